@@ -0,0 +1,929 @@
+#include <unicodelib.h>
+#include <unicodelib_encodings.h>
+#include "unicodelib_data.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace unicode;
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+static volatile size_t sink;
+
+static size_t allocation_count = 0;
+
+void *operator new(size_t size) {
+  allocation_count++;
+  if (auto p = malloc(size)) {
+    return p;
+  }
+  throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+
+template <typename Fn> double measure_ms(size_t repeat, Fn fn) {
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < repeat; i++) {
+    fn();
+  }
+  auto end = chrono::steady_clock::now();
+  return chrono::duration<double, milli>(end - start).count();
+}
+
+static double mega_per_second(size_t count, double ms) {
+  return static_cast<double>(count) / (ms * 1000.0);
+}
+
+// Deterministic pseudo random text mixing Latin, Greek, Cyrillic, Arabic,
+// Devanagari, Han, Hangul and emoji code points.
+static u32string mixed_script_text(size_t l) {
+  static const char32_t ranges[][2] = {
+      {0x0020, 0x007E}, {0x00C0, 0x017F}, {0x0391, 0x03C9},
+      {0x0410, 0x044F}, {0x0621, 0x064A}, {0x0905, 0x0939},
+      {0x4E00, 0x9FEF}, {0xAC00, 0xD7A3}, {0x1F300, 0x1F64F},
+  };
+  const size_t range_count = sizeof(ranges) / sizeof(ranges[0]);
+
+  u32string s32;
+  uint32_t seed = 2463534242u;
+  for (size_t i = 0; i < l; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    const auto &r = ranges[seed % range_count];
+    s32 += static_cast<char32_t>(r[0] + (seed >> 8) % (r[1] - r[0] + 1));
+  }
+  return s32;
+}
+
+// English prose with punctuation, digits and a few accented letters.
+static u32string english_text(size_t l) {
+  static const char32_t sentence[] =
+      U"The quick brown fox jumps over the lazy dog. It's 3.14 o'clock; "
+      U"na\u00EFve caf\u00E9 owners don't \"care\" (much)! Really? ";
+
+  u32string s32;
+  while (s32.size() < l) {
+    s32 += sentence;
+  }
+  s32.resize(l);
+  return s32;
+}
+
+// German and French prose, where about one letter in ten is Latin-1.
+static u32string latin1_text(size_t l) {
+  static const char32_t sentence[] =
+      U"Gr\u00FC\u00DFe aus K\u00F6ln: die Stra\u00DFe ist f\u00FCr "
+      U"Fu\u00DFg\u00E4nger gesperrt. O\u00F9 est le caf\u00E9 pr\u00E8s "
+      U"de l'h\u00F4tel? \u00C0 c\u00F4t\u00E9 du th\u00E9\u00E2tre. ";
+
+  u32string s32;
+  while (s32.size() < l) {
+    s32 += sentence;
+  }
+  s32.resize(l);
+  return s32;
+}
+
+//-----------------------------------------------------------------------------
+// Code point trie
+//-----------------------------------------------------------------------------
+
+template <typename T> size_t trie_footprint(const CodePointTrie<T> &trie) {
+  const size_t block_size =
+      1 << (CodePointTrie<T>::Shift1 - CodePointTrie<T>::Shift2);
+  const size_t leaf_size = 1 << CodePointTrie<T>::Shift2;
+
+  size_t n1 = 0x110000 >> CodePointTrie<T>::Shift1;
+  size_t n2 = 0;
+  for (size_t i = 0; i < n1; i++) {
+    n2 = max(n2, trie.stage1[i] + block_size);
+  }
+  size_t n3 = 0;
+  for (size_t i = 0; i < n2; i++) {
+    n3 = max(n3, trie.stage2[i] + leaf_size);
+  }
+  return (n1 + n2) * sizeof(uint16_t) + n3 * sizeof(T);
+}
+
+template <typename T> static vector<T> flatten(const CodePointTrie<T> &trie) {
+  vector<T> flat(0x110000);
+  for (char32_t cp = 0; cp < 0x110000; cp++) {
+    flat[cp] = trie[cp];
+  }
+  return flat;
+}
+
+template <typename T>
+static void bench_trie(const char *name, const CodePointTrie<T> &trie,
+                       const u32string &text) {
+  auto flat = flatten(trie);
+
+  const size_t repeat = 20;
+  size_t acc = 0;
+  auto flat_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += static_cast<size_t>(flat[cp]);
+    }
+  });
+  auto trie_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += static_cast<size_t>(trie[cp]);
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10zu %10zu %10.1f %10.1f\n", name, flat.size() * sizeof(T),
+         trie_footprint(trie), mega_per_second(text.size() * repeat, flat_ms),
+         mega_per_second(text.size() * repeat, trie_ms));
+}
+
+// Reads every table for each code point, as the segmentation and casing code
+// does. The flat tables no longer fit in the cache together.
+static void bench_trie_all_tables(const u32string &text) {
+  const auto &t = _builtin_tables;
+  auto gc = flatten(t.general_category_properties);
+  auto prop = flatten(t.properties);
+  auto dprop = flatten(t.derived_core_properties);
+  auto blk = flatten(t.block_properties);
+  auto sc = flatten(t.script_properties);
+  auto scx = flatten(t.script_extension_ids);
+  auto record = flatten(t.code_point_record_ids);
+
+  const size_t repeat = 20;
+  size_t acc = 0;
+  auto flat_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += static_cast<size_t>(gc[cp]) + prop[cp] + dprop[cp] +
+             static_cast<size_t>(blk[cp]) + static_cast<size_t>(sc[cp]) +
+             static_cast<size_t>(scx[cp]) +
+             t.code_point_records[record[cp]].combining_class;
+    }
+  });
+  auto trie_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += static_cast<size_t>(t.general_category_properties[cp]) +
+             t.properties[cp] + t.derived_core_properties[cp] +
+             static_cast<size_t>(t.block_properties[cp]) +
+             static_cast<size_t>(t.script_properties[cp]) +
+             static_cast<size_t>(t.script_extension_ids[cp]) +
+             code_point_record(&t, cp).combining_class;
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10s %10s %10.1f %10.1f\n", "all tables", "", "",
+         mega_per_second(text.size() * repeat, flat_ms),
+         mega_per_second(text.size() * repeat, trie_ms));
+}
+
+static void bench_trie_tables() {
+  auto text = mixed_script_text(1 << 20);
+  const auto &t = _builtin_tables;
+
+  printf("%-28s %10s %10s %10s %10s\n", "table", "flat(B)", "trie(B)",
+         "flat(M/s)", "trie(M/s)");
+  bench_trie("general_category", t.general_category_properties, text);
+  bench_trie("properties", t.properties, text);
+  bench_trie("derived_core_properties", t.derived_core_properties, text);
+  bench_trie("block", t.block_properties, text);
+  bench_trie("script", t.script_properties, text);
+  bench_trie("script_extension_ids", t.script_extension_ids, text);
+  bench_trie("code_point_record_ids", t.code_point_record_ids, text);
+  bench_trie("combining_class", t.combining_class_properties, text);
+  bench_trie("decomposition", t.decomposition_properties, text);
+  bench_trie_all_tables(text);
+}
+
+//-----------------------------------------------------------------------------
+// Property
+//-----------------------------------------------------------------------------
+
+// Classifies each code point with several properties, as a tokenizer does.
+static void bench_property() {
+  const size_t repeat = 20;
+  auto text = mixed_script_text(1 << 18);
+  size_t acc = 0;
+
+  auto predicates_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += is_white_space(cp) + is_pattern_white_space(cp) +
+             is_pattern_syntax(cp) + is_xid_start(cp) + is_xid_continue(cp) +
+             is_default_ignorable_code_point(cp);
+    }
+  });
+
+  auto masks_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      auto props = property_mask(cp);
+      auto derived = derived_property_mask(cp);
+      acc += ((props & Property_White_Space) != 0) +
+             ((props & Property_Pattern_White_Space) != 0) +
+             ((props & Property_Pattern_Syntax) != 0) +
+             ((derived & DerivedProperty_XID_Start) != 0) +
+             ((derived & DerivedProperty_XID_Continue) != 0) +
+             ((derived & DerivedProperty_Default_Ignorable_Code_Point) != 0);
+    }
+  });
+
+  auto categories = vector<GeneralCategory>(text.size());
+  general_categories(text.data(), text.size(), categories.data());
+  auto groups_ms = measure_ms(repeat, [&] {
+    for (auto gc : categories) {
+      acc += is_letter_category(gc) + is_mark_category(gc) +
+             is_number_category(gc) + is_punctuation_category(gc) +
+             is_symbol_category(gc) + is_separator_category(gc);
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10s\n", "function", "M/s");
+  printf("%-28s %10.1f\n", "6 is_* predicates",
+         mega_per_second(text.size() * repeat, predicates_ms));
+  printf("%-28s %10.1f\n", "2 masks",
+         mega_per_second(text.size() * repeat, masks_ms));
+  printf("%-28s %10.1f\n", "6 category groups",
+         mega_per_second(text.size() * repeat, groups_ms));
+}
+
+//-----------------------------------------------------------------------------
+// Latin-1 fast path
+//-----------------------------------------------------------------------------
+
+// ASCII log lines, as a log parser or tokenizer sees them.
+static u32string log_text(size_t l) {
+  static const char32_t lines[] =
+      U"2020-03-10T12:34:56.789Z INFO  [worker-3] GET /api/v1/items?id=42 "
+      U"200 12ms user=alice\n"
+      U"2020-03-10T12:34:57.012Z WARN  [worker-1] Slow query (1532 ms): "
+      U"SELECT * FROM orders WHERE status = 'open';\n"
+      U"2020-03-10T12:34:57.345Z ERROR [main] Connection reset by peer, "
+      U"retrying in 5s...\n";
+
+  u32string s32;
+  while (s32.size() < l) {
+    s32 += lines;
+  }
+  s32.resize(l);
+  return s32;
+}
+
+template <typename Fn>
+static double measure_each_ms(size_t repeat, const u32string &text, Fn fn) {
+  size_t acc = 0;
+  auto ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += static_cast<size_t>(fn(cp));
+    }
+  });
+  sink = acc;
+  return ms;
+}
+
+// Compares the inline functions with the context overloads, which are the
+// out-of-line calls they replace.
+static void bench_latin1() {
+  const size_t repeat = 20;
+  auto text = log_text(1 << 18);
+  auto ctx = default_data_context();
+
+  auto run = [&](const char *name, double inline_ms, double call_ms) {
+    printf("%-28s %10.1f %10.1f\n", name,
+           mega_per_second(text.size() * repeat, inline_ms),
+           mega_per_second(text.size() * repeat, call_ms));
+  };
+
+  printf("%-28s %10s %10s\n", "function", "inline", "call");
+  run("general_category",
+      measure_each_ms(repeat, text,
+                      [](char32_t cp) { return general_category(cp); }),
+      measure_each_ms(repeat, text,
+                      [&](char32_t cp) { return general_category(ctx, cp); }));
+  run("is_letter",
+      measure_each_ms(repeat, text, [](char32_t cp) { return is_letter(cp); }),
+      measure_each_ms(repeat, text,
+                      [&](char32_t cp) { return is_letter(ctx, cp); }));
+  run("is_white_space",
+      measure_each_ms(repeat, text,
+                      [](char32_t cp) { return is_white_space(cp); }),
+      measure_each_ms(repeat, text,
+                      [&](char32_t cp) { return is_white_space(ctx, cp); }));
+  run("simple_lowercase_mapping",
+      measure_each_ms(repeat, text,
+                      [](char32_t cp) { return simple_lowercase_mapping(cp); }),
+      measure_each_ms(repeat, text, [&](char32_t cp) {
+        return simple_lowercase_mapping(ctx, cp);
+      }));
+}
+
+//-----------------------------------------------------------------------------
+// Batch lookup
+//-----------------------------------------------------------------------------
+
+template <typename T, typename Single, typename Batch>
+static void bench_batch_function(const char *name, const u32string &text,
+                                 Single single, Batch batch) {
+  const size_t repeat = 20;
+  vector<T> out(text.size());
+
+  auto single_ms = measure_ms(repeat, [&] {
+    for (size_t i = 0; i < text.size(); i++) {
+      out[i] = single(text[i]);
+    }
+    sink = static_cast<size_t>(out.back());
+  });
+
+  auto batch_ms = measure_ms(repeat, [&] {
+    batch(text.data(), text.size(), out.data());
+    sink = static_cast<size_t>(out.back());
+  });
+
+  printf("%-28s %10.1f %10.1f\n", name,
+         mega_per_second(text.size() * repeat, single_ms),
+         mega_per_second(text.size() * repeat, batch_ms));
+}
+
+// Compares a batch lookup with a loop calling the context overload for each
+// code point.
+static void bench_batch_text(const char *text_name, const u32string &text) {
+  auto ctx = default_data_context();
+
+  printf("%-28s %10s %10s\n", text_name, "per cp", "batch");
+  bench_batch_function<GeneralCategory>(
+      "general_categories", text,
+      [&](char32_t cp) { return general_category(ctx, cp); },
+      [&](const char32_t *s32, size_t l, GeneralCategory *out) {
+        general_categories(ctx, s32, l, out);
+      });
+  bench_batch_function<uint64_t>(
+      "property_masks", text,
+      [&](char32_t cp) { return property_mask(ctx, cp); },
+      [&](const char32_t *s32, size_t l, uint64_t *out) {
+        property_masks(ctx, s32, l, out);
+      });
+  bench_batch_function<Script>(
+      "scripts", text, [&](char32_t cp) { return script(ctx, cp); },
+      [&](const char32_t *s32, size_t l, Script *out) {
+        scripts(ctx, s32, l, out);
+      });
+  bench_batch_function<GraphemeBreak>(
+      "grapheme_breaks", text,
+      [&](char32_t cp) { return grapheme_break(ctx, cp); },
+      [&](const char32_t *s32, size_t l, GraphemeBreak *out) {
+        grapheme_breaks(ctx, s32, l, out);
+      });
+  bench_batch_function<uint8_t>(
+      "combining_classes", text,
+      [&](char32_t cp) { return combining_class(ctx, cp); },
+      [&](const char32_t *s32, size_t l, uint8_t *out) {
+        combining_classes(ctx, s32, l, out);
+      });
+  bench_batch_function<HangulSyllableType>(
+      "hangul_syllable_types", text,
+      [&](char32_t cp) { return hangul_syllable_type(ctx, cp); },
+      [&](const char32_t *s32, size_t l, HangulSyllableType *out) {
+        hangul_syllable_types(ctx, s32, l, out);
+      });
+}
+
+static void bench_batch() {
+  bench_batch_text("mixed script", mixed_script_text(1 << 18));
+  bench_batch_text("log lines", log_text(1 << 18));
+}
+
+//-----------------------------------------------------------------------------
+// Code point set
+//-----------------------------------------------------------------------------
+
+// Builds the identifier class "XID_Continue minus Han plus U+002D" and tests
+// membership, compared with calling the predicates for each code point.
+static void bench_code_point_set() {
+  const size_t repeat = 20;
+  auto text = mixed_script_text(1 << 18);
+  size_t acc = 0;
+
+  auto xid_continue = derived_property_set(DerivedProperty_XID_Continue);
+  auto han = script_set(Script::Han);
+  auto dash = CodePointSet(U'-', U'-');
+
+  auto factory_ms = measure_ms(repeat, [&] {
+    acc += derived_property_set(DerivedProperty_XID_Continue).size();
+  });
+
+  CodePointSet id;
+  auto algebra_ms = measure_ms(repeat, [&] {
+    id = xid_continue - han | dash;
+    acc += id.size();
+  });
+
+  auto contains_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += id.contains(cp);
+    }
+  });
+
+  auto predicates_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += (is_xid_continue(cp) && script(cp) != Script::Han) || cp == U'-';
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10s\n", "measure", "value");
+  printf("%-28s %10zu\n", "ranges", id.inversion_list().size() / 2);
+  printf("%-28s %10.3f\n", "factory (ms)", factory_ms / repeat);
+  printf("%-28s %10.3f\n", "difference, union (ms)", algebra_ms / repeat);
+  printf("%-28s %10.1f\n", "contains (M/s)",
+         mega_per_second(text.size() * repeat, contains_ms));
+  printf("%-28s %10.1f\n", "predicates (M/s)",
+         mega_per_second(text.size() * repeat, predicates_ms));
+}
+
+// Builds the sets that a regex compiler builds for property escapes.
+template <typename Fn>
+static void bench_set_factory(const char *name, Fn factory) {
+  const size_t repeat = 20;
+  size_t acc = 0;
+  auto ms = measure_ms(repeat, [&] { acc += factory().size(); });
+  sink = acc;
+  printf("%-28s %10zu %10.4f\n", name,
+         factory().inversion_list().size() / 2, ms / repeat);
+}
+
+static void bench_set_factories() {
+  printf("%-28s %10s %10s\n", "set", "ranges", "build (ms)");
+  bench_set_factory("gc=Lu",
+                    [] { return general_category_set(GeneralCategory::Lu); });
+  bench_set_factory("gc=L", [] {
+    PropertyValue pv;
+    resolve_property("gc=L", pv);
+    return property_value_set(pv);
+  });
+  bench_set_factory("sc=Greek", [] { return script_set(Script::Greek); });
+  bench_set_factory("sc=Han", [] { return script_set(Script::Han); });
+  bench_set_factory("blk=Basic Latin",
+                    [] { return block_set(Block::BasicLatin); });
+  bench_set_factory("White_Space",
+                    [] { return property_set(Property_White_Space); });
+  bench_set_factory("XID_Continue", [] {
+    return derived_property_set(DerivedProperty_XID_Continue);
+  });
+  bench_set_factory("WB=ALetter", [] {
+    return property_value_set({PropertyType::Word_Break,
+                               static_cast<uint64_t>(WordBreak::ALetter),
+                               false});
+  });
+}
+
+//-----------------------------------------------------------------------------
+// Property ranges
+//-----------------------------------------------------------------------------
+
+// Collects the ranges of a property value as a lexer generator does, from the
+// range index and by looking up every code point.
+template <typename T, typename Fn>
+static void bench_ranges_of(const char *name, T value, Fn fn) {
+  const size_t repeat = 20;
+  size_t acc = 0;
+
+  auto index_ms = measure_ms(repeat, [&] {
+    for_each_range(value, [&](char32_t first, char32_t last) {
+      acc += last - first + 1;
+    });
+  });
+
+  auto scan_ms = measure_ms(repeat, [&] {
+    for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+      acc += fn(cp) == value;
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10zu %10.4f %10.3f\n", name, code_point_ranges(value).count,
+         index_ms / repeat, scan_ms / repeat);
+}
+
+static void bench_ranges() {
+  printf("%-28s %10s %10s %10s\n", "value", "ranges", "index (ms)",
+         "scan (ms)");
+  bench_ranges_of("WordBreak::ALetter", WordBreak::ALetter,
+                  [](char32_t cp) { return word_break(cp); });
+  bench_ranges_of("Script::Greek", Script::Greek,
+                  [](char32_t cp) { return script(cp); });
+  bench_ranges_of("GeneralCategory::Lu", GeneralCategory::Lu,
+                  [](char32_t cp) { return general_category(cp); });
+}
+
+//-----------------------------------------------------------------------------
+// Property names
+//-----------------------------------------------------------------------------
+
+// Resolves the property escapes of a regex, as a regex compiler does.
+static void bench_property_names() {
+  const size_t repeat = 20;
+  const char *expressions[] = {
+      "Script=Greek", "gc=Lu",           "L",
+      "Alphabetic",   "isAlphabetic",    "White_Space=No",
+      "Han",          "blk=Basic Latin", "WB=ALetter",
+      "Nd",           "XID_Continue",    "Klingon",
+  };
+  const size_t count = 1000;
+  size_t acc = 0;
+
+  auto resolve_ms = measure_ms(repeat, [&] {
+    for (size_t i = 0; i < count; i++) {
+      for (auto s : expressions) {
+        PropertyValue pv;
+        acc += resolve_property(s, strlen(s), pv);
+      }
+    }
+  });
+  sink = acc;
+
+  auto resolved = count * (sizeof(expressions) / sizeof(expressions[0]));
+  printf("%-28s %10s\n", "measure", "value");
+  printf("%-28s %10.1f\n", "resolve (ns)",
+         resolve_ms * 1000000.0 / (resolved * repeat));
+}
+
+//-----------------------------------------------------------------------------
+// Normalization
+//-----------------------------------------------------------------------------
+
+// All fields of 'NormalizationTest.txt', one string per field.
+static vector<u32string> normalization_test_strings() {
+  vector<u32string> strs;
+  ifstream fs("../../UCD/NormalizationTest.txt");
+  string line;
+  while (getline(fs, line)) {
+    if (line.empty() || line[0] == '#' || line[0] == '@') {
+      continue;
+    }
+    line.erase(line.find("; #"));
+
+    stringstream ss(line);
+    string field;
+    while (getline(ss, field, ';')) {
+      u32string s32;
+      stringstream fss(field);
+      int val;
+      while (fss >> hex >> val) {
+        s32 += static_cast<char32_t>(val);
+      }
+      strs.push_back(s32);
+    }
+  }
+  return strs;
+}
+
+static void bench_normalization() {
+  auto strs = normalization_test_strings();
+  if (strs.empty()) {
+    printf("'NormalizationTest.txt' is not found.\n");
+    return;
+  }
+
+  size_t count = 0;
+  for (const auto &s : strs) {
+    count += s.size();
+  }
+
+  const size_t repeat = 10;
+  size_t acc = 0;
+  auto run = [&](const char *name, u32string (*fn)(const u32string &)) {
+    auto allocations = allocation_count;
+    auto ms = measure_ms(repeat, [&] {
+      for (const auto &s : strs) {
+        acc += fn(s).size();
+      }
+    });
+    allocations = allocation_count - allocations;
+    printf("%-28s %10.1f %10.2f\n", name, mega_per_second(count * repeat, ms),
+           static_cast<double>(allocations) / (strs.size() * repeat));
+  };
+
+  // The same with one output string reused for every call.
+  u32string out;
+  auto run_into = [&](const char *name,
+                      void (*fn)(const u32string &, u32string &)) {
+    auto allocations = allocation_count;
+    auto ms = measure_ms(repeat, [&] {
+      for (const auto &s : strs) {
+        out.clear();
+        fn(s, out);
+        acc += out.size();
+      }
+    });
+    allocations = allocation_count - allocations;
+    printf("%-28s %10.1f %10.2f\n", name, mega_per_second(count * repeat, ms),
+           static_cast<double>(allocations) / (strs.size() * repeat));
+  };
+
+  printf("%-28s %10s %10s\n", "function", "M/s", "allocs");
+  run("to_nfc", to_nfc);
+  run("to_nfd", to_nfd);
+  run("to_nfkc", to_nfkc);
+  run("to_nfkd", to_nfkd);
+  run_into("to_nfc (reused output)", to_nfc);
+  run_into("to_nfd (reused output)", to_nfd);
+  run_into("to_nfkc (reused output)", to_nfkc);
+  run_into("to_nfkd (reused output)", to_nfkd);
+  sink = acc;
+}
+
+//-----------------------------------------------------------------------------
+// Segmentation
+//-----------------------------------------------------------------------------
+
+static void bench_segmentation_text(const char *text_name,
+                                    const u32string &text) {
+  const size_t repeat = 5;
+  auto s32 = text.data();
+  auto l = text.size();
+  size_t acc = 0;
+
+  auto run = [&](const char *name,
+                 bool (*fn)(const char32_t *, size_t, size_t)) {
+    auto ms = measure_ms(repeat, [&] {
+      for (size_t i = 0; i <= l; i++) {
+        acc += fn(s32, l, i);
+      }
+    });
+    printf("%-12s %-15s %10.1f\n", text_name, name,
+           mega_per_second(l * repeat, ms));
+  };
+
+  run("grapheme", is_grapheme_boundary);
+  run("word", is_word_boundary);
+  run("sentence", is_sentence_boundary);
+  sink = acc;
+}
+
+static void bench_segmentation() {
+  printf("%-12s %-15s %10s\n", "text", "boundary", "M/s");
+  bench_segmentation_text("english", english_text(1 << 18));
+  bench_segmentation_text("mixed", mixed_script_text(1 << 18));
+}
+
+//-----------------------------------------------------------------------------
+// Casing
+//-----------------------------------------------------------------------------
+
+static void bench_casing_text(const char *text_name, const u32string &text) {
+  const size_t repeat = 5;
+  auto lower = to_lowercase(text);
+  size_t acc = 0;
+
+  auto run = [&](const char *name, const u32string &s32,
+                 size_t (*fn)(const u32string &)) {
+    auto ms = measure_ms(repeat, [&] { acc += fn(s32); });
+    printf("%-12s %-15s %10.1f\n", text_name, name,
+           mega_per_second(s32.size() * repeat, ms));
+  };
+
+  run("to_uppercase", text,
+      [](const u32string &s) { return to_uppercase(s).size(); });
+  run("to_lowercase", text,
+      [](const u32string &s) { return to_lowercase(s).size(); });
+  run("to_titlecase", text,
+      [](const u32string &s) { return to_titlecase(s).size(); });
+  run("to_case_fold", text,
+      [](const u32string &s) { return to_case_fold(s).size(); });
+  run("to_lower (out)", text, [](const u32string &s) {
+    static u32string out;
+    out.clear();
+    to_lowercase(s, out);
+    return out.size();
+  });
+  run("simple_upper", text, [](const u32string &s) {
+    size_t n = 0;
+    for (auto cp : s) {
+      n += simple_uppercase_mapping(cp);
+    }
+    return n;
+  });
+  run("simple_fold", text, [](const u32string &s) {
+    size_t n = 0;
+    for (auto cp : s) {
+      n += simple_case_folding(cp);
+    }
+    return n;
+  });
+  // Lowercased first so that the predicate scans the whole text.
+  run("is_lowercase", lower,
+      [](const u32string &s) { return static_cast<size_t>(is_lowercase(s)); });
+
+  // UTF-8 in and out, against decoding, mapping and encoding. The rates are
+  // in code points as above.
+  auto s8 = utf8::encode(text);
+  auto run_utf8 = [&](const char *name, size_t (*fn)(const string &)) {
+    auto ms = measure_ms(repeat, [&] { acc += fn(s8); });
+    printf("%-12s %-15s %10.1f\n", text_name, name,
+           mega_per_second(text.size() * repeat, ms));
+  };
+
+  run_utf8("upper utf8",
+           [](const string &s) { return to_uppercase(s).size(); });
+  run_utf8("upper via u32", [](const string &s) {
+    return utf8::encode(to_uppercase(utf8::decode(s))).size();
+  });
+  run_utf8("lower utf8",
+           [](const string &s) { return to_lowercase(s).size(); });
+  run_utf8("lower via u32", [](const string &s) {
+    return utf8::encode(to_lowercase(utf8::decode(s))).size();
+  });
+  run_utf8("fold utf8",
+           [](const string &s) { return to_case_fold(s).size(); });
+  run_utf8("fold via u32", [](const string &s) {
+    return utf8::encode(to_case_fold(utf8::decode(s))).size();
+  });
+  sink = acc;
+}
+
+static void bench_casing() {
+  printf("%-12s %-15s %10s\n", "text", "function", "M/s");
+  bench_casing_text("ascii", log_text(1 << 18));
+  bench_casing_text("english", english_text(1 << 18));
+  bench_casing_text("latin1", latin1_text(1 << 18));
+  bench_casing_text("mixed", mixed_script_text(1 << 18));
+}
+
+//-----------------------------------------------------------------------------
+// Script
+//-----------------------------------------------------------------------------
+
+// Japanese text has many Common characters with script extensions.
+static u32string japanese_text(size_t l) {
+  static const char32_t sentence[] =
+      U"ユーザー・インターフェース（ＵＩ）の「テスト」を、明日ー〜三回行う。";
+
+  u32string s32;
+  while (s32.size() < l) {
+    s32 += sentence;
+  }
+  s32.resize(l);
+  return s32;
+}
+
+static void bench_script() {
+  const size_t repeat = 20;
+  auto text = japanese_text(1 << 18);
+  size_t acc = 0;
+
+  auto is_script_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += is_script(Script::Katakana, cp);
+    }
+  });
+
+  auto intersection_ms = measure_ms(repeat, [&] {
+    ScriptSet set = script_extensions(text[0]);
+    for (auto cp : text) {
+      set &= script_extensions(cp);
+    }
+    acc += set.empty();
+  });
+  sink = acc;
+
+  printf("%-28s %10s\n", "function", "M/s");
+  printf("%-28s %10.1f\n", "is_script",
+         mega_per_second(text.size() * repeat, is_script_ms));
+  printf("%-28s %10.1f\n", "script_extensions &=",
+         mega_per_second(text.size() * repeat, intersection_ms));
+}
+
+//-----------------------------------------------------------------------------
+// Emoji
+//-----------------------------------------------------------------------------
+
+// Chat messages, mostly ASCII with emoji and their modifiers and joiners.
+static u32string chat_text(size_t l) {
+  static const char32_t messages[] =
+      U"see you at 7? \U0001F44D\U0001F3FD\n"
+      U"lol \U0001F602\U0001F602 that was great\n"
+      U"new phone who dis \U0001F469\u200D\U0001F4BB #blessed\n"
+      U"\u2764\uFE0F thanks everyone!\n";
+
+  u32string s32;
+  while (s32.size() < l) {
+    s32 += messages;
+  }
+  s32.resize(l);
+  return s32;
+}
+
+// Flags each message that has an emoji, as a moderation filter does.
+static void bench_emoji() {
+  const size_t repeat = 20;
+  auto text = chat_text(1 << 18);
+  size_t acc = 0;
+
+  auto predicate_ms = measure_ms(repeat, [&] {
+    for (auto cp : text) {
+      acc += is_emoji_presentation(cp) || is_extended_pictographic(cp);
+    }
+  });
+
+  vector<uint8_t> masks(text.size());
+  auto batch_ms = measure_ms(repeat, [&] {
+    emoji_property_masks(text.data(), text.size(), masks.data());
+    for (auto mask : masks) {
+      acc += (mask & (EmojiProperty_Emoji_Presentation |
+                      EmojiProperty_Extended_Pictographic)) != 0;
+    }
+  });
+  sink = acc;
+
+  printf("%-28s %10s\n", "function", "M/s");
+  printf("%-28s %10.1f\n", "2 is_* predicates",
+         mega_per_second(text.size() * repeat, predicate_ms));
+  printf("%-28s %10.1f\n", "emoji_property_masks",
+         mega_per_second(text.size() * repeat, batch_ms));
+}
+
+//-----------------------------------------------------------------------------
+// Startup
+//-----------------------------------------------------------------------------
+
+static const char *program_path = nullptr;
+static size_t allocations_before_main = 0;
+
+// Spawns this program with '--startup-probe', which returns from 'main'
+// immediately, to time a cold process start with all tables linked in.
+static void bench_startup() {
+  const size_t repeat = 100;
+  auto cmd = string(program_path) + " --startup-probe";
+  auto ms = measure_ms(repeat, [&] {
+    if (system(cmd.c_str()) != 0) {
+      printf("'%s' failed.\n", cmd.c_str());
+    }
+  });
+
+  printf("%-28s %10s\n", "measure", "value");
+  printf("%-28s %10.3f\n", "process start (ms)", ms / repeat);
+  printf("%-28s %10zu\n", "allocations before main", allocations_before_main);
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+struct Benchmark {
+  const char *name;
+  void (*fn)();
+};
+
+int main(int argc, const char **argv) {
+  allocations_before_main = allocation_count;
+  program_path = argv[0];
+
+  if (argc == 2 && !strcmp(argv[1], "--startup-probe")) {
+    // Keep the tables referenced so that the linker can't drop them.
+    return to_uppercase(U"a") == U"A" ? 0 : 1;
+  }
+
+  static const Benchmark benchmarks[] = {
+      {"trie", bench_trie_tables},
+      {"property", bench_property},
+      {"latin1", bench_latin1},
+      {"batch", bench_batch},
+      {"set", bench_code_point_set},
+      {"factories", bench_set_factories},
+      {"ranges", bench_ranges},
+      {"names", bench_property_names},
+      {"normalization", bench_normalization},
+      {"segmentation", bench_segmentation},
+      {"casing", bench_casing},
+      {"script", bench_script},
+      {"emoji", bench_emoji},
+      {"startup", bench_startup},
+  };
+
+  for (const auto &b : benchmarks) {
+    bool run = argc < 2;
+    for (int i = 1; i < argc; i++) {
+      run = run || !strcmp(argv[i], b.name);
+    }
+    if (run) {
+      printf("[%s]\n", b.name);
+      b.fn();
+      printf("\n");
+    }
+  }
+  return 0;
+}
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
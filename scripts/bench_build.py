@@ -0,0 +1,43 @@
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+#------------------------------------------------------------------------------
+# Measures how long the compiler takes to build each generated data unit and
+# how much memory it needs. Usage:
+#
+#   python bench_build.py CXX [FLAGS...]
+#
+# The 'bench-build' target in 'bench/CMakeLists.txt' runs it with the bench
+# compiler and flags.
+#------------------------------------------------------------------------------
+
+src = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+units = sorted(name for name in os.listdir(src)
+               if name.startswith('data_') and name.endswith('.cpp') and
+               name not in ('data_file.cpp', 'data_tables.cpp'))
+
+command = sys.argv[1:] + ['-std=c++1y', '-I' + os.path.join(src, '..'),
+                          '-I' + src, '-c']
+obj = os.path.join(tempfile.mkdtemp(), 'unit.o')
+
+print("%-40s %10s %10s" % ("unit", "sec", "max MB"))
+
+total = 0
+maxMemory = 0
+for name in units:
+    start = time.time()
+    process = subprocess.Popen(command + [os.path.join(src, name), '-o', obj])
+    _, status, usage = os.wait4(process.pid, 0)
+    seconds = time.time() - start
+    if status != 0:
+        sys.exit("failed to compile %s" % name)
+    memory = usage.ru_maxrss / 1024.0
+    print("%-40s %10.2f %10.1f" % (name, seconds, memory))
+    total += seconds
+    maxMemory = max(maxMemory, memory)
+
+os.remove(obj)
+print("%-40s %10.2f %10.1f" % ("total", total, maxMemory))
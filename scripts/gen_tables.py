@@ -1,5 +1,6 @@
 import sys
 import re
+import struct
 
 #------------------------------------------------------------------------------
 # Constants
@@ -7,14 +8,201 @@ import re
 
 MaxCode = 0x0010FFFF
 
+# This list must match 'GeneralCategory' in 'unicodelib.h'.
+GeneralCategories = [
+    'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc',
+    'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl',
+    'Zp', 'Cc', 'Cf', 'Cs', 'Co', 'Cn',
+]
+
+# The long names of 'GeneralCategories', with the other aliases of UAX #44.
+GeneralCategoryNames = [
+    ['Uppercase_Letter'], ['Lowercase_Letter'], ['Titlecase_Letter'],
+    ['Modifier_Letter'], ['Other_Letter'], ['Nonspacing_Mark'],
+    ['Spacing_Mark'], ['Enclosing_Mark'], ['Decimal_Number', 'digit'],
+    ['Letter_Number'], ['Other_Number'], ['Connector_Punctuation'],
+    ['Dash_Punctuation'], ['Open_Punctuation'], ['Close_Punctuation'],
+    ['Initial_Punctuation'], ['Final_Punctuation'], ['Other_Punctuation'],
+    ['Math_Symbol'], ['Currency_Symbol'], ['Modifier_Symbol'],
+    ['Other_Symbol'], ['Space_Separator'], ['Line_Separator'],
+    ['Paragraph_Separator'], ['Control', 'cntrl'], ['Format'], ['Surrogate'],
+    ['Private_Use'], ['Unassigned'],
+]
+
+# The groups of general categories that a property expression can name.
+GeneralCategoryGroups = [
+    (['L', 'Letter'], ['Lu', 'Ll', 'Lt', 'Lm', 'Lo']),
+    (['LC', 'Cased_Letter', 'L&'], ['Lu', 'Ll', 'Lt']),
+    (['M', 'Mark', 'Combining_Mark'], ['Mn', 'Mc', 'Me']),
+    (['N', 'Number'], ['Nd', 'Nl', 'No']),
+    (['P', 'Punctuation', 'punct'],
+     ['Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po']),
+    (['S', 'Symbol'], ['Sm', 'Sc', 'Sk', 'So']),
+    (['Z', 'Separator'], ['Zs', 'Zl', 'Zp']),
+    (['C', 'Other'], ['Cc', 'Cf', 'Cs', 'Co', 'Cn']),
+]
+
+# This list must match 'PropertyType' in 'unicodelib.h'. The first names are
+# the enumerated properties, followed by their aliases.
+PropertyTypes = [
+    ['General_Category', 'gc'],
+    ['Script', 'sc'],
+    ['Block', 'blk'],
+    ['Grapheme_Cluster_Break', 'GCB'],
+    ['Word_Break', 'WB'],
+    ['Sentence_Break', 'SB'],
+    ['Property'],
+    ['Derived_Property'],
+]
+
+# This list must match 'SpecialCasingContext' in 'src/unicodelib_data.h'.
+SpecialCasingContexts = [
+    'Unassigned', 'Final_Sigma', 'Not_Final_Sigma', 'After_Soft_Dotted',
+    'More_Above', 'Before_Dot', 'Not_Before_Dot', 'After_I',
+]
+
 #------------------------------------------------------------------------------
 # Utilities
 #------------------------------------------------------------------------------
 
-def to_unicode_literal(str):
-    if len(str):
-        return 'U"%s"' % ''.join([('\\U%08X' % x) for x in str])
-    return 'nullptr'
+# Values of an enum generated by 'gen_property_values.py', which lists them in
+# the order of first appearance after 'Unassigned'.
+def property_value_names(path):
+    r = re.compile(r"^[0-9A-F]+(?:\.\.[0-9A-F]+)?\s*;\s*(.+?)\s*(?:#.+)?$")
+    names = ['Unassigned']
+    for line in open(path):
+        m = r.match(line)
+        if m:
+            name = ''.join([x.title() if x.islower() else x for x in re.split(r"[ -]", m.group(1))])
+            if not name in names:
+                names.append(name)
+    return names
+
+# The generated tables depend on the numbering of these enums.
+def write_enum_asserts(fout, enum, names):
+    for i, name in enumerate(names):
+        fout.write("static_assert(static_cast<int>(%s::%s) == %d, \"\");\n" %
+                   (enum, name, i))
+
+#------------------------------------------------------------------------------
+# Data file
+#------------------------------------------------------------------------------
+
+# Every table is also collected as a named section of the data file, which
+# 'load_data_file' maps instead of the compiled-in tables. The layout must
+# match 'src/data_file.cpp'. All values are little-endian.
+DataFileMagic = b'UCDTABLE'
+DataFileFormatVersion = 4
+DataFileAlignment = 16
+
+sections = []
+
+def add_section(name, fmt, values):
+    data = b''.join([struct.pack('<' + fmt, *(v if type(v) is tuple else (v,)))
+                     for v in values])
+    sections.append((name, struct.calcsize('<' + fmt), len(values), data))
+
+def write_data_file(path, unicodeVersion):
+    headerSize = struct.calcsize('<8sII16sII')
+    sectionSize = struct.calcsize('<48sIIII')
+
+    offset = headerSize + sectionSize * len(sections)
+    entries = b''
+    body = b''
+    for name, elementSize, count, data in sections:
+        padding = -(offset + len(body)) % DataFileAlignment
+        body += b'\0' * padding
+        entries += struct.pack('<48sIIII', name.encode(), elementSize, count,
+                               offset + len(body), 0)
+        body += data
+
+    header = struct.pack('<8sII16sII', DataFileMagic, DataFileFormatVersion,
+                         0x01020304, unicodeVersion.encode(), len(sections), 0)
+
+    fout = open(path, 'wb')
+    fout.write(header + entries + body)
+
+#------------------------------------------------------------------------------
+# Arrays
+#------------------------------------------------------------------------------
+
+# Writes 'const TYPE NAME[]' and adds it to the data file. 'fmt' is the
+# 'struct' format of an element, and 'literal' formats an element for C++.
+# The elements are packed into lines of up to 80 columns, which keeps the
+# generated units small and quick to compile.
+def write_array(fout, name, type, values, fmt, literal=lambda x: "%d" % x,
+                section=True):
+    fout.write("const %s %s[] = {\n" % (type, name))
+    line = ''
+    for val in values:
+        item = literal(val) + ','
+        if line and len(line) + 1 + len(item) > 80:
+            fout.write(line + '\n')
+            line = ''
+        line = line + ' ' + item if line else item
+    if line:
+        fout.write(line + '\n')
+    fout.write("};\n")
+    if section:
+        add_section(name, fmt, values)
+
+#------------------------------------------------------------------------------
+# Code point trie
+#------------------------------------------------------------------------------
+
+# A per-code-point table is split into three stages indexed by 'cp >> 10',
+# '(cp >> 4) & 0x3F' and 'cp & 0xF'. Identical blocks are stored only once.
+# These shifts must match 'CodePointTrie' in 'src/unicodelib_data.h'.
+TrieShift1 = 10
+TrieShift2 = 4
+
+def build_trie(values):
+    leafSize = 1 << TrieShift2
+    blockSize = 1 << (TrieShift1 - TrieShift2)
+
+    stage3 = []
+    leaves = {}
+    leafOffsets = []
+    for i in range(0, len(values), leafSize):
+        leaf = tuple(values[i:i + leafSize])
+        if not leaf in leaves:
+            leaves[leaf] = len(stage3)
+            stage3.extend(leaf)
+        leafOffsets.append(leaves[leaf])
+
+    stage2 = []
+    blocks = {}
+    stage1 = []
+    for i in range(0, len(leafOffsets), blockSize):
+        block = tuple(leafOffsets[i:i + blockSize])
+        if not block in blocks:
+            blocks[block] = len(stage2)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+
+    assert len(stage2) <= 0x10000 and len(stage3) <= 0x10000
+    return stage1, stage2, stage3
+
+# Writes the stages as 'NAME_stage1', 'NAME_stage2' and 'NAME_stage3'.
+def write_trie(fout, name, type, values, fmt, literal=lambda x: "%d" % x):
+    stage1, stage2, stage3 = build_trie(values)
+    write_array(fout, name + '_stage1', 'uint16_t', stage1, 'H')
+    write_array(fout, name + '_stage2', 'uint16_t', stage2, 'H')
+    write_array(fout, name + '_stage3', type, stage3, fmt, literal)
+
+#------------------------------------------------------------------------------
+# genUnicodeVersion
+#------------------------------------------------------------------------------
+
+def genUnicodeVersion(ucd, out):
+    fin = open(ucd + '/DerivedCoreProperties.txt')
+    fout = open(out + '/_unicode_version.cpp', 'w')
+
+    # The first line is '# DerivedCoreProperties-13.0.0.txt'.
+    version = re.match(r"# DerivedCoreProperties-([0-9.]+)\.txt", fin.readline()).group(1)
+
+    fout.write("const char _unicode_version[] = \"%s\";\n" % version)
+    return version
 
 #------------------------------------------------------------------------------
 # genGeneralCategoryPropertyTable
@@ -53,10 +241,13 @@ def genGeneralCategoryPropertyTable(ucd, out):
         for cp in range(codePointPrev + 1, MaxCode + 1):
             yield cp, 'Cn'
 
-    fout.write("const GeneralCategory _general_category_properties[] = {\n")
-    for cp, val in items():
-        fout.write("GeneralCategory::%s,\n" % val)
-    fout.write("};\n")
+    indices = dict([(x, i) for i, x in enumerate(GeneralCategories)])
+    values = [indices[val] for cp, val in items()]
+
+    write_enum_asserts(fout, 'GeneralCategory', GeneralCategories)
+    write_trie(fout, '_general_category_properties', 'GeneralCategory', values,
+               'i', lambda x: "GeneralCategory::%s" % GeneralCategories[x])
+    return values
 
 #------------------------------------------------------------------------------
 # getPropertyTable
@@ -86,10 +277,9 @@ def getPropertyTable(ucd, out):
             else:
                 values[codePoint] += (1 << val)
 
-    fout.write("const uint64_t _properties[] = {\n")
-    for val in values:
-        fout.write("0x%016X,\n" % val)
-    fout.write("};\n")
+    write_trie(fout, '_properties', 'uint64_t', values, 'Q',
+               lambda x: "0x%016X" % x)
+    return values, sorted(names, key=lambda x: names[x])
 
 #------------------------------------------------------------------------------
 # getDerivedCorePropertyTable
@@ -119,18 +309,16 @@ def getDerivedCorePropertyTable(ucd, out):
             else:
                 values[codePoint] += (1 << val)
 
-    fout.write("const uint32_t _derived_core_properties[] = {\n")
-    for val in values:
-        fout.write("0x%08X,\n" % val)
-    fout.write("};\n")
+    write_trie(fout, '_derived_core_properties', 'uint32_t', values, 'I',
+               lambda x: "0x%08X" % x)
+    return values, sorted(names, key=lambda x: names[x])
 
 #------------------------------------------------------------------------------
 # getSimpleCaseMappingTable
 #------------------------------------------------------------------------------
 
-def getSimpleCaseMappingTable(ucd, out):
+def getSimpleCaseMappingTable(ucd):
     fin = open(ucd + '/UnicodeData.txt')
-    fout = open(out + '/_simple_case_mappings.cpp', 'w')
 
     data = [x.rstrip().split(';') for x in fin]
     r = re.compile(r"(?:<(\w+)> )?(.+)")
@@ -162,10 +350,37 @@ def getSimpleCaseMappingTable(ucd, out):
                 codePointPrev = codePoint
                 i += 1
 
-    fout.write("const std::unordered_map<char32_t, const char32_t*> _simple_case_mappings = {\n")
+    values = [(cp, cp, cp) for cp in range(MaxCode + 1)]
     for cp, upper, lower, title in items():
-        fout.write('{ 0x%08X, U"\\U%08X\\U%08X\\U%08X" },\n' % (cp, upper, lower, title))
-    fout.write("};\n")
+        values[cp] = (upper, lower, title)
+    return values
+
+#------------------------------------------------------------------------------
+# genSimpleCaseMappingTable
+#------------------------------------------------------------------------------
+
+# The simple mappings and folding of a code point are stored as offsets from
+# it. Runs of letters that map alike, such as the Greek, Cyrillic and
+# fullwidth Latin letters, then share a row of '_simple_case_deltas', and the
+# trie of row ids compresses well. Row 0 maps nothing.
+def genSimpleCaseMappingTable(out, simpleCaseMappings, simpleCaseFoldings):
+    fout = open(out + '/_simple_case_mappings.cpp', 'w')
+
+    rows = {(0, 0, 0, 0): 0}
+    values = []
+    for cp in range(MaxCode + 1):
+        upper, lower, title = simpleCaseMappings[cp]
+        row = (upper - cp, lower - cp, title - cp, simpleCaseFoldings[cp] - cp)
+        if not row in rows:
+            rows[row] = len(rows)
+        values.append(rows[row])
+
+    assert len(rows) <= 0x100
+
+    write_array(fout, '_simple_case_deltas', 'SimpleCaseDelta',
+                sorted(rows, key=lambda x: rows[x]), 'iiii',
+                lambda x: "{%d, %d, %d, %d}" % x)
+    write_trie(fout, '_simple_case_delta_ids', 'uint8_t', values, 'B')
 
 #------------------------------------------------------------------------------
 # getSpecialCaseMappingTable
@@ -174,7 +389,6 @@ def getSimpleCaseMappingTable(ucd, out):
 def getSpecialCaseMappingTable(ucd, out):
     fin = open(ucd + '/SpecialCasing.txt')
     fout = open(out + '/_special_case_mappings.cpp', 'w')
-    foutDefault = open(out + '/_special_case_mappings_default.cpp', 'w')
 
     r = re.compile(r"(?!#)(.+?); #")
 
@@ -197,31 +411,58 @@ def getSpecialCaseMappingTable(ucd, out):
                 title = [int(x, 16) for x in to_array(flds[2])]
                 upper = [int(x, 16) for x in to_array(flds[3])]
 
-                hasContext = False
-                language = 'nullptr'
+                hasCondition = False
+                language = ''
                 context = 'Unassigned'
                 if len(flds) == 5:
-                    hasContext = True
+                    hasCondition = True
                     for x in to_array(flds[4]):
                         if is_language(x):
-                            language = '"%s"' % x
+                            language = x
                         else:
                             context = x
 
-                yield cp, lower, title, upper, language, context, hasContext
-
-    fout.write("const std::unordered_multimap<char32_t, SpecialCasing> _special_case_mappings = {\n")
-    foutDefault.write("const std::unordered_multimap<char32_t, SpecialCasing> _special_case_mappings_default = {\n")
-    for cp, lower, title, upper, language, context, hasContext in items():
-        if hasContext:
-            f = fout
-        else:
-            f = foutDefault
-        f.write('{ 0x%08X, { %s, %s, %s, %s, SpecialCasingContext::%s } },\n'
-                % (cp, to_unicode_literal(lower), to_unicode_literal(title),
-                    to_unicode_literal(upper), language, context))
-    fout.write("};\n")
-    foutDefault.write("};\n")
+                yield cp, lower, title, upper, language, context, hasCondition
+
+    # Entries are sorted by code point, then conditional ones before the
+    # unconditional one, keeping the order in the file otherwise. Row 0 is
+    # reserved so that 0 means 'no entry', and the last row ends the run of
+    # the last code point.
+    entries = sorted(items(), key=lambda x: (x[0], not x[6]))
+
+    # Each mapping is zero-terminated in the pool. Offset 0 is reserved for
+    # the empty mapping.
+    pool = [0]
+    offsets = {(): 0}
+    def offset(codes):
+        codes = tuple(codes)
+        if not codes in offsets:
+            offsets[codes] = len(pool)
+            pool.extend(codes)
+            pool.append(0)
+        return offsets[codes]
+
+    contexts = dict([(x, i) for i, x in enumerate(SpecialCasingContexts)])
+    values = [0] * (MaxCode + 1)
+    rows = [(0, 0, 0, 0, b'', 0)]
+    for cp, lower, title, upper, language, context, hasCondition in entries:
+        if not values[cp]:
+            values[cp] = len(rows)
+        rows.append((cp, offset(lower), offset(title), offset(upper),
+                     language.encode(), contexts[context]))
+    rows.append((0, 0, 0, 0, b'', 0))
+
+    assert len(rows) <= 0x100 and len(pool) <= 0x10000
+
+    write_enum_asserts(fout, 'SpecialCasingContext', SpecialCasingContexts)
+    write_array(fout, '_special_case_mapping_pool', 'char32_t', pool, 'I',
+                lambda x: "0x%08X" % x)
+    write_array(fout, '_special_case_mappings', 'SpecialCasing', rows,
+                'IHHH4s2xi',
+                lambda x: '{ 0x%08X, %d, %d, %d, "%s", SpecialCasingContext::%s }'
+                % (x[0], x[1], x[2], x[3], x[4].decode(),
+                   SpecialCasingContexts[x[5]]))
+    write_trie(fout, '_special_case_mapping_ids', 'uint8_t', values, 'B')
 
 #------------------------------------------------------------------------------
 # getCaseFoldingTable
@@ -252,11 +493,56 @@ def getCaseFoldingTable(ucd, out):
             elif status == 'T':
                 dic[cp][3] = codes[0]
 
-    fout.write("const std::unordered_map<char32_t, CaseFolding> _case_foldings = {\n")
-    for cp in dic:
+    # The simple foldings (C and S) are in '_simple_case_deltas', so only the
+    # code points with a full (F) or Turkic (T) folding have a row here. Full
+    # foldings are zero-terminated in the pool, and offset 0 is reserved for
+    # 'no full folding'. Index 0 is reserved so that 0 means 'no folding'.
+    pool = [0]
+    values = [0] * (MaxCode + 1)
+    rows = [(0, 0)]
+    for cp in sorted(dic):
         cf = dic[cp]
-        f = to_unicode_literal(cf[2])
-        fout.write('{ 0x%08X, { 0x%08X,  0x%08X, %s, 0x%08X } },\n' % (cp, cf[0], cf[1], f, cf[3]))
+        if not cf[2] and not cf[3]:
+            continue
+        f = 0
+        if cf[2]:
+            f = len(pool)
+            pool.extend(cf[2])
+            pool.append(0)
+        values[cp] = len(rows)
+        rows.append((f, cf[3]))
+
+    assert len(rows) <= 0x10000 and len(pool) <= 0x10000
+
+    write_array(fout, '_case_folding_pool', 'char32_t', pool, 'I',
+                lambda x: "0x%08X" % x)
+    write_array(fout, '_case_folding_values', 'CaseFolding', rows, 'II',
+                lambda x: "{ %d, 0x%08X }" % x)
+    write_trie(fout, '_case_foldings', 'uint16_t', values, 'H')
+    return [dic[cp][1] or dic[cp][0] or cp if cp in dic else cp
+            for cp in range(MaxCode + 1)]
+
+#------------------------------------------------------------------------------
+# genLatin1RecordTable
+#------------------------------------------------------------------------------
+
+# The properties of U+0000..U+00FF that the inline functions in 'unicodelib.h'
+# answer without a call. Data files don't store it, since the loader builds it
+# from the other tables.
+def genLatin1RecordTable(out, generalCategories, properties, derivedProperties,
+                         simpleCaseMappings, simpleCaseFoldings):
+    fout = open(out + '/_latin1_records.cpp', 'w')
+
+    fout.write("const Latin1Record _latin1_records[] = {\n")
+    for cp in range(0x100):
+        upper, lower, title = simpleCaseMappings[cp]
+        folding = simpleCaseFoldings[cp]
+        assert max(upper, lower, title, folding) <= 0xFFFF
+        fout.write("{0x%016X, 0x%08X, GeneralCategory::%s, 0x%04X, 0x%04X, "
+                   "0x%04X, 0x%04X},\n" %
+                   (properties[cp], derivedProperties[cp],
+                    GeneralCategories[generalCategories[cp]], upper, lower,
+                    title, folding))
     fout.write("};\n")
 
 #------------------------------------------------------------------------------
@@ -267,7 +553,8 @@ def genBlockPropertyTable(ucd, out):
     fin = open(ucd + '/Blocks.txt')
     fout = open(out + '/_block_properties.cpp', 'w')
 
-    values = ['Unassigned'] * (MaxCode + 1)
+    blocks = property_value_names(ucd + '/Blocks.txt')
+    values = [0] * (MaxCode + 1)
     r = re.compile(r"([0-9A-F]+)\.\.([0-9A-F]+)\s*;\s+(.+)")
 
     for line in fin:
@@ -278,12 +565,12 @@ def genBlockPropertyTable(ucd, out):
             block = ''.join([x.title() if x.islower() else x for x in re.split(r"[ -]", m.group(3))])
 
             for cp in range(codePointFirst, codePointLast + 1):
-                values[cp] = block
+                values[cp] = blocks.index(block)
 
-    fout.write("const Block _block_properties[] = {\n")
-    for val in values:
-        fout.write("    Block::%s,\n" % val)
-    fout.write("};\n")
+    write_enum_asserts(fout, 'Block', blocks)
+    write_trie(fout, '_block_properties', 'Block', values, 'i',
+               lambda x: "Block::%s" % blocks[x])
+    return values, len(blocks)
 
 #------------------------------------------------------------------------------
 # genScriptPropertyTable
@@ -293,14 +580,15 @@ def genScriptPropertyTable(ucd, out):
     fin = open(ucd + '/Scripts.txt')
     fout = open(out + '/_script_properties.cpp', 'w')
 
-    values = ['Unassigned'] * (MaxCode + 1)
+    scripts = property_value_names(ucd + '/Scripts.txt')
+    values = [0] * (MaxCode + 1)
     r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s+;\s+(\w+)\s+#.*")
 
     for line in fin:
         m = r.match(line)
         if m:
             codePoint = int(m.group(1), 16)
-            value = m.group(3)
+            value = scripts.index(m.group(3))
 
             if m.group(2):
                 codePointLast = int(m.group(2), 16)
@@ -309,286 +597,170 @@ def genScriptPropertyTable(ucd, out):
             else:
                 values[codePoint] = value
 
-    fout.write("const Script _script_properties[] = {\n")
-    for val in values:
-        fout.write("Script::%s,\n" % val)
-    fout.write("};\n")
+    write_enum_asserts(fout, 'Script', scripts)
+    write_trie(fout, '_script_properties', 'Script', values, 'i',
+               lambda x: "Script::%s" % scripts[x])
+    return values, len(scripts)
 
 #------------------------------------------------------------------------------
-# genScriptExtensionIdTable
+# genScriptExtensionTable
 #------------------------------------------------------------------------------
 
-def genScriptExtensionIdTable(ucd, out):
+def genScriptExtensionTable(ucd, out):
+    finScripts = open(ucd + '/Scripts.txt')
     fin = open(ucd + '/ScriptExtensions.txt')
-    fout = open(out + '/_script_extension_ids.cpp', 'w')
+    fout = open(out + '/_script_extensions.cpp', 'w')
+
+    dic = {}
+    for fields in alias_lines(ucd, 'PropertyValueAliases.txt',
+                              PropertyValueAliasesFallback):
+        if fields[0] == 'sc':
+            dic[fields[1]] = fields[2]
 
-    values = [-1] * (MaxCode + 1)
-    rHeader = re.compile(r"# Script_Extensions=(.*)")
-    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?.*")
+    scripts = property_value_names(ucd + '/Scripts.txt')
+    values = [0] * (MaxCode + 1)
+    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*([\w ]+?)\s*#.*")
 
-    id = -1
+    for line in finScripts:
+        m = r.match(line)
+        if m:
+            codePoint = int(m.group(1), 16)
+            codePointLast = int(m.group(2), 16) if m.group(2) else codePoint
+            for cp in range(codePoint, codePointLast + 1):
+                values[cp] = scripts.index(m.group(3))
+
+    # Set N holds the single script N, so that a code point without explicit
+    # extensions uses the value of its script as the id.
+    sets = [(i,) for i in range(len(scripts))]
+    ids = {}
     for line in fin:
-        m = rHeader.match(line)
+        m = r.match(line)
         if m:
-            id += 1
-        else:
-            m = r.match(line)
-            if m:
-                codePoint = int(m.group(1), 16)
+            codePoint = int(m.group(1), 16)
+            codePointLast = int(m.group(2), 16) if m.group(2) else codePoint
+            scs = tuple(sorted([scripts.index(dic[x]) for x in m.group(3).split()]))
+            if not scs in ids:
+                ids[scs] = len(sets)
+                sets.append(scs)
+            for cp in range(codePoint, codePointLast + 1):
+                values[cp] = ids[scs]
+
+    # This must match 'ScriptSet::WordCount' in 'unicodelib.h'.
+    wordCount = 3
+    assert len(scripts) <= wordCount * 64
+
+    rows = []
+    for scs in sets:
+        words = [0] * wordCount
+        for i in scs:
+            words[i // 64] |= 1 << (i % 64)
+        rows.append(tuple(words))
+
+    write_array(fout, '_script_extension_sets', 'ScriptSet', rows,
+                '%dQ' % wordCount,
+                lambda x: "{{%s}}" % ', '.join(["0x%016X" % w for w in x]))
+    write_trie(fout, '_script_extension_ids', 'uint16_t', values, 'H')
 
-                if m.group(2):
-                    codePointLast = int(m.group(2), 16)
-                    for cp in range(codePoint, codePointLast + 1):
-                        values[cp] = id
-                else:
-                    values[codePoint] = id
+#------------------------------------------------------------------------------
+# genCombiningClassPropertyTable
+#------------------------------------------------------------------------------
 
-    fout.write("const int _script_extension_ids[] = {\n")
-    for id in values:
-        fout.write("%d,\n" % id)
-    fout.write("};\n")
+def genCombiningClassPropertyTable(ucd, out):
+    fin = open(ucd + '/UnicodeData.txt')
+    fout = open(out + '/_combining_class_properties.cpp', 'w')
+
+    data = [x.rstrip().split(';') for x in fin]
+
+    values = [0] * (MaxCode + 1)
+    i = 0
+    while i < len(data):
+        flds = data[i]
+        codePoint = int(flds[0], 16)
+        combiningClass = int(flds[3])
+
+        if flds[1].endswith('First>'):
+            codePointLast = int(data[i + 1][0], 16)
+            for cp in range(codePoint, codePointLast + 1):
+                values[cp] = combiningClass
+            i += 2
+        else:
+            values[codePoint] = combiningClass
+            i += 1
+
+    write_trie(fout, '_combining_class_properties', 'uint8_t', values, 'B')
 
 #------------------------------------------------------------------------------
-# genScriptExtensionPropertyForIdTable
+# genEmojiPropertyTable
 #------------------------------------------------------------------------------
 
-def genScriptExtensionPropertyForIdTable(ucd, out):
-    fin = open(ucd + '/ScriptExtensions.txt')
-    fout = open(out + '/_script_extension_properties_for_id.cpp', 'w')
-
-    # This list is from 'PropertyValueAliases.txt' in Unicode database.
-    dic = {
-        'Adlm': 'Adlam',
-        'Aghb': 'Caucasian_Albanian',
-        'Ahom': 'Ahom',
-        'Arab': 'Arabic',
-        'Armi': 'Imperial_Aramaic',
-        'Armn': 'Armenian',
-        'Avst': 'Avestan',
-        'Bali': 'Balinese',
-        'Bamu': 'Bamum',
-        'Bass': 'Bassa_Vah',
-        'Batk': 'Batak',
-        'Beng': 'Bengali',
-        'Bhks': 'Bhaiksuki',
-        'Bopo': 'Bopomofo',
-        'Brah': 'Brahmi',
-        'Brai': 'Braille',
-        'Bugi': 'Buginese',
-        'Buhd': 'Buhid',
-        'Cakm': 'Chakma',
-        'Cans': 'Canadian_Aboriginal',
-        'Cari': 'Carian',
-        'Cham': 'Cham',
-        'Cher': 'Cherokee',
-        'Chrs': 'Chorasmian',
-        'Copt': 'Coptic',
-        'Cprt': 'Cypriot',
-        'Cyrl': 'Cyrillic',
-        'Deva': 'Devanagari',
-        'Diak': 'Dives_Akuru',
-        'Dogr': 'Dogra',
-        'Dsrt': 'Deseret',
-        'Dupl': 'Duployan',
-        'Egyp': 'Egyptian_Hieroglyphs',
-        'Elba': 'Elbasan',
-        'Elym': 'Elymaic',
-        'Ethi': 'Ethiopic',
-        'Geor': 'Georgian',
-        'Glag': 'Glagolitic',
-        'Gong': 'Gunjala_Gondi',
-        'Gonm': 'Masaram_Gondi',
-        'Goth': 'Gothic',
-        'Gran': 'Grantha',
-        'Grek': 'Greek',
-        'Gujr': 'Gujarati',
-        'Guru': 'Gurmukhi',
-        'Hang': 'Hangul',
-        'Hani': 'Han',
-        'Hano': 'Hanunoo',
-        'Hatr': 'Hatran',
-        'Hebr': 'Hebrew',
-        'Hira': 'Hiragana',
-        'Hluw': 'Anatolian_Hieroglyphs',
-        'Hmng': 'Pahawh_Hmong',
-        'Hmnp': 'Nyiakeng_Puachue_Hmong',
-        'Hrkt': 'Katakana_Or_Hiragana',
-        'Hung': 'Old_Hungarian',
-        'Ital': 'Old_Italic',
-        'Java': 'Javanese',
-        'Kali': 'Kayah_Li',
-        'Kana': 'Katakana',
-        'Khar': 'Kharoshthi',
-        'Khmr': 'Khmer',
-        'Khoj': 'Khojki',
-        'Kits': 'Khitan_Small_Script',
-        'Knda': 'Kannada',
-        'Kthi': 'Kaithi',
-        'Lana': 'Tai_Tham',
-        'Laoo': 'Lao',
-        'Latn': 'Latin',
-        'Lepc': 'Lepcha',
-        'Limb': 'Limbu',
-        'Lina': 'Linear_A',
-        'Linb': 'Linear_B',
-        'Lisu': 'Lisu',
-        'Lyci': 'Lycian',
-        'Lydi': 'Lydian',
-        'Mahj': 'Mahajani',
-        'Maka': 'Makasar',
-        'Mand': 'Mandaic',
-        'Mani': 'Manichaean',
-        'Marc': 'Marchen',
-        'Medf': 'Medefaidrin',
-        'Mend': 'Mende_Kikakui',
-        'Merc': 'Meroitic_Cursive',
-        'Mero': 'Meroitic_Hieroglyphs',
-        'Mlym': 'Malayalam',
-        'Modi': 'Modi',
-        'Mong': 'Mongolian',
-        'Mroo': 'Mro',
-        'Mtei': 'Meetei_Mayek',
-        'Mult': 'Multani',
-        'Mymr': 'Myanmar',
-        'Nand': 'Nandinagari',
-        'Narb': 'Old_North_Arabian',
-        'Nbat': 'Nabataean',
-        'Newa': 'Newa',
-        'Nkoo': 'Nko',
-        'Nshu': 'Nushu',
-        'Ogam': 'Ogham',
-        'Olck': 'Ol_Chiki',
-        'Orkh': 'Old_Turkic',
-        'Orya': 'Oriya',
-        'Osge': 'Osage',
-        'Osma': 'Osmanya',
-        'Palm': 'Palmyrene',
-        'Pauc': 'Pau_Cin_Hau',
-        'Perm': 'Old_Permic',
-        'Phag': 'Phags_Pa',
-        'Phli': 'Inscriptional_Pahlavi',
-        'Phlp': 'Psalter_Pahlavi',
-        'Phnx': 'Phoenician',
-        'Plrd': 'Miao',
-        'Prti': 'Inscriptional_Parthian',
-        'Rjng': 'Rejang',
-        'Rohg': 'Hanifi_Rohingya',
-        'Runr': 'Runic',
-        'Samr': 'Samaritan',
-        'Sarb': 'Old_South_Arabian',
-        'Saur': 'Saurashtra',
-        'Sgnw': 'SignWriting',
-        'Shaw': 'Shavian',
-        'Shrd': 'Sharada',
-        'Sidd': 'Siddham',
-        'Sind': 'Khudawadi',
-        'Sinh': 'Sinhala',
-        'Sogd': 'Sogdian',
-        'Sogo': 'Old_Sogdian',
-        'Sora': 'Sora_Sompeng',
-        'Soyo': 'Soyombo',
-        'Sund': 'Sundanese',
-        'Sylo': 'Syloti_Nagri',
-        'Syrc': 'Syriac',
-        'Tagb': 'Tagbanwa',
-        'Takr': 'Takri',
-        'Tale': 'Tai_Le',
-        'Talu': 'New_Tai_Lue',
-        'Taml': 'Tamil',
-        'Tang': 'Tangut',
-        'Tavt': 'Tai_Viet',
-        'Telu': 'Telugu',
-        'Tfng': 'Tifinagh',
-        'Tglg': 'Tagalog',
-        'Thaa': 'Thaana',
-        'Thai': 'Thai',
-        'Tibt': 'Tibetan',
-        'Tirh': 'Tirhuta',
-        'Ugar': 'Ugaritic',
-        'Vaii': 'Vai',
-        'Wara': 'Warang_Citi',
-        'Wcho': 'Wancho',
-        'Xpeo': 'Old_Persian',
-        'Xsux': 'Cuneiform',
-        'Yezi': 'Yezidi',
-        'Yiii': 'Yi',
-        'Zanb': 'Zanabazar_Square',
-        'Zinh': 'Inherited',
-        'Zyyy': 'Common',
-        'Zzzz': 'Unknown',
-    }
+# This list must match the 'EmojiProperty_*' bits in 'unicodelib.h'.
+EmojiProperties = [
+    'Emoji',
+    'Emoji_Presentation',
+    'Emoji_Modifier',
+    'Emoji_Modifier_Base',
+    'Emoji_Component',
+    'Extended_Pictographic',
+]
+
+# A code point has any number of the emoji properties, so each is a bit.
+def genEmojiPropertyTable(ucd, out):
+    fin = open(ucd + '/emoji/emoji-data.txt')
+    fout = open(out + '/_emoji_properties.cpp', 'w')
 
-    values = [-1] * (MaxCode + 1)
-    rHeader = re.compile(r"# Script_Extensions=(.*)")
+    values = [0] * (MaxCode + 1)
+    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#.*")
 
-    fout.write("const std::vector<std::vector<Script>> _script_extension_properties_for_id = {\n")
-    id = 0
     for line in fin:
-        m = rHeader.match(line)
+        m = r.match(line)
         if m:
-            fout.write('{\n')
-            for sc in [dic[x] for x in m.group(1).split(' ')]:
-                fout.write('    Script::%s, \n' % sc)
-            fout.write('},\n')
-            id += 1
-    fout.write("};\n")
+            codePoint = int(m.group(1), 16)
+            codePointLast = int(m.group(2), 16) if m.group(2) else codePoint
+            bit = 1 << EmojiProperties.index(m.group(3))
+            for cp in range(codePoint, codePointLast + 1):
+                values[cp] |= bit
+
+    for i, name in enumerate(EmojiProperties):
+        fout.write("static_assert(EmojiProperty_%s == 0x%02X, \"\");\n" %
+                   (name, 1 << i))
+    write_trie(fout, '_emoji_properties', 'uint8_t', values, 'B',
+               lambda x: "0x%02X" % x)
 
 #------------------------------------------------------------------------------
-# genNomalizationPropertyTable
+# genDecompositionPropertyTable
 #------------------------------------------------------------------------------
 
-def genNomalizationPropertyTable(ucd, out):
+def genDecompositionPropertyTable(ucd, out):
     fin = open(ucd + '/UnicodeData.txt')
-    fout = open(out + '/_normalization_properties.cpp', 'w')
+    fout = open(out + '/_decomposition_properties.cpp', 'w')
 
     data = [x.rstrip().split(';') for x in fin]
     r = re.compile(r"(?:<(\w+)> )?(.+)")
 
-    def items():
-        codePointPrev = -1
-        i = 0
-        while i < len(data):
-            flds = data[i]
-            codePoint = int(flds[0], 16)
-            combiningClass = int(flds[3])
-            codes = flds[5]
-
-            for cp in range(codePointPrev + 1, codePoint):
-                yield cp, combiningClass, None, []
+    # Each distinct decomposition is stored once in the pool as a
+    # zero-terminated sequence. A table value is 'offset << 1 | compat', and
+    # offset 0 is reserved so that 0 means 'no decomposition'.
+    pool = [0]
+    offsets = {}
+    values = [0] * (MaxCode + 1)
 
-            if flds[1].endswith('First>'):
-                fldsLast = data[i + 1]
-                codePointLast = int(fldsLast[0], 16)
-                for cp in range(codePoint, codePointLast + 1):
-                    yield cp, combiningClass, None, []
-                codePointPrev = codePointLast
-                i += 2
-            else:
-                m = r.match(codes)
-                if m:
-                    compat = m.group(1)
-                    codes = [int(x, 16) for x in m.group(2).split(' ')]
-                    yield codePoint, combiningClass, compat, codes
-                else:
-                    yield codePoint, combiningClass, None, []
-                codePointPrev = codePoint
-                i += 1
+    for flds in data:
+        codePoint = int(flds[0], 16)
+        m = r.match(flds[5])
+        if m:
+            compat = 1 if m.group(1) else 0
+            codes = tuple([int(x, 16) for x in m.group(2).split(' ')])
+            if not codes in offsets:
+                offsets[codes] = len(pool)
+                pool.extend(codes)
+                pool.append(0)
+            values[codePoint] = (offsets[codes] << 1) | compat
 
-        for cp in range(codePointPrev + 1, MaxCode + 1):
-            yield cp, combiningClass, None, []
+    assert len(pool) <= 0x8000
 
-    fout.write("const NormalizationProperties _normalization_properties[] = {\n")
-    for cp, cls, compat, codes in items():
-        if compat:
-            compat = '"%s"' % compat
-        else:
-            compat = 'nullptr'
-        if codes:
-            codes = 'U"%s"' % ''.join(["\\U%08X" % x for x in codes])
-        else:
-            codes = 'nullptr'
-        fout.write("{ %d, %s, %s },\n" % (cls, compat, codes))
-    fout.write("};\n")
+    write_array(fout, '_decomposition_pool', 'char32_t', pool, 'I',
+                lambda x: "0x%08X" % x)
+    write_trie(fout, '_decomposition_properties', 'uint16_t', values, 'H')
 
 #------------------------------------------------------------------------------
 # genNomalizationCompositionTable
@@ -639,151 +811,990 @@ def genNomalizationCompositionTable(ucd, out):
             else:
                 exclusions.add(first)
 
-    fout.write("const std::unordered_map<std::u32string, char32_t> _normalization_composition = {\n")
+    pairs = {}
     for cp, codes in items():
         if not cp in exclusions:
-            fout.write('{ U"\\U%08X\\U%08X", 0x%08X },\n' % (codes[0], codes[1], cp))
-    fout.write("};\n")
-
-#------------------------------------------------------------------------------
-# getGraphemeBreakPropertyTable
-#------------------------------------------------------------------------------
+            if not codes[0] in pairs:
+                pairs[codes[0]] = []
+            pairs[codes[0]].append((codes[1], cp))
+
+    # For each starter, '(second, composite)' pairs sorted by the second code
+    # point and terminated by 0. A table value is the offset of the list, and
+    # offset 0 is reserved so that 0 means 'no composition'.
+    pool = [0]
+    values = [0] * (MaxCode + 1)
+    for first in sorted(pairs):
+        values[first] = len(pool)
+        for second, cp in sorted(pairs[first]):
+            pool.extend([second, cp])
+        pool.append(0)
 
-def getGraphemeBreakPropertyTable(ucd, out):
-    fin = open(ucd + '/auxiliary/GraphemeBreakProperty.txt')
-    fout = open(out + '/_grapheme_break_properties.cpp', 'w')
+    assert len(pool) <= 0x10000
 
-    values = ['Unassigned'] * (MaxCode + 1)
-    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#.*")
-
-    for line in fin:
-        m = r.match(line)
-        if m:
-            codePoint = int(m.group(1), 16)
-            value = m.group(3)
-
-            if m.group(2):
-                codePointLast = int(m.group(2), 16)
-                for cp in range(codePoint, codePointLast + 1):
-                    values[cp] = value
-            else:
-                values[codePoint] = value
-
-    fout.write("const GraphemeBreak _grapheme_break_properties[] = {\n")
-    for val in values:
-        fout.write("GraphemeBreak::%s,\n" % val)
-    fout.write("};\n")
+    write_array(fout, '_normalization_composition_pairs', 'char32_t', pool, 'I',
+                lambda x: "0x%08X" % x)
+    write_trie(fout, '_normalization_composition', 'uint16_t', values, 'H')
 
 #------------------------------------------------------------------------------
-# getWordBreakPropertyTable
+# genCodePointRecordTable
 #------------------------------------------------------------------------------
 
-def getWordBreakPropertyTable(ucd, out):
-    fin = open(ucd + '/auxiliary/WordBreakProperty.txt')
-    fout = open(out + '/_word_break_properties.cpp', 'w')
+def genCodePointRecordTable(ucd, out):
+    fout = open(out + '/_code_point_records.cpp', 'w')
 
-    values = ['Unassigned'] * (MaxCode + 1)
     r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#.*")
 
-    for line in fin:
-        m = r.match(line)
-        if m:
-            codePoint = int(m.group(1), 16)
-            value = m.group(3)
-
-            if m.group(2):
-                codePointLast = int(m.group(2), 16)
-                for cp in range(codePoint, codePointLast + 1):
-                    values[cp] = value
-            else:
-                values[codePoint] = value
-
-    fout.write("const WordBreak _word_break_properties[] = {\n")
-    for val in values:
-        fout.write("WordBreak::%s,\n" % val)
-    fout.write("};\n")
+    def ranges(path):
+        for line in open(path):
+            m = r.match(line)
+            if m:
+                codePoint = int(m.group(1), 16)
+                codePointLast = int(m.group(2), 16) if m.group(2) else codePoint
+                yield codePoint, codePointLast, m.group(3)
+
+    def enumValues(path, names):
+        values = [0] * (MaxCode + 1)
+        for first, last, value in ranges(path):
+            for cp in range(first, last + 1):
+                values[cp] = names.index(value)
+        return values
+
+    generalCategories = ['Cn'] * (MaxCode + 1)
+    combiningClasses = [0] * (MaxCode + 1)
+    data = [x.rstrip().split(';') for x in open(ucd + '/UnicodeData.txt')]
+    i = 0
+    while i < len(data):
+        flds = data[i]
+        codePoint = int(flds[0], 16)
+        codePointLast = codePoint
+        if flds[1].endswith('First>'):
+            codePointLast = int(data[i + 1][0], 16)
+            i += 1
+        for cp in range(codePoint, codePointLast + 1):
+            generalCategories[cp] = flds[2]
+            combiningClasses[cp] = int(flds[3])
+        i += 1
+
+    generalCategories = [GeneralCategories.index(x) for x in generalCategories]
+
+    graphemeBreakNames = property_value_names(ucd + '/auxiliary/GraphemeBreakProperty.txt')
+    wordBreakNames = property_value_names(ucd + '/auxiliary/WordBreakProperty.txt')
+    sentenceBreakNames = property_value_names(ucd + '/auxiliary/SentenceBreakProperty.txt')
+    graphemeBreaks = enumValues(ucd + '/auxiliary/GraphemeBreakProperty.txt',
+                                graphemeBreakNames)
+    wordBreaks = enumValues(ucd + '/auxiliary/WordBreakProperty.txt',
+                            wordBreakNames)
+    sentenceBreaks = enumValues(ucd + '/auxiliary/SentenceBreakProperty.txt',
+                                sentenceBreakNames)
+
+    # The bits must match 'CodePointRecord_*' in 'src/unicodelib_data.h'.
+    flagBits = {
+        'Extended_Pictographic': 0,
+        'Cased': 1,
+        'Case_Ignorable': 2,
+        'Changes_When_Lowercased': 3,
+        'Changes_When_Uppercased': 4,
+        'Changes_When_Titlecased': 5,
+        'Changes_When_Casefolded': 6,
+        'Changes_When_Casemapped': 7,
+    }
+    flags = [0] * (MaxCode + 1)
+    for path in ('/DerivedCoreProperties.txt', '/emoji/emoji-data.txt'):
+        for first, last, name in ranges(ucd + path):
+            if name in flagBits:
+                for cp in range(first, last + 1):
+                    flags[cp] |= 1 << flagBits[name]
+
+    # Only a few hundred distinct records exist, so the trie stores an index
+    # into the record array.
+    records = {}
+    values = []
+    for cp in range(MaxCode + 1):
+        record = (generalCategories[cp], graphemeBreaks[cp], wordBreaks[cp],
+                  sentenceBreaks[cp], combiningClasses[cp], flags[cp])
+        if not record in records:
+            records[record] = len(records)
+        values.append(records[record])
+
+    assert len(records) <= 0x100
+
+    def literal(x):
+        return ("{GeneralCategory::%s, GraphemeBreak::%s, WordBreak::%s, "
+                "SentenceBreak::%s, %d, 0x%02X}" %
+                (GeneralCategories[x[0]], graphemeBreakNames[x[1]],
+                 wordBreakNames[x[2]], sentenceBreakNames[x[3]], x[4], x[5]))
+
+    write_enum_asserts(fout, 'GraphemeBreak', graphemeBreakNames)
+    write_enum_asserts(fout, 'WordBreak', wordBreakNames)
+    write_enum_asserts(fout, 'SentenceBreak', sentenceBreakNames)
+    write_array(fout, '_code_point_records', 'CodePointRecord',
+                sorted(records, key=lambda x: records[x]), 'iiiiBB2x', literal)
+    write_trie(fout, '_code_point_record_ids', 'uint8_t', values, 'B')
+    return ((graphemeBreaks, len(graphemeBreakNames)),
+            (wordBreaks, len(wordBreakNames)),
+            (sentenceBreaks, len(sentenceBreakNames)))
 
 #------------------------------------------------------------------------------
-# getSentenceBreakPropertyTable
+# genPropertyRangeTables
 #------------------------------------------------------------------------------
 
-def getSentenceBreakPropertyTable(ucd, out):
-    fin = open(ucd + '/auxiliary/SentenceBreakProperty.txt')
-    fout = open(out + '/_sentence_break_properties.cpp', 'w')
-
-    values = ['Unassigned'] * (MaxCode + 1)
-    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#.*")
-
-    for line in fin:
-        m = r.match(line)
-        if m:
-            codePoint = int(m.group(1), 16)
-            value = m.group(3)
-
-            if m.group(2):
-                codePointLast = int(m.group(2), 16)
-                for cp in range(codePoint, codePointLast + 1):
-                    values[cp] = value
-            else:
-                values[codePoint] = value
-
-    fout.write("const SentenceBreak _sentence_break_properties[] = {\n")
-    for val in values:
-        fout.write("SentenceBreak::%s,\n" % val)
-    fout.write("};\n")
+# The ranges of code points with each value of a property, grouped by value so
+# that 'for_each_range' costs O(ranges). 'NAME_ranges' holds inclusive
+# (first, last) pairs and 'NAME_range_offsets' the index of the first range of
+# each value, followed by the number of ranges.
+def runs(values):
+    first = 0
+    for cp in range(1, MaxCode + 2):
+        if cp > MaxCode or values[cp] != values[first]:
+            yield first, cp - 1, values[first]
+            first = cp
+
+def write_ranges(fout, name, groups):
+    ranges = []
+    offsets = []
+    for group in groups:
+        offsets.append(len(ranges))
+        ranges.extend(group)
+    offsets.append(len(ranges))
+    write_array(fout, name + '_ranges', 'CodePointRange', ranges, 'II',
+                lambda x: "{0x%04X, 0x%04X}" % x)
+    write_array(fout, name + '_range_offsets', 'uint32_t', offsets, 'I')
+
+# 'values' of an enumerated property with 'count' values.
+def write_value_ranges(fout, name, values, count):
+    groups = [[] for i in range(count)]
+    for first, last, value in runs(values):
+        groups[value].append((first, last))
+    write_ranges(fout, name, groups)
+
+# 'values' of a mask with 'bits' binary properties, grouped by bit.
+def write_bit_ranges(fout, name, values, bits):
+    groups = [[] for i in range(bits)]
+    for first, last, value in runs(values):
+        for bit in range(bits):
+            if value & (1 << bit):
+                group = groups[bit]
+                if group and group[-1][1] == first - 1:
+                    group[-1] = (group[-1][0], last)
+                else:
+                    group.append((first, last))
+    write_ranges(fout, name, groups)
+
+def genPropertyRangeTables(out, generalCategories, properties,
+                           derivedProperties, breaks, blocks, scripts):
+    fout = open(out + '/_property_ranges.cpp', 'w')
+    write_value_ranges(fout, '_general_category', generalCategories,
+                       len(GeneralCategories))
+    write_bit_ranges(fout, '_property', properties, 64)
+    write_bit_ranges(fout, '_derived_core_property', derivedProperties, 32)
+    for name, (values, count) in zip(
+            ('_grapheme_break', '_word_break', '_sentence_break'), breaks):
+        write_value_ranges(fout, name, values, count)
+
+    fout = open(out + '/_script_ranges.cpp', 'w')
+    write_value_ranges(fout, '_block', blocks[0], blocks[1])
+    write_value_ranges(fout, '_script', scripts[0], scripts[1])
 
 #------------------------------------------------------------------------------
-# getEmojiPropertyTable
+# genPropertyNameTable
 #------------------------------------------------------------------------------
 
-def getEmojiPropertyTable(ucd, out):
-    fin = open(ucd + '/emoji/emoji-data.txt')
-    fout = open(out + '/_emoji_properties.cpp', 'w')
-
-    values = ['Unassigned'] * (MaxCode + 1)
-    r = re.compile(r"([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#.*")
-
-    for line in fin:
-        m = r.match(line)
-        if m:
-            codePoint = int(m.group(1), 16)
-            value = m.group(3)
-
-            if m.group(2):
-                codePointLast = int(m.group(2), 16)
-                for cp in range(codePoint, codePointLast + 1):
-                    values[cp] = value
-            else:
-                values[codePoint] = value
-
-    fout.write("const Emoji _emoji_properties[] = {\n")
-    for val in values:
-        fout.write("Emoji::%s,\n" % val)
-    fout.write("};\n")
+# The lines of 'PropertyAliases.txt' and 'PropertyValueAliases.txt' of Unicode
+# 14.0.0 for the properties the library has, used when the UCD snapshot leaves
+# out those files. The general category names are in 'GeneralCategoryNames'.
+PropertyAliasesFallback = '''
+AHex ; ASCII_Hex_Digit
+Alpha ; Alphabetic
+Bidi_C ; Bidi_Control
+CI ; Case_Ignorable
+Cased ; Cased
+CWCF ; Changes_When_Casefolded
+CWCM ; Changes_When_Casemapped
+CWL ; Changes_When_Lowercased
+CWT ; Changes_When_Titlecased
+CWU ; Changes_When_Uppercased
+Dash ; Dash
+DI ; Default_Ignorable_Code_Point
+Dep ; Deprecated
+Dia ; Diacritic
+Ext ; Extender
+Gr_Base ; Grapheme_Base
+Gr_Ext ; Grapheme_Extend
+Gr_Link ; Grapheme_Link
+Hex ; Hex_Digit
+Hyphen ; Hyphen
+IDSB ; IDS_Binary_Operator
+IDST ; IDS_Trinary_Operator
+IDC ; ID_Continue
+IDS ; ID_Start
+Ideo ; Ideographic
+Join_C ; Join_Control
+LOE ; Logical_Order_Exception
+Lower ; Lowercase
+Math ; Math
+NChar ; Noncharacter_Code_Point
+OAlpha ; Other_Alphabetic
+ODI ; Other_Default_Ignorable_Code_Point
+OGr_Ext ; Other_Grapheme_Extend
+OIDC ; Other_ID_Continue
+OIDS ; Other_ID_Start
+OLower ; Other_Lowercase
+OMath ; Other_Math
+OUpper ; Other_Uppercase
+Pat_Syn ; Pattern_Syntax
+Pat_WS ; Pattern_White_Space
+PCM ; Prepended_Concatenation_Mark
+QMark ; Quotation_Mark
+Radical ; Radical
+RI ; Regional_Indicator
+STerm ; Sentence_Terminal
+SD ; Soft_Dotted
+Term ; Terminal_Punctuation
+UIdeo ; Unified_Ideograph
+Upper ; Uppercase
+VS ; Variation_Selector
+WSpace ; White_Space ; Space
+XIDC ; XID_Continue
+XIDS ; XID_Start
+'''
+
+PropertyValueAliasesFallback = '''
+sc ; Adlm ; Adlam
+sc ; Aghb ; Caucasian_Albanian
+sc ; Ahom ; Ahom
+sc ; Arab ; Arabic
+sc ; Armi ; Imperial_Aramaic
+sc ; Armn ; Armenian
+sc ; Avst ; Avestan
+sc ; Bali ; Balinese
+sc ; Bamu ; Bamum
+sc ; Bass ; Bassa_Vah
+sc ; Batk ; Batak
+sc ; Beng ; Bengali
+sc ; Bhks ; Bhaiksuki
+sc ; Bopo ; Bopomofo
+sc ; Brah ; Brahmi
+sc ; Brai ; Braille
+sc ; Bugi ; Buginese
+sc ; Buhd ; Buhid
+sc ; Cakm ; Chakma
+sc ; Cans ; Canadian_Aboriginal
+sc ; Cari ; Carian
+sc ; Cham ; Cham
+sc ; Cher ; Cherokee
+sc ; Chrs ; Chorasmian
+sc ; Copt ; Coptic ; Qaac
+sc ; Cpmn ; Cypro_Minoan
+sc ; Cprt ; Cypriot
+sc ; Cyrl ; Cyrillic
+sc ; Deva ; Devanagari
+sc ; Diak ; Dives_Akuru
+sc ; Dogr ; Dogra
+sc ; Dsrt ; Deseret
+sc ; Dupl ; Duployan
+sc ; Egyp ; Egyptian_Hieroglyphs
+sc ; Elba ; Elbasan
+sc ; Elym ; Elymaic
+sc ; Ethi ; Ethiopic
+sc ; Geor ; Georgian
+sc ; Glag ; Glagolitic
+sc ; Gong ; Gunjala_Gondi
+sc ; Gonm ; Masaram_Gondi
+sc ; Goth ; Gothic
+sc ; Gran ; Grantha
+sc ; Grek ; Greek
+sc ; Gujr ; Gujarati
+sc ; Guru ; Gurmukhi
+sc ; Hang ; Hangul
+sc ; Hani ; Han
+sc ; Hano ; Hanunoo
+sc ; Hatr ; Hatran
+sc ; Hebr ; Hebrew
+sc ; Hira ; Hiragana
+sc ; Hluw ; Anatolian_Hieroglyphs
+sc ; Hmng ; Pahawh_Hmong
+sc ; Hmnp ; Nyiakeng_Puachue_Hmong
+sc ; Hung ; Old_Hungarian
+sc ; Ital ; Old_Italic
+sc ; Java ; Javanese
+sc ; Kali ; Kayah_Li
+sc ; Kana ; Katakana
+sc ; Khar ; Kharoshthi
+sc ; Khmr ; Khmer
+sc ; Khoj ; Khojki
+sc ; Kits ; Khitan_Small_Script
+sc ; Knda ; Kannada
+sc ; Kthi ; Kaithi
+sc ; Lana ; Tai_Tham
+sc ; Laoo ; Lao
+sc ; Latn ; Latin
+sc ; Lepc ; Lepcha
+sc ; Limb ; Limbu
+sc ; Lina ; Linear_A
+sc ; Linb ; Linear_B
+sc ; Lisu ; Lisu
+sc ; Lyci ; Lycian
+sc ; Lydi ; Lydian
+sc ; Mahj ; Mahajani
+sc ; Maka ; Makasar
+sc ; Mand ; Mandaic
+sc ; Mani ; Manichaean
+sc ; Marc ; Marchen
+sc ; Medf ; Medefaidrin
+sc ; Mend ; Mende_Kikakui
+sc ; Merc ; Meroitic_Cursive
+sc ; Mero ; Meroitic_Hieroglyphs
+sc ; Mlym ; Malayalam
+sc ; Modi ; Modi
+sc ; Mong ; Mongolian
+sc ; Mroo ; Mro
+sc ; Mtei ; Meetei_Mayek
+sc ; Mult ; Multani
+sc ; Mymr ; Myanmar
+sc ; Nand ; Nandinagari
+sc ; Narb ; Old_North_Arabian
+sc ; Nbat ; Nabataean
+sc ; Newa ; Newa
+sc ; Nkoo ; Nko
+sc ; Nshu ; Nushu
+sc ; Ogam ; Ogham
+sc ; Olck ; Ol_Chiki
+sc ; Orkh ; Old_Turkic
+sc ; Orya ; Oriya
+sc ; Osge ; Osage
+sc ; Osma ; Osmanya
+sc ; Ougr ; Old_Uyghur
+sc ; Palm ; Palmyrene
+sc ; Pauc ; Pau_Cin_Hau
+sc ; Perm ; Old_Permic
+sc ; Phag ; Phags_Pa
+sc ; Phli ; Inscriptional_Pahlavi
+sc ; Phlp ; Psalter_Pahlavi
+sc ; Phnx ; Phoenician
+sc ; Plrd ; Miao
+sc ; Prti ; Inscriptional_Parthian
+sc ; Rjng ; Rejang
+sc ; Rohg ; Hanifi_Rohingya
+sc ; Runr ; Runic
+sc ; Samr ; Samaritan
+sc ; Sarb ; Old_South_Arabian
+sc ; Saur ; Saurashtra
+sc ; Sgnw ; SignWriting
+sc ; Shaw ; Shavian
+sc ; Shrd ; Sharada
+sc ; Sidd ; Siddham
+sc ; Sind ; Khudawadi
+sc ; Sinh ; Sinhala
+sc ; Sogd ; Sogdian
+sc ; Sogo ; Old_Sogdian
+sc ; Sora ; Sora_Sompeng
+sc ; Soyo ; Soyombo
+sc ; Sund ; Sundanese
+sc ; Sylo ; Syloti_Nagri
+sc ; Syrc ; Syriac
+sc ; Tagb ; Tagbanwa
+sc ; Takr ; Takri
+sc ; Tale ; Tai_Le
+sc ; Talu ; New_Tai_Lue
+sc ; Taml ; Tamil
+sc ; Tang ; Tangut
+sc ; Tavt ; Tai_Viet
+sc ; Telu ; Telugu
+sc ; Tfng ; Tifinagh
+sc ; Tglg ; Tagalog
+sc ; Thaa ; Thaana
+sc ; Thai ; Thai
+sc ; Tibt ; Tibetan
+sc ; Tirh ; Tirhuta
+sc ; Tnsa ; Tangsa
+sc ; Toto ; Toto
+sc ; Ugar ; Ugaritic
+sc ; Vaii ; Vai
+sc ; Vith ; Vithkuqi
+sc ; Wara ; Warang_Citi
+sc ; Wcho ; Wancho
+sc ; Xpeo ; Old_Persian
+sc ; Xsux ; Cuneiform
+sc ; Yezi ; Yezidi
+sc ; Yiii ; Yi
+sc ; Zanb ; Zanabazar_Square
+sc ; Zinh ; Inherited ; Qaai
+sc ; Zyyy ; Common
+sc ; Zzzz ; Unknown
+blk ; Adlam ; Adlam
+blk ; Aegean_Numbers ; Aegean_Numbers
+blk ; Ahom ; Ahom
+blk ; Alchemical ; Alchemical_Symbols
+blk ; Alphabetic_PF ; Alphabetic_Presentation_Forms
+blk ; Anatolian_Hieroglyphs ; Anatolian_Hieroglyphs
+blk ; Ancient_Greek_Music ; Ancient_Greek_Musical_Notation
+blk ; Ancient_Greek_Numbers ; Ancient_Greek_Numbers
+blk ; Ancient_Symbols ; Ancient_Symbols
+blk ; Arabic ; Arabic
+blk ; Arabic_Ext_A ; Arabic_Extended_A
+blk ; Arabic_Ext_B ; Arabic_Extended_B
+blk ; Arabic_Math ; Arabic_Mathematical_Alphabetic_Symbols
+blk ; Arabic_PF_A ; Arabic_Presentation_Forms_A
+blk ; Arabic_PF_B ; Arabic_Presentation_Forms_B
+blk ; Arabic_Sup ; Arabic_Supplement
+blk ; Armenian ; Armenian
+blk ; Arrows ; Arrows
+blk ; ASCII ; Basic_Latin
+blk ; Avestan ; Avestan
+blk ; Balinese ; Balinese
+blk ; Bamum ; Bamum
+blk ; Bamum_Sup ; Bamum_Supplement
+blk ; Bassa_Vah ; Bassa_Vah
+blk ; Batak ; Batak
+blk ; Bengali ; Bengali
+blk ; Bhaiksuki ; Bhaiksuki
+blk ; Block_Elements ; Block_Elements
+blk ; Bopomofo ; Bopomofo
+blk ; Bopomofo_Ext ; Bopomofo_Extended
+blk ; Box_Drawing ; Box_Drawing
+blk ; Brahmi ; Brahmi
+blk ; Braille ; Braille_Patterns
+blk ; Buginese ; Buginese
+blk ; Buhid ; Buhid
+blk ; Byzantine_Music ; Byzantine_Musical_Symbols
+blk ; Carian ; Carian
+blk ; Caucasian_Albanian ; Caucasian_Albanian
+blk ; Chakma ; Chakma
+blk ; Cham ; Cham
+blk ; Cherokee ; Cherokee
+blk ; Cherokee_Sup ; Cherokee_Supplement
+blk ; Chess_Symbols ; Chess_Symbols
+blk ; Chorasmian ; Chorasmian
+blk ; CJK ; CJK_Unified_Ideographs
+blk ; CJK_Compat ; CJK_Compatibility
+blk ; CJK_Compat_Forms ; CJK_Compatibility_Forms
+blk ; CJK_Compat_Ideographs ; CJK_Compatibility_Ideographs
+blk ; CJK_Compat_Ideographs_Sup ; CJK_Compatibility_Ideographs_Supplement
+blk ; CJK_Ext_A ; CJK_Unified_Ideographs_Extension_A
+blk ; CJK_Ext_B ; CJK_Unified_Ideographs_Extension_B
+blk ; CJK_Ext_C ; CJK_Unified_Ideographs_Extension_C
+blk ; CJK_Ext_D ; CJK_Unified_Ideographs_Extension_D
+blk ; CJK_Ext_E ; CJK_Unified_Ideographs_Extension_E
+blk ; CJK_Ext_F ; CJK_Unified_Ideographs_Extension_F
+blk ; CJK_Ext_G ; CJK_Unified_Ideographs_Extension_G
+blk ; CJK_Radicals_Sup ; CJK_Radicals_Supplement
+blk ; CJK_Strokes ; CJK_Strokes
+blk ; CJK_Symbols ; CJK_Symbols_And_Punctuation
+blk ; Compat_Jamo ; Hangul_Compatibility_Jamo
+blk ; Control_Pictures ; Control_Pictures
+blk ; Coptic ; Coptic
+blk ; Coptic_Epact_Numbers ; Coptic_Epact_Numbers
+blk ; Counting_Rod ; Counting_Rod_Numerals
+blk ; Cuneiform ; Cuneiform
+blk ; Cuneiform_Numbers ; Cuneiform_Numbers_And_Punctuation
+blk ; Currency_Symbols ; Currency_Symbols
+blk ; Cypriot_Syllabary ; Cypriot_Syllabary
+blk ; Cypro_Minoan ; Cypro_Minoan
+blk ; Cyrillic ; Cyrillic
+blk ; Cyrillic_Ext_A ; Cyrillic_Extended_A
+blk ; Cyrillic_Ext_B ; Cyrillic_Extended_B
+blk ; Cyrillic_Ext_C ; Cyrillic_Extended_C
+blk ; Cyrillic_Sup ; Cyrillic_Supplement ; Cyrillic_Supplementary
+blk ; Deseret ; Deseret
+blk ; Devanagari ; Devanagari
+blk ; Devanagari_Ext ; Devanagari_Extended
+blk ; Diacriticals ; Combining_Diacritical_Marks
+blk ; Diacriticals_Ext ; Combining_Diacritical_Marks_Extended
+blk ; Diacriticals_For_Symbols ; Combining_Diacritical_Marks_For_Symbols ; Combining_Marks_For_Symbols
+blk ; Diacriticals_Sup ; Combining_Diacritical_Marks_Supplement
+blk ; Dingbats ; Dingbats
+blk ; Dives_Akuru ; Dives_Akuru
+blk ; Dogra ; Dogra
+blk ; Domino ; Domino_Tiles
+blk ; Duployan ; Duployan
+blk ; Early_Dynastic_Cuneiform ; Early_Dynastic_Cuneiform
+blk ; Egyptian_Hieroglyph_Format_Controls ; Egyptian_Hieroglyph_Format_Controls
+blk ; Egyptian_Hieroglyphs ; Egyptian_Hieroglyphs
+blk ; Elbasan ; Elbasan
+blk ; Elymaic ; Elymaic
+blk ; Emoticons ; Emoticons
+blk ; Enclosed_Alphanum ; Enclosed_Alphanumerics
+blk ; Enclosed_Alphanum_Sup ; Enclosed_Alphanumeric_Supplement
+blk ; Enclosed_CJK ; Enclosed_CJK_Letters_And_Months
+blk ; Enclosed_Ideographic_Sup ; Enclosed_Ideographic_Supplement
+blk ; Ethiopic ; Ethiopic
+blk ; Ethiopic_Ext ; Ethiopic_Extended
+blk ; Ethiopic_Ext_A ; Ethiopic_Extended_A
+blk ; Ethiopic_Ext_B ; Ethiopic_Extended_B
+blk ; Ethiopic_Sup ; Ethiopic_Supplement
+blk ; Geometric_Shapes ; Geometric_Shapes
+blk ; Geometric_Shapes_Ext ; Geometric_Shapes_Extended
+blk ; Georgian ; Georgian
+blk ; Georgian_Ext ; Georgian_Extended
+blk ; Georgian_Sup ; Georgian_Supplement
+blk ; Glagolitic ; Glagolitic
+blk ; Glagolitic_Sup ; Glagolitic_Supplement
+blk ; Gothic ; Gothic
+blk ; Grantha ; Grantha
+blk ; Greek ; Greek_And_Coptic
+blk ; Greek_Ext ; Greek_Extended
+blk ; Gujarati ; Gujarati
+blk ; Gunjala_Gondi ; Gunjala_Gondi
+blk ; Gurmukhi ; Gurmukhi
+blk ; Half_And_Full_Forms ; Halfwidth_And_Fullwidth_Forms
+blk ; Half_Marks ; Combining_Half_Marks
+blk ; Hangul ; Hangul_Syllables
+blk ; Hanifi_Rohingya ; Hanifi_Rohingya
+blk ; Hanunoo ; Hanunoo
+blk ; Hatran ; Hatran
+blk ; Hebrew ; Hebrew
+blk ; High_PU_Surrogates ; High_Private_Use_Surrogates
+blk ; High_Surrogates ; High_Surrogates
+blk ; Hiragana ; Hiragana
+blk ; IDC ; Ideographic_Description_Characters
+blk ; Ideographic_Symbols ; Ideographic_Symbols_And_Punctuation
+blk ; Imperial_Aramaic ; Imperial_Aramaic
+blk ; Indic_Number_Forms ; Common_Indic_Number_Forms
+blk ; Indic_Siyaq_Numbers ; Indic_Siyaq_Numbers
+blk ; Inscriptional_Pahlavi ; Inscriptional_Pahlavi
+blk ; Inscriptional_Parthian ; Inscriptional_Parthian
+blk ; IPA_Ext ; IPA_Extensions
+blk ; Jamo ; Hangul_Jamo
+blk ; Jamo_Ext_A ; Hangul_Jamo_Extended_A
+blk ; Jamo_Ext_B ; Hangul_Jamo_Extended_B
+blk ; Javanese ; Javanese
+blk ; Kaithi ; Kaithi
+blk ; Kana_Ext_A ; Kana_Extended_A
+blk ; Kana_Ext_B ; Kana_Extended_B
+blk ; Kana_Sup ; Kana_Supplement
+blk ; Kanbun ; Kanbun
+blk ; Kangxi ; Kangxi_Radicals
+blk ; Kannada ; Kannada
+blk ; Katakana ; Katakana
+blk ; Katakana_Ext ; Katakana_Phonetic_Extensions
+blk ; Kayah_Li ; Kayah_Li
+blk ; Kharoshthi ; Kharoshthi
+blk ; Khitan_Small_Script ; Khitan_Small_Script
+blk ; Khmer ; Khmer
+blk ; Khmer_Symbols ; Khmer_Symbols
+blk ; Khojki ; Khojki
+blk ; Khudawadi ; Khudawadi
+blk ; Lao ; Lao
+blk ; Latin_1_Sup ; Latin_1_Supplement ; Latin_1
+blk ; Latin_Ext_A ; Latin_Extended_A
+blk ; Latin_Ext_Additional ; Latin_Extended_Additional
+blk ; Latin_Ext_B ; Latin_Extended_B
+blk ; Latin_Ext_C ; Latin_Extended_C
+blk ; Latin_Ext_D ; Latin_Extended_D
+blk ; Latin_Ext_E ; Latin_Extended_E
+blk ; Latin_Ext_F ; Latin_Extended_F
+blk ; Latin_Ext_G ; Latin_Extended_G
+blk ; Lepcha ; Lepcha
+blk ; Letterlike_Symbols ; Letterlike_Symbols
+blk ; Limbu ; Limbu
+blk ; Linear_A ; Linear_A
+blk ; Linear_B_Ideograms ; Linear_B_Ideograms
+blk ; Linear_B_Syllabary ; Linear_B_Syllabary
+blk ; Lisu ; Lisu
+blk ; Lisu_Sup ; Lisu_Supplement
+blk ; Low_Surrogates ; Low_Surrogates
+blk ; Lycian ; Lycian
+blk ; Lydian ; Lydian
+blk ; Mahajani ; Mahajani
+blk ; Mahjong ; Mahjong_Tiles
+blk ; Makasar ; Makasar
+blk ; Malayalam ; Malayalam
+blk ; Mandaic ; Mandaic
+blk ; Manichaean ; Manichaean
+blk ; Marchen ; Marchen
+blk ; Masaram_Gondi ; Masaram_Gondi
+blk ; Math_Alphanum ; Mathematical_Alphanumeric_Symbols
+blk ; Math_Operators ; Mathematical_Operators
+blk ; Mayan_Numerals ; Mayan_Numerals
+blk ; Medefaidrin ; Medefaidrin
+blk ; Meetei_Mayek ; Meetei_Mayek
+blk ; Meetei_Mayek_Ext ; Meetei_Mayek_Extensions
+blk ; Mende_Kikakui ; Mende_Kikakui
+blk ; Meroitic_Cursive ; Meroitic_Cursive
+blk ; Meroitic_Hieroglyphs ; Meroitic_Hieroglyphs
+blk ; Miao ; Miao
+blk ; Misc_Arrows ; Miscellaneous_Symbols_And_Arrows
+blk ; Misc_Math_Symbols_A ; Miscellaneous_Mathematical_Symbols_A
+blk ; Misc_Math_Symbols_B ; Miscellaneous_Mathematical_Symbols_B
+blk ; Misc_Pictographs ; Miscellaneous_Symbols_And_Pictographs
+blk ; Misc_Symbols ; Miscellaneous_Symbols
+blk ; Misc_Technical ; Miscellaneous_Technical
+blk ; Modi ; Modi
+blk ; Modifier_Letters ; Spacing_Modifier_Letters
+blk ; Modifier_Tone_Letters ; Modifier_Tone_Letters
+blk ; Mongolian ; Mongolian
+blk ; Mongolian_Sup ; Mongolian_Supplement
+blk ; Mro ; Mro
+blk ; Multani ; Multani
+blk ; Music ; Musical_Symbols
+blk ; Myanmar ; Myanmar
+blk ; Myanmar_Ext_A ; Myanmar_Extended_A
+blk ; Myanmar_Ext_B ; Myanmar_Extended_B
+blk ; Nabataean ; Nabataean
+blk ; Nandinagari ; Nandinagari
+blk ; NB ; No_Block
+blk ; Newa ; Newa
+blk ; New_Tai_Lue ; New_Tai_Lue
+blk ; NKo ; NKo
+blk ; Number_Forms ; Number_Forms
+blk ; Nushu ; Nushu
+blk ; Nyiakeng_Puachue_Hmong ; Nyiakeng_Puachue_Hmong
+blk ; OCR ; Optical_Character_Recognition
+blk ; Ogham ; Ogham
+blk ; Ol_Chiki ; Ol_Chiki
+blk ; Old_Hungarian ; Old_Hungarian
+blk ; Old_Italic ; Old_Italic
+blk ; Old_North_Arabian ; Old_North_Arabian
+blk ; Old_Permic ; Old_Permic
+blk ; Old_Persian ; Old_Persian
+blk ; Old_Sogdian ; Old_Sogdian
+blk ; Old_South_Arabian ; Old_South_Arabian
+blk ; Old_Turkic ; Old_Turkic
+blk ; Old_Uyghur ; Old_Uyghur
+blk ; Oriya ; Oriya
+blk ; Ornamental_Dingbats ; Ornamental_Dingbats
+blk ; Osage ; Osage
+blk ; Osmanya ; Osmanya
+blk ; Ottoman_Siyaq_Numbers ; Ottoman_Siyaq_Numbers
+blk ; Pahawh_Hmong ; Pahawh_Hmong
+blk ; Palmyrene ; Palmyrene
+blk ; Pau_Cin_Hau ; Pau_Cin_Hau
+blk ; Phags_Pa ; Phags_Pa
+blk ; Phaistos ; Phaistos_Disc
+blk ; Phoenician ; Phoenician
+blk ; Phonetic_Ext ; Phonetic_Extensions
+blk ; Phonetic_Ext_Sup ; Phonetic_Extensions_Supplement
+blk ; Playing_Cards ; Playing_Cards
+blk ; Psalter_Pahlavi ; Psalter_Pahlavi
+blk ; PUA ; Private_Use_Area ; Private_Use
+blk ; Punctuation ; General_Punctuation
+blk ; Rejang ; Rejang
+blk ; Rumi ; Rumi_Numeral_Symbols
+blk ; Runic ; Runic
+blk ; Samaritan ; Samaritan
+blk ; Saurashtra ; Saurashtra
+blk ; Sharada ; Sharada
+blk ; Shavian ; Shavian
+blk ; Shorthand_Format_Controls ; Shorthand_Format_Controls
+blk ; Siddham ; Siddham
+blk ; Sinhala ; Sinhala
+blk ; Sinhala_Archaic_Numbers ; Sinhala_Archaic_Numbers
+blk ; Small_Forms ; Small_Form_Variants
+blk ; Small_Kana_Ext ; Small_Kana_Extension
+blk ; Sogdian ; Sogdian
+blk ; Sora_Sompeng ; Sora_Sompeng
+blk ; Soyombo ; Soyombo
+blk ; Specials ; Specials
+blk ; Sundanese ; Sundanese
+blk ; Sundanese_Sup ; Sundanese_Supplement
+blk ; Sup_Arrows_A ; Supplemental_Arrows_A
+blk ; Sup_Arrows_B ; Supplemental_Arrows_B
+blk ; Sup_Arrows_C ; Supplemental_Arrows_C
+blk ; Super_And_Sub ; Superscripts_And_Subscripts
+blk ; Sup_Math_Operators ; Supplemental_Mathematical_Operators
+blk ; Sup_PUA_A ; Supplementary_Private_Use_Area_A
+blk ; Sup_PUA_B ; Supplementary_Private_Use_Area_B
+blk ; Sup_Punctuation ; Supplemental_Punctuation
+blk ; Sup_Symbols_And_Pictographs ; Supplemental_Symbols_And_Pictographs
+blk ; Sutton_SignWriting ; Sutton_SignWriting
+blk ; Syloti_Nagri ; Syloti_Nagri
+blk ; Symbols_And_Pictographs_Ext_A ; Symbols_And_Pictographs_Extended_A
+blk ; Symbols_For_Legacy_Computing ; Symbols_For_Legacy_Computing
+blk ; Syriac ; Syriac
+blk ; Syriac_Sup ; Syriac_Supplement
+blk ; Tagalog ; Tagalog
+blk ; Tagbanwa ; Tagbanwa
+blk ; Tags ; Tags
+blk ; Tai_Le ; Tai_Le
+blk ; Tai_Tham ; Tai_Tham
+blk ; Tai_Viet ; Tai_Viet
+blk ; Tai_Xuan_Jing ; Tai_Xuan_Jing_Symbols
+blk ; Takri ; Takri
+blk ; Tamil ; Tamil
+blk ; Tamil_Sup ; Tamil_Supplement
+blk ; Tangsa ; Tangsa
+blk ; Tangut ; Tangut
+blk ; Tangut_Components ; Tangut_Components
+blk ; Tangut_Sup ; Tangut_Supplement
+blk ; Telugu ; Telugu
+blk ; Thaana ; Thaana
+blk ; Thai ; Thai
+blk ; Tibetan ; Tibetan
+blk ; Tifinagh ; Tifinagh
+blk ; Tirhuta ; Tirhuta
+blk ; Toto ; Toto
+blk ; Transport_And_Map ; Transport_And_Map_Symbols
+blk ; UCAS ; Unified_Canadian_Aboriginal_Syllabics ; Canadian_Syllabics
+blk ; UCAS_Ext ; Unified_Canadian_Aboriginal_Syllabics_Extended
+blk ; UCAS_Ext_A ; Unified_Canadian_Aboriginal_Syllabics_Extended_A
+blk ; Ugaritic ; Ugaritic
+blk ; Vai ; Vai
+blk ; Vedic_Ext ; Vedic_Extensions
+blk ; Vertical_Forms ; Vertical_Forms
+blk ; Vithkuqi ; Vithkuqi
+blk ; VS ; Variation_Selectors
+blk ; VS_Sup ; Variation_Selectors_Supplement
+blk ; Wancho ; Wancho
+blk ; Warang_Citi ; Warang_Citi
+blk ; Yezidi ; Yezidi
+blk ; Yijing ; Yijing_Hexagram_Symbols
+blk ; Yi_Radicals ; Yi_Radicals
+blk ; Yi_Syllables ; Yi_Syllables
+blk ; Zanabazar_Square ; Zanabazar_Square
+blk ; Znamenny_Music ; Znamenny_Musical_Notation
+GCB ; CN ; Control
+GCB ; CR ; CR
+GCB ; EB ; E_Base
+GCB ; EBG ; E_Base_GAZ
+GCB ; EM ; E_Modifier
+GCB ; EX ; Extend
+GCB ; GAZ ; Glue_After_Zwj
+GCB ; L ; L
+GCB ; LF ; LF
+GCB ; LV ; LV
+GCB ; LVT ; LVT
+GCB ; PP ; Prepend
+GCB ; RI ; Regional_Indicator
+GCB ; SM ; SpacingMark
+GCB ; T ; T
+GCB ; V ; V
+GCB ; XX ; Other
+GCB ; ZWJ ; ZWJ
+WB ; CR ; CR
+WB ; DQ ; Double_Quote
+WB ; EB ; E_Base
+WB ; EBG ; E_Base_GAZ
+WB ; EM ; E_Modifier
+WB ; EX ; ExtendNumLet
+WB ; Extend ; Extend
+WB ; FO ; Format
+WB ; GAZ ; Glue_After_Zwj
+WB ; HL ; Hebrew_Letter
+WB ; KA ; Katakana
+WB ; LE ; ALetter
+WB ; LF ; LF
+WB ; MB ; MidNumLet
+WB ; ML ; MidLetter
+WB ; MN ; MidNum
+WB ; NL ; Newline
+WB ; NU ; Numeric
+WB ; RI ; Regional_Indicator
+WB ; SQ ; Single_Quote
+WB ; WSegSpace ; WSegSpace
+WB ; XX ; Other
+WB ; ZWJ ; ZWJ
+SB ; AT ; ATerm
+SB ; CL ; Close
+SB ; CR ; CR
+SB ; EX ; Extend
+SB ; FO ; Format
+SB ; LE ; OLetter
+SB ; LF ; LF
+SB ; LO ; Lower
+SB ; NU ; Numeric
+SB ; SC ; SContinue
+SB ; SE ; Sep
+SB ; SP ; Sp
+SB ; ST ; STerm
+SB ; UP ; Upper
+SB ; XX ; Other
+'''
+
+# The fields of the lines of the UCD file 'name', or of 'fallback' when the
+# snapshot leaves out the file.
+def alias_lines(ucd, name, fallback):
+    try:
+        text = open(ucd + '/' + name).read()
+    except IOError:
+        text = fallback
+    for line in text.splitlines():
+        fields = [x.strip() for x in line.split('#')[0].split(';')]
+        if len(fields) >= 2:
+            yield fields
+
+# Property and value names compared as in UAX #44-LM3, ignoring case,
+# whitespace, '_', '-' and a leading 'is'. This must match 'loose_name' in
+# 'src/unicodelib_names.cpp'.
+def loose_name(name):
+    key = re.sub(r"[\s_\-]", '', name).lower()
+    return key[2:] if key.startswith('is') else key
+
+# FNV-1a of the namespace byte and the name. This must match 'hash_name' in
+# 'src/unicodelib_names.cpp'.
+def hash_name(key, seed):
+    h = 0x811C9DC5 ^ seed
+    for b in key:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+# Finds a seed for each bucket of keys that sends its keys to free slots, so
+# that a lookup costs two hashes and one compare (hash and displace).
+def perfect_hash(keys):
+    n = len(keys)
+    bucketCount = (n + 3) // 4
+    buckets = [[] for i in range(bucketCount)]
+    for key in keys:
+        buckets[hash_name(key, 0) % bucketCount].append(key)
+
+    slots = [None] * n
+    seeds = [0] * bucketCount
+    for b in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            positions = [hash_name(key, seed) % n for key in buckets[b]]
+            if (len(set(positions)) == len(positions) and
+                    all(slots[p] is None for p in positions)):
+                break
+            seed += 1
+        assert seed <= 0xFFFF
+        seeds[b] = seed
+        for key, p in zip(buckets[b], positions):
+            slots[p] = key
+    return seeds, slots
+
+# The names of the properties the library has and of their values, keyed by a
+# namespace byte: 0 for property names and 1 + 'PropertyType' for the values of
+# a property, with their aliases from 'PropertyAliases.txt' and
+# 'PropertyValueAliases.txt'.
+def genPropertyNameTable(ucd, out, propertyNames, derivedPropertyNames):
+    fout = open(out + '/_property_names.cpp', 'w')
+
+    entries = {}
+    def add(ns, name, type, value):
+        key = bytes([ns]) + loose_name(name).encode()
+        assert entries.get(key, (type, value)) == (type, value), name
+        entries[key] = (type, value)
+
+    def valueNamespace(type):
+        return 1 + [x[0] for x in PropertyTypes].index(type)
+
+    for names in PropertyTypes[:6]:
+        for name in names:
+            add(0, name, names[0], 0)
+    for i, name in enumerate(propertyNames):
+        add(0, name, 'Property', 1 << i)
+    for i, name in enumerate(derivedPropertyNames):
+        add(0, name, 'Derived_Property', 1 << i)
+
+    ns = valueNamespace('General_Category')
+    for i, names in enumerate(GeneralCategoryNames):
+        for name in [GeneralCategories[i]] + names:
+            add(ns, name, 'General_Category', 1 << i)
+    for names, categories in GeneralCategoryGroups:
+        mask = sum([1 << GeneralCategories.index(x) for x in categories])
+        for name in names:
+            add(ns, name, 'General_Category', mask)
+
+    for type, path, unassigned in [
+            ('Script', '/Scripts.txt', ['Unknown', 'Zzzz']),
+            ('Block', '/Blocks.txt', ['No_Block', 'NB']),
+            ('Grapheme_Cluster_Break', '/auxiliary/GraphemeBreakProperty.txt',
+             ['Other', 'XX']),
+            ('Word_Break', '/auxiliary/WordBreakProperty.txt',
+             ['Other', 'XX']),
+            ('Sentence_Break', '/auxiliary/SentenceBreakProperty.txt',
+             ['Other', 'XX'])]:
+        ns = valueNamespace(type)
+        for i, name in enumerate(property_value_names(ucd + path)):
+            add(ns, name, type, i)
+        for name in unassigned:
+            add(ns, name, type, 0)
+
+    # Every property and value of the library must get its short name, so that
+    # a UCD update that adds one fails here instead of leaving it out.
+    aliased = set()
+
+    # 'short ; long ; other aliases'
+    for fields in alias_lines(ucd, 'PropertyAliases.txt',
+                              PropertyAliasesFallback):
+        for name in fields:
+            key = b'\0' + loose_name(name).encode()
+            if key in entries:
+                for alias in fields:
+                    add(0, alias, *entries[key])
+                aliased.add((0,) + entries[key])
+                break
+
+    # 'property ; short ; long ; other aliases'
+    for fields in alias_lines(ucd, 'PropertyValueAliases.txt',
+                              PropertyValueAliasesFallback):
+        key = b'\0' + loose_name(fields[0]).encode()
+        type = entries.get(key, (None, 0))[0]
+        if type is None or type in ('Property', 'Derived_Property'):
+            continue
+        ns = valueNamespace(type)
+        for name in fields[1:]:
+            key = bytes([ns]) + loose_name(name).encode()
+            if key in entries:
+                for alias in fields[1:]:
+                    add(ns, alias, *entries[key])
+                aliased.add((ns,) + entries[key])
+                break
+
+    for key, (type, value) in entries.items():
+        if key[0] == 0 and type in ('Property', 'Derived_Property') or \
+           key[0] > valueNamespace('General_Category'):
+            assert (key[0], type, value) in aliased, \
+                'no alias for %s' % key[1:].decode()
+
+    seeds, slots = perfect_hash(list(entries))
+    pool = b''.join([key[1:] for key in slots])
+    assert len(pool) <= 0xFFFF
+
+    records = []
+    offset = 0
+    for key in slots:
+        type, value = entries[key]
+        records.append((offset, len(key) - 1, key[0], type, value))
+        offset += len(key) - 1
+
+    write_enum_asserts(fout, 'PropertyType', [x[0] for x in PropertyTypes])
+    # The group masks of 'unicodelib.h' must select the same categories.
+    for names, categories in GeneralCategoryGroups:
+        mask = sum([1 << GeneralCategories.index(x) for x in categories])
+        fout.write("static_assert(GeneralCategoryMask_%s == 0x%X, \"\");\n" %
+                   (names[1], mask))
+    write_array(fout, '_property_name_pool', 'char', pool, 'B', section=False)
+    write_array(fout, '_property_names', 'PropertyNameEntry', records, '',
+                lambda x: "{%d, %d, %d, PropertyType::%s, 0x%X}" % x,
+                section=False)
+    write_array(fout, '_property_name_seeds', 'uint16_t', seeds, 'H',
+                section=False)
 
 #------------------------------------------------------------------------------
 # Main
 #------------------------------------------------------------------------------
 
 if (len(sys.argv) < 3):
-    print('usage: python gen_tables.py UCD_DIR OUT_DIR')
+    print('usage: python gen_tables.py UCD_DIR OUT_DIR [DATA_FILE]')
 else:
     ucd = sys.argv[1]
     out = sys.argv[2]
 
-    genGeneralCategoryPropertyTable(ucd, out)
-    getPropertyTable(ucd, out)
-    getDerivedCorePropertyTable(ucd, out)
-    getSimpleCaseMappingTable(ucd, out)
+    version = genUnicodeVersion(ucd, out)
+    generalCategories = genGeneralCategoryPropertyTable(ucd, out)
+    properties, propertyNames = getPropertyTable(ucd, out)
+    derivedProperties, derivedPropertyNames = getDerivedCorePropertyTable(ucd,
+                                                                          out)
+    simpleCaseMappings = getSimpleCaseMappingTable(ucd)
     getSpecialCaseMappingTable(ucd, out)
-    getCaseFoldingTable(ucd, out)
-    genBlockPropertyTable(ucd, out)
-    genScriptPropertyTable(ucd, out)
-    genScriptExtensionIdTable(ucd, out)
-    genScriptExtensionPropertyForIdTable(ucd, out)
-    genNomalizationPropertyTable(ucd, out)
+    simpleCaseFoldings = getCaseFoldingTable(ucd, out)
+    genSimpleCaseMappingTable(out, simpleCaseMappings, simpleCaseFoldings)
+    genLatin1RecordTable(out, generalCategories, properties, derivedProperties,
+                         simpleCaseMappings, simpleCaseFoldings)
+    blocks = genBlockPropertyTable(ucd, out)
+    scripts = genScriptPropertyTable(ucd, out)
+    genScriptExtensionTable(ucd, out)
+    genCombiningClassPropertyTable(ucd, out)
+    genEmojiPropertyTable(ucd, out)
+    genDecompositionPropertyTable(ucd, out)
     genNomalizationCompositionTable(ucd, out)
-    getGraphemeBreakPropertyTable(ucd, out)
-    getWordBreakPropertyTable(ucd, out)
-    getSentenceBreakPropertyTable(ucd, out)
-    getEmojiPropertyTable(ucd, out)
+    breaks = genCodePointRecordTable(ucd, out)
+    genPropertyRangeTables(out, generalCategories, properties,
+                           derivedProperties, breaks, blocks, scripts)
+    genPropertyNameTable(ucd, out, propertyNames, derivedPropertyNames)
+
+    if len(sys.argv) > 3:
+        write_data_file(sys.argv[3], version)
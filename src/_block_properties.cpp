@@ -0,0 +1,2460 @@
+static_assert(static_cast<int>(Block::Unassigned) == 0, "");
+static_assert(static_cast<int>(Block::BasicLatin) == 1, "");
+static_assert(static_cast<int>(Block::Latin1Supplement) == 2, "");
+static_assert(static_cast<int>(Block::LatinExtendedA) == 3, "");
+static_assert(static_cast<int>(Block::LatinExtendedB) == 4, "");
+static_assert(static_cast<int>(Block::IPAExtensions) == 5, "");
+static_assert(static_cast<int>(Block::SpacingModifierLetters) == 6, "");
+static_assert(static_cast<int>(Block::CombiningDiacriticalMarks) == 7, "");
+static_assert(static_cast<int>(Block::GreekAndCoptic) == 8, "");
+static_assert(static_cast<int>(Block::Cyrillic) == 9, "");
+static_assert(static_cast<int>(Block::CyrillicSupplement) == 10, "");
+static_assert(static_cast<int>(Block::Armenian) == 11, "");
+static_assert(static_cast<int>(Block::Hebrew) == 12, "");
+static_assert(static_cast<int>(Block::Arabic) == 13, "");
+static_assert(static_cast<int>(Block::Syriac) == 14, "");
+static_assert(static_cast<int>(Block::ArabicSupplement) == 15, "");
+static_assert(static_cast<int>(Block::Thaana) == 16, "");
+static_assert(static_cast<int>(Block::NKo) == 17, "");
+static_assert(static_cast<int>(Block::Samaritan) == 18, "");
+static_assert(static_cast<int>(Block::Mandaic) == 19, "");
+static_assert(static_cast<int>(Block::SyriacSupplement) == 20, "");
+static_assert(static_cast<int>(Block::ArabicExtendedA) == 21, "");
+static_assert(static_cast<int>(Block::Devanagari) == 22, "");
+static_assert(static_cast<int>(Block::Bengali) == 23, "");
+static_assert(static_cast<int>(Block::Gurmukhi) == 24, "");
+static_assert(static_cast<int>(Block::Gujarati) == 25, "");
+static_assert(static_cast<int>(Block::Oriya) == 26, "");
+static_assert(static_cast<int>(Block::Tamil) == 27, "");
+static_assert(static_cast<int>(Block::Telugu) == 28, "");
+static_assert(static_cast<int>(Block::Kannada) == 29, "");
+static_assert(static_cast<int>(Block::Malayalam) == 30, "");
+static_assert(static_cast<int>(Block::Sinhala) == 31, "");
+static_assert(static_cast<int>(Block::Thai) == 32, "");
+static_assert(static_cast<int>(Block::Lao) == 33, "");
+static_assert(static_cast<int>(Block::Tibetan) == 34, "");
+static_assert(static_cast<int>(Block::Myanmar) == 35, "");
+static_assert(static_cast<int>(Block::Georgian) == 36, "");
+static_assert(static_cast<int>(Block::HangulJamo) == 37, "");
+static_assert(static_cast<int>(Block::Ethiopic) == 38, "");
+static_assert(static_cast<int>(Block::EthiopicSupplement) == 39, "");
+static_assert(static_cast<int>(Block::Cherokee) == 40, "");
+static_assert(static_cast<int>(Block::UnifiedCanadianAboriginalSyllabics) == 41, "");
+static_assert(static_cast<int>(Block::Ogham) == 42, "");
+static_assert(static_cast<int>(Block::Runic) == 43, "");
+static_assert(static_cast<int>(Block::Tagalog) == 44, "");
+static_assert(static_cast<int>(Block::Hanunoo) == 45, "");
+static_assert(static_cast<int>(Block::Buhid) == 46, "");
+static_assert(static_cast<int>(Block::Tagbanwa) == 47, "");
+static_assert(static_cast<int>(Block::Khmer) == 48, "");
+static_assert(static_cast<int>(Block::Mongolian) == 49, "");
+static_assert(static_cast<int>(Block::UnifiedCanadianAboriginalSyllabicsExtended) == 50, "");
+static_assert(static_cast<int>(Block::Limbu) == 51, "");
+static_assert(static_cast<int>(Block::TaiLe) == 52, "");
+static_assert(static_cast<int>(Block::NewTaiLue) == 53, "");
+static_assert(static_cast<int>(Block::KhmerSymbols) == 54, "");
+static_assert(static_cast<int>(Block::Buginese) == 55, "");
+static_assert(static_cast<int>(Block::TaiTham) == 56, "");
+static_assert(static_cast<int>(Block::CombiningDiacriticalMarksExtended) == 57, "");
+static_assert(static_cast<int>(Block::Balinese) == 58, "");
+static_assert(static_cast<int>(Block::Sundanese) == 59, "");
+static_assert(static_cast<int>(Block::Batak) == 60, "");
+static_assert(static_cast<int>(Block::Lepcha) == 61, "");
+static_assert(static_cast<int>(Block::OlChiki) == 62, "");
+static_assert(static_cast<int>(Block::CyrillicExtendedC) == 63, "");
+static_assert(static_cast<int>(Block::GeorgianExtended) == 64, "");
+static_assert(static_cast<int>(Block::SundaneseSupplement) == 65, "");
+static_assert(static_cast<int>(Block::VedicExtensions) == 66, "");
+static_assert(static_cast<int>(Block::PhoneticExtensions) == 67, "");
+static_assert(static_cast<int>(Block::PhoneticExtensionsSupplement) == 68, "");
+static_assert(static_cast<int>(Block::CombiningDiacriticalMarksSupplement) == 69, "");
+static_assert(static_cast<int>(Block::LatinExtendedAdditional) == 70, "");
+static_assert(static_cast<int>(Block::GreekExtended) == 71, "");
+static_assert(static_cast<int>(Block::GeneralPunctuation) == 72, "");
+static_assert(static_cast<int>(Block::SuperscriptsAndSubscripts) == 73, "");
+static_assert(static_cast<int>(Block::CurrencySymbols) == 74, "");
+static_assert(static_cast<int>(Block::CombiningDiacriticalMarksForSymbols) == 75, "");
+static_assert(static_cast<int>(Block::LetterlikeSymbols) == 76, "");
+static_assert(static_cast<int>(Block::NumberForms) == 77, "");
+static_assert(static_cast<int>(Block::Arrows) == 78, "");
+static_assert(static_cast<int>(Block::MathematicalOperators) == 79, "");
+static_assert(static_cast<int>(Block::MiscellaneousTechnical) == 80, "");
+static_assert(static_cast<int>(Block::ControlPictures) == 81, "");
+static_assert(static_cast<int>(Block::OpticalCharacterRecognition) == 82, "");
+static_assert(static_cast<int>(Block::EnclosedAlphanumerics) == 83, "");
+static_assert(static_cast<int>(Block::BoxDrawing) == 84, "");
+static_assert(static_cast<int>(Block::BlockElements) == 85, "");
+static_assert(static_cast<int>(Block::GeometricShapes) == 86, "");
+static_assert(static_cast<int>(Block::MiscellaneousSymbols) == 87, "");
+static_assert(static_cast<int>(Block::Dingbats) == 88, "");
+static_assert(static_cast<int>(Block::MiscellaneousMathematicalSymbolsA) == 89, "");
+static_assert(static_cast<int>(Block::SupplementalArrowsA) == 90, "");
+static_assert(static_cast<int>(Block::BraillePatterns) == 91, "");
+static_assert(static_cast<int>(Block::SupplementalArrowsB) == 92, "");
+static_assert(static_cast<int>(Block::MiscellaneousMathematicalSymbolsB) == 93, "");
+static_assert(static_cast<int>(Block::SupplementalMathematicalOperators) == 94, "");
+static_assert(static_cast<int>(Block::MiscellaneousSymbolsAndArrows) == 95, "");
+static_assert(static_cast<int>(Block::Glagolitic) == 96, "");
+static_assert(static_cast<int>(Block::LatinExtendedC) == 97, "");
+static_assert(static_cast<int>(Block::Coptic) == 98, "");
+static_assert(static_cast<int>(Block::GeorgianSupplement) == 99, "");
+static_assert(static_cast<int>(Block::Tifinagh) == 100, "");
+static_assert(static_cast<int>(Block::EthiopicExtended) == 101, "");
+static_assert(static_cast<int>(Block::CyrillicExtendedA) == 102, "");
+static_assert(static_cast<int>(Block::SupplementalPunctuation) == 103, "");
+static_assert(static_cast<int>(Block::CJKRadicalsSupplement) == 104, "");
+static_assert(static_cast<int>(Block::KangxiRadicals) == 105, "");
+static_assert(static_cast<int>(Block::IdeographicDescriptionCharacters) == 106, "");
+static_assert(static_cast<int>(Block::CJKSymbolsAndPunctuation) == 107, "");
+static_assert(static_cast<int>(Block::Hiragana) == 108, "");
+static_assert(static_cast<int>(Block::Katakana) == 109, "");
+static_assert(static_cast<int>(Block::Bopomofo) == 110, "");
+static_assert(static_cast<int>(Block::HangulCompatibilityJamo) == 111, "");
+static_assert(static_cast<int>(Block::Kanbun) == 112, "");
+static_assert(static_cast<int>(Block::BopomofoExtended) == 113, "");
+static_assert(static_cast<int>(Block::CJKStrokes) == 114, "");
+static_assert(static_cast<int>(Block::KatakanaPhoneticExtensions) == 115, "");
+static_assert(static_cast<int>(Block::EnclosedCJKLettersAndMonths) == 116, "");
+static_assert(static_cast<int>(Block::CJKCompatibility) == 117, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionA) == 118, "");
+static_assert(static_cast<int>(Block::YijingHexagramSymbols) == 119, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographs) == 120, "");
+static_assert(static_cast<int>(Block::YiSyllables) == 121, "");
+static_assert(static_cast<int>(Block::YiRadicals) == 122, "");
+static_assert(static_cast<int>(Block::Lisu) == 123, "");
+static_assert(static_cast<int>(Block::Vai) == 124, "");
+static_assert(static_cast<int>(Block::CyrillicExtendedB) == 125, "");
+static_assert(static_cast<int>(Block::Bamum) == 126, "");
+static_assert(static_cast<int>(Block::ModifierToneLetters) == 127, "");
+static_assert(static_cast<int>(Block::LatinExtendedD) == 128, "");
+static_assert(static_cast<int>(Block::SylotiNagri) == 129, "");
+static_assert(static_cast<int>(Block::CommonIndicNumberForms) == 130, "");
+static_assert(static_cast<int>(Block::PhagsPa) == 131, "");
+static_assert(static_cast<int>(Block::Saurashtra) == 132, "");
+static_assert(static_cast<int>(Block::DevanagariExtended) == 133, "");
+static_assert(static_cast<int>(Block::KayahLi) == 134, "");
+static_assert(static_cast<int>(Block::Rejang) == 135, "");
+static_assert(static_cast<int>(Block::HangulJamoExtendedA) == 136, "");
+static_assert(static_cast<int>(Block::Javanese) == 137, "");
+static_assert(static_cast<int>(Block::MyanmarExtendedB) == 138, "");
+static_assert(static_cast<int>(Block::Cham) == 139, "");
+static_assert(static_cast<int>(Block::MyanmarExtendedA) == 140, "");
+static_assert(static_cast<int>(Block::TaiViet) == 141, "");
+static_assert(static_cast<int>(Block::MeeteiMayekExtensions) == 142, "");
+static_assert(static_cast<int>(Block::EthiopicExtendedA) == 143, "");
+static_assert(static_cast<int>(Block::LatinExtendedE) == 144, "");
+static_assert(static_cast<int>(Block::CherokeeSupplement) == 145, "");
+static_assert(static_cast<int>(Block::MeeteiMayek) == 146, "");
+static_assert(static_cast<int>(Block::HangulSyllables) == 147, "");
+static_assert(static_cast<int>(Block::HangulJamoExtendedB) == 148, "");
+static_assert(static_cast<int>(Block::HighSurrogates) == 149, "");
+static_assert(static_cast<int>(Block::HighPrivateUseSurrogates) == 150, "");
+static_assert(static_cast<int>(Block::LowSurrogates) == 151, "");
+static_assert(static_cast<int>(Block::PrivateUseArea) == 152, "");
+static_assert(static_cast<int>(Block::CJKCompatibilityIdeographs) == 153, "");
+static_assert(static_cast<int>(Block::AlphabeticPresentationForms) == 154, "");
+static_assert(static_cast<int>(Block::ArabicPresentationFormsA) == 155, "");
+static_assert(static_cast<int>(Block::VariationSelectors) == 156, "");
+static_assert(static_cast<int>(Block::VerticalForms) == 157, "");
+static_assert(static_cast<int>(Block::CombiningHalfMarks) == 158, "");
+static_assert(static_cast<int>(Block::CJKCompatibilityForms) == 159, "");
+static_assert(static_cast<int>(Block::SmallFormVariants) == 160, "");
+static_assert(static_cast<int>(Block::ArabicPresentationFormsB) == 161, "");
+static_assert(static_cast<int>(Block::HalfwidthAndFullwidthForms) == 162, "");
+static_assert(static_cast<int>(Block::Specials) == 163, "");
+static_assert(static_cast<int>(Block::LinearBSyllabary) == 164, "");
+static_assert(static_cast<int>(Block::LinearBIdeograms) == 165, "");
+static_assert(static_cast<int>(Block::AegeanNumbers) == 166, "");
+static_assert(static_cast<int>(Block::AncientGreekNumbers) == 167, "");
+static_assert(static_cast<int>(Block::AncientSymbols) == 168, "");
+static_assert(static_cast<int>(Block::PhaistosDisc) == 169, "");
+static_assert(static_cast<int>(Block::Lycian) == 170, "");
+static_assert(static_cast<int>(Block::Carian) == 171, "");
+static_assert(static_cast<int>(Block::CopticEpactNumbers) == 172, "");
+static_assert(static_cast<int>(Block::OldItalic) == 173, "");
+static_assert(static_cast<int>(Block::Gothic) == 174, "");
+static_assert(static_cast<int>(Block::OldPermic) == 175, "");
+static_assert(static_cast<int>(Block::Ugaritic) == 176, "");
+static_assert(static_cast<int>(Block::OldPersian) == 177, "");
+static_assert(static_cast<int>(Block::Deseret) == 178, "");
+static_assert(static_cast<int>(Block::Shavian) == 179, "");
+static_assert(static_cast<int>(Block::Osmanya) == 180, "");
+static_assert(static_cast<int>(Block::Osage) == 181, "");
+static_assert(static_cast<int>(Block::Elbasan) == 182, "");
+static_assert(static_cast<int>(Block::CaucasianAlbanian) == 183, "");
+static_assert(static_cast<int>(Block::LinearA) == 184, "");
+static_assert(static_cast<int>(Block::CypriotSyllabary) == 185, "");
+static_assert(static_cast<int>(Block::ImperialAramaic) == 186, "");
+static_assert(static_cast<int>(Block::Palmyrene) == 187, "");
+static_assert(static_cast<int>(Block::Nabataean) == 188, "");
+static_assert(static_cast<int>(Block::Hatran) == 189, "");
+static_assert(static_cast<int>(Block::Phoenician) == 190, "");
+static_assert(static_cast<int>(Block::Lydian) == 191, "");
+static_assert(static_cast<int>(Block::MeroiticHieroglyphs) == 192, "");
+static_assert(static_cast<int>(Block::MeroiticCursive) == 193, "");
+static_assert(static_cast<int>(Block::Kharoshthi) == 194, "");
+static_assert(static_cast<int>(Block::OldSouthArabian) == 195, "");
+static_assert(static_cast<int>(Block::OldNorthArabian) == 196, "");
+static_assert(static_cast<int>(Block::Manichaean) == 197, "");
+static_assert(static_cast<int>(Block::Avestan) == 198, "");
+static_assert(static_cast<int>(Block::InscriptionalParthian) == 199, "");
+static_assert(static_cast<int>(Block::InscriptionalPahlavi) == 200, "");
+static_assert(static_cast<int>(Block::PsalterPahlavi) == 201, "");
+static_assert(static_cast<int>(Block::OldTurkic) == 202, "");
+static_assert(static_cast<int>(Block::OldHungarian) == 203, "");
+static_assert(static_cast<int>(Block::HanifiRohingya) == 204, "");
+static_assert(static_cast<int>(Block::RumiNumeralSymbols) == 205, "");
+static_assert(static_cast<int>(Block::Yezidi) == 206, "");
+static_assert(static_cast<int>(Block::OldSogdian) == 207, "");
+static_assert(static_cast<int>(Block::Sogdian) == 208, "");
+static_assert(static_cast<int>(Block::Chorasmian) == 209, "");
+static_assert(static_cast<int>(Block::Elymaic) == 210, "");
+static_assert(static_cast<int>(Block::Brahmi) == 211, "");
+static_assert(static_cast<int>(Block::Kaithi) == 212, "");
+static_assert(static_cast<int>(Block::SoraSompeng) == 213, "");
+static_assert(static_cast<int>(Block::Chakma) == 214, "");
+static_assert(static_cast<int>(Block::Mahajani) == 215, "");
+static_assert(static_cast<int>(Block::Sharada) == 216, "");
+static_assert(static_cast<int>(Block::SinhalaArchaicNumbers) == 217, "");
+static_assert(static_cast<int>(Block::Khojki) == 218, "");
+static_assert(static_cast<int>(Block::Multani) == 219, "");
+static_assert(static_cast<int>(Block::Khudawadi) == 220, "");
+static_assert(static_cast<int>(Block::Grantha) == 221, "");
+static_assert(static_cast<int>(Block::Newa) == 222, "");
+static_assert(static_cast<int>(Block::Tirhuta) == 223, "");
+static_assert(static_cast<int>(Block::Siddham) == 224, "");
+static_assert(static_cast<int>(Block::Modi) == 225, "");
+static_assert(static_cast<int>(Block::MongolianSupplement) == 226, "");
+static_assert(static_cast<int>(Block::Takri) == 227, "");
+static_assert(static_cast<int>(Block::Ahom) == 228, "");
+static_assert(static_cast<int>(Block::Dogra) == 229, "");
+static_assert(static_cast<int>(Block::WarangCiti) == 230, "");
+static_assert(static_cast<int>(Block::DivesAkuru) == 231, "");
+static_assert(static_cast<int>(Block::Nandinagari) == 232, "");
+static_assert(static_cast<int>(Block::ZanabazarSquare) == 233, "");
+static_assert(static_cast<int>(Block::Soyombo) == 234, "");
+static_assert(static_cast<int>(Block::PauCinHau) == 235, "");
+static_assert(static_cast<int>(Block::Bhaiksuki) == 236, "");
+static_assert(static_cast<int>(Block::Marchen) == 237, "");
+static_assert(static_cast<int>(Block::MasaramGondi) == 238, "");
+static_assert(static_cast<int>(Block::GunjalaGondi) == 239, "");
+static_assert(static_cast<int>(Block::Makasar) == 240, "");
+static_assert(static_cast<int>(Block::LisuSupplement) == 241, "");
+static_assert(static_cast<int>(Block::TamilSupplement) == 242, "");
+static_assert(static_cast<int>(Block::Cuneiform) == 243, "");
+static_assert(static_cast<int>(Block::CuneiformNumbersAndPunctuation) == 244, "");
+static_assert(static_cast<int>(Block::EarlyDynasticCuneiform) == 245, "");
+static_assert(static_cast<int>(Block::EgyptianHieroglyphs) == 246, "");
+static_assert(static_cast<int>(Block::EgyptianHieroglyphFormatControls) == 247, "");
+static_assert(static_cast<int>(Block::AnatolianHieroglyphs) == 248, "");
+static_assert(static_cast<int>(Block::BamumSupplement) == 249, "");
+static_assert(static_cast<int>(Block::Mro) == 250, "");
+static_assert(static_cast<int>(Block::BassaVah) == 251, "");
+static_assert(static_cast<int>(Block::PahawhHmong) == 252, "");
+static_assert(static_cast<int>(Block::Medefaidrin) == 253, "");
+static_assert(static_cast<int>(Block::Miao) == 254, "");
+static_assert(static_cast<int>(Block::IdeographicSymbolsAndPunctuation) == 255, "");
+static_assert(static_cast<int>(Block::Tangut) == 256, "");
+static_assert(static_cast<int>(Block::TangutComponents) == 257, "");
+static_assert(static_cast<int>(Block::KhitanSmallScript) == 258, "");
+static_assert(static_cast<int>(Block::TangutSupplement) == 259, "");
+static_assert(static_cast<int>(Block::KanaSupplement) == 260, "");
+static_assert(static_cast<int>(Block::KanaExtendedA) == 261, "");
+static_assert(static_cast<int>(Block::SmallKanaExtension) == 262, "");
+static_assert(static_cast<int>(Block::Nushu) == 263, "");
+static_assert(static_cast<int>(Block::Duployan) == 264, "");
+static_assert(static_cast<int>(Block::ShorthandFormatControls) == 265, "");
+static_assert(static_cast<int>(Block::ByzantineMusicalSymbols) == 266, "");
+static_assert(static_cast<int>(Block::MusicalSymbols) == 267, "");
+static_assert(static_cast<int>(Block::AncientGreekMusicalNotation) == 268, "");
+static_assert(static_cast<int>(Block::MayanNumerals) == 269, "");
+static_assert(static_cast<int>(Block::TaiXuanJingSymbols) == 270, "");
+static_assert(static_cast<int>(Block::CountingRodNumerals) == 271, "");
+static_assert(static_cast<int>(Block::MathematicalAlphanumericSymbols) == 272, "");
+static_assert(static_cast<int>(Block::SuttonSignWriting) == 273, "");
+static_assert(static_cast<int>(Block::GlagoliticSupplement) == 274, "");
+static_assert(static_cast<int>(Block::NyiakengPuachueHmong) == 275, "");
+static_assert(static_cast<int>(Block::Wancho) == 276, "");
+static_assert(static_cast<int>(Block::MendeKikakui) == 277, "");
+static_assert(static_cast<int>(Block::Adlam) == 278, "");
+static_assert(static_cast<int>(Block::IndicSiyaqNumbers) == 279, "");
+static_assert(static_cast<int>(Block::OttomanSiyaqNumbers) == 280, "");
+static_assert(static_cast<int>(Block::ArabicMathematicalAlphabeticSymbols) == 281, "");
+static_assert(static_cast<int>(Block::MahjongTiles) == 282, "");
+static_assert(static_cast<int>(Block::DominoTiles) == 283, "");
+static_assert(static_cast<int>(Block::PlayingCards) == 284, "");
+static_assert(static_cast<int>(Block::EnclosedAlphanumericSupplement) == 285, "");
+static_assert(static_cast<int>(Block::EnclosedIdeographicSupplement) == 286, "");
+static_assert(static_cast<int>(Block::MiscellaneousSymbolsAndPictographs) == 287, "");
+static_assert(static_cast<int>(Block::Emoticons) == 288, "");
+static_assert(static_cast<int>(Block::OrnamentalDingbats) == 289, "");
+static_assert(static_cast<int>(Block::TransportAndMapSymbols) == 290, "");
+static_assert(static_cast<int>(Block::AlchemicalSymbols) == 291, "");
+static_assert(static_cast<int>(Block::GeometricShapesExtended) == 292, "");
+static_assert(static_cast<int>(Block::SupplementalArrowsC) == 293, "");
+static_assert(static_cast<int>(Block::SupplementalSymbolsAndPictographs) == 294, "");
+static_assert(static_cast<int>(Block::ChessSymbols) == 295, "");
+static_assert(static_cast<int>(Block::SymbolsAndPictographsExtendedA) == 296, "");
+static_assert(static_cast<int>(Block::SymbolsForLegacyComputing) == 297, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionB) == 298, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionC) == 299, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionD) == 300, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionE) == 301, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionF) == 302, "");
+static_assert(static_cast<int>(Block::CJKCompatibilityIdeographsSupplement) == 303, "");
+static_assert(static_cast<int>(Block::CJKUnifiedIdeographsExtensionG) == 304, "");
+static_assert(static_cast<int>(Block::Tags) == 305, "");
+static_assert(static_cast<int>(Block::VariationSelectorsSupplement) == 306, "");
+static_assert(static_cast<int>(Block::SupplementaryPrivateUseAreaA) == 307, "");
+static_assert(static_cast<int>(Block::SupplementaryPrivateUseAreaB) == 308, "");
+const uint16_t _block_properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 960, 960, 960, 960, 960, 960, 960, 960, 960, 960, 960, 960,
+960, 960, 960, 960, 960, 960, 960, 960, 1024, 1088, 1152, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1280, 1344, 1408, 1472, 1472, 1472,
+1472, 1472, 1472, 1536, 1600, 1664, 1728, 1792, 1856, 1920, 1984, 2048, 2112,
+2176, 2240, 2304, 2304, 2368, 2432, 2304, 2304, 2304, 2496, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2560, 2624, 2688, 2688, 2688, 2688, 2688, 2688,
+2752, 2816, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2880, 2304, 2304,
+2944, 2304, 2304, 2304, 2304, 3008, 3072, 3136, 2304, 3200, 2304, 3264, 3328,
+3392, 3456, 3520, 2304, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
+3584, 3584, 3584, 3584, 3584, 3584, 3648, 3712, 3712, 3712, 3776, 3840, 3904,
+3904, 3904, 3904, 3968, 4032, 4032, 4032, 4032, 4032, 4032, 4096, 2304, 2304,
+2304, 4160, 2304, 4224, 4224, 4224, 4224, 4288, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 4352, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
+2304, 2304, 2304, 2304, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
+4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
+4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
+4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
+4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
+4480, 4480,
+};
+const uint16_t _block_properties_stage2[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 32, 32, 32, 32, 32, 32,
+32, 32, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 64, 64, 64, 64, 64,
+64, 80, 80, 80, 80, 80, 96, 96, 96, 96, 96, 96, 96, 112, 112, 112, 112, 112,
+112, 112, 112, 112, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 144, 144, 144, 160, 160, 160, 160, 160, 160, 176, 176, 176,
+176, 176, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+192, 192, 192, 192, 208, 208, 208, 208, 208, 224, 224, 224, 240, 240, 240, 240,
+256, 256, 256, 256, 272, 272, 272, 272, 288, 288, 304, 320, 320, 320, 336, 336,
+336, 336, 336, 336, 352, 352, 352, 352, 352, 352, 352, 352, 368, 368, 368, 368,
+368, 368, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 400, 400, 400, 400,
+400, 400, 400, 400, 416, 416, 416, 416, 416, 416, 416, 416, 432, 432, 432, 432,
+432, 432, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 464, 464, 464, 464,
+464, 464, 464, 464, 480, 480, 480, 480, 480, 480, 480, 480, 496, 496, 496, 496,
+496, 496, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 528, 528, 528, 528,
+528, 528, 528, 528, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+544, 544, 544, 544, 560, 560, 560, 560, 560, 560, 560, 560, 560, 560, 576, 576,
+576, 576, 576, 576, 592, 592, 592, 592, 592, 592, 592, 592, 592, 592, 592, 592,
+592, 592, 592, 592, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608,
+608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 624, 624, 640, 640,
+640, 640, 640, 640, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656,
+656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656,
+656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 672, 672, 688, 688,
+688, 688, 688, 688, 704, 704, 720, 720, 736, 736, 752, 752, 768, 768, 768, 768,
+768, 768, 768, 768, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 800,
+800, 800, 800, 800, 816, 816, 816, 816, 816, 832, 832, 832, 848, 848, 848, 848,
+848, 848, 864, 864, 880, 880, 896, 896, 896, 896, 896, 896, 896, 896, 896, 912,
+912, 912, 912, 912, 928, 928, 928, 928, 928, 928, 928, 928, 944, 944, 944, 944,
+960, 960, 960, 960, 976, 976, 976, 976, 976, 992, 992, 992, 1008, 1024, 1024,
+1024, 1040, 1056, 1056, 1056, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+1088, 1088, 1088, 1088, 1104, 1104, 1104, 1104, 1120, 1120, 1120, 1120, 1120,
+1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1136, 1136,
+1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+1136, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1168, 1168, 1168, 1184, 1184,
+1184, 1200, 1200, 1200, 1216, 1216, 1216, 1216, 1216, 1232, 1232, 1232, 1232,
+1248, 1248, 1248, 1248, 1248, 1248, 1248, 1264, 1264, 1264, 1264, 1264, 1264,
+1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1296, 1296, 1296, 1296, 1312, 1312, 1328, 1328, 1328, 1328, 1328, 1328, 1328,
+1328, 1328, 1328, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1360, 1360,
+1376, 1376, 1376, 1376, 1376, 1376, 1392, 1392, 1392, 1392, 1392, 1392, 1392,
+1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1408, 1408, 1408, 1408,
+1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1424, 1424, 1424, 1440, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1488, 1488, 1488,
+1488, 1488, 1488, 1488, 1488, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1520, 1520, 1520, 1520, 1520,
+1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1536, 1536,
+1536, 1536, 1536, 1536, 1552, 1552, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+1568, 1584, 1584, 1584, 1600, 1600, 1600, 1600, 1600, 1616, 1616, 1616, 1616,
+1616, 1616, 1632, 1632, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1664,
+1664, 1664, 1664, 1664, 1664, 1664, 1664, 1680, 1680, 1680, 1680, 1680, 1680,
+1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 320, 1696, 1712, 1712, 1712,
+1712, 1728, 1728, 1728, 1728, 1728, 1728, 1744, 1744, 1744, 1744, 1744, 1744,
+1760, 1760, 1760, 1776, 1776, 1776, 1776, 1776, 1776, 1792, 1808, 1808, 1824,
+1824, 1824, 1840, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856,
+1856, 1856, 1856, 1856, 1856, 1856, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
+1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1904, 1904, 1904,
+1904, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920, 1920,
+1920, 1920, 1920, 1920, 1920, 1920, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+1936, 1952, 1952, 1952, 1952, 1968, 1968, 1968, 1984, 1984, 1984, 1984, 1984,
+1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
+1984, 1984, 2000, 2000, 2000, 2000, 2000, 2000, 2016, 2016, 2016, 2016, 2016,
+2016, 2032, 2032, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+2048, 2048, 2048, 2048, 2064, 2064, 2064, 2080, 2096, 2096, 2096, 2096, 2112,
+2112, 2112, 2112, 2112, 2112, 2128, 2128, 2144, 2144, 2144, 2160, 2160, 2160,
+2176, 2176, 2192, 2192, 2192, 2192, 2192, 2192, 2208, 2208, 2224, 2224, 2224,
+2224, 2224, 2224, 2240, 2240, 2256, 2256, 2256, 2256, 2256, 2256, 2272, 2272,
+2288, 2288, 2288, 2304, 2304, 2304, 2304, 2320, 2320, 2320, 2320, 2320, 2336,
+2336, 2336, 2336, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2368, 2368, 2368, 2368,
+2368, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384,
+2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384,
+2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384,
+2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384, 2384,
+2384, 2384, 2384, 2384, 2384, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
+2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416,
+2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416,
+2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416,
+2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416,
+2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
+2432, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448,
+2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448, 2448,
+2448, 2448, 2448, 2448, 2448, 2448, 2448, 2464, 2464, 2464, 2464, 2464, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2496, 2512, 2528, 2544, 2544, 2560, 2560, 2576, 2576, 2576,
+2576, 2576, 2576, 2576, 2576, 2576, 2592, 2592, 2592, 2592, 2592, 2592, 2592,
+2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2608, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2656,
+2656, 2656, 2656, 2672, 2672, 2672, 2672, 2672, 2688, 2688, 2688, 2688, 2704,
+2704, 2704, 320, 320, 320, 320, 320, 320, 320, 320, 2720, 2720, 2736, 2736,
+2736, 2736, 2752, 2752, 2768, 2768, 2768, 2784, 2784, 2800, 2800, 2800, 2816,
+2816, 2832, 2832, 2832, 2832, 320, 320, 2848, 2848, 2848, 2848, 2848, 2864,
+2864, 2864, 2880, 2880, 2880, 2896, 2896, 2896, 2896, 2896, 2912, 2912, 2912,
+2928, 2928, 2928, 2928, 320, 320, 320, 320, 320, 320, 320, 320, 320, 2944, 2944,
+2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944,
+2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 320, 320, 320, 320, 320,
+320, 320, 320, 2960, 2960, 2960, 2960, 2976, 2976, 2992, 2992, 3008, 3008, 3008,
+320, 320, 320, 3024, 3024, 3040, 3040, 3056, 3056, 320, 320, 320, 320, 3072,
+3072, 3088, 3088, 3088, 3088, 3088, 3088, 3104, 3104, 3104, 3104, 3104, 3104,
+3120, 3120, 3136, 3136, 320, 320, 3152, 3152, 3152, 3152, 3168, 3168, 3168,
+3168, 3184, 3184, 3200, 3200, 3216, 3216, 3216, 320, 320, 320, 320, 320, 3232,
+3232, 3232, 3232, 3232, 320, 320, 320, 3248, 3248, 3248, 3248, 3248, 3248, 3248,
+3248, 3264, 3264, 3264, 3264, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 3280, 3280, 3296, 3296, 3296, 3296, 320,
+320, 320, 320, 3312, 3312, 3312, 3328, 3328, 3328, 3328, 320, 320, 320, 320,
+3344, 3344, 3344, 3360, 3360, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376,
+3392, 3392, 3392, 3392, 3392, 3408, 3408, 3408, 3424, 3424, 3424, 3424, 3424,
+3440, 3440, 3440, 3456, 3456, 3456, 3456, 3456, 3456, 3472, 3472, 3488, 3488,
+3488, 3488, 3488, 320, 320, 320, 3504, 3504, 3504, 3520, 3520, 3520, 3520, 3520,
+3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 320, 320, 320, 320, 320, 320,
+320, 320, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3552, 3568, 3568, 3568,
+3568, 3568, 3568, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 3584, 3584,
+3584, 3584, 3584, 3584, 3584, 3584, 3600, 3600, 3600, 3600, 3600, 3600, 3616,
+3616, 3632, 3632, 3632, 3632, 3632, 320, 320, 320, 3648, 3648, 3648, 3648, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 3664, 3664, 3664, 3664,
+3664, 320, 320, 320, 320, 320, 3680, 3680, 3680, 3680, 3680, 3680, 3696, 3696,
+3696, 3696, 3696, 3696, 320, 320, 320, 320, 3712, 3712, 3712, 3712, 3712, 3712,
+3728, 3728, 3728, 3728, 3728, 3744, 3744, 3744, 3744, 3744, 3744, 320, 3760,
+3760, 3760, 3760, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3792, 3792, 3792,
+3792, 3792, 320, 320, 320, 320, 3808, 3808, 3808, 3808, 3808, 3808, 3824, 3824,
+3824, 3824, 3824, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 3840, 3840, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 3856, 3872, 3872, 3872, 3872, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3904, 3904, 3904, 3904, 3904,
+3904, 3904, 3904, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920, 3920,
+3920, 3920, 3920, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 3936,
+3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936, 3936,
+3936, 3952, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 3968,
+3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 4000, 4000, 4000, 320, 320, 320, 320, 320, 320, 4016,
+4016, 4016, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 4032, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 4048, 4048, 4048, 4048, 4048, 4048, 320,
+320, 320, 320, 320, 320, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064, 4064,
+4064, 320, 320, 320, 320, 4080, 4080, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+4096, 4096, 4096, 4096, 4096, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128,
+4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128,
+4128, 4128, 4128, 4128, 4128, 4128, 4128, 4144, 4144, 4144, 4144, 4144, 4144,
+4144, 4144, 4144, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4160, 4160, 4160, 4160,
+4160, 4160, 4160, 4160, 4160, 4160, 4160, 4160, 4160, 4160, 4160, 4160, 4176,
+4176, 4176, 4192, 4192, 4192, 4192, 4208, 4208, 4208, 4208, 4208, 4208, 4208,
+4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208, 4208,
+4208, 4208, 4208, 4208, 4208, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 4224, 4224, 4224, 4224, 4224, 4224, 4224, 4224,
+4224, 4224, 4240, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 4256, 4256, 4256, 4256, 4256, 4256,
+4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4272, 4272, 4272,
+4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272,
+4288, 4288, 4288, 4288, 4288, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4304,
+4304, 4320, 4320, 4320, 4320, 4320, 4320, 4336, 4336, 320, 320, 320, 320, 320,
+320, 320, 320, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368,
+4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368,
+4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368,
+4368, 4368, 4368, 4368, 4368, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4384, 4384, 4384, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4400, 4400, 4400,
+4400, 4400, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4416, 4416, 4416, 4416, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4432,
+4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432, 4432,
+320, 320, 4448, 4448, 4448, 4448, 4448, 4448, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4464, 4464, 4464, 4464, 4464,
+320, 320, 320, 320, 4480, 4480, 4480, 4480, 4480, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 4496, 4496, 4496, 4496, 4496, 4496, 4496, 4496, 4496,
+4496, 4496, 4496, 4496, 4496, 4496, 4496, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 4512, 4512, 4512, 4528, 4528, 4528,
+4528, 4528, 4528, 4528, 4544, 4544, 4544, 4544, 4544, 4544, 4560, 4560, 4560,
+4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560,
+4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576,
+4576, 4576, 4576, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4608,
+4608, 4608, 4608, 4608, 4624, 4624, 4624, 4640, 4640, 4640, 4640, 4640, 4640,
+4640, 4640, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4672, 4672, 4672,
+4672, 4672, 4672, 4672, 4672, 4688, 4688, 4688, 4688, 4688, 4688, 4688, 4688,
+4688, 4688, 4688, 4688, 4688, 4688, 4688, 4688, 4704, 4704, 4704, 4704, 4704,
+4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4720, 4720,
+4720, 4720, 4720, 4720, 4720, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
+4736, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752,
+4752, 4752, 4752, 4752, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768,
+4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 4768, 320, 320, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
+4784, 4800, 4800, 4800, 4800, 4800, 4800, 4800, 4800, 4800, 4800, 4800, 4800,
+4800, 4800, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816,
+4816, 4816, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+4832, 4832, 4832, 4832, 4832, 4832, 4832, 320, 4848, 4848, 4848, 4848, 4848,
+4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848,
+4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848, 4848,
+4848, 4848, 4848, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+4864, 4864, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 4880, 4880,
+4880, 4880, 4880, 4880, 4880, 4880, 320, 320, 320, 320, 320, 320, 320, 320,
+4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896, 4896,
+4896, 4896, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
+4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
+4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
+4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
+4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
+4912, 4912, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928,
+4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928,
+4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928,
+4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928,
+4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928, 4928,
+4928,
+};
+const Block _block_properties_stage3[] = {
+Block::BasicLatin, Block::BasicLatin, Block::BasicLatin, Block::BasicLatin,
+Block::BasicLatin, Block::BasicLatin, Block::BasicLatin, Block::BasicLatin,
+Block::BasicLatin, Block::BasicLatin, Block::BasicLatin, Block::BasicLatin,
+Block::BasicLatin, Block::BasicLatin, Block::BasicLatin, Block::BasicLatin,
+Block::Latin1Supplement, Block::Latin1Supplement, Block::Latin1Supplement,
+Block::Latin1Supplement, Block::Latin1Supplement, Block::Latin1Supplement,
+Block::Latin1Supplement, Block::Latin1Supplement, Block::Latin1Supplement,
+Block::Latin1Supplement, Block::Latin1Supplement, Block::Latin1Supplement,
+Block::Latin1Supplement, Block::Latin1Supplement, Block::Latin1Supplement,
+Block::Latin1Supplement, Block::LatinExtendedA, Block::LatinExtendedA,
+Block::LatinExtendedA, Block::LatinExtendedA, Block::LatinExtendedA,
+Block::LatinExtendedA, Block::LatinExtendedA, Block::LatinExtendedA,
+Block::LatinExtendedA, Block::LatinExtendedA, Block::LatinExtendedA,
+Block::LatinExtendedA, Block::LatinExtendedA, Block::LatinExtendedA,
+Block::LatinExtendedA, Block::LatinExtendedA, Block::LatinExtendedB,
+Block::LatinExtendedB, Block::LatinExtendedB, Block::LatinExtendedB,
+Block::LatinExtendedB, Block::LatinExtendedB, Block::LatinExtendedB,
+Block::LatinExtendedB, Block::LatinExtendedB, Block::LatinExtendedB,
+Block::LatinExtendedB, Block::LatinExtendedB, Block::LatinExtendedB,
+Block::LatinExtendedB, Block::LatinExtendedB, Block::LatinExtendedB,
+Block::IPAExtensions, Block::IPAExtensions, Block::IPAExtensions,
+Block::IPAExtensions, Block::IPAExtensions, Block::IPAExtensions,
+Block::IPAExtensions, Block::IPAExtensions, Block::IPAExtensions,
+Block::IPAExtensions, Block::IPAExtensions, Block::IPAExtensions,
+Block::IPAExtensions, Block::IPAExtensions, Block::IPAExtensions,
+Block::IPAExtensions, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::SpacingModifierLetters,
+Block::SpacingModifierLetters, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::CombiningDiacriticalMarks,
+Block::CombiningDiacriticalMarks, Block::GreekAndCoptic, Block::GreekAndCoptic,
+Block::GreekAndCoptic, Block::GreekAndCoptic, Block::GreekAndCoptic,
+Block::GreekAndCoptic, Block::GreekAndCoptic, Block::GreekAndCoptic,
+Block::GreekAndCoptic, Block::GreekAndCoptic, Block::GreekAndCoptic,
+Block::GreekAndCoptic, Block::GreekAndCoptic, Block::GreekAndCoptic,
+Block::GreekAndCoptic, Block::GreekAndCoptic, Block::Cyrillic, Block::Cyrillic,
+Block::Cyrillic, Block::Cyrillic, Block::Cyrillic, Block::Cyrillic,
+Block::Cyrillic, Block::Cyrillic, Block::Cyrillic, Block::Cyrillic,
+Block::Cyrillic, Block::Cyrillic, Block::Cyrillic, Block::Cyrillic,
+Block::Cyrillic, Block::Cyrillic, Block::CyrillicSupplement,
+Block::CyrillicSupplement, Block::CyrillicSupplement, Block::CyrillicSupplement,
+Block::CyrillicSupplement, Block::CyrillicSupplement, Block::CyrillicSupplement,
+Block::CyrillicSupplement, Block::CyrillicSupplement, Block::CyrillicSupplement,
+Block::CyrillicSupplement, Block::CyrillicSupplement, Block::CyrillicSupplement,
+Block::CyrillicSupplement, Block::CyrillicSupplement, Block::CyrillicSupplement,
+Block::Armenian, Block::Armenian, Block::Armenian, Block::Armenian,
+Block::Armenian, Block::Armenian, Block::Armenian, Block::Armenian,
+Block::Armenian, Block::Armenian, Block::Armenian, Block::Armenian,
+Block::Armenian, Block::Armenian, Block::Armenian, Block::Armenian,
+Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew,
+Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew,
+Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew, Block::Hebrew,
+Block::Hebrew, Block::Arabic, Block::Arabic, Block::Arabic, Block::Arabic,
+Block::Arabic, Block::Arabic, Block::Arabic, Block::Arabic, Block::Arabic,
+Block::Arabic, Block::Arabic, Block::Arabic, Block::Arabic, Block::Arabic,
+Block::Arabic, Block::Arabic, Block::Syriac, Block::Syriac, Block::Syriac,
+Block::Syriac, Block::Syriac, Block::Syriac, Block::Syriac, Block::Syriac,
+Block::Syriac, Block::Syriac, Block::Syriac, Block::Syriac, Block::Syriac,
+Block::Syriac, Block::Syriac, Block::Syriac, Block::ArabicSupplement,
+Block::ArabicSupplement, Block::ArabicSupplement, Block::ArabicSupplement,
+Block::ArabicSupplement, Block::ArabicSupplement, Block::ArabicSupplement,
+Block::ArabicSupplement, Block::ArabicSupplement, Block::ArabicSupplement,
+Block::ArabicSupplement, Block::ArabicSupplement, Block::ArabicSupplement,
+Block::ArabicSupplement, Block::ArabicSupplement, Block::ArabicSupplement,
+Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana,
+Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana,
+Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana, Block::Thaana,
+Block::Thaana, Block::NKo, Block::NKo, Block::NKo, Block::NKo, Block::NKo,
+Block::NKo, Block::NKo, Block::NKo, Block::NKo, Block::NKo, Block::NKo,
+Block::NKo, Block::NKo, Block::NKo, Block::NKo, Block::NKo, Block::Samaritan,
+Block::Samaritan, Block::Samaritan, Block::Samaritan, Block::Samaritan,
+Block::Samaritan, Block::Samaritan, Block::Samaritan, Block::Samaritan,
+Block::Samaritan, Block::Samaritan, Block::Samaritan, Block::Samaritan,
+Block::Samaritan, Block::Samaritan, Block::Samaritan, Block::Mandaic,
+Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic,
+Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic,
+Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic, Block::Mandaic,
+Block::SyriacSupplement, Block::SyriacSupplement, Block::SyriacSupplement,
+Block::SyriacSupplement, Block::SyriacSupplement, Block::SyriacSupplement,
+Block::SyriacSupplement, Block::SyriacSupplement, Block::SyriacSupplement,
+Block::SyriacSupplement, Block::SyriacSupplement, Block::SyriacSupplement,
+Block::SyriacSupplement, Block::SyriacSupplement, Block::SyriacSupplement,
+Block::SyriacSupplement, Block::Unassigned, Block::Unassigned,
+Block::Unassigned, Block::Unassigned, Block::Unassigned, Block::Unassigned,
+Block::Unassigned, Block::Unassigned, Block::Unassigned, Block::Unassigned,
+Block::Unassigned, Block::Unassigned, Block::Unassigned, Block::Unassigned,
+Block::Unassigned, Block::Unassigned, Block::ArabicExtendedA,
+Block::ArabicExtendedA, Block::ArabicExtendedA, Block::ArabicExtendedA,
+Block::ArabicExtendedA, Block::ArabicExtendedA, Block::ArabicExtendedA,
+Block::ArabicExtendedA, Block::ArabicExtendedA, Block::ArabicExtendedA,
+Block::ArabicExtendedA, Block::ArabicExtendedA, Block::ArabicExtendedA,
+Block::ArabicExtendedA, Block::ArabicExtendedA, Block::ArabicExtendedA,
+Block::Devanagari, Block::Devanagari, Block::Devanagari, Block::Devanagari,
+Block::Devanagari, Block::Devanagari, Block::Devanagari, Block::Devanagari,
+Block::Devanagari, Block::Devanagari, Block::Devanagari, Block::Devanagari,
+Block::Devanagari, Block::Devanagari, Block::Devanagari, Block::Devanagari,
+Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali,
+Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali,
+Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali, Block::Bengali,
+Block::Bengali, Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi,
+Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi,
+Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi,
+Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi, Block::Gurmukhi,
+Block::Gurmukhi, Block::Gujarati, Block::Gujarati, Block::Gujarati,
+Block::Gujarati, Block::Gujarati, Block::Gujarati, Block::Gujarati,
+Block::Gujarati, Block::Gujarati, Block::Gujarati, Block::Gujarati,
+Block::Gujarati, Block::Gujarati, Block::Gujarati, Block::Gujarati,
+Block::Gujarati, Block::Oriya, Block::Oriya, Block::Oriya, Block::Oriya,
+Block::Oriya, Block::Oriya, Block::Oriya, Block::Oriya, Block::Oriya,
+Block::Oriya, Block::Oriya, Block::Oriya, Block::Oriya, Block::Oriya,
+Block::Oriya, Block::Oriya, Block::Tamil, Block::Tamil, Block::Tamil,
+Block::Tamil, Block::Tamil, Block::Tamil, Block::Tamil, Block::Tamil,
+Block::Tamil, Block::Tamil, Block::Tamil, Block::Tamil, Block::Tamil,
+Block::Tamil, Block::Tamil, Block::Tamil, Block::Telugu, Block::Telugu,
+Block::Telugu, Block::Telugu, Block::Telugu, Block::Telugu, Block::Telugu,
+Block::Telugu, Block::Telugu, Block::Telugu, Block::Telugu, Block::Telugu,
+Block::Telugu, Block::Telugu, Block::Telugu, Block::Telugu, Block::Kannada,
+Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada,
+Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada,
+Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada, Block::Kannada,
+Block::Malayalam, Block::Malayalam, Block::Malayalam, Block::Malayalam,
+Block::Malayalam, Block::Malayalam, Block::Malayalam, Block::Malayalam,
+Block::Malayalam, Block::Malayalam, Block::Malayalam, Block::Malayalam,
+Block::Malayalam, Block::Malayalam, Block::Malayalam, Block::Malayalam,
+Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala,
+Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala,
+Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala, Block::Sinhala,
+Block::Sinhala, Block::Thai, Block::Thai, Block::Thai, Block::Thai, Block::Thai,
+Block::Thai, Block::Thai, Block::Thai, Block::Thai, Block::Thai, Block::Thai,
+Block::Thai, Block::Thai, Block::Thai, Block::Thai, Block::Thai, Block::Lao,
+Block::Lao, Block::Lao, Block::Lao, Block::Lao, Block::Lao, Block::Lao,
+Block::Lao, Block::Lao, Block::Lao, Block::Lao, Block::Lao, Block::Lao,
+Block::Lao, Block::Lao, Block::Lao, Block::Tibetan, Block::Tibetan,
+Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Tibetan,
+Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Tibetan,
+Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Tibetan, Block::Myanmar,
+Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar,
+Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar,
+Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar, Block::Myanmar,
+Block::Georgian, Block::Georgian, Block::Georgian, Block::Georgian,
+Block::Georgian, Block::Georgian, Block::Georgian, Block::Georgian,
+Block::Georgian, Block::Georgian, Block::Georgian, Block::Georgian,
+Block::Georgian, Block::Georgian, Block::Georgian, Block::Georgian,
+Block::HangulJamo, Block::HangulJamo, Block::HangulJamo, Block::HangulJamo,
+Block::HangulJamo, Block::HangulJamo, Block::HangulJamo, Block::HangulJamo,
+Block::HangulJamo, Block::HangulJamo, Block::HangulJamo, Block::HangulJamo,
+Block::HangulJamo, Block::HangulJamo, Block::HangulJamo, Block::HangulJamo,
+Block::Ethiopic, Block::Ethiopic, Block::Ethiopic, Block::Ethiopic,
+Block::Ethiopic, Block::Ethiopic, Block::Ethiopic, Block::Ethiopic,
+Block::Ethiopic, Block::Ethiopic, Block::Ethiopic, Block::Ethiopic,
+Block::Ethiopic, Block::Ethiopic, Block::Ethiopic, Block::Ethiopic,
+Block::EthiopicSupplement, Block::EthiopicSupplement, Block::EthiopicSupplement,
+Block::EthiopicSupplement, Block::EthiopicSupplement, Block::EthiopicSupplement,
+Block::EthiopicSupplement, Block::EthiopicSupplement, Block::EthiopicSupplement,
+Block::EthiopicSupplement, Block::EthiopicSupplement, Block::EthiopicSupplement,
+Block::EthiopicSupplement, Block::EthiopicSupplement, Block::EthiopicSupplement,
+Block::EthiopicSupplement, Block::Cherokee, Block::Cherokee, Block::Cherokee,
+Block::Cherokee, Block::Cherokee, Block::Cherokee, Block::Cherokee,
+Block::Cherokee, Block::Cherokee, Block::Cherokee, Block::Cherokee,
+Block::Cherokee, Block::Cherokee, Block::Cherokee, Block::Cherokee,
+Block::Cherokee, Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics,
+Block::UnifiedCanadianAboriginalSyllabics, Block::Ogham, Block::Ogham,
+Block::Ogham, Block::Ogham, Block::Ogham, Block::Ogham, Block::Ogham,
+Block::Ogham, Block::Ogham, Block::Ogham, Block::Ogham, Block::Ogham,
+Block::Ogham, Block::Ogham, Block::Ogham, Block::Ogham, Block::Runic,
+Block::Runic, Block::Runic, Block::Runic, Block::Runic, Block::Runic,
+Block::Runic, Block::Runic, Block::Runic, Block::Runic, Block::Runic,
+Block::Runic, Block::Runic, Block::Runic, Block::Runic, Block::Runic,
+Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog,
+Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog,
+Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog, Block::Tagalog,
+Block::Tagalog, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo,
+Block::Hanunoo, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo,
+Block::Hanunoo, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo, Block::Hanunoo,
+Block::Hanunoo, Block::Hanunoo, Block::Buhid, Block::Buhid, Block::Buhid,
+Block::Buhid, Block::Buhid, Block::Buhid, Block::Buhid, Block::Buhid,
+Block::Buhid, Block::Buhid, Block::Buhid, Block::Buhid, Block::Buhid,
+Block::Buhid, Block::Buhid, Block::Buhid, Block::Tagbanwa, Block::Tagbanwa,
+Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa,
+Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa,
+Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa, Block::Tagbanwa,
+Block::Tagbanwa, Block::Tagbanwa, Block::Khmer, Block::Khmer, Block::Khmer,
+Block::Khmer, Block::Khmer, Block::Khmer, Block::Khmer, Block::Khmer,
+Block::Khmer, Block::Khmer, Block::Khmer, Block::Khmer, Block::Khmer,
+Block::Khmer, Block::Khmer, Block::Khmer, Block::Mongolian, Block::Mongolian,
+Block::Mongolian, Block::Mongolian, Block::Mongolian, Block::Mongolian,
+Block::Mongolian, Block::Mongolian, Block::Mongolian, Block::Mongolian,
+Block::Mongolian, Block::Mongolian, Block::Mongolian, Block::Mongolian,
+Block::Mongolian, Block::Mongolian,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended,
+Block::UnifiedCanadianAboriginalSyllabicsExtended, Block::Limbu, Block::Limbu,
+Block::Limbu, Block::Limbu, Block::Limbu, Block::Limbu, Block::Limbu,
+Block::Limbu, Block::Limbu, Block::Limbu, Block::Limbu, Block::Limbu,
+Block::Limbu, Block::Limbu, Block::Limbu, Block::Limbu, Block::TaiLe,
+Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe,
+Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe,
+Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe, Block::TaiLe,
+Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue,
+Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue,
+Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue,
+Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue, Block::NewTaiLue,
+Block::KhmerSymbols, Block::KhmerSymbols, Block::KhmerSymbols,
+Block::KhmerSymbols, Block::KhmerSymbols, Block::KhmerSymbols,
+Block::KhmerSymbols, Block::KhmerSymbols, Block::KhmerSymbols,
+Block::KhmerSymbols, Block::KhmerSymbols, Block::KhmerSymbols,
+Block::KhmerSymbols, Block::KhmerSymbols, Block::KhmerSymbols,
+Block::KhmerSymbols, Block::Buginese, Block::Buginese, Block::Buginese,
+Block::Buginese, Block::Buginese, Block::Buginese, Block::Buginese,
+Block::Buginese, Block::Buginese, Block::Buginese, Block::Buginese,
+Block::Buginese, Block::Buginese, Block::Buginese, Block::Buginese,
+Block::Buginese, Block::TaiTham, Block::TaiTham, Block::TaiTham, Block::TaiTham,
+Block::TaiTham, Block::TaiTham, Block::TaiTham, Block::TaiTham, Block::TaiTham,
+Block::TaiTham, Block::TaiTham, Block::TaiTham, Block::TaiTham, Block::TaiTham,
+Block::TaiTham, Block::TaiTham, Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended,
+Block::CombiningDiacriticalMarksExtended, Block::Balinese, Block::Balinese,
+Block::Balinese, Block::Balinese, Block::Balinese, Block::Balinese,
+Block::Balinese, Block::Balinese, Block::Balinese, Block::Balinese,
+Block::Balinese, Block::Balinese, Block::Balinese, Block::Balinese,
+Block::Balinese, Block::Balinese, Block::Sundanese, Block::Sundanese,
+Block::Sundanese, Block::Sundanese, Block::Sundanese, Block::Sundanese,
+Block::Sundanese, Block::Sundanese, Block::Sundanese, Block::Sundanese,
+Block::Sundanese, Block::Sundanese, Block::Sundanese, Block::Sundanese,
+Block::Sundanese, Block::Sundanese, Block::Batak, Block::Batak, Block::Batak,
+Block::Batak, Block::Batak, Block::Batak, Block::Batak, Block::Batak,
+Block::Batak, Block::Batak, Block::Batak, Block::Batak, Block::Batak,
+Block::Batak, Block::Batak, Block::Batak, Block::Lepcha, Block::Lepcha,
+Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::Lepcha,
+Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::Lepcha,
+Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::Lepcha, Block::OlChiki,
+Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki,
+Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki,
+Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki, Block::OlChiki,
+Block::CyrillicExtendedC, Block::CyrillicExtendedC, Block::CyrillicExtendedC,
+Block::CyrillicExtendedC, Block::CyrillicExtendedC, Block::CyrillicExtendedC,
+Block::CyrillicExtendedC, Block::CyrillicExtendedC, Block::CyrillicExtendedC,
+Block::CyrillicExtendedC, Block::CyrillicExtendedC, Block::CyrillicExtendedC,
+Block::CyrillicExtendedC, Block::CyrillicExtendedC, Block::CyrillicExtendedC,
+Block::CyrillicExtendedC, Block::GeorgianExtended, Block::GeorgianExtended,
+Block::GeorgianExtended, Block::GeorgianExtended, Block::GeorgianExtended,
+Block::GeorgianExtended, Block::GeorgianExtended, Block::GeorgianExtended,
+Block::GeorgianExtended, Block::GeorgianExtended, Block::GeorgianExtended,
+Block::GeorgianExtended, Block::GeorgianExtended, Block::GeorgianExtended,
+Block::GeorgianExtended, Block::GeorgianExtended, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::SundaneseSupplement,
+Block::SundaneseSupplement, Block::VedicExtensions, Block::VedicExtensions,
+Block::VedicExtensions, Block::VedicExtensions, Block::VedicExtensions,
+Block::VedicExtensions, Block::VedicExtensions, Block::VedicExtensions,
+Block::VedicExtensions, Block::VedicExtensions, Block::VedicExtensions,
+Block::VedicExtensions, Block::VedicExtensions, Block::VedicExtensions,
+Block::VedicExtensions, Block::VedicExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensions, Block::PhoneticExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensions, Block::PhoneticExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensions, Block::PhoneticExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensions, Block::PhoneticExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensions, Block::PhoneticExtensions, Block::PhoneticExtensions,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::PhoneticExtensionsSupplement, Block::PhoneticExtensionsSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement,
+Block::CombiningDiacriticalMarksSupplement, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::LatinExtendedAdditional,
+Block::LatinExtendedAdditional, Block::GreekExtended, Block::GreekExtended,
+Block::GreekExtended, Block::GreekExtended, Block::GreekExtended,
+Block::GreekExtended, Block::GreekExtended, Block::GreekExtended,
+Block::GreekExtended, Block::GreekExtended, Block::GreekExtended,
+Block::GreekExtended, Block::GreekExtended, Block::GreekExtended,
+Block::GreekExtended, Block::GreekExtended, Block::GeneralPunctuation,
+Block::GeneralPunctuation, Block::GeneralPunctuation, Block::GeneralPunctuation,
+Block::GeneralPunctuation, Block::GeneralPunctuation, Block::GeneralPunctuation,
+Block::GeneralPunctuation, Block::GeneralPunctuation, Block::GeneralPunctuation,
+Block::GeneralPunctuation, Block::GeneralPunctuation, Block::GeneralPunctuation,
+Block::GeneralPunctuation, Block::GeneralPunctuation, Block::GeneralPunctuation,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::SuperscriptsAndSubscripts, Block::SuperscriptsAndSubscripts,
+Block::CurrencySymbols, Block::CurrencySymbols, Block::CurrencySymbols,
+Block::CurrencySymbols, Block::CurrencySymbols, Block::CurrencySymbols,
+Block::CurrencySymbols, Block::CurrencySymbols, Block::CurrencySymbols,
+Block::CurrencySymbols, Block::CurrencySymbols, Block::CurrencySymbols,
+Block::CurrencySymbols, Block::CurrencySymbols, Block::CurrencySymbols,
+Block::CurrencySymbols, Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols,
+Block::CombiningDiacriticalMarksForSymbols, Block::LetterlikeSymbols,
+Block::LetterlikeSymbols, Block::LetterlikeSymbols, Block::LetterlikeSymbols,
+Block::LetterlikeSymbols, Block::LetterlikeSymbols, Block::LetterlikeSymbols,
+Block::LetterlikeSymbols, Block::LetterlikeSymbols, Block::LetterlikeSymbols,
+Block::LetterlikeSymbols, Block::LetterlikeSymbols, Block::LetterlikeSymbols,
+Block::LetterlikeSymbols, Block::LetterlikeSymbols, Block::LetterlikeSymbols,
+Block::NumberForms, Block::NumberForms, Block::NumberForms, Block::NumberForms,
+Block::NumberForms, Block::NumberForms, Block::NumberForms, Block::NumberForms,
+Block::NumberForms, Block::NumberForms, Block::NumberForms, Block::NumberForms,
+Block::NumberForms, Block::NumberForms, Block::NumberForms, Block::NumberForms,
+Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows,
+Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows,
+Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows, Block::Arrows,
+Block::Arrows, Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MathematicalOperators, Block::MathematicalOperators,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::MiscellaneousTechnical, Block::MiscellaneousTechnical,
+Block::ControlPictures, Block::ControlPictures, Block::ControlPictures,
+Block::ControlPictures, Block::ControlPictures, Block::ControlPictures,
+Block::ControlPictures, Block::ControlPictures, Block::ControlPictures,
+Block::ControlPictures, Block::ControlPictures, Block::ControlPictures,
+Block::ControlPictures, Block::ControlPictures, Block::ControlPictures,
+Block::ControlPictures, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::OpticalCharacterRecognition,
+Block::OpticalCharacterRecognition, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::EnclosedAlphanumerics,
+Block::EnclosedAlphanumerics, Block::BoxDrawing, Block::BoxDrawing,
+Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing,
+Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing,
+Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing, Block::BoxDrawing,
+Block::BoxDrawing, Block::BoxDrawing, Block::BlockElements,
+Block::BlockElements, Block::BlockElements, Block::BlockElements,
+Block::BlockElements, Block::BlockElements, Block::BlockElements,
+Block::BlockElements, Block::BlockElements, Block::BlockElements,
+Block::BlockElements, Block::BlockElements, Block::BlockElements,
+Block::BlockElements, Block::BlockElements, Block::BlockElements,
+Block::GeometricShapes, Block::GeometricShapes, Block::GeometricShapes,
+Block::GeometricShapes, Block::GeometricShapes, Block::GeometricShapes,
+Block::GeometricShapes, Block::GeometricShapes, Block::GeometricShapes,
+Block::GeometricShapes, Block::GeometricShapes, Block::GeometricShapes,
+Block::GeometricShapes, Block::GeometricShapes, Block::GeometricShapes,
+Block::GeometricShapes, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::MiscellaneousSymbols,
+Block::MiscellaneousSymbols, Block::Dingbats, Block::Dingbats, Block::Dingbats,
+Block::Dingbats, Block::Dingbats, Block::Dingbats, Block::Dingbats,
+Block::Dingbats, Block::Dingbats, Block::Dingbats, Block::Dingbats,
+Block::Dingbats, Block::Dingbats, Block::Dingbats, Block::Dingbats,
+Block::Dingbats, Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA,
+Block::MiscellaneousMathematicalSymbolsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::SupplementalArrowsA,
+Block::SupplementalArrowsA, Block::BraillePatterns, Block::BraillePatterns,
+Block::BraillePatterns, Block::BraillePatterns, Block::BraillePatterns,
+Block::BraillePatterns, Block::BraillePatterns, Block::BraillePatterns,
+Block::BraillePatterns, Block::BraillePatterns, Block::BraillePatterns,
+Block::BraillePatterns, Block::BraillePatterns, Block::BraillePatterns,
+Block::BraillePatterns, Block::BraillePatterns, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::SupplementalArrowsB,
+Block::SupplementalArrowsB, Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::MiscellaneousMathematicalSymbolsB,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators,
+Block::SupplementalMathematicalOperators, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::MiscellaneousSymbolsAndArrows,
+Block::MiscellaneousSymbolsAndArrows, Block::Glagolitic, Block::Glagolitic,
+Block::Glagolitic, Block::Glagolitic, Block::Glagolitic, Block::Glagolitic,
+Block::Glagolitic, Block::Glagolitic, Block::Glagolitic, Block::Glagolitic,
+Block::Glagolitic, Block::Glagolitic, Block::Glagolitic, Block::Glagolitic,
+Block::Glagolitic, Block::Glagolitic, Block::LatinExtendedC,
+Block::LatinExtendedC, Block::LatinExtendedC, Block::LatinExtendedC,
+Block::LatinExtendedC, Block::LatinExtendedC, Block::LatinExtendedC,
+Block::LatinExtendedC, Block::LatinExtendedC, Block::LatinExtendedC,
+Block::LatinExtendedC, Block::LatinExtendedC, Block::LatinExtendedC,
+Block::LatinExtendedC, Block::LatinExtendedC, Block::LatinExtendedC,
+Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic,
+Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic,
+Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic, Block::Coptic,
+Block::Coptic, Block::GeorgianSupplement, Block::GeorgianSupplement,
+Block::GeorgianSupplement, Block::GeorgianSupplement, Block::GeorgianSupplement,
+Block::GeorgianSupplement, Block::GeorgianSupplement, Block::GeorgianSupplement,
+Block::GeorgianSupplement, Block::GeorgianSupplement, Block::GeorgianSupplement,
+Block::GeorgianSupplement, Block::GeorgianSupplement, Block::GeorgianSupplement,
+Block::GeorgianSupplement, Block::GeorgianSupplement, Block::Tifinagh,
+Block::Tifinagh, Block::Tifinagh, Block::Tifinagh, Block::Tifinagh,
+Block::Tifinagh, Block::Tifinagh, Block::Tifinagh, Block::Tifinagh,
+Block::Tifinagh, Block::Tifinagh, Block::Tifinagh, Block::Tifinagh,
+Block::Tifinagh, Block::Tifinagh, Block::Tifinagh, Block::EthiopicExtended,
+Block::EthiopicExtended, Block::EthiopicExtended, Block::EthiopicExtended,
+Block::EthiopicExtended, Block::EthiopicExtended, Block::EthiopicExtended,
+Block::EthiopicExtended, Block::EthiopicExtended, Block::EthiopicExtended,
+Block::EthiopicExtended, Block::EthiopicExtended, Block::EthiopicExtended,
+Block::EthiopicExtended, Block::EthiopicExtended, Block::EthiopicExtended,
+Block::CyrillicExtendedA, Block::CyrillicExtendedA, Block::CyrillicExtendedA,
+Block::CyrillicExtendedA, Block::CyrillicExtendedA, Block::CyrillicExtendedA,
+Block::CyrillicExtendedA, Block::CyrillicExtendedA, Block::CyrillicExtendedA,
+Block::CyrillicExtendedA, Block::CyrillicExtendedA, Block::CyrillicExtendedA,
+Block::CyrillicExtendedA, Block::CyrillicExtendedA, Block::CyrillicExtendedA,
+Block::CyrillicExtendedA, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::SupplementalPunctuation,
+Block::SupplementalPunctuation, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::CJKRadicalsSupplement,
+Block::CJKRadicalsSupplement, Block::KangxiRadicals, Block::KangxiRadicals,
+Block::KangxiRadicals, Block::KangxiRadicals, Block::KangxiRadicals,
+Block::KangxiRadicals, Block::KangxiRadicals, Block::KangxiRadicals,
+Block::KangxiRadicals, Block::KangxiRadicals, Block::KangxiRadicals,
+Block::KangxiRadicals, Block::KangxiRadicals, Block::KangxiRadicals,
+Block::KangxiRadicals, Block::KangxiRadicals,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters,
+Block::IdeographicDescriptionCharacters, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::CJKSymbolsAndPunctuation,
+Block::CJKSymbolsAndPunctuation, Block::Hiragana, Block::Hiragana,
+Block::Hiragana, Block::Hiragana, Block::Hiragana, Block::Hiragana,
+Block::Hiragana, Block::Hiragana, Block::Hiragana, Block::Hiragana,
+Block::Hiragana, Block::Hiragana, Block::Hiragana, Block::Hiragana,
+Block::Hiragana, Block::Hiragana, Block::Katakana, Block::Katakana,
+Block::Katakana, Block::Katakana, Block::Katakana, Block::Katakana,
+Block::Katakana, Block::Katakana, Block::Katakana, Block::Katakana,
+Block::Katakana, Block::Katakana, Block::Katakana, Block::Katakana,
+Block::Katakana, Block::Katakana, Block::Bopomofo, Block::Bopomofo,
+Block::Bopomofo, Block::Bopomofo, Block::Bopomofo, Block::Bopomofo,
+Block::Bopomofo, Block::Bopomofo, Block::Bopomofo, Block::Bopomofo,
+Block::Bopomofo, Block::Bopomofo, Block::Bopomofo, Block::Bopomofo,
+Block::Bopomofo, Block::Bopomofo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::HangulCompatibilityJamo,
+Block::HangulCompatibilityJamo, Block::Kanbun, Block::Kanbun, Block::Kanbun,
+Block::Kanbun, Block::Kanbun, Block::Kanbun, Block::Kanbun, Block::Kanbun,
+Block::Kanbun, Block::Kanbun, Block::Kanbun, Block::Kanbun, Block::Kanbun,
+Block::Kanbun, Block::Kanbun, Block::Kanbun, Block::BopomofoExtended,
+Block::BopomofoExtended, Block::BopomofoExtended, Block::BopomofoExtended,
+Block::BopomofoExtended, Block::BopomofoExtended, Block::BopomofoExtended,
+Block::BopomofoExtended, Block::BopomofoExtended, Block::BopomofoExtended,
+Block::BopomofoExtended, Block::BopomofoExtended, Block::BopomofoExtended,
+Block::BopomofoExtended, Block::BopomofoExtended, Block::BopomofoExtended,
+Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes,
+Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes,
+Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes,
+Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes, Block::CJKStrokes,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::KatakanaPhoneticExtensions, Block::KatakanaPhoneticExtensions,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::EnclosedCJKLettersAndMonths, Block::EnclosedCJKLettersAndMonths,
+Block::CJKCompatibility, Block::CJKCompatibility, Block::CJKCompatibility,
+Block::CJKCompatibility, Block::CJKCompatibility, Block::CJKCompatibility,
+Block::CJKCompatibility, Block::CJKCompatibility, Block::CJKCompatibility,
+Block::CJKCompatibility, Block::CJKCompatibility, Block::CJKCompatibility,
+Block::CJKCompatibility, Block::CJKCompatibility, Block::CJKCompatibility,
+Block::CJKCompatibility, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::CJKUnifiedIdeographsExtensionA,
+Block::CJKUnifiedIdeographsExtensionA, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::YijingHexagramSymbols,
+Block::YijingHexagramSymbols, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::CJKUnifiedIdeographs,
+Block::CJKUnifiedIdeographs, Block::YiSyllables, Block::YiSyllables,
+Block::YiSyllables, Block::YiSyllables, Block::YiSyllables, Block::YiSyllables,
+Block::YiSyllables, Block::YiSyllables, Block::YiSyllables, Block::YiSyllables,
+Block::YiSyllables, Block::YiSyllables, Block::YiSyllables, Block::YiSyllables,
+Block::YiSyllables, Block::YiSyllables, Block::YiRadicals, Block::YiRadicals,
+Block::YiRadicals, Block::YiRadicals, Block::YiRadicals, Block::YiRadicals,
+Block::YiRadicals, Block::YiRadicals, Block::YiRadicals, Block::YiRadicals,
+Block::YiRadicals, Block::YiRadicals, Block::YiRadicals, Block::YiRadicals,
+Block::YiRadicals, Block::YiRadicals, Block::Lisu, Block::Lisu, Block::Lisu,
+Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu,
+Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu, Block::Lisu,
+Block::Lisu, Block::Vai, Block::Vai, Block::Vai, Block::Vai, Block::Vai,
+Block::Vai, Block::Vai, Block::Vai, Block::Vai, Block::Vai, Block::Vai,
+Block::Vai, Block::Vai, Block::Vai, Block::Vai, Block::Vai,
+Block::CyrillicExtendedB, Block::CyrillicExtendedB, Block::CyrillicExtendedB,
+Block::CyrillicExtendedB, Block::CyrillicExtendedB, Block::CyrillicExtendedB,
+Block::CyrillicExtendedB, Block::CyrillicExtendedB, Block::CyrillicExtendedB,
+Block::CyrillicExtendedB, Block::CyrillicExtendedB, Block::CyrillicExtendedB,
+Block::CyrillicExtendedB, Block::CyrillicExtendedB, Block::CyrillicExtendedB,
+Block::CyrillicExtendedB, Block::Bamum, Block::Bamum, Block::Bamum,
+Block::Bamum, Block::Bamum, Block::Bamum, Block::Bamum, Block::Bamum,
+Block::Bamum, Block::Bamum, Block::Bamum, Block::Bamum, Block::Bamum,
+Block::Bamum, Block::Bamum, Block::Bamum, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::ModifierToneLetters,
+Block::ModifierToneLetters, Block::LatinExtendedD, Block::LatinExtendedD,
+Block::LatinExtendedD, Block::LatinExtendedD, Block::LatinExtendedD,
+Block::LatinExtendedD, Block::LatinExtendedD, Block::LatinExtendedD,
+Block::LatinExtendedD, Block::LatinExtendedD, Block::LatinExtendedD,
+Block::LatinExtendedD, Block::LatinExtendedD, Block::LatinExtendedD,
+Block::LatinExtendedD, Block::LatinExtendedD, Block::SylotiNagri,
+Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri,
+Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri,
+Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri,
+Block::SylotiNagri, Block::SylotiNagri, Block::SylotiNagri,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms,
+Block::CommonIndicNumberForms, Block::CommonIndicNumberForms, Block::PhagsPa,
+Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa,
+Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa,
+Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa, Block::PhagsPa,
+Block::Saurashtra, Block::Saurashtra, Block::Saurashtra, Block::Saurashtra,
+Block::Saurashtra, Block::Saurashtra, Block::Saurashtra, Block::Saurashtra,
+Block::Saurashtra, Block::Saurashtra, Block::Saurashtra, Block::Saurashtra,
+Block::Saurashtra, Block::Saurashtra, Block::Saurashtra, Block::Saurashtra,
+Block::DevanagariExtended, Block::DevanagariExtended, Block::DevanagariExtended,
+Block::DevanagariExtended, Block::DevanagariExtended, Block::DevanagariExtended,
+Block::DevanagariExtended, Block::DevanagariExtended, Block::DevanagariExtended,
+Block::DevanagariExtended, Block::DevanagariExtended, Block::DevanagariExtended,
+Block::DevanagariExtended, Block::DevanagariExtended, Block::DevanagariExtended,
+Block::DevanagariExtended, Block::KayahLi, Block::KayahLi, Block::KayahLi,
+Block::KayahLi, Block::KayahLi, Block::KayahLi, Block::KayahLi, Block::KayahLi,
+Block::KayahLi, Block::KayahLi, Block::KayahLi, Block::KayahLi, Block::KayahLi,
+Block::KayahLi, Block::KayahLi, Block::KayahLi, Block::Rejang, Block::Rejang,
+Block::Rejang, Block::Rejang, Block::Rejang, Block::Rejang, Block::Rejang,
+Block::Rejang, Block::Rejang, Block::Rejang, Block::Rejang, Block::Rejang,
+Block::Rejang, Block::Rejang, Block::Rejang, Block::Rejang,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA,
+Block::HangulJamoExtendedA, Block::HangulJamoExtendedA, Block::Javanese,
+Block::Javanese, Block::Javanese, Block::Javanese, Block::Javanese,
+Block::Javanese, Block::Javanese, Block::Javanese, Block::Javanese,
+Block::Javanese, Block::Javanese, Block::Javanese, Block::Javanese,
+Block::Javanese, Block::Javanese, Block::Javanese, Block::MyanmarExtendedB,
+Block::MyanmarExtendedB, Block::MyanmarExtendedB, Block::MyanmarExtendedB,
+Block::MyanmarExtendedB, Block::MyanmarExtendedB, Block::MyanmarExtendedB,
+Block::MyanmarExtendedB, Block::MyanmarExtendedB, Block::MyanmarExtendedB,
+Block::MyanmarExtendedB, Block::MyanmarExtendedB, Block::MyanmarExtendedB,
+Block::MyanmarExtendedB, Block::MyanmarExtendedB, Block::MyanmarExtendedB,
+Block::Cham, Block::Cham, Block::Cham, Block::Cham, Block::Cham, Block::Cham,
+Block::Cham, Block::Cham, Block::Cham, Block::Cham, Block::Cham, Block::Cham,
+Block::Cham, Block::Cham, Block::Cham, Block::Cham, Block::MyanmarExtendedA,
+Block::MyanmarExtendedA, Block::MyanmarExtendedA, Block::MyanmarExtendedA,
+Block::MyanmarExtendedA, Block::MyanmarExtendedA, Block::MyanmarExtendedA,
+Block::MyanmarExtendedA, Block::MyanmarExtendedA, Block::MyanmarExtendedA,
+Block::MyanmarExtendedA, Block::MyanmarExtendedA, Block::MyanmarExtendedA,
+Block::MyanmarExtendedA, Block::MyanmarExtendedA, Block::MyanmarExtendedA,
+Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet,
+Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet,
+Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet, Block::TaiViet,
+Block::TaiViet, Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::MeeteiMayekExtensions, Block::MeeteiMayekExtensions,
+Block::EthiopicExtendedA, Block::EthiopicExtendedA, Block::EthiopicExtendedA,
+Block::EthiopicExtendedA, Block::EthiopicExtendedA, Block::EthiopicExtendedA,
+Block::EthiopicExtendedA, Block::EthiopicExtendedA, Block::EthiopicExtendedA,
+Block::EthiopicExtendedA, Block::EthiopicExtendedA, Block::EthiopicExtendedA,
+Block::EthiopicExtendedA, Block::EthiopicExtendedA, Block::EthiopicExtendedA,
+Block::EthiopicExtendedA, Block::LatinExtendedE, Block::LatinExtendedE,
+Block::LatinExtendedE, Block::LatinExtendedE, Block::LatinExtendedE,
+Block::LatinExtendedE, Block::LatinExtendedE, Block::LatinExtendedE,
+Block::LatinExtendedE, Block::LatinExtendedE, Block::LatinExtendedE,
+Block::LatinExtendedE, Block::LatinExtendedE, Block::LatinExtendedE,
+Block::LatinExtendedE, Block::LatinExtendedE, Block::CherokeeSupplement,
+Block::CherokeeSupplement, Block::CherokeeSupplement, Block::CherokeeSupplement,
+Block::CherokeeSupplement, Block::CherokeeSupplement, Block::CherokeeSupplement,
+Block::CherokeeSupplement, Block::CherokeeSupplement, Block::CherokeeSupplement,
+Block::CherokeeSupplement, Block::CherokeeSupplement, Block::CherokeeSupplement,
+Block::CherokeeSupplement, Block::CherokeeSupplement, Block::CherokeeSupplement,
+Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek,
+Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek,
+Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek,
+Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek, Block::MeeteiMayek,
+Block::HangulSyllables, Block::HangulSyllables, Block::HangulSyllables,
+Block::HangulSyllables, Block::HangulSyllables, Block::HangulSyllables,
+Block::HangulSyllables, Block::HangulSyllables, Block::HangulSyllables,
+Block::HangulSyllables, Block::HangulSyllables, Block::HangulSyllables,
+Block::HangulSyllables, Block::HangulSyllables, Block::HangulSyllables,
+Block::HangulSyllables, Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB,
+Block::HangulJamoExtendedB, Block::HangulJamoExtendedB, Block::HighSurrogates,
+Block::HighSurrogates, Block::HighSurrogates, Block::HighSurrogates,
+Block::HighSurrogates, Block::HighSurrogates, Block::HighSurrogates,
+Block::HighSurrogates, Block::HighSurrogates, Block::HighSurrogates,
+Block::HighSurrogates, Block::HighSurrogates, Block::HighSurrogates,
+Block::HighSurrogates, Block::HighSurrogates, Block::HighSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::HighPrivateUseSurrogates, Block::HighPrivateUseSurrogates,
+Block::LowSurrogates, Block::LowSurrogates, Block::LowSurrogates,
+Block::LowSurrogates, Block::LowSurrogates, Block::LowSurrogates,
+Block::LowSurrogates, Block::LowSurrogates, Block::LowSurrogates,
+Block::LowSurrogates, Block::LowSurrogates, Block::LowSurrogates,
+Block::LowSurrogates, Block::LowSurrogates, Block::LowSurrogates,
+Block::LowSurrogates, Block::PrivateUseArea, Block::PrivateUseArea,
+Block::PrivateUseArea, Block::PrivateUseArea, Block::PrivateUseArea,
+Block::PrivateUseArea, Block::PrivateUseArea, Block::PrivateUseArea,
+Block::PrivateUseArea, Block::PrivateUseArea, Block::PrivateUseArea,
+Block::PrivateUseArea, Block::PrivateUseArea, Block::PrivateUseArea,
+Block::PrivateUseArea, Block::PrivateUseArea, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::CJKCompatibilityIdeographs,
+Block::CJKCompatibilityIdeographs, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::AlphabeticPresentationForms,
+Block::AlphabeticPresentationForms, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::ArabicPresentationFormsA,
+Block::ArabicPresentationFormsA, Block::VariationSelectors,
+Block::VariationSelectors, Block::VariationSelectors, Block::VariationSelectors,
+Block::VariationSelectors, Block::VariationSelectors, Block::VariationSelectors,
+Block::VariationSelectors, Block::VariationSelectors, Block::VariationSelectors,
+Block::VariationSelectors, Block::VariationSelectors, Block::VariationSelectors,
+Block::VariationSelectors, Block::VariationSelectors, Block::VariationSelectors,
+Block::VerticalForms, Block::VerticalForms, Block::VerticalForms,
+Block::VerticalForms, Block::VerticalForms, Block::VerticalForms,
+Block::VerticalForms, Block::VerticalForms, Block::VerticalForms,
+Block::VerticalForms, Block::VerticalForms, Block::VerticalForms,
+Block::VerticalForms, Block::VerticalForms, Block::VerticalForms,
+Block::VerticalForms, Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CombiningHalfMarks, Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CombiningHalfMarks, Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CombiningHalfMarks, Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CombiningHalfMarks, Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CombiningHalfMarks, Block::CombiningHalfMarks,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::CJKCompatibilityForms, Block::CJKCompatibilityForms,
+Block::SmallFormVariants, Block::SmallFormVariants, Block::SmallFormVariants,
+Block::SmallFormVariants, Block::SmallFormVariants, Block::SmallFormVariants,
+Block::SmallFormVariants, Block::SmallFormVariants, Block::SmallFormVariants,
+Block::SmallFormVariants, Block::SmallFormVariants, Block::SmallFormVariants,
+Block::SmallFormVariants, Block::SmallFormVariants, Block::SmallFormVariants,
+Block::SmallFormVariants, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::ArabicPresentationFormsB,
+Block::ArabicPresentationFormsB, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::HalfwidthAndFullwidthForms,
+Block::HalfwidthAndFullwidthForms, Block::Specials, Block::Specials,
+Block::Specials, Block::Specials, Block::Specials, Block::Specials,
+Block::Specials, Block::Specials, Block::Specials, Block::Specials,
+Block::Specials, Block::Specials, Block::Specials, Block::Specials,
+Block::Specials, Block::Specials, Block::LinearBSyllabary,
+Block::LinearBSyllabary, Block::LinearBSyllabary, Block::LinearBSyllabary,
+Block::LinearBSyllabary, Block::LinearBSyllabary, Block::LinearBSyllabary,
+Block::LinearBSyllabary, Block::LinearBSyllabary, Block::LinearBSyllabary,
+Block::LinearBSyllabary, Block::LinearBSyllabary, Block::LinearBSyllabary,
+Block::LinearBSyllabary, Block::LinearBSyllabary, Block::LinearBSyllabary,
+Block::LinearBIdeograms, Block::LinearBIdeograms, Block::LinearBIdeograms,
+Block::LinearBIdeograms, Block::LinearBIdeograms, Block::LinearBIdeograms,
+Block::LinearBIdeograms, Block::LinearBIdeograms, Block::LinearBIdeograms,
+Block::LinearBIdeograms, Block::LinearBIdeograms, Block::LinearBIdeograms,
+Block::LinearBIdeograms, Block::LinearBIdeograms, Block::LinearBIdeograms,
+Block::LinearBIdeograms, Block::AegeanNumbers, Block::AegeanNumbers,
+Block::AegeanNumbers, Block::AegeanNumbers, Block::AegeanNumbers,
+Block::AegeanNumbers, Block::AegeanNumbers, Block::AegeanNumbers,
+Block::AegeanNumbers, Block::AegeanNumbers, Block::AegeanNumbers,
+Block::AegeanNumbers, Block::AegeanNumbers, Block::AegeanNumbers,
+Block::AegeanNumbers, Block::AegeanNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientGreekNumbers,
+Block::AncientGreekNumbers, Block::AncientSymbols, Block::AncientSymbols,
+Block::AncientSymbols, Block::AncientSymbols, Block::AncientSymbols,
+Block::AncientSymbols, Block::AncientSymbols, Block::AncientSymbols,
+Block::AncientSymbols, Block::AncientSymbols, Block::AncientSymbols,
+Block::AncientSymbols, Block::AncientSymbols, Block::AncientSymbols,
+Block::AncientSymbols, Block::AncientSymbols, Block::PhaistosDisc,
+Block::PhaistosDisc, Block::PhaistosDisc, Block::PhaistosDisc,
+Block::PhaistosDisc, Block::PhaistosDisc, Block::PhaistosDisc,
+Block::PhaistosDisc, Block::PhaistosDisc, Block::PhaistosDisc,
+Block::PhaistosDisc, Block::PhaistosDisc, Block::PhaistosDisc,
+Block::PhaistosDisc, Block::PhaistosDisc, Block::PhaistosDisc, Block::Lycian,
+Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian,
+Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian,
+Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian, Block::Lycian,
+Block::Carian, Block::Carian, Block::Carian, Block::Carian, Block::Carian,
+Block::Carian, Block::Carian, Block::Carian, Block::Carian, Block::Carian,
+Block::Carian, Block::Carian, Block::Carian, Block::Carian, Block::Carian,
+Block::Carian, Block::CopticEpactNumbers, Block::CopticEpactNumbers,
+Block::CopticEpactNumbers, Block::CopticEpactNumbers, Block::CopticEpactNumbers,
+Block::CopticEpactNumbers, Block::CopticEpactNumbers, Block::CopticEpactNumbers,
+Block::CopticEpactNumbers, Block::CopticEpactNumbers, Block::CopticEpactNumbers,
+Block::CopticEpactNumbers, Block::CopticEpactNumbers, Block::CopticEpactNumbers,
+Block::CopticEpactNumbers, Block::CopticEpactNumbers, Block::OldItalic,
+Block::OldItalic, Block::OldItalic, Block::OldItalic, Block::OldItalic,
+Block::OldItalic, Block::OldItalic, Block::OldItalic, Block::OldItalic,
+Block::OldItalic, Block::OldItalic, Block::OldItalic, Block::OldItalic,
+Block::OldItalic, Block::OldItalic, Block::OldItalic, Block::Gothic,
+Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic,
+Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic,
+Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic, Block::Gothic,
+Block::OldPermic, Block::OldPermic, Block::OldPermic, Block::OldPermic,
+Block::OldPermic, Block::OldPermic, Block::OldPermic, Block::OldPermic,
+Block::OldPermic, Block::OldPermic, Block::OldPermic, Block::OldPermic,
+Block::OldPermic, Block::OldPermic, Block::OldPermic, Block::OldPermic,
+Block::Ugaritic, Block::Ugaritic, Block::Ugaritic, Block::Ugaritic,
+Block::Ugaritic, Block::Ugaritic, Block::Ugaritic, Block::Ugaritic,
+Block::Ugaritic, Block::Ugaritic, Block::Ugaritic, Block::Ugaritic,
+Block::Ugaritic, Block::Ugaritic, Block::Ugaritic, Block::Ugaritic,
+Block::OldPersian, Block::OldPersian, Block::OldPersian, Block::OldPersian,
+Block::OldPersian, Block::OldPersian, Block::OldPersian, Block::OldPersian,
+Block::OldPersian, Block::OldPersian, Block::OldPersian, Block::OldPersian,
+Block::OldPersian, Block::OldPersian, Block::OldPersian, Block::OldPersian,
+Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret,
+Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret,
+Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret, Block::Deseret,
+Block::Deseret, Block::Shavian, Block::Shavian, Block::Shavian, Block::Shavian,
+Block::Shavian, Block::Shavian, Block::Shavian, Block::Shavian, Block::Shavian,
+Block::Shavian, Block::Shavian, Block::Shavian, Block::Shavian, Block::Shavian,
+Block::Shavian, Block::Shavian, Block::Osmanya, Block::Osmanya, Block::Osmanya,
+Block::Osmanya, Block::Osmanya, Block::Osmanya, Block::Osmanya, Block::Osmanya,
+Block::Osmanya, Block::Osmanya, Block::Osmanya, Block::Osmanya, Block::Osmanya,
+Block::Osmanya, Block::Osmanya, Block::Osmanya, Block::Osage, Block::Osage,
+Block::Osage, Block::Osage, Block::Osage, Block::Osage, Block::Osage,
+Block::Osage, Block::Osage, Block::Osage, Block::Osage, Block::Osage,
+Block::Osage, Block::Osage, Block::Osage, Block::Osage, Block::Elbasan,
+Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan,
+Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan,
+Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan, Block::Elbasan,
+Block::CaucasianAlbanian, Block::CaucasianAlbanian, Block::CaucasianAlbanian,
+Block::CaucasianAlbanian, Block::CaucasianAlbanian, Block::CaucasianAlbanian,
+Block::CaucasianAlbanian, Block::CaucasianAlbanian, Block::CaucasianAlbanian,
+Block::CaucasianAlbanian, Block::CaucasianAlbanian, Block::CaucasianAlbanian,
+Block::CaucasianAlbanian, Block::CaucasianAlbanian, Block::CaucasianAlbanian,
+Block::CaucasianAlbanian, Block::LinearA, Block::LinearA, Block::LinearA,
+Block::LinearA, Block::LinearA, Block::LinearA, Block::LinearA, Block::LinearA,
+Block::LinearA, Block::LinearA, Block::LinearA, Block::LinearA, Block::LinearA,
+Block::LinearA, Block::LinearA, Block::LinearA, Block::CypriotSyllabary,
+Block::CypriotSyllabary, Block::CypriotSyllabary, Block::CypriotSyllabary,
+Block::CypriotSyllabary, Block::CypriotSyllabary, Block::CypriotSyllabary,
+Block::CypriotSyllabary, Block::CypriotSyllabary, Block::CypriotSyllabary,
+Block::CypriotSyllabary, Block::CypriotSyllabary, Block::CypriotSyllabary,
+Block::CypriotSyllabary, Block::CypriotSyllabary, Block::CypriotSyllabary,
+Block::ImperialAramaic, Block::ImperialAramaic, Block::ImperialAramaic,
+Block::ImperialAramaic, Block::ImperialAramaic, Block::ImperialAramaic,
+Block::ImperialAramaic, Block::ImperialAramaic, Block::ImperialAramaic,
+Block::ImperialAramaic, Block::ImperialAramaic, Block::ImperialAramaic,
+Block::ImperialAramaic, Block::ImperialAramaic, Block::ImperialAramaic,
+Block::ImperialAramaic, Block::Palmyrene, Block::Palmyrene, Block::Palmyrene,
+Block::Palmyrene, Block::Palmyrene, Block::Palmyrene, Block::Palmyrene,
+Block::Palmyrene, Block::Palmyrene, Block::Palmyrene, Block::Palmyrene,
+Block::Palmyrene, Block::Palmyrene, Block::Palmyrene, Block::Palmyrene,
+Block::Palmyrene, Block::Nabataean, Block::Nabataean, Block::Nabataean,
+Block::Nabataean, Block::Nabataean, Block::Nabataean, Block::Nabataean,
+Block::Nabataean, Block::Nabataean, Block::Nabataean, Block::Nabataean,
+Block::Nabataean, Block::Nabataean, Block::Nabataean, Block::Nabataean,
+Block::Nabataean, Block::Hatran, Block::Hatran, Block::Hatran, Block::Hatran,
+Block::Hatran, Block::Hatran, Block::Hatran, Block::Hatran, Block::Hatran,
+Block::Hatran, Block::Hatran, Block::Hatran, Block::Hatran, Block::Hatran,
+Block::Hatran, Block::Hatran, Block::Phoenician, Block::Phoenician,
+Block::Phoenician, Block::Phoenician, Block::Phoenician, Block::Phoenician,
+Block::Phoenician, Block::Phoenician, Block::Phoenician, Block::Phoenician,
+Block::Phoenician, Block::Phoenician, Block::Phoenician, Block::Phoenician,
+Block::Phoenician, Block::Phoenician, Block::Lydian, Block::Lydian,
+Block::Lydian, Block::Lydian, Block::Lydian, Block::Lydian, Block::Lydian,
+Block::Lydian, Block::Lydian, Block::Lydian, Block::Lydian, Block::Lydian,
+Block::Lydian, Block::Lydian, Block::Lydian, Block::Lydian,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs,
+Block::MeroiticHieroglyphs, Block::MeroiticHieroglyphs, Block::MeroiticCursive,
+Block::MeroiticCursive, Block::MeroiticCursive, Block::MeroiticCursive,
+Block::MeroiticCursive, Block::MeroiticCursive, Block::MeroiticCursive,
+Block::MeroiticCursive, Block::MeroiticCursive, Block::MeroiticCursive,
+Block::MeroiticCursive, Block::MeroiticCursive, Block::MeroiticCursive,
+Block::MeroiticCursive, Block::MeroiticCursive, Block::MeroiticCursive,
+Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi,
+Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi,
+Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi,
+Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi, Block::Kharoshthi,
+Block::OldSouthArabian, Block::OldSouthArabian, Block::OldSouthArabian,
+Block::OldSouthArabian, Block::OldSouthArabian, Block::OldSouthArabian,
+Block::OldSouthArabian, Block::OldSouthArabian, Block::OldSouthArabian,
+Block::OldSouthArabian, Block::OldSouthArabian, Block::OldSouthArabian,
+Block::OldSouthArabian, Block::OldSouthArabian, Block::OldSouthArabian,
+Block::OldSouthArabian, Block::OldNorthArabian, Block::OldNorthArabian,
+Block::OldNorthArabian, Block::OldNorthArabian, Block::OldNorthArabian,
+Block::OldNorthArabian, Block::OldNorthArabian, Block::OldNorthArabian,
+Block::OldNorthArabian, Block::OldNorthArabian, Block::OldNorthArabian,
+Block::OldNorthArabian, Block::OldNorthArabian, Block::OldNorthArabian,
+Block::OldNorthArabian, Block::OldNorthArabian, Block::Manichaean,
+Block::Manichaean, Block::Manichaean, Block::Manichaean, Block::Manichaean,
+Block::Manichaean, Block::Manichaean, Block::Manichaean, Block::Manichaean,
+Block::Manichaean, Block::Manichaean, Block::Manichaean, Block::Manichaean,
+Block::Manichaean, Block::Manichaean, Block::Manichaean, Block::Avestan,
+Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan,
+Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan,
+Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan, Block::Avestan,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalParthian, Block::InscriptionalParthian,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi,
+Block::InscriptionalPahlavi, Block::InscriptionalPahlavi, Block::PsalterPahlavi,
+Block::PsalterPahlavi, Block::PsalterPahlavi, Block::PsalterPahlavi,
+Block::PsalterPahlavi, Block::PsalterPahlavi, Block::PsalterPahlavi,
+Block::PsalterPahlavi, Block::PsalterPahlavi, Block::PsalterPahlavi,
+Block::PsalterPahlavi, Block::PsalterPahlavi, Block::PsalterPahlavi,
+Block::PsalterPahlavi, Block::PsalterPahlavi, Block::PsalterPahlavi,
+Block::OldTurkic, Block::OldTurkic, Block::OldTurkic, Block::OldTurkic,
+Block::OldTurkic, Block::OldTurkic, Block::OldTurkic, Block::OldTurkic,
+Block::OldTurkic, Block::OldTurkic, Block::OldTurkic, Block::OldTurkic,
+Block::OldTurkic, Block::OldTurkic, Block::OldTurkic, Block::OldTurkic,
+Block::OldHungarian, Block::OldHungarian, Block::OldHungarian,
+Block::OldHungarian, Block::OldHungarian, Block::OldHungarian,
+Block::OldHungarian, Block::OldHungarian, Block::OldHungarian,
+Block::OldHungarian, Block::OldHungarian, Block::OldHungarian,
+Block::OldHungarian, Block::OldHungarian, Block::OldHungarian,
+Block::OldHungarian, Block::HanifiRohingya, Block::HanifiRohingya,
+Block::HanifiRohingya, Block::HanifiRohingya, Block::HanifiRohingya,
+Block::HanifiRohingya, Block::HanifiRohingya, Block::HanifiRohingya,
+Block::HanifiRohingya, Block::HanifiRohingya, Block::HanifiRohingya,
+Block::HanifiRohingya, Block::HanifiRohingya, Block::HanifiRohingya,
+Block::HanifiRohingya, Block::HanifiRohingya, Block::RumiNumeralSymbols,
+Block::RumiNumeralSymbols, Block::RumiNumeralSymbols, Block::RumiNumeralSymbols,
+Block::RumiNumeralSymbols, Block::RumiNumeralSymbols, Block::RumiNumeralSymbols,
+Block::RumiNumeralSymbols, Block::RumiNumeralSymbols, Block::RumiNumeralSymbols,
+Block::RumiNumeralSymbols, Block::RumiNumeralSymbols, Block::RumiNumeralSymbols,
+Block::RumiNumeralSymbols, Block::RumiNumeralSymbols, Block::RumiNumeralSymbols,
+Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi,
+Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi,
+Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi, Block::Yezidi,
+Block::Yezidi, Block::OldSogdian, Block::OldSogdian, Block::OldSogdian,
+Block::OldSogdian, Block::OldSogdian, Block::OldSogdian, Block::OldSogdian,
+Block::OldSogdian, Block::OldSogdian, Block::OldSogdian, Block::OldSogdian,
+Block::OldSogdian, Block::OldSogdian, Block::OldSogdian, Block::OldSogdian,
+Block::OldSogdian, Block::Sogdian, Block::Sogdian, Block::Sogdian,
+Block::Sogdian, Block::Sogdian, Block::Sogdian, Block::Sogdian, Block::Sogdian,
+Block::Sogdian, Block::Sogdian, Block::Sogdian, Block::Sogdian, Block::Sogdian,
+Block::Sogdian, Block::Sogdian, Block::Sogdian, Block::Chorasmian,
+Block::Chorasmian, Block::Chorasmian, Block::Chorasmian, Block::Chorasmian,
+Block::Chorasmian, Block::Chorasmian, Block::Chorasmian, Block::Chorasmian,
+Block::Chorasmian, Block::Chorasmian, Block::Chorasmian, Block::Chorasmian,
+Block::Chorasmian, Block::Chorasmian, Block::Chorasmian, Block::Elymaic,
+Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic,
+Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic,
+Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic, Block::Elymaic,
+Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi,
+Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi,
+Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi, Block::Brahmi,
+Block::Brahmi, Block::Kaithi, Block::Kaithi, Block::Kaithi, Block::Kaithi,
+Block::Kaithi, Block::Kaithi, Block::Kaithi, Block::Kaithi, Block::Kaithi,
+Block::Kaithi, Block::Kaithi, Block::Kaithi, Block::Kaithi, Block::Kaithi,
+Block::Kaithi, Block::Kaithi, Block::SoraSompeng, Block::SoraSompeng,
+Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng,
+Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng,
+Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng, Block::SoraSompeng,
+Block::SoraSompeng, Block::SoraSompeng, Block::Chakma, Block::Chakma,
+Block::Chakma, Block::Chakma, Block::Chakma, Block::Chakma, Block::Chakma,
+Block::Chakma, Block::Chakma, Block::Chakma, Block::Chakma, Block::Chakma,
+Block::Chakma, Block::Chakma, Block::Chakma, Block::Chakma, Block::Mahajani,
+Block::Mahajani, Block::Mahajani, Block::Mahajani, Block::Mahajani,
+Block::Mahajani, Block::Mahajani, Block::Mahajani, Block::Mahajani,
+Block::Mahajani, Block::Mahajani, Block::Mahajani, Block::Mahajani,
+Block::Mahajani, Block::Mahajani, Block::Mahajani, Block::Sharada,
+Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada,
+Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada,
+Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada, Block::Sharada,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers,
+Block::SinhalaArchaicNumbers, Block::SinhalaArchaicNumbers, Block::Khojki,
+Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki,
+Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki,
+Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki, Block::Khojki,
+Block::Multani, Block::Multani, Block::Multani, Block::Multani, Block::Multani,
+Block::Multani, Block::Multani, Block::Multani, Block::Multani, Block::Multani,
+Block::Multani, Block::Multani, Block::Multani, Block::Multani, Block::Multani,
+Block::Multani, Block::Khudawadi, Block::Khudawadi, Block::Khudawadi,
+Block::Khudawadi, Block::Khudawadi, Block::Khudawadi, Block::Khudawadi,
+Block::Khudawadi, Block::Khudawadi, Block::Khudawadi, Block::Khudawadi,
+Block::Khudawadi, Block::Khudawadi, Block::Khudawadi, Block::Khudawadi,
+Block::Khudawadi, Block::Grantha, Block::Grantha, Block::Grantha,
+Block::Grantha, Block::Grantha, Block::Grantha, Block::Grantha, Block::Grantha,
+Block::Grantha, Block::Grantha, Block::Grantha, Block::Grantha, Block::Grantha,
+Block::Grantha, Block::Grantha, Block::Grantha, Block::Newa, Block::Newa,
+Block::Newa, Block::Newa, Block::Newa, Block::Newa, Block::Newa, Block::Newa,
+Block::Newa, Block::Newa, Block::Newa, Block::Newa, Block::Newa, Block::Newa,
+Block::Newa, Block::Newa, Block::Tirhuta, Block::Tirhuta, Block::Tirhuta,
+Block::Tirhuta, Block::Tirhuta, Block::Tirhuta, Block::Tirhuta, Block::Tirhuta,
+Block::Tirhuta, Block::Tirhuta, Block::Tirhuta, Block::Tirhuta, Block::Tirhuta,
+Block::Tirhuta, Block::Tirhuta, Block::Tirhuta, Block::Siddham, Block::Siddham,
+Block::Siddham, Block::Siddham, Block::Siddham, Block::Siddham, Block::Siddham,
+Block::Siddham, Block::Siddham, Block::Siddham, Block::Siddham, Block::Siddham,
+Block::Siddham, Block::Siddham, Block::Siddham, Block::Siddham, Block::Modi,
+Block::Modi, Block::Modi, Block::Modi, Block::Modi, Block::Modi, Block::Modi,
+Block::Modi, Block::Modi, Block::Modi, Block::Modi, Block::Modi, Block::Modi,
+Block::Modi, Block::Modi, Block::Modi, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::MongolianSupplement,
+Block::MongolianSupplement, Block::Takri, Block::Takri, Block::Takri,
+Block::Takri, Block::Takri, Block::Takri, Block::Takri, Block::Takri,
+Block::Takri, Block::Takri, Block::Takri, Block::Takri, Block::Takri,
+Block::Takri, Block::Takri, Block::Takri, Block::Ahom, Block::Ahom, Block::Ahom,
+Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom,
+Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom, Block::Ahom,
+Block::Ahom, Block::Dogra, Block::Dogra, Block::Dogra, Block::Dogra,
+Block::Dogra, Block::Dogra, Block::Dogra, Block::Dogra, Block::Dogra,
+Block::Dogra, Block::Dogra, Block::Dogra, Block::Dogra, Block::Dogra,
+Block::Dogra, Block::Dogra, Block::WarangCiti, Block::WarangCiti,
+Block::WarangCiti, Block::WarangCiti, Block::WarangCiti, Block::WarangCiti,
+Block::WarangCiti, Block::WarangCiti, Block::WarangCiti, Block::WarangCiti,
+Block::WarangCiti, Block::WarangCiti, Block::WarangCiti, Block::WarangCiti,
+Block::WarangCiti, Block::WarangCiti, Block::DivesAkuru, Block::DivesAkuru,
+Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru,
+Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru,
+Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru, Block::DivesAkuru,
+Block::DivesAkuru, Block::DivesAkuru, Block::Nandinagari, Block::Nandinagari,
+Block::Nandinagari, Block::Nandinagari, Block::Nandinagari, Block::Nandinagari,
+Block::Nandinagari, Block::Nandinagari, Block::Nandinagari, Block::Nandinagari,
+Block::Nandinagari, Block::Nandinagari, Block::Nandinagari, Block::Nandinagari,
+Block::Nandinagari, Block::Nandinagari, Block::ZanabazarSquare,
+Block::ZanabazarSquare, Block::ZanabazarSquare, Block::ZanabazarSquare,
+Block::ZanabazarSquare, Block::ZanabazarSquare, Block::ZanabazarSquare,
+Block::ZanabazarSquare, Block::ZanabazarSquare, Block::ZanabazarSquare,
+Block::ZanabazarSquare, Block::ZanabazarSquare, Block::ZanabazarSquare,
+Block::ZanabazarSquare, Block::ZanabazarSquare, Block::ZanabazarSquare,
+Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo,
+Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo,
+Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo, Block::Soyombo,
+Block::Soyombo, Block::PauCinHau, Block::PauCinHau, Block::PauCinHau,
+Block::PauCinHau, Block::PauCinHau, Block::PauCinHau, Block::PauCinHau,
+Block::PauCinHau, Block::PauCinHau, Block::PauCinHau, Block::PauCinHau,
+Block::PauCinHau, Block::PauCinHau, Block::PauCinHau, Block::PauCinHau,
+Block::PauCinHau, Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki,
+Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki,
+Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki,
+Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki, Block::Bhaiksuki,
+Block::Bhaiksuki, Block::Marchen, Block::Marchen, Block::Marchen,
+Block::Marchen, Block::Marchen, Block::Marchen, Block::Marchen, Block::Marchen,
+Block::Marchen, Block::Marchen, Block::Marchen, Block::Marchen, Block::Marchen,
+Block::Marchen, Block::Marchen, Block::Marchen, Block::MasaramGondi,
+Block::MasaramGondi, Block::MasaramGondi, Block::MasaramGondi,
+Block::MasaramGondi, Block::MasaramGondi, Block::MasaramGondi,
+Block::MasaramGondi, Block::MasaramGondi, Block::MasaramGondi,
+Block::MasaramGondi, Block::MasaramGondi, Block::MasaramGondi,
+Block::MasaramGondi, Block::MasaramGondi, Block::MasaramGondi,
+Block::GunjalaGondi, Block::GunjalaGondi, Block::GunjalaGondi,
+Block::GunjalaGondi, Block::GunjalaGondi, Block::GunjalaGondi,
+Block::GunjalaGondi, Block::GunjalaGondi, Block::GunjalaGondi,
+Block::GunjalaGondi, Block::GunjalaGondi, Block::GunjalaGondi,
+Block::GunjalaGondi, Block::GunjalaGondi, Block::GunjalaGondi,
+Block::GunjalaGondi, Block::Makasar, Block::Makasar, Block::Makasar,
+Block::Makasar, Block::Makasar, Block::Makasar, Block::Makasar, Block::Makasar,
+Block::Makasar, Block::Makasar, Block::Makasar, Block::Makasar, Block::Makasar,
+Block::Makasar, Block::Makasar, Block::Makasar, Block::LisuSupplement,
+Block::LisuSupplement, Block::LisuSupplement, Block::LisuSupplement,
+Block::LisuSupplement, Block::LisuSupplement, Block::LisuSupplement,
+Block::LisuSupplement, Block::LisuSupplement, Block::LisuSupplement,
+Block::LisuSupplement, Block::LisuSupplement, Block::LisuSupplement,
+Block::LisuSupplement, Block::LisuSupplement, Block::LisuSupplement,
+Block::TamilSupplement, Block::TamilSupplement, Block::TamilSupplement,
+Block::TamilSupplement, Block::TamilSupplement, Block::TamilSupplement,
+Block::TamilSupplement, Block::TamilSupplement, Block::TamilSupplement,
+Block::TamilSupplement, Block::TamilSupplement, Block::TamilSupplement,
+Block::TamilSupplement, Block::TamilSupplement, Block::TamilSupplement,
+Block::TamilSupplement, Block::Cuneiform, Block::Cuneiform, Block::Cuneiform,
+Block::Cuneiform, Block::Cuneiform, Block::Cuneiform, Block::Cuneiform,
+Block::Cuneiform, Block::Cuneiform, Block::Cuneiform, Block::Cuneiform,
+Block::Cuneiform, Block::Cuneiform, Block::Cuneiform, Block::Cuneiform,
+Block::Cuneiform, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::CuneiformNumbersAndPunctuation,
+Block::CuneiformNumbersAndPunctuation, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EarlyDynasticCuneiform,
+Block::EarlyDynasticCuneiform, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphs,
+Block::EgyptianHieroglyphs, Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls,
+Block::EgyptianHieroglyphFormatControls, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::AnatolianHieroglyphs,
+Block::AnatolianHieroglyphs, Block::BamumSupplement, Block::BamumSupplement,
+Block::BamumSupplement, Block::BamumSupplement, Block::BamumSupplement,
+Block::BamumSupplement, Block::BamumSupplement, Block::BamumSupplement,
+Block::BamumSupplement, Block::BamumSupplement, Block::BamumSupplement,
+Block::BamumSupplement, Block::BamumSupplement, Block::BamumSupplement,
+Block::BamumSupplement, Block::BamumSupplement, Block::Mro, Block::Mro,
+Block::Mro, Block::Mro, Block::Mro, Block::Mro, Block::Mro, Block::Mro,
+Block::Mro, Block::Mro, Block::Mro, Block::Mro, Block::Mro, Block::Mro,
+Block::Mro, Block::Mro, Block::BassaVah, Block::BassaVah, Block::BassaVah,
+Block::BassaVah, Block::BassaVah, Block::BassaVah, Block::BassaVah,
+Block::BassaVah, Block::BassaVah, Block::BassaVah, Block::BassaVah,
+Block::BassaVah, Block::BassaVah, Block::BassaVah, Block::BassaVah,
+Block::BassaVah, Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong,
+Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong,
+Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong,
+Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong, Block::PahawhHmong,
+Block::PahawhHmong, Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin,
+Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin,
+Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin,
+Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin, Block::Medefaidrin,
+Block::Medefaidrin, Block::Miao, Block::Miao, Block::Miao, Block::Miao,
+Block::Miao, Block::Miao, Block::Miao, Block::Miao, Block::Miao, Block::Miao,
+Block::Miao, Block::Miao, Block::Miao, Block::Miao, Block::Miao, Block::Miao,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation,
+Block::IdeographicSymbolsAndPunctuation, Block::Tangut, Block::Tangut,
+Block::Tangut, Block::Tangut, Block::Tangut, Block::Tangut, Block::Tangut,
+Block::Tangut, Block::Tangut, Block::Tangut, Block::Tangut, Block::Tangut,
+Block::Tangut, Block::Tangut, Block::Tangut, Block::Tangut,
+Block::TangutComponents, Block::TangutComponents, Block::TangutComponents,
+Block::TangutComponents, Block::TangutComponents, Block::TangutComponents,
+Block::TangutComponents, Block::TangutComponents, Block::TangutComponents,
+Block::TangutComponents, Block::TangutComponents, Block::TangutComponents,
+Block::TangutComponents, Block::TangutComponents, Block::TangutComponents,
+Block::TangutComponents, Block::KhitanSmallScript, Block::KhitanSmallScript,
+Block::KhitanSmallScript, Block::KhitanSmallScript, Block::KhitanSmallScript,
+Block::KhitanSmallScript, Block::KhitanSmallScript, Block::KhitanSmallScript,
+Block::KhitanSmallScript, Block::KhitanSmallScript, Block::KhitanSmallScript,
+Block::KhitanSmallScript, Block::KhitanSmallScript, Block::KhitanSmallScript,
+Block::KhitanSmallScript, Block::KhitanSmallScript, Block::TangutSupplement,
+Block::TangutSupplement, Block::TangutSupplement, Block::TangutSupplement,
+Block::TangutSupplement, Block::TangutSupplement, Block::TangutSupplement,
+Block::TangutSupplement, Block::TangutSupplement, Block::TangutSupplement,
+Block::TangutSupplement, Block::TangutSupplement, Block::TangutSupplement,
+Block::TangutSupplement, Block::TangutSupplement, Block::TangutSupplement,
+Block::KanaSupplement, Block::KanaSupplement, Block::KanaSupplement,
+Block::KanaSupplement, Block::KanaSupplement, Block::KanaSupplement,
+Block::KanaSupplement, Block::KanaSupplement, Block::KanaSupplement,
+Block::KanaSupplement, Block::KanaSupplement, Block::KanaSupplement,
+Block::KanaSupplement, Block::KanaSupplement, Block::KanaSupplement,
+Block::KanaSupplement, Block::KanaExtendedA, Block::KanaExtendedA,
+Block::KanaExtendedA, Block::KanaExtendedA, Block::KanaExtendedA,
+Block::KanaExtendedA, Block::KanaExtendedA, Block::KanaExtendedA,
+Block::KanaExtendedA, Block::KanaExtendedA, Block::KanaExtendedA,
+Block::KanaExtendedA, Block::KanaExtendedA, Block::KanaExtendedA,
+Block::KanaExtendedA, Block::KanaExtendedA, Block::SmallKanaExtension,
+Block::SmallKanaExtension, Block::SmallKanaExtension, Block::SmallKanaExtension,
+Block::SmallKanaExtension, Block::SmallKanaExtension, Block::SmallKanaExtension,
+Block::SmallKanaExtension, Block::SmallKanaExtension, Block::SmallKanaExtension,
+Block::SmallKanaExtension, Block::SmallKanaExtension, Block::SmallKanaExtension,
+Block::SmallKanaExtension, Block::SmallKanaExtension, Block::SmallKanaExtension,
+Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu,
+Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu,
+Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu, Block::Nushu,
+Block::Nushu, Block::Duployan, Block::Duployan, Block::Duployan,
+Block::Duployan, Block::Duployan, Block::Duployan, Block::Duployan,
+Block::Duployan, Block::Duployan, Block::Duployan, Block::Duployan,
+Block::Duployan, Block::Duployan, Block::Duployan, Block::Duployan,
+Block::Duployan, Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ShorthandFormatControls, Block::ShorthandFormatControls,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::ByzantineMusicalSymbols, Block::ByzantineMusicalSymbols,
+Block::MusicalSymbols, Block::MusicalSymbols, Block::MusicalSymbols,
+Block::MusicalSymbols, Block::MusicalSymbols, Block::MusicalSymbols,
+Block::MusicalSymbols, Block::MusicalSymbols, Block::MusicalSymbols,
+Block::MusicalSymbols, Block::MusicalSymbols, Block::MusicalSymbols,
+Block::MusicalSymbols, Block::MusicalSymbols, Block::MusicalSymbols,
+Block::MusicalSymbols, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::AncientGreekMusicalNotation,
+Block::AncientGreekMusicalNotation, Block::MayanNumerals, Block::MayanNumerals,
+Block::MayanNumerals, Block::MayanNumerals, Block::MayanNumerals,
+Block::MayanNumerals, Block::MayanNumerals, Block::MayanNumerals,
+Block::MayanNumerals, Block::MayanNumerals, Block::MayanNumerals,
+Block::MayanNumerals, Block::MayanNumerals, Block::MayanNumerals,
+Block::MayanNumerals, Block::MayanNumerals, Block::TaiXuanJingSymbols,
+Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols,
+Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols,
+Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols,
+Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols,
+Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols, Block::TaiXuanJingSymbols,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::CountingRodNumerals, Block::CountingRodNumerals,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::MathematicalAlphanumericSymbols, Block::MathematicalAlphanumericSymbols,
+Block::SuttonSignWriting, Block::SuttonSignWriting, Block::SuttonSignWriting,
+Block::SuttonSignWriting, Block::SuttonSignWriting, Block::SuttonSignWriting,
+Block::SuttonSignWriting, Block::SuttonSignWriting, Block::SuttonSignWriting,
+Block::SuttonSignWriting, Block::SuttonSignWriting, Block::SuttonSignWriting,
+Block::SuttonSignWriting, Block::SuttonSignWriting, Block::SuttonSignWriting,
+Block::SuttonSignWriting, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::GlagoliticSupplement,
+Block::GlagoliticSupplement, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::NyiakengPuachueHmong,
+Block::NyiakengPuachueHmong, Block::Wancho, Block::Wancho, Block::Wancho,
+Block::Wancho, Block::Wancho, Block::Wancho, Block::Wancho, Block::Wancho,
+Block::Wancho, Block::Wancho, Block::Wancho, Block::Wancho, Block::Wancho,
+Block::Wancho, Block::Wancho, Block::Wancho, Block::MendeKikakui,
+Block::MendeKikakui, Block::MendeKikakui, Block::MendeKikakui,
+Block::MendeKikakui, Block::MendeKikakui, Block::MendeKikakui,
+Block::MendeKikakui, Block::MendeKikakui, Block::MendeKikakui,
+Block::MendeKikakui, Block::MendeKikakui, Block::MendeKikakui,
+Block::MendeKikakui, Block::MendeKikakui, Block::MendeKikakui, Block::Adlam,
+Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam,
+Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam,
+Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam, Block::Adlam,
+Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers,
+Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers,
+Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers,
+Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers,
+Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers, Block::IndicSiyaqNumbers,
+Block::IndicSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::OttomanSiyaqNumbers,
+Block::OttomanSiyaqNumbers, Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols,
+Block::ArabicMathematicalAlphabeticSymbols, Block::MahjongTiles,
+Block::MahjongTiles, Block::MahjongTiles, Block::MahjongTiles,
+Block::MahjongTiles, Block::MahjongTiles, Block::MahjongTiles,
+Block::MahjongTiles, Block::MahjongTiles, Block::MahjongTiles,
+Block::MahjongTiles, Block::MahjongTiles, Block::MahjongTiles,
+Block::MahjongTiles, Block::MahjongTiles, Block::MahjongTiles,
+Block::DominoTiles, Block::DominoTiles, Block::DominoTiles, Block::DominoTiles,
+Block::DominoTiles, Block::DominoTiles, Block::DominoTiles, Block::DominoTiles,
+Block::DominoTiles, Block::DominoTiles, Block::DominoTiles, Block::DominoTiles,
+Block::DominoTiles, Block::DominoTiles, Block::DominoTiles, Block::DominoTiles,
+Block::PlayingCards, Block::PlayingCards, Block::PlayingCards,
+Block::PlayingCards, Block::PlayingCards, Block::PlayingCards,
+Block::PlayingCards, Block::PlayingCards, Block::PlayingCards,
+Block::PlayingCards, Block::PlayingCards, Block::PlayingCards,
+Block::PlayingCards, Block::PlayingCards, Block::PlayingCards,
+Block::PlayingCards, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedAlphanumericSupplement,
+Block::EnclosedAlphanumericSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::EnclosedIdeographicSupplement,
+Block::EnclosedIdeographicSupplement, Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs,
+Block::MiscellaneousSymbolsAndPictographs, Block::Emoticons, Block::Emoticons,
+Block::Emoticons, Block::Emoticons, Block::Emoticons, Block::Emoticons,
+Block::Emoticons, Block::Emoticons, Block::Emoticons, Block::Emoticons,
+Block::Emoticons, Block::Emoticons, Block::Emoticons, Block::Emoticons,
+Block::Emoticons, Block::Emoticons, Block::OrnamentalDingbats,
+Block::OrnamentalDingbats, Block::OrnamentalDingbats, Block::OrnamentalDingbats,
+Block::OrnamentalDingbats, Block::OrnamentalDingbats, Block::OrnamentalDingbats,
+Block::OrnamentalDingbats, Block::OrnamentalDingbats, Block::OrnamentalDingbats,
+Block::OrnamentalDingbats, Block::OrnamentalDingbats, Block::OrnamentalDingbats,
+Block::OrnamentalDingbats, Block::OrnamentalDingbats, Block::OrnamentalDingbats,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::TransportAndMapSymbols, Block::TransportAndMapSymbols,
+Block::AlchemicalSymbols, Block::AlchemicalSymbols, Block::AlchemicalSymbols,
+Block::AlchemicalSymbols, Block::AlchemicalSymbols, Block::AlchemicalSymbols,
+Block::AlchemicalSymbols, Block::AlchemicalSymbols, Block::AlchemicalSymbols,
+Block::AlchemicalSymbols, Block::AlchemicalSymbols, Block::AlchemicalSymbols,
+Block::AlchemicalSymbols, Block::AlchemicalSymbols, Block::AlchemicalSymbols,
+Block::AlchemicalSymbols, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::GeometricShapesExtended,
+Block::GeometricShapesExtended, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalArrowsC,
+Block::SupplementalArrowsC, Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs,
+Block::SupplementalSymbolsAndPictographs, Block::ChessSymbols,
+Block::ChessSymbols, Block::ChessSymbols, Block::ChessSymbols,
+Block::ChessSymbols, Block::ChessSymbols, Block::ChessSymbols,
+Block::ChessSymbols, Block::ChessSymbols, Block::ChessSymbols,
+Block::ChessSymbols, Block::ChessSymbols, Block::ChessSymbols,
+Block::ChessSymbols, Block::ChessSymbols, Block::ChessSymbols,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsAndPictographsExtendedA, Block::SymbolsAndPictographsExtendedA,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::SymbolsForLegacyComputing, Block::SymbolsForLegacyComputing,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionB, Block::CJKUnifiedIdeographsExtensionB,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionC, Block::CJKUnifiedIdeographsExtensionC,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionD, Block::CJKUnifiedIdeographsExtensionD,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionE, Block::CJKUnifiedIdeographsExtensionE,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKUnifiedIdeographsExtensionF, Block::CJKUnifiedIdeographsExtensionF,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKCompatibilityIdeographsSupplement,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::CJKUnifiedIdeographsExtensionG, Block::CJKUnifiedIdeographsExtensionG,
+Block::Tags, Block::Tags, Block::Tags, Block::Tags, Block::Tags, Block::Tags,
+Block::Tags, Block::Tags, Block::Tags, Block::Tags, Block::Tags, Block::Tags,
+Block::Tags, Block::Tags, Block::Tags, Block::Tags,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::VariationSelectorsSupplement, Block::VariationSelectorsSupplement,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaA, Block::SupplementaryPrivateUseAreaA,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+Block::SupplementaryPrivateUseAreaB, Block::SupplementaryPrivateUseAreaB,
+};
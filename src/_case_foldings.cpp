@@ -1,1492 +1,193 @@
-const std::unordered_map<char32_t, CaseFolding> _case_foldings = {
-{ 0x00000041, { 0x00000061,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000042, { 0x00000062,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000043, { 0x00000063,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000044, { 0x00000064,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000045, { 0x00000065,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000046, { 0x00000066,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000047, { 0x00000067,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000048, { 0x00000068,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000049, { 0x00000069,  0x00000000, nullptr, 0x00000131 } },
-{ 0x0000004A, { 0x0000006A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000004B, { 0x0000006B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000004C, { 0x0000006C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000004D, { 0x0000006D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000004E, { 0x0000006E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000004F, { 0x0000006F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000050, { 0x00000070,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000051, { 0x00000071,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000052, { 0x00000072,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000053, { 0x00000073,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000054, { 0x00000074,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000055, { 0x00000075,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000056, { 0x00000076,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000057, { 0x00000077,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000058, { 0x00000078,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000059, { 0x00000079,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000005A, { 0x0000007A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000B5, { 0x000003BC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C0, { 0x000000E0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C1, { 0x000000E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C2, { 0x000000E2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C3, { 0x000000E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C4, { 0x000000E4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C5, { 0x000000E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C6, { 0x000000E6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C7, { 0x000000E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C8, { 0x000000E8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000C9, { 0x000000E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CA, { 0x000000EA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CB, { 0x000000EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CC, { 0x000000EC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CD, { 0x000000ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CE, { 0x000000EE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000CF, { 0x000000EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D0, { 0x000000F0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D1, { 0x000000F1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D2, { 0x000000F2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D3, { 0x000000F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D4, { 0x000000F4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D5, { 0x000000F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D6, { 0x000000F6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D8, { 0x000000F8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000D9, { 0x000000F9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DA, { 0x000000FA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DB, { 0x000000FB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DC, { 0x000000FC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DD, { 0x000000FD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DE, { 0x000000FE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000000DF, { 0x00000000,  0x00000000, U"\U00000073\U00000073", 0x00000000 } },
-{ 0x00000100, { 0x00000101,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000102, { 0x00000103,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000104, { 0x00000105,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000106, { 0x00000107,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000108, { 0x00000109,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000010A, { 0x0000010B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000010C, { 0x0000010D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000010E, { 0x0000010F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000110, { 0x00000111,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000112, { 0x00000113,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000114, { 0x00000115,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000116, { 0x00000117,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000118, { 0x00000119,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000011A, { 0x0000011B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000011C, { 0x0000011D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000011E, { 0x0000011F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000120, { 0x00000121,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000122, { 0x00000123,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000124, { 0x00000125,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000126, { 0x00000127,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000128, { 0x00000129,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000012A, { 0x0000012B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000212B, { 0x000000E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000012C, { 0x0000012D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000012E, { 0x0000012F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000130, { 0x00000000,  0x00000000, U"\U00000069\U00000307", 0x00000069 } },
-{ 0x00000132, { 0x00000133,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000134, { 0x00000135,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000136, { 0x00000137,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000139, { 0x0000013A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000013B, { 0x0000013C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000013D, { 0x0000013E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000013F, { 0x00000140,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000141, { 0x00000142,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000143, { 0x00000144,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000145, { 0x00000146,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000147, { 0x00000148,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000149, { 0x00000000,  0x00000000, U"\U000002BC\U0000006E", 0x00000000 } },
-{ 0x0000014A, { 0x0000014B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000014C, { 0x0000014D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000014E, { 0x0000014F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000150, { 0x00000151,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000152, { 0x00000153,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000154, { 0x00000155,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000156, { 0x00000157,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000158, { 0x00000159,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000015A, { 0x0000015B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000015C, { 0x0000015D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000015E, { 0x0000015F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000160, { 0x00000161,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002161, { 0x00002171,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000162, { 0x00000163,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002163, { 0x00002173,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000164, { 0x00000165,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002165, { 0x00002175,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002166, { 0x00002176,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002167, { 0x00002177,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002168, { 0x00002178,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002169, { 0x00002179,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216A, { 0x0000217A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216B, { 0x0000217B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216C, { 0x0000217C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216D, { 0x0000217D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216E, { 0x0000217E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000216F, { 0x0000217F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000170, { 0x00000171,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000172, { 0x00000173,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000174, { 0x00000175,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000176, { 0x00000177,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000178, { 0x000000FF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000179, { 0x0000017A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000017B, { 0x0000017C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000017D, { 0x0000017E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000017F, { 0x00000073,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000181, { 0x00000253,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000182, { 0x00000183,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002183, { 0x00002184,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000184, { 0x00000185,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000186, { 0x00000254,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000187, { 0x00000188,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000189, { 0x00000256,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000018A, { 0x00000257,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000018B, { 0x0000018C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000018E, { 0x000001DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000018F, { 0x00000259,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000190, { 0x0000025B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000191, { 0x00000192,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000193, { 0x00000260,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000194, { 0x00000263,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000196, { 0x00000269,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000197, { 0x00000268,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000198, { 0x00000199,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000019C, { 0x0000026F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000019D, { 0x00000272,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000019F, { 0x00000275,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A0, { 0x000001A1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A2, { 0x000001A3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A4, { 0x000001A5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A6, { 0x00000280,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A7, { 0x000001A8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001A9, { 0x00000283,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001AC, { 0x000001AD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001AE, { 0x00000288,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001AF, { 0x000001B0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B1, { 0x0000028A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B2, { 0x0000028B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B3, { 0x000001B4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B5, { 0x000001B6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B7, { 0x00000292,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001B8, { 0x000001B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001BC, { 0x000001BD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001C4, { 0x000001C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001C5, { 0x000001C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001C7, { 0x000001C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001C8, { 0x000001C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001CA, { 0x000001CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001CB, { 0x000001CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001CD, { 0x000001CE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001CF, { 0x000001D0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001D1, { 0x000001D2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001D3, { 0x000001D4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001D5, { 0x000001D6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001D7, { 0x000001D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001D9, { 0x000001DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001DB, { 0x000001DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001DE, { 0x000001DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001E0, { 0x000001E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001E2, { 0x000001E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001E4, { 0x000001E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001E6, { 0x000001E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001E8, { 0x000001E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001EA, { 0x000001EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001EC, { 0x000001ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001EE, { 0x000001EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F0, { 0x00000000,  0x00000000, U"\U0000006A\U0000030C", 0x00000000 } },
-{ 0x000001F1, { 0x000001F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F2, { 0x000001F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F4, { 0x000001F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F6, { 0x00000195,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F7, { 0x000001BF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001F8, { 0x000001F9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001FA, { 0x000001FB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001FC, { 0x000001FD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000001FE, { 0x000001FF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000200, { 0x00000201,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000202, { 0x00000203,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000204, { 0x00000205,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000206, { 0x00000207,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000208, { 0x00000209,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000020A, { 0x0000020B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000020C, { 0x0000020D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000020E, { 0x0000020F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000210, { 0x00000211,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000212, { 0x00000213,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000214, { 0x00000215,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000216, { 0x00000217,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000218, { 0x00000219,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000021A, { 0x0000021B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000021C, { 0x0000021D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000021E, { 0x0000021F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000220, { 0x0000019E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000222, { 0x00000223,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000224, { 0x00000225,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000226, { 0x00000227,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000228, { 0x00000229,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000022A, { 0x0000022B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000022C, { 0x0000022D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000022E, { 0x0000022F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000230, { 0x00000231,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000232, { 0x00000233,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000023A, { 0x00002C65,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000023B, { 0x0000023C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000023D, { 0x0000019A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000023E, { 0x00002C66,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000241, { 0x00000242,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000243, { 0x00000180,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000244, { 0x00000289,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000245, { 0x0000028C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000246, { 0x00000247,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000248, { 0x00000249,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000024A, { 0x0000024B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000024C, { 0x0000024D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000024E, { 0x0000024F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9A, { 0x00010CDA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9C, { 0x00010CDC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9E, { 0x00010CDE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000345, { 0x000003B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000370, { 0x00000371,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000372, { 0x00000373,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000376, { 0x00000377,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000037F, { 0x000003F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000386, { 0x000003AC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000388, { 0x000003AD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000389, { 0x000003AE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000038A, { 0x000003AF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000038C, { 0x000003CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000038E, { 0x000003CD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000038F, { 0x000003CE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000390, { 0x00000000,  0x00000000, U"\U000003B9\U00000308\U00000301", 0x00000000 } },
-{ 0x00000391, { 0x000003B1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000392, { 0x000003B2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000393, { 0x000003B3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000394, { 0x000003B4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000395, { 0x000003B5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000396, { 0x000003B6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000397, { 0x000003B7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000398, { 0x000003B8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000399, { 0x000003B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039A, { 0x000003BA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039B, { 0x000003BB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039C, { 0x000003BC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039D, { 0x000003BD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039E, { 0x000003BE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000039F, { 0x000003BF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A0, { 0x000003C0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A1, { 0x000003C1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A3, { 0x000003C3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A4, { 0x000003C4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A5, { 0x000003C5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A6, { 0x000003C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A7, { 0x000003C7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A8, { 0x000003C8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003A9, { 0x000003C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003AA, { 0x000003CA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003AB, { 0x000003CB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003B0, { 0x00000000,  0x00000000, U"\U000003C5\U00000308\U00000301", 0x00000000 } },
-{ 0x000003C2, { 0x000003C3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003CF, { 0x000003D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003D0, { 0x000003B2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003D1, { 0x000003B8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003D5, { 0x000003C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003D6, { 0x000003C0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003D8, { 0x000003D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003DA, { 0x000003DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003DC, { 0x000003DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003DE, { 0x000003DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003E0, { 0x000003E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003E2, { 0x000003E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003E4, { 0x000003E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003E6, { 0x000003E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003E8, { 0x000003E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003EA, { 0x000003EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003EC, { 0x000003ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003EE, { 0x000003EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F0, { 0x000003BA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F1, { 0x000003C1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F4, { 0x000003B8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F5, { 0x000003B5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F7, { 0x000003F8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003F9, { 0x000003F2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003FA, { 0x000003FB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003FD, { 0x0000037B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003FE, { 0x0000037C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000003FF, { 0x0000037D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010400, { 0x00010428,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000401, { 0x00000451,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010402, { 0x0001042A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010403, { 0x0001042B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010404, { 0x0001042C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010405, { 0x0001042D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010406, { 0x0001042E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010407, { 0x0001042F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000408, { 0x00000458,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010409, { 0x00010431,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040A, { 0x00010432,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040B, { 0x00010433,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040C, { 0x00010434,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040D, { 0x0000045D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040E, { 0x0000045E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040F, { 0x00010437,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010410, { 0x00010438,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000411, { 0x00000431,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010412, { 0x0001043A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010413, { 0x0001043B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010414, { 0x0001043C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010415, { 0x0001043D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000416, { 0x00000436,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010417, { 0x0001043F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000418, { 0x00000438,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000419, { 0x00000439,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041A, { 0x00010442,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041B, { 0x0000043B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041C, { 0x00010444,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041D, { 0x00010445,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041E, { 0x00010446,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041F, { 0x00010447,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010420, { 0x00010448,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000421, { 0x00000441,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000422, { 0x00000442,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000423, { 0x00000443,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000424, { 0x00000444,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000425, { 0x00000445,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000426, { 0x00000446,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000427, { 0x00000447,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000428, { 0x00000448,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000429, { 0x00000449,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042A, { 0x0000044A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042B, { 0x0000044B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042C, { 0x0000044C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042D, { 0x0000044D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042E, { 0x0000044E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000042F, { 0x0000044F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000460, { 0x00000461,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000462, { 0x00000463,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000464, { 0x00000465,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000466, { 0x00000467,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000468, { 0x00000469,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000046A, { 0x0000046B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000046C, { 0x0000046D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000046E, { 0x0000046F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000470, { 0x00000471,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000472, { 0x00000473,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000474, { 0x00000475,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000476, { 0x00000477,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000478, { 0x00000479,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000047A, { 0x0000047B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000047C, { 0x0000047D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000047E, { 0x0000047F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000480, { 0x00000481,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000048A, { 0x0000048B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000048C, { 0x0000048D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000048E, { 0x0000048F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000490, { 0x00000491,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000492, { 0x00000493,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAC, { 0x00010CEC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000494, { 0x00000495,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000496, { 0x00000497,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000498, { 0x00000499,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000049A, { 0x0000049B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000049C, { 0x0000049D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000049E, { 0x0000049F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004A0, { 0x000004A1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004A2, { 0x000004A3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004A4, { 0x000004A5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004A6, { 0x000004A7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004A8, { 0x000004A9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004AA, { 0x000004AB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004AC, { 0x000004AD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004AE, { 0x000004AF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B0, { 0x000104D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B1, { 0x000104D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004B2, { 0x000004B3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B3, { 0x000104DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B4, { 0x000104DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B5, { 0x000104DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B6, { 0x000104DE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024B7, { 0x000024D1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B8, { 0x000104E0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B9, { 0x000104E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BA, { 0x000104E2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BB, { 0x000104E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BC, { 0x000024D6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BD, { 0x000104E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BE, { 0x000024D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BF, { 0x000104E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C0, { 0x000104E8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C1, { 0x000104E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C2, { 0x000104EA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C3, { 0x000024DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C4, { 0x000104EC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C5, { 0x000104ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C6, { 0x000104EE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C7, { 0x000024E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C8, { 0x000024E2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C9, { 0x000024E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CA, { 0x000024E4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CB, { 0x000104F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CC, { 0x000104F4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CD, { 0x000104F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CE, { 0x000104F6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CF, { 0x000104F7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104D0, { 0x000104F8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104D1, { 0x000104F9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104D2, { 0x000104FA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104D3, { 0x000104FB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004D4, { 0x000004D5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004D6, { 0x000004D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB79, { 0x000013A9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004D8, { 0x000004D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004DA, { 0x000004DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004DC, { 0x000004DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004DE, { 0x000004DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004E0, { 0x000004E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004E2, { 0x000004E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004E4, { 0x000004E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004E6, { 0x000004E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004E8, { 0x000004E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004EA, { 0x000004EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004EC, { 0x000004ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004EE, { 0x000004EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004F0, { 0x000004F1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004F2, { 0x000004F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004F4, { 0x000004F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004F6, { 0x000004F7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004F8, { 0x000004F9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004FA, { 0x000004FB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004FC, { 0x000004FD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004FE, { 0x000004FF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000500, { 0x00000501,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000502, { 0x00000503,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000504, { 0x00000505,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000506, { 0x00000507,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000508, { 0x00000509,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000050A, { 0x0000050B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CB0, { 0x00010CF0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000050C, { 0x0000050D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000050E, { 0x0000050F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000510, { 0x00000511,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000512, { 0x00000513,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000514, { 0x00000515,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000516, { 0x00000517,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000518, { 0x00000519,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000051A, { 0x0000051B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000051C, { 0x0000051D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000051E, { 0x0000051F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000520, { 0x00000521,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000522, { 0x00000523,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000524, { 0x00000525,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000526, { 0x00000527,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000528, { 0x00000529,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000052A, { 0x0000052B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000052C, { 0x0000052D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000052E, { 0x0000052F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000531, { 0x00000561,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000532, { 0x00000562,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000533, { 0x00000563,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000534, { 0x00000564,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000535, { 0x00000565,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000536, { 0x00000566,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000537, { 0x00000567,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000538, { 0x00000568,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000539, { 0x00000569,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053A, { 0x0000056A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053B, { 0x0000056B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053C, { 0x0000056C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053D, { 0x0000056D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053E, { 0x0000056E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000053F, { 0x0000056F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000540, { 0x00000570,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000541, { 0x00000571,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000542, { 0x00000572,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000543, { 0x00000573,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000544, { 0x00000574,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000545, { 0x00000575,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000546, { 0x00000576,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000547, { 0x00000577,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000548, { 0x00000578,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000549, { 0x00000579,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054A, { 0x0000057A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054B, { 0x0000057B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054C, { 0x0000057C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054D, { 0x0000057D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054E, { 0x0000057E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000054F, { 0x0000057F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000550, { 0x00000580,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000551, { 0x00000581,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000552, { 0x00000582,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000553, { 0x00000583,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000554, { 0x00000584,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000555, { 0x00000585,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000556, { 0x00000586,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB91, { 0x000013C1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000587, { 0x00000000,  0x00000000, U"\U00000565\U00000582", 0x00000000 } },
-{ 0x0000A640, { 0x0000A641,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A642, { 0x0000A643,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A644, { 0x0000A645,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A646, { 0x0000A647,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A648, { 0x0000A649,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A64A, { 0x0000A64B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A64C, { 0x0000A64D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A64E, { 0x0000A64F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A650, { 0x0000A651,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A652, { 0x0000A653,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A654, { 0x0000A655,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A656, { 0x0000A657,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A658, { 0x0000A659,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A65A, { 0x0000A65B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A65C, { 0x0000A65D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A65E, { 0x0000A65F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A660, { 0x0000A661,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A662, { 0x0000A663,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A664, { 0x0000A665,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A666, { 0x0000A667,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A668, { 0x0000A669,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A66A, { 0x0000A66B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A66C, { 0x0000A66D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A680, { 0x0000A681,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A682, { 0x0000A683,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A684, { 0x0000A685,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A686, { 0x0000A687,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A688, { 0x0000A689,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A68A, { 0x0000A68B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A68C, { 0x0000A68D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A68E, { 0x0000A68F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A690, { 0x0000A691,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A692, { 0x0000A693,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A694, { 0x0000A695,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A696, { 0x0000A697,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A698, { 0x0000A699,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A69A, { 0x0000A69B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002126, { 0x000003C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000212A, { 0x0000006B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A722, { 0x0000A723,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A724, { 0x0000A725,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A726, { 0x0000A727,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A728, { 0x0000A729,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A72A, { 0x0000A72B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A72C, { 0x0000A72D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002132, { 0x0000214E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A72E, { 0x0000A72F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A732, { 0x0000A733,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A734, { 0x0000A735,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A736, { 0x0000A737,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A738, { 0x0000A739,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A73A, { 0x0000A73B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A73C, { 0x0000A73D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A73E, { 0x0000A73F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A740, { 0x0000A741,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A742, { 0x0000A743,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A744, { 0x0000A745,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A746, { 0x0000A747,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A748, { 0x0000A749,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A74A, { 0x0000A74B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A74C, { 0x0000A74D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A74E, { 0x0000A74F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A750, { 0x0000A751,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A752, { 0x0000A753,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A754, { 0x0000A755,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A756, { 0x0000A757,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A758, { 0x0000A759,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A75A, { 0x0000A75B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A75C, { 0x0000A75D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A75E, { 0x0000A75F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A760, { 0x0000A761,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A762, { 0x0000A763,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A764, { 0x0000A765,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A766, { 0x0000A767,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A768, { 0x0000A769,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A76A, { 0x0000A76B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A76C, { 0x0000A76D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A76E, { 0x0000A76F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A779, { 0x0000A77A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A77B, { 0x0000A77C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A77D, { 0x00001D79,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A77E, { 0x0000A77F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A780, { 0x0000A781,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A782, { 0x0000A783,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A784, { 0x0000A785,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A786, { 0x0000A787,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A78B, { 0x0000A78C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A78D, { 0x00000265,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A790, { 0x0000A791,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A792, { 0x0000A793,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A796, { 0x0000A797,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A798, { 0x0000A799,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A79A, { 0x0000A79B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A79C, { 0x0000A79D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A79E, { 0x0000A79F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7A0, { 0x0000A7A1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7A2, { 0x0000A7A3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7A4, { 0x0000A7A5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7A6, { 0x0000A7A7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7A8, { 0x0000A7A9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7AA, { 0x00000266,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7AB, { 0x0000025C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7AC, { 0x00000261,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7AD, { 0x0000026C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7AE, { 0x0000026A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B0, { 0x0000029E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B1, { 0x00000287,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B2, { 0x0000029D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B3, { 0x0000AB53,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B4, { 0x0000A7B5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B6, { 0x0000A7B7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7B8, { 0x0000A7B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7BA, { 0x0000A7BB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7BC, { 0x0000A7BD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7BE, { 0x0000A7BF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C2, { 0x0000A7C3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C4, { 0x0000A794,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C5, { 0x00000282,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C6, { 0x00001D8E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C7, { 0x0000A7C8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7C9, { 0x0000A7CA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000A7F5, { 0x0000A7F6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F2B, { 0x00001F23,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002160, { 0x00002170,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002162, { 0x00002172,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002164, { 0x00002174,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000166, { 0x00000167,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000168, { 0x00000169,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000016A, { 0x0000016B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000016C, { 0x0000016D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000016E, { 0x0000016F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E900, { 0x0001E922,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E901, { 0x0001E923,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E902, { 0x0001E924,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E903, { 0x0001E925,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E904, { 0x0001E926,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E905, { 0x0001E927,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E906, { 0x0001E928,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E907, { 0x0001E929,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E908, { 0x0001E92A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E909, { 0x0001E92B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90A, { 0x0001E92C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90B, { 0x0001E92D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90C, { 0x0001E92E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90D, { 0x0001E92F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90E, { 0x0001E930,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E90F, { 0x0001E931,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E910, { 0x0001E932,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E911, { 0x0001E933,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E912, { 0x0001E934,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E913, { 0x0001E935,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E914, { 0x0001E936,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E915, { 0x0001E937,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E916, { 0x0001E938,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E917, { 0x0001E939,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E918, { 0x0001E93A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E919, { 0x0001E93B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91A, { 0x0001E93C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91B, { 0x0001E93D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91C, { 0x0001E93E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91D, { 0x0001E93F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91E, { 0x0001E940,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E91F, { 0x0001E941,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E920, { 0x0001E942,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001E921, { 0x0001E943,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C96, { 0x00010CD6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C80, { 0x00010CC0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C82, { 0x00002C83,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C84, { 0x00002C85,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C86, { 0x00002C87,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C87, { 0x00000463,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C88, { 0x00002C89,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C8A, { 0x00002C8B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8C, { 0x00010CCC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8E, { 0x00010CCE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C90, { 0x00002C91,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C92, { 0x00002C93,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB70, { 0x000013A0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB71, { 0x000013A1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB72, { 0x000013A2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB73, { 0x000013A3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB74, { 0x000013A4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB75, { 0x000013A5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB76, { 0x000013A6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB77, { 0x000013A7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB78, { 0x000013A8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C94, { 0x00002C95,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7A, { 0x000013AA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7B, { 0x000013AB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7C, { 0x000013AC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7D, { 0x000013AD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7E, { 0x000013AE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB7F, { 0x000013AF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB80, { 0x000013B0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB81, { 0x000013B1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB82, { 0x000013B2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB83, { 0x000013B3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB84, { 0x000013B4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB85, { 0x000013B5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB86, { 0x000013B6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB87, { 0x000013B7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB88, { 0x000013B8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB89, { 0x000013B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8A, { 0x000013BA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8B, { 0x000013BB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8C, { 0x000013BC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8D, { 0x000013BD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8E, { 0x000013BE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB8F, { 0x000013BF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB90, { 0x000013C0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C98, { 0x00010CD8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB92, { 0x000013C2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB93, { 0x000013C3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB94, { 0x000013C4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB95, { 0x000013C5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB96, { 0x000013C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB97, { 0x000013C7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB98, { 0x000013C8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB99, { 0x000013C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9A, { 0x000013CA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9B, { 0x000013CB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9C, { 0x000013CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9D, { 0x000013CD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9E, { 0x000013CE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000AB9F, { 0x000013CF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA0, { 0x000013D0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA1, { 0x000013D1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA2, { 0x000013D2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA3, { 0x000013D3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA4, { 0x000013D4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA5, { 0x000013D5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA6, { 0x000013D6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA7, { 0x000013D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA8, { 0x000013D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABA9, { 0x000013D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAA, { 0x000013DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAB, { 0x000013DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAC, { 0x000013DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAD, { 0x000013DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAE, { 0x000013DE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABAF, { 0x000013DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB0, { 0x000013E0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB1, { 0x000013E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB2, { 0x000013E2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB3, { 0x000013E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB4, { 0x000013E4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB5, { 0x000013E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB6, { 0x000013E6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB7, { 0x000013E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB8, { 0x000013E8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABB9, { 0x000013E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBA, { 0x000013EA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBB, { 0x000013EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBC, { 0x000013EC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBD, { 0x000013ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBE, { 0x000013EE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000ABBF, { 0x000013EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA0, { 0x00010CE0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA2, { 0x00010CE2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA4, { 0x00010CE4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA6, { 0x00010CE6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA8, { 0x00010CE8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAA, { 0x00010CEA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C00, { 0x00002C30,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C01, { 0x00002C31,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C02, { 0x00002C32,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C03, { 0x00002C33,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C04, { 0x00002C34,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C05, { 0x00002C35,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C06, { 0x00002C36,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C07, { 0x00002C37,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C08, { 0x00002C38,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C09, { 0x00002C39,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0A, { 0x00002C3A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0B, { 0x00002C3B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0C, { 0x00002C3C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0D, { 0x00002C3D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0E, { 0x00002C3E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C0F, { 0x00002C3F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C10, { 0x00002C40,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C11, { 0x00002C41,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C12, { 0x00002C42,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C13, { 0x00002C43,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C14, { 0x00002C44,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C15, { 0x00002C45,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C16, { 0x00002C46,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C17, { 0x00002C47,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C18, { 0x00002C48,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C19, { 0x00002C49,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1A, { 0x00002C4A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1B, { 0x00002C4B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1C, { 0x00002C4C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1D, { 0x00002C4D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1E, { 0x00002C4E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C1F, { 0x00002C4F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C20, { 0x00002C50,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C21, { 0x00002C51,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C22, { 0x00002C52,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C23, { 0x00002C53,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C24, { 0x00002C54,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C25, { 0x00002C55,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C26, { 0x00002C56,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C27, { 0x00002C57,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C28, { 0x00002C58,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C29, { 0x00002C59,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C2A, { 0x00002C5A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C2B, { 0x00002C5B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C2C, { 0x00002C5C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C2D, { 0x00002C5D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C2E, { 0x00002C5E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C60, { 0x00002C61,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C62, { 0x0000026B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C63, { 0x00001D7D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C64, { 0x0000027D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C67, { 0x00002C68,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C69, { 0x00002C6A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C6B, { 0x00002C6C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C6D, { 0x00000251,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C6E, { 0x00000271,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C6F, { 0x00000250,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C70, { 0x00000252,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C72, { 0x00002C73,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C75, { 0x00002C76,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C7E, { 0x0000023F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C7F, { 0x00000240,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C80, { 0x00002C81,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C81, { 0x00010CC1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C82, { 0x00010CC2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C83, { 0x00010CC3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C84, { 0x00010CC4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C85, { 0x00010CC5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C86, { 0x00010CC6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C87, { 0x00010CC7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C88, { 0x00010CC8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C89, { 0x00010CC9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8A, { 0x00010CCA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8B, { 0x00010CCB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C8C, { 0x00002C8D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8D, { 0x00010CCD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C8E, { 0x00002C8F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C8F, { 0x00010CCF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C90, { 0x00010CD0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C91, { 0x00010CD1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C92, { 0x00010CD2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C93, { 0x00010CD3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C94, { 0x00010CD4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C95, { 0x00010CD5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C96, { 0x00002C97,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C97, { 0x00010CD7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C98, { 0x00002C99,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C99, { 0x00010CD9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C9A, { 0x00002C9B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9B, { 0x00010CDB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C9C, { 0x00002C9D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9D, { 0x00010CDD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002C9E, { 0x00002C9F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010C9F, { 0x00010CDF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CA0, { 0x00002CA1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA1, { 0x00010CE1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CA2, { 0x00002CA3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA3, { 0x00010CE3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CA4, { 0x00002CA5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA5, { 0x00010CE5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CA6, { 0x00002CA7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA7, { 0x00010CE7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CA8, { 0x00002CA9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CA9, { 0x00010CE9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CAA, { 0x00002CAB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAB, { 0x00010CEB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CAC, { 0x00002CAD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAD, { 0x00010CED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CAE, { 0x00002CAF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAF, { 0x00010CEF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CB0, { 0x00002CB1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CB1, { 0x00010CF1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CB2, { 0x00002CB3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CB4, { 0x00002CB5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CB6, { 0x00002CB7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CB8, { 0x00002CB9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CBA, { 0x00002CBB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CBC, { 0x00002CBD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CBE, { 0x00002CBF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CC0, { 0x00002CC1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CC2, { 0x00002CC3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CC4, { 0x00002CC5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CC6, { 0x00002CC7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CC8, { 0x00002CC9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CCA, { 0x00002CCB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CCC, { 0x00002CCD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CCE, { 0x00002CCF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CD0, { 0x00002CD1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CD2, { 0x00002CD3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CD4, { 0x00002CD5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CD6, { 0x00002CD7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CD8, { 0x00002CD9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CDA, { 0x00002CDB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CDC, { 0x00002CDD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CDE, { 0x00002CDF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CE0, { 0x00002CE1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CE2, { 0x00002CE3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CEB, { 0x00002CEC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CED, { 0x00002CEE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00002CF2, { 0x00002CF3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E40, { 0x00016E60,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E41, { 0x00016E61,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E42, { 0x00016E62,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E43, { 0x00016E63,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E44, { 0x00016E64,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E45, { 0x00016E65,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E46, { 0x00016E66,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E47, { 0x00016E67,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E48, { 0x00016E68,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E49, { 0x00016E69,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4A, { 0x00016E6A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4B, { 0x00016E6B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4C, { 0x00016E6C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4D, { 0x00016E6D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4E, { 0x00016E6E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E4F, { 0x00016E6F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E50, { 0x00016E70,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E51, { 0x00016E71,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E52, { 0x00016E72,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E53, { 0x00016E73,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E54, { 0x00016E74,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E55, { 0x00016E75,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E56, { 0x00016E76,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E57, { 0x00016E77,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E58, { 0x00016E78,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E59, { 0x00016E79,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5A, { 0x00016E7A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5B, { 0x00016E7B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5C, { 0x00016E7C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5D, { 0x00016E7D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5E, { 0x00016E7E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00016E5F, { 0x00016E7F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004BE, { 0x000004BF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024B6, { 0x000024D0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C0, { 0x000004CF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024B8, { 0x000024D2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C1, { 0x000004C2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BA, { 0x000024D4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C3, { 0x000004C4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C5, { 0x000004C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2E, { 0x0000FF4E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C0, { 0x000024DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C9, { 0x000004CA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004CB, { 0x000004CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C4, { 0x000024DE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C5, { 0x000024DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C6, { 0x000024E0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A0, { 0x00002D00,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A1, { 0x00002D01,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A2, { 0x00002D02,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A3, { 0x00002D03,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A4, { 0x00002D04,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A5, { 0x00002D05,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A6, { 0x00002D06,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A7, { 0x00002D07,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A8, { 0x00002D08,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010A9, { 0x00002D09,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AA, { 0x00002D0A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AB, { 0x00002D0B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AC, { 0x00002D0C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AD, { 0x00002D0D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AE, { 0x00002D0E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010AF, { 0x00002D0F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B0, { 0x00002D10,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B1, { 0x00002D11,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B2, { 0x00002D12,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B3, { 0x00002D13,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B4, { 0x00002D14,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B5, { 0x00002D15,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B6, { 0x00002D16,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B7, { 0x00002D17,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B8, { 0x00002D18,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010B9, { 0x00002D19,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BA, { 0x00002D1A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BB, { 0x00002D1B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BC, { 0x00002D1C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BD, { 0x00002D1D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BE, { 0x00002D1E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010BF, { 0x00002D1F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C0, { 0x00002D20,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C1, { 0x00002D21,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C2, { 0x00002D22,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C3, { 0x00002D23,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C4, { 0x00002D24,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C5, { 0x00002D25,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010C7, { 0x00002D27,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000010CD, { 0x00002D2D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CD, { 0x000024E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A3, { 0x000118C3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A9, { 0x000118C9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013F8, { 0x000013F0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013F9, { 0x000013F1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013FA, { 0x000013F2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013FB, { 0x000013F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013FC, { 0x000013F4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000013FD, { 0x000013F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AF, { 0x000118CF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B5, { 0x000118D5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BB, { 0x000118DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BC, { 0x000104E4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C3, { 0x000104EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C7, { 0x000104EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C8, { 0x000104F0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104C9, { 0x000104F1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104CA, { 0x000104F2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000400, { 0x00000450,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010401, { 0x00010429,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000402, { 0x00000452,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000403, { 0x00000453,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000404, { 0x00000454,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000405, { 0x00000455,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000406, { 0x00000456,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000407, { 0x00000457,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010408, { 0x00010430,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000409, { 0x00000459,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040A, { 0x0000045A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040B, { 0x0000045B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040C, { 0x0000045C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040D, { 0x00010435,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001040E, { 0x00010436,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000040F, { 0x0000045F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000410, { 0x00000430,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010411, { 0x00010439,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000412, { 0x00000432,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000413, { 0x00000433,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000414, { 0x00000434,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000415, { 0x00000435,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010416, { 0x0001043E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000417, { 0x00000437,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010418, { 0x00010440,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010419, { 0x00010441,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041A, { 0x0000043A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A0, { 0x000118C0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A1, { 0x000118C1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A2, { 0x000118C2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0001041B, { 0x00010443,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A4, { 0x000118C4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A5, { 0x000118C5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A6, { 0x000118C6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A7, { 0x000118C7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118A8, { 0x000118C8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041C, { 0x0000043C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AA, { 0x000118CA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AB, { 0x000118CB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AC, { 0x000118CC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AD, { 0x000118CD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118AE, { 0x000118CE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041D, { 0x0000043D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B0, { 0x000118D0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B1, { 0x000118D1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B2, { 0x000118D2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B3, { 0x000118D3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B4, { 0x000118D4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041E, { 0x0000043E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B6, { 0x000118D6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B7, { 0x000118D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B8, { 0x000118D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118B9, { 0x000118D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BA, { 0x000118DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000041F, { 0x0000043F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BC, { 0x000118DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BD, { 0x000118DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BE, { 0x000118DE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000118BF, { 0x000118DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00000420, { 0x00000440,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010421, { 0x00010449,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010422, { 0x0001044A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010423, { 0x0001044B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010424, { 0x0001044C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010425, { 0x0001044D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010426, { 0x0001044E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010427, { 0x0001044F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CAE, { 0x00010CEE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00010CB2, { 0x00010CF2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F28, { 0x00001F20,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F29, { 0x00001F21,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F2A, { 0x00001F22,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FB00, { 0x00000000,  0x00000000, U"\U00000066\U00000066", 0x00000000 } },
-{ 0x0000FB01, { 0x00000000,  0x00000000, U"\U00000066\U00000069", 0x00000000 } },
-{ 0x0000FB02, { 0x00000000,  0x00000000, U"\U00000066\U0000006C", 0x00000000 } },
-{ 0x0000FB03, { 0x00000000,  0x00000000, U"\U00000066\U00000066\U00000069", 0x00000000 } },
-{ 0x0000FB04, { 0x00000000,  0x00000000, U"\U00000066\U00000066\U0000006C", 0x00000000 } },
-{ 0x0000FB05, { 0x00000000,  0x00000000, U"\U00000073\U00000074", 0x00000000 } },
-{ 0x0000FB06, { 0x00000000,  0x00000000, U"\U00000073\U00000074", 0x00000000 } },
-{ 0x00001F2C, { 0x00001F24,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2D, { 0x0000FF4D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FB13, { 0x00000000,  0x00000000, U"\U00000574\U00000576", 0x00000000 } },
-{ 0x0000FB14, { 0x00000000,  0x00000000, U"\U00000574\U00000565", 0x00000000 } },
-{ 0x0000FB15, { 0x00000000,  0x00000000, U"\U00000574\U0000056B", 0x00000000 } },
-{ 0x0000FB16, { 0x00000000,  0x00000000, U"\U0000057E\U00000576", 0x00000000 } },
-{ 0x0000FB17, { 0x00000000,  0x00000000, U"\U00000574\U0000056D", 0x00000000 } },
-{ 0x00001F2F, { 0x00001F27,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F38, { 0x00001F30,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F39, { 0x00001F31,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3A, { 0x00001F32,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004B0, { 0x000004B1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B2, { 0x000104DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004B4, { 0x000004B5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004B6, { 0x000004B7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104B7, { 0x000104DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004B8, { 0x000004B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024B9, { 0x000024D3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004BA, { 0x000004BB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BB, { 0x000024D5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004BC, { 0x000004BD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BD, { 0x000024D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000104BE, { 0x000104E6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024BF, { 0x000024D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C80, { 0x00000432,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C81, { 0x00000434,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C82, { 0x0000043E,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C83, { 0x00000441,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C84, { 0x00000442,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C85, { 0x00000442,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C86, { 0x0000044A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C1, { 0x000024DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C88, { 0x0000A64B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024C2, { 0x000024DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C90, { 0x000010D0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C91, { 0x000010D1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C92, { 0x000010D2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C93, { 0x000010D3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C94, { 0x000010D4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C95, { 0x000010D5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C96, { 0x000010D6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C97, { 0x000010D7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C98, { 0x000010D8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C99, { 0x000010D9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9A, { 0x000010DA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9B, { 0x000010DB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9C, { 0x000010DC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9D, { 0x000010DD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9E, { 0x000010DE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001C9F, { 0x000010DF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA0, { 0x000010E0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA1, { 0x000010E1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA2, { 0x000010E2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA3, { 0x000010E3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA4, { 0x000010E4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA5, { 0x000010E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA6, { 0x000010E6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA7, { 0x000010E7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA8, { 0x000010E8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CA9, { 0x000010E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAA, { 0x000010EA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004C7, { 0x000004C8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAC, { 0x000010EC,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAD, { 0x000010ED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAE, { 0x000010EE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAF, { 0x000010EF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB0, { 0x000010F0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB1, { 0x000010F1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB2, { 0x000010F2,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB3, { 0x000010F3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB4, { 0x000010F4,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB5, { 0x000010F5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB6, { 0x000010F6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB7, { 0x000010F7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB8, { 0x000010F8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CB9, { 0x000010F9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CBA, { 0x000010FA,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CBD, { 0x000010FD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CBE, { 0x000010FE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CBF, { 0x000010FF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CB, { 0x000024E5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CC, { 0x000024E6,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004CD, { 0x000004CE,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CE, { 0x000024E8,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000024CF, { 0x000024E9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004D0, { 0x000004D1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x000004D2, { 0x000004D3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001CAB, { 0x000010EB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E00, { 0x00001E01,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E02, { 0x00001E03,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E04, { 0x00001E05,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E06, { 0x00001E07,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E08, { 0x00001E09,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E0A, { 0x00001E0B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E0C, { 0x00001E0D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E0E, { 0x00001E0F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E10, { 0x00001E11,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E12, { 0x00001E13,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E14, { 0x00001E15,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E16, { 0x00001E17,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E18, { 0x00001E19,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E1A, { 0x00001E1B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E1C, { 0x00001E1D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E1E, { 0x00001E1F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E20, { 0x00001E21,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E22, { 0x00001E23,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E24, { 0x00001E25,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E26, { 0x00001E27,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E28, { 0x00001E29,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E2A, { 0x00001E2B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E2C, { 0x00001E2D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E2E, { 0x00001E2F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E30, { 0x00001E31,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E32, { 0x00001E33,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E34, { 0x00001E35,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E36, { 0x00001E37,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E38, { 0x00001E39,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E3A, { 0x00001E3B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E3C, { 0x00001E3D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E3E, { 0x00001E3F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E40, { 0x00001E41,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E42, { 0x00001E43,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E44, { 0x00001E45,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E46, { 0x00001E47,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E48, { 0x00001E49,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E4A, { 0x00001E4B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E4C, { 0x00001E4D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E4E, { 0x00001E4F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E50, { 0x00001E51,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E52, { 0x00001E53,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E54, { 0x00001E55,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E56, { 0x00001E57,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E58, { 0x00001E59,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E5A, { 0x00001E5B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E5C, { 0x00001E5D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E5E, { 0x00001E5F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E60, { 0x00001E61,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E62, { 0x00001E63,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E64, { 0x00001E65,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E66, { 0x00001E67,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E68, { 0x00001E69,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E6A, { 0x00001E6B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E6C, { 0x00001E6D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E6E, { 0x00001E6F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E70, { 0x00001E71,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E72, { 0x00001E73,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E74, { 0x00001E75,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E76, { 0x00001E77,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E78, { 0x00001E79,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E7A, { 0x00001E7B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E7C, { 0x00001E7D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E7E, { 0x00001E7F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E80, { 0x00001E81,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E82, { 0x00001E83,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E84, { 0x00001E85,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E86, { 0x00001E87,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E88, { 0x00001E89,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E8A, { 0x00001E8B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E8C, { 0x00001E8D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E8E, { 0x00001E8F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E90, { 0x00001E91,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E92, { 0x00001E93,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E94, { 0x00001E95,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E96, { 0x00000000,  0x00000000, U"\U00000068\U00000331", 0x00000000 } },
-{ 0x00001E97, { 0x00000000,  0x00000000, U"\U00000074\U00000308", 0x00000000 } },
-{ 0x00001E98, { 0x00000000,  0x00000000, U"\U00000077\U0000030A", 0x00000000 } },
-{ 0x00001E99, { 0x00000000,  0x00000000, U"\U00000079\U0000030A", 0x00000000 } },
-{ 0x00001E9A, { 0x00000000,  0x00000000, U"\U00000061\U000002BE", 0x00000000 } },
-{ 0x00001E9B, { 0x00001E61,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001E9E, { 0x00000000,  0x000000DF, U"\U00000073\U00000073", 0x00000000 } },
-{ 0x00001EA0, { 0x00001EA1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EA2, { 0x00001EA3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EA4, { 0x00001EA5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EA6, { 0x00001EA7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EA8, { 0x00001EA9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EAA, { 0x00001EAB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EAC, { 0x00001EAD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EAE, { 0x00001EAF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EB0, { 0x00001EB1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EB2, { 0x00001EB3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EB4, { 0x00001EB5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EB6, { 0x00001EB7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EB8, { 0x00001EB9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EBA, { 0x00001EBB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EBC, { 0x00001EBD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EBE, { 0x00001EBF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EC0, { 0x00001EC1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EC2, { 0x00001EC3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EC4, { 0x00001EC5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EC6, { 0x00001EC7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EC8, { 0x00001EC9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ECA, { 0x00001ECB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ECC, { 0x00001ECD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ECE, { 0x00001ECF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ED0, { 0x00001ED1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ED2, { 0x00001ED3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ED4, { 0x00001ED5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ED6, { 0x00001ED7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001ED8, { 0x00001ED9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EDA, { 0x00001EDB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EDC, { 0x00001EDD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EDE, { 0x00001EDF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EE0, { 0x00001EE1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EE2, { 0x00001EE3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EE4, { 0x00001EE5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EE6, { 0x00001EE7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EE8, { 0x00001EE9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EEA, { 0x00001EEB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EEC, { 0x00001EED,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EEE, { 0x00001EEF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EF0, { 0x00001EF1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EF2, { 0x00001EF3,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EF4, { 0x00001EF5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EF6, { 0x00001EF7,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EF8, { 0x00001EF9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EFA, { 0x00001EFB,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EFC, { 0x00001EFD,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001EFE, { 0x00001EFF,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F08, { 0x00001F00,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F09, { 0x00001F01,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0A, { 0x00001F02,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0B, { 0x00001F03,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0C, { 0x00001F04,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0D, { 0x00001F05,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0E, { 0x00001F06,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F0F, { 0x00001F07,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F18, { 0x00001F10,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F19, { 0x00001F11,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F1A, { 0x00001F12,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F1B, { 0x00001F13,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F1C, { 0x00001F14,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F1D, { 0x00001F15,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF21, { 0x0000FF41,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF22, { 0x0000FF42,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF23, { 0x0000FF43,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF24, { 0x0000FF44,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF25, { 0x0000FF45,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF26, { 0x0000FF46,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF27, { 0x0000FF47,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF28, { 0x0000FF48,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF29, { 0x0000FF49,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2A, { 0x0000FF4A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2B, { 0x0000FF4B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2C, { 0x0000FF4C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F2D, { 0x00001F25,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F2E, { 0x00001F26,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF2F, { 0x0000FF4F,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF30, { 0x0000FF50,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF31, { 0x0000FF51,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF32, { 0x0000FF52,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF33, { 0x0000FF53,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF34, { 0x0000FF54,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF35, { 0x0000FF55,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF36, { 0x0000FF56,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF37, { 0x0000FF57,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF38, { 0x0000FF58,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF39, { 0x0000FF59,  0x00000000, nullptr, 0x00000000 } },
-{ 0x0000FF3A, { 0x0000FF5A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3B, { 0x00001F33,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3C, { 0x00001F34,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3D, { 0x00001F35,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3E, { 0x00001F36,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F3F, { 0x00001F37,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F48, { 0x00001F40,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F49, { 0x00001F41,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F4A, { 0x00001F42,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F4B, { 0x00001F43,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F4C, { 0x00001F44,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F4D, { 0x00001F45,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F50, { 0x00000000,  0x00000000, U"\U000003C5\U00000313", 0x00000000 } },
-{ 0x00001F52, { 0x00000000,  0x00000000, U"\U000003C5\U00000313\U00000300", 0x00000000 } },
-{ 0x00001F54, { 0x00000000,  0x00000000, U"\U000003C5\U00000313\U00000301", 0x00000000 } },
-{ 0x00001F56, { 0x00000000,  0x00000000, U"\U000003C5\U00000313\U00000342", 0x00000000 } },
-{ 0x00001F59, { 0x00001F51,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F5B, { 0x00001F53,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F5D, { 0x00001F55,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F5F, { 0x00001F57,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F68, { 0x00001F60,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F69, { 0x00001F61,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6A, { 0x00001F62,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6B, { 0x00001F63,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6C, { 0x00001F64,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6D, { 0x00001F65,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6E, { 0x00001F66,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F6F, { 0x00001F67,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001F80, { 0x00000000,  0x00000000, U"\U00001F00\U000003B9", 0x00000000 } },
-{ 0x00001F81, { 0x00000000,  0x00000000, U"\U00001F01\U000003B9", 0x00000000 } },
-{ 0x00001F82, { 0x00000000,  0x00000000, U"\U00001F02\U000003B9", 0x00000000 } },
-{ 0x00001F83, { 0x00000000,  0x00000000, U"\U00001F03\U000003B9", 0x00000000 } },
-{ 0x00001F84, { 0x00000000,  0x00000000, U"\U00001F04\U000003B9", 0x00000000 } },
-{ 0x00001F85, { 0x00000000,  0x00000000, U"\U00001F05\U000003B9", 0x00000000 } },
-{ 0x00001F86, { 0x00000000,  0x00000000, U"\U00001F06\U000003B9", 0x00000000 } },
-{ 0x00001F87, { 0x00000000,  0x00000000, U"\U00001F07\U000003B9", 0x00000000 } },
-{ 0x00001F88, { 0x00000000,  0x00001F80, U"\U00001F00\U000003B9", 0x00000000 } },
-{ 0x00001F89, { 0x00000000,  0x00001F81, U"\U00001F01\U000003B9", 0x00000000 } },
-{ 0x00001F8A, { 0x00000000,  0x00001F82, U"\U00001F02\U000003B9", 0x00000000 } },
-{ 0x00001F8B, { 0x00000000,  0x00001F83, U"\U00001F03\U000003B9", 0x00000000 } },
-{ 0x00001F8C, { 0x00000000,  0x00001F84, U"\U00001F04\U000003B9", 0x00000000 } },
-{ 0x00001F8D, { 0x00000000,  0x00001F85, U"\U00001F05\U000003B9", 0x00000000 } },
-{ 0x00001F8E, { 0x00000000,  0x00001F86, U"\U00001F06\U000003B9", 0x00000000 } },
-{ 0x00001F8F, { 0x00000000,  0x00001F87, U"\U00001F07\U000003B9", 0x00000000 } },
-{ 0x00001F90, { 0x00000000,  0x00000000, U"\U00001F20\U000003B9", 0x00000000 } },
-{ 0x00001F91, { 0x00000000,  0x00000000, U"\U00001F21\U000003B9", 0x00000000 } },
-{ 0x00001F92, { 0x00000000,  0x00000000, U"\U00001F22\U000003B9", 0x00000000 } },
-{ 0x00001F93, { 0x00000000,  0x00000000, U"\U00001F23\U000003B9", 0x00000000 } },
-{ 0x00001F94, { 0x00000000,  0x00000000, U"\U00001F24\U000003B9", 0x00000000 } },
-{ 0x00001F95, { 0x00000000,  0x00000000, U"\U00001F25\U000003B9", 0x00000000 } },
-{ 0x00001F96, { 0x00000000,  0x00000000, U"\U00001F26\U000003B9", 0x00000000 } },
-{ 0x00001F97, { 0x00000000,  0x00000000, U"\U00001F27\U000003B9", 0x00000000 } },
-{ 0x00001F98, { 0x00000000,  0x00001F90, U"\U00001F20\U000003B9", 0x00000000 } },
-{ 0x00001F99, { 0x00000000,  0x00001F91, U"\U00001F21\U000003B9", 0x00000000 } },
-{ 0x00001F9A, { 0x00000000,  0x00001F92, U"\U00001F22\U000003B9", 0x00000000 } },
-{ 0x00001F9B, { 0x00000000,  0x00001F93, U"\U00001F23\U000003B9", 0x00000000 } },
-{ 0x00001F9C, { 0x00000000,  0x00001F94, U"\U00001F24\U000003B9", 0x00000000 } },
-{ 0x00001F9D, { 0x00000000,  0x00001F95, U"\U00001F25\U000003B9", 0x00000000 } },
-{ 0x00001F9E, { 0x00000000,  0x00001F96, U"\U00001F26\U000003B9", 0x00000000 } },
-{ 0x00001F9F, { 0x00000000,  0x00001F97, U"\U00001F27\U000003B9", 0x00000000 } },
-{ 0x00001FA0, { 0x00000000,  0x00000000, U"\U00001F60\U000003B9", 0x00000000 } },
-{ 0x00001FA1, { 0x00000000,  0x00000000, U"\U00001F61\U000003B9", 0x00000000 } },
-{ 0x00001FA2, { 0x00000000,  0x00000000, U"\U00001F62\U000003B9", 0x00000000 } },
-{ 0x00001FA3, { 0x00000000,  0x00000000, U"\U00001F63\U000003B9", 0x00000000 } },
-{ 0x00001FA4, { 0x00000000,  0x00000000, U"\U00001F64\U000003B9", 0x00000000 } },
-{ 0x00001FA5, { 0x00000000,  0x00000000, U"\U00001F65\U000003B9", 0x00000000 } },
-{ 0x00001FA6, { 0x00000000,  0x00000000, U"\U00001F66\U000003B9", 0x00000000 } },
-{ 0x00001FA7, { 0x00000000,  0x00000000, U"\U00001F67\U000003B9", 0x00000000 } },
-{ 0x00001FA8, { 0x00000000,  0x00001FA0, U"\U00001F60\U000003B9", 0x00000000 } },
-{ 0x00001FA9, { 0x00000000,  0x00001FA1, U"\U00001F61\U000003B9", 0x00000000 } },
-{ 0x00001FAA, { 0x00000000,  0x00001FA2, U"\U00001F62\U000003B9", 0x00000000 } },
-{ 0x00001FAB, { 0x00000000,  0x00001FA3, U"\U00001F63\U000003B9", 0x00000000 } },
-{ 0x00001FAC, { 0x00000000,  0x00001FA4, U"\U00001F64\U000003B9", 0x00000000 } },
-{ 0x00001FAD, { 0x00000000,  0x00001FA5, U"\U00001F65\U000003B9", 0x00000000 } },
-{ 0x00001FAE, { 0x00000000,  0x00001FA6, U"\U00001F66\U000003B9", 0x00000000 } },
-{ 0x00001FAF, { 0x00000000,  0x00001FA7, U"\U00001F67\U000003B9", 0x00000000 } },
-{ 0x00001FB2, { 0x00000000,  0x00000000, U"\U00001F70\U000003B9", 0x00000000 } },
-{ 0x00001FB3, { 0x00000000,  0x00000000, U"\U000003B1\U000003B9", 0x00000000 } },
-{ 0x00001FB4, { 0x00000000,  0x00000000, U"\U000003AC\U000003B9", 0x00000000 } },
-{ 0x00001FB6, { 0x00000000,  0x00000000, U"\U000003B1\U00000342", 0x00000000 } },
-{ 0x00001FB7, { 0x00000000,  0x00000000, U"\U000003B1\U00000342\U000003B9", 0x00000000 } },
-{ 0x00001FB8, { 0x00001FB0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FB9, { 0x00001FB1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FBA, { 0x00001F70,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FBB, { 0x00001F71,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FBC, { 0x00000000,  0x00001FB3, U"\U000003B1\U000003B9", 0x00000000 } },
-{ 0x00001FBE, { 0x000003B9,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FC2, { 0x00000000,  0x00000000, U"\U00001F74\U000003B9", 0x00000000 } },
-{ 0x00001FC3, { 0x00000000,  0x00000000, U"\U000003B7\U000003B9", 0x00000000 } },
-{ 0x00001FC4, { 0x00000000,  0x00000000, U"\U000003AE\U000003B9", 0x00000000 } },
-{ 0x00001FC6, { 0x00000000,  0x00000000, U"\U000003B7\U00000342", 0x00000000 } },
-{ 0x00001FC7, { 0x00000000,  0x00000000, U"\U000003B7\U00000342\U000003B9", 0x00000000 } },
-{ 0x00001FC8, { 0x00001F72,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FC9, { 0x00001F73,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FCA, { 0x00001F74,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FCB, { 0x00001F75,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FCC, { 0x00000000,  0x00001FC3, U"\U000003B7\U000003B9", 0x00000000 } },
-{ 0x00001FD2, { 0x00000000,  0x00000000, U"\U000003B9\U00000308\U00000300", 0x00000000 } },
-{ 0x00001FD3, { 0x00000000,  0x00000000, U"\U000003B9\U00000308\U00000301", 0x00000000 } },
-{ 0x00001FD6, { 0x00000000,  0x00000000, U"\U000003B9\U00000342", 0x00000000 } },
-{ 0x00001FD7, { 0x00000000,  0x00000000, U"\U000003B9\U00000308\U00000342", 0x00000000 } },
-{ 0x00001FD8, { 0x00001FD0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FD9, { 0x00001FD1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FDA, { 0x00001F76,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FDB, { 0x00001F77,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FE2, { 0x00000000,  0x00000000, U"\U000003C5\U00000308\U00000300", 0x00000000 } },
-{ 0x00001FE3, { 0x00000000,  0x00000000, U"\U000003C5\U00000308\U00000301", 0x00000000 } },
-{ 0x00001FE4, { 0x00000000,  0x00000000, U"\U000003C1\U00000313", 0x00000000 } },
-{ 0x00001FE6, { 0x00000000,  0x00000000, U"\U000003C5\U00000342", 0x00000000 } },
-{ 0x00001FE7, { 0x00000000,  0x00000000, U"\U000003C5\U00000308\U00000342", 0x00000000 } },
-{ 0x00001FE8, { 0x00001FE0,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FE9, { 0x00001FE1,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FEA, { 0x00001F7A,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FEB, { 0x00001F7B,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FEC, { 0x00001FE5,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FF2, { 0x00000000,  0x00000000, U"\U00001F7C\U000003B9", 0x00000000 } },
-{ 0x00001FF3, { 0x00000000,  0x00000000, U"\U000003C9\U000003B9", 0x00000000 } },
-{ 0x00001FF4, { 0x00000000,  0x00000000, U"\U000003CE\U000003B9", 0x00000000 } },
-{ 0x00001FF6, { 0x00000000,  0x00000000, U"\U000003C9\U00000342", 0x00000000 } },
-{ 0x00001FF7, { 0x00000000,  0x00000000, U"\U000003C9\U00000342\U000003B9", 0x00000000 } },
-{ 0x00001FF8, { 0x00001F78,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FF9, { 0x00001F79,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FFA, { 0x00001F7C,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FFB, { 0x00001F7D,  0x00000000, nullptr, 0x00000000 } },
-{ 0x00001FFC, { 0x00000000,  0x00001FF3, U"\U000003C9\U000003B9", 0x00000000 } },
+const char32_t _case_folding_pool[] = {
+0x00000000, 0x00000073, 0x00000073, 0x00000000, 0x00000069, 0x00000307,
+0x00000000, 0x000002BC, 0x0000006E, 0x00000000, 0x0000006A, 0x0000030C,
+0x00000000, 0x000003B9, 0x00000308, 0x00000301, 0x00000000, 0x000003C5,
+0x00000308, 0x00000301, 0x00000000, 0x00000565, 0x00000582, 0x00000000,
+0x00000068, 0x00000331, 0x00000000, 0x00000074, 0x00000308, 0x00000000,
+0x00000077, 0x0000030A, 0x00000000, 0x00000079, 0x0000030A, 0x00000000,
+0x00000061, 0x000002BE, 0x00000000, 0x00000073, 0x00000073, 0x00000000,
+0x000003C5, 0x00000313, 0x00000000, 0x000003C5, 0x00000313, 0x00000300,
+0x00000000, 0x000003C5, 0x00000313, 0x00000301, 0x00000000, 0x000003C5,
+0x00000313, 0x00000342, 0x00000000, 0x00001F00, 0x000003B9, 0x00000000,
+0x00001F01, 0x000003B9, 0x00000000, 0x00001F02, 0x000003B9, 0x00000000,
+0x00001F03, 0x000003B9, 0x00000000, 0x00001F04, 0x000003B9, 0x00000000,
+0x00001F05, 0x000003B9, 0x00000000, 0x00001F06, 0x000003B9, 0x00000000,
+0x00001F07, 0x000003B9, 0x00000000, 0x00001F00, 0x000003B9, 0x00000000,
+0x00001F01, 0x000003B9, 0x00000000, 0x00001F02, 0x000003B9, 0x00000000,
+0x00001F03, 0x000003B9, 0x00000000, 0x00001F04, 0x000003B9, 0x00000000,
+0x00001F05, 0x000003B9, 0x00000000, 0x00001F06, 0x000003B9, 0x00000000,
+0x00001F07, 0x000003B9, 0x00000000, 0x00001F20, 0x000003B9, 0x00000000,
+0x00001F21, 0x000003B9, 0x00000000, 0x00001F22, 0x000003B9, 0x00000000,
+0x00001F23, 0x000003B9, 0x00000000, 0x00001F24, 0x000003B9, 0x00000000,
+0x00001F25, 0x000003B9, 0x00000000, 0x00001F26, 0x000003B9, 0x00000000,
+0x00001F27, 0x000003B9, 0x00000000, 0x00001F20, 0x000003B9, 0x00000000,
+0x00001F21, 0x000003B9, 0x00000000, 0x00001F22, 0x000003B9, 0x00000000,
+0x00001F23, 0x000003B9, 0x00000000, 0x00001F24, 0x000003B9, 0x00000000,
+0x00001F25, 0x000003B9, 0x00000000, 0x00001F26, 0x000003B9, 0x00000000,
+0x00001F27, 0x000003B9, 0x00000000, 0x00001F60, 0x000003B9, 0x00000000,
+0x00001F61, 0x000003B9, 0x00000000, 0x00001F62, 0x000003B9, 0x00000000,
+0x00001F63, 0x000003B9, 0x00000000, 0x00001F64, 0x000003B9, 0x00000000,
+0x00001F65, 0x000003B9, 0x00000000, 0x00001F66, 0x000003B9, 0x00000000,
+0x00001F67, 0x000003B9, 0x00000000, 0x00001F60, 0x000003B9, 0x00000000,
+0x00001F61, 0x000003B9, 0x00000000, 0x00001F62, 0x000003B9, 0x00000000,
+0x00001F63, 0x000003B9, 0x00000000, 0x00001F64, 0x000003B9, 0x00000000,
+0x00001F65, 0x000003B9, 0x00000000, 0x00001F66, 0x000003B9, 0x00000000,
+0x00001F67, 0x000003B9, 0x00000000, 0x00001F70, 0x000003B9, 0x00000000,
+0x000003B1, 0x000003B9, 0x00000000, 0x000003AC, 0x000003B9, 0x00000000,
+0x000003B1, 0x00000342, 0x00000000, 0x000003B1, 0x00000342, 0x000003B9,
+0x00000000, 0x000003B1, 0x000003B9, 0x00000000, 0x00001F74, 0x000003B9,
+0x00000000, 0x000003B7, 0x000003B9, 0x00000000, 0x000003AE, 0x000003B9,
+0x00000000, 0x000003B7, 0x00000342, 0x00000000, 0x000003B7, 0x00000342,
+0x000003B9, 0x00000000, 0x000003B7, 0x000003B9, 0x00000000, 0x000003B9,
+0x00000308, 0x00000300, 0x00000000, 0x000003B9, 0x00000308, 0x00000301,
+0x00000000, 0x000003B9, 0x00000342, 0x00000000, 0x000003B9, 0x00000308,
+0x00000342, 0x00000000, 0x000003C5, 0x00000308, 0x00000300, 0x00000000,
+0x000003C5, 0x00000308, 0x00000301, 0x00000000, 0x000003C1, 0x00000313,
+0x00000000, 0x000003C5, 0x00000342, 0x00000000, 0x000003C5, 0x00000308,
+0x00000342, 0x00000000, 0x00001F7C, 0x000003B9, 0x00000000, 0x000003C9,
+0x000003B9, 0x00000000, 0x000003CE, 0x000003B9, 0x00000000, 0x000003C9,
+0x00000342, 0x00000000, 0x000003C9, 0x00000342, 0x000003B9, 0x00000000,
+0x000003C9, 0x000003B9, 0x00000000, 0x00000066, 0x00000066, 0x00000000,
+0x00000066, 0x00000069, 0x00000000, 0x00000066, 0x0000006C, 0x00000000,
+0x00000066, 0x00000066, 0x00000069, 0x00000000, 0x00000066, 0x00000066,
+0x0000006C, 0x00000000, 0x00000073, 0x00000074, 0x00000000, 0x00000073,
+0x00000074, 0x00000000, 0x00000574, 0x00000576, 0x00000000, 0x00000574,
+0x00000565, 0x00000000, 0x00000574, 0x0000056B, 0x00000000, 0x0000057E,
+0x00000576, 0x00000000, 0x00000574, 0x0000056D, 0x00000000,
+};
+const CaseFolding _case_folding_values[] = {
+{ 0, 0x00000000 }, { 0, 0x00000131 }, { 1, 0x00000000 }, { 4, 0x00000069 },
+{ 7, 0x00000000 }, { 10, 0x00000000 }, { 13, 0x00000000 }, { 17, 0x00000000 },
+{ 21, 0x00000000 }, { 24, 0x00000000 }, { 27, 0x00000000 }, { 30, 0x00000000 },
+{ 33, 0x00000000 }, { 36, 0x00000000 }, { 39, 0x00000000 }, { 42, 0x00000000 },
+{ 45, 0x00000000 }, { 49, 0x00000000 }, { 53, 0x00000000 }, { 57, 0x00000000 },
+{ 60, 0x00000000 }, { 63, 0x00000000 }, { 66, 0x00000000 }, { 69, 0x00000000 },
+{ 72, 0x00000000 }, { 75, 0x00000000 }, { 78, 0x00000000 }, { 81, 0x00000000 },
+{ 84, 0x00000000 }, { 87, 0x00000000 }, { 90, 0x00000000 }, { 93, 0x00000000 },
+{ 96, 0x00000000 }, { 99, 0x00000000 }, { 102, 0x00000000 },
+{ 105, 0x00000000 }, { 108, 0x00000000 }, { 111, 0x00000000 },
+{ 114, 0x00000000 }, { 117, 0x00000000 }, { 120, 0x00000000 },
+{ 123, 0x00000000 }, { 126, 0x00000000 }, { 129, 0x00000000 },
+{ 132, 0x00000000 }, { 135, 0x00000000 }, { 138, 0x00000000 },
+{ 141, 0x00000000 }, { 144, 0x00000000 }, { 147, 0x00000000 },
+{ 150, 0x00000000 }, { 153, 0x00000000 }, { 156, 0x00000000 },
+{ 159, 0x00000000 }, { 162, 0x00000000 }, { 165, 0x00000000 },
+{ 168, 0x00000000 }, { 171, 0x00000000 }, { 174, 0x00000000 },
+{ 177, 0x00000000 }, { 180, 0x00000000 }, { 183, 0x00000000 },
+{ 186, 0x00000000 }, { 189, 0x00000000 }, { 192, 0x00000000 },
+{ 195, 0x00000000 }, { 198, 0x00000000 }, { 201, 0x00000000 },
+{ 204, 0x00000000 }, { 207, 0x00000000 }, { 210, 0x00000000 },
+{ 213, 0x00000000 }, { 217, 0x00000000 }, { 220, 0x00000000 },
+{ 223, 0x00000000 }, { 226, 0x00000000 }, { 229, 0x00000000 },
+{ 232, 0x00000000 }, { 236, 0x00000000 }, { 239, 0x00000000 },
+{ 243, 0x00000000 }, { 247, 0x00000000 }, { 250, 0x00000000 },
+{ 254, 0x00000000 }, { 258, 0x00000000 }, { 262, 0x00000000 },
+{ 265, 0x00000000 }, { 268, 0x00000000 }, { 272, 0x00000000 },
+{ 275, 0x00000000 }, { 278, 0x00000000 }, { 281, 0x00000000 },
+{ 284, 0x00000000 }, { 288, 0x00000000 }, { 291, 0x00000000 },
+{ 294, 0x00000000 }, { 297, 0x00000000 }, { 300, 0x00000000 },
+{ 304, 0x00000000 }, { 308, 0x00000000 }, { 311, 0x00000000 },
+{ 314, 0x00000000 }, { 317, 0x00000000 }, { 320, 0x00000000 },
+{ 323, 0x00000000 }, { 326, 0x00000000 },
+};
+const uint16_t _case_foldings_stage1[] = {
+0, 64, 128, 128, 128, 128, 128, 192, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 256, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+};
+const uint16_t _case_foldings_stage2[] = {
+0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 48, 64, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 96, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 160, 0, 0, 176, 192, 208, 224, 240, 256, 272, 288, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 320, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+const uint16_t _case_foldings_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 5,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 11, 12, 13, 0, 0, 0, 14, 0,
+15, 0, 16, 0, 17, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 21, 22, 23, 24, 25,
+26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+66, 0, 0, 67, 68, 69, 0, 70, 71, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 73, 74, 75, 0,
+76, 77, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 79, 80, 0, 0, 81, 82, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 83, 84, 85, 0, 86, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 89, 90, 0,
+91, 92, 0, 0, 0, 0, 93, 0, 0, 0, 94, 95, 96, 97, 98, 99, 100, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 101, 102, 103, 104, 105, 0, 0, 0, 0, 0, 0, 0, 0,
 };
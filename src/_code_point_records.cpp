@@ -0,0 +1,1299 @@
+static_assert(static_cast<int>(GraphemeBreak::Unassigned) == 0, "");
+static_assert(static_cast<int>(GraphemeBreak::Prepend) == 1, "");
+static_assert(static_cast<int>(GraphemeBreak::CR) == 2, "");
+static_assert(static_cast<int>(GraphemeBreak::LF) == 3, "");
+static_assert(static_cast<int>(GraphemeBreak::Control) == 4, "");
+static_assert(static_cast<int>(GraphemeBreak::Extend) == 5, "");
+static_assert(static_cast<int>(GraphemeBreak::Regional_Indicator) == 6, "");
+static_assert(static_cast<int>(GraphemeBreak::SpacingMark) == 7, "");
+static_assert(static_cast<int>(GraphemeBreak::L) == 8, "");
+static_assert(static_cast<int>(GraphemeBreak::V) == 9, "");
+static_assert(static_cast<int>(GraphemeBreak::T) == 10, "");
+static_assert(static_cast<int>(GraphemeBreak::LV) == 11, "");
+static_assert(static_cast<int>(GraphemeBreak::LVT) == 12, "");
+static_assert(static_cast<int>(GraphemeBreak::ZWJ) == 13, "");
+static_assert(static_cast<int>(WordBreak::Unassigned) == 0, "");
+static_assert(static_cast<int>(WordBreak::Double_Quote) == 1, "");
+static_assert(static_cast<int>(WordBreak::Single_Quote) == 2, "");
+static_assert(static_cast<int>(WordBreak::Hebrew_Letter) == 3, "");
+static_assert(static_cast<int>(WordBreak::CR) == 4, "");
+static_assert(static_cast<int>(WordBreak::LF) == 5, "");
+static_assert(static_cast<int>(WordBreak::Newline) == 6, "");
+static_assert(static_cast<int>(WordBreak::Extend) == 7, "");
+static_assert(static_cast<int>(WordBreak::Regional_Indicator) == 8, "");
+static_assert(static_cast<int>(WordBreak::Format) == 9, "");
+static_assert(static_cast<int>(WordBreak::Katakana) == 10, "");
+static_assert(static_cast<int>(WordBreak::ALetter) == 11, "");
+static_assert(static_cast<int>(WordBreak::MidLetter) == 12, "");
+static_assert(static_cast<int>(WordBreak::MidNum) == 13, "");
+static_assert(static_cast<int>(WordBreak::MidNumLet) == 14, "");
+static_assert(static_cast<int>(WordBreak::Numeric) == 15, "");
+static_assert(static_cast<int>(WordBreak::ExtendNumLet) == 16, "");
+static_assert(static_cast<int>(WordBreak::ZWJ) == 17, "");
+static_assert(static_cast<int>(WordBreak::WSegSpace) == 18, "");
+static_assert(static_cast<int>(SentenceBreak::Unassigned) == 0, "");
+static_assert(static_cast<int>(SentenceBreak::CR) == 1, "");
+static_assert(static_cast<int>(SentenceBreak::LF) == 2, "");
+static_assert(static_cast<int>(SentenceBreak::Extend) == 3, "");
+static_assert(static_cast<int>(SentenceBreak::Sep) == 4, "");
+static_assert(static_cast<int>(SentenceBreak::Format) == 5, "");
+static_assert(static_cast<int>(SentenceBreak::Sp) == 6, "");
+static_assert(static_cast<int>(SentenceBreak::Lower) == 7, "");
+static_assert(static_cast<int>(SentenceBreak::Upper) == 8, "");
+static_assert(static_cast<int>(SentenceBreak::OLetter) == 9, "");
+static_assert(static_cast<int>(SentenceBreak::Numeric) == 10, "");
+static_assert(static_cast<int>(SentenceBreak::ATerm) == 11, "");
+static_assert(static_cast<int>(SentenceBreak::STerm) == 12, "");
+static_assert(static_cast<int>(SentenceBreak::Close) == 13, "");
+static_assert(static_cast<int>(SentenceBreak::SContinue) == 14, "");
+const CodePointRecord _code_point_records[] = {
+{GeneralCategory::Cc, GraphemeBreak::Control, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Cc, GraphemeBreak::Control, WordBreak::Unassigned, SentenceBreak::Sp, 0, 0x00},
+{GeneralCategory::Cc, GraphemeBreak::LF, WordBreak::LF, SentenceBreak::LF, 0, 0x00},
+{GeneralCategory::Cc, GraphemeBreak::Control, WordBreak::Newline, SentenceBreak::Sp, 0, 0x00},
+{GeneralCategory::Cc, GraphemeBreak::CR, WordBreak::CR, SentenceBreak::CR, 0, 0x00},
+{GeneralCategory::Zs, GraphemeBreak::Unassigned, WordBreak::WSegSpace, SentenceBreak::Sp, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::STerm, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Double_Quote, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Sc, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Single_Quote, SentenceBreak::Close, 0, 0x04},
+{GeneralCategory::Ps, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Pe, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Sm, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNum, SentenceBreak::SContinue, 0, 0x00},
+{GeneralCategory::Pd, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::SContinue, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNumLet, SentenceBreak::ATerm, 0, 0x04},
+{GeneralCategory::Nd, GraphemeBreak::Unassigned, WordBreak::Numeric, SentenceBreak::Numeric, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidLetter, SentenceBreak::SContinue, 0, 0x04},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNum, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Lu, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xCA},
+{GeneralCategory::Sk, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x04},
+{GeneralCategory::Pc, GraphemeBreak::Unassigned, WordBreak::ExtendNumLet, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Ll, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0xB2},
+{GeneralCategory::Cc, GraphemeBreak::Control, WordBreak::Newline, SentenceBreak::Sep, 0, 0x00},
+{GeneralCategory::Zs, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Sp, 0, 0x00},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x01},
+{GeneralCategory::Lo, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0x02},
+{GeneralCategory::Pi, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Cf, GraphemeBreak::Control, WordBreak::Format, SentenceBreak::Format, 0, 0x04},
+{GeneralCategory::No, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Ll, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0xF2},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidLetter, SentenceBreak::Unassigned, 0, 0x04},
+{GeneralCategory::Pf, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Ll, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0x02},
+{GeneralCategory::Lo, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lu, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xEA},
+{GeneralCategory::Lt, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xDA},
+{GeneralCategory::Lm, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0x06},
+{GeneralCategory::Lm, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x04},
+{GeneralCategory::Sk, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Unassigned, 0, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 230, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 232, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 220, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 216, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 202, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 1, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 240, 0xF6},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 0, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 233, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 234, 0x04},
+{GeneralCategory::Cn, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Lu, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0x02},
+{GeneralCategory::Me, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 0, 0x04},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::SContinue, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNum, SentenceBreak::STerm, 0, 0x00},
+{GeneralCategory::Pd, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 222, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 228, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 10, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 11, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 12, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 13, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 14, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 15, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 16, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 17, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 18, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 19, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 20, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 21, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 22, 0x04},
+{GeneralCategory::Pd, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 23, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 24, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 25, 0x04},
+{GeneralCategory::Lo, GraphemeBreak::Unassigned, WordBreak::Hebrew_Letter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Cf, GraphemeBreak::Prepend, WordBreak::Format, SentenceBreak::Format, 0, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 30, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 31, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 32, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 27, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 28, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 29, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 33, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 34, 0x04},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Numeric, SentenceBreak::Numeric, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNum, SentenceBreak::Numeric, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 35, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 36, 0x04},
+{GeneralCategory::Mc, GraphemeBreak::SpacingMark, WordBreak::Extend, SentenceBreak::Extend, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 7, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 9, 0x04},
+{GeneralCategory::Mc, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 84, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 91, 0x04},
+{GeneralCategory::Lo, GraphemeBreak::Prepend, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::SpacingMark, WordBreak::Unassigned, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 103, 0x04},
+{GeneralCategory::Lm, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::OLetter, 0, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 107, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 118, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 122, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 129, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 130, 0x04},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 132, 0x04},
+{GeneralCategory::Mc, GraphemeBreak::Unassigned, WordBreak::Extend, SentenceBreak::Extend, 0, 0x00},
+{GeneralCategory::Ll, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x92},
+{GeneralCategory::Lo, GraphemeBreak::L, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::V, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::T, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lu, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0x8A},
+{GeneralCategory::Nl, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Mc, GraphemeBreak::SpacingMark, WordBreak::Extend, SentenceBreak::Extend, 9, 0x00},
+{GeneralCategory::Lu, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0xCA},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 214, 0x04},
+{GeneralCategory::Cf, GraphemeBreak::Control, WordBreak::Unassigned, SentenceBreak::Format, 0, 0x04},
+{GeneralCategory::Cf, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 0, 0x04},
+{GeneralCategory::Cf, GraphemeBreak::ZWJ, WordBreak::ZWJ, SentenceBreak::Extend, 0, 0x04},
+{GeneralCategory::Pi, GraphemeBreak::Unassigned, WordBreak::MidNumLet, SentenceBreak::Close, 0, 0x04},
+{GeneralCategory::Pf, GraphemeBreak::Unassigned, WordBreak::MidNumLet, SentenceBreak::Close, 0, 0x04},
+{GeneralCategory::Zl, GraphemeBreak::Control, WordBreak::Newline, SentenceBreak::Sep, 0, 0x00},
+{GeneralCategory::Zp, GraphemeBreak::Control, WordBreak::Newline, SentenceBreak::Sep, 0, 0x00},
+{GeneralCategory::Zs, GraphemeBreak::Unassigned, WordBreak::ExtendNumLet, SentenceBreak::Sp, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::STerm, 0, 0x01},
+{GeneralCategory::Sm, GraphemeBreak::Unassigned, WordBreak::MidNum, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Cn, GraphemeBreak::Control, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Ll, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0x03},
+{GeneralCategory::Nl, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xCA},
+{GeneralCategory::Nl, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0xB2},
+{GeneralCategory::Sm, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x01},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xCA},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0xCB},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Lower, 0, 0xB2},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Close, 0, 0x00},
+{GeneralCategory::Nl, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 218, 0x04},
+{GeneralCategory::Mc, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 224, 0x00},
+{GeneralCategory::Pd, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x01},
+{GeneralCategory::Lm, GraphemeBreak::Unassigned, WordBreak::Katakana, SentenceBreak::OLetter, 0, 0x04},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x01},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 8, 0x04},
+{GeneralCategory::Sk, GraphemeBreak::Unassigned, WordBreak::Katakana, SentenceBreak::Unassigned, 0, 0x04},
+{GeneralCategory::Pd, GraphemeBreak::Unassigned, WordBreak::Katakana, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::Unassigned, WordBreak::Katakana, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::Katakana, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::LV, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Lo, GraphemeBreak::LVT, WordBreak::ALetter, SentenceBreak::OLetter, 0, 0x00},
+{GeneralCategory::Cs, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Co, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Mn, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 26, 0x04},
+{GeneralCategory::Po, GraphemeBreak::Unassigned, WordBreak::MidNumLet, SentenceBreak::Unassigned, 0, 0x04},
+{GeneralCategory::Lm, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 0, 0x04},
+{GeneralCategory::Mc, GraphemeBreak::SpacingMark, WordBreak::Extend, SentenceBreak::Extend, 6, 0x00},
+{GeneralCategory::Mc, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Extend, 216, 0x00},
+{GeneralCategory::Mc, GraphemeBreak::SpacingMark, WordBreak::Extend, SentenceBreak::Extend, 216, 0x00},
+{GeneralCategory::Mc, GraphemeBreak::SpacingMark, WordBreak::Extend, SentenceBreak::Extend, 226, 0x00},
+{GeneralCategory::Cn, GraphemeBreak::Unassigned, WordBreak::Unassigned, SentenceBreak::Unassigned, 0, 0x01},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0x02},
+{GeneralCategory::So, GraphemeBreak::Unassigned, WordBreak::ALetter, SentenceBreak::Upper, 0, 0x03},
+{GeneralCategory::So, GraphemeBreak::Regional_Indicator, WordBreak::Regional_Indicator, SentenceBreak::Unassigned, 0, 0x00},
+{GeneralCategory::Sk, GraphemeBreak::Extend, WordBreak::Extend, SentenceBreak::Unassigned, 0, 0x04},
+};
+const uint16_t _code_point_record_ids_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 1216, 1280, 1344,
+1408, 1472, 1536, 1600, 1216, 1280, 1344, 1664, 1728, 1728, 1792, 1792, 1792,
+1792, 1792, 1792, 1856, 1920, 1984, 2048, 2112, 2176, 2240, 2304, 2368, 2432,
+2496, 2560, 2624, 2624, 2688, 2752, 2624, 2624, 2624, 2816, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2880, 2944, 832, 832, 832, 832, 832, 3008, 832,
+3072, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 3136, 2624, 2624, 3200,
+2624, 2624, 2624, 2624, 3264, 3328, 3392, 2624, 3456, 2624, 3520, 3584, 3648,
+3712, 3776, 3840, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 3904, 832, 832,
+832, 3968, 4032, 832, 832, 832, 832, 4096, 832, 832, 832, 832, 832, 832, 4160,
+2624, 2624, 2624, 4224, 2624, 832, 832, 832, 832, 4288, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 4352, 4416, 4416, 4416, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
+2624, 2624, 2624, 2624, 2624, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 4480, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+1792, 1792, 4480,
+};
+const uint16_t _code_point_record_ids_stage2[] = {
+0, 16, 32, 48, 64, 80, 96, 112, 128, 16, 144, 160, 176, 192, 208, 224, 240, 240,
+240, 256, 272, 240, 240, 288, 304, 320, 336, 352, 368, 384, 240, 400, 240, 240,
+416, 432, 448, 464, 480, 496, 512, 528, 544, 560, 576, 592, 608, 624, 640, 656,
+672, 688, 704, 720, 736, 752, 768, 784, 800, 208, 816, 832, 240, 848, 176, 176,
+176, 208, 208, 208, 240, 240, 864, 240, 240, 240, 880, 240, 240, 240, 240, 240,
+240, 896, 176, 912, 928, 208, 944, 960, 976, 992, 1008, 1024, 1040, 1056, 1072,
+1088, 1104, 1104, 1120, 1136, 1152, 1168, 1104, 1104, 1104, 1104, 1104, 1184,
+1200, 1216, 1232, 1248, 1104, 1264, 1280, 1104, 1104, 1104, 1104, 1104, 1296,
+1312, 1328, 1104, 1344, 1360, 1104, 1376, 1392, 1408, 1104, 1424, 1440, 1456,
+1456, 1456, 1104, 1472, 1488, 1504, 1520, 1536, 1552, 1104, 1104, 1568, 1584,
+1600, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728, 1744, 1760, 1776, 1664,
+1680, 1792, 1808, 1824, 1840, 1856, 1872, 1888, 1680, 1904, 1920, 1936, 1744,
+1952, 1968, 1664, 1680, 1984, 2000, 2016, 1744, 2032, 2048, 2064, 2080, 2096,
+2112, 2128, 1840, 2144, 2160, 2176, 1680, 2192, 2208, 2224, 1744, 2240, 2256,
+2176, 1680, 2272, 2288, 2304, 1744, 2320, 2336, 2176, 1104, 2352, 2368, 2384,
+1744, 2400, 2416, 2432, 1104, 2448, 2464, 2480, 1840, 2496, 2512, 2528, 2528,
+2544, 2560, 2576, 1456, 1456, 2592, 2528, 2608, 2624, 2640, 2656, 1456, 1456,
+2672, 2688, 2704, 2720, 2736, 1104, 2752, 2768, 2784, 2800, 2816, 2832, 2848,
+2864, 1456, 1456, 2528, 2528, 2880, 2896, 2912, 2928, 2944, 2960, 2976, 2992,
+176, 176, 3008, 3024, 3024, 3040, 3056, 3056, 3056, 3056, 3056, 3056, 3072,
+3072, 3072, 3072, 3088, 3104, 3104, 3104, 3104, 3104, 1104, 1104, 1104, 1104,
+3120, 3136, 1104, 1104, 3120, 1104, 1104, 3152, 3168, 3184, 1104, 1104, 1104,
+3168, 1104, 1104, 1104, 3200, 3216, 3232, 1104, 3248, 3264, 3264, 3264, 3264,
+3264, 3280, 3296, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 3312, 1104, 3328, 3344, 1104, 1104, 1104, 1104, 3360, 3376, 3392, 3408,
+1104, 3424, 1104, 3440, 3392, 3456, 2528, 2528, 2528, 3472, 3488, 3504, 3520,
+3536, 3552, 3520, 1104, 1104, 3568, 1104, 1104, 3584, 3600, 1104, 3616, 1104,
+1104, 1104, 1104, 3632, 1104, 3648, 3664, 3680, 3696, 2528, 3712, 3728, 2528,
+2528, 3744, 2528, 3760, 3776, 3792, 3792, 1104, 3808, 2528, 2528, 2528, 3824,
+3840, 3856, 3520, 3520, 3872, 3888, 3904, 1456, 1456, 1456, 3920, 1104, 1104,
+3936, 3952, 3968, 3984, 4000, 4016, 1104, 4032, 1328, 1104, 1104, 4048, 4064,
+1104, 1104, 4080, 4096, 4112, 1328, 1104, 4128, 4144, 4160, 4160, 4176, 4192,
+4208, 4224, 4240, 544, 544, 4256, 4272, 4272, 4272, 4288, 4304, 4320, 4336,
+4272, 4272, 4352, 4368, 640, 4384, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+4400, 240, 240, 240, 240, 240, 240, 4416, 4432, 4416, 4416, 4432, 4448, 4416,
+4464, 4480, 4480, 4480, 4496, 4512, 4528, 4544, 4560, 4576, 4592, 4608, 4624,
+4640, 4656, 4672, 4688, 4704, 4720, 4736, 4736, 1456, 4752, 4768, 4784, 4800,
+4816, 4832, 4848, 4864, 4880, 4896, 4912, 4928, 4944, 4960, 3792, 4976, 4992,
+3792, 5008, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024,
+5024, 5024, 5024, 5024, 5024, 5040, 5056, 5072, 3792, 3792, 3792, 3792, 5088,
+5104, 5120, 5024, 5136, 5152, 5168, 5184, 5200, 3792, 3792, 5216, 1456, 5232,
+1456, 4880, 4880, 4880, 5248, 3792, 5264, 5280, 5296, 5312, 4880, 3792, 3792,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 5056, 5328, 5344, 3792, 3792,
+5360, 5376, 5392, 5408, 5408, 5408, 5408, 5424, 5408, 5440, 5408, 5408, 5408,
+5408, 5408, 5408, 5408, 5456, 5472, 5488, 5504, 5520, 5536, 5552, 5568, 4880,
+5584, 5600, 5616, 5632, 5024, 5648, 5024, 3792, 3792, 3792, 3792, 3792, 3792,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 5024, 5024, 5024,
+5664, 5024, 5024, 5024, 5024, 5680, 5696, 5024, 5024, 5024, 5712, 5024, 5728,
+5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024,
+5024, 5024, 5024, 5744, 5760, 3792, 5024, 5776, 5792, 3792, 5808, 3792, 5824,
+3792, 3792, 3792, 3792, 3792, 3792, 176, 176, 5840, 208, 208, 5856, 5872, 5888,
+240, 240, 240, 240, 240, 240, 5904, 5920, 208, 208, 5936, 1104, 1104, 1104,
+5952, 5968, 1104, 5984, 6000, 6000, 6000, 6000, 640, 640, 6016, 6032, 6048,
+6064, 6080, 6096, 1456, 1456, 3792, 6112, 3792, 3792, 3792, 3792, 3792, 6128,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+6144, 1456, 6160, 6176, 6192, 6208, 6224, 2512, 2528, 2528, 2528, 2528, 6240,
+6256, 6272, 6272, 6272, 6272, 6288, 6304, 1104, 1104, 6320, 1104, 1104, 1104,
+1104, 3648, 6336, 1104, 1104, 3792, 3792, 6128, 6272, 3792, 6352, 6368, 3792,
+6384, 6400, 3792, 3792, 6368, 6416, 3792, 6400, 3792, 6432, 6432, 6448, 6432,
+6432, 6432, 6432, 6432, 6464, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+3792, 3792, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 3792, 3792, 3792, 3792, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 6480, 1104,
+6496, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 2752, 3792, 3792, 3792, 5216, 1104, 1104,
+6512, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 6528, 1104, 6544, 1456, 240, 240, 6560, 6576, 240, 6592,
+1104, 1104, 1104, 1104, 6608, 6624, 6640, 6656, 6672, 6688, 240, 240, 240, 6704,
+6720, 6736, 6752, 6768, 6784, 1456, 1456, 6800, 6816, 1104, 6832, 6848, 1104,
+1104, 1104, 6864, 6880, 1104, 1104, 6896, 6912, 3520, 640, 6928, 1328, 1104,
+6944, 1104, 6960, 6976, 3056, 6992, 1552, 1104, 1104, 7008, 7024, 7040, 7056,
+7072, 1104, 1104, 7088, 7104, 7120, 7136, 2528, 7152, 2528, 2528, 2528, 7168,
+7184, 7200, 7216, 7232, 7248, 7264, 6000, 544, 544, 7280, 7296, 7312, 7312,
+7312, 7312, 7312, 1104, 1104, 7328, 3520, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376,
+7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392,
+7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376,
+7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392,
+7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376,
+7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392,
+7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376,
+7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392,
+7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376,
+7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392,
+7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360,
+7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344,
+7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408, 7376,
+7344, 7360, 7376, 7392, 7376, 7408, 7376, 7344, 7360, 7376, 7392, 7376, 7408,
+7376, 7344, 7360, 7376, 7392, 7376, 7424, 3072, 7440, 3104, 3104, 7456, 7472,
+7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472,
+7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472,
+7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472,
+7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472,
+7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 3712, 2528, 2528, 2528,
+2528, 2528, 2528, 3760, 1456, 1456, 7504, 7520, 7536, 7552, 7568, 1104, 1104,
+1104, 1104, 1104, 1104, 7584, 7600, 7616, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 7632, 1456, 1104, 1104, 1104, 1104, 7648, 1104, 1104, 1488, 1456,
+1456, 7664, 2816, 7680, 7696, 7712, 7728, 7744, 7760, 1472, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 7776, 7792, 48, 64, 80, 96, 7808, 7824, 7840, 6272,
+7856, 1104, 3648, 7872, 7888, 7904, 7920, 7936, 1104, 3184, 7952, 7968, 7968,
+1456, 1456, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1440, 7984, 4880, 4880,
+8000, 8016, 8016, 8016, 8032, 8048, 8064, 8080, 1456, 1456, 3792, 3792, 8096,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 2752, 1104, 1104, 1104,
+1936, 8112, 8128, 1104, 1104, 8144, 1104, 8160, 1104, 1104, 8176, 1104, 8192,
+1104, 1104, 8208, 8224, 1456, 1456, 176, 176, 8240, 208, 208, 1104, 1104, 1104,
+1104, 7968, 3520, 176, 176, 8256, 208, 8272, 1104, 1104, 1488, 1104, 1104, 1104,
+8288, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 5984, 1104, 3632, 1488, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 8304, 1104, 1104, 8320, 1104, 8336, 1104, 8352, 1104, 3648,
+8368, 1456, 1456, 1456, 1104, 8384, 1104, 8400, 1104, 8416, 1456, 1456, 1456,
+1456, 1104, 1104, 1104, 8432, 4880, 8448, 4880, 4880, 8464, 8480, 1104, 8496,
+8512, 8528, 1104, 8544, 1104, 8560, 1456, 1456, 8576, 1104, 8592, 8608, 1104,
+1104, 1104, 8624, 1104, 8640, 1104, 8656, 1104, 8672, 8688, 1456, 1456, 1456,
+1456, 1456, 1104, 1104, 1104, 1104, 3584, 1456, 1456, 1456, 176, 176, 176, 8704,
+208, 208, 208, 8720, 1104, 1104, 8736, 3520, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 4880,
+8752, 1104, 1104, 8768, 8784, 1456, 1456, 1456, 1456, 1104, 8560, 8800, 1104,
+8816, 8832, 1456, 1456, 1456, 1456, 1456, 1104, 8848, 1456, 1104, 5984, 8864,
+1104, 1104, 8880, 8896, 8448, 8912, 8928, 4016, 1104, 1104, 8944, 8960, 1104,
+3584, 3520, 8976, 1104, 8992, 9008, 9024, 1104, 1104, 9040, 4016, 1104, 1104,
+9056, 9072, 9088, 9104, 9120, 1104, 1888, 9136, 9152, 1456, 1456, 1456, 1456,
+9168, 9184, 9200, 1104, 1104, 9216, 9232, 3520, 9248, 1664, 1680, 9264, 9280,
+9296, 9312, 9328, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104,
+1104, 9344, 9360, 9376, 8784, 1456, 1104, 1104, 1104, 9392, 9408, 3520, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104, 9424, 9440,
+9456, 9472, 1456, 1456, 1104, 1104, 1104, 9488, 9504, 3520, 9520, 1456, 1104,
+1104, 9536, 9552, 3520, 1456, 1456, 1456, 2528, 9568, 9584, 9600, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104, 9136,
+9616, 1456, 1456, 1456, 1456, 1456, 1456, 176, 176, 208, 208, 2704, 9632, 9648,
+9664, 1104, 9680, 9696, 3520, 1456, 1456, 1456, 1456, 9712, 1104, 1104, 9728,
+9744, 1456, 9760, 1104, 1104, 9776, 9792, 9808, 1104, 1104, 9824, 9840, 9856,
+1456, 1104, 1104, 1104, 3584, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1680, 1104, 9872, 9888, 9904,
+2704, 3232, 9920, 1104, 9936, 9952, 9968, 1456, 1456, 1456, 1456, 9984, 1104,
+1104, 10000, 10016, 3520, 10032, 1104, 10048, 10064, 3520, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1104, 10080, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1936, 4880, 10096, 10112, 10128, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+10144, 1456, 1456, 1456, 1456, 1456, 1456, 8016, 8016, 8016, 8016, 8016, 8016,
+10160, 10176, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 10192, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 3648, 10208, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+5984, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 3584, 1104,
+3648, 10224, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 7968, 10240, 1104, 1104,
+1104, 10256, 10272, 10288, 10304, 10320, 1104, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 176,
+176, 208, 208, 4880, 10336, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104,
+1104, 1104, 10352, 10368, 10384, 10384, 10400, 10416, 1456, 1456, 1456, 1456,
+10432, 10448, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+10464, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 10480, 1456, 1456, 10496, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+10512, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 10528, 1456, 1456, 1456, 10544, 10560, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 3744, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104,
+1104, 1104, 1104, 1104, 1104, 1440, 2752, 3584, 10576, 10592, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 3792, 3792,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+6144, 3792, 3792, 10608, 3792, 3792, 3792, 10624, 10640, 10656, 3792, 10672,
+3792, 3792, 3792, 10688, 1456, 3792, 3792, 3792, 3792, 10704, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 4880, 10720, 3792, 3792, 3792, 3792, 3792,
+5216, 4880, 8512, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 10736, 10752,
+544, 10768, 10784, 10800, 10816, 10736, 10832, 10848, 10864, 10880, 10896,
+10736, 10752, 544, 10912, 10928, 544, 10944, 10960, 10976, 10992, 10736, 11008,
+544, 10736, 10752, 544, 10768, 10784, 544, 10816, 10736, 10832, 10992, 10736,
+11008, 544, 10736, 10752, 544, 11024, 10736, 11040, 11056, 11072, 11088, 544,
+11104, 10736, 11120, 11136, 11152, 11168, 544, 11184, 10736, 11200, 544, 11216,
+11232, 11232, 11232, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 2816, 2816, 2816, 11248,
+2816, 2816, 11264, 11280, 11296, 11312, 11328, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 11344, 11360, 11376, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104, 2752, 11392, 11408, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1104, 1104, 11424, 11440, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+1104, 11456, 11472, 1456, 1456, 176, 176, 11488, 208, 11504, 7040, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 9104, 4880, 4880, 11520, 11536,
+1456, 1456, 1456, 1456, 9104, 4880, 11552, 11568, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 11584, 1104, 11600, 11616, 11632,
+11648, 11664, 11680, 11696, 11712, 11728, 11712, 1456, 1456, 1456, 11744, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 5408, 5408, 11760, 5408, 5408, 5408, 5408, 5408, 5408, 11776, 11792,
+11808, 11808, 11808, 5408, 11824, 11840, 3792, 5152, 11856, 11872, 11856, 11888,
+11904, 11920, 11936, 11952, 11968, 11968, 11968, 11984, 12000, 12016, 12032,
+5152, 12048, 12064, 12080, 11824, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408,
+5408, 5408, 5408, 5408, 5408, 12096, 5408, 5408, 5408, 5408, 5408, 5408, 5408,
+5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 12112,
+12128, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408, 5408,
+5408, 5408, 5408, 5408, 3792, 3792, 12144, 5408, 5408, 5408, 5408, 5408, 12160,
+12176, 12176, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 12192, 3792, 3792, 3792,
+3792, 3792, 12208, 11760, 11968, 12224, 3792, 3792, 3792, 12240, 12256, 3792,
+3792, 12240, 3792, 12272, 12080, 11968, 11968, 11968, 11968, 12288, 5408, 5408,
+12304, 5376, 5408, 5408, 12320, 5408, 5408, 5408, 5408, 12336, 5408, 5408, 5408,
+5408, 5408, 5408, 5408, 5408, 11776, 12352, 12368, 12384, 5408, 12400, 12384,
+12416, 12384, 11968, 11968, 3792, 3792, 3792, 3792, 3792, 3792, 3792, 3792,
+3792, 12432, 3792, 3792, 5232, 1456, 1456, 3520, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968, 11968,
+11968, 11968, 11968, 11968, 12448, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 3712,
+1456, 1456, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 3728, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 3712, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 12464, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 12480,
+1456, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 3712, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+12496, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 12512,
+12528, 12544, 12544, 12544, 12544, 12544, 12544, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
+2816, 2816, 2816, 2816, 2816, 2816, 2816, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528, 12528,
+12528, 12528, 12528, 12528, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+7488, 7488, 7488, 12560,
+};
+const uint8_t _code_point_record_ids_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 5, 6, 7, 8, 9, 8, 8, 10, 11, 12, 8, 13, 14, 15, 16, 8, 17, 17,
+17, 17, 17, 17, 17, 17, 17, 17, 18, 19, 13, 13, 13, 6, 8, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 11, 8, 12, 21, 22, 21, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 11, 13, 12, 13, 0, 0, 0, 0,
+0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 8, 9, 9, 9, 9, 26, 8, 21, 27, 28,
+29, 13, 30, 27, 21, 26, 13, 31, 31, 21, 32, 8, 33, 21, 31, 28, 34, 31, 31, 31,
+8, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 13, 20, 20, 20, 20, 20, 20, 20, 32, 23, 23, 23, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 13, 23, 23, 23,
+23, 23, 23, 23, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20,
+23, 20, 23, 20, 23, 20, 23, 20, 23, 35, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23,
+20, 23, 20, 23, 20, 23, 32, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20,
+23, 20, 20, 23, 20, 23, 20, 23, 32, 23, 20, 20, 23, 20, 23, 20, 20, 23, 20, 20,
+20, 23, 35, 20, 20, 20, 20, 23, 20, 20, 23, 20, 20, 20, 23, 23, 35, 20, 20, 23,
+20, 20, 23, 20, 23, 20, 23, 20, 20, 23, 20, 35, 35, 20, 23, 20, 20, 23, 20, 20,
+20, 23, 20, 23, 20, 20, 23, 35, 36, 20, 23, 35, 23, 36, 36, 36, 36, 37, 38, 23,
+37, 38, 23, 37, 38, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23,
+20, 23, 23, 20, 23, 23, 37, 38, 23, 20, 23, 20, 20, 20, 23, 20, 23, 20, 23, 20,
+23, 20, 35, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20,
+23, 35, 35, 35, 35, 35, 35, 20, 20, 23, 20, 20, 23, 23, 20, 23, 20, 20, 20, 20,
+23, 20, 23, 20, 23, 20, 23, 20, 23, 23, 23, 23, 23, 23, 35, 23, 23, 35, 23, 35,
+23, 23, 35, 35, 35, 23, 23, 35, 23, 35, 23, 23, 35, 23, 23, 23, 23, 23, 35, 35,
+23, 35, 23, 23, 35, 35, 23, 35, 35, 35, 35, 35, 35, 35, 23, 35, 35, 23, 35, 23,
+23, 35, 35, 35, 23, 23, 23, 23, 23, 23, 35, 35, 35, 35, 35, 23, 35, 36, 35, 35,
+35, 35, 35, 35, 35, 35, 23, 23, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 39, 39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40,
+40, 39, 39, 41, 41, 41, 41, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 41,
+41, 41, 41, 41, 41, 21, 21, 21, 21, 21, 21, 41, 41, 39, 39, 39, 39, 39, 41, 41,
+41, 41, 41, 41, 41, 40, 41, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+42, 42, 42, 42, 42, 42, 43, 44, 44, 44, 44, 43, 45, 44, 44, 44, 44, 44, 46, 46,
+44, 44, 44, 44, 46, 46, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 47, 47, 47,
+47, 47, 44, 44, 44, 44, 42, 42, 42, 42, 42, 42, 42, 42, 48, 42, 44, 44, 44, 42,
+42, 42, 44, 44, 49, 42, 42, 42, 44, 44, 44, 44, 42, 43, 44, 44, 42, 50, 51, 51,
+50, 51, 51, 50, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 20, 23, 20,
+23, 40, 21, 20, 23, 52, 52, 39, 23, 23, 23, 19, 20, 52, 52, 52, 52, 21, 21, 20,
+33, 20, 20, 20, 52, 20, 52, 20, 20, 23, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 52, 20, 20, 20, 20, 20, 20, 20, 20, 20, 23, 23, 23,
+23, 23, 23, 32, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 20, 32, 32, 53,
+53, 53, 32, 32, 23, 20, 23, 20, 23, 20, 23, 20, 23, 32, 32, 23, 23, 20, 32, 13,
+20, 23, 20, 20, 23, 35, 20, 20, 20, 20, 23, 26, 42, 42, 42, 42, 42, 54, 54, 20,
+23, 20, 23, 20, 23, 20, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23,
+23, 52, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 52, 52, 40, 55, 55, 55, 56, 55, 33, 35, 23, 23, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 32, 35, 57, 58,
+52, 52, 26, 26, 9, 52, 44, 42, 42, 42, 42, 44, 42, 42, 42, 59, 44, 42, 42, 42,
+42, 42, 42, 44, 44, 44, 44, 44, 44, 42, 42, 44, 42, 42, 59, 60, 42, 61, 62, 63,
+64, 65, 66, 67, 68, 69, 70, 70, 71, 72, 73, 74, 75, 8, 76, 77, 8, 42, 44, 8, 69,
+52, 52, 52, 52, 52, 52, 52, 52, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 52, 52, 52, 52, 78,
+78, 78, 78, 79, 33, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 80, 80, 80, 80,
+80, 80, 13, 13, 13, 8, 8, 9, 14, 14, 26, 26, 42, 42, 42, 42, 42, 42, 42, 42, 81,
+82, 83, 8, 30, 52, 6, 6, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 40, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 84, 85, 86, 81, 82, 83, 87,
+88, 42, 42, 44, 44, 42, 42, 42, 42, 42, 44, 42, 42, 44, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 8, 89, 90, 8, 36, 36, 91, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 6, 36, 42, 42, 42, 42, 42, 42, 42, 80,
+26, 42, 42, 42, 42, 44, 42, 40, 40, 42, 42, 26, 44, 42, 42, 44, 36, 36, 17, 17,
+17, 17, 17, 17, 17, 17, 17, 17, 36, 36, 36, 26, 26, 36, 6, 6, 6, 8, 8, 8, 8, 8,
+8, 8, 8, 8, 8, 8, 52, 80, 36, 92, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 42, 44, 42, 42, 44, 42, 42, 44, 44, 44, 42, 44, 44, 42, 44, 42, 42,
+42, 44, 42, 44, 42, 44, 42, 44, 42, 42, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 36, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 42, 42, 42, 42, 42, 42,
+42, 44, 42, 40, 40, 26, 8, 14, 6, 40, 52, 52, 44, 9, 9, 36, 36, 36, 36, 36, 36,
+42, 42, 42, 42, 40, 42, 42, 42, 42, 42, 42, 42, 42, 42, 40, 42, 42, 42, 40, 42,
+42, 42, 42, 42, 52, 52, 8, 8, 8, 8, 8, 8, 8, 6, 8, 6, 8, 8, 8, 6, 6, 52, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 44, 44, 44, 52, 52, 8, 52, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 44, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 80, 44, 42, 42,
+44, 42, 42, 44, 42, 42, 42, 44, 44, 44, 84, 85, 86, 42, 42, 42, 44, 42, 42, 44,
+44, 42, 42, 42, 42, 42, 49, 49, 49, 93, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 49, 93, 94, 36, 93, 93, 93, 49,
+49, 49, 49, 49, 49, 49, 49, 93, 93, 93, 93, 95, 93, 93, 36, 42, 44, 42, 42, 49,
+49, 49, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 49, 49, 6, 6, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 8, 40, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 49, 93, 93, 52, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 52,
+52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 52, 36, 52, 52, 52, 36, 36, 36, 36,
+52, 52, 94, 36, 96, 93, 93, 49, 49, 49, 49, 52, 52, 93, 93, 52, 52, 93, 93, 95,
+36, 52, 52, 52, 52, 52, 52, 52, 52, 96, 52, 52, 52, 52, 36, 36, 52, 36, 36, 36,
+49, 49, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 36, 36, 9, 9, 31, 31,
+31, 31, 31, 31, 26, 9, 36, 8, 42, 52, 52, 49, 49, 93, 52, 36, 36, 36, 36, 36,
+36, 52, 52, 52, 52, 36, 36, 52, 36, 36, 52, 36, 36, 52, 36, 36, 52, 52, 94, 52,
+93, 93, 93, 49, 49, 52, 52, 52, 52, 49, 49, 52, 52, 49, 49, 95, 52, 52, 52, 49,
+52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 52, 36, 52, 52, 52, 52, 52, 52, 52,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 49, 49, 36, 36, 36, 49, 8, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 49, 49, 93, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+52, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52,
+36, 36, 52, 36, 36, 36, 36, 36, 52, 52, 94, 36, 93, 93, 93, 49, 49, 49, 49, 49,
+52, 49, 49, 93, 52, 93, 93, 95, 52, 52, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 8, 9, 52, 52, 52, 52, 52, 52, 52, 36, 49, 49, 49, 49,
+49, 49, 52, 49, 93, 93, 52, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 52,
+36, 36, 52, 36, 36, 36, 36, 36, 52, 52, 94, 36, 96, 49, 93, 49, 49, 49, 49, 52,
+52, 93, 93, 52, 52, 93, 93, 95, 52, 52, 52, 52, 52, 52, 52, 49, 49, 96, 52, 52,
+52, 52, 36, 36, 52, 36, 26, 36, 31, 31, 31, 31, 31, 31, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 49, 36, 52, 36, 36, 36, 36, 36, 36, 52, 52, 52, 36, 36, 36, 52,
+36, 36, 36, 36, 52, 52, 52, 36, 36, 52, 36, 52, 36, 36, 52, 52, 52, 36, 36, 52,
+52, 52, 36, 36, 36, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+52, 52, 52, 52, 96, 93, 49, 93, 93, 52, 52, 52, 93, 93, 93, 52, 93, 93, 93, 95,
+52, 52, 36, 52, 52, 52, 52, 52, 52, 96, 52, 52, 52, 52, 52, 52, 52, 52, 31, 31,
+31, 26, 26, 26, 26, 26, 26, 9, 26, 52, 52, 52, 52, 52, 49, 93, 93, 93, 49, 36,
+36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 36,
+49, 49, 49, 93, 93, 93, 93, 52, 49, 49, 49, 52, 49, 49, 49, 95, 52, 52, 52, 52,
+52, 52, 52, 97, 98, 52, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 8, 31, 31, 31, 31, 31, 31, 31, 26, 36, 49, 93, 93, 8, 36, 36, 36, 36, 36,
+36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 52, 52, 94, 36,
+93, 49, 93, 93, 96, 93, 93, 52, 49, 93, 93, 52, 93, 93, 49, 95, 52, 52, 52, 52,
+52, 52, 52, 96, 96, 52, 52, 52, 52, 52, 52, 52, 36, 52, 52, 36, 36, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 49, 49, 93, 93, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 95, 95, 36,
+96, 93, 93, 49, 49, 49, 49, 52, 93, 93, 93, 52, 93, 93, 93, 95, 99, 26, 52, 52,
+52, 52, 36, 36, 36, 96, 31, 31, 31, 31, 31, 31, 31, 36, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 26, 36, 36, 36, 36, 36, 36, 52, 49, 93, 93, 52, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 36, 36, 36, 36,
+36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 52, 52, 36, 36,
+36, 36, 36, 36, 36, 52, 52, 52, 95, 52, 52, 52, 52, 96, 93, 93, 49, 49, 49, 52,
+49, 52, 93, 93, 93, 93, 93, 93, 93, 96, 52, 52, 93, 93, 8, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 49, 100, 101, 49, 49, 49, 49, 102, 102, 95, 52,
+52, 52, 52, 9, 100, 100, 100, 100, 100, 100, 103, 49, 104, 104, 104, 104, 49,
+49, 49, 8, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 8, 8, 52, 52, 52, 52, 52,
+100, 100, 52, 100, 52, 100, 100, 100, 100, 100, 52, 100, 100, 100, 100, 100,
+100, 100, 100, 52, 100, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+49, 100, 101, 49, 49, 49, 49, 105, 105, 95, 49, 49, 100, 52, 52, 100, 100, 100,
+100, 100, 52, 103, 52, 106, 106, 106, 106, 49, 49, 52, 52, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 52, 52, 100, 100, 100, 100, 36, 26, 26, 26, 8, 8, 8, 8, 8,
+8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26, 8, 26, 26, 26, 44, 44, 26, 26, 26, 26, 26, 26,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+26, 44, 26, 44, 26, 45, 11, 12, 11, 12, 93, 93, 36, 36, 36, 36, 36, 36, 36, 36,
+52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 52, 52, 52, 52, 107, 108, 49, 109, 49, 49, 49, 49, 49, 108, 108, 108, 108,
+49, 93, 108, 49, 42, 42, 95, 8, 42, 42, 36, 36, 36, 36, 36, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 52, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 52, 26, 26, 26, 26, 26, 26, 26, 26, 44, 26, 26, 26, 26, 26, 26, 52,
+26, 26, 8, 8, 8, 8, 8, 26, 26, 26, 26, 8, 8, 52, 52, 52, 52, 52, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 100, 100, 110, 110, 49, 49, 49, 49, 93, 49, 49,
+49, 49, 49, 94, 110, 95, 95, 93, 93, 49, 49, 100, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 6, 6, 8, 8, 8, 8, 100, 100, 100, 100, 100, 100, 93, 93, 49, 49, 100,
+100, 100, 100, 49, 49, 49, 100, 110, 110, 110, 100, 100, 110, 110, 110, 110,
+110, 110, 110, 100, 100, 100, 49, 49, 49, 49, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 49, 110, 93, 49, 49, 110, 110, 110, 110, 110, 110,
+44, 100, 110, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 110, 110, 110, 49, 26, 26,
+20, 20, 20, 20, 20, 20, 52, 20, 52, 52, 52, 52, 52, 20, 52, 52, 111, 111, 111,
+111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+111, 111, 111, 111, 111, 111, 111, 111, 8, 40, 111, 111, 111, 112, 112, 112,
+112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+113, 113, 113, 113, 113, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 52, 52, 36, 36, 36, 36, 36, 36, 36, 52,
+36, 52, 36, 36, 36, 36, 52, 52, 36, 52, 36, 36, 36, 36, 52, 52, 36, 36, 36, 36,
+36, 36, 36, 52, 36, 52, 36, 36, 36, 36, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 52, 52, 42, 42, 42, 8, 8, 6, 8, 8, 8, 8, 6, 6, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 52,
+52, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 115,
+115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+115, 115, 115, 115, 115, 52, 52, 32, 32, 32, 32, 32, 32, 52, 52, 74, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 26, 6, 36, 5, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 11, 12, 52, 52, 52,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 8, 8, 8, 116, 116, 116, 36, 36, 36,
+36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 49, 49, 95, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 36, 36, 49, 49, 95, 6, 6, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+36, 36, 49, 49, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 52, 49, 49,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 100, 100, 100, 100, 49, 49, 93,
+49, 49, 49, 49, 49, 49, 49, 93, 93, 93, 93, 93, 93, 93, 93, 49, 93, 93, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 95, 49, 8, 8, 8, 103, 8, 8, 8, 9, 100, 42, 52, 52,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 52, 52, 52, 52, 52, 52, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 52, 52, 52, 52, 52, 52, 8, 8, 56, 6, 8, 8, 74, 8, 56, 6,
+8, 49, 49, 49, 30, 52, 36, 36, 36, 40, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 36, 36,
+36, 36, 36, 49, 49, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 60, 36, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 52, 49, 49, 49, 93, 93, 93, 93, 49, 49, 93, 93, 93, 52, 52, 52, 52, 93, 93,
+49, 93, 93, 93, 93, 93, 93, 59, 42, 44, 52, 52, 52, 52, 26, 52, 52, 52, 6, 6,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 52, 52, 100, 100, 100, 100, 100, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 52, 52, 52, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 52,
+52, 52, 52, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 52, 52, 52, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 36, 36, 36,
+36, 36, 36, 36, 42, 44, 93, 93, 49, 52, 52, 8, 8, 100, 100, 100, 100, 100, 93,
+49, 93, 49, 49, 49, 49, 49, 49, 49, 52, 95, 110, 49, 110, 110, 49, 49, 49, 49,
+49, 49, 49, 49, 93, 93, 93, 93, 93, 93, 49, 49, 42, 42, 42, 42, 42, 42, 42, 42,
+52, 52, 44, 8, 8, 8, 8, 8, 8, 8, 103, 6, 6, 6, 6, 8, 8, 52, 52, 42, 42, 42, 42,
+42, 44, 44, 44, 44, 44, 44, 42, 42, 44, 54, 44, 44, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 49, 49, 49, 49, 93, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 94, 96, 49, 49, 49, 49, 49, 93, 49, 93, 93, 93,
+93, 93, 49, 93, 117, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 6, 6, 8, 8, 6, 6, 8, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 42, 44, 42, 42, 42, 42, 42, 42, 42, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52,
+52, 52, 49, 49, 93, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 93,
+49, 49, 49, 49, 93, 93, 49, 49, 117, 95, 49, 49, 36, 36, 36, 36, 36, 36, 36, 36,
+94, 93, 49, 49, 93, 93, 93, 49, 93, 49, 49, 49, 117, 117, 52, 52, 52, 52, 52,
+52, 52, 52, 8, 8, 8, 8, 36, 36, 36, 36, 93, 93, 93, 93, 93, 93, 93, 93, 49, 49,
+49, 49, 49, 49, 49, 49, 93, 93, 49, 94, 52, 52, 52, 6, 6, 8, 8, 8, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 17, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 40, 40, 40, 40, 40, 40, 6, 6, 32, 32, 32, 32, 32, 32, 32, 32, 32, 52, 52,
+52, 52, 52, 52, 52, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 52,
+52, 118, 118, 118, 8, 8, 8, 8, 8, 8, 8, 8, 52, 52, 52, 52, 52, 52, 52, 52, 42,
+42, 42, 8, 47, 44, 44, 44, 44, 44, 42, 42, 44, 44, 44, 44, 42, 93, 47, 47, 47,
+47, 47, 47, 47, 36, 36, 36, 36, 44, 36, 36, 36, 36, 36, 36, 42, 36, 36, 93, 42,
+42, 36, 52, 52, 52, 52, 52, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 39,
+39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 39, 23, 35, 35, 35, 23, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 23, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 39, 39,
+39, 39, 39, 42, 42, 44, 42, 42, 42, 42, 42, 42, 42, 44, 42, 42, 51, 119, 44, 46,
+42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+42, 43, 60, 60, 44, 52, 42, 50, 44, 42, 44, 20, 23, 20, 23, 20, 23, 23, 23, 23,
+23, 32, 32, 35, 35, 20, 35, 23, 23, 23, 23, 23, 23, 23, 23, 20, 20, 20, 20, 20,
+20, 20, 20, 23, 23, 23, 23, 23, 23, 52, 52, 20, 20, 20, 20, 20, 20, 52, 52, 23,
+23, 23, 23, 23, 23, 23, 23, 52, 20, 52, 20, 52, 20, 52, 20, 23, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 52, 52, 32, 32, 32, 32, 32, 32, 32, 32, 38,
+38, 38, 38, 38, 38, 38, 38, 23, 23, 32, 32, 32, 52, 23, 32, 20, 20, 20, 20, 38,
+21, 23, 21, 21, 21, 32, 32, 32, 52, 23, 32, 20, 20, 20, 20, 38, 21, 21, 21, 23,
+23, 23, 23, 52, 52, 23, 23, 20, 20, 20, 20, 52, 21, 21, 21, 23, 23, 23, 23, 23,
+23, 23, 23, 20, 20, 20, 20, 20, 21, 21, 21, 52, 52, 32, 32, 32, 52, 23, 32, 20,
+20, 20, 20, 38, 21, 21, 52, 5, 5, 5, 5, 5, 5, 5, 25, 5, 5, 5, 120, 121, 122, 30,
+30, 74, 74, 74, 15, 15, 74, 8, 8, 123, 124, 11, 29, 29, 34, 11, 29, 8, 8, 8, 8,
+16, 8, 8, 33, 125, 126, 30, 30, 30, 30, 30, 127, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29,
+34, 8, 128, 6, 8, 22, 22, 8, 8, 8, 129, 11, 12, 6, 6, 128, 8, 8, 8, 8, 8, 8, 8,
+8, 13, 8, 22, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5, 30, 30, 30, 30, 30, 130, 30, 30,
+30, 30, 30, 30, 30, 30, 30, 30, 31, 39, 52, 52, 31, 31, 31, 31, 31, 31, 13, 13,
+13, 11, 12, 39, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 13, 13, 13, 11, 12, 52,
+39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 52, 52, 52, 9, 9, 9, 9, 9,
+9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 42, 42, 47, 47, 42, 42, 42, 42, 47, 47, 47, 42,
+42, 54, 54, 54, 54, 42, 54, 54, 54, 47, 47, 42, 44, 42, 47, 47, 44, 44, 44, 44,
+42, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 26, 26, 53, 26,
+26, 26, 26, 53, 26, 26, 35, 53, 53, 53, 35, 35, 53, 53, 53, 35, 26, 53, 26, 26,
+13, 53, 53, 53, 53, 53, 26, 26, 26, 26, 27, 26, 53, 26, 20, 26, 53, 26, 20, 20,
+53, 53, 26, 35, 53, 53, 20, 53, 35, 36, 36, 36, 36, 131, 26, 26, 35, 35, 53, 53,
+13, 13, 13, 13, 13, 53, 35, 35, 35, 35, 26, 13, 26, 26, 23, 26, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 132, 132, 132, 132, 132, 132,
+132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133,
+133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 116, 116, 116, 20, 23, 116,
+116, 116, 116, 31, 26, 26, 52, 52, 52, 52, 13, 13, 13, 13, 134, 27, 27, 27, 27,
+27, 13, 13, 26, 26, 26, 26, 13, 26, 26, 13, 26, 26, 13, 26, 26, 27, 27, 26, 26,
+26, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 13, 13, 26,
+26, 13, 26, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 13,
+13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+13, 13, 13, 13, 13, 13, 13, 26, 26, 26, 26, 26, 26, 26, 26, 11, 12, 11, 12, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 26, 26, 26, 26, 13,
+13, 26, 26, 26, 26, 26, 26, 27, 11, 12, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 13, 13,
+13, 13, 13, 13, 13, 13, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 13, 13, 13, 13, 13, 13, 26, 26, 26, 26, 26, 26, 26,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 26, 26, 26, 27, 27, 27, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 135, 135,
+135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 136, 135, 135, 135, 135, 135,
+135, 135, 135, 135, 135, 135, 135, 135, 137, 137, 137, 137, 137, 137, 137, 137,
+137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+137, 137, 31, 31, 31, 31, 31, 31, 26, 26, 26, 26, 26, 26, 27, 13, 26, 26, 26,
+26, 26, 26, 26, 26, 27, 13, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 13, 13, 13, 134, 134, 134, 134, 13, 27, 27,
+27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 134, 27, 27, 27, 27, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27,
+27, 27, 27, 27, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 26,
+27, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 27, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 27, 26, 26, 27, 26, 26, 26, 26, 27, 26, 27, 26, 26, 26,
+26, 27, 27, 27, 26, 27, 26, 26, 26, 138, 138, 138, 138, 138, 138, 26, 26, 27,
+27, 27, 27, 27, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 26, 27, 27, 27, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 13, 13, 13, 13,
+13, 11, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 12,
+11, 12, 11, 12, 11, 12, 11, 12, 13, 13, 13, 13, 134, 134, 13, 13, 13, 13, 13,
+13, 13, 13, 13, 13, 13, 13, 13, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12,
+11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+13, 13, 13, 13, 13, 11, 12, 11, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+13, 13, 13, 13, 13, 11, 12, 13, 13, 26, 26, 26, 26, 26, 27, 27, 27, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 26, 26,
+26, 13, 13, 13, 13, 13, 26, 26, 13, 13, 13, 13, 13, 13, 26, 26, 26, 27, 26, 26,
+26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 52, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+52, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 52, 20, 23, 20,
+20, 20, 23, 23, 20, 23, 20, 23, 20, 23, 20, 20, 20, 20, 35, 20, 23, 35, 20, 23,
+35, 35, 35, 35, 35, 39, 39, 20, 20, 20, 23, 20, 23, 35, 26, 26, 26, 26, 26, 26,
+20, 23, 20, 23, 42, 42, 42, 20, 23, 52, 52, 52, 52, 52, 8, 8, 8, 8, 31, 8, 8,
+23, 23, 23, 23, 23, 23, 52, 23, 52, 52, 52, 52, 52, 23, 52, 52, 36, 36, 36, 36,
+36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 40, 8, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 95, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 52,
+139, 139, 29, 34, 29, 34, 139, 139, 139, 29, 34, 139, 29, 34, 8, 8, 8, 8, 8, 8,
+8, 8, 8, 74, 8, 8, 74, 8, 29, 34, 8, 8, 29, 34, 11, 12, 11, 12, 11, 12, 11, 12,
+8, 8, 8, 8, 6, 40, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 74, 74, 6, 8, 8, 8, 74, 8, 11,
+8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26, 26, 8, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 26, 26,
+26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 5, 56, 6, 8, 26, 40, 100, 140, 11, 12,
+11, 12, 11, 12, 11, 12, 11, 12, 26, 26, 11, 12, 11, 12, 11, 12, 11, 12, 74, 11,
+12, 12, 26, 140, 140, 140, 140, 140, 140, 140, 140, 140, 141, 60, 43, 59, 142,
+142, 143, 144, 144, 144, 144, 144, 26, 26, 140, 140, 140, 40, 36, 145, 26, 26,
+100, 100, 100, 100, 100, 100, 100, 52, 52, 146, 146, 147, 147, 103, 103, 100,
+148, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 8, 144, 144, 144, 149,
+52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 26, 26, 31, 31, 31, 31, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 52, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 31, 31, 31, 31, 31, 31, 31, 31, 26, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 26, 26, 26, 26, 26, 26, 26, 27,
+26, 27, 26, 26, 26, 26, 26, 26, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+150, 150, 150, 150, 150, 150, 26, 150, 150, 150, 150, 150, 150, 150, 150, 26,
+26, 26, 26, 26, 26, 26, 26, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 52, 52, 52, 36, 36, 36, 36, 36, 40, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 40, 40, 40, 40, 40, 40, 8, 6, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 40, 8, 6, 6, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 36, 36, 52, 52, 52, 52, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23,
+20, 23, 20, 23, 36, 42, 54, 54, 54, 8, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+8, 40, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 39, 39, 42, 42, 36, 36,
+36, 36, 36, 36, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 42, 42, 8, 6,
+8, 8, 8, 6, 52, 52, 52, 52, 52, 52, 52, 52, 21, 21, 21, 21, 21, 21, 21, 21, 41,
+41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 40, 40, 40, 40, 40,
+40, 40, 40, 41, 41, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 35,
+35, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 39, 35, 35, 35, 35,
+35, 35, 35, 35, 20, 23, 20, 23, 20, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 40,
+41, 41, 20, 23, 20, 35, 36, 20, 23, 20, 23, 23, 35, 20, 23, 20, 23, 20, 23, 20,
+23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 20, 20, 20, 20, 35, 20,
+20, 20, 20, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 20, 23, 52, 52, 20, 23, 20,
+20, 20, 20, 23, 20, 23, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 20, 23, 36, 39,
+39, 35, 36, 36, 36, 36, 36, 36, 36, 49, 36, 36, 36, 95, 36, 36, 36, 36, 49, 36,
+36, 36, 36, 36, 36, 36, 93, 93, 49, 49, 93, 26, 26, 26, 26, 95, 52, 52, 52, 31,
+31, 31, 31, 31, 31, 26, 26, 9, 26, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 8, 8,
+6, 6, 52, 52, 52, 52, 52, 52, 52, 52, 93, 93, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+93, 93, 93, 93, 93, 93, 95, 49, 52, 52, 52, 52, 52, 52, 52, 52, 6, 6, 42, 42,
+36, 36, 36, 36, 36, 36, 8, 8, 8, 36, 8, 36, 36, 49, 36, 36, 36, 36, 36, 36, 49,
+49, 49, 49, 49, 44, 44, 44, 8, 6, 36, 36, 36, 36, 36, 36, 36, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 93, 117, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+8, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 52, 52, 52,
+36, 36, 36, 94, 93, 93, 49, 49, 49, 49, 93, 93, 49, 49, 93, 93, 117, 8, 8, 8, 8,
+8, 8, 8, 6, 6, 8, 8, 8, 8, 52, 40, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 52,
+52, 52, 52, 8, 8, 100, 100, 100, 100, 100, 49, 103, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 100, 100, 100, 100,
+100, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 49, 49, 49, 49, 49, 49, 93, 93, 49,
+49, 93, 93, 49, 49, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 49, 36, 36,
+36, 36, 36, 36, 36, 36, 49, 93, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+52, 52, 8, 6, 6, 6, 103, 100, 100, 100, 100, 100, 100, 26, 26, 26, 100, 110, 49,
+110, 100, 100, 42, 100, 42, 42, 44, 100, 100, 42, 42, 100, 100, 100, 100, 100,
+42, 42, 100, 42, 100, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 100, 100, 103, 8, 8, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 93, 49, 49, 93, 93, 6, 6, 36, 40, 40, 93, 95, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 36, 36,
+36, 36, 52, 52, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 35,
+35, 35, 23, 35, 35, 35, 35, 35, 35, 35, 41, 39, 39, 39, 39, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 40, 21, 21, 52, 52, 52, 52, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 36, 36, 36, 93, 93, 49, 93, 93, 49, 93, 93, 6, 93,
+95, 52, 52, 151, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 151,
+152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 151, 152, 152, 152, 152,
+152, 152, 152, 152, 152, 152, 152, 151, 152, 152, 152, 152, 152, 152, 152, 152,
+152, 152, 152, 152, 152, 152, 152, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 113, 113, 113, 113, 113, 113, 113, 52, 52, 52, 52, 114, 114, 114, 114, 114,
+114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 52, 52, 52, 52, 153,
+153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 154,
+154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 32,
+32, 32, 32, 32, 32, 32, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 32, 32,
+32, 32, 32, 52, 52, 52, 52, 52, 78, 155, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+13, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 52, 78, 78, 78, 78, 78,
+52, 78, 52, 78, 78, 52, 78, 78, 52, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 36,
+36, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 12, 11, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 9, 26, 52, 52, 14, 56, 8, 18, 19, 8,
+8, 11, 12, 8, 52, 52, 52, 52, 52, 52, 42, 42, 42, 42, 42, 42, 42, 44, 44, 44,
+44, 44, 44, 44, 42, 42, 8, 15, 15, 22, 22, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+12, 11, 12, 11, 12, 11, 12, 8, 8, 11, 12, 8, 8, 8, 8, 22, 22, 22, 14, 56, 16,
+52, 19, 18, 6, 6, 15, 11, 12, 11, 12, 11, 12, 8, 8, 8, 13, 15, 13, 13, 13, 52,
+8, 9, 8, 8, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+52, 52, 30, 52, 6, 8, 8, 9, 8, 8, 156, 11, 12, 8, 13, 14, 15, 16, 8, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 11, 13, 12, 13, 11, 12, 6, 11, 12, 56, 8, 149,
+149, 149, 149, 149, 149, 149, 149, 149, 149, 144, 149, 149, 149, 149, 149, 149,
+149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+149, 149, 149, 149, 149, 149, 149, 157, 157, 52, 52, 36, 36, 36, 36, 36, 36, 52,
+52, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 36,
+52, 52, 52, 9, 9, 13, 21, 26, 9, 9, 52, 26, 13, 13, 13, 13, 26, 26, 52, 130,
+130, 130, 130, 130, 130, 130, 130, 130, 30, 30, 30, 26, 26, 52, 52, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 52, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 52, 52, 8, 8, 8, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 52, 52, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 116, 116, 116,
+116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+116, 116, 31, 31, 31, 31, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 31, 31, 26, 26, 26, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 52, 52, 52, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 44, 52, 52, 44, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 52, 52, 52, 52, 31, 31, 31, 31, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 36, 36, 36, 36, 116, 36, 36, 36, 36, 36, 36, 36, 36, 116, 52, 52,
+52, 52, 52, 36, 36, 36, 36, 36, 36, 42, 42, 42, 42, 42, 52, 52, 52, 52, 52, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 8, 36, 36, 36, 36, 52,
+52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 8, 116, 116, 116, 116, 116, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 20, 20, 20, 20, 20, 20, 20, 20, 23, 23, 23, 23,
+23, 23, 23, 23, 20, 20, 20, 20, 52, 52, 52, 52, 23, 23, 23, 23, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 52, 52, 52, 52, 36, 36, 36, 36,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 8, 36, 36, 36, 36, 36, 36, 52, 52,
+36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 52, 52, 52,
+36, 52, 52, 36, 36, 36, 36, 36, 36, 36, 52, 8, 31, 31, 31, 31, 31, 31, 31, 31,
+36, 36, 36, 36, 36, 36, 36, 26, 26, 31, 31, 31, 31, 31, 31, 31, 52, 52, 52, 52,
+52, 52, 52, 31, 31, 31, 31, 31, 31, 31, 31, 31, 36, 36, 36, 52, 36, 36, 52, 52,
+52, 52, 52, 31, 31, 31, 31, 31, 36, 36, 36, 36, 36, 36, 31, 31, 31, 31, 31, 31,
+52, 52, 52, 8, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 8,
+36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 31, 31, 36, 36, 52, 52, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 36, 49, 49, 49, 52, 49, 49, 52,
+52, 52, 52, 52, 49, 44, 49, 42, 36, 36, 36, 36, 52, 36, 36, 36, 52, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 42, 47, 44, 52, 52, 52, 52, 95,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 52, 52, 52, 52, 52, 52, 52, 8, 8, 8, 8, 8,
+8, 6, 6, 8, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 31, 31, 8, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 31,
+31, 31, 36, 36, 36, 36, 36, 36, 36, 36, 26, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 42, 44, 52, 52, 52, 52, 31, 31, 31, 31, 31, 8, 8, 8, 8, 8, 8, 8, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 52, 52, 52, 8, 8, 8, 8,
+8, 8, 8, 36, 36, 36, 36, 36, 36, 52, 52, 31, 31, 31, 31, 31, 31, 31, 31, 36, 36,
+36, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31, 31, 31, 36, 36, 52, 52, 52, 52,
+52, 52, 52, 8, 8, 8, 8, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 31, 31,
+31, 31, 31, 31, 31, 20, 20, 20, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 23, 23, 23, 52, 52, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31, 36, 36, 36,
+36, 42, 42, 42, 42, 52, 52, 52, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52,
+42, 42, 74, 52, 52, 36, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 31, 31, 31, 31, 31, 31, 31, 36, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36,
+36, 36, 36, 44, 44, 42, 42, 42, 44, 42, 44, 44, 44, 44, 31, 31, 31, 31, 6, 6, 6,
+6, 6, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 31, 31, 31, 31, 31, 31, 31,
+52, 52, 52, 52, 93, 49, 93, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+49, 49, 95, 6, 6, 8, 8, 8, 8, 8, 52, 52, 31, 31, 31, 31, 31, 31, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 95, 93, 93, 93, 49, 49, 49, 49, 93, 93, 95, 94, 8, 8, 80, 6, 6, 6, 6, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 80, 52, 52, 42, 42, 42, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 49, 49, 49, 49,
+49, 93, 49, 49, 49, 49, 49, 49, 95, 95, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 8, 6, 6, 6, 36, 93, 93, 36, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 94,
+8, 8, 36, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 93, 93, 93, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 93, 117, 36, 99, 99, 36, 6, 6, 8, 8, 49, 94, 49, 49,
+6, 93, 49, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 36, 8, 36, 8, 6, 6, 52, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 93, 93, 93, 49, 49, 49, 93, 93, 49, 117, 94, 49, 6, 6, 8, 6, 6, 8, 49,
+52, 36, 36, 36, 36, 36, 36, 36, 52, 36, 52, 36, 36, 36, 36, 52, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 6, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 49, 93, 93, 93, 49, 49, 49, 49, 49, 49, 94, 95, 52, 52, 52, 52,
+52, 49, 49, 93, 93, 52, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 36, 36, 52, 36,
+36, 52, 36, 36, 36, 36, 36, 52, 94, 94, 36, 96, 93, 49, 93, 93, 93, 93, 52, 52,
+93, 93, 52, 52, 93, 93, 117, 52, 52, 36, 52, 52, 52, 52, 52, 52, 96, 52, 52, 52,
+52, 52, 36, 36, 36, 36, 36, 93, 93, 52, 52, 42, 42, 42, 42, 42, 42, 42, 52, 52,
+52, 42, 42, 42, 42, 42, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36,
+36, 36, 93, 93, 93, 49, 49, 49, 49, 49, 49, 49, 49, 93, 93, 95, 49, 49, 93, 94,
+36, 36, 36, 36, 6, 6, 8, 8, 8, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 8, 8, 52,
+8, 42, 36, 96, 93, 93, 49, 49, 49, 49, 49, 49, 93, 49, 93, 93, 96, 93, 49, 49,
+93, 95, 94, 36, 36, 8, 36, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 96, 93, 93, 49, 49, 49, 49, 52, 52, 93,
+93, 93, 93, 49, 49, 93, 95, 94, 8, 6, 6, 8, 8, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6,
+6, 6, 6, 6, 6, 6, 6, 36, 36, 36, 36, 49, 49, 52, 52, 93, 93, 93, 49, 49, 49, 49,
+49, 49, 49, 49, 93, 93, 49, 93, 95, 49, 6, 6, 8, 36, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52, 52, 52, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 49, 93, 49, 93, 93, 49, 49, 49, 49, 49, 49, 117,
+94, 36, 52, 52, 52, 52, 52, 52, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 52, 52, 49, 49, 49, 93, 93, 49, 49, 49, 49, 93, 49, 49, 49, 49, 95,
+52, 52, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 31, 31, 6, 6, 6, 26, 49,
+49, 49, 49, 49, 49, 49, 49, 93, 95, 94, 8, 52, 52, 52, 52, 31, 31, 31, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52,
+36, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 52, 36, 36, 36, 36, 36,
+36, 36, 36, 96, 93, 93, 93, 93, 93, 52, 93, 93, 52, 52, 49, 49, 117, 95, 99, 93,
+99, 93, 94, 6, 8, 6, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36,
+36, 36, 52, 52, 36, 36, 36, 36, 36, 36, 36, 93, 93, 93, 49, 49, 49, 49, 52, 52,
+49, 49, 93, 93, 93, 93, 95, 36, 8, 36, 93, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 36, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 36, 36, 36, 36, 36, 36, 36,
+36, 49, 95, 49, 49, 49, 49, 93, 99, 49, 49, 49, 49, 8, 8, 8, 6, 6, 8, 8, 8, 95,
+52, 52, 52, 52, 52, 52, 52, 52, 36, 49, 49, 49, 49, 49, 49, 93, 93, 49, 49, 49,
+36, 36, 36, 36, 36, 36, 36, 36, 99, 99, 99, 99, 99, 99, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 93, 49, 95, 8, 6, 6, 36, 8, 8, 8, 8, 8, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 93, 49, 49, 49, 49, 49, 49, 49, 52, 49, 49, 49, 49, 49, 49,
+93, 95, 36, 6, 6, 8, 8, 8, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 8, 8, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 52, 93, 49, 49,
+49, 49, 49, 49, 49, 93, 49, 49, 93, 49, 49, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 52, 36, 36, 36, 36, 36, 36, 49, 49, 49,
+49, 49, 49, 52, 52, 52, 49, 52, 49, 49, 52, 49, 49, 49, 94, 49, 95, 95, 99, 49,
+52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 52, 36, 36, 52, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 93, 93, 93, 93, 93, 52,
+49, 49, 52, 93, 93, 49, 93, 95, 36, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 49,
+49, 93, 93, 6, 6, 52, 52, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31, 26, 26, 26,
+26, 26, 26, 26, 26, 9, 9, 9, 9, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 8, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52, 116, 116, 116, 116,
+116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 52, 8, 8, 8, 8, 8, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 30, 30, 30, 30, 30, 30, 30, 30, 30, 52, 52, 52, 52, 52,
+52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 52, 52, 52, 52, 6, 6, 47, 47,
+47, 47, 47, 6, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 42, 42, 42, 42, 42, 42,
+42, 6, 6, 8, 8, 8, 26, 26, 26, 26, 40, 40, 40, 40, 6, 26, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 52, 31, 31, 31, 31,
+31, 31, 31, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 52, 52, 52, 52, 52, 36, 36, 36, 31, 31, 31, 31, 31, 31, 31,
+8, 6, 8, 8, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52,
+52, 52, 52, 49, 36, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+93, 93, 93, 93, 52, 52, 52, 52, 52, 52, 52, 49, 49, 49, 49, 40, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 8, 40, 49, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 158, 158, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 100, 100, 100, 100, 100, 100, 100, 100, 52, 52, 52, 52, 52, 52, 52, 52, 100,
+100, 100, 100, 100, 100, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 52, 52, 52, 52, 52, 52, 52, 149, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 52, 100, 100, 100, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 149, 149, 149,
+149, 52, 52, 52, 52, 52, 52, 52, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52,
+52, 26, 49, 47, 6, 30, 30, 30, 30, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 26, 26, 26, 26, 26, 26, 26, 52, 52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 159, 160, 47, 47, 47, 26, 26, 26, 161, 159, 159, 159, 159, 159, 30, 30,
+30, 30, 30, 30, 30, 30, 44, 44, 44, 44, 44, 44, 44, 44, 26, 26, 42, 42, 42, 42,
+42, 44, 44, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 42, 42, 42,
+42, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 52, 52, 52, 52, 52, 52, 52, 26,
+26, 42, 42, 42, 26, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 31, 31, 31, 31, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 35, 35, 35, 35, 35, 35, 35,
+52, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 53, 52, 53, 53, 52,
+52, 53, 52, 52, 53, 53, 52, 52, 53, 53, 53, 53, 52, 53, 53, 53, 53, 53, 53, 53,
+53, 35, 35, 35, 35, 52, 35, 52, 35, 35, 35, 35, 35, 35, 35, 52, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 53, 53, 52, 53, 53, 53, 53, 52, 52,
+53, 53, 53, 53, 53, 53, 53, 53, 52, 53, 53, 53, 53, 53, 53, 53, 52, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 53, 53, 52, 53, 53, 53, 53, 52, 53, 53, 53, 53, 53,
+52, 53, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 52, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53, 13, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 13, 35, 35, 35, 35, 35, 35, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 13, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 13, 35, 35, 35, 35, 35, 35, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+13, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 13, 35, 35, 35, 35, 35, 35, 53, 53, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 13, 35,
+35, 35, 35, 35, 35, 35, 35, 35, 13, 35, 35, 35, 35, 35, 35, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 13, 35, 35, 35, 35, 35, 35, 35, 35, 35, 13, 35, 35, 35, 35, 35,
+35, 53, 35, 52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 49, 49, 49, 49, 49, 49, 49, 26, 26, 26, 26, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 26, 26, 26, 26, 26, 26, 26, 26,
+49, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 49, 26, 26, 8, 6, 8,
+8, 8, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 49, 49, 49,
+49, 49, 52, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 42, 42,
+42, 42, 42, 42, 42, 52, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+42, 42, 42, 52, 52, 42, 42, 42, 42, 42, 42, 42, 52, 42, 42, 52, 42, 42, 42, 42,
+42, 52, 52, 52, 52, 52, 42, 42, 42, 42, 42, 42, 42, 40, 40, 40, 40, 40, 40, 40,
+52, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 52, 52, 52, 52, 36, 26, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 42, 42, 42, 42, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 52, 52, 52, 52, 52, 9, 36, 36, 36, 36, 36, 52, 52, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 44, 44, 44, 44, 44, 44, 44, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 20, 20, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+23, 23, 42, 42, 42, 42, 42, 42, 94, 40, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 26, 31, 31, 31, 9, 31, 31, 31, 31, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+26, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 52, 52, 36, 36,
+36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 52, 36, 52,
+52, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 52, 36,
+52, 36, 52, 52, 52, 52, 52, 52, 36, 52, 52, 52, 52, 36, 52, 36, 52, 36, 52, 36,
+36, 36, 52, 36, 36, 52, 36, 52, 52, 36, 52, 36, 52, 36, 52, 36, 52, 36, 52, 36,
+36, 52, 36, 52, 52, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 36, 36, 52, 36, 36,
+36, 36, 52, 36, 36, 36, 36, 52, 36, 52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+52, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 52, 52,
+52, 52, 52, 36, 36, 36, 52, 36, 36, 36, 36, 36, 52, 36, 36, 36, 36, 36, 13, 13,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 162, 162, 162, 162, 27, 27, 27, 27, 162, 162, 162, 162,
+162, 162, 162, 162, 162, 162, 162, 162, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 162, 162, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+162, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 27, 27, 27, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 26, 26, 26, 26, 26, 26, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 26, 26, 27, 27, 27, 27, 164, 164, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 164, 164, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 26, 26, 26, 26, 27, 26, 26, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 27, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 26, 27, 27, 162, 162, 162, 162, 162, 162, 162, 162,
+162, 162, 162, 162, 162, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26,
+26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 162, 162, 162, 162, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 162, 162, 162, 162, 162, 162, 162, 27, 27, 162,
+162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 166, 166, 166, 166, 166, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 26, 26, 26, 26, 26, 26, 138, 138, 138, 26, 26, 26, 26, 26,
+26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 162, 162, 162, 162, 162, 162, 162, 162,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 162, 162, 162, 26, 26, 26,
+26, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 26, 26, 26, 26,
+26, 27, 27, 27, 27, 162, 162, 162, 162, 162, 162, 162, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 162, 162, 162, 162, 26, 26, 26, 26, 26, 26, 26, 26, 162,
+162, 162, 162, 162, 162, 162, 162, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 162,
+162, 162, 162, 162, 162, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+162, 162, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 162, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 162, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 162, 162, 27, 27, 27, 27, 27, 162, 162, 162, 27, 27, 27, 162, 162, 162, 162,
+162, 27, 27, 27, 27, 27, 27, 27, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 162, 162, 162, 162, 162, 162, 162, 27, 27,
+27, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 26, 26, 26,
+52, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 162, 162, 162, 162, 162,
+162, 162, 162, 162, 162, 162, 162, 162, 162, 52, 52, 100, 100, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 100, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+52, 52, 52, 52, 52, 130, 30, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+130, 130, 130, 130, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+121, 121, 121, 121, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+154, 154, 52, 52,
+};
@@ -0,0 +1,2356 @@
+const char32_t _decomposition_pool[] = {
+0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000308, 0x00000000,
+0x00000061, 0x00000000, 0x00000020, 0x00000304, 0x00000000, 0x00000032,
+0x00000000, 0x00000033, 0x00000000, 0x00000020, 0x00000301, 0x00000000,
+0x000003BC, 0x00000000, 0x00000020, 0x00000327, 0x00000000, 0x00000031,
+0x00000000, 0x0000006F, 0x00000000, 0x00000031, 0x00002044, 0x00000034,
+0x00000000, 0x00000031, 0x00002044, 0x00000032, 0x00000000, 0x00000033,
+0x00002044, 0x00000034, 0x00000000, 0x00000041, 0x00000300, 0x00000000,
+0x00000041, 0x00000301, 0x00000000, 0x00000041, 0x00000302, 0x00000000,
+0x00000041, 0x00000303, 0x00000000, 0x00000041, 0x00000308, 0x00000000,
+0x00000041, 0x0000030A, 0x00000000, 0x00000043, 0x00000327, 0x00000000,
+0x00000045, 0x00000300, 0x00000000, 0x00000045, 0x00000301, 0x00000000,
+0x00000045, 0x00000302, 0x00000000, 0x00000045, 0x00000308, 0x00000000,
+0x00000049, 0x00000300, 0x00000000, 0x00000049, 0x00000301, 0x00000000,
+0x00000049, 0x00000302, 0x00000000, 0x00000049, 0x00000308, 0x00000000,
+0x0000004E, 0x00000303, 0x00000000, 0x0000004F, 0x00000300, 0x00000000,
+0x0000004F, 0x00000301, 0x00000000, 0x0000004F, 0x00000302, 0x00000000,
+0x0000004F, 0x00000303, 0x00000000, 0x0000004F, 0x00000308, 0x00000000,
+0x00000055, 0x00000300, 0x00000000, 0x00000055, 0x00000301, 0x00000000,
+0x00000055, 0x00000302, 0x00000000, 0x00000055, 0x00000308, 0x00000000,
+0x00000059, 0x00000301, 0x00000000, 0x00000061, 0x00000300, 0x00000000,
+0x00000061, 0x00000301, 0x00000000, 0x00000061, 0x00000302, 0x00000000,
+0x00000061, 0x00000303, 0x00000000, 0x00000061, 0x00000308, 0x00000000,
+0x00000061, 0x0000030A, 0x00000000, 0x00000063, 0x00000327, 0x00000000,
+0x00000065, 0x00000300, 0x00000000, 0x00000065, 0x00000301, 0x00000000,
+0x00000065, 0x00000302, 0x00000000, 0x00000065, 0x00000308, 0x00000000,
+0x00000069, 0x00000300, 0x00000000, 0x00000069, 0x00000301, 0x00000000,
+0x00000069, 0x00000302, 0x00000000, 0x00000069, 0x00000308, 0x00000000,
+0x0000006E, 0x00000303, 0x00000000, 0x0000006F, 0x00000300, 0x00000000,
+0x0000006F, 0x00000301, 0x00000000, 0x0000006F, 0x00000302, 0x00000000,
+0x0000006F, 0x00000303, 0x00000000, 0x0000006F, 0x00000308, 0x00000000,
+0x00000075, 0x00000300, 0x00000000, 0x00000075, 0x00000301, 0x00000000,
+0x00000075, 0x00000302, 0x00000000, 0x00000075, 0x00000308, 0x00000000,
+0x00000079, 0x00000301, 0x00000000, 0x00000079, 0x00000308, 0x00000000,
+0x00000041, 0x00000304, 0x00000000, 0x00000061, 0x00000304, 0x00000000,
+0x00000041, 0x00000306, 0x00000000, 0x00000061, 0x00000306, 0x00000000,
+0x00000041, 0x00000328, 0x00000000, 0x00000061, 0x00000328, 0x00000000,
+0x00000043, 0x00000301, 0x00000000, 0x00000063, 0x00000301, 0x00000000,
+0x00000043, 0x00000302, 0x00000000, 0x00000063, 0x00000302, 0x00000000,
+0x00000043, 0x00000307, 0x00000000, 0x00000063, 0x00000307, 0x00000000,
+0x00000043, 0x0000030C, 0x00000000, 0x00000063, 0x0000030C, 0x00000000,
+0x00000044, 0x0000030C, 0x00000000, 0x00000064, 0x0000030C, 0x00000000,
+0x00000045, 0x00000304, 0x00000000, 0x00000065, 0x00000304, 0x00000000,
+0x00000045, 0x00000306, 0x00000000, 0x00000065, 0x00000306, 0x00000000,
+0x00000045, 0x00000307, 0x00000000, 0x00000065, 0x00000307, 0x00000000,
+0x00000045, 0x00000328, 0x00000000, 0x00000065, 0x00000328, 0x00000000,
+0x00000045, 0x0000030C, 0x00000000, 0x00000065, 0x0000030C, 0x00000000,
+0x00000047, 0x00000302, 0x00000000, 0x00000067, 0x00000302, 0x00000000,
+0x00000047, 0x00000306, 0x00000000, 0x00000067, 0x00000306, 0x00000000,
+0x00000047, 0x00000307, 0x00000000, 0x00000067, 0x00000307, 0x00000000,
+0x00000047, 0x00000327, 0x00000000, 0x00000067, 0x00000327, 0x00000000,
+0x00000048, 0x00000302, 0x00000000, 0x00000068, 0x00000302, 0x00000000,
+0x00000049, 0x00000303, 0x00000000, 0x00000069, 0x00000303, 0x00000000,
+0x00000049, 0x00000304, 0x00000000, 0x00000069, 0x00000304, 0x00000000,
+0x00000049, 0x00000306, 0x00000000, 0x00000069, 0x00000306, 0x00000000,
+0x00000049, 0x00000328, 0x00000000, 0x00000069, 0x00000328, 0x00000000,
+0x00000049, 0x00000307, 0x00000000, 0x00000049, 0x0000004A, 0x00000000,
+0x00000069, 0x0000006A, 0x00000000, 0x0000004A, 0x00000302, 0x00000000,
+0x0000006A, 0x00000302, 0x00000000, 0x0000004B, 0x00000327, 0x00000000,
+0x0000006B, 0x00000327, 0x00000000, 0x0000004C, 0x00000301, 0x00000000,
+0x0000006C, 0x00000301, 0x00000000, 0x0000004C, 0x00000327, 0x00000000,
+0x0000006C, 0x00000327, 0x00000000, 0x0000004C, 0x0000030C, 0x00000000,
+0x0000006C, 0x0000030C, 0x00000000, 0x0000004C, 0x000000B7, 0x00000000,
+0x0000006C, 0x000000B7, 0x00000000, 0x0000004E, 0x00000301, 0x00000000,
+0x0000006E, 0x00000301, 0x00000000, 0x0000004E, 0x00000327, 0x00000000,
+0x0000006E, 0x00000327, 0x00000000, 0x0000004E, 0x0000030C, 0x00000000,
+0x0000006E, 0x0000030C, 0x00000000, 0x000002BC, 0x0000006E, 0x00000000,
+0x0000004F, 0x00000304, 0x00000000, 0x0000006F, 0x00000304, 0x00000000,
+0x0000004F, 0x00000306, 0x00000000, 0x0000006F, 0x00000306, 0x00000000,
+0x0000004F, 0x0000030B, 0x00000000, 0x0000006F, 0x0000030B, 0x00000000,
+0x00000052, 0x00000301, 0x00000000, 0x00000072, 0x00000301, 0x00000000,
+0x00000052, 0x00000327, 0x00000000, 0x00000072, 0x00000327, 0x00000000,
+0x00000052, 0x0000030C, 0x00000000, 0x00000072, 0x0000030C, 0x00000000,
+0x00000053, 0x00000301, 0x00000000, 0x00000073, 0x00000301, 0x00000000,
+0x00000053, 0x00000302, 0x00000000, 0x00000073, 0x00000302, 0x00000000,
+0x00000053, 0x00000327, 0x00000000, 0x00000073, 0x00000327, 0x00000000,
+0x00000053, 0x0000030C, 0x00000000, 0x00000073, 0x0000030C, 0x00000000,
+0x00000054, 0x00000327, 0x00000000, 0x00000074, 0x00000327, 0x00000000,
+0x00000054, 0x0000030C, 0x00000000, 0x00000074, 0x0000030C, 0x00000000,
+0x00000055, 0x00000303, 0x00000000, 0x00000075, 0x00000303, 0x00000000,
+0x00000055, 0x00000304, 0x00000000, 0x00000075, 0x00000304, 0x00000000,
+0x00000055, 0x00000306, 0x00000000, 0x00000075, 0x00000306, 0x00000000,
+0x00000055, 0x0000030A, 0x00000000, 0x00000075, 0x0000030A, 0x00000000,
+0x00000055, 0x0000030B, 0x00000000, 0x00000075, 0x0000030B, 0x00000000,
+0x00000055, 0x00000328, 0x00000000, 0x00000075, 0x00000328, 0x00000000,
+0x00000057, 0x00000302, 0x00000000, 0x00000077, 0x00000302, 0x00000000,
+0x00000059, 0x00000302, 0x00000000, 0x00000079, 0x00000302, 0x00000000,
+0x00000059, 0x00000308, 0x00000000, 0x0000005A, 0x00000301, 0x00000000,
+0x0000007A, 0x00000301, 0x00000000, 0x0000005A, 0x00000307, 0x00000000,
+0x0000007A, 0x00000307, 0x00000000, 0x0000005A, 0x0000030C, 0x00000000,
+0x0000007A, 0x0000030C, 0x00000000, 0x00000073, 0x00000000, 0x0000004F,
+0x0000031B, 0x00000000, 0x0000006F, 0x0000031B, 0x00000000, 0x00000055,
+0x0000031B, 0x00000000, 0x00000075, 0x0000031B, 0x00000000, 0x00000044,
+0x0000017D, 0x00000000, 0x00000044, 0x0000017E, 0x00000000, 0x00000064,
+0x0000017E, 0x00000000, 0x0000004C, 0x0000004A, 0x00000000, 0x0000004C,
+0x0000006A, 0x00000000, 0x0000006C, 0x0000006A, 0x00000000, 0x0000004E,
+0x0000004A, 0x00000000, 0x0000004E, 0x0000006A, 0x00000000, 0x0000006E,
+0x0000006A, 0x00000000, 0x00000041, 0x0000030C, 0x00000000, 0x00000061,
+0x0000030C, 0x00000000, 0x00000049, 0x0000030C, 0x00000000, 0x00000069,
+0x0000030C, 0x00000000, 0x0000004F, 0x0000030C, 0x00000000, 0x0000006F,
+0x0000030C, 0x00000000, 0x00000055, 0x0000030C, 0x00000000, 0x00000075,
+0x0000030C, 0x00000000, 0x000000DC, 0x00000304, 0x00000000, 0x000000FC,
+0x00000304, 0x00000000, 0x000000DC, 0x00000301, 0x00000000, 0x000000FC,
+0x00000301, 0x00000000, 0x000000DC, 0x0000030C, 0x00000000, 0x000000FC,
+0x0000030C, 0x00000000, 0x000000DC, 0x00000300, 0x00000000, 0x000000FC,
+0x00000300, 0x00000000, 0x000000C4, 0x00000304, 0x00000000, 0x000000E4,
+0x00000304, 0x00000000, 0x00000226, 0x00000304, 0x00000000, 0x00000227,
+0x00000304, 0x00000000, 0x000000C6, 0x00000304, 0x00000000, 0x000000E6,
+0x00000304, 0x00000000, 0x00000047, 0x0000030C, 0x00000000, 0x00000067,
+0x0000030C, 0x00000000, 0x0000004B, 0x0000030C, 0x00000000, 0x0000006B,
+0x0000030C, 0x00000000, 0x0000004F, 0x00000328, 0x00000000, 0x0000006F,
+0x00000328, 0x00000000, 0x000001EA, 0x00000304, 0x00000000, 0x000001EB,
+0x00000304, 0x00000000, 0x000001B7, 0x0000030C, 0x00000000, 0x00000292,
+0x0000030C, 0x00000000, 0x0000006A, 0x0000030C, 0x00000000, 0x00000044,
+0x0000005A, 0x00000000, 0x00000044, 0x0000007A, 0x00000000, 0x00000064,
+0x0000007A, 0x00000000, 0x00000047, 0x00000301, 0x00000000, 0x00000067,
+0x00000301, 0x00000000, 0x0000004E, 0x00000300, 0x00000000, 0x0000006E,
+0x00000300, 0x00000000, 0x000000C5, 0x00000301, 0x00000000, 0x000000E5,
+0x00000301, 0x00000000, 0x000000C6, 0x00000301, 0x00000000, 0x000000E6,
+0x00000301, 0x00000000, 0x000000D8, 0x00000301, 0x00000000, 0x000000F8,
+0x00000301, 0x00000000, 0x00000041, 0x0000030F, 0x00000000, 0x00000061,
+0x0000030F, 0x00000000, 0x00000041, 0x00000311, 0x00000000, 0x00000061,
+0x00000311, 0x00000000, 0x00000045, 0x0000030F, 0x00000000, 0x00000065,
+0x0000030F, 0x00000000, 0x00000045, 0x00000311, 0x00000000, 0x00000065,
+0x00000311, 0x00000000, 0x00000049, 0x0000030F, 0x00000000, 0x00000069,
+0x0000030F, 0x00000000, 0x00000049, 0x00000311, 0x00000000, 0x00000069,
+0x00000311, 0x00000000, 0x0000004F, 0x0000030F, 0x00000000, 0x0000006F,
+0x0000030F, 0x00000000, 0x0000004F, 0x00000311, 0x00000000, 0x0000006F,
+0x00000311, 0x00000000, 0x00000052, 0x0000030F, 0x00000000, 0x00000072,
+0x0000030F, 0x00000000, 0x00000052, 0x00000311, 0x00000000, 0x00000072,
+0x00000311, 0x00000000, 0x00000055, 0x0000030F, 0x00000000, 0x00000075,
+0x0000030F, 0x00000000, 0x00000055, 0x00000311, 0x00000000, 0x00000075,
+0x00000311, 0x00000000, 0x00000053, 0x00000326, 0x00000000, 0x00000073,
+0x00000326, 0x00000000, 0x00000054, 0x00000326, 0x00000000, 0x00000074,
+0x00000326, 0x00000000, 0x00000048, 0x0000030C, 0x00000000, 0x00000068,
+0x0000030C, 0x00000000, 0x00000041, 0x00000307, 0x00000000, 0x00000061,
+0x00000307, 0x00000000, 0x00000045, 0x00000327, 0x00000000, 0x00000065,
+0x00000327, 0x00000000, 0x000000D6, 0x00000304, 0x00000000, 0x000000F6,
+0x00000304, 0x00000000, 0x000000D5, 0x00000304, 0x00000000, 0x000000F5,
+0x00000304, 0x00000000, 0x0000004F, 0x00000307, 0x00000000, 0x0000006F,
+0x00000307, 0x00000000, 0x0000022E, 0x00000304, 0x00000000, 0x0000022F,
+0x00000304, 0x00000000, 0x00000059, 0x00000304, 0x00000000, 0x00000079,
+0x00000304, 0x00000000, 0x00000068, 0x00000000, 0x00000266, 0x00000000,
+0x0000006A, 0x00000000, 0x00000072, 0x00000000, 0x00000279, 0x00000000,
+0x0000027B, 0x00000000, 0x00000281, 0x00000000, 0x00000077, 0x00000000,
+0x00000079, 0x00000000, 0x00000020, 0x00000306, 0x00000000, 0x00000020,
+0x00000307, 0x00000000, 0x00000020, 0x0000030A, 0x00000000, 0x00000020,
+0x00000328, 0x00000000, 0x00000020, 0x00000303, 0x00000000, 0x00000020,
+0x0000030B, 0x00000000, 0x00000263, 0x00000000, 0x0000006C, 0x00000000,
+0x00000078, 0x00000000, 0x00000295, 0x00000000, 0x00000300, 0x00000000,
+0x00000301, 0x00000000, 0x00000313, 0x00000000, 0x00000308, 0x00000301,
+0x00000000, 0x000002B9, 0x00000000, 0x00000020, 0x00000345, 0x00000000,
+0x0000003B, 0x00000000, 0x000000A8, 0x00000301, 0x00000000, 0x00000391,
+0x00000301, 0x00000000, 0x000000B7, 0x00000000, 0x00000395, 0x00000301,
+0x00000000, 0x00000397, 0x00000301, 0x00000000, 0x00000399, 0x00000301,
+0x00000000, 0x0000039F, 0x00000301, 0x00000000, 0x000003A5, 0x00000301,
+0x00000000, 0x000003A9, 0x00000301, 0x00000000, 0x000003CA, 0x00000301,
+0x00000000, 0x00000399, 0x00000308, 0x00000000, 0x000003A5, 0x00000308,
+0x00000000, 0x000003B1, 0x00000301, 0x00000000, 0x000003B5, 0x00000301,
+0x00000000, 0x000003B7, 0x00000301, 0x00000000, 0x000003B9, 0x00000301,
+0x00000000, 0x000003CB, 0x00000301, 0x00000000, 0x000003B9, 0x00000308,
+0x00000000, 0x000003C5, 0x00000308, 0x00000000, 0x000003BF, 0x00000301,
+0x00000000, 0x000003C5, 0x00000301, 0x00000000, 0x000003C9, 0x00000301,
+0x00000000, 0x000003B2, 0x00000000, 0x000003B8, 0x00000000, 0x000003A5,
+0x00000000, 0x000003D2, 0x00000301, 0x00000000, 0x000003D2, 0x00000308,
+0x00000000, 0x000003C6, 0x00000000, 0x000003C0, 0x00000000, 0x000003BA,
+0x00000000, 0x000003C1, 0x00000000, 0x000003C2, 0x00000000, 0x00000398,
+0x00000000, 0x000003B5, 0x00000000, 0x000003A3, 0x00000000, 0x00000415,
+0x00000300, 0x00000000, 0x00000415, 0x00000308, 0x00000000, 0x00000413,
+0x00000301, 0x00000000, 0x00000406, 0x00000308, 0x00000000, 0x0000041A,
+0x00000301, 0x00000000, 0x00000418, 0x00000300, 0x00000000, 0x00000423,
+0x00000306, 0x00000000, 0x00000418, 0x00000306, 0x00000000, 0x00000438,
+0x00000306, 0x00000000, 0x00000435, 0x00000300, 0x00000000, 0x00000435,
+0x00000308, 0x00000000, 0x00000433, 0x00000301, 0x00000000, 0x00000456,
+0x00000308, 0x00000000, 0x0000043A, 0x00000301, 0x00000000, 0x00000438,
+0x00000300, 0x00000000, 0x00000443, 0x00000306, 0x00000000, 0x00000474,
+0x0000030F, 0x00000000, 0x00000475, 0x0000030F, 0x00000000, 0x00000416,
+0x00000306, 0x00000000, 0x00000436, 0x00000306, 0x00000000, 0x00000410,
+0x00000306, 0x00000000, 0x00000430, 0x00000306, 0x00000000, 0x00000410,
+0x00000308, 0x00000000, 0x00000430, 0x00000308, 0x00000000, 0x00000415,
+0x00000306, 0x00000000, 0x00000435, 0x00000306, 0x00000000, 0x000004D8,
+0x00000308, 0x00000000, 0x000004D9, 0x00000308, 0x00000000, 0x00000416,
+0x00000308, 0x00000000, 0x00000436, 0x00000308, 0x00000000, 0x00000417,
+0x00000308, 0x00000000, 0x00000437, 0x00000308, 0x00000000, 0x00000418,
+0x00000304, 0x00000000, 0x00000438, 0x00000304, 0x00000000, 0x00000418,
+0x00000308, 0x00000000, 0x00000438, 0x00000308, 0x00000000, 0x0000041E,
+0x00000308, 0x00000000, 0x0000043E, 0x00000308, 0x00000000, 0x000004E8,
+0x00000308, 0x00000000, 0x000004E9, 0x00000308, 0x00000000, 0x0000042D,
+0x00000308, 0x00000000, 0x0000044D, 0x00000308, 0x00000000, 0x00000423,
+0x00000304, 0x00000000, 0x00000443, 0x00000304, 0x00000000, 0x00000423,
+0x00000308, 0x00000000, 0x00000443, 0x00000308, 0x00000000, 0x00000423,
+0x0000030B, 0x00000000, 0x00000443, 0x0000030B, 0x00000000, 0x00000427,
+0x00000308, 0x00000000, 0x00000447, 0x00000308, 0x00000000, 0x0000042B,
+0x00000308, 0x00000000, 0x0000044B, 0x00000308, 0x00000000, 0x00000565,
+0x00000582, 0x00000000, 0x00000627, 0x00000653, 0x00000000, 0x00000627,
+0x00000654, 0x00000000, 0x00000648, 0x00000654, 0x00000000, 0x00000627,
+0x00000655, 0x00000000, 0x0000064A, 0x00000654, 0x00000000, 0x00000627,
+0x00000674, 0x00000000, 0x00000648, 0x00000674, 0x00000000, 0x000006C7,
+0x00000674, 0x00000000, 0x0000064A, 0x00000674, 0x00000000, 0x000006D5,
+0x00000654, 0x00000000, 0x000006C1, 0x00000654, 0x00000000, 0x000006D2,
+0x00000654, 0x00000000, 0x00000928, 0x0000093C, 0x00000000, 0x00000930,
+0x0000093C, 0x00000000, 0x00000933, 0x0000093C, 0x00000000, 0x00000915,
+0x0000093C, 0x00000000, 0x00000916, 0x0000093C, 0x00000000, 0x00000917,
+0x0000093C, 0x00000000, 0x0000091C, 0x0000093C, 0x00000000, 0x00000921,
+0x0000093C, 0x00000000, 0x00000922, 0x0000093C, 0x00000000, 0x0000092B,
+0x0000093C, 0x00000000, 0x0000092F, 0x0000093C, 0x00000000, 0x000009C7,
+0x000009BE, 0x00000000, 0x000009C7, 0x000009D7, 0x00000000, 0x000009A1,
+0x000009BC, 0x00000000, 0x000009A2, 0x000009BC, 0x00000000, 0x000009AF,
+0x000009BC, 0x00000000, 0x00000A32, 0x00000A3C, 0x00000000, 0x00000A38,
+0x00000A3C, 0x00000000, 0x00000A16, 0x00000A3C, 0x00000000, 0x00000A17,
+0x00000A3C, 0x00000000, 0x00000A1C, 0x00000A3C, 0x00000000, 0x00000A2B,
+0x00000A3C, 0x00000000, 0x00000B47, 0x00000B56, 0x00000000, 0x00000B47,
+0x00000B3E, 0x00000000, 0x00000B47, 0x00000B57, 0x00000000, 0x00000B21,
+0x00000B3C, 0x00000000, 0x00000B22, 0x00000B3C, 0x00000000, 0x00000B92,
+0x00000BD7, 0x00000000, 0x00000BC6, 0x00000BBE, 0x00000000, 0x00000BC7,
+0x00000BBE, 0x00000000, 0x00000BC6, 0x00000BD7, 0x00000000, 0x00000C46,
+0x00000C56, 0x00000000, 0x00000CBF, 0x00000CD5, 0x00000000, 0x00000CC6,
+0x00000CD5, 0x00000000, 0x00000CC6, 0x00000CD6, 0x00000000, 0x00000CC6,
+0x00000CC2, 0x00000000, 0x00000CCA, 0x00000CD5, 0x00000000, 0x00000D46,
+0x00000D3E, 0x00000000, 0x00000D47, 0x00000D3E, 0x00000000, 0x00000D46,
+0x00000D57, 0x00000000, 0x00000DD9, 0x00000DCA, 0x00000000, 0x00000DD9,
+0x00000DCF, 0x00000000, 0x00000DDC, 0x00000DCA, 0x00000000, 0x00000DD9,
+0x00000DDF, 0x00000000, 0x00000E4D, 0x00000E32, 0x00000000, 0x00000ECD,
+0x00000EB2, 0x00000000, 0x00000EAB, 0x00000E99, 0x00000000, 0x00000EAB,
+0x00000EA1, 0x00000000, 0x00000F0B, 0x00000000, 0x00000F42, 0x00000FB7,
+0x00000000, 0x00000F4C, 0x00000FB7, 0x00000000, 0x00000F51, 0x00000FB7,
+0x00000000, 0x00000F56, 0x00000FB7, 0x00000000, 0x00000F5B, 0x00000FB7,
+0x00000000, 0x00000F40, 0x00000FB5, 0x00000000, 0x00000F71, 0x00000F72,
+0x00000000, 0x00000F71, 0x00000F74, 0x00000000, 0x00000FB2, 0x00000F80,
+0x00000000, 0x00000FB2, 0x00000F81, 0x00000000, 0x00000FB3, 0x00000F80,
+0x00000000, 0x00000FB3, 0x00000F81, 0x00000000, 0x00000F71, 0x00000F80,
+0x00000000, 0x00000F92, 0x00000FB7, 0x00000000, 0x00000F9C, 0x00000FB7,
+0x00000000, 0x00000FA1, 0x00000FB7, 0x00000000, 0x00000FA6, 0x00000FB7,
+0x00000000, 0x00000FAB, 0x00000FB7, 0x00000000, 0x00000F90, 0x00000FB5,
+0x00000000, 0x00001025, 0x0000102E, 0x00000000, 0x000010DC, 0x00000000,
+0x00001B05, 0x00001B35, 0x00000000, 0x00001B07, 0x00001B35, 0x00000000,
+0x00001B09, 0x00001B35, 0x00000000, 0x00001B0B, 0x00001B35, 0x00000000,
+0x00001B0D, 0x00001B35, 0x00000000, 0x00001B11, 0x00001B35, 0x00000000,
+0x00001B3A, 0x00001B35, 0x00000000, 0x00001B3C, 0x00001B35, 0x00000000,
+0x00001B3E, 0x00001B35, 0x00000000, 0x00001B3F, 0x00001B35, 0x00000000,
+0x00001B42, 0x00001B35, 0x00000000, 0x00000041, 0x00000000, 0x000000C6,
+0x00000000, 0x00000042, 0x00000000, 0x00000044, 0x00000000, 0x00000045,
+0x00000000, 0x0000018E, 0x00000000, 0x00000047, 0x00000000, 0x00000048,
+0x00000000, 0x00000049, 0x00000000, 0x0000004A, 0x00000000, 0x0000004B,
+0x00000000, 0x0000004C, 0x00000000, 0x0000004D, 0x00000000, 0x0000004E,
+0x00000000, 0x0000004F, 0x00000000, 0x00000222, 0x00000000, 0x00000050,
+0x00000000, 0x00000052, 0x00000000, 0x00000054, 0x00000000, 0x00000055,
+0x00000000, 0x00000057, 0x00000000, 0x00000250, 0x00000000, 0x00000251,
+0x00000000, 0x00001D02, 0x00000000, 0x00000062, 0x00000000, 0x00000064,
+0x00000000, 0x00000065, 0x00000000, 0x00000259, 0x00000000, 0x0000025B,
+0x00000000, 0x0000025C, 0x00000000, 0x00000067, 0x00000000, 0x0000006B,
+0x00000000, 0x0000006D, 0x00000000, 0x0000014B, 0x00000000, 0x00000254,
+0x00000000, 0x00001D16, 0x00000000, 0x00001D17, 0x00000000, 0x00000070,
+0x00000000, 0x00000074, 0x00000000, 0x00000075, 0x00000000, 0x00001D1D,
+0x00000000, 0x0000026F, 0x00000000, 0x00000076, 0x00000000, 0x00001D25,
+0x00000000, 0x000003B3, 0x00000000, 0x000003B4, 0x00000000, 0x000003C7,
+0x00000000, 0x00000069, 0x00000000, 0x0000043D, 0x00000000, 0x00000252,
+0x00000000, 0x00000063, 0x00000000, 0x00000255, 0x00000000, 0x000000F0,
+0x00000000, 0x00000066, 0x00000000, 0x0000025F, 0x00000000, 0x00000261,
+0x00000000, 0x00000265, 0x00000000, 0x00000268, 0x00000000, 0x00000269,
+0x00000000, 0x0000026A, 0x00000000, 0x00001D7B, 0x00000000, 0x0000029D,
+0x00000000, 0x0000026D, 0x00000000, 0x00001D85, 0x00000000, 0x0000029F,
+0x00000000, 0x00000271, 0x00000000, 0x00000270, 0x00000000, 0x00000272,
+0x00000000, 0x00000273, 0x00000000, 0x00000274, 0x00000000, 0x00000275,
+0x00000000, 0x00000278, 0x00000000, 0x00000282, 0x00000000, 0x00000283,
+0x00000000, 0x000001AB, 0x00000000, 0x00000289, 0x00000000, 0x0000028A,
+0x00000000, 0x00001D1C, 0x00000000, 0x0000028B, 0x00000000, 0x0000028C,
+0x00000000, 0x0000007A, 0x00000000, 0x00000290, 0x00000000, 0x00000291,
+0x00000000, 0x00000292, 0x00000000, 0x00000041, 0x00000325, 0x00000000,
+0x00000061, 0x00000325, 0x00000000, 0x00000042, 0x00000307, 0x00000000,
+0x00000062, 0x00000307, 0x00000000, 0x00000042, 0x00000323, 0x00000000,
+0x00000062, 0x00000323, 0x00000000, 0x00000042, 0x00000331, 0x00000000,
+0x00000062, 0x00000331, 0x00000000, 0x000000C7, 0x00000301, 0x00000000,
+0x000000E7, 0x00000301, 0x00000000, 0x00000044, 0x00000307, 0x00000000,
+0x00000064, 0x00000307, 0x00000000, 0x00000044, 0x00000323, 0x00000000,
+0x00000064, 0x00000323, 0x00000000, 0x00000044, 0x00000331, 0x00000000,
+0x00000064, 0x00000331, 0x00000000, 0x00000044, 0x00000327, 0x00000000,
+0x00000064, 0x00000327, 0x00000000, 0x00000044, 0x0000032D, 0x00000000,
+0x00000064, 0x0000032D, 0x00000000, 0x00000112, 0x00000300, 0x00000000,
+0x00000113, 0x00000300, 0x00000000, 0x00000112, 0x00000301, 0x00000000,
+0x00000113, 0x00000301, 0x00000000, 0x00000045, 0x0000032D, 0x00000000,
+0x00000065, 0x0000032D, 0x00000000, 0x00000045, 0x00000330, 0x00000000,
+0x00000065, 0x00000330, 0x00000000, 0x00000228, 0x00000306, 0x00000000,
+0x00000229, 0x00000306, 0x00000000, 0x00000046, 0x00000307, 0x00000000,
+0x00000066, 0x00000307, 0x00000000, 0x00000047, 0x00000304, 0x00000000,
+0x00000067, 0x00000304, 0x00000000, 0x00000048, 0x00000307, 0x00000000,
+0x00000068, 0x00000307, 0x00000000, 0x00000048, 0x00000323, 0x00000000,
+0x00000068, 0x00000323, 0x00000000, 0x00000048, 0x00000308, 0x00000000,
+0x00000068, 0x00000308, 0x00000000, 0x00000048, 0x00000327, 0x00000000,
+0x00000068, 0x00000327, 0x00000000, 0x00000048, 0x0000032E, 0x00000000,
+0x00000068, 0x0000032E, 0x00000000, 0x00000049, 0x00000330, 0x00000000,
+0x00000069, 0x00000330, 0x00000000, 0x000000CF, 0x00000301, 0x00000000,
+0x000000EF, 0x00000301, 0x00000000, 0x0000004B, 0x00000301, 0x00000000,
+0x0000006B, 0x00000301, 0x00000000, 0x0000004B, 0x00000323, 0x00000000,
+0x0000006B, 0x00000323, 0x00000000, 0x0000004B, 0x00000331, 0x00000000,
+0x0000006B, 0x00000331, 0x00000000, 0x0000004C, 0x00000323, 0x00000000,
+0x0000006C, 0x00000323, 0x00000000, 0x00001E36, 0x00000304, 0x00000000,
+0x00001E37, 0x00000304, 0x00000000, 0x0000004C, 0x00000331, 0x00000000,
+0x0000006C, 0x00000331, 0x00000000, 0x0000004C, 0x0000032D, 0x00000000,
+0x0000006C, 0x0000032D, 0x00000000, 0x0000004D, 0x00000301, 0x00000000,
+0x0000006D, 0x00000301, 0x00000000, 0x0000004D, 0x00000307, 0x00000000,
+0x0000006D, 0x00000307, 0x00000000, 0x0000004D, 0x00000323, 0x00000000,
+0x0000006D, 0x00000323, 0x00000000, 0x0000004E, 0x00000307, 0x00000000,
+0x0000006E, 0x00000307, 0x00000000, 0x0000004E, 0x00000323, 0x00000000,
+0x0000006E, 0x00000323, 0x00000000, 0x0000004E, 0x00000331, 0x00000000,
+0x0000006E, 0x00000331, 0x00000000, 0x0000004E, 0x0000032D, 0x00000000,
+0x0000006E, 0x0000032D, 0x00000000, 0x000000D5, 0x00000301, 0x00000000,
+0x000000F5, 0x00000301, 0x00000000, 0x000000D5, 0x00000308, 0x00000000,
+0x000000F5, 0x00000308, 0x00000000, 0x0000014C, 0x00000300, 0x00000000,
+0x0000014D, 0x00000300, 0x00000000, 0x0000014C, 0x00000301, 0x00000000,
+0x0000014D, 0x00000301, 0x00000000, 0x00000050, 0x00000301, 0x00000000,
+0x00000070, 0x00000301, 0x00000000, 0x00000050, 0x00000307, 0x00000000,
+0x00000070, 0x00000307, 0x00000000, 0x00000052, 0x00000307, 0x00000000,
+0x00000072, 0x00000307, 0x00000000, 0x00000052, 0x00000323, 0x00000000,
+0x00000072, 0x00000323, 0x00000000, 0x00001E5A, 0x00000304, 0x00000000,
+0x00001E5B, 0x00000304, 0x00000000, 0x00000052, 0x00000331, 0x00000000,
+0x00000072, 0x00000331, 0x00000000, 0x00000053, 0x00000307, 0x00000000,
+0x00000073, 0x00000307, 0x00000000, 0x00000053, 0x00000323, 0x00000000,
+0x00000073, 0x00000323, 0x00000000, 0x0000015A, 0x00000307, 0x00000000,
+0x0000015B, 0x00000307, 0x00000000, 0x00000160, 0x00000307, 0x00000000,
+0x00000161, 0x00000307, 0x00000000, 0x00001E62, 0x00000307, 0x00000000,
+0x00001E63, 0x00000307, 0x00000000, 0x00000054, 0x00000307, 0x00000000,
+0x00000074, 0x00000307, 0x00000000, 0x00000054, 0x00000323, 0x00000000,
+0x00000074, 0x00000323, 0x00000000, 0x00000054, 0x00000331, 0x00000000,
+0x00000074, 0x00000331, 0x00000000, 0x00000054, 0x0000032D, 0x00000000,
+0x00000074, 0x0000032D, 0x00000000, 0x00000055, 0x00000324, 0x00000000,
+0x00000075, 0x00000324, 0x00000000, 0x00000055, 0x00000330, 0x00000000,
+0x00000075, 0x00000330, 0x00000000, 0x00000055, 0x0000032D, 0x00000000,
+0x00000075, 0x0000032D, 0x00000000, 0x00000168, 0x00000301, 0x00000000,
+0x00000169, 0x00000301, 0x00000000, 0x0000016A, 0x00000308, 0x00000000,
+0x0000016B, 0x00000308, 0x00000000, 0x00000056, 0x00000303, 0x00000000,
+0x00000076, 0x00000303, 0x00000000, 0x00000056, 0x00000323, 0x00000000,
+0x00000076, 0x00000323, 0x00000000, 0x00000057, 0x00000300, 0x00000000,
+0x00000077, 0x00000300, 0x00000000, 0x00000057, 0x00000301, 0x00000000,
+0x00000077, 0x00000301, 0x00000000, 0x00000057, 0x00000308, 0x00000000,
+0x00000077, 0x00000308, 0x00000000, 0x00000057, 0x00000307, 0x00000000,
+0x00000077, 0x00000307, 0x00000000, 0x00000057, 0x00000323, 0x00000000,
+0x00000077, 0x00000323, 0x00000000, 0x00000058, 0x00000307, 0x00000000,
+0x00000078, 0x00000307, 0x00000000, 0x00000058, 0x00000308, 0x00000000,
+0x00000078, 0x00000308, 0x00000000, 0x00000059, 0x00000307, 0x00000000,
+0x00000079, 0x00000307, 0x00000000, 0x0000005A, 0x00000302, 0x00000000,
+0x0000007A, 0x00000302, 0x00000000, 0x0000005A, 0x00000323, 0x00000000,
+0x0000007A, 0x00000323, 0x00000000, 0x0000005A, 0x00000331, 0x00000000,
+0x0000007A, 0x00000331, 0x00000000, 0x00000068, 0x00000331, 0x00000000,
+0x00000074, 0x00000308, 0x00000000, 0x00000077, 0x0000030A, 0x00000000,
+0x00000079, 0x0000030A, 0x00000000, 0x00000061, 0x000002BE, 0x00000000,
+0x0000017F, 0x00000307, 0x00000000, 0x00000041, 0x00000323, 0x00000000,
+0x00000061, 0x00000323, 0x00000000, 0x00000041, 0x00000309, 0x00000000,
+0x00000061, 0x00000309, 0x00000000, 0x000000C2, 0x00000301, 0x00000000,
+0x000000E2, 0x00000301, 0x00000000, 0x000000C2, 0x00000300, 0x00000000,
+0x000000E2, 0x00000300, 0x00000000, 0x000000C2, 0x00000309, 0x00000000,
+0x000000E2, 0x00000309, 0x00000000, 0x000000C2, 0x00000303, 0x00000000,
+0x000000E2, 0x00000303, 0x00000000, 0x00001EA0, 0x00000302, 0x00000000,
+0x00001EA1, 0x00000302, 0x00000000, 0x00000102, 0x00000301, 0x00000000,
+0x00000103, 0x00000301, 0x00000000, 0x00000102, 0x00000300, 0x00000000,
+0x00000103, 0x00000300, 0x00000000, 0x00000102, 0x00000309, 0x00000000,
+0x00000103, 0x00000309, 0x00000000, 0x00000102, 0x00000303, 0x00000000,
+0x00000103, 0x00000303, 0x00000000, 0x00001EA0, 0x00000306, 0x00000000,
+0x00001EA1, 0x00000306, 0x00000000, 0x00000045, 0x00000323, 0x00000000,
+0x00000065, 0x00000323, 0x00000000, 0x00000045, 0x00000309, 0x00000000,
+0x00000065, 0x00000309, 0x00000000, 0x00000045, 0x00000303, 0x00000000,
+0x00000065, 0x00000303, 0x00000000, 0x000000CA, 0x00000301, 0x00000000,
+0x000000EA, 0x00000301, 0x00000000, 0x000000CA, 0x00000300, 0x00000000,
+0x000000EA, 0x00000300, 0x00000000, 0x000000CA, 0x00000309, 0x00000000,
+0x000000EA, 0x00000309, 0x00000000, 0x000000CA, 0x00000303, 0x00000000,
+0x000000EA, 0x00000303, 0x00000000, 0x00001EB8, 0x00000302, 0x00000000,
+0x00001EB9, 0x00000302, 0x00000000, 0x00000049, 0x00000309, 0x00000000,
+0x00000069, 0x00000309, 0x00000000, 0x00000049, 0x00000323, 0x00000000,
+0x00000069, 0x00000323, 0x00000000, 0x0000004F, 0x00000323, 0x00000000,
+0x0000006F, 0x00000323, 0x00000000, 0x0000004F, 0x00000309, 0x00000000,
+0x0000006F, 0x00000309, 0x00000000, 0x000000D4, 0x00000301, 0x00000000,
+0x000000F4, 0x00000301, 0x00000000, 0x000000D4, 0x00000300, 0x00000000,
+0x000000F4, 0x00000300, 0x00000000, 0x000000D4, 0x00000309, 0x00000000,
+0x000000F4, 0x00000309, 0x00000000, 0x000000D4, 0x00000303, 0x00000000,
+0x000000F4, 0x00000303, 0x00000000, 0x00001ECC, 0x00000302, 0x00000000,
+0x00001ECD, 0x00000302, 0x00000000, 0x000001A0, 0x00000301, 0x00000000,
+0x000001A1, 0x00000301, 0x00000000, 0x000001A0, 0x00000300, 0x00000000,
+0x000001A1, 0x00000300, 0x00000000, 0x000001A0, 0x00000309, 0x00000000,
+0x000001A1, 0x00000309, 0x00000000, 0x000001A0, 0x00000303, 0x00000000,
+0x000001A1, 0x00000303, 0x00000000, 0x000001A0, 0x00000323, 0x00000000,
+0x000001A1, 0x00000323, 0x00000000, 0x00000055, 0x00000323, 0x00000000,
+0x00000075, 0x00000323, 0x00000000, 0x00000055, 0x00000309, 0x00000000,
+0x00000075, 0x00000309, 0x00000000, 0x000001AF, 0x00000301, 0x00000000,
+0x000001B0, 0x00000301, 0x00000000, 0x000001AF, 0x00000300, 0x00000000,
+0x000001B0, 0x00000300, 0x00000000, 0x000001AF, 0x00000309, 0x00000000,
+0x000001B0, 0x00000309, 0x00000000, 0x000001AF, 0x00000303, 0x00000000,
+0x000001B0, 0x00000303, 0x00000000, 0x000001AF, 0x00000323, 0x00000000,
+0x000001B0, 0x00000323, 0x00000000, 0x00000059, 0x00000300, 0x00000000,
+0x00000079, 0x00000300, 0x00000000, 0x00000059, 0x00000323, 0x00000000,
+0x00000079, 0x00000323, 0x00000000, 0x00000059, 0x00000309, 0x00000000,
+0x00000079, 0x00000309, 0x00000000, 0x00000059, 0x00000303, 0x00000000,
+0x00000079, 0x00000303, 0x00000000, 0x000003B1, 0x00000313, 0x00000000,
+0x000003B1, 0x00000314, 0x00000000, 0x00001F00, 0x00000300, 0x00000000,
+0x00001F01, 0x00000300, 0x00000000, 0x00001F00, 0x00000301, 0x00000000,
+0x00001F01, 0x00000301, 0x00000000, 0x00001F00, 0x00000342, 0x00000000,
+0x00001F01, 0x00000342, 0x00000000, 0x00000391, 0x00000313, 0x00000000,
+0x00000391, 0x00000314, 0x00000000, 0x00001F08, 0x00000300, 0x00000000,
+0x00001F09, 0x00000300, 0x00000000, 0x00001F08, 0x00000301, 0x00000000,
+0x00001F09, 0x00000301, 0x00000000, 0x00001F08, 0x00000342, 0x00000000,
+0x00001F09, 0x00000342, 0x00000000, 0x000003B5, 0x00000313, 0x00000000,
+0x000003B5, 0x00000314, 0x00000000, 0x00001F10, 0x00000300, 0x00000000,
+0x00001F11, 0x00000300, 0x00000000, 0x00001F10, 0x00000301, 0x00000000,
+0x00001F11, 0x00000301, 0x00000000, 0x00000395, 0x00000313, 0x00000000,
+0x00000395, 0x00000314, 0x00000000, 0x00001F18, 0x00000300, 0x00000000,
+0x00001F19, 0x00000300, 0x00000000, 0x00001F18, 0x00000301, 0x00000000,
+0x00001F19, 0x00000301, 0x00000000, 0x000003B7, 0x00000313, 0x00000000,
+0x000003B7, 0x00000314, 0x00000000, 0x00001F20, 0x00000300, 0x00000000,
+0x00001F21, 0x00000300, 0x00000000, 0x00001F20, 0x00000301, 0x00000000,
+0x00001F21, 0x00000301, 0x00000000, 0x00001F20, 0x00000342, 0x00000000,
+0x00001F21, 0x00000342, 0x00000000, 0x00000397, 0x00000313, 0x00000000,
+0x00000397, 0x00000314, 0x00000000, 0x00001F28, 0x00000300, 0x00000000,
+0x00001F29, 0x00000300, 0x00000000, 0x00001F28, 0x00000301, 0x00000000,
+0x00001F29, 0x00000301, 0x00000000, 0x00001F28, 0x00000342, 0x00000000,
+0x00001F29, 0x00000342, 0x00000000, 0x000003B9, 0x00000313, 0x00000000,
+0x000003B9, 0x00000314, 0x00000000, 0x00001F30, 0x00000300, 0x00000000,
+0x00001F31, 0x00000300, 0x00000000, 0x00001F30, 0x00000301, 0x00000000,
+0x00001F31, 0x00000301, 0x00000000, 0x00001F30, 0x00000342, 0x00000000,
+0x00001F31, 0x00000342, 0x00000000, 0x00000399, 0x00000313, 0x00000000,
+0x00000399, 0x00000314, 0x00000000, 0x00001F38, 0x00000300, 0x00000000,
+0x00001F39, 0x00000300, 0x00000000, 0x00001F38, 0x00000301, 0x00000000,
+0x00001F39, 0x00000301, 0x00000000, 0x00001F38, 0x00000342, 0x00000000,
+0x00001F39, 0x00000342, 0x00000000, 0x000003BF, 0x00000313, 0x00000000,
+0x000003BF, 0x00000314, 0x00000000, 0x00001F40, 0x00000300, 0x00000000,
+0x00001F41, 0x00000300, 0x00000000, 0x00001F40, 0x00000301, 0x00000000,
+0x00001F41, 0x00000301, 0x00000000, 0x0000039F, 0x00000313, 0x00000000,
+0x0000039F, 0x00000314, 0x00000000, 0x00001F48, 0x00000300, 0x00000000,
+0x00001F49, 0x00000300, 0x00000000, 0x00001F48, 0x00000301, 0x00000000,
+0x00001F49, 0x00000301, 0x00000000, 0x000003C5, 0x00000313, 0x00000000,
+0x000003C5, 0x00000314, 0x00000000, 0x00001F50, 0x00000300, 0x00000000,
+0x00001F51, 0x00000300, 0x00000000, 0x00001F50, 0x00000301, 0x00000000,
+0x00001F51, 0x00000301, 0x00000000, 0x00001F50, 0x00000342, 0x00000000,
+0x00001F51, 0x00000342, 0x00000000, 0x000003A5, 0x00000314, 0x00000000,
+0x00001F59, 0x00000300, 0x00000000, 0x00001F59, 0x00000301, 0x00000000,
+0x00001F59, 0x00000342, 0x00000000, 0x000003C9, 0x00000313, 0x00000000,
+0x000003C9, 0x00000314, 0x00000000, 0x00001F60, 0x00000300, 0x00000000,
+0x00001F61, 0x00000300, 0x00000000, 0x00001F60, 0x00000301, 0x00000000,
+0x00001F61, 0x00000301, 0x00000000, 0x00001F60, 0x00000342, 0x00000000,
+0x00001F61, 0x00000342, 0x00000000, 0x000003A9, 0x00000313, 0x00000000,
+0x000003A9, 0x00000314, 0x00000000, 0x00001F68, 0x00000300, 0x00000000,
+0x00001F69, 0x00000300, 0x00000000, 0x00001F68, 0x00000301, 0x00000000,
+0x00001F69, 0x00000301, 0x00000000, 0x00001F68, 0x00000342, 0x00000000,
+0x00001F69, 0x00000342, 0x00000000, 0x000003B1, 0x00000300, 0x00000000,
+0x000003AC, 0x00000000, 0x000003B5, 0x00000300, 0x00000000, 0x000003AD,
+0x00000000, 0x000003B7, 0x00000300, 0x00000000, 0x000003AE, 0x00000000,
+0x000003B9, 0x00000300, 0x00000000, 0x000003AF, 0x00000000, 0x000003BF,
+0x00000300, 0x00000000, 0x000003CC, 0x00000000, 0x000003C5, 0x00000300,
+0x00000000, 0x000003CD, 0x00000000, 0x000003C9, 0x00000300, 0x00000000,
+0x000003CE, 0x00000000, 0x00001F00, 0x00000345, 0x00000000, 0x00001F01,
+0x00000345, 0x00000000, 0x00001F02, 0x00000345, 0x00000000, 0x00001F03,
+0x00000345, 0x00000000, 0x00001F04, 0x00000345, 0x00000000, 0x00001F05,
+0x00000345, 0x00000000, 0x00001F06, 0x00000345, 0x00000000, 0x00001F07,
+0x00000345, 0x00000000, 0x00001F08, 0x00000345, 0x00000000, 0x00001F09,
+0x00000345, 0x00000000, 0x00001F0A, 0x00000345, 0x00000000, 0x00001F0B,
+0x00000345, 0x00000000, 0x00001F0C, 0x00000345, 0x00000000, 0x00001F0D,
+0x00000345, 0x00000000, 0x00001F0E, 0x00000345, 0x00000000, 0x00001F0F,
+0x00000345, 0x00000000, 0x00001F20, 0x00000345, 0x00000000, 0x00001F21,
+0x00000345, 0x00000000, 0x00001F22, 0x00000345, 0x00000000, 0x00001F23,
+0x00000345, 0x00000000, 0x00001F24, 0x00000345, 0x00000000, 0x00001F25,
+0x00000345, 0x00000000, 0x00001F26, 0x00000345, 0x00000000, 0x00001F27,
+0x00000345, 0x00000000, 0x00001F28, 0x00000345, 0x00000000, 0x00001F29,
+0x00000345, 0x00000000, 0x00001F2A, 0x00000345, 0x00000000, 0x00001F2B,
+0x00000345, 0x00000000, 0x00001F2C, 0x00000345, 0x00000000, 0x00001F2D,
+0x00000345, 0x00000000, 0x00001F2E, 0x00000345, 0x00000000, 0x00001F2F,
+0x00000345, 0x00000000, 0x00001F60, 0x00000345, 0x00000000, 0x00001F61,
+0x00000345, 0x00000000, 0x00001F62, 0x00000345, 0x00000000, 0x00001F63,
+0x00000345, 0x00000000, 0x00001F64, 0x00000345, 0x00000000, 0x00001F65,
+0x00000345, 0x00000000, 0x00001F66, 0x00000345, 0x00000000, 0x00001F67,
+0x00000345, 0x00000000, 0x00001F68, 0x00000345, 0x00000000, 0x00001F69,
+0x00000345, 0x00000000, 0x00001F6A, 0x00000345, 0x00000000, 0x00001F6B,
+0x00000345, 0x00000000, 0x00001F6C, 0x00000345, 0x00000000, 0x00001F6D,
+0x00000345, 0x00000000, 0x00001F6E, 0x00000345, 0x00000000, 0x00001F6F,
+0x00000345, 0x00000000, 0x000003B1, 0x00000306, 0x00000000, 0x000003B1,
+0x00000304, 0x00000000, 0x00001F70, 0x00000345, 0x00000000, 0x000003B1,
+0x00000345, 0x00000000, 0x000003AC, 0x00000345, 0x00000000, 0x000003B1,
+0x00000342, 0x00000000, 0x00001FB6, 0x00000345, 0x00000000, 0x00000391,
+0x00000306, 0x00000000, 0x00000391, 0x00000304, 0x00000000, 0x00000391,
+0x00000300, 0x00000000, 0x00000386, 0x00000000, 0x00000391, 0x00000345,
+0x00000000, 0x00000020, 0x00000313, 0x00000000, 0x000003B9, 0x00000000,
+0x00000020, 0x00000342, 0x00000000, 0x000000A8, 0x00000342, 0x00000000,
+0x00001F74, 0x00000345, 0x00000000, 0x000003B7, 0x00000345, 0x00000000,
+0x000003AE, 0x00000345, 0x00000000, 0x000003B7, 0x00000342, 0x00000000,
+0x00001FC6, 0x00000345, 0x00000000, 0x00000395, 0x00000300, 0x00000000,
+0x00000388, 0x00000000, 0x00000397, 0x00000300, 0x00000000, 0x00000389,
+0x00000000, 0x00000397, 0x00000345, 0x00000000, 0x00001FBF, 0x00000300,
+0x00000000, 0x00001FBF, 0x00000301, 0x00000000, 0x00001FBF, 0x00000342,
+0x00000000, 0x000003B9, 0x00000306, 0x00000000, 0x000003B9, 0x00000304,
+0x00000000, 0x000003CA, 0x00000300, 0x00000000, 0x00000390, 0x00000000,
+0x000003B9, 0x00000342, 0x00000000, 0x000003CA, 0x00000342, 0x00000000,
+0x00000399, 0x00000306, 0x00000000, 0x00000399, 0x00000304, 0x00000000,
+0x00000399, 0x00000300, 0x00000000, 0x0000038A, 0x00000000, 0x00001FFE,
+0x00000300, 0x00000000, 0x00001FFE, 0x00000301, 0x00000000, 0x00001FFE,
+0x00000342, 0x00000000, 0x000003C5, 0x00000306, 0x00000000, 0x000003C5,
+0x00000304, 0x00000000, 0x000003CB, 0x00000300, 0x00000000, 0x000003B0,
+0x00000000, 0x000003C1, 0x00000313, 0x00000000, 0x000003C1, 0x00000314,
+0x00000000, 0x000003C5, 0x00000342, 0x00000000, 0x000003CB, 0x00000342,
+0x00000000, 0x000003A5, 0x00000306, 0x00000000, 0x000003A5, 0x00000304,
+0x00000000, 0x000003A5, 0x00000300, 0x00000000, 0x0000038E, 0x00000000,
+0x000003A1, 0x00000314, 0x00000000, 0x000000A8, 0x00000300, 0x00000000,
+0x00000385, 0x00000000, 0x00000060, 0x00000000, 0x00001F7C, 0x00000345,
+0x00000000, 0x000003C9, 0x00000345, 0x00000000, 0x000003CE, 0x00000345,
+0x00000000, 0x000003C9, 0x00000342, 0x00000000, 0x00001FF6, 0x00000345,
+0x00000000, 0x0000039F, 0x00000300, 0x00000000, 0x0000038C, 0x00000000,
+0x000003A9, 0x00000300, 0x00000000, 0x0000038F, 0x00000000, 0x000003A9,
+0x00000345, 0x00000000, 0x000000B4, 0x00000000, 0x00000020, 0x00000314,
+0x00000000, 0x00002002, 0x00000000, 0x00002003, 0x00000000, 0x00002010,
+0x00000000, 0x00000020, 0x00000333, 0x00000000, 0x0000002E, 0x00000000,
+0x0000002E, 0x0000002E, 0x00000000, 0x0000002E, 0x0000002E, 0x0000002E,
+0x00000000, 0x00002032, 0x00002032, 0x00000000, 0x00002032, 0x00002032,
+0x00002032, 0x00000000, 0x00002035, 0x00002035, 0x00000000, 0x00002035,
+0x00002035, 0x00002035, 0x00000000, 0x00000021, 0x00000021, 0x00000000,
+0x00000020, 0x00000305, 0x00000000, 0x0000003F, 0x0000003F, 0x00000000,
+0x0000003F, 0x00000021, 0x00000000, 0x00000021, 0x0000003F, 0x00000000,
+0x00002032, 0x00002032, 0x00002032, 0x00002032, 0x00000000, 0x00000030,
+0x00000000, 0x00000034, 0x00000000, 0x00000035, 0x00000000, 0x00000036,
+0x00000000, 0x00000037, 0x00000000, 0x00000038, 0x00000000, 0x00000039,
+0x00000000, 0x0000002B, 0x00000000, 0x00002212, 0x00000000, 0x0000003D,
+0x00000000, 0x00000028, 0x00000000, 0x00000029, 0x00000000, 0x0000006E,
+0x00000000, 0x00000052, 0x00000073, 0x00000000, 0x00000061, 0x0000002F,
+0x00000063, 0x00000000, 0x00000061, 0x0000002F, 0x00000073, 0x00000000,
+0x00000043, 0x00000000, 0x000000B0, 0x00000043, 0x00000000, 0x00000063,
+0x0000002F, 0x0000006F, 0x00000000, 0x00000063, 0x0000002F, 0x00000075,
+0x00000000, 0x00000190, 0x00000000, 0x000000B0, 0x00000046, 0x00000000,
+0x00000127, 0x00000000, 0x0000004E, 0x0000006F, 0x00000000, 0x00000051,
+0x00000000, 0x00000053, 0x0000004D, 0x00000000, 0x00000054, 0x00000045,
+0x0000004C, 0x00000000, 0x00000054, 0x0000004D, 0x00000000, 0x0000005A,
+0x00000000, 0x000003A9, 0x00000000, 0x000000C5, 0x00000000, 0x00000046,
+0x00000000, 0x000005D0, 0x00000000, 0x000005D1, 0x00000000, 0x000005D2,
+0x00000000, 0x000005D3, 0x00000000, 0x00000046, 0x00000041, 0x00000058,
+0x00000000, 0x00000393, 0x00000000, 0x000003A0, 0x00000000, 0x00002211,
+0x00000000, 0x00000031, 0x00002044, 0x00000037, 0x00000000, 0x00000031,
+0x00002044, 0x00000039, 0x00000000, 0x00000031, 0x00002044, 0x00000031,
+0x00000030, 0x00000000, 0x00000031, 0x00002044, 0x00000033, 0x00000000,
+0x00000032, 0x00002044, 0x00000033, 0x00000000, 0x00000031, 0x00002044,
+0x00000035, 0x00000000, 0x00000032, 0x00002044, 0x00000035, 0x00000000,
+0x00000033, 0x00002044, 0x00000035, 0x00000000, 0x00000034, 0x00002044,
+0x00000035, 0x00000000, 0x00000031, 0x00002044, 0x00000036, 0x00000000,
+0x00000035, 0x00002044, 0x00000036, 0x00000000, 0x00000031, 0x00002044,
+0x00000038, 0x00000000, 0x00000033, 0x00002044, 0x00000038, 0x00000000,
+0x00000035, 0x00002044, 0x00000038, 0x00000000, 0x00000037, 0x00002044,
+0x00000038, 0x00000000, 0x00000031, 0x00002044, 0x00000000, 0x00000049,
+0x00000049, 0x00000000, 0x00000049, 0x00000049, 0x00000049, 0x00000000,
+0x00000049, 0x00000056, 0x00000000, 0x00000056, 0x00000000, 0x00000056,
+0x00000049, 0x00000000, 0x00000056, 0x00000049, 0x00000049, 0x00000000,
+0x00000056, 0x00000049, 0x00000049, 0x00000049, 0x00000000, 0x00000049,
+0x00000058, 0x00000000, 0x00000058, 0x00000000, 0x00000058, 0x00000049,
+0x00000000, 0x00000058, 0x00000049, 0x00000049, 0x00000000, 0x00000069,
+0x00000069, 0x00000000, 0x00000069, 0x00000069, 0x00000069, 0x00000000,
+0x00000069, 0x00000076, 0x00000000, 0x00000076, 0x00000069, 0x00000000,
+0x00000076, 0x00000069, 0x00000069, 0x00000000, 0x00000076, 0x00000069,
+0x00000069, 0x00000069, 0x00000000, 0x00000069, 0x00000078, 0x00000000,
+0x00000078, 0x00000069, 0x00000000, 0x00000078, 0x00000069, 0x00000069,
+0x00000000, 0x00000030, 0x00002044, 0x00000033, 0x00000000, 0x00002190,
+0x00000338, 0x00000000, 0x00002192, 0x00000338, 0x00000000, 0x00002194,
+0x00000338, 0x00000000, 0x000021D0, 0x00000338, 0x00000000, 0x000021D4,
+0x00000338, 0x00000000, 0x000021D2, 0x00000338, 0x00000000, 0x00002203,
+0x00000338, 0x00000000, 0x00002208, 0x00000338, 0x00000000, 0x0000220B,
+0x00000338, 0x00000000, 0x00002223, 0x00000338, 0x00000000, 0x00002225,
+0x00000338, 0x00000000, 0x0000222B, 0x0000222B, 0x00000000, 0x0000222B,
+0x0000222B, 0x0000222B, 0x00000000, 0x0000222E, 0x0000222E, 0x00000000,
+0x0000222E, 0x0000222E, 0x0000222E, 0x00000000, 0x0000223C, 0x00000338,
+0x00000000, 0x00002243, 0x00000338, 0x00000000, 0x00002245, 0x00000338,
+0x00000000, 0x00002248, 0x00000338, 0x00000000, 0x0000003D, 0x00000338,
+0x00000000, 0x00002261, 0x00000338, 0x00000000, 0x0000224D, 0x00000338,
+0x00000000, 0x0000003C, 0x00000338, 0x00000000, 0x0000003E, 0x00000338,
+0x00000000, 0x00002264, 0x00000338, 0x00000000, 0x00002265, 0x00000338,
+0x00000000, 0x00002272, 0x00000338, 0x00000000, 0x00002273, 0x00000338,
+0x00000000, 0x00002276, 0x00000338, 0x00000000, 0x00002277, 0x00000338,
+0x00000000, 0x0000227A, 0x00000338, 0x00000000, 0x0000227B, 0x00000338,
+0x00000000, 0x00002282, 0x00000338, 0x00000000, 0x00002283, 0x00000338,
+0x00000000, 0x00002286, 0x00000338, 0x00000000, 0x00002287, 0x00000338,
+0x00000000, 0x000022A2, 0x00000338, 0x00000000, 0x000022A8, 0x00000338,
+0x00000000, 0x000022A9, 0x00000338, 0x00000000, 0x000022AB, 0x00000338,
+0x00000000, 0x0000227C, 0x00000338, 0x00000000, 0x0000227D, 0x00000338,
+0x00000000, 0x00002291, 0x00000338, 0x00000000, 0x00002292, 0x00000338,
+0x00000000, 0x000022B2, 0x00000338, 0x00000000, 0x000022B3, 0x00000338,
+0x00000000, 0x000022B4, 0x00000338, 0x00000000, 0x000022B5, 0x00000338,
+0x00000000, 0x00003008, 0x00000000, 0x00003009, 0x00000000, 0x00000031,
+0x00000030, 0x00000000, 0x00000031, 0x00000031, 0x00000000, 0x00000031,
+0x00000032, 0x00000000, 0x00000031, 0x00000033, 0x00000000, 0x00000031,
+0x00000034, 0x00000000, 0x00000031, 0x00000035, 0x00000000, 0x00000031,
+0x00000036, 0x00000000, 0x00000031, 0x00000037, 0x00000000, 0x00000031,
+0x00000038, 0x00000000, 0x00000031, 0x00000039, 0x00000000, 0x00000032,
+0x00000030, 0x00000000, 0x00000028, 0x00000031, 0x00000029, 0x00000000,
+0x00000028, 0x00000032, 0x00000029, 0x00000000, 0x00000028, 0x00000033,
+0x00000029, 0x00000000, 0x00000028, 0x00000034, 0x00000029, 0x00000000,
+0x00000028, 0x00000035, 0x00000029, 0x00000000, 0x00000028, 0x00000036,
+0x00000029, 0x00000000, 0x00000028, 0x00000037, 0x00000029, 0x00000000,
+0x00000028, 0x00000038, 0x00000029, 0x00000000, 0x00000028, 0x00000039,
+0x00000029, 0x00000000, 0x00000028, 0x00000031, 0x00000030, 0x00000029,
+0x00000000, 0x00000028, 0x00000031, 0x00000031, 0x00000029, 0x00000000,
+0x00000028, 0x00000031, 0x00000032, 0x00000029, 0x00000000, 0x00000028,
+0x00000031, 0x00000033, 0x00000029, 0x00000000, 0x00000028, 0x00000031,
+0x00000034, 0x00000029, 0x00000000, 0x00000028, 0x00000031, 0x00000035,
+0x00000029, 0x00000000, 0x00000028, 0x00000031, 0x00000036, 0x00000029,
+0x00000000, 0x00000028, 0x00000031, 0x00000037, 0x00000029, 0x00000000,
+0x00000028, 0x00000031, 0x00000038, 0x00000029, 0x00000000, 0x00000028,
+0x00000031, 0x00000039, 0x00000029, 0x00000000, 0x00000028, 0x00000032,
+0x00000030, 0x00000029, 0x00000000, 0x00000031, 0x0000002E, 0x00000000,
+0x00000032, 0x0000002E, 0x00000000, 0x00000033, 0x0000002E, 0x00000000,
+0x00000034, 0x0000002E, 0x00000000, 0x00000035, 0x0000002E, 0x00000000,
+0x00000036, 0x0000002E, 0x00000000, 0x00000037, 0x0000002E, 0x00000000,
+0x00000038, 0x0000002E, 0x00000000, 0x00000039, 0x0000002E, 0x00000000,
+0x00000031, 0x00000030, 0x0000002E, 0x00000000, 0x00000031, 0x00000031,
+0x0000002E, 0x00000000, 0x00000031, 0x00000032, 0x0000002E, 0x00000000,
+0x00000031, 0x00000033, 0x0000002E, 0x00000000, 0x00000031, 0x00000034,
+0x0000002E, 0x00000000, 0x00000031, 0x00000035, 0x0000002E, 0x00000000,
+0x00000031, 0x00000036, 0x0000002E, 0x00000000, 0x00000031, 0x00000037,
+0x0000002E, 0x00000000, 0x00000031, 0x00000038, 0x0000002E, 0x00000000,
+0x00000031, 0x00000039, 0x0000002E, 0x00000000, 0x00000032, 0x00000030,
+0x0000002E, 0x00000000, 0x00000028, 0x00000061, 0x00000029, 0x00000000,
+0x00000028, 0x00000062, 0x00000029, 0x00000000, 0x00000028, 0x00000063,
+0x00000029, 0x00000000, 0x00000028, 0x00000064, 0x00000029, 0x00000000,
+0x00000028, 0x00000065, 0x00000029, 0x00000000, 0x00000028, 0x00000066,
+0x00000029, 0x00000000, 0x00000028, 0x00000067, 0x00000029, 0x00000000,
+0x00000028, 0x00000068, 0x00000029, 0x00000000, 0x00000028, 0x00000069,
+0x00000029, 0x00000000, 0x00000028, 0x0000006A, 0x00000029, 0x00000000,
+0x00000028, 0x0000006B, 0x00000029, 0x00000000, 0x00000028, 0x0000006C,
+0x00000029, 0x00000000, 0x00000028, 0x0000006D, 0x00000029, 0x00000000,
+0x00000028, 0x0000006E, 0x00000029, 0x00000000, 0x00000028, 0x0000006F,
+0x00000029, 0x00000000, 0x00000028, 0x00000070, 0x00000029, 0x00000000,
+0x00000028, 0x00000071, 0x00000029, 0x00000000, 0x00000028, 0x00000072,
+0x00000029, 0x00000000, 0x00000028, 0x00000073, 0x00000029, 0x00000000,
+0x00000028, 0x00000074, 0x00000029, 0x00000000, 0x00000028, 0x00000075,
+0x00000029, 0x00000000, 0x00000028, 0x00000076, 0x00000029, 0x00000000,
+0x00000028, 0x00000077, 0x00000029, 0x00000000, 0x00000028, 0x00000078,
+0x00000029, 0x00000000, 0x00000028, 0x00000079, 0x00000029, 0x00000000,
+0x00000028, 0x0000007A, 0x00000029, 0x00000000, 0x00000053, 0x00000000,
+0x00000059, 0x00000000, 0x00000071, 0x00000000, 0x0000222B, 0x0000222B,
+0x0000222B, 0x0000222B, 0x00000000, 0x0000003A, 0x0000003A, 0x0000003D,
+0x00000000, 0x0000003D, 0x0000003D, 0x00000000, 0x0000003D, 0x0000003D,
+0x0000003D, 0x00000000, 0x00002ADD, 0x00000338, 0x00000000, 0x00002D61,
+0x00000000, 0x00006BCD, 0x00000000, 0x00009F9F, 0x00000000, 0x00004E00,
+0x00000000, 0x00004E28, 0x00000000, 0x00004E36, 0x00000000, 0x00004E3F,
+0x00000000, 0x00004E59, 0x00000000, 0x00004E85, 0x00000000, 0x00004E8C,
+0x00000000, 0x00004EA0, 0x00000000, 0x00004EBA, 0x00000000, 0x0000513F,
+0x00000000, 0x00005165, 0x00000000, 0x0000516B, 0x00000000, 0x00005182,
+0x00000000, 0x00005196, 0x00000000, 0x000051AB, 0x00000000, 0x000051E0,
+0x00000000, 0x000051F5, 0x00000000, 0x00005200, 0x00000000, 0x0000529B,
+0x00000000, 0x000052F9, 0x00000000, 0x00005315, 0x00000000, 0x0000531A,
+0x00000000, 0x00005338, 0x00000000, 0x00005341, 0x00000000, 0x0000535C,
+0x00000000, 0x00005369, 0x00000000, 0x00005382, 0x00000000, 0x000053B6,
+0x00000000, 0x000053C8, 0x00000000, 0x000053E3, 0x00000000, 0x000056D7,
+0x00000000, 0x0000571F, 0x00000000, 0x000058EB, 0x00000000, 0x00005902,
+0x00000000, 0x0000590A, 0x00000000, 0x00005915, 0x00000000, 0x00005927,
+0x00000000, 0x00005973, 0x00000000, 0x00005B50, 0x00000000, 0x00005B80,
+0x00000000, 0x00005BF8, 0x00000000, 0x00005C0F, 0x00000000, 0x00005C22,
+0x00000000, 0x00005C38, 0x00000000, 0x00005C6E, 0x00000000, 0x00005C71,
+0x00000000, 0x00005DDB, 0x00000000, 0x00005DE5, 0x00000000, 0x00005DF1,
+0x00000000, 0x00005DFE, 0x00000000, 0x00005E72, 0x00000000, 0x00005E7A,
+0x00000000, 0x00005E7F, 0x00000000, 0x00005EF4, 0x00000000, 0x00005EFE,
+0x00000000, 0x00005F0B, 0x00000000, 0x00005F13, 0x00000000, 0x00005F50,
+0x00000000, 0x00005F61, 0x00000000, 0x00005F73, 0x00000000, 0x00005FC3,
+0x00000000, 0x00006208, 0x00000000, 0x00006236, 0x00000000, 0x0000624B,
+0x00000000, 0x0000652F, 0x00000000, 0x00006534, 0x00000000, 0x00006587,
+0x00000000, 0x00006597, 0x00000000, 0x000065A4, 0x00000000, 0x000065B9,
+0x00000000, 0x000065E0, 0x00000000, 0x000065E5, 0x00000000, 0x000066F0,
+0x00000000, 0x00006708, 0x00000000, 0x00006728, 0x00000000, 0x00006B20,
+0x00000000, 0x00006B62, 0x00000000, 0x00006B79, 0x00000000, 0x00006BB3,
+0x00000000, 0x00006BCB, 0x00000000, 0x00006BD4, 0x00000000, 0x00006BDB,
+0x00000000, 0x00006C0F, 0x00000000, 0x00006C14, 0x00000000, 0x00006C34,
+0x00000000, 0x0000706B, 0x00000000, 0x0000722A, 0x00000000, 0x00007236,
+0x00000000, 0x0000723B, 0x00000000, 0x0000723F, 0x00000000, 0x00007247,
+0x00000000, 0x00007259, 0x00000000, 0x0000725B, 0x00000000, 0x000072AC,
+0x00000000, 0x00007384, 0x00000000, 0x00007389, 0x00000000, 0x000074DC,
+0x00000000, 0x000074E6, 0x00000000, 0x00007518, 0x00000000, 0x0000751F,
+0x00000000, 0x00007528, 0x00000000, 0x00007530, 0x00000000, 0x0000758B,
+0x00000000, 0x00007592, 0x00000000, 0x00007676, 0x00000000, 0x0000767D,
+0x00000000, 0x000076AE, 0x00000000, 0x000076BF, 0x00000000, 0x000076EE,
+0x00000000, 0x000077DB, 0x00000000, 0x000077E2, 0x00000000, 0x000077F3,
+0x00000000, 0x0000793A, 0x00000000, 0x000079B8, 0x00000000, 0x000079BE,
+0x00000000, 0x00007A74, 0x00000000, 0x00007ACB, 0x00000000, 0x00007AF9,
+0x00000000, 0x00007C73, 0x00000000, 0x00007CF8, 0x00000000, 0x00007F36,
+0x00000000, 0x00007F51, 0x00000000, 0x00007F8A, 0x00000000, 0x00007FBD,
+0x00000000, 0x00008001, 0x00000000, 0x0000800C, 0x00000000, 0x00008012,
+0x00000000, 0x00008033, 0x00000000, 0x0000807F, 0x00000000, 0x00008089,
+0x00000000, 0x000081E3, 0x00000000, 0x000081EA, 0x00000000, 0x000081F3,
+0x00000000, 0x000081FC, 0x00000000, 0x0000820C, 0x00000000, 0x0000821B,
+0x00000000, 0x0000821F, 0x00000000, 0x0000826E, 0x00000000, 0x00008272,
+0x00000000, 0x00008278, 0x00000000, 0x0000864D, 0x00000000, 0x0000866B,
+0x00000000, 0x00008840, 0x00000000, 0x0000884C, 0x00000000, 0x00008863,
+0x00000000, 0x0000897E, 0x00000000, 0x0000898B, 0x00000000, 0x000089D2,
+0x00000000, 0x00008A00, 0x00000000, 0x00008C37, 0x00000000, 0x00008C46,
+0x00000000, 0x00008C55, 0x00000000, 0x00008C78, 0x00000000, 0x00008C9D,
+0x00000000, 0x00008D64, 0x00000000, 0x00008D70, 0x00000000, 0x00008DB3,
+0x00000000, 0x00008EAB, 0x00000000, 0x00008ECA, 0x00000000, 0x00008F9B,
+0x00000000, 0x00008FB0, 0x00000000, 0x00008FB5, 0x00000000, 0x00009091,
+0x00000000, 0x00009149, 0x00000000, 0x000091C6, 0x00000000, 0x000091CC,
+0x00000000, 0x000091D1, 0x00000000, 0x00009577, 0x00000000, 0x00009580,
+0x00000000, 0x0000961C, 0x00000000, 0x000096B6, 0x00000000, 0x000096B9,
+0x00000000, 0x000096E8, 0x00000000, 0x00009751, 0x00000000, 0x0000975E,
+0x00000000, 0x00009762, 0x00000000, 0x00009769, 0x00000000, 0x000097CB,
+0x00000000, 0x000097ED, 0x00000000, 0x000097F3, 0x00000000, 0x00009801,
+0x00000000, 0x000098A8, 0x00000000, 0x000098DB, 0x00000000, 0x000098DF,
+0x00000000, 0x00009996, 0x00000000, 0x00009999, 0x00000000, 0x000099AC,
+0x00000000, 0x00009AA8, 0x00000000, 0x00009AD8, 0x00000000, 0x00009ADF,
+0x00000000, 0x00009B25, 0x00000000, 0x00009B2F, 0x00000000, 0x00009B32,
+0x00000000, 0x00009B3C, 0x00000000, 0x00009B5A, 0x00000000, 0x00009CE5,
+0x00000000, 0x00009E75, 0x00000000, 0x00009E7F, 0x00000000, 0x00009EA5,
+0x00000000, 0x00009EBB, 0x00000000, 0x00009EC3, 0x00000000, 0x00009ECD,
+0x00000000, 0x00009ED1, 0x00000000, 0x00009EF9, 0x00000000, 0x00009EFD,
+0x00000000, 0x00009F0E, 0x00000000, 0x00009F13, 0x00000000, 0x00009F20,
+0x00000000, 0x00009F3B, 0x00000000, 0x00009F4A, 0x00000000, 0x00009F52,
+0x00000000, 0x00009F8D, 0x00000000, 0x00009F9C, 0x00000000, 0x00009FA0,
+0x00000000, 0x00003012, 0x00000000, 0x00005344, 0x00000000, 0x00005345,
+0x00000000, 0x0000304B, 0x00003099, 0x00000000, 0x0000304D, 0x00003099,
+0x00000000, 0x0000304F, 0x00003099, 0x00000000, 0x00003051, 0x00003099,
+0x00000000, 0x00003053, 0x00003099, 0x00000000, 0x00003055, 0x00003099,
+0x00000000, 0x00003057, 0x00003099, 0x00000000, 0x00003059, 0x00003099,
+0x00000000, 0x0000305B, 0x00003099, 0x00000000, 0x0000305D, 0x00003099,
+0x00000000, 0x0000305F, 0x00003099, 0x00000000, 0x00003061, 0x00003099,
+0x00000000, 0x00003064, 0x00003099, 0x00000000, 0x00003066, 0x00003099,
+0x00000000, 0x00003068, 0x00003099, 0x00000000, 0x0000306F, 0x00003099,
+0x00000000, 0x0000306F, 0x0000309A, 0x00000000, 0x00003072, 0x00003099,
+0x00000000, 0x00003072, 0x0000309A, 0x00000000, 0x00003075, 0x00003099,
+0x00000000, 0x00003075, 0x0000309A, 0x00000000, 0x00003078, 0x00003099,
+0x00000000, 0x00003078, 0x0000309A, 0x00000000, 0x0000307B, 0x00003099,
+0x00000000, 0x0000307B, 0x0000309A, 0x00000000, 0x00003046, 0x00003099,
+0x00000000, 0x00000020, 0x00003099, 0x00000000, 0x00000020, 0x0000309A,
+0x00000000, 0x0000309D, 0x00003099, 0x00000000, 0x00003088, 0x0000308A,
+0x00000000, 0x000030AB, 0x00003099, 0x00000000, 0x000030AD, 0x00003099,
+0x00000000, 0x000030AF, 0x00003099, 0x00000000, 0x000030B1, 0x00003099,
+0x00000000, 0x000030B3, 0x00003099, 0x00000000, 0x000030B5, 0x00003099,
+0x00000000, 0x000030B7, 0x00003099, 0x00000000, 0x000030B9, 0x00003099,
+0x00000000, 0x000030BB, 0x00003099, 0x00000000, 0x000030BD, 0x00003099,
+0x00000000, 0x000030BF, 0x00003099, 0x00000000, 0x000030C1, 0x00003099,
+0x00000000, 0x000030C4, 0x00003099, 0x00000000, 0x000030C6, 0x00003099,
+0x00000000, 0x000030C8, 0x00003099, 0x00000000, 0x000030CF, 0x00003099,
+0x00000000, 0x000030CF, 0x0000309A, 0x00000000, 0x000030D2, 0x00003099,
+0x00000000, 0x000030D2, 0x0000309A, 0x00000000, 0x000030D5, 0x00003099,
+0x00000000, 0x000030D5, 0x0000309A, 0x00000000, 0x000030D8, 0x00003099,
+0x00000000, 0x000030D8, 0x0000309A, 0x00000000, 0x000030DB, 0x00003099,
+0x00000000, 0x000030DB, 0x0000309A, 0x00000000, 0x000030A6, 0x00003099,
+0x00000000, 0x000030EF, 0x00003099, 0x00000000, 0x000030F0, 0x00003099,
+0x00000000, 0x000030F1, 0x00003099, 0x00000000, 0x000030F2, 0x00003099,
+0x00000000, 0x000030FD, 0x00003099, 0x00000000, 0x000030B3, 0x000030C8,
+0x00000000, 0x00001100, 0x00000000, 0x00001101, 0x00000000, 0x000011AA,
+0x00000000, 0x00001102, 0x00000000, 0x000011AC, 0x00000000, 0x000011AD,
+0x00000000, 0x00001103, 0x00000000, 0x00001104, 0x00000000, 0x00001105,
+0x00000000, 0x000011B0, 0x00000000, 0x000011B1, 0x00000000, 0x000011B2,
+0x00000000, 0x000011B3, 0x00000000, 0x000011B4, 0x00000000, 0x000011B5,
+0x00000000, 0x0000111A, 0x00000000, 0x00001106, 0x00000000, 0x00001107,
+0x00000000, 0x00001108, 0x00000000, 0x00001121, 0x00000000, 0x00001109,
+0x00000000, 0x0000110A, 0x00000000, 0x0000110B, 0x00000000, 0x0000110C,
+0x00000000, 0x0000110D, 0x00000000, 0x0000110E, 0x00000000, 0x0000110F,
+0x00000000, 0x00001110, 0x00000000, 0x00001111, 0x00000000, 0x00001112,
+0x00000000, 0x00001161, 0x00000000, 0x00001162, 0x00000000, 0x00001163,
+0x00000000, 0x00001164, 0x00000000, 0x00001165, 0x00000000, 0x00001166,
+0x00000000, 0x00001167, 0x00000000, 0x00001168, 0x00000000, 0x00001169,
+0x00000000, 0x0000116A, 0x00000000, 0x0000116B, 0x00000000, 0x0000116C,
+0x00000000, 0x0000116D, 0x00000000, 0x0000116E, 0x00000000, 0x0000116F,
+0x00000000, 0x00001170, 0x00000000, 0x00001171, 0x00000000, 0x00001172,
+0x00000000, 0x00001173, 0x00000000, 0x00001174, 0x00000000, 0x00001175,
+0x00000000, 0x00001160, 0x00000000, 0x00001114, 0x00000000, 0x00001115,
+0x00000000, 0x000011C7, 0x00000000, 0x000011C8, 0x00000000, 0x000011CC,
+0x00000000, 0x000011CE, 0x00000000, 0x000011D3, 0x00000000, 0x000011D7,
+0x00000000, 0x000011D9, 0x00000000, 0x0000111C, 0x00000000, 0x000011DD,
+0x00000000, 0x000011DF, 0x00000000, 0x0000111D, 0x00000000, 0x0000111E,
+0x00000000, 0x00001120, 0x00000000, 0x00001122, 0x00000000, 0x00001123,
+0x00000000, 0x00001127, 0x00000000, 0x00001129, 0x00000000, 0x0000112B,
+0x00000000, 0x0000112C, 0x00000000, 0x0000112D, 0x00000000, 0x0000112E,
+0x00000000, 0x0000112F, 0x00000000, 0x00001132, 0x00000000, 0x00001136,
+0x00000000, 0x00001140, 0x00000000, 0x00001147, 0x00000000, 0x0000114C,
+0x00000000, 0x000011F1, 0x00000000, 0x000011F2, 0x00000000, 0x00001157,
+0x00000000, 0x00001158, 0x00000000, 0x00001159, 0x00000000, 0x00001184,
+0x00000000, 0x00001185, 0x00000000, 0x00001188, 0x00000000, 0x00001191,
+0x00000000, 0x00001192, 0x00000000, 0x00001194, 0x00000000, 0x0000119E,
+0x00000000, 0x000011A1, 0x00000000, 0x00004E09, 0x00000000, 0x000056DB,
+0x00000000, 0x00004E0A, 0x00000000, 0x00004E2D, 0x00000000, 0x00004E0B,
+0x00000000, 0x00007532, 0x00000000, 0x00004E19, 0x00000000, 0x00004E01,
+0x00000000, 0x00005929, 0x00000000, 0x00005730, 0x00000000, 0x00000028,
+0x00001100, 0x00000029, 0x00000000, 0x00000028, 0x00001102, 0x00000029,
+0x00000000, 0x00000028, 0x00001103, 0x00000029, 0x00000000, 0x00000028,
+0x00001105, 0x00000029, 0x00000000, 0x00000028, 0x00001106, 0x00000029,
+0x00000000, 0x00000028, 0x00001107, 0x00000029, 0x00000000, 0x00000028,
+0x00001109, 0x00000029, 0x00000000, 0x00000028, 0x0000110B, 0x00000029,
+0x00000000, 0x00000028, 0x0000110C, 0x00000029, 0x00000000, 0x00000028,
+0x0000110E, 0x00000029, 0x00000000, 0x00000028, 0x0000110F, 0x00000029,
+0x00000000, 0x00000028, 0x00001110, 0x00000029, 0x00000000, 0x00000028,
+0x00001111, 0x00000029, 0x00000000, 0x00000028, 0x00001112, 0x00000029,
+0x00000000, 0x00000028, 0x00001100, 0x00001161, 0x00000029, 0x00000000,
+0x00000028, 0x00001102, 0x00001161, 0x00000029, 0x00000000, 0x00000028,
+0x00001103, 0x00001161, 0x00000029, 0x00000000, 0x00000028, 0x00001105,
+0x00001161, 0x00000029, 0x00000000, 0x00000028, 0x00001106, 0x00001161,
+0x00000029, 0x00000000, 0x00000028, 0x00001107, 0x00001161, 0x00000029,
+0x00000000, 0x00000028, 0x00001109, 0x00001161, 0x00000029, 0x00000000,
+0x00000028, 0x0000110B, 0x00001161, 0x00000029, 0x00000000, 0x00000028,
+0x0000110C, 0x00001161, 0x00000029, 0x00000000, 0x00000028, 0x0000110E,
+0x00001161, 0x00000029, 0x00000000, 0x00000028, 0x0000110F, 0x00001161,
+0x00000029, 0x00000000, 0x00000028, 0x00001110, 0x00001161, 0x00000029,
+0x00000000, 0x00000028, 0x00001111, 0x00001161, 0x00000029, 0x00000000,
+0x00000028, 0x00001112, 0x00001161, 0x00000029, 0x00000000, 0x00000028,
+0x0000110C, 0x0000116E, 0x00000029, 0x00000000, 0x00000028, 0x0000110B,
+0x00001169, 0x0000110C, 0x00001165, 0x000011AB, 0x00000029, 0x00000000,
+0x00000028, 0x0000110B, 0x00001169, 0x00001112, 0x0000116E, 0x00000029,
+0x00000000, 0x00000028, 0x00004E00, 0x00000029, 0x00000000, 0x00000028,
+0x00004E8C, 0x00000029, 0x00000000, 0x00000028, 0x00004E09, 0x00000029,
+0x00000000, 0x00000028, 0x000056DB, 0x00000029, 0x00000000, 0x00000028,
+0x00004E94, 0x00000029, 0x00000000, 0x00000028, 0x0000516D, 0x00000029,
+0x00000000, 0x00000028, 0x00004E03, 0x00000029, 0x00000000, 0x00000028,
+0x0000516B, 0x00000029, 0x00000000, 0x00000028, 0x00004E5D, 0x00000029,
+0x00000000, 0x00000028, 0x00005341, 0x00000029, 0x00000000, 0x00000028,
+0x00006708, 0x00000029, 0x00000000, 0x00000028, 0x0000706B, 0x00000029,
+0x00000000, 0x00000028, 0x00006C34, 0x00000029, 0x00000000, 0x00000028,
+0x00006728, 0x00000029, 0x00000000, 0x00000028, 0x000091D1, 0x00000029,
+0x00000000, 0x00000028, 0x0000571F, 0x00000029, 0x00000000, 0x00000028,
+0x000065E5, 0x00000029, 0x00000000, 0x00000028, 0x0000682A, 0x00000029,
+0x00000000, 0x00000028, 0x00006709, 0x00000029, 0x00000000, 0x00000028,
+0x0000793E, 0x00000029, 0x00000000, 0x00000028, 0x0000540D, 0x00000029,
+0x00000000, 0x00000028, 0x00007279, 0x00000029, 0x00000000, 0x00000028,
+0x00008CA1, 0x00000029, 0x00000000, 0x00000028, 0x0000795D, 0x00000029,
+0x00000000, 0x00000028, 0x000052B4, 0x00000029, 0x00000000, 0x00000028,
+0x00004EE3, 0x00000029, 0x00000000, 0x00000028, 0x0000547C, 0x00000029,
+0x00000000, 0x00000028, 0x00005B66, 0x00000029, 0x00000000, 0x00000028,
+0x000076E3, 0x00000029, 0x00000000, 0x00000028, 0x00004F01, 0x00000029,
+0x00000000, 0x00000028, 0x00008CC7, 0x00000029, 0x00000000, 0x00000028,
+0x00005354, 0x00000029, 0x00000000, 0x00000028, 0x0000796D, 0x00000029,
+0x00000000, 0x00000028, 0x00004F11, 0x00000029, 0x00000000, 0x00000028,
+0x000081EA, 0x00000029, 0x00000000, 0x00000028, 0x000081F3, 0x00000029,
+0x00000000, 0x0000554F, 0x00000000, 0x00005E7C, 0x00000000, 0x00007B8F,
+0x00000000, 0x00000050, 0x00000054, 0x00000045, 0x00000000, 0x00000032,
+0x00000031, 0x00000000, 0x00000032, 0x00000032, 0x00000000, 0x00000032,
+0x00000033, 0x00000000, 0x00000032, 0x00000034, 0x00000000, 0x00000032,
+0x00000035, 0x00000000, 0x00000032, 0x00000036, 0x00000000, 0x00000032,
+0x00000037, 0x00000000, 0x00000032, 0x00000038, 0x00000000, 0x00000032,
+0x00000039, 0x00000000, 0x00000033, 0x00000030, 0x00000000, 0x00000033,
+0x00000031, 0x00000000, 0x00000033, 0x00000032, 0x00000000, 0x00000033,
+0x00000033, 0x00000000, 0x00000033, 0x00000034, 0x00000000, 0x00000033,
+0x00000035, 0x00000000, 0x00001100, 0x00001161, 0x00000000, 0x00001102,
+0x00001161, 0x00000000, 0x00001103, 0x00001161, 0x00000000, 0x00001105,
+0x00001161, 0x00000000, 0x00001106, 0x00001161, 0x00000000, 0x00001107,
+0x00001161, 0x00000000, 0x00001109, 0x00001161, 0x00000000, 0x0000110B,
+0x00001161, 0x00000000, 0x0000110C, 0x00001161, 0x00000000, 0x0000110E,
+0x00001161, 0x00000000, 0x0000110F, 0x00001161, 0x00000000, 0x00001110,
+0x00001161, 0x00000000, 0x00001111, 0x00001161, 0x00000000, 0x00001112,
+0x00001161, 0x00000000, 0x0000110E, 0x00001161, 0x000011B7, 0x00001100,
+0x00001169, 0x00000000, 0x0000110C, 0x0000116E, 0x0000110B, 0x00001174,
+0x00000000, 0x0000110B, 0x0000116E, 0x00000000, 0x00004E94, 0x00000000,
+0x0000516D, 0x00000000, 0x00004E03, 0x00000000, 0x00004E5D, 0x00000000,
+0x0000682A, 0x00000000, 0x00006709, 0x00000000, 0x0000793E, 0x00000000,
+0x0000540D, 0x00000000, 0x00007279, 0x00000000, 0x00008CA1, 0x00000000,
+0x0000795D, 0x00000000, 0x000052B4, 0x00000000, 0x000079D8, 0x00000000,
+0x00007537, 0x00000000, 0x00009069, 0x00000000, 0x0000512A, 0x00000000,
+0x00005370, 0x00000000, 0x00006CE8, 0x00000000, 0x00009805, 0x00000000,
+0x00004F11, 0x00000000, 0x00005199, 0x00000000, 0x00006B63, 0x00000000,
+0x00005DE6, 0x00000000, 0x000053F3, 0x00000000, 0x0000533B, 0x00000000,
+0x00005B97, 0x00000000, 0x00005B66, 0x00000000, 0x000076E3, 0x00000000,
+0x00004F01, 0x00000000, 0x00008CC7, 0x00000000, 0x00005354, 0x00000000,
+0x0000591C, 0x00000000, 0x00000033, 0x00000036, 0x00000000, 0x00000033,
+0x00000037, 0x00000000, 0x00000033, 0x00000038, 0x00000000, 0x00000033,
+0x00000039, 0x00000000, 0x00000034, 0x00000030, 0x00000000, 0x00000034,
+0x00000031, 0x00000000, 0x00000034, 0x00000032, 0x00000000, 0x00000034,
+0x00000033, 0x00000000, 0x00000034, 0x00000034, 0x00000000, 0x00000034,
+0x00000035, 0x00000000, 0x00000034, 0x00000036, 0x00000000, 0x00000034,
+0x00000037, 0x00000000, 0x00000034, 0x00000038, 0x00000000, 0x00000034,
+0x00000039, 0x00000000, 0x00000035, 0x00000030, 0x00000000, 0x00000031,
+0x00006708, 0x00000000, 0x00000032, 0x00006708, 0x00000000, 0x00000033,
+0x00006708, 0x00000000, 0x00000034, 0x00006708, 0x00000000, 0x00000035,
+0x00006708, 0x00000000, 0x00000036, 0x00006708, 0x00000000, 0x00000037,
+0x00006708, 0x00000000, 0x00000038, 0x00006708, 0x00000000, 0x00000039,
+0x00006708, 0x00000000, 0x00000031, 0x00000030, 0x00006708, 0x00000000,
+0x00000031, 0x00000031, 0x00006708, 0x00000000, 0x00000031, 0x00000032,
+0x00006708, 0x00000000, 0x00000048, 0x00000067, 0x00000000, 0x00000065,
+0x00000072, 0x00000067, 0x00000000, 0x00000065, 0x00000056, 0x00000000,
+0x0000004C, 0x00000054, 0x00000044, 0x00000000, 0x000030A2, 0x00000000,
+0x000030A4, 0x00000000, 0x000030A6, 0x00000000, 0x000030A8, 0x00000000,
+0x000030AA, 0x00000000, 0x000030AB, 0x00000000, 0x000030AD, 0x00000000,
+0x000030AF, 0x00000000, 0x000030B1, 0x00000000, 0x000030B3, 0x00000000,
+0x000030B5, 0x00000000, 0x000030B7, 0x00000000, 0x000030B9, 0x00000000,
+0x000030BB, 0x00000000, 0x000030BD, 0x00000000, 0x000030BF, 0x00000000,
+0x000030C1, 0x00000000, 0x000030C4, 0x00000000, 0x000030C6, 0x00000000,
+0x000030C8, 0x00000000, 0x000030CA, 0x00000000, 0x000030CB, 0x00000000,
+0x000030CC, 0x00000000, 0x000030CD, 0x00000000, 0x000030CE, 0x00000000,
+0x000030CF, 0x00000000, 0x000030D2, 0x00000000, 0x000030D5, 0x00000000,
+0x000030D8, 0x00000000, 0x000030DB, 0x00000000, 0x000030DE, 0x00000000,
+0x000030DF, 0x00000000, 0x000030E0, 0x00000000, 0x000030E1, 0x00000000,
+0x000030E2, 0x00000000, 0x000030E4, 0x00000000, 0x000030E6, 0x00000000,
+0x000030E8, 0x00000000, 0x000030E9, 0x00000000, 0x000030EA, 0x00000000,
+0x000030EB, 0x00000000, 0x000030EC, 0x00000000, 0x000030ED, 0x00000000,
+0x000030EF, 0x00000000, 0x000030F0, 0x00000000, 0x000030F1, 0x00000000,
+0x000030F2, 0x00000000, 0x00004EE4, 0x0000548C, 0x00000000, 0x000030A2,
+0x000030D1, 0x000030FC, 0x000030C8, 0x00000000, 0x000030A2, 0x000030EB,
+0x000030D5, 0x000030A1, 0x00000000, 0x000030A2, 0x000030F3, 0x000030DA,
+0x000030A2, 0x00000000, 0x000030A2, 0x000030FC, 0x000030EB, 0x00000000,
+0x000030A4, 0x000030CB, 0x000030F3, 0x000030B0, 0x00000000, 0x000030A4,
+0x000030F3, 0x000030C1, 0x00000000, 0x000030A6, 0x000030A9, 0x000030F3,
+0x00000000, 0x000030A8, 0x000030B9, 0x000030AF, 0x000030FC, 0x000030C9,
+0x00000000, 0x000030A8, 0x000030FC, 0x000030AB, 0x000030FC, 0x00000000,
+0x000030AA, 0x000030F3, 0x000030B9, 0x00000000, 0x000030AA, 0x000030FC,
+0x000030E0, 0x00000000, 0x000030AB, 0x000030A4, 0x000030EA, 0x00000000,
+0x000030AB, 0x000030E9, 0x000030C3, 0x000030C8, 0x00000000, 0x000030AB,
+0x000030ED, 0x000030EA, 0x000030FC, 0x00000000, 0x000030AC, 0x000030ED,
+0x000030F3, 0x00000000, 0x000030AC, 0x000030F3, 0x000030DE, 0x00000000,
+0x000030AE, 0x000030AC, 0x00000000, 0x000030AE, 0x000030CB, 0x000030FC,
+0x00000000, 0x000030AD, 0x000030E5, 0x000030EA, 0x000030FC, 0x00000000,
+0x000030AE, 0x000030EB, 0x000030C0, 0x000030FC, 0x00000000, 0x000030AD,
+0x000030ED, 0x00000000, 0x000030AD, 0x000030ED, 0x000030B0, 0x000030E9,
+0x000030E0, 0x00000000, 0x000030AD, 0x000030ED, 0x000030E1, 0x000030FC,
+0x000030C8, 0x000030EB, 0x00000000, 0x000030AD, 0x000030ED, 0x000030EF,
+0x000030C3, 0x000030C8, 0x00000000, 0x000030B0, 0x000030E9, 0x000030E0,
+0x00000000, 0x000030B0, 0x000030E9, 0x000030E0, 0x000030C8, 0x000030F3,
+0x00000000, 0x000030AF, 0x000030EB, 0x000030BC, 0x000030A4, 0x000030ED,
+0x00000000, 0x000030AF, 0x000030ED, 0x000030FC, 0x000030CD, 0x00000000,
+0x000030B1, 0x000030FC, 0x000030B9, 0x00000000, 0x000030B3, 0x000030EB,
+0x000030CA, 0x00000000, 0x000030B3, 0x000030FC, 0x000030DD, 0x00000000,
+0x000030B5, 0x000030A4, 0x000030AF, 0x000030EB, 0x00000000, 0x000030B5,
+0x000030F3, 0x000030C1, 0x000030FC, 0x000030E0, 0x00000000, 0x000030B7,
+0x000030EA, 0x000030F3, 0x000030B0, 0x00000000, 0x000030BB, 0x000030F3,
+0x000030C1, 0x00000000, 0x000030BB, 0x000030F3, 0x000030C8, 0x00000000,
+0x000030C0, 0x000030FC, 0x000030B9, 0x00000000, 0x000030C7, 0x000030B7,
+0x00000000, 0x000030C9, 0x000030EB, 0x00000000, 0x000030C8, 0x000030F3,
+0x00000000, 0x000030CA, 0x000030CE, 0x00000000, 0x000030CE, 0x000030C3,
+0x000030C8, 0x00000000, 0x000030CF, 0x000030A4, 0x000030C4, 0x00000000,
+0x000030D1, 0x000030FC, 0x000030BB, 0x000030F3, 0x000030C8, 0x00000000,
+0x000030D1, 0x000030FC, 0x000030C4, 0x00000000, 0x000030D0, 0x000030FC,
+0x000030EC, 0x000030EB, 0x00000000, 0x000030D4, 0x000030A2, 0x000030B9,
+0x000030C8, 0x000030EB, 0x00000000, 0x000030D4, 0x000030AF, 0x000030EB,
+0x00000000, 0x000030D4, 0x000030B3, 0x00000000, 0x000030D3, 0x000030EB,
+0x00000000, 0x000030D5, 0x000030A1, 0x000030E9, 0x000030C3, 0x000030C9,
+0x00000000, 0x000030D5, 0x000030A3, 0x000030FC, 0x000030C8, 0x00000000,
+0x000030D6, 0x000030C3, 0x000030B7, 0x000030A7, 0x000030EB, 0x00000000,
+0x000030D5, 0x000030E9, 0x000030F3, 0x00000000, 0x000030D8, 0x000030AF,
+0x000030BF, 0x000030FC, 0x000030EB, 0x00000000, 0x000030DA, 0x000030BD,
+0x00000000, 0x000030DA, 0x000030CB, 0x000030D2, 0x00000000, 0x000030D8,
+0x000030EB, 0x000030C4, 0x00000000, 0x000030DA, 0x000030F3, 0x000030B9,
+0x00000000, 0x000030DA, 0x000030FC, 0x000030B8, 0x00000000, 0x000030D9,
+0x000030FC, 0x000030BF, 0x00000000, 0x000030DD, 0x000030A4, 0x000030F3,
+0x000030C8, 0x00000000, 0x000030DC, 0x000030EB, 0x000030C8, 0x00000000,
+0x000030DB, 0x000030F3, 0x00000000, 0x000030DD, 0x000030F3, 0x000030C9,
+0x00000000, 0x000030DB, 0x000030FC, 0x000030EB, 0x00000000, 0x000030DB,
+0x000030FC, 0x000030F3, 0x00000000, 0x000030DE, 0x000030A4, 0x000030AF,
+0x000030ED, 0x00000000, 0x000030DE, 0x000030A4, 0x000030EB, 0x00000000,
+0x000030DE, 0x000030C3, 0x000030CF, 0x00000000, 0x000030DE, 0x000030EB,
+0x000030AF, 0x00000000, 0x000030DE, 0x000030F3, 0x000030B7, 0x000030E7,
+0x000030F3, 0x00000000, 0x000030DF, 0x000030AF, 0x000030ED, 0x000030F3,
+0x00000000, 0x000030DF, 0x000030EA, 0x00000000, 0x000030DF, 0x000030EA,
+0x000030D0, 0x000030FC, 0x000030EB, 0x00000000, 0x000030E1, 0x000030AC,
+0x00000000, 0x000030E1, 0x000030AC, 0x000030C8, 0x000030F3, 0x00000000,
+0x000030E1, 0x000030FC, 0x000030C8, 0x000030EB, 0x00000000, 0x000030E4,
+0x000030FC, 0x000030C9, 0x00000000, 0x000030E4, 0x000030FC, 0x000030EB,
+0x00000000, 0x000030E6, 0x000030A2, 0x000030F3, 0x00000000, 0x000030EA,
+0x000030C3, 0x000030C8, 0x000030EB, 0x00000000, 0x000030EA, 0x000030E9,
+0x00000000, 0x000030EB, 0x000030D4, 0x000030FC, 0x00000000, 0x000030EB,
+0x000030FC, 0x000030D6, 0x000030EB, 0x00000000, 0x000030EC, 0x000030E0,
+0x00000000, 0x000030EC, 0x000030F3, 0x000030C8, 0x000030B2, 0x000030F3,
+0x00000000, 0x000030EF, 0x000030C3, 0x000030C8, 0x00000000, 0x00000030,
+0x000070B9, 0x00000000, 0x00000031, 0x000070B9, 0x00000000, 0x00000032,
+0x000070B9, 0x00000000, 0x00000033, 0x000070B9, 0x00000000, 0x00000034,
+0x000070B9, 0x00000000, 0x00000035, 0x000070B9, 0x00000000, 0x00000036,
+0x000070B9, 0x00000000, 0x00000037, 0x000070B9, 0x00000000, 0x00000038,
+0x000070B9, 0x00000000, 0x00000039, 0x000070B9, 0x00000000, 0x00000031,
+0x00000030, 0x000070B9, 0x00000000, 0x00000031, 0x00000031, 0x000070B9,
+0x00000000, 0x00000031, 0x00000032, 0x000070B9, 0x00000000, 0x00000031,
+0x00000033, 0x000070B9, 0x00000000, 0x00000031, 0x00000034, 0x000070B9,
+0x00000000, 0x00000031, 0x00000035, 0x000070B9, 0x00000000, 0x00000031,
+0x00000036, 0x000070B9, 0x00000000, 0x00000031, 0x00000037, 0x000070B9,
+0x00000000, 0x00000031, 0x00000038, 0x000070B9, 0x00000000, 0x00000031,
+0x00000039, 0x000070B9, 0x00000000, 0x00000032, 0x00000030, 0x000070B9,
+0x00000000, 0x00000032, 0x00000031, 0x000070B9, 0x00000000, 0x00000032,
+0x00000032, 0x000070B9, 0x00000000, 0x00000032, 0x00000033, 0x000070B9,
+0x00000000, 0x00000032, 0x00000034, 0x000070B9, 0x00000000, 0x00000068,
+0x00000050, 0x00000061, 0x00000000, 0x00000064, 0x00000061, 0x00000000,
+0x00000041, 0x00000055, 0x00000000, 0x00000062, 0x00000061, 0x00000072,
+0x00000000, 0x0000006F, 0x00000056, 0x00000000, 0x00000070, 0x00000063,
+0x00000000, 0x00000064, 0x0000006D, 0x00000000, 0x00000064, 0x0000006D,
+0x000000B2, 0x00000000, 0x00000064, 0x0000006D, 0x000000B3, 0x00000000,
+0x00000049, 0x00000055, 0x00000000, 0x00005E73, 0x00006210, 0x00000000,
+0x0000662D, 0x0000548C, 0x00000000, 0x00005927, 0x00006B63, 0x00000000,
+0x0000660E, 0x00006CBB, 0x00000000, 0x0000682A, 0x00005F0F, 0x00004F1A,
+0x0000793E, 0x00000000, 0x00000070, 0x00000041, 0x00000000, 0x0000006E,
+0x00000041, 0x00000000, 0x000003BC, 0x00000041, 0x00000000, 0x0000006D,
+0x00000041, 0x00000000, 0x0000006B, 0x00000041, 0x00000000, 0x0000004B,
+0x00000042, 0x00000000, 0x0000004D, 0x00000042, 0x00000000, 0x00000047,
+0x00000042, 0x00000000, 0x00000063, 0x00000061, 0x0000006C, 0x00000000,
+0x0000006B, 0x00000063, 0x00000061, 0x0000006C, 0x00000000, 0x00000070,
+0x00000046, 0x00000000, 0x0000006E, 0x00000046, 0x00000000, 0x000003BC,
+0x00000046, 0x00000000, 0x000003BC, 0x00000067, 0x00000000, 0x0000006D,
+0x00000067, 0x00000000, 0x0000006B, 0x00000067, 0x00000000, 0x00000048,
+0x0000007A, 0x00000000, 0x0000006B, 0x00000048, 0x0000007A, 0x00000000,
+0x0000004D, 0x00000048, 0x0000007A, 0x00000000, 0x00000047, 0x00000048,
+0x0000007A, 0x00000000, 0x00000054, 0x00000048, 0x0000007A, 0x00000000,
+0x000003BC, 0x00002113, 0x00000000, 0x0000006D, 0x00002113, 0x00000000,
+0x00000064, 0x00002113, 0x00000000, 0x0000006B, 0x00002113, 0x00000000,
+0x00000066, 0x0000006D, 0x00000000, 0x0000006E, 0x0000006D, 0x00000000,
+0x000003BC, 0x0000006D, 0x00000000, 0x0000006D, 0x0000006D, 0x00000000,
+0x00000063, 0x0000006D, 0x00000000, 0x0000006B, 0x0000006D, 0x00000000,
+0x0000006D, 0x0000006D, 0x000000B2, 0x00000000, 0x00000063, 0x0000006D,
+0x000000B2, 0x00000000, 0x0000006D, 0x000000B2, 0x00000000, 0x0000006B,
+0x0000006D, 0x000000B2, 0x00000000, 0x0000006D, 0x0000006D, 0x000000B3,
+0x00000000, 0x00000063, 0x0000006D, 0x000000B3, 0x00000000, 0x0000006D,
+0x000000B3, 0x00000000, 0x0000006B, 0x0000006D, 0x000000B3, 0x00000000,
+0x0000006D, 0x00002215, 0x00000073, 0x00000000, 0x0000006D, 0x00002215,
+0x00000073, 0x000000B2, 0x00000000, 0x00000050, 0x00000061, 0x00000000,
+0x0000006B, 0x00000050, 0x00000061, 0x00000000, 0x0000004D, 0x00000050,
+0x00000061, 0x00000000, 0x00000047, 0x00000050, 0x00000061, 0x00000000,
+0x00000072, 0x00000061, 0x00000064, 0x00000000, 0x00000072, 0x00000061,
+0x00000064, 0x00002215, 0x00000073, 0x00000000, 0x00000072, 0x00000061,
+0x00000064, 0x00002215, 0x00000073, 0x000000B2, 0x00000000, 0x00000070,
+0x00000073, 0x00000000, 0x0000006E, 0x00000073, 0x00000000, 0x000003BC,
+0x00000073, 0x00000000, 0x0000006D, 0x00000073, 0x00000000, 0x00000070,
+0x00000056, 0x00000000, 0x0000006E, 0x00000056, 0x00000000, 0x000003BC,
+0x00000056, 0x00000000, 0x0000006D, 0x00000056, 0x00000000, 0x0000006B,
+0x00000056, 0x00000000, 0x0000004D, 0x00000056, 0x00000000, 0x00000070,
+0x00000057, 0x00000000, 0x0000006E, 0x00000057, 0x00000000, 0x000003BC,
+0x00000057, 0x00000000, 0x0000006D, 0x00000057, 0x00000000, 0x0000006B,
+0x00000057, 0x00000000, 0x0000004D, 0x00000057, 0x00000000, 0x0000006B,
+0x000003A9, 0x00000000, 0x0000004D, 0x000003A9, 0x00000000, 0x00000061,
+0x0000002E, 0x0000006D, 0x0000002E, 0x00000000, 0x00000042, 0x00000071,
+0x00000000, 0x00000063, 0x00000063, 0x00000000, 0x00000063, 0x00000064,
+0x00000000, 0x00000043, 0x00002215, 0x0000006B, 0x00000067, 0x00000000,
+0x00000043, 0x0000006F, 0x0000002E, 0x00000000, 0x00000064, 0x00000042,
+0x00000000, 0x00000047, 0x00000079, 0x00000000, 0x00000068, 0x00000061,
+0x00000000, 0x00000048, 0x00000050, 0x00000000, 0x00000069, 0x0000006E,
+0x00000000, 0x0000004B, 0x0000004B, 0x00000000, 0x0000004B, 0x0000004D,
+0x00000000, 0x0000006B, 0x00000074, 0x00000000, 0x0000006C, 0x0000006D,
+0x00000000, 0x0000006C, 0x0000006E, 0x00000000, 0x0000006C, 0x0000006F,
+0x00000067, 0x00000000, 0x0000006C, 0x00000078, 0x00000000, 0x0000006D,
+0x00000062, 0x00000000, 0x0000006D, 0x00000069, 0x0000006C, 0x00000000,
+0x0000006D, 0x0000006F, 0x0000006C, 0x00000000, 0x00000050, 0x00000048,
+0x00000000, 0x00000070, 0x0000002E, 0x0000006D, 0x0000002E, 0x00000000,
+0x00000050, 0x00000050, 0x0000004D, 0x00000000, 0x00000050, 0x00000052,
+0x00000000, 0x00000073, 0x00000072, 0x00000000, 0x00000053, 0x00000076,
+0x00000000, 0x00000057, 0x00000062, 0x00000000, 0x00000056, 0x00002215,
+0x0000006D, 0x00000000, 0x00000041, 0x00002215, 0x0000006D, 0x00000000,
+0x00000031, 0x000065E5, 0x00000000, 0x00000032, 0x000065E5, 0x00000000,
+0x00000033, 0x000065E5, 0x00000000, 0x00000034, 0x000065E5, 0x00000000,
+0x00000035, 0x000065E5, 0x00000000, 0x00000036, 0x000065E5, 0x00000000,
+0x00000037, 0x000065E5, 0x00000000, 0x00000038, 0x000065E5, 0x00000000,
+0x00000039, 0x000065E5, 0x00000000, 0x00000031, 0x00000030, 0x000065E5,
+0x00000000, 0x00000031, 0x00000031, 0x000065E5, 0x00000000, 0x00000031,
+0x00000032, 0x000065E5, 0x00000000, 0x00000031, 0x00000033, 0x000065E5,
+0x00000000, 0x00000031, 0x00000034, 0x000065E5, 0x00000000, 0x00000031,
+0x00000035, 0x000065E5, 0x00000000, 0x00000031, 0x00000036, 0x000065E5,
+0x00000000, 0x00000031, 0x00000037, 0x000065E5, 0x00000000, 0x00000031,
+0x00000038, 0x000065E5, 0x00000000, 0x00000031, 0x00000039, 0x000065E5,
+0x00000000, 0x00000032, 0x00000030, 0x000065E5, 0x00000000, 0x00000032,
+0x00000031, 0x000065E5, 0x00000000, 0x00000032, 0x00000032, 0x000065E5,
+0x00000000, 0x00000032, 0x00000033, 0x000065E5, 0x00000000, 0x00000032,
+0x00000034, 0x000065E5, 0x00000000, 0x00000032, 0x00000035, 0x000065E5,
+0x00000000, 0x00000032, 0x00000036, 0x000065E5, 0x00000000, 0x00000032,
+0x00000037, 0x000065E5, 0x00000000, 0x00000032, 0x00000038, 0x000065E5,
+0x00000000, 0x00000032, 0x00000039, 0x000065E5, 0x00000000, 0x00000033,
+0x00000030, 0x000065E5, 0x00000000, 0x00000033, 0x00000031, 0x000065E5,
+0x00000000, 0x00000067, 0x00000061, 0x0000006C, 0x00000000, 0x0000044A,
+0x00000000, 0x0000044C, 0x00000000, 0x0000A76F, 0x00000000, 0x00000126,
+0x00000000, 0x00000153, 0x00000000, 0x0000A727, 0x00000000, 0x0000AB37,
+0x00000000, 0x0000026B, 0x00000000, 0x0000AB52, 0x00000000, 0x0000028D,
+0x00000000, 0x00008C48, 0x00000000, 0x000066F4, 0x00000000, 0x00008CC8,
+0x00000000, 0x00006ED1, 0x00000000, 0x00004E32, 0x00000000, 0x000053E5,
+0x00000000, 0x00005951, 0x00000000, 0x00005587, 0x00000000, 0x00005948,
+0x00000000, 0x000061F6, 0x00000000, 0x00007669, 0x00000000, 0x00007F85,
+0x00000000, 0x0000863F, 0x00000000, 0x000087BA, 0x00000000, 0x000088F8,
+0x00000000, 0x0000908F, 0x00000000, 0x00006A02, 0x00000000, 0x00006D1B,
+0x00000000, 0x000070D9, 0x00000000, 0x000073DE, 0x00000000, 0x0000843D,
+0x00000000, 0x0000916A, 0x00000000, 0x000099F1, 0x00000000, 0x00004E82,
+0x00000000, 0x00005375, 0x00000000, 0x00006B04, 0x00000000, 0x0000721B,
+0x00000000, 0x0000862D, 0x00000000, 0x00009E1E, 0x00000000, 0x00005D50,
+0x00000000, 0x00006FEB, 0x00000000, 0x000085CD, 0x00000000, 0x00008964,
+0x00000000, 0x000062C9, 0x00000000, 0x000081D8, 0x00000000, 0x0000881F,
+0x00000000, 0x00005ECA, 0x00000000, 0x00006717, 0x00000000, 0x00006D6A,
+0x00000000, 0x000072FC, 0x00000000, 0x000090CE, 0x00000000, 0x00004F86,
+0x00000000, 0x000051B7, 0x00000000, 0x000052DE, 0x00000000, 0x000064C4,
+0x00000000, 0x00006AD3, 0x00000000, 0x00007210, 0x00000000, 0x000076E7,
+0x00000000, 0x00008606, 0x00000000, 0x0000865C, 0x00000000, 0x00008DEF,
+0x00000000, 0x00009732, 0x00000000, 0x00009B6F, 0x00000000, 0x00009DFA,
+0x00000000, 0x0000788C, 0x00000000, 0x0000797F, 0x00000000, 0x00007DA0,
+0x00000000, 0x000083C9, 0x00000000, 0x00009304, 0x00000000, 0x00008AD6,
+0x00000000, 0x000058DF, 0x00000000, 0x00005F04, 0x00000000, 0x00007C60,
+0x00000000, 0x0000807E, 0x00000000, 0x00007262, 0x00000000, 0x000078CA,
+0x00000000, 0x00008CC2, 0x00000000, 0x000096F7, 0x00000000, 0x000058D8,
+0x00000000, 0x00005C62, 0x00000000, 0x00006A13, 0x00000000, 0x00006DDA,
+0x00000000, 0x00006F0F, 0x00000000, 0x00007D2F, 0x00000000, 0x00007E37,
+0x00000000, 0x0000964B, 0x00000000, 0x000052D2, 0x00000000, 0x0000808B,
+0x00000000, 0x000051DC, 0x00000000, 0x000051CC, 0x00000000, 0x00007A1C,
+0x00000000, 0x00007DBE, 0x00000000, 0x000083F1, 0x00000000, 0x00009675,
+0x00000000, 0x00008B80, 0x00000000, 0x000062CF, 0x00000000, 0x00008AFE,
+0x00000000, 0x00004E39, 0x00000000, 0x00005BE7, 0x00000000, 0x00006012,
+0x00000000, 0x00007387, 0x00000000, 0x00007570, 0x00000000, 0x00005317,
+0x00000000, 0x000078FB, 0x00000000, 0x00004FBF, 0x00000000, 0x00005FA9,
+0x00000000, 0x00004E0D, 0x00000000, 0x00006CCC, 0x00000000, 0x00006578,
+0x00000000, 0x00007D22, 0x00000000, 0x000053C3, 0x00000000, 0x0000585E,
+0x00000000, 0x00007701, 0x00000000, 0x00008449, 0x00000000, 0x00008AAA,
+0x00000000, 0x00006BBA, 0x00000000, 0x00006C88, 0x00000000, 0x000062FE,
+0x00000000, 0x000082E5, 0x00000000, 0x000063A0, 0x00000000, 0x00007565,
+0x00000000, 0x00004EAE, 0x00000000, 0x00005169, 0x00000000, 0x000051C9,
+0x00000000, 0x00006881, 0x00000000, 0x00007CE7, 0x00000000, 0x0000826F,
+0x00000000, 0x00008AD2, 0x00000000, 0x000091CF, 0x00000000, 0x000052F5,
+0x00000000, 0x00005442, 0x00000000, 0x00005EEC, 0x00000000, 0x000065C5,
+0x00000000, 0x00006FFE, 0x00000000, 0x0000792A, 0x00000000, 0x000095AD,
+0x00000000, 0x00009A6A, 0x00000000, 0x00009E97, 0x00000000, 0x00009ECE,
+0x00000000, 0x000066C6, 0x00000000, 0x00006B77, 0x00000000, 0x00008F62,
+0x00000000, 0x00005E74, 0x00000000, 0x00006190, 0x00000000, 0x00006200,
+0x00000000, 0x0000649A, 0x00000000, 0x00006F23, 0x00000000, 0x00007149,
+0x00000000, 0x00007489, 0x00000000, 0x000079CA, 0x00000000, 0x00007DF4,
+0x00000000, 0x0000806F, 0x00000000, 0x00008F26, 0x00000000, 0x000084EE,
+0x00000000, 0x00009023, 0x00000000, 0x0000934A, 0x00000000, 0x00005217,
+0x00000000, 0x000052A3, 0x00000000, 0x000054BD, 0x00000000, 0x000070C8,
+0x00000000, 0x000088C2, 0x00000000, 0x00005EC9, 0x00000000, 0x00005FF5,
+0x00000000, 0x0000637B, 0x00000000, 0x00006BAE, 0x00000000, 0x00007C3E,
+0x00000000, 0x00007375, 0x00000000, 0x00004EE4, 0x00000000, 0x000056F9,
+0x00000000, 0x00005DBA, 0x00000000, 0x0000601C, 0x00000000, 0x000073B2,
+0x00000000, 0x00007469, 0x00000000, 0x00007F9A, 0x00000000, 0x00008046,
+0x00000000, 0x00009234, 0x00000000, 0x000096F6, 0x00000000, 0x00009748,
+0x00000000, 0x00009818, 0x00000000, 0x00004F8B, 0x00000000, 0x000079AE,
+0x00000000, 0x000091B4, 0x00000000, 0x000096B8, 0x00000000, 0x000060E1,
+0x00000000, 0x00004E86, 0x00000000, 0x000050DA, 0x00000000, 0x00005BEE,
+0x00000000, 0x00005C3F, 0x00000000, 0x00006599, 0x00000000, 0x000071CE,
+0x00000000, 0x00007642, 0x00000000, 0x000084FC, 0x00000000, 0x0000907C,
+0x00000000, 0x00006688, 0x00000000, 0x0000962E, 0x00000000, 0x00005289,
+0x00000000, 0x0000677B, 0x00000000, 0x000067F3, 0x00000000, 0x00006D41,
+0x00000000, 0x00006E9C, 0x00000000, 0x00007409, 0x00000000, 0x00007559,
+0x00000000, 0x0000786B, 0x00000000, 0x00007D10, 0x00000000, 0x0000985E,
+0x00000000, 0x0000622E, 0x00000000, 0x00009678, 0x00000000, 0x0000502B,
+0x00000000, 0x00005D19, 0x00000000, 0x00006DEA, 0x00000000, 0x00008F2A,
+0x00000000, 0x00005F8B, 0x00000000, 0x00006144, 0x00000000, 0x00006817,
+0x00000000, 0x00009686, 0x00000000, 0x00005229, 0x00000000, 0x0000540F,
+0x00000000, 0x00005C65, 0x00000000, 0x00006613, 0x00000000, 0x0000674E,
+0x00000000, 0x000068A8, 0x00000000, 0x00006CE5, 0x00000000, 0x00007406,
+0x00000000, 0x000075E2, 0x00000000, 0x00007F79, 0x00000000, 0x000088CF,
+0x00000000, 0x000088E1, 0x00000000, 0x000096E2, 0x00000000, 0x0000533F,
+0x00000000, 0x00006EBA, 0x00000000, 0x0000541D, 0x00000000, 0x000071D0,
+0x00000000, 0x00007498, 0x00000000, 0x000085FA, 0x00000000, 0x000096A3,
+0x00000000, 0x00009C57, 0x00000000, 0x00009E9F, 0x00000000, 0x00006797,
+0x00000000, 0x00006DCB, 0x00000000, 0x000081E8, 0x00000000, 0x00007B20,
+0x00000000, 0x00007C92, 0x00000000, 0x000072C0, 0x00000000, 0x00007099,
+0x00000000, 0x00008B58, 0x00000000, 0x00004EC0, 0x00000000, 0x00008336,
+0x00000000, 0x0000523A, 0x00000000, 0x00005207, 0x00000000, 0x00005EA6,
+0x00000000, 0x000062D3, 0x00000000, 0x00007CD6, 0x00000000, 0x00005B85,
+0x00000000, 0x00006D1E, 0x00000000, 0x000066B4, 0x00000000, 0x00008F3B,
+0x00000000, 0x0000964D, 0x00000000, 0x00005ED3, 0x00000000, 0x00005140,
+0x00000000, 0x000055C0, 0x00000000, 0x0000585A, 0x00000000, 0x00006674,
+0x00000000, 0x000051DE, 0x00000000, 0x0000732A, 0x00000000, 0x000076CA,
+0x00000000, 0x0000793C, 0x00000000, 0x0000795E, 0x00000000, 0x00007965,
+0x00000000, 0x0000798F, 0x00000000, 0x00009756, 0x00000000, 0x00007CBE,
+0x00000000, 0x00008612, 0x00000000, 0x00008AF8, 0x00000000, 0x00009038,
+0x00000000, 0x000090FD, 0x00000000, 0x000098EF, 0x00000000, 0x000098FC,
+0x00000000, 0x00009928, 0x00000000, 0x00009DB4, 0x00000000, 0x000090DE,
+0x00000000, 0x000096B7, 0x00000000, 0x00004FAE, 0x00000000, 0x000050E7,
+0x00000000, 0x0000514D, 0x00000000, 0x000052C9, 0x00000000, 0x000052E4,
+0x00000000, 0x00005351, 0x00000000, 0x0000559D, 0x00000000, 0x00005606,
+0x00000000, 0x00005668, 0x00000000, 0x00005840, 0x00000000, 0x000058A8,
+0x00000000, 0x00005C64, 0x00000000, 0x00006094, 0x00000000, 0x00006168,
+0x00000000, 0x0000618E, 0x00000000, 0x000061F2, 0x00000000, 0x0000654F,
+0x00000000, 0x000065E2, 0x00000000, 0x00006691, 0x00000000, 0x00006885,
+0x00000000, 0x00006D77, 0x00000000, 0x00006E1A, 0x00000000, 0x00006F22,
+0x00000000, 0x0000716E, 0x00000000, 0x0000722B, 0x00000000, 0x00007422,
+0x00000000, 0x00007891, 0x00000000, 0x00007949, 0x00000000, 0x00007948,
+0x00000000, 0x00007950, 0x00000000, 0x00007956, 0x00000000, 0x0000798D,
+0x00000000, 0x0000798E, 0x00000000, 0x00007A40, 0x00000000, 0x00007A81,
+0x00000000, 0x00007BC0, 0x00000000, 0x00007E09, 0x00000000, 0x00007E41,
+0x00000000, 0x00007F72, 0x00000000, 0x00008005, 0x00000000, 0x000081ED,
+0x00000000, 0x00008279, 0x00000000, 0x00008457, 0x00000000, 0x00008910,
+0x00000000, 0x00008996, 0x00000000, 0x00008B01, 0x00000000, 0x00008B39,
+0x00000000, 0x00008CD3, 0x00000000, 0x00008D08, 0x00000000, 0x00008FB6,
+0x00000000, 0x000096E3, 0x00000000, 0x000097FF, 0x00000000, 0x0000983B,
+0x00000000, 0x00006075, 0x00000000, 0x000242EE, 0x00000000, 0x00008218,
+0x00000000, 0x00004E26, 0x00000000, 0x000051B5, 0x00000000, 0x00005168,
+0x00000000, 0x00004F80, 0x00000000, 0x00005145, 0x00000000, 0x00005180,
+0x00000000, 0x000052C7, 0x00000000, 0x000052FA, 0x00000000, 0x00005555,
+0x00000000, 0x00005599, 0x00000000, 0x000055E2, 0x00000000, 0x000058B3,
+0x00000000, 0x00005944, 0x00000000, 0x00005954, 0x00000000, 0x00005A62,
+0x00000000, 0x00005B28, 0x00000000, 0x00005ED2, 0x00000000, 0x00005ED9,
+0x00000000, 0x00005F69, 0x00000000, 0x00005FAD, 0x00000000, 0x000060D8,
+0x00000000, 0x0000614E, 0x00000000, 0x00006108, 0x00000000, 0x00006160,
+0x00000000, 0x00006234, 0x00000000, 0x000063C4, 0x00000000, 0x0000641C,
+0x00000000, 0x00006452, 0x00000000, 0x00006556, 0x00000000, 0x0000671B,
+0x00000000, 0x00006756, 0x00000000, 0x00006EDB, 0x00000000, 0x00006ECB,
+0x00000000, 0x0000701E, 0x00000000, 0x000077A7, 0x00000000, 0x00007235,
+0x00000000, 0x000072AF, 0x00000000, 0x00007471, 0x00000000, 0x00007506,
+0x00000000, 0x0000753B, 0x00000000, 0x0000761D, 0x00000000, 0x0000761F,
+0x00000000, 0x000076DB, 0x00000000, 0x000076F4, 0x00000000, 0x0000774A,
+0x00000000, 0x00007740, 0x00000000, 0x000078CC, 0x00000000, 0x00007AB1,
+0x00000000, 0x00007C7B, 0x00000000, 0x00007D5B, 0x00000000, 0x00007F3E,
+0x00000000, 0x00008352, 0x00000000, 0x000083EF, 0x00000000, 0x00008779,
+0x00000000, 0x00008941, 0x00000000, 0x00008986, 0x00000000, 0x00008ABF,
+0x00000000, 0x00008ACB, 0x00000000, 0x00008AED, 0x00000000, 0x00008B8A,
+0x00000000, 0x00008F38, 0x00000000, 0x00009072, 0x00000000, 0x00009199,
+0x00000000, 0x00009276, 0x00000000, 0x0000967C, 0x00000000, 0x000097DB,
+0x00000000, 0x0000980B, 0x00000000, 0x00009B12, 0x00000000, 0x0002284A,
+0x00000000, 0x00022844, 0x00000000, 0x000233D5, 0x00000000, 0x00003B9D,
+0x00000000, 0x00004018, 0x00000000, 0x00004039, 0x00000000, 0x00025249,
+0x00000000, 0x00025CD0, 0x00000000, 0x00027ED3, 0x00000000, 0x00009F43,
+0x00000000, 0x00009F8E, 0x00000000, 0x00000066, 0x00000066, 0x00000000,
+0x00000066, 0x00000069, 0x00000000, 0x00000066, 0x0000006C, 0x00000000,
+0x00000066, 0x00000066, 0x00000069, 0x00000000, 0x00000066, 0x00000066,
+0x0000006C, 0x00000000, 0x0000017F, 0x00000074, 0x00000000, 0x00000073,
+0x00000074, 0x00000000, 0x00000574, 0x00000576, 0x00000000, 0x00000574,
+0x00000565, 0x00000000, 0x00000574, 0x0000056B, 0x00000000, 0x0000057E,
+0x00000576, 0x00000000, 0x00000574, 0x0000056D, 0x00000000, 0x000005D9,
+0x000005B4, 0x00000000, 0x000005F2, 0x000005B7, 0x00000000, 0x000005E2,
+0x00000000, 0x000005D4, 0x00000000, 0x000005DB, 0x00000000, 0x000005DC,
+0x00000000, 0x000005DD, 0x00000000, 0x000005E8, 0x00000000, 0x000005EA,
+0x00000000, 0x000005E9, 0x000005C1, 0x00000000, 0x000005E9, 0x000005C2,
+0x00000000, 0x0000FB49, 0x000005C1, 0x00000000, 0x0000FB49, 0x000005C2,
+0x00000000, 0x000005D0, 0x000005B7, 0x00000000, 0x000005D0, 0x000005B8,
+0x00000000, 0x000005D0, 0x000005BC, 0x00000000, 0x000005D1, 0x000005BC,
+0x00000000, 0x000005D2, 0x000005BC, 0x00000000, 0x000005D3, 0x000005BC,
+0x00000000, 0x000005D4, 0x000005BC, 0x00000000, 0x000005D5, 0x000005BC,
+0x00000000, 0x000005D6, 0x000005BC, 0x00000000, 0x000005D8, 0x000005BC,
+0x00000000, 0x000005D9, 0x000005BC, 0x00000000, 0x000005DA, 0x000005BC,
+0x00000000, 0x000005DB, 0x000005BC, 0x00000000, 0x000005DC, 0x000005BC,
+0x00000000, 0x000005DE, 0x000005BC, 0x00000000, 0x000005E0, 0x000005BC,
+0x00000000, 0x000005E1, 0x000005BC, 0x00000000, 0x000005E3, 0x000005BC,
+0x00000000, 0x000005E4, 0x000005BC, 0x00000000, 0x000005E6, 0x000005BC,
+0x00000000, 0x000005E7, 0x000005BC, 0x00000000, 0x000005E8, 0x000005BC,
+0x00000000, 0x000005E9, 0x000005BC, 0x00000000, 0x000005EA, 0x000005BC,
+0x00000000, 0x000005D5, 0x000005B9, 0x00000000, 0x000005D1, 0x000005BF,
+0x00000000, 0x000005DB, 0x000005BF, 0x00000000, 0x000005E4, 0x000005BF,
+0x00000000, 0x000005D0, 0x000005DC, 0x00000000, 0x00000671, 0x00000000,
+0x0000067B, 0x00000000, 0x0000067E, 0x00000000, 0x00000680, 0x00000000,
+0x0000067A, 0x00000000, 0x0000067F, 0x00000000, 0x00000679, 0x00000000,
+0x000006A4, 0x00000000, 0x000006A6, 0x00000000, 0x00000684, 0x00000000,
+0x00000683, 0x00000000, 0x00000686, 0x00000000, 0x00000687, 0x00000000,
+0x0000068D, 0x00000000, 0x0000068C, 0x00000000, 0x0000068E, 0x00000000,
+0x00000688, 0x00000000, 0x00000698, 0x00000000, 0x00000691, 0x00000000,
+0x000006A9, 0x00000000, 0x000006AF, 0x00000000, 0x000006B3, 0x00000000,
+0x000006B1, 0x00000000, 0x000006BA, 0x00000000, 0x000006BB, 0x00000000,
+0x000006C0, 0x00000000, 0x000006C1, 0x00000000, 0x000006BE, 0x00000000,
+0x000006D2, 0x00000000, 0x000006D3, 0x00000000, 0x000006AD, 0x00000000,
+0x000006C7, 0x00000000, 0x000006C6, 0x00000000, 0x000006C8, 0x00000000,
+0x00000677, 0x00000000, 0x000006CB, 0x00000000, 0x000006C5, 0x00000000,
+0x000006C9, 0x00000000, 0x000006D0, 0x00000000, 0x00000649, 0x00000000,
+0x00000626, 0x00000627, 0x00000000, 0x00000626, 0x000006D5, 0x00000000,
+0x00000626, 0x00000648, 0x00000000, 0x00000626, 0x000006C7, 0x00000000,
+0x00000626, 0x000006C6, 0x00000000, 0x00000626, 0x000006C8, 0x00000000,
+0x00000626, 0x000006D0, 0x00000000, 0x00000626, 0x00000649, 0x00000000,
+0x000006CC, 0x00000000, 0x00000626, 0x0000062C, 0x00000000, 0x00000626,
+0x0000062D, 0x00000000, 0x00000626, 0x00000645, 0x00000000, 0x00000626,
+0x0000064A, 0x00000000, 0x00000628, 0x0000062C, 0x00000000, 0x00000628,
+0x0000062D, 0x00000000, 0x00000628, 0x0000062E, 0x00000000, 0x00000628,
+0x00000645, 0x00000000, 0x00000628, 0x00000649, 0x00000000, 0x00000628,
+0x0000064A, 0x00000000, 0x0000062A, 0x0000062C, 0x00000000, 0x0000062A,
+0x0000062D, 0x00000000, 0x0000062A, 0x0000062E, 0x00000000, 0x0000062A,
+0x00000645, 0x00000000, 0x0000062A, 0x00000649, 0x00000000, 0x0000062A,
+0x0000064A, 0x00000000, 0x0000062B, 0x0000062C, 0x00000000, 0x0000062B,
+0x00000645, 0x00000000, 0x0000062B, 0x00000649, 0x00000000, 0x0000062B,
+0x0000064A, 0x00000000, 0x0000062C, 0x0000062D, 0x00000000, 0x0000062C,
+0x00000645, 0x00000000, 0x0000062D, 0x0000062C, 0x00000000, 0x0000062D,
+0x00000645, 0x00000000, 0x0000062E, 0x0000062C, 0x00000000, 0x0000062E,
+0x0000062D, 0x00000000, 0x0000062E, 0x00000645, 0x00000000, 0x00000633,
+0x0000062C, 0x00000000, 0x00000633, 0x0000062D, 0x00000000, 0x00000633,
+0x0000062E, 0x00000000, 0x00000633, 0x00000645, 0x00000000, 0x00000635,
+0x0000062D, 0x00000000, 0x00000635, 0x00000645, 0x00000000, 0x00000636,
+0x0000062C, 0x00000000, 0x00000636, 0x0000062D, 0x00000000, 0x00000636,
+0x0000062E, 0x00000000, 0x00000636, 0x00000645, 0x00000000, 0x00000637,
+0x0000062D, 0x00000000, 0x00000637, 0x00000645, 0x00000000, 0x00000638,
+0x00000645, 0x00000000, 0x00000639, 0x0000062C, 0x00000000, 0x00000639,
+0x00000645, 0x00000000, 0x0000063A, 0x0000062C, 0x00000000, 0x0000063A,
+0x00000645, 0x00000000, 0x00000641, 0x0000062C, 0x00000000, 0x00000641,
+0x0000062D, 0x00000000, 0x00000641, 0x0000062E, 0x00000000, 0x00000641,
+0x00000645, 0x00000000, 0x00000641, 0x00000649, 0x00000000, 0x00000641,
+0x0000064A, 0x00000000, 0x00000642, 0x0000062D, 0x00000000, 0x00000642,
+0x00000645, 0x00000000, 0x00000642, 0x00000649, 0x00000000, 0x00000642,
+0x0000064A, 0x00000000, 0x00000643, 0x00000627, 0x00000000, 0x00000643,
+0x0000062C, 0x00000000, 0x00000643, 0x0000062D, 0x00000000, 0x00000643,
+0x0000062E, 0x00000000, 0x00000643, 0x00000644, 0x00000000, 0x00000643,
+0x00000645, 0x00000000, 0x00000643, 0x00000649, 0x00000000, 0x00000643,
+0x0000064A, 0x00000000, 0x00000644, 0x0000062C, 0x00000000, 0x00000644,
+0x0000062D, 0x00000000, 0x00000644, 0x0000062E, 0x00000000, 0x00000644,
+0x00000645, 0x00000000, 0x00000644, 0x00000649, 0x00000000, 0x00000644,
+0x0000064A, 0x00000000, 0x00000645, 0x0000062C, 0x00000000, 0x00000645,
+0x0000062D, 0x00000000, 0x00000645, 0x0000062E, 0x00000000, 0x00000645,
+0x00000645, 0x00000000, 0x00000645, 0x00000649, 0x00000000, 0x00000645,
+0x0000064A, 0x00000000, 0x00000646, 0x0000062C, 0x00000000, 0x00000646,
+0x0000062D, 0x00000000, 0x00000646, 0x0000062E, 0x00000000, 0x00000646,
+0x00000645, 0x00000000, 0x00000646, 0x00000649, 0x00000000, 0x00000646,
+0x0000064A, 0x00000000, 0x00000647, 0x0000062C, 0x00000000, 0x00000647,
+0x00000645, 0x00000000, 0x00000647, 0x00000649, 0x00000000, 0x00000647,
+0x0000064A, 0x00000000, 0x0000064A, 0x0000062C, 0x00000000, 0x0000064A,
+0x0000062D, 0x00000000, 0x0000064A, 0x0000062E, 0x00000000, 0x0000064A,
+0x00000645, 0x00000000, 0x0000064A, 0x00000649, 0x00000000, 0x0000064A,
+0x0000064A, 0x00000000, 0x00000630, 0x00000670, 0x00000000, 0x00000631,
+0x00000670, 0x00000000, 0x00000649, 0x00000670, 0x00000000, 0x00000020,
+0x0000064C, 0x00000651, 0x00000000, 0x00000020, 0x0000064D, 0x00000651,
+0x00000000, 0x00000020, 0x0000064E, 0x00000651, 0x00000000, 0x00000020,
+0x0000064F, 0x00000651, 0x00000000, 0x00000020, 0x00000650, 0x00000651,
+0x00000000, 0x00000020, 0x00000651, 0x00000670, 0x00000000, 0x00000626,
+0x00000631, 0x00000000, 0x00000626, 0x00000632, 0x00000000, 0x00000626,
+0x00000646, 0x00000000, 0x00000628, 0x00000631, 0x00000000, 0x00000628,
+0x00000632, 0x00000000, 0x00000628, 0x00000646, 0x00000000, 0x0000062A,
+0x00000631, 0x00000000, 0x0000062A, 0x00000632, 0x00000000, 0x0000062A,
+0x00000646, 0x00000000, 0x0000062B, 0x00000631, 0x00000000, 0x0000062B,
+0x00000632, 0x00000000, 0x0000062B, 0x00000646, 0x00000000, 0x00000645,
+0x00000627, 0x00000000, 0x00000646, 0x00000631, 0x00000000, 0x00000646,
+0x00000632, 0x00000000, 0x00000646, 0x00000646, 0x00000000, 0x0000064A,
+0x00000631, 0x00000000, 0x0000064A, 0x00000632, 0x00000000, 0x0000064A,
+0x00000646, 0x00000000, 0x00000626, 0x0000062E, 0x00000000, 0x00000626,
+0x00000647, 0x00000000, 0x00000628, 0x00000647, 0x00000000, 0x0000062A,
+0x00000647, 0x00000000, 0x00000635, 0x0000062E, 0x00000000, 0x00000644,
+0x00000647, 0x00000000, 0x00000646, 0x00000647, 0x00000000, 0x00000647,
+0x00000670, 0x00000000, 0x0000064A, 0x00000647, 0x00000000, 0x0000062B,
+0x00000647, 0x00000000, 0x00000633, 0x00000647, 0x00000000, 0x00000634,
+0x00000645, 0x00000000, 0x00000634, 0x00000647, 0x00000000, 0x00000640,
+0x0000064E, 0x00000651, 0x00000000, 0x00000640, 0x0000064F, 0x00000651,
+0x00000000, 0x00000640, 0x00000650, 0x00000651, 0x00000000, 0x00000637,
+0x00000649, 0x00000000, 0x00000637, 0x0000064A, 0x00000000, 0x00000639,
+0x00000649, 0x00000000, 0x00000639, 0x0000064A, 0x00000000, 0x0000063A,
+0x00000649, 0x00000000, 0x0000063A, 0x0000064A, 0x00000000, 0x00000633,
+0x00000649, 0x00000000, 0x00000633, 0x0000064A, 0x00000000, 0x00000634,
+0x00000649, 0x00000000, 0x00000634, 0x0000064A, 0x00000000, 0x0000062D,
+0x00000649, 0x00000000, 0x0000062D, 0x0000064A, 0x00000000, 0x0000062C,
+0x00000649, 0x00000000, 0x0000062C, 0x0000064A, 0x00000000, 0x0000062E,
+0x00000649, 0x00000000, 0x0000062E, 0x0000064A, 0x00000000, 0x00000635,
+0x00000649, 0x00000000, 0x00000635, 0x0000064A, 0x00000000, 0x00000636,
+0x00000649, 0x00000000, 0x00000636, 0x0000064A, 0x00000000, 0x00000634,
+0x0000062C, 0x00000000, 0x00000634, 0x0000062D, 0x00000000, 0x00000634,
+0x0000062E, 0x00000000, 0x00000634, 0x00000631, 0x00000000, 0x00000633,
+0x00000631, 0x00000000, 0x00000635, 0x00000631, 0x00000000, 0x00000636,
+0x00000631, 0x00000000, 0x00000627, 0x0000064B, 0x00000000, 0x0000062A,
+0x0000062C, 0x00000645, 0x00000000, 0x0000062A, 0x0000062D, 0x0000062C,
+0x00000000, 0x0000062A, 0x0000062D, 0x00000645, 0x00000000, 0x0000062A,
+0x0000062E, 0x00000645, 0x00000000, 0x0000062A, 0x00000645, 0x0000062C,
+0x00000000, 0x0000062A, 0x00000645, 0x0000062D, 0x00000000, 0x0000062A,
+0x00000645, 0x0000062E, 0x00000000, 0x0000062C, 0x00000645, 0x0000062D,
+0x00000000, 0x0000062D, 0x00000645, 0x0000064A, 0x00000000, 0x0000062D,
+0x00000645, 0x00000649, 0x00000000, 0x00000633, 0x0000062D, 0x0000062C,
+0x00000000, 0x00000633, 0x0000062C, 0x0000062D, 0x00000000, 0x00000633,
+0x0000062C, 0x00000649, 0x00000000, 0x00000633, 0x00000645, 0x0000062D,
+0x00000000, 0x00000633, 0x00000645, 0x0000062C, 0x00000000, 0x00000633,
+0x00000645, 0x00000645, 0x00000000, 0x00000635, 0x0000062D, 0x0000062D,
+0x00000000, 0x00000635, 0x00000645, 0x00000645, 0x00000000, 0x00000634,
+0x0000062D, 0x00000645, 0x00000000, 0x00000634, 0x0000062C, 0x0000064A,
+0x00000000, 0x00000634, 0x00000645, 0x0000062E, 0x00000000, 0x00000634,
+0x00000645, 0x00000645, 0x00000000, 0x00000636, 0x0000062D, 0x00000649,
+0x00000000, 0x00000636, 0x0000062E, 0x00000645, 0x00000000, 0x00000637,
+0x00000645, 0x0000062D, 0x00000000, 0x00000637, 0x00000645, 0x00000645,
+0x00000000, 0x00000637, 0x00000645, 0x0000064A, 0x00000000, 0x00000639,
+0x0000062C, 0x00000645, 0x00000000, 0x00000639, 0x00000645, 0x00000645,
+0x00000000, 0x00000639, 0x00000645, 0x00000649, 0x00000000, 0x0000063A,
+0x00000645, 0x00000645, 0x00000000, 0x0000063A, 0x00000645, 0x0000064A,
+0x00000000, 0x0000063A, 0x00000645, 0x00000649, 0x00000000, 0x00000641,
+0x0000062E, 0x00000645, 0x00000000, 0x00000642, 0x00000645, 0x0000062D,
+0x00000000, 0x00000642, 0x00000645, 0x00000645, 0x00000000, 0x00000644,
+0x0000062D, 0x00000645, 0x00000000, 0x00000644, 0x0000062D, 0x0000064A,
+0x00000000, 0x00000644, 0x0000062D, 0x00000649, 0x00000000, 0x00000644,
+0x0000062C, 0x0000062C, 0x00000000, 0x00000644, 0x0000062E, 0x00000645,
+0x00000000, 0x00000644, 0x00000645, 0x0000062D, 0x00000000, 0x00000645,
+0x0000062D, 0x0000062C, 0x00000000, 0x00000645, 0x0000062D, 0x00000645,
+0x00000000, 0x00000645, 0x0000062D, 0x0000064A, 0x00000000, 0x00000645,
+0x0000062C, 0x0000062D, 0x00000000, 0x00000645, 0x0000062C, 0x00000645,
+0x00000000, 0x00000645, 0x0000062E, 0x0000062C, 0x00000000, 0x00000645,
+0x0000062E, 0x00000645, 0x00000000, 0x00000645, 0x0000062C, 0x0000062E,
+0x00000000, 0x00000647, 0x00000645, 0x0000062C, 0x00000000, 0x00000647,
+0x00000645, 0x00000645, 0x00000000, 0x00000646, 0x0000062D, 0x00000645,
+0x00000000, 0x00000646, 0x0000062D, 0x00000649, 0x00000000, 0x00000646,
+0x0000062C, 0x00000645, 0x00000000, 0x00000646, 0x0000062C, 0x00000649,
+0x00000000, 0x00000646, 0x00000645, 0x0000064A, 0x00000000, 0x00000646,
+0x00000645, 0x00000649, 0x00000000, 0x0000064A, 0x00000645, 0x00000645,
+0x00000000, 0x00000628, 0x0000062E, 0x0000064A, 0x00000000, 0x0000062A,
+0x0000062C, 0x0000064A, 0x00000000, 0x0000062A, 0x0000062C, 0x00000649,
+0x00000000, 0x0000062A, 0x0000062E, 0x0000064A, 0x00000000, 0x0000062A,
+0x0000062E, 0x00000649, 0x00000000, 0x0000062A, 0x00000645, 0x0000064A,
+0x00000000, 0x0000062A, 0x00000645, 0x00000649, 0x00000000, 0x0000062C,
+0x00000645, 0x0000064A, 0x00000000, 0x0000062C, 0x0000062D, 0x00000649,
+0x00000000, 0x0000062C, 0x00000645, 0x00000649, 0x00000000, 0x00000633,
+0x0000062E, 0x00000649, 0x00000000, 0x00000635, 0x0000062D, 0x0000064A,
+0x00000000, 0x00000634, 0x0000062D, 0x0000064A, 0x00000000, 0x00000636,
+0x0000062D, 0x0000064A, 0x00000000, 0x00000644, 0x0000062C, 0x0000064A,
+0x00000000, 0x00000644, 0x00000645, 0x0000064A, 0x00000000, 0x0000064A,
+0x0000062D, 0x0000064A, 0x00000000, 0x0000064A, 0x0000062C, 0x0000064A,
+0x00000000, 0x0000064A, 0x00000645, 0x0000064A, 0x00000000, 0x00000645,
+0x00000645, 0x0000064A, 0x00000000, 0x00000642, 0x00000645, 0x0000064A,
+0x00000000, 0x00000646, 0x0000062D, 0x0000064A, 0x00000000, 0x00000639,
+0x00000645, 0x0000064A, 0x00000000, 0x00000643, 0x00000645, 0x0000064A,
+0x00000000, 0x00000646, 0x0000062C, 0x0000062D, 0x00000000, 0x00000645,
+0x0000062E, 0x0000064A, 0x00000000, 0x00000644, 0x0000062C, 0x00000645,
+0x00000000, 0x00000643, 0x00000645, 0x00000645, 0x00000000, 0x0000062C,
+0x0000062D, 0x0000064A, 0x00000000, 0x0000062D, 0x0000062C, 0x0000064A,
+0x00000000, 0x00000645, 0x0000062C, 0x0000064A, 0x00000000, 0x00000641,
+0x00000645, 0x0000064A, 0x00000000, 0x00000628, 0x0000062D, 0x0000064A,
+0x00000000, 0x00000633, 0x0000062E, 0x0000064A, 0x00000000, 0x00000646,
+0x0000062C, 0x0000064A, 0x00000000, 0x00000635, 0x00000644, 0x000006D2,
+0x00000000, 0x00000642, 0x00000644, 0x000006D2, 0x00000000, 0x00000627,
+0x00000644, 0x00000644, 0x00000647, 0x00000000, 0x00000627, 0x00000643,
+0x00000628, 0x00000631, 0x00000000, 0x00000645, 0x0000062D, 0x00000645,
+0x0000062F, 0x00000000, 0x00000635, 0x00000644, 0x00000639, 0x00000645,
+0x00000000, 0x00000631, 0x00000633, 0x00000648, 0x00000644, 0x00000000,
+0x00000639, 0x00000644, 0x0000064A, 0x00000647, 0x00000000, 0x00000648,
+0x00000633, 0x00000644, 0x00000645, 0x00000000, 0x00000635, 0x00000644,
+0x00000649, 0x00000000, 0x00000635, 0x00000644, 0x00000649, 0x00000020,
+0x00000627, 0x00000644, 0x00000644, 0x00000647, 0x00000020, 0x00000639,
+0x00000644, 0x0000064A, 0x00000647, 0x00000020, 0x00000648, 0x00000633,
+0x00000644, 0x00000645, 0x00000000, 0x0000062C, 0x00000644, 0x00000020,
+0x0000062C, 0x00000644, 0x00000627, 0x00000644, 0x00000647, 0x00000000,
+0x00000631, 0x000006CC, 0x00000627, 0x00000644, 0x00000000, 0x0000002C,
+0x00000000, 0x00003001, 0x00000000, 0x00003002, 0x00000000, 0x0000003A,
+0x00000000, 0x00000021, 0x00000000, 0x0000003F, 0x00000000, 0x00003016,
+0x00000000, 0x00003017, 0x00000000, 0x00002026, 0x00000000, 0x00002025,
+0x00000000, 0x00002014, 0x00000000, 0x00002013, 0x00000000, 0x0000005F,
+0x00000000, 0x0000007B, 0x00000000, 0x0000007D, 0x00000000, 0x00003014,
+0x00000000, 0x00003015, 0x00000000, 0x00003010, 0x00000000, 0x00003011,
+0x00000000, 0x0000300A, 0x00000000, 0x0000300B, 0x00000000, 0x0000300C,
+0x00000000, 0x0000300D, 0x00000000, 0x0000300E, 0x00000000, 0x0000300F,
+0x00000000, 0x0000005B, 0x00000000, 0x0000005D, 0x00000000, 0x0000203E,
+0x00000000, 0x00000023, 0x00000000, 0x00000026, 0x00000000, 0x0000002A,
+0x00000000, 0x0000002D, 0x00000000, 0x0000003C, 0x00000000, 0x0000003E,
+0x00000000, 0x0000005C, 0x00000000, 0x00000024, 0x00000000, 0x00000025,
+0x00000000, 0x00000040, 0x00000000, 0x00000020, 0x0000064B, 0x00000000,
+0x00000640, 0x0000064B, 0x00000000, 0x00000020, 0x0000064C, 0x00000000,
+0x00000020, 0x0000064D, 0x00000000, 0x00000020, 0x0000064E, 0x00000000,
+0x00000640, 0x0000064E, 0x00000000, 0x00000020, 0x0000064F, 0x00000000,
+0x00000640, 0x0000064F, 0x00000000, 0x00000020, 0x00000650, 0x00000000,
+0x00000640, 0x00000650, 0x00000000, 0x00000020, 0x00000651, 0x00000000,
+0x00000640, 0x00000651, 0x00000000, 0x00000020, 0x00000652, 0x00000000,
+0x00000640, 0x00000652, 0x00000000, 0x00000621, 0x00000000, 0x00000622,
+0x00000000, 0x00000623, 0x00000000, 0x00000624, 0x00000000, 0x00000625,
+0x00000000, 0x00000626, 0x00000000, 0x00000627, 0x00000000, 0x00000628,
+0x00000000, 0x00000629, 0x00000000, 0x0000062A, 0x00000000, 0x0000062B,
+0x00000000, 0x0000062C, 0x00000000, 0x0000062D, 0x00000000, 0x0000062E,
+0x00000000, 0x0000062F, 0x00000000, 0x00000630, 0x00000000, 0x00000631,
+0x00000000, 0x00000632, 0x00000000, 0x00000633, 0x00000000, 0x00000634,
+0x00000000, 0x00000635, 0x00000000, 0x00000636, 0x00000000, 0x00000637,
+0x00000000, 0x00000638, 0x00000000, 0x00000639, 0x00000000, 0x0000063A,
+0x00000000, 0x00000641, 0x00000000, 0x00000642, 0x00000000, 0x00000643,
+0x00000000, 0x00000644, 0x00000000, 0x00000645, 0x00000000, 0x00000646,
+0x00000000, 0x00000647, 0x00000000, 0x00000648, 0x00000000, 0x0000064A,
+0x00000000, 0x00000644, 0x00000622, 0x00000000, 0x00000644, 0x00000623,
+0x00000000, 0x00000644, 0x00000625, 0x00000000, 0x00000644, 0x00000627,
+0x00000000, 0x00000022, 0x00000000, 0x00000027, 0x00000000, 0x0000002F,
+0x00000000, 0x0000005E, 0x00000000, 0x0000007C, 0x00000000, 0x0000007E,
+0x00000000, 0x00002985, 0x00000000, 0x00002986, 0x00000000, 0x000030FB,
+0x00000000, 0x000030A1, 0x00000000, 0x000030A3, 0x00000000, 0x000030A5,
+0x00000000, 0x000030A7, 0x00000000, 0x000030A9, 0x00000000, 0x000030E3,
+0x00000000, 0x000030E5, 0x00000000, 0x000030E7, 0x00000000, 0x000030C3,
+0x00000000, 0x000030FC, 0x00000000, 0x000030F3, 0x00000000, 0x00003099,
+0x00000000, 0x0000309A, 0x00000000, 0x00003164, 0x00000000, 0x00003131,
+0x00000000, 0x00003132, 0x00000000, 0x00003133, 0x00000000, 0x00003134,
+0x00000000, 0x00003135, 0x00000000, 0x00003136, 0x00000000, 0x00003137,
+0x00000000, 0x00003138, 0x00000000, 0x00003139, 0x00000000, 0x0000313A,
+0x00000000, 0x0000313B, 0x00000000, 0x0000313C, 0x00000000, 0x0000313D,
+0x00000000, 0x0000313E, 0x00000000, 0x0000313F, 0x00000000, 0x00003140,
+0x00000000, 0x00003141, 0x00000000, 0x00003142, 0x00000000, 0x00003143,
+0x00000000, 0x00003144, 0x00000000, 0x00003145, 0x00000000, 0x00003146,
+0x00000000, 0x00003147, 0x00000000, 0x00003148, 0x00000000, 0x00003149,
+0x00000000, 0x0000314A, 0x00000000, 0x0000314B, 0x00000000, 0x0000314C,
+0x00000000, 0x0000314D, 0x00000000, 0x0000314E, 0x00000000, 0x0000314F,
+0x00000000, 0x00003150, 0x00000000, 0x00003151, 0x00000000, 0x00003152,
+0x00000000, 0x00003153, 0x00000000, 0x00003154, 0x00000000, 0x00003155,
+0x00000000, 0x00003156, 0x00000000, 0x00003157, 0x00000000, 0x00003158,
+0x00000000, 0x00003159, 0x00000000, 0x0000315A, 0x00000000, 0x0000315B,
+0x00000000, 0x0000315C, 0x00000000, 0x0000315D, 0x00000000, 0x0000315E,
+0x00000000, 0x0000315F, 0x00000000, 0x00003160, 0x00000000, 0x00003161,
+0x00000000, 0x00003162, 0x00000000, 0x00003163, 0x00000000, 0x000000A2,
+0x00000000, 0x000000A3, 0x00000000, 0x000000AC, 0x00000000, 0x000000AF,
+0x00000000, 0x000000A6, 0x00000000, 0x000000A5, 0x00000000, 0x000020A9,
+0x00000000, 0x00002502, 0x00000000, 0x00002190, 0x00000000, 0x00002191,
+0x00000000, 0x00002192, 0x00000000, 0x00002193, 0x00000000, 0x000025A0,
+0x00000000, 0x000025CB, 0x00000000, 0x00011099, 0x000110BA, 0x00000000,
+0x0001109B, 0x000110BA, 0x00000000, 0x000110A5, 0x000110BA, 0x00000000,
+0x00011131, 0x00011127, 0x00000000, 0x00011132, 0x00011127, 0x00000000,
+0x00011347, 0x0001133E, 0x00000000, 0x00011347, 0x00011357, 0x00000000,
+0x000114B9, 0x000114BA, 0x00000000, 0x000114B9, 0x000114B0, 0x00000000,
+0x000114B9, 0x000114BD, 0x00000000, 0x000115B8, 0x000115AF, 0x00000000,
+0x000115B9, 0x000115AF, 0x00000000, 0x00011935, 0x00011930, 0x00000000,
+0x0001D157, 0x0001D165, 0x00000000, 0x0001D158, 0x0001D165, 0x00000000,
+0x0001D15F, 0x0001D16E, 0x00000000, 0x0001D15F, 0x0001D16F, 0x00000000,
+0x0001D15F, 0x0001D170, 0x00000000, 0x0001D15F, 0x0001D171, 0x00000000,
+0x0001D15F, 0x0001D172, 0x00000000, 0x0001D1B9, 0x0001D165, 0x00000000,
+0x0001D1BA, 0x0001D165, 0x00000000, 0x0001D1BB, 0x0001D16E, 0x00000000,
+0x0001D1BC, 0x0001D16E, 0x00000000, 0x0001D1BB, 0x0001D16F, 0x00000000,
+0x0001D1BC, 0x0001D16F, 0x00000000, 0x00000131, 0x00000000, 0x00000237,
+0x00000000, 0x00000391, 0x00000000, 0x00000392, 0x00000000, 0x00000394,
+0x00000000, 0x00000395, 0x00000000, 0x00000396, 0x00000000, 0x00000397,
+0x00000000, 0x00000399, 0x00000000, 0x0000039A, 0x00000000, 0x0000039B,
+0x00000000, 0x0000039C, 0x00000000, 0x0000039D, 0x00000000, 0x0000039E,
+0x00000000, 0x0000039F, 0x00000000, 0x000003A1, 0x00000000, 0x000003F4,
+0x00000000, 0x000003A4, 0x00000000, 0x000003A6, 0x00000000, 0x000003A7,
+0x00000000, 0x000003A8, 0x00000000, 0x00002207, 0x00000000, 0x000003B1,
+0x00000000, 0x000003B6, 0x00000000, 0x000003B7, 0x00000000, 0x000003BB,
+0x00000000, 0x000003BD, 0x00000000, 0x000003BE, 0x00000000, 0x000003BF,
+0x00000000, 0x000003C3, 0x00000000, 0x000003C4, 0x00000000, 0x000003C5,
+0x00000000, 0x000003C8, 0x00000000, 0x000003C9, 0x00000000, 0x00002202,
+0x00000000, 0x000003F5, 0x00000000, 0x000003D1, 0x00000000, 0x000003F0,
+0x00000000, 0x000003D5, 0x00000000, 0x000003F1, 0x00000000, 0x000003D6,
+0x00000000, 0x000003DC, 0x00000000, 0x000003DD, 0x00000000, 0x0000066E,
+0x00000000, 0x000006A1, 0x00000000, 0x0000066F, 0x00000000, 0x00000030,
+0x0000002E, 0x00000000, 0x00000030, 0x0000002C, 0x00000000, 0x00000031,
+0x0000002C, 0x00000000, 0x00000032, 0x0000002C, 0x00000000, 0x00000033,
+0x0000002C, 0x00000000, 0x00000034, 0x0000002C, 0x00000000, 0x00000035,
+0x0000002C, 0x00000000, 0x00000036, 0x0000002C, 0x00000000, 0x00000037,
+0x0000002C, 0x00000000, 0x00000038, 0x0000002C, 0x00000000, 0x00000039,
+0x0000002C, 0x00000000, 0x00000028, 0x00000041, 0x00000029, 0x00000000,
+0x00000028, 0x00000042, 0x00000029, 0x00000000, 0x00000028, 0x00000043,
+0x00000029, 0x00000000, 0x00000028, 0x00000044, 0x00000029, 0x00000000,
+0x00000028, 0x00000045, 0x00000029, 0x00000000, 0x00000028, 0x00000046,
+0x00000029, 0x00000000, 0x00000028, 0x00000047, 0x00000029, 0x00000000,
+0x00000028, 0x00000048, 0x00000029, 0x00000000, 0x00000028, 0x00000049,
+0x00000029, 0x00000000, 0x00000028, 0x0000004A, 0x00000029, 0x00000000,
+0x00000028, 0x0000004B, 0x00000029, 0x00000000, 0x00000028, 0x0000004C,
+0x00000029, 0x00000000, 0x00000028, 0x0000004D, 0x00000029, 0x00000000,
+0x00000028, 0x0000004E, 0x00000029, 0x00000000, 0x00000028, 0x0000004F,
+0x00000029, 0x00000000, 0x00000028, 0x00000050, 0x00000029, 0x00000000,
+0x00000028, 0x00000051, 0x00000029, 0x00000000, 0x00000028, 0x00000052,
+0x00000029, 0x00000000, 0x00000028, 0x00000053, 0x00000029, 0x00000000,
+0x00000028, 0x00000054, 0x00000029, 0x00000000, 0x00000028, 0x00000055,
+0x00000029, 0x00000000, 0x00000028, 0x00000056, 0x00000029, 0x00000000,
+0x00000028, 0x00000057, 0x00000029, 0x00000000, 0x00000028, 0x00000058,
+0x00000029, 0x00000000, 0x00000028, 0x00000059, 0x00000029, 0x00000000,
+0x00000028, 0x0000005A, 0x00000029, 0x00000000, 0x00003014, 0x00000053,
+0x00003015, 0x00000000, 0x00000043, 0x00000044, 0x00000000, 0x00000057,
+0x0000005A, 0x00000000, 0x00000048, 0x00000056, 0x00000000, 0x00000053,
+0x00000044, 0x00000000, 0x00000053, 0x00000053, 0x00000000, 0x00000050,
+0x00000050, 0x00000056, 0x00000000, 0x00000057, 0x00000043, 0x00000000,
+0x0000004D, 0x00000043, 0x00000000, 0x0000004D, 0x00000044, 0x00000000,
+0x0000004D, 0x00000052, 0x00000000, 0x00000044, 0x0000004A, 0x00000000,
+0x0000307B, 0x0000304B, 0x00000000, 0x000030B3, 0x000030B3, 0x00000000,
+0x00005B57, 0x00000000, 0x000053CC, 0x00000000, 0x000030C7, 0x00000000,
+0x0000591A, 0x00000000, 0x000089E3, 0x00000000, 0x00004EA4, 0x00000000,
+0x00006620, 0x00000000, 0x00007121, 0x00000000, 0x0000524D, 0x00000000,
+0x00005F8C, 0x00000000, 0x0000518D, 0x00000000, 0x000065B0, 0x00000000,
+0x0000521D, 0x00000000, 0x00007D42, 0x00000000, 0x00008CA9, 0x00000000,
+0x000058F0, 0x00000000, 0x00005439, 0x00000000, 0x00006F14, 0x00000000,
+0x00006295, 0x00000000, 0x00006355, 0x00000000, 0x0000904A, 0x00000000,
+0x00006307, 0x00000000, 0x00006253, 0x00000000, 0x00007981, 0x00000000,
+0x00007A7A, 0x00000000, 0x00005408, 0x00000000, 0x00006E80, 0x00000000,
+0x00007533, 0x00000000, 0x00005272, 0x00000000, 0x000055B6, 0x00000000,
+0x0000914D, 0x00000000, 0x00003014, 0x0000672C, 0x00003015, 0x00000000,
+0x00003014, 0x00004E09, 0x00003015, 0x00000000, 0x00003014, 0x00004E8C,
+0x00003015, 0x00000000, 0x00003014, 0x00005B89, 0x00003015, 0x00000000,
+0x00003014, 0x000070B9, 0x00003015, 0x00000000, 0x00003014, 0x00006253,
+0x00003015, 0x00000000, 0x00003014, 0x000076D7, 0x00003015, 0x00000000,
+0x00003014, 0x000052DD, 0x00003015, 0x00000000, 0x00003014, 0x00006557,
+0x00003015, 0x00000000, 0x00005F97, 0x00000000, 0x000053EF, 0x00000000,
+0x00004E3D, 0x00000000, 0x00004E38, 0x00000000, 0x00004E41, 0x00000000,
+0x00020122, 0x00000000, 0x00004F60, 0x00000000, 0x00004FBB, 0x00000000,
+0x00005002, 0x00000000, 0x0000507A, 0x00000000, 0x00005099, 0x00000000,
+0x000050CF, 0x00000000, 0x0000349E, 0x00000000, 0x0002063A, 0x00000000,
+0x00005154, 0x00000000, 0x00005164, 0x00000000, 0x00005177, 0x00000000,
+0x0002051C, 0x00000000, 0x000034B9, 0x00000000, 0x00005167, 0x00000000,
+0x0002054B, 0x00000000, 0x00005197, 0x00000000, 0x000051A4, 0x00000000,
+0x00004ECC, 0x00000000, 0x000051AC, 0x00000000, 0x000291DF, 0x00000000,
+0x00005203, 0x00000000, 0x000034DF, 0x00000000, 0x0000523B, 0x00000000,
+0x00005246, 0x00000000, 0x00005277, 0x00000000, 0x00003515, 0x00000000,
+0x00005305, 0x00000000, 0x00005306, 0x00000000, 0x00005349, 0x00000000,
+0x0000535A, 0x00000000, 0x00005373, 0x00000000, 0x0000537D, 0x00000000,
+0x0000537F, 0x00000000, 0x00020A2C, 0x00000000, 0x00007070, 0x00000000,
+0x000053CA, 0x00000000, 0x000053DF, 0x00000000, 0x00020B63, 0x00000000,
+0x000053EB, 0x00000000, 0x000053F1, 0x00000000, 0x00005406, 0x00000000,
+0x0000549E, 0x00000000, 0x00005438, 0x00000000, 0x00005448, 0x00000000,
+0x00005468, 0x00000000, 0x000054A2, 0x00000000, 0x000054F6, 0x00000000,
+0x00005510, 0x00000000, 0x00005553, 0x00000000, 0x00005563, 0x00000000,
+0x00005584, 0x00000000, 0x000055AB, 0x00000000, 0x000055B3, 0x00000000,
+0x000055C2, 0x00000000, 0x00005716, 0x00000000, 0x00005717, 0x00000000,
+0x00005651, 0x00000000, 0x00005674, 0x00000000, 0x000058EE, 0x00000000,
+0x000057CE, 0x00000000, 0x000057F4, 0x00000000, 0x0000580D, 0x00000000,
+0x0000578B, 0x00000000, 0x00005832, 0x00000000, 0x00005831, 0x00000000,
+0x000058AC, 0x00000000, 0x000214E4, 0x00000000, 0x000058F2, 0x00000000,
+0x000058F7, 0x00000000, 0x00005906, 0x00000000, 0x00005922, 0x00000000,
+0x00005962, 0x00000000, 0x000216A8, 0x00000000, 0x000216EA, 0x00000000,
+0x000059EC, 0x00000000, 0x00005A1B, 0x00000000, 0x00005A27, 0x00000000,
+0x000059D8, 0x00000000, 0x00005A66, 0x00000000, 0x000036EE, 0x00000000,
+0x000036FC, 0x00000000, 0x00005B08, 0x00000000, 0x00005B3E, 0x00000000,
+0x000219C8, 0x00000000, 0x00005BC3, 0x00000000, 0x00005BD8, 0x00000000,
+0x00005BF3, 0x00000000, 0x00021B18, 0x00000000, 0x00005BFF, 0x00000000,
+0x00005C06, 0x00000000, 0x00005F53, 0x00000000, 0x00003781, 0x00000000,
+0x00005C60, 0x00000000, 0x00005CC0, 0x00000000, 0x00005C8D, 0x00000000,
+0x00021DE4, 0x00000000, 0x00005D43, 0x00000000, 0x00021DE6, 0x00000000,
+0x00005D6E, 0x00000000, 0x00005D6B, 0x00000000, 0x00005D7C, 0x00000000,
+0x00005DE1, 0x00000000, 0x00005DE2, 0x00000000, 0x0000382F, 0x00000000,
+0x00005DFD, 0x00000000, 0x00005E28, 0x00000000, 0x00005E3D, 0x00000000,
+0x00005E69, 0x00000000, 0x00003862, 0x00000000, 0x00022183, 0x00000000,
+0x0000387C, 0x00000000, 0x00005EB0, 0x00000000, 0x00005EB3, 0x00000000,
+0x00005EB6, 0x00000000, 0x0002A392, 0x00000000, 0x00022331, 0x00000000,
+0x00008201, 0x00000000, 0x00005F22, 0x00000000, 0x000038C7, 0x00000000,
+0x000232B8, 0x00000000, 0x000261DA, 0x00000000, 0x00005F62, 0x00000000,
+0x00005F6B, 0x00000000, 0x000038E3, 0x00000000, 0x00005F9A, 0x00000000,
+0x00005FCD, 0x00000000, 0x00005FD7, 0x00000000, 0x00005FF9, 0x00000000,
+0x00006081, 0x00000000, 0x0000393A, 0x00000000, 0x0000391C, 0x00000000,
+0x000226D4, 0x00000000, 0x000060C7, 0x00000000, 0x00006148, 0x00000000,
+0x0000614C, 0x00000000, 0x0000617A, 0x00000000, 0x000061B2, 0x00000000,
+0x000061A4, 0x00000000, 0x000061AF, 0x00000000, 0x000061DE, 0x00000000,
+0x00006210, 0x00000000, 0x0000621B, 0x00000000, 0x0000625D, 0x00000000,
+0x000062B1, 0x00000000, 0x000062D4, 0x00000000, 0x00006350, 0x00000000,
+0x00022B0C, 0x00000000, 0x0000633D, 0x00000000, 0x000062FC, 0x00000000,
+0x00006368, 0x00000000, 0x00006383, 0x00000000, 0x000063E4, 0x00000000,
+0x00022BF1, 0x00000000, 0x00006422, 0x00000000, 0x000063C5, 0x00000000,
+0x000063A9, 0x00000000, 0x00003A2E, 0x00000000, 0x00006469, 0x00000000,
+0x0000647E, 0x00000000, 0x0000649D, 0x00000000, 0x00006477, 0x00000000,
+0x00003A6C, 0x00000000, 0x0000656C, 0x00000000, 0x0002300A, 0x00000000,
+0x000065E3, 0x00000000, 0x000066F8, 0x00000000, 0x00006649, 0x00000000,
+0x00003B19, 0x00000000, 0x00003B08, 0x00000000, 0x00003AE4, 0x00000000,
+0x00005192, 0x00000000, 0x00005195, 0x00000000, 0x00006700, 0x00000000,
+0x0000669C, 0x00000000, 0x000080AD, 0x00000000, 0x000043D9, 0x00000000,
+0x00006721, 0x00000000, 0x0000675E, 0x00000000, 0x00006753, 0x00000000,
+0x000233C3, 0x00000000, 0x00003B49, 0x00000000, 0x000067FA, 0x00000000,
+0x00006785, 0x00000000, 0x00006852, 0x00000000, 0x0002346D, 0x00000000,
+0x0000688E, 0x00000000, 0x0000681F, 0x00000000, 0x00006914, 0x00000000,
+0x00006942, 0x00000000, 0x000069A3, 0x00000000, 0x000069EA, 0x00000000,
+0x00006AA8, 0x00000000, 0x000236A3, 0x00000000, 0x00006ADB, 0x00000000,
+0x00003C18, 0x00000000, 0x00006B21, 0x00000000, 0x000238A7, 0x00000000,
+0x00006B54, 0x00000000, 0x00003C4E, 0x00000000, 0x00006B72, 0x00000000,
+0x00006B9F, 0x00000000, 0x00006BBB, 0x00000000, 0x00023A8D, 0x00000000,
+0x00021D0B, 0x00000000, 0x00023AFA, 0x00000000, 0x00006C4E, 0x00000000,
+0x00023CBC, 0x00000000, 0x00006CBF, 0x00000000, 0x00006CCD, 0x00000000,
+0x00006C67, 0x00000000, 0x00006D16, 0x00000000, 0x00006D3E, 0x00000000,
+0x00006D69, 0x00000000, 0x00006D78, 0x00000000, 0x00006D85, 0x00000000,
+0x00023D1E, 0x00000000, 0x00006D34, 0x00000000, 0x00006E2F, 0x00000000,
+0x00006E6E, 0x00000000, 0x00003D33, 0x00000000, 0x00006EC7, 0x00000000,
+0x00023ED1, 0x00000000, 0x00006DF9, 0x00000000, 0x00006F6E, 0x00000000,
+0x00023F5E, 0x00000000, 0x00023F8E, 0x00000000, 0x00006FC6, 0x00000000,
+0x00007039, 0x00000000, 0x0000701B, 0x00000000, 0x00003D96, 0x00000000,
+0x0000704A, 0x00000000, 0x0000707D, 0x00000000, 0x00007077, 0x00000000,
+0x000070AD, 0x00000000, 0x00020525, 0x00000000, 0x00007145, 0x00000000,
+0x00024263, 0x00000000, 0x0000719C, 0x00000000, 0x000243AB, 0x00000000,
+0x00007228, 0x00000000, 0x00007250, 0x00000000, 0x00024608, 0x00000000,
+0x00007280, 0x00000000, 0x00007295, 0x00000000, 0x00024735, 0x00000000,
+0x00024814, 0x00000000, 0x0000737A, 0x00000000, 0x0000738B, 0x00000000,
+0x00003EAC, 0x00000000, 0x000073A5, 0x00000000, 0x00003EB8, 0x00000000,
+0x00007447, 0x00000000, 0x0000745C, 0x00000000, 0x00007485, 0x00000000,
+0x000074CA, 0x00000000, 0x00003F1B, 0x00000000, 0x00007524, 0x00000000,
+0x00024C36, 0x00000000, 0x0000753E, 0x00000000, 0x00024C92, 0x00000000,
+0x0002219F, 0x00000000, 0x00007610, 0x00000000, 0x00024FA1, 0x00000000,
+0x00024FB8, 0x00000000, 0x00025044, 0x00000000, 0x00003FFC, 0x00000000,
+0x00004008, 0x00000000, 0x000250F3, 0x00000000, 0x000250F2, 0x00000000,
+0x00025119, 0x00000000, 0x00025133, 0x00000000, 0x0000771E, 0x00000000,
+0x0000771F, 0x00000000, 0x0000778B, 0x00000000, 0x00004046, 0x00000000,
+0x00004096, 0x00000000, 0x0002541D, 0x00000000, 0x0000784E, 0x00000000,
+0x000040E3, 0x00000000, 0x00025626, 0x00000000, 0x0002569A, 0x00000000,
+0x000256C5, 0x00000000, 0x000079EB, 0x00000000, 0x0000412F, 0x00000000,
+0x00007A4A, 0x00000000, 0x00007A4F, 0x00000000, 0x0002597C, 0x00000000,
+0x00025AA7, 0x00000000, 0x00007AEE, 0x00000000, 0x00004202, 0x00000000,
+0x00025BAB, 0x00000000, 0x00007BC6, 0x00000000, 0x00007BC9, 0x00000000,
+0x00004227, 0x00000000, 0x00025C80, 0x00000000, 0x00007CD2, 0x00000000,
+0x000042A0, 0x00000000, 0x00007CE8, 0x00000000, 0x00007CE3, 0x00000000,
+0x00007D00, 0x00000000, 0x00025F86, 0x00000000, 0x00007D63, 0x00000000,
+0x00004301, 0x00000000, 0x00007DC7, 0x00000000, 0x00007E02, 0x00000000,
+0x00007E45, 0x00000000, 0x00004334, 0x00000000, 0x00026228, 0x00000000,
+0x00026247, 0x00000000, 0x00004359, 0x00000000, 0x000262D9, 0x00000000,
+0x00007F7A, 0x00000000, 0x0002633E, 0x00000000, 0x00007F95, 0x00000000,
+0x00007FFA, 0x00000000, 0x000264DA, 0x00000000, 0x00026523, 0x00000000,
+0x00008060, 0x00000000, 0x000265A8, 0x00000000, 0x00008070, 0x00000000,
+0x0002335F, 0x00000000, 0x000043D5, 0x00000000, 0x000080B2, 0x00000000,
+0x00008103, 0x00000000, 0x0000440B, 0x00000000, 0x0000813E, 0x00000000,
+0x00005AB5, 0x00000000, 0x000267A7, 0x00000000, 0x000267B5, 0x00000000,
+0x00023393, 0x00000000, 0x0002339C, 0x00000000, 0x00008204, 0x00000000,
+0x00008F9E, 0x00000000, 0x0000446B, 0x00000000, 0x00008291, 0x00000000,
+0x0000828B, 0x00000000, 0x0000829D, 0x00000000, 0x000052B3, 0x00000000,
+0x000082B1, 0x00000000, 0x000082B3, 0x00000000, 0x000082BD, 0x00000000,
+0x000082E6, 0x00000000, 0x00026B3C, 0x00000000, 0x0000831D, 0x00000000,
+0x00008363, 0x00000000, 0x000083AD, 0x00000000, 0x00008323, 0x00000000,
+0x000083BD, 0x00000000, 0x000083E7, 0x00000000, 0x00008353, 0x00000000,
+0x000083CA, 0x00000000, 0x000083CC, 0x00000000, 0x000083DC, 0x00000000,
+0x00026C36, 0x00000000, 0x00026D6B, 0x00000000, 0x00026CD5, 0x00000000,
+0x0000452B, 0x00000000, 0x000084F1, 0x00000000, 0x000084F3, 0x00000000,
+0x00008516, 0x00000000, 0x000273CA, 0x00000000, 0x00008564, 0x00000000,
+0x00026F2C, 0x00000000, 0x0000455D, 0x00000000, 0x00004561, 0x00000000,
+0x00026FB1, 0x00000000, 0x000270D2, 0x00000000, 0x0000456B, 0x00000000,
+0x00008650, 0x00000000, 0x00008667, 0x00000000, 0x00008669, 0x00000000,
+0x000086A9, 0x00000000, 0x00008688, 0x00000000, 0x0000870E, 0x00000000,
+0x000086E2, 0x00000000, 0x00008728, 0x00000000, 0x0000876B, 0x00000000,
+0x00008786, 0x00000000, 0x000045D7, 0x00000000, 0x000087E1, 0x00000000,
+0x00008801, 0x00000000, 0x000045F9, 0x00000000, 0x00008860, 0x00000000,
+0x00027667, 0x00000000, 0x000088D7, 0x00000000, 0x000088DE, 0x00000000,
+0x00004635, 0x00000000, 0x000088FA, 0x00000000, 0x000034BB, 0x00000000,
+0x000278AE, 0x00000000, 0x00027966, 0x00000000, 0x000046BE, 0x00000000,
+0x000046C7, 0x00000000, 0x00008AA0, 0x00000000, 0x00027CA8, 0x00000000,
+0x00008CAB, 0x00000000, 0x00008CC1, 0x00000000, 0x00008D1B, 0x00000000,
+0x00008D77, 0x00000000, 0x00027F2F, 0x00000000, 0x00020804, 0x00000000,
+0x00008DCB, 0x00000000, 0x00008DBC, 0x00000000, 0x00008DF0, 0x00000000,
+0x000208DE, 0x00000000, 0x00008ED4, 0x00000000, 0x000285D2, 0x00000000,
+0x000285ED, 0x00000000, 0x00009094, 0x00000000, 0x000090F1, 0x00000000,
+0x00009111, 0x00000000, 0x0002872E, 0x00000000, 0x0000911B, 0x00000000,
+0x00009238, 0x00000000, 0x000092D7, 0x00000000, 0x000092D8, 0x00000000,
+0x0000927C, 0x00000000, 0x000093F9, 0x00000000, 0x00009415, 0x00000000,
+0x00028BFA, 0x00000000, 0x0000958B, 0x00000000, 0x00004995, 0x00000000,
+0x000095B7, 0x00000000, 0x00028D77, 0x00000000, 0x000049E6, 0x00000000,
+0x000096C3, 0x00000000, 0x00005DB2, 0x00000000, 0x00009723, 0x00000000,
+0x00029145, 0x00000000, 0x0002921A, 0x00000000, 0x00004A6E, 0x00000000,
+0x00004A76, 0x00000000, 0x000097E0, 0x00000000, 0x0002940A, 0x00000000,
+0x00004AB2, 0x00000000, 0x00029496, 0x00000000, 0x00009829, 0x00000000,
+0x000295B6, 0x00000000, 0x000098E2, 0x00000000, 0x00004B33, 0x00000000,
+0x00009929, 0x00000000, 0x000099A7, 0x00000000, 0x000099C2, 0x00000000,
+0x000099FE, 0x00000000, 0x00004BCE, 0x00000000, 0x00029B30, 0x00000000,
+0x00009C40, 0x00000000, 0x00009CFD, 0x00000000, 0x00004CCE, 0x00000000,
+0x00004CED, 0x00000000, 0x00009D67, 0x00000000, 0x0002A0CE, 0x00000000,
+0x00004CF8, 0x00000000, 0x0002A105, 0x00000000, 0x0002A20E, 0x00000000,
+0x0002A291, 0x00000000, 0x00004D56, 0x00000000, 0x00009EFE, 0x00000000,
+0x00009F05, 0x00000000, 0x00009F0F, 0x00000000, 0x00009F16, 0x00000000,
+0x0002A600, 0x00000000,
+};
+const uint16_t _decomposition_properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 832, 896, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 960, 1024,
+320, 320, 320, 320, 1088, 1152, 1216, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 1280, 1344, 320, 320, 320, 320, 320, 1408, 1472, 320,
+1536, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+1600, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320,
+};
+const uint16_t _decomposition_properties_stage2[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176,
+192, 208, 224, 0, 0, 240, 256, 272, 288, 304, 320, 336, 352, 368, 384, 0, 0, 0,
+0, 0, 0, 0, 400, 0, 416, 432, 0, 0, 0, 0, 0, 448, 0, 0, 464, 480, 496, 512, 528,
+544, 560, 0, 576, 592, 608, 0, 624, 0, 640, 0, 656, 0, 0, 0, 0, 672, 688, 704,
+720, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 752, 0, 0, 0, 0,
+768, 0, 0, 0, 0, 784, 800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 816, 832, 0, 848, 0, 0, 0,
+0, 0, 0, 864, 880, 0, 0, 0, 0, 0, 896, 0, 912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 928, 944, 0, 0, 0, 960, 0, 0, 976, 0, 0, 0, 0, 0, 0, 0, 992, 0, 0, 0,
+0, 0, 0, 0, 1008, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 1040, 0, 0,
+0, 0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 1072, 0, 1088, 0, 0, 1104, 0, 0, 0, 1120,
+1136, 1152, 1168, 1184, 1200, 1216, 1232, 0, 0, 0, 0, 0, 0, 1248, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1280, 1296, 0, 1312, 1328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1344, 1360, 1376, 1392,
+1408, 1424, 0, 1440, 1456, 1472, 0, 0, 0, 0, 1488, 1504, 1520, 1536, 1552, 1568,
+1584, 1600, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728, 1744, 1760, 1776,
+1792, 1808, 1824, 1840, 1856, 1872, 1888, 1904, 1920, 1936, 1952, 1968, 1984,
+2000, 2016, 2032, 2048, 2064, 2080, 0, 2096, 2112, 2128, 2144, 0, 0, 0, 0, 0,
+2160, 2176, 2192, 2208, 2224, 2240, 2256, 2272, 2288, 2304, 2320, 0, 2336, 0, 0,
+0, 2352, 0, 2368, 2384, 2400, 0, 2416, 2432, 2448, 0, 2464, 0, 0, 0, 2480, 0, 0,
+0, 2496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2512, 2528,
+2544, 2560, 2576, 2592, 2608, 2624, 2640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2656, 0, 0, 0, 0, 0, 0, 2672, 0, 0, 0,
+0, 0, 2688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 2704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2720, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2736, 0, 0, 0, 0, 0, 2752, 2768, 2784, 2800,
+2816, 2832, 2848, 2864, 2880, 2896, 2912, 2928, 2944, 2960, 2976, 0, 0, 2992, 0,
+0, 3008, 3024, 3040, 3056, 3072, 0, 3088, 3104, 3120, 3136, 3152, 0, 3168, 0, 0,
+0, 3184, 3200, 3216, 3232, 3248, 3264, 3280, 0, 0, 0, 0, 0, 0, 3296, 3312, 3328,
+3344, 3360, 3376, 3392, 3408, 3424, 3440, 3456, 3472, 3488, 3504, 3520, 3536,
+3552, 3568, 3584, 3600, 3616, 3632, 3648, 3664, 3680, 3696, 3712, 3728, 3744,
+3760, 3776, 3792, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3808, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 3824, 0, 0, 0, 0, 0, 0, 0, 3840, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3856, 3872, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3888, 3904, 3920,
+3936, 3952, 3968, 3984, 4000, 4016, 4032, 4048, 4064, 4080, 4096, 4112, 4128,
+4144, 4160, 4176, 4192, 4208, 4224, 4240, 4256, 4272, 4288, 4304, 4320, 4336,
+4352, 0, 0, 4368, 4384, 4400, 4416, 4432, 4448, 4464, 4480, 4496, 4512, 4528,
+4544, 0, 4560, 4576, 4592, 4608, 4624, 4640, 4656, 4672, 4688, 4704, 4720, 4736,
+4752, 4768, 4784, 4800, 4816, 4832, 4848, 4864, 4880, 4896, 4912, 0, 4928, 4944,
+4960, 4976, 4992, 5008, 5024, 5040, 0, 0, 5056, 0, 5072, 0, 5088, 5104, 5120,
+5136, 5152, 5168, 5184, 5200, 5216, 5232, 5248, 5264, 5280, 5296, 5312, 5328,
+5344, 5360, 5376, 5392, 5408, 5424, 5440, 5456, 5472, 5488, 5504, 5520, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 5536, 5552, 0, 0, 0, 0, 0, 0, 0, 5568, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+5584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5600, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5632, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 5648, 5664, 0, 0, 0, 0, 5680, 5696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5712, 5728,
+5744, 5760, 5776, 5792, 5808, 5824, 5840, 5856, 5872, 5888, 5904, 5712, 5728,
+5744, 5920, 5936, 5952, 5968, 5984, 6000, 6016, 6032, 6048, 6064, 5712, 5728,
+5744, 5760, 5776, 5952, 5808, 5824, 5840, 6016, 6032, 6048, 6064, 5712, 5728,
+5744, 6080, 6096, 6112, 6128, 6144, 6160, 6176, 6192, 6208, 6224, 6240, 6256,
+6272, 6288, 6304, 6320, 6336, 6352, 6368, 6384, 6400, 6416, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6432,
+6448, 6464, 6480, 6496, 6512, 6528, 6544, 6560, 6576, 6592, 6576, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 6608, 6624, 6640, 5712, 6656, 0, 6672, 0, 0, 6688, 0, 0, 0, 0, 0, 0,
+6704, 6720, 6736, 6752, 6768, 6784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6800, 6816, 6832,
+6848, 6864, 6880, 6896, 6912, 6928, 6944, 6960, 6976, 6992, 7008, 7024, 7040,
+7056, 7072, 7088, 7104, 7120, 7136, 7152, 7168, 7184, 7200, 7216, 7232, 7248,
+7264, 7280, 7296, 7312, 7328, 7344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+const uint16_t _decomposition_properties_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+13, 0, 0, 0, 0, 17, 0, 0, 23, 27, 31, 37, 0, 0, 41, 47, 51, 0, 55, 63, 71, 0,
+78, 84, 90, 96, 102, 108, 0, 114, 120, 126, 132, 138, 144, 150, 156, 162, 0,
+168, 174, 180, 186, 192, 198, 0, 0, 204, 210, 216, 222, 228, 0, 0, 234, 240,
+246, 252, 258, 264, 0, 270, 276, 282, 288, 294, 300, 306, 312, 318, 0, 324, 330,
+336, 342, 348, 354, 0, 0, 360, 366, 372, 378, 384, 0, 390, 396, 402, 408, 414,
+420, 426, 432, 438, 444, 450, 456, 462, 468, 474, 480, 486, 0, 0, 492, 498, 504,
+510, 516, 522, 528, 534, 540, 546, 552, 558, 564, 570, 576, 582, 588, 594, 600,
+606, 0, 0, 612, 618, 624, 630, 636, 642, 648, 654, 660, 0, 667, 673, 678, 684,
+690, 696, 0, 702, 708, 714, 720, 726, 732, 739, 745, 0, 0, 750, 756, 762, 768,
+774, 780, 787, 0, 0, 792, 798, 804, 810, 816, 822, 0, 0, 828, 834, 840, 846,
+852, 858, 864, 870, 876, 882, 888, 894, 900, 906, 912, 918, 924, 930, 0, 0, 936,
+942, 948, 954, 960, 966, 972, 978, 984, 990, 996, 1002, 1008, 1014, 1020, 1026,
+1032, 1038, 1044, 1050, 1056, 1062, 1068, 1075, 1078, 1084, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1090, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1103, 1109, 1115, 1121, 1127, 1133, 1139, 1145, 1151, 1156, 1162, 1168,
+1174, 1180, 1186, 1192, 1198, 1204, 1210, 1216, 1222, 1228, 1234, 1240, 1246, 0,
+1252, 1258, 1264, 1270, 1276, 1282, 0, 0, 1288, 1294, 1300, 1306, 1312, 1318,
+1324, 1330, 1336, 1342, 1348, 1355, 1361, 1367, 1372, 1378, 0, 0, 1384, 1390,
+1396, 1402, 1408, 1414, 1420, 1426, 1432, 1438, 1444, 1450, 1456, 1462, 1468,
+1474, 1480, 1486, 1492, 1498, 1504, 1510, 1516, 1522, 1528, 1534, 1540, 1546,
+1552, 1558, 1564, 1570, 1576, 1582, 1588, 1594, 0, 0, 1600, 1606, 0, 0, 0, 0, 0,
+0, 1612, 1618, 1624, 1630, 1636, 1642, 1648, 1654, 1660, 1666, 1672, 1678, 1684,
+1690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1697, 1701, 1705, 1709, 1713, 1717,
+1721, 1725, 1729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1733, 1739, 1745,
+1751, 1757, 1763, 0, 0, 1769, 1773, 1075, 1777, 1781, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1784, 1788, 0, 1792, 1796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1802, 0, 0, 0, 0, 0, 1807, 0, 0, 0, 1812, 0, 0, 0, 0, 0, 31, 1816, 1822, 1828,
+1832, 1838, 1844, 0, 1850, 0, 1856, 1862, 1868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1874, 1880, 1886, 1892, 1898, 1904,
+1910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1916, 1922, 1928, 1934, 1940, 0, 1947, 1951, 1955, 1958, 1964, 1971, 1975, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1979, 1983, 1987, 0, 1991, 1995, 0, 0, 0, 1999, 0, 0, 0, 0,
+0, 0, 2002, 2008, 0, 2014, 0, 0, 0, 2020, 0, 0, 0, 0, 2026, 2032, 2038, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 2044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2050, 0,
+0, 0, 0, 0, 0, 2056, 2062, 0, 2068, 0, 0, 0, 2074, 0, 0, 0, 0, 2080, 2086, 2092,
+0, 0, 0, 0, 0, 0, 0, 2098, 2104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2110, 2116, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2122, 2128, 2134, 2140, 0, 0, 2146, 2152, 0, 0,
+2158, 2164, 2170, 2176, 2182, 2188, 0, 0, 2194, 2200, 2206, 2212, 2218, 2224, 0,
+0, 2230, 2236, 2242, 2248, 2254, 2260, 2266, 2272, 2278, 2284, 2290, 2296, 0, 0,
+2302, 2308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2315, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 2320, 2326, 2332, 2338, 2344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+2351, 2357, 2363, 2369, 0, 0, 0, 0, 0, 0, 0, 2374, 0, 2380, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 2392, 0, 0, 0, 0, 0, 0, 0, 2398, 0, 0, 2404, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2410, 2416, 2422, 2428, 2434, 2440, 2446,
+2452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2458, 2464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 2470, 2476, 0, 2482, 0, 0, 0, 2488, 0, 0, 2494, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2500, 2506, 2512, 0, 0, 2518, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 2524, 0, 0, 2530, 2536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+2542, 2548, 0, 0, 0, 0, 0, 0, 2554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 2560, 2566, 2572, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2578, 0, 0,
+0, 0, 0, 0, 0, 2584, 0, 0, 0, 0, 0, 0, 2590, 2596, 0, 2602, 2608, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2614, 2620, 2626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 2632, 0, 2638, 2644, 2650, 0, 0, 0, 0, 2657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 2663, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2669, 2675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2681, 0, 0, 0, 0,
+0, 0, 2684, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2690, 0, 0, 0, 0, 2696, 0, 0, 0, 0, 2702,
+0, 0, 0, 0, 2708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2714, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 2720, 0, 2726, 2732, 2739, 2744, 2751, 0, 0, 0, 0, 0, 0, 0, 2756, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2768,
+0, 0, 0, 0, 2774, 0, 0, 0, 0, 2780, 0, 0, 0, 0, 2786, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2792, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2798, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2805, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2808, 0,
+2814, 0, 2820, 0, 2826, 0, 2832, 0, 0, 0, 2838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2844, 0, 2850, 0, 0, 2856, 2862, 0, 2868,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2875,
+2879, 2883, 0, 2887, 2891, 2895, 2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927,
+0, 2931, 2935, 2939, 2943, 2947, 2951, 2955, 13, 2959, 2963, 2967, 2971, 2975,
+2979, 2983, 2987, 2991, 2995, 0, 2999, 3003, 3007, 51, 3011, 3015, 3019, 3023,
+3027, 3031, 3035, 3039, 3043, 3047, 1947, 3051, 3055, 1971, 3059, 3063, 1709,
+3031, 3043, 1947, 3051, 1983, 1971, 3059, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+3067, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 3075, 3079,
+3083, 2991, 3087, 3091, 3095, 3099, 3103, 3107, 3111, 3115, 3119, 3123, 3127,
+3131, 3135, 3139, 3143, 3147, 3151, 3155, 3159, 3163, 3167, 3171, 3175, 3179,
+3183, 3187, 3191, 3195, 3199, 3203, 3207, 1951, 3210, 3216, 3222, 3228, 3234,
+3240, 3246, 3252, 3258, 3264, 3270, 3276, 3282, 3288, 3294, 3300, 3306, 3312,
+3318, 3324, 3330, 3336, 3342, 3348, 3354, 3360, 3366, 3372, 3378, 3384, 3390,
+3396, 3402, 3408, 3414, 3420, 3426, 3432, 3438, 3444, 3450, 3456, 3462, 3468,
+3474, 3480, 3486, 3492, 3498, 3504, 3510, 3516, 3522, 3528, 3534, 3540, 3546,
+3552, 3558, 3564, 3570, 3576, 3582, 3588, 3594, 3600, 3606, 3612, 3618, 3624,
+3630, 3636, 3642, 3648, 3654, 3660, 3666, 3672, 3678, 3684, 3690, 3696, 3702,
+3708, 3714, 3720, 3726, 3732, 3738, 3744, 3750, 3756, 3762, 3768, 3774, 3780,
+3786, 3792, 3798, 3804, 3810, 3816, 3822, 3828, 3834, 3840, 3846, 3852, 3858,
+3864, 3870, 3876, 3882, 3888, 3894, 3900, 3906, 3912, 3918, 3924, 3930, 3936,
+3942, 3948, 3954, 3960, 3966, 3972, 3978, 3984, 3990, 3996, 4002, 4008, 4014,
+4020, 4026, 4032, 4038, 4044, 4050, 4056, 4062, 4068, 4074, 4080, 4086, 4092,
+4098, 4104, 4110, 4116, 4122, 4128, 4135, 4140, 0, 0, 0, 0, 4146, 4152, 4158,
+4164, 4170, 4176, 4182, 4188, 4194, 4200, 4206, 4212, 4218, 4224, 4230, 4236,
+4242, 4248, 4254, 4260, 4266, 4272, 4278, 4284, 4290, 4296, 4302, 4308, 4314,
+4320, 4326, 4332, 4338, 4344, 4350, 4356, 4362, 4368, 4374, 4380, 4386, 4392,
+4398, 4404, 4410, 4416, 4422, 4428, 4434, 4440, 4446, 4452, 4458, 4464, 4470,
+4476, 4482, 4488, 4494, 4500, 4506, 4512, 4518, 4524, 4530, 4536, 4542, 4548,
+4554, 4560, 4566, 4572, 4578, 4584, 4590, 4596, 4602, 4608, 4614, 4620, 4626,
+4632, 4638, 4644, 4650, 4656, 4662, 4668, 4674, 4680, 0, 0, 0, 0, 0, 0, 4686,
+4692, 4698, 4704, 4710, 4716, 4722, 4728, 4734, 4740, 4746, 4752, 4758, 4764,
+4770, 4776, 4782, 4788, 4794, 4800, 4806, 4812, 0, 0, 4818, 4824, 4830, 4836,
+4842, 4848, 0, 0, 4854, 4860, 4866, 4872, 4878, 4884, 4890, 4896, 4902, 4908,
+4914, 4920, 4926, 4932, 4938, 4944, 4950, 4956, 4962, 4968, 4974, 4980, 4986,
+4992, 4998, 5004, 5010, 5016, 5022, 5028, 5034, 5040, 5046, 5052, 5058, 5064,
+5070, 5076, 0, 0, 5082, 5088, 5094, 5100, 5106, 5112, 0, 0, 5118, 5124, 5130,
+5136, 5142, 5148, 5154, 5160, 0, 5166, 0, 5172, 0, 5178, 0, 5184, 5190, 5196,
+5202, 5208, 5214, 5220, 5226, 5232, 5238, 5244, 5250, 5256, 5262, 5268, 5274,
+5280, 5286, 5292, 5296, 5302, 5306, 5312, 5316, 5322, 5326, 5332, 5336, 5342,
+5346, 5352, 0, 0, 5356, 5362, 5368, 5374, 5380, 5386, 5392, 5398, 5404, 5410,
+5416, 5422, 5428, 5434, 5440, 5446, 5452, 5458, 5464, 5470, 5476, 5482, 5488,
+5494, 5500, 5506, 5512, 5518, 5524, 5530, 5536, 5542, 5548, 5554, 5560, 5566,
+5572, 5578, 5584, 5590, 5596, 5602, 5608, 5614, 5620, 5626, 5632, 5638, 5644,
+5650, 5656, 5662, 5668, 0, 5674, 5680, 5686, 5692, 5698, 5704, 5708, 5715, 5720,
+5715, 5725, 5730, 5736, 5742, 5748, 0, 5754, 5760, 5766, 5772, 5776, 5782, 5786,
+5792, 5798, 5804, 5810, 5816, 5822, 5828, 0, 0, 5832, 5838, 5844, 5850, 5856,
+5862, 0, 5866, 5872, 5878, 5884, 5890, 5896, 5902, 5906, 5912, 5918, 5924, 5930,
+5936, 5942, 5948, 5952, 5958, 5964, 5968, 0, 0, 5972, 5978, 5984, 0, 5990, 5996,
+6002, 6008, 6012, 6018, 6022, 6028, 6033, 0, 6038, 6042, 3, 3, 3, 3, 3, 3, 3, 3,
+3, 0, 0, 0, 0, 0, 0, 6047, 0, 0, 0, 0, 0, 6051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 6057, 6061, 6067, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 6075, 6081, 0, 6089,
+6095, 0, 0, 0, 0, 6103, 0, 6109, 0, 0, 0, 0, 0, 0, 0, 0, 6115, 6121, 6127, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6133, 0, 0, 0, 0, 0, 0, 0, 3, 6143, 3063, 0, 0,
+6147, 6151, 6155, 6159, 6163, 6167, 6171, 6175, 6179, 6183, 6187, 6191, 6143,
+47, 23, 27, 6147, 6151, 6155, 6159, 6163, 6167, 6171, 6175, 6179, 6183, 6187, 0,
+13, 2979, 51, 1777, 2983, 1697, 2999, 1773, 3003, 6191, 3023, 1075, 3027, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 6195, 0, 0, 0, 0, 0, 0, 0, 6201, 6209, 6217, 6221, 0,
+6227, 6235, 6243, 0, 6247, 2995, 2903, 2903, 2903, 1697, 6253, 2907, 2907, 2919,
+1773, 0, 2927, 6257, 0, 0, 2939, 6263, 2943, 2943, 2943, 0, 0, 6267, 6273, 6281,
+0, 6287, 0, 6290, 0, 6287, 0, 2914, 6294, 2883, 6217, 0, 2979, 2891, 6299, 0,
+2923, 51, 6303, 6307, 6311, 6315, 3063, 0, 6319, 1975, 3051, 6327, 6331, 6335,
+0, 0, 0, 0, 2887, 2975, 2979, 3063, 1705, 0, 0, 0, 0, 0, 0, 6339, 6347, 6355,
+6365, 6373, 6381, 6389, 6397, 6405, 6413, 6421, 6429, 6437, 6445, 6453, 6461,
+2907, 6467, 6473, 6481, 6487, 6491, 6497, 6505, 6515, 6521, 6525, 6531, 2919,
+6217, 2887, 2923, 3063, 6539, 6545, 6553, 3043, 6559, 6565, 6573, 6583, 1777,
+6589, 6595, 1773, 3075, 2975, 3003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6603, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6610, 6616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 6622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6628, 6634,
+6640, 0, 0, 0, 0, 6646, 0, 0, 0, 0, 6652, 0, 0, 6658, 0, 0, 0, 0, 0, 0, 0, 6664,
+0, 6670, 0, 0, 0, 0, 0, 6677, 6683, 0, 6691, 6697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 6704, 0, 0, 6710, 0, 0, 6716, 0, 6722, 0, 0, 0, 0, 0, 0, 6728,
+0, 6734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6740, 6746, 6752, 6758, 6764, 0, 0, 6770,
+6776, 0, 0, 6782, 6788, 0, 0, 0, 0, 0, 0, 6794, 6800, 0, 0, 6806, 6812, 0, 0,
+6818, 6824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6830, 6836,
+6842, 6848, 6854, 6860, 6866, 6872, 0, 0, 0, 0, 0, 0, 6878, 6884, 6890, 6896, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6902, 6906, 0, 0, 0, 0, 0, 47, 23, 27, 6147, 6151,
+6155, 6159, 6163, 6167, 6911, 6917, 6923, 6929, 6935, 6941, 6947, 6953, 6959,
+6965, 6971, 6977, 6985, 6993, 7001, 7009, 7017, 7025, 7033, 7041, 7049, 7059,
+7069, 7079, 7089, 7099, 7109, 7119, 7129, 7139, 7149, 7159, 7165, 7171, 7177,
+7183, 7189, 7195, 7201, 7207, 7213, 7221, 7229, 7237, 7245, 7253, 7261, 7269,
+7277, 7285, 7293, 7301, 7309, 7317, 7325, 7333, 7341, 7349, 7357, 7365, 7373,
+7381, 7389, 7397, 7405, 7413, 7421, 7429, 7437, 7445, 7453, 7461, 7469, 7477,
+7485, 7493, 7501, 2875, 2883, 6217, 2887, 2891, 6299, 2899, 2903, 2907, 2911,
+2915, 2919, 2923, 2927, 2931, 2939, 6263, 2943, 7509, 2947, 2951, 6487, 2955,
+6521, 7513, 6287, 13, 2971, 3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705,
+2999, 1773, 3003, 6191, 51, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725,
+1777, 1729, 3195, 6143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7521,
+0, 0, 0, 0, 0, 0, 0, 7531, 7539, 7545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 7552, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1705,
+6487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7559, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 7563, 0, 0, 0, 7567, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 7571, 7575, 7579, 7583, 7587, 7591, 7595, 7599, 7603, 7607, 7611, 7615, 7619,
+7623, 7627, 7631, 7635, 7639, 7643, 7647, 7651, 7655, 7659, 7663, 7667, 7671,
+7675, 7679, 7683, 7687, 7691, 7695, 7699, 7703, 7707, 7711, 7715, 7719, 7723,
+7727, 7731, 7735, 7739, 7743, 7747, 7751, 7755, 7759, 7763, 7767, 7771, 7775,
+7779, 7783, 7787, 7791, 7795, 7799, 7803, 7807, 7811, 7815, 7819, 7823, 7827,
+7831, 7835, 7839, 7843, 7847, 7851, 7855, 7859, 7863, 7867, 7871, 7875, 7879,
+7883, 7887, 7891, 7895, 7899, 7903, 7907, 7911, 7915, 7919, 7923, 7927, 7931,
+7935, 7939, 7943, 7947, 7951, 7955, 7959, 7963, 7967, 7971, 7975, 7979, 7983,
+7987, 7991, 7995, 7999, 8003, 8007, 8011, 8015, 8019, 8023, 8027, 8031, 8035,
+8039, 8043, 8047, 8051, 8055, 8059, 8063, 8067, 8071, 8075, 8079, 8083, 8087,
+8091, 8095, 8099, 8103, 8107, 8111, 8115, 8119, 8123, 8127, 8131, 8135, 8139,
+8143, 8147, 8151, 8155, 8159, 8163, 8167, 8171, 8175, 8179, 8183, 8187, 8191,
+8195, 8199, 8203, 8207, 8211, 8215, 8219, 8223, 8227, 8231, 8235, 8239, 8243,
+8247, 8251, 8255, 8259, 8263, 8267, 8271, 8275, 8279, 8283, 8287, 8291, 8295,
+8299, 8303, 8307, 8311, 8315, 8319, 8323, 8327, 8331, 8335, 8339, 8343, 8347,
+8351, 8355, 8359, 8363, 8367, 8371, 8375, 8379, 8383, 8387, 8391, 8395, 8399,
+8403, 8407, 8411, 8415, 8419, 8423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8427, 0, 7663, 8431, 8435, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8438, 0, 8444, 0, 8450, 0, 8456,
+0, 8462, 0, 8468, 0, 8474, 0, 8480, 0, 8486, 0, 8492, 0, 8498, 0, 8504, 0, 0,
+8510, 0, 8516, 0, 8522, 0, 0, 0, 0, 0, 0, 8528, 8534, 0, 8540, 8546, 0, 8552,
+8558, 0, 8564, 8570, 0, 8576, 8582, 0, 0, 0, 0, 0, 0, 8588, 0, 0, 0, 0, 0, 0,
+8595, 8601, 0, 8606, 8613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8618, 0, 8624, 0,
+8630, 0, 8636, 0, 8642, 0, 8648, 0, 8654, 0, 8660, 0, 8666, 0, 8672, 0, 8678, 0,
+8684, 0, 0, 8690, 0, 8696, 0, 8702, 0, 0, 0, 0, 0, 0, 8708, 8714, 0, 8720, 8726,
+0, 8732, 8738, 0, 8744, 8750, 0, 8756, 8762, 0, 0, 0, 0, 0, 0, 8768, 0, 0, 8774,
+8780, 8786, 8792, 0, 0, 0, 8798, 8805, 0, 8811, 8815, 8819, 8823, 8827, 8831,
+8835, 8839, 8843, 8847, 8851, 8855, 8859, 8863, 8867, 8871, 8875, 8879, 8883,
+8887, 8891, 8895, 8899, 8903, 8907, 8911, 8915, 8919, 8923, 8927, 8931, 8935,
+8939, 8943, 8947, 8951, 8955, 8959, 8963, 8967, 8971, 8975, 8979, 8983, 8987,
+8991, 8995, 8999, 9003, 9007, 9011, 9015, 9019, 9023, 9027, 9031, 9035, 9039,
+9043, 9047, 9051, 9055, 9059, 9063, 9067, 9071, 9075, 9079, 9083, 9087, 9091,
+9095, 9099, 9103, 9107, 9111, 9115, 9119, 9123, 9127, 9131, 9135, 9139, 9143,
+9147, 9151, 9155, 9159, 9163, 9167, 9171, 9175, 9179, 9183, 0, 0, 0, 7571, 7595,
+9187, 9191, 9195, 9199, 9203, 9207, 7587, 9211, 9215, 9219, 9223, 7603, 9227,
+9235, 9243, 9251, 9259, 9267, 9275, 9283, 9291, 9299, 9307, 9315, 9323, 9331,
+9339, 9349, 9359, 9369, 9379, 9389, 9399, 9409, 9419, 9429, 9439, 9449, 9459,
+9469, 9479, 9489, 9505, 0, 9519, 9527, 9535, 9543, 9551, 9559, 9567, 9575, 9583,
+9591, 9599, 9607, 9615, 9623, 9631, 9639, 9647, 9655, 9663, 9671, 9679, 9687,
+9695, 9703, 9711, 9719, 9727, 9735, 9743, 9751, 9759, 9767, 9775, 9783, 9791,
+9799, 9807, 9811, 7835, 9815, 0, 0, 0, 0, 0, 0, 0, 0, 9819, 9827, 9833, 9839,
+9845, 9851, 9857, 9863, 9869, 9875, 9881, 9887, 9893, 9899, 9905, 9911, 8811,
+8823, 8835, 8843, 8875, 8879, 8891, 8899, 8903, 8911, 8915, 8919, 8923, 8927,
+9917, 9923, 9929, 9935, 9941, 9947, 9953, 9959, 9965, 9971, 9977, 9983, 9989,
+9995, 10001, 10013, 10023, 0, 7571, 7595, 9187, 9191, 10029, 10033, 10037, 7615,
+10041, 7663, 7863, 7911, 7907, 7867, 8235, 7695, 7855, 10045, 10049, 10053,
+10057, 10061, 10065, 10069, 10073, 10077, 10081, 7719, 10085, 10089, 10093,
+10097, 10101, 10105, 10109, 10113, 9195, 9199, 9203, 10117, 10121, 10125, 10129,
+10133, 10137, 10141, 10145, 10149, 10153, 10157, 10163, 10169, 10175, 10181,
+10187, 10193, 10199, 10205, 10211, 10217, 10223, 10229, 10235, 10241, 10247,
+10253, 10259, 10265, 10271, 10277, 10283, 10289, 10295, 10301, 10309, 10317,
+10325, 10331, 10339, 10345, 10353, 10357, 10361, 10365, 10369, 10373, 10377,
+10381, 10385, 10389, 10393, 10397, 10401, 10405, 10409, 10413, 10417, 10421,
+10425, 10429, 10433, 10437, 10441, 10445, 10449, 10453, 10457, 10461, 10465,
+10469, 10473, 10477, 10481, 10485, 10489, 10493, 10497, 10501, 10505, 10509,
+10513, 10517, 10521, 10525, 10529, 10533, 10537, 10541, 10547, 10557, 10567,
+10577, 10585, 10595, 10603, 10611, 10623, 10633, 10641, 10649, 10657, 10667,
+10677, 10685, 10693, 10699, 10707, 10717, 10727, 10733, 10745, 10759, 10771,
+10779, 10791, 10803, 10813, 10821, 10829, 10837, 10847, 10859, 10869, 10877,
+10885, 10893, 10899, 10905, 10911, 10917, 10925, 10933, 10945, 10953, 10963,
+10975, 10983, 10989, 10995, 11007, 11017, 11029, 11037, 11049, 11055, 11063,
+11071, 11079, 11087, 11095, 11105, 11113, 11119, 11127, 11135, 11143, 11153,
+11161, 11169, 11177, 11189, 11199, 11205, 11217, 11223, 11233, 11243, 11251,
+11259, 11267, 11277, 11283, 11291, 11301, 11307, 11319, 11327, 11333, 11339,
+11345, 11351, 11357, 11363, 11369, 11375, 11381, 11387, 11395, 11403, 11411,
+11419, 11427, 11435, 11443, 11451, 11459, 11467, 11475, 11483, 11491, 11499,
+11507, 11515, 11521, 11527, 11535, 11541, 11547, 11553, 11561, 11569, 11575,
+11581, 11587, 11593, 11599, 11609, 11615, 11621, 11627, 11633, 11639, 11645,
+11651, 11657, 11665, 11675, 11681, 11687, 11693, 11699, 11705, 11711, 11717,
+11725, 11733, 11741, 11749, 11755, 11761, 11767, 11773, 11779, 11785, 11791,
+11797, 11803, 11809, 11817, 11825, 11831, 11839, 11847, 11855, 11861, 11869,
+11877, 11887, 11893, 11901, 11909, 11917, 11925, 11937, 11951, 11957, 11963,
+11969, 11975, 11981, 11987, 11993, 11999, 12005, 12011, 12017, 12023, 12029,
+12035, 12041, 12047, 12053, 12059, 12069, 12075, 12081, 12087, 12097, 12105,
+12111, 12117, 12123, 12129, 12135, 12141, 12147, 12153, 12159, 12165, 12173,
+12179, 12185, 12193, 12201, 12207, 12217, 12225, 12231, 12237, 12243, 12249,
+12257, 12265, 12271, 12277, 12283, 12289, 12295, 12301, 12307, 12313, 12319,
+12327, 12335, 12343, 12351, 12359, 12367, 12375, 12383, 12391, 12399, 12407,
+12415, 12423, 12431, 12439, 12447, 12455, 12463, 12471, 12479, 12487, 12495, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12503, 12507, 0, 0, 12511, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12515, 12519, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12523, 12527, 12531, 12535, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 12539, 0, 0, 0, 0, 0, 0, 12542, 12546, 8202, 12550, 12554, 12558,
+12562, 8418, 8418, 12566, 8234, 12570, 12574, 12578, 12582, 12586, 12590, 12594,
+12598, 12602, 12606, 12610, 12614, 12618, 12622, 12626, 12630, 12634, 12638,
+12642, 12646, 12650, 12654, 12658, 12662, 12666, 12670, 12674, 12678, 12682,
+12686, 12690, 12694, 12698, 12702, 12706, 12710, 12714, 12718, 12722, 12726,
+12730, 8066, 12734, 12738, 12742, 12746, 12750, 12754, 12758, 12762, 12766,
+12770, 12774, 8358, 12778, 12782, 12786, 12790, 12794, 12798, 12802, 12806,
+12810, 12814, 12818, 12822, 12826, 12830, 12834, 12838, 12842, 12846, 12850,
+12854, 12858, 12862, 12866, 12870, 12874, 12878, 12882, 12606, 12886, 12890,
+12894, 12898, 12902, 12906, 12910, 12914, 12918, 12922, 12926, 12930, 12934,
+12938, 12942, 12946, 12950, 12954, 12958, 12962, 8210, 12966, 12970, 12974,
+12978, 12982, 12986, 12990, 12994, 12998, 13002, 13006, 13010, 13014, 13018,
+13022, 7718, 13026, 13030, 13034, 13038, 13042, 13046, 13050, 13054, 7642,
+13058, 13062, 13066, 13070, 13074, 13078, 13082, 13086, 13090, 13094, 13098,
+13102, 13106, 13110, 13114, 13118, 13122, 13126, 13130, 13134, 13138, 13142,
+12958, 13146, 13150, 13154, 13158, 13162, 13166, 13170, 13174, 12894, 13178,
+13182, 13186, 13190, 13194, 13198, 13202, 13206, 13210, 13214, 13218, 13222,
+13226, 13230, 13234, 13238, 13242, 13246, 13250, 13254, 12606, 13258, 13262,
+13266, 13270, 8414, 13274, 13278, 13282, 13286, 13290, 13294, 13298, 13302,
+13306, 13310, 13314, 13318, 10032, 13322, 13326, 13330, 13334, 13338, 13342,
+13346, 13350, 13354, 12902, 13358, 13362, 13366, 13370, 13374, 13378, 13382,
+13386, 13390, 13394, 13398, 13402, 13406, 8230, 13410, 13414, 13418, 13422,
+13426, 13430, 13434, 13438, 13442, 13446, 13450, 13454, 13458, 8034, 13462,
+13466, 13470, 13474, 13478, 13482, 13486, 13490, 13494, 13498, 13502, 13506,
+13510, 13514, 13518, 13522, 8142, 13526, 8154, 13530, 13534, 13538, 0, 0, 13542,
+0, 13546, 0, 0, 13550, 13554, 13558, 13562, 13566, 13570, 13574, 13578, 13582,
+8062, 0, 13586, 0, 13590, 0, 0, 13594, 13598, 0, 0, 0, 13602, 13606, 13610,
+13614, 13618, 13622, 13626, 13630, 13634, 13638, 13642, 13646, 13650, 13654,
+13658, 13662, 13666, 13670, 7746, 13674, 13678, 13682, 13686, 13690, 13694,
+13698, 13702, 13706, 13710, 13714, 13718, 13722, 13726, 13730, 10052, 13734,
+13738, 13742, 13746, 10068, 13750, 13754, 13758, 13762, 13766, 13102, 13770,
+13774, 13778, 13782, 13786, 13790, 13790, 13794, 13798, 13802, 13806, 13810,
+13814, 13818, 13822, 13594, 13826, 13830, 13834, 13838, 13842, 13846, 0, 0,
+13850, 13854, 13858, 13862, 13866, 13870, 13874, 13878, 13650, 13882, 13886,
+13890, 13542, 13894, 13898, 13902, 13906, 13910, 13914, 13918, 13922, 13926,
+13930, 13934, 13938, 13682, 13942, 13686, 13946, 13950, 13954, 13958, 13962,
+13546, 12690, 13966, 13970, 7878, 12962, 13294, 13974, 13978, 13714, 13982,
+13718, 13986, 13990, 13994, 13554, 13998, 14002, 14006, 14010, 14014, 13558,
+14018, 14022, 14026, 14030, 14034, 14038, 13766, 14042, 14046, 13102, 14050,
+13782, 14054, 14058, 14062, 14066, 14070, 13802, 14074, 13590, 14078, 13806,
+12886, 14082, 13810, 14086, 13818, 14090, 14094, 14098, 14102, 14106, 13826,
+13578, 14110, 13830, 14114, 13834, 14118, 8418, 14122, 14126, 14130, 14134,
+14138, 14142, 14146, 14150, 14154, 14158, 14162, 0, 0, 0, 0, 0, 0, 14167, 14173,
+14179, 14185, 14193, 14201, 14207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14213,
+14219, 14225, 14231, 14237, 0, 0, 0, 0, 0, 14242, 0, 14248, 14255, 6303, 6315,
+14259, 14263, 14267, 14271, 14275, 14279, 6171, 14282, 14288, 14294, 14300,
+14306, 14312, 14318, 14324, 14330, 14336, 14342, 14348, 14354, 0, 14360, 14366,
+14372, 14378, 14384, 0, 14390, 0, 14396, 14402, 0, 14408, 14414, 0, 14420,
+14426, 14432, 14438, 14444, 14450, 14456, 14462, 14468, 14475, 14481, 14481,
+14485, 14485, 14485, 14485, 14489, 14489, 14489, 14489, 14493, 14493, 14493,
+14493, 14497, 14497, 14497, 14497, 14501, 14501, 14501, 14501, 14505, 14505,
+14505, 14505, 14509, 14509, 14509, 14509, 14513, 14513, 14513, 14513, 14517,
+14517, 14517, 14517, 14521, 14521, 14521, 14521, 14525, 14525, 14525, 14525,
+14529, 14529, 14529, 14529, 14533, 14533, 14537, 14537, 14541, 14541, 14545,
+14545, 14549, 14549, 14553, 14553, 14557, 14557, 14557, 14557, 14561, 14561,
+14561, 14561, 14565, 14565, 14565, 14565, 14569, 14569, 14569, 14569, 14573,
+14573, 14577, 14577, 14577, 14577, 14581, 14581, 14585, 14585, 14585, 14585,
+14589, 14589, 14589, 14589, 14593, 14593, 14597, 14597, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 14601, 14601, 14601, 14601, 14605, 14605, 14609,
+14609, 14613, 14613, 14617, 14621, 14621, 14625, 14625, 14629, 14629, 14633,
+14633, 14633, 14633, 14637, 14637, 14641, 14641, 14647, 14647, 14653, 14653,
+14659, 14659, 14665, 14665, 14671, 14671, 14677, 14677, 14677, 14683, 14683,
+14683, 14689, 14689, 14689, 14689, 14693, 14699, 14705, 14683, 14711, 14717,
+14723, 14729, 14735, 14741, 14747, 14753, 14759, 14765, 14771, 14777, 14783,
+14789, 14795, 14801, 14807, 14813, 14819, 14825, 14831, 14837, 14843, 14849,
+14855, 14861, 14867, 14873, 14879, 14885, 14891, 14897, 14903, 14909, 14915,
+14921, 14927, 14933, 14939, 14945, 14951, 14957, 14963, 14969, 14975, 14981,
+14987, 14993, 14999, 15005, 15011, 15017, 15023, 15029, 15035, 15041, 15047,
+15053, 15059, 15065, 15071, 15077, 15083, 15089, 15095, 15101, 15107, 15113,
+15119, 15125, 15131, 15137, 15143, 15149, 15155, 15161, 15167, 15173, 15179,
+15185, 15191, 15197, 15203, 15209, 15215, 15221, 15227, 15233, 15239, 15245,
+15251, 15259, 15267, 15275, 15283, 15291, 15299, 15305, 14705, 15311, 14683,
+14711, 15317, 15323, 14735, 15329, 14741, 14747, 15335, 15341, 14771, 15347,
+14777, 14783, 15353, 15359, 14795, 15365, 14801, 14807, 14981, 14987, 15005,
+15011, 15017, 15041, 15047, 15053, 15059, 15083, 15089, 15095, 15371, 15119,
+15377, 15383, 15155, 15389, 15161, 15167, 15245, 15395, 15401, 15215, 15407,
+15221, 15227, 14693, 14699, 15413, 14705, 15419, 14717, 14723, 14729, 14735,
+15425, 14753, 14759, 14765, 14771, 15431, 14795, 14813, 14819, 14825, 14831,
+14837, 14849, 14855, 14861, 14867, 14873, 14879, 15437, 14885, 14891, 14897,
+14903, 14909, 14915, 14927, 14933, 14939, 14945, 14951, 14957, 14963, 14969,
+14975, 14993, 14999, 15023, 15029, 15035, 15041, 15047, 15065, 15071, 15077,
+15083, 15443, 15101, 15107, 15113, 15119, 15137, 15143, 15149, 15155, 15449,
+15173, 15179, 15455, 15197, 15203, 15209, 15215, 15461, 14705, 15419, 14735,
+15425, 14771, 15431, 14795, 15467, 14873, 15473, 15479, 15485, 15041, 15047,
+15083, 15155, 15449, 15215, 15461, 15491, 15499, 15507, 15515, 15521, 15527,
+15533, 15539, 15545, 15551, 15557, 15563, 15569, 15575, 15581, 15587, 15593,
+15599, 15605, 15611, 15617, 15623, 15629, 15635, 15641, 15647, 15479, 15653,
+15659, 15665, 15671, 15515, 15521, 15527, 15533, 15539, 15545, 15551, 15557,
+15563, 15569, 15575, 15581, 15587, 15593, 15599, 15605, 15611, 15617, 15623,
+15629, 15635, 15641, 15647, 15479, 15653, 15659, 15665, 15671, 15635, 15641,
+15647, 15479, 15473, 15485, 14921, 14855, 14861, 14867, 15635, 15641, 15647,
+14921, 14927, 15677, 15677, 0, 0, 15683, 15691, 15691, 15699, 15707, 15715,
+15723, 15731, 15739, 15739, 15747, 15755, 15763, 15771, 15779, 15787, 15787,
+15795, 15803, 15803, 15811, 15811, 15819, 15827, 15827, 15835, 15843, 15843,
+15851, 15851, 15859, 15867, 15867, 15875, 15875, 15883, 15891, 15899, 15907,
+15907, 15915, 15923, 15931, 15939, 15947, 15947, 15955, 15963, 15971, 15979,
+15987, 15995, 15995, 16003, 16003, 16011, 16011, 16019, 16027, 16035, 16043,
+16051, 16059, 16067, 0, 0, 16075, 16083, 16091, 16099, 16107, 16115, 16115,
+16123, 16131, 16139, 16147, 16147, 16155, 16163, 16171, 16179, 16187, 16195,
+16203, 16211, 16219, 16227, 16235, 16243, 16251, 16259, 16267, 16275, 16283,
+16291, 16299, 16307, 16315, 16323, 15955, 15971, 16331, 16339, 16347, 16355,
+16363, 16371, 16363, 16347, 16379, 16387, 16395, 16403, 16411, 16371, 15899,
+15819, 16419, 16427, 0, 0, 0, 0, 0, 0, 0, 0, 16435, 16443, 16451, 16461, 16471,
+16481, 16491, 16501, 16511, 16521, 16529, 16567, 16585, 0, 0, 0, 16595, 16599,
+16603, 16607, 1813, 16611, 16615, 16619, 16623, 16627, 0, 0, 0, 0, 0, 0, 16631,
+16635, 16639, 16643, 16643, 6183, 6187, 16647, 16651, 16655, 16659, 16663,
+16667, 16671, 16675, 6903, 6907, 16679, 16683, 16687, 16691, 0, 0, 16695, 16699,
+16703, 16703, 16703, 16703, 16643, 16643, 16643, 16595, 16599, 6057, 0, 1813,
+16607, 16615, 16611, 16635, 6183, 6187, 16647, 16651, 16655, 16659, 16707,
+16711, 16715, 6171, 16719, 16723, 16727, 6179, 0, 16731, 16735, 16739, 16743, 0,
+0, 0, 0, 16747, 16753, 16759, 0, 16765, 0, 16771, 16777, 16783, 16789, 16795,
+16801, 16807, 16813, 16819, 16825, 16831, 16835, 16835, 16839, 16839, 16843,
+16843, 16847, 16847, 16851, 16851, 16851, 16851, 16855, 16855, 16859, 16859,
+16859, 16859, 16863, 16863, 16867, 16867, 16867, 16867, 16871, 16871, 16871,
+16871, 16875, 16875, 16875, 16875, 16879, 16879, 16879, 16879, 16883, 16883,
+16883, 16883, 16887, 16887, 16891, 16891, 16895, 16895, 16899, 16899, 16903,
+16903, 16903, 16903, 16907, 16907, 16907, 16907, 16911, 16911, 16911, 16911,
+16915, 16915, 16915, 16915, 16919, 16919, 16919, 16919, 16923, 16923, 16923,
+16923, 16927, 16927, 16927, 16927, 16931, 16931, 16931, 16931, 16935, 16935,
+16935, 16935, 16939, 16939, 16939, 16939, 16943, 16943, 16943, 16943, 16947,
+16947, 16947, 16947, 16951, 16951, 16951, 16951, 16955, 16955, 16955, 16955,
+16959, 16959, 16959, 16959, 16963, 16963, 14637, 14637, 16967, 16967, 16967,
+16967, 16971, 16971, 16977, 16977, 16983, 16983, 16989, 16989, 0, 0, 0, 0,
+16611, 16995, 16707, 16735, 16739, 16711, 16999, 6183, 6187, 16715, 6171, 16595,
+16719, 6057, 17003, 6143, 47, 23, 27, 6147, 6151, 6155, 6159, 6163, 6167, 16607,
+1813, 16723, 6179, 16727, 16615, 16743, 2875, 2883, 6217, 2887, 2891, 6299,
+2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927, 2931, 2939, 6263, 2943, 7509,
+2947, 2951, 6487, 2955, 6521, 7513, 6287, 16695, 16731, 16699, 17007, 16643,
+5969, 13, 2971, 3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705, 2999, 1773,
+3003, 6191, 51, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729,
+3195, 16647, 17011, 16651, 17015, 17019, 17023, 16603, 16679, 16683, 16599,
+17027, 10537, 17031, 17035, 17039, 17043, 17047, 17051, 17055, 17059, 17063,
+17067, 10353, 10357, 10361, 10365, 10369, 10373, 10377, 10381, 10385, 10389,
+10393, 10397, 10401, 10405, 10409, 10413, 10417, 10421, 10425, 10429, 10433,
+10437, 10441, 10445, 10449, 10453, 10457, 10461, 10465, 10469, 10473, 10477,
+10481, 10485, 10489, 10493, 10497, 10501, 10505, 10509, 10513, 10517, 10521,
+10525, 17071, 17075, 17079, 17083, 17087, 17091, 17095, 17099, 17103, 17107,
+17111, 17115, 17119, 17123, 17127, 17131, 17135, 17139, 17143, 17147, 17151,
+17155, 17159, 17163, 17167, 17171, 17175, 17179, 17183, 17187, 17191, 17195,
+17199, 17203, 0, 0, 0, 17207, 17211, 17215, 17219, 17223, 17227, 0, 0, 17231,
+17235, 17239, 17243, 17247, 17251, 0, 0, 17255, 17259, 17263, 17267, 17271,
+17275, 0, 0, 17279, 17283, 17287, 0, 0, 0, 17291, 17295, 17299, 17303, 17307,
+17311, 17315, 0, 17319, 17323, 17327, 17331, 17335, 17339, 17343, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 17346, 0, 17352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+17358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17364, 17370, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 17376, 17382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 17388, 17394, 0, 17400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17406, 17412, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 17424, 17430, 17436, 17442, 17448, 17454, 17460, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17466, 17472, 17478,
+17484, 17490, 17496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2875, 2883,
+6217, 2887, 2891, 6299, 2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927, 2931,
+2939, 6263, 2943, 7509, 2947, 2951, 6487, 2955, 6521, 7513, 6287, 13, 2971,
+3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705, 2999, 1773, 3003, 6191, 51,
+3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729, 3195, 2875, 2883,
+6217, 2887, 2891, 6299, 2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927, 2931,
+2939, 6263, 2943, 7509, 2947, 2951, 6487, 2955, 6521, 7513, 6287, 13, 2971,
+3075, 2975, 2979, 3087, 2995, 0, 3063, 1705, 2999, 1773, 3003, 6191, 51, 3023,
+7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729, 3195, 2875, 2883, 6217,
+2887, 2891, 6299, 2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927, 2931, 2939,
+6263, 2943, 7509, 2947, 2951, 6487, 2955, 6521, 7513, 6287, 13, 2971, 3075,
+2975, 2979, 3087, 2995, 1697, 3063, 1705, 2999, 1773, 3003, 6191, 51, 3023,
+7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729, 3195, 2875, 0, 6217, 2887,
+0, 0, 2899, 0, 0, 2911, 2915, 0, 0, 2927, 2931, 2939, 6263, 0, 7509, 2947, 2951,
+6487, 2955, 6521, 7513, 6287, 13, 2971, 3075, 2975, 0, 3087, 0, 1697, 3063,
+1705, 2999, 1773, 3003, 6191, 0, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725,
+1777, 1729, 3195, 1725, 1777, 1729, 3195, 2875, 2883, 0, 2887, 2891, 6299, 2899,
+0, 0, 2911, 2915, 2919, 2923, 2927, 2931, 2939, 6263, 0, 7509, 2947, 2951, 6487,
+2955, 6521, 7513, 0, 13, 2971, 3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705,
+2999, 1773, 3003, 6191, 51, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725,
+1777, 1729, 3195, 2875, 2883, 0, 2887, 2891, 6299, 2899, 0, 2907, 2911, 2915,
+2919, 2923, 0, 2931, 0, 0, 0, 7509, 2947, 2951, 6487, 2955, 6521, 7513, 0, 13,
+2971, 3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705, 2999, 1773, 3003, 6191,
+51, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729, 3195, 2875,
+2883, 6217, 2887, 2891, 6299, 2899, 2903, 2907, 2911, 2915, 2919, 2923, 2927,
+2931, 2939, 6263, 2943, 7509, 2947, 2951, 6487, 2955, 6521, 7513, 6287, 13,
+2971, 3075, 2975, 2979, 3087, 2995, 1697, 3063, 1705, 2999, 1773, 3003, 6191,
+51, 3023, 7517, 1709, 1075, 3027, 3031, 3043, 1725, 1777, 1729, 3195, 1725,
+1777, 1729, 3195, 17503, 17507, 0, 0, 17511, 17515, 6327, 17519, 17523, 17527,
+17531, 1991, 17535, 17539, 17543, 17547, 17551, 17555, 17559, 6331, 17563,
+17567, 1999, 17571, 1955, 17575, 17579, 17583, 6291, 17587, 17591, 1947, 3051,
+3055, 1995, 17595, 17599, 1951, 5721, 1979, 17603, 37, 17607, 17611, 17615,
+1975, 1983, 1987, 17619, 17623, 17627, 1971, 3059, 17631, 17635, 17639, 17643,
+17647, 17651, 17655, 17659, 17663, 17511, 17515, 6327, 17519, 17523, 17527,
+17531, 1991, 17535, 17539, 17543, 17547, 17551, 17555, 17559, 6331, 17563,
+17567, 1999, 17571, 1955, 17575, 17579, 17583, 6291, 17587, 17591, 1947, 3051,
+3055, 1995, 17595, 17599, 1951, 5721, 1979, 17603, 37, 17607, 17611, 17615,
+1975, 1983, 1987, 17619, 17623, 17627, 1971, 3059, 17631, 17635, 17639, 17643,
+17647, 17651, 17655, 17659, 17663, 17511, 17515, 6327, 17519, 17523, 17527,
+17531, 1991, 17535, 17539, 17543, 17547, 17551, 17555, 17559, 6331, 17563,
+17567, 1999, 17571, 1955, 17575, 17579, 17583, 6291, 17587, 17591, 1947, 3051,
+3055, 1995, 17595, 17599, 1951, 5721, 1979, 17603, 37, 17607, 17611, 17615,
+1975, 1983, 1987, 17619, 17623, 17627, 1971, 3059, 17631, 17635, 17639, 17643,
+17647, 17651, 17655, 17659, 17663, 17511, 17515, 6327, 17519, 17523, 17527,
+17531, 1991, 17535, 17539, 17543, 17547, 17551, 17555, 17559, 6331, 17563,
+17567, 1999, 17571, 1955, 17575, 17579, 17583, 6291, 17587, 17591, 1947, 3051,
+3055, 1995, 17595, 17599, 1951, 5721, 1979, 17603, 37, 17607, 17611, 17615,
+1975, 1983, 1987, 17619, 17623, 17627, 1971, 3059, 17631, 17635, 17639, 17643,
+17647, 17651, 17655, 17659, 17663, 17511, 17515, 6327, 17519, 17523, 17527,
+17531, 1991, 17535, 17539, 17543, 17547, 17551, 17555, 17559, 6331, 17563,
+17567, 1999, 17571, 1955, 17575, 17579, 17583, 6291, 17587, 17591, 1947, 3051,
+3055, 1995, 17595, 17599, 1951, 5721, 1979, 17603, 37, 17607, 17611, 17615,
+1975, 1983, 1987, 17619, 17623, 17627, 1971, 3059, 17631, 17635, 17639, 17643,
+17647, 17651, 17655, 17659, 17663, 17667, 17671, 0, 0, 6143, 47, 23, 27, 6147,
+6151, 6155, 6159, 6163, 6167, 6143, 47, 23, 27, 6147, 6151, 6155, 6159, 6163,
+6167, 6143, 47, 23, 27, 6147, 6151, 6155, 6159, 6163, 6167, 6143, 47, 23, 27,
+6147, 6151, 6155, 6159, 6163, 6167, 6143, 47, 23, 27, 6147, 6151, 6155, 6159,
+6163, 6167, 16855, 16859, 16875, 16887, 0, 16963, 16899, 16879, 16919, 16967,
+16943, 16947, 16951, 16955, 16903, 16927, 16935, 16911, 16939, 16895, 16907,
+16867, 16871, 16883, 16891, 16915, 16923, 16931, 17675, 14573, 17679, 17683, 0,
+16859, 16875, 0, 16959, 0, 0, 16879, 0, 16967, 16943, 16947, 16951, 16955,
+16903, 16927, 16935, 16911, 16939, 0, 16907, 16867, 16871, 16883, 0, 16915, 0,
+16931, 0, 0, 0, 0, 0, 0, 16875, 0, 0, 0, 0, 16879, 0, 16967, 0, 16947, 0, 16955,
+16903, 16927, 0, 16911, 16939, 0, 16907, 0, 0, 16883, 0, 16915, 0, 16931, 0,
+14573, 0, 17683, 0, 16859, 16875, 0, 16959, 0, 0, 16879, 16919, 16967, 16943, 0,
+16951, 16955, 16903, 16927, 16935, 16911, 16939, 0, 16907, 16867, 16871, 16883,
+0, 16915, 16923, 16931, 17675, 0, 17679, 0, 16855, 16859, 16875, 16887, 16959,
+16963, 16899, 16879, 16919, 16967, 0, 16947, 16951, 16955, 16903, 16927, 16935,
+16911, 16939, 16895, 16907, 16867, 16871, 16883, 16891, 16915, 16923, 16931, 0,
+0, 0, 0, 0, 16859, 16875, 16887, 0, 16963, 16899, 16879, 16919, 16967, 0, 16947,
+16951, 16955, 16903, 16927, 17687, 17693, 17699, 17705, 17711, 17717, 17723,
+17729, 17735, 17741, 17747, 0, 0, 0, 0, 0, 17753, 17761, 17769, 17777, 17785,
+17793, 17801, 17809, 17817, 17825, 17833, 17841, 17849, 17857, 17865, 17873,
+17881, 17889, 17897, 17905, 17913, 17921, 17929, 17937, 17945, 17953, 17961,
+6217, 2943, 17969, 17975, 0, 6263, 2943, 7509, 2947, 2951, 6487, 2955, 6521,
+7513, 6287, 17981, 12005, 17987, 17993, 17999, 18007, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 18013, 18019, 18025, 0, 0, 0, 18031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 18037, 18043, 10393, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7823, 18049,
+18053, 18057, 7595, 18061, 18065, 9219, 18069, 18073, 18077, 13255, 18081,
+18085, 18089, 18093, 18097, 18101, 7967, 18105, 18109, 18113, 18117, 18121,
+18125, 7571, 9187, 18129, 10117, 9199, 10121, 18133, 8191, 18137, 18141, 18145,
+18149, 18153, 10049, 7863, 18157, 18161, 18165, 18169, 0, 0, 0, 0, 18173, 18181,
+18189, 18197, 18205, 18213, 18221, 18229, 18237, 0, 0, 0, 0, 0, 0, 0, 18245,
+18249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6143, 47, 23, 27, 6147, 6151,
+6155, 6159, 6163, 6167, 0, 0, 0, 0, 0, 0, 18252, 18256, 18260, 18264, 18268,
+13626, 18272, 18276, 18280, 18284, 13630, 18288, 18292, 18296, 13634, 18300,
+18304, 18308, 18312, 18316, 18320, 18088, 18324, 18328, 18332, 18336, 18340,
+13854, 18344, 7634, 18348, 18352, 18356, 18360, 18160, 18364, 18368, 13874,
+13638, 13642, 13878, 18372, 18376, 12910, 18380, 13646, 18384, 18388, 18392,
+18396, 18396, 18396, 18400, 18404, 18408, 18412, 18416, 18420, 18424, 18428,
+18432, 18436, 18440, 18444, 18448, 18452, 18456, 18460, 18464, 18468, 18468,
+13886, 18472, 18476, 18480, 18484, 13654, 18488, 18492, 18496, 13494, 18500,
+18504, 18508, 18512, 18516, 18520, 18524, 18528, 18532, 18536, 18540, 18544,
+18060, 18548, 18552, 18556, 18560, 18564, 18568, 18572, 18576, 18580, 18584,
+18588, 18592, 18596, 18596, 18600, 18604, 18608, 12894, 18612, 18616, 18620,
+18624, 18628, 7738, 18632, 18636, 7746, 18640, 18644, 18648, 18652, 18656,
+18660, 18664, 18668, 18672, 18676, 18680, 18684, 18688, 18692, 18696, 18700,
+18704, 18708, 18712, 18716, 18720, 12686, 18724, 7786, 18728, 18728, 18732,
+18736, 18736, 18740, 18744, 18748, 18752, 18756, 18760, 18764, 18768, 18772,
+18776, 18780, 18784, 18788, 13674, 18792, 18796, 18800, 18804, 13934, 18804,
+18808, 13682, 18812, 18816, 18820, 18824, 13686, 12578, 18828, 18832, 18836,
+18840, 18844, 18848, 18852, 18856, 18860, 18864, 18868, 18872, 18876, 18880,
+18884, 18888, 18892, 18896, 18900, 18904, 18908, 18912, 13690, 18916, 18920,
+18924, 18928, 18932, 18936, 13698, 18940, 18944, 18948, 18952, 18956, 18960,
+18964, 18968, 12690, 13966, 18972, 18976, 18980, 18984, 18988, 18992, 18996,
+19000, 13702, 19004, 19008, 19012, 19016, 14134, 19020, 19024, 19028, 19032,
+19036, 19040, 19044, 19048, 19052, 19056, 19060, 19064, 19068, 12962, 19072,
+19076, 19080, 19084, 19088, 19092, 19096, 19100, 19104, 19108, 19112, 13706,
+13294, 19116, 19120, 19124, 19128, 19132, 19136, 19140, 19144, 13978, 19148,
+19152, 19156, 19160, 19164, 19168, 19172, 19176, 13982, 19180, 19184, 19188,
+19192, 19196, 19200, 19204, 19208, 19212, 19216, 19220, 19224, 13990, 19228,
+19232, 19236, 19240, 19244, 19248, 19252, 19256, 19260, 19264, 19268, 19268,
+19272, 19276, 13998, 19280, 19284, 19288, 19292, 19296, 19300, 19304, 12906,
+19308, 19312, 19316, 19320, 19324, 19328, 19332, 14022, 19336, 19340, 19344,
+19348, 19352, 19356, 19356, 14026, 14142, 19360, 19364, 19368, 19372, 19376,
+12758, 14034, 19380, 19384, 13746, 19388, 19392, 13574, 19396, 19400, 13758,
+19404, 19408, 19412, 19416, 19416, 19420, 19424, 19428, 19432, 19436, 19440,
+19444, 19448, 19452, 19456, 19460, 19464, 19468, 19472, 19476, 19480, 19484,
+19488, 19492, 19496, 19500, 19504, 19508, 19512, 19516, 19520, 19524, 13782,
+19528, 19532, 19536, 19540, 19544, 19548, 19552, 19556, 19560, 19564, 19568,
+19572, 19576, 19580, 19584, 19588, 18732, 19592, 19596, 19600, 19604, 19608,
+19612, 19616, 19620, 19624, 19628, 19632, 19636, 12974, 19640, 19644, 19648,
+19652, 19656, 19660, 13794, 19664, 19668, 19672, 19676, 19680, 19684, 19688,
+19692, 19696, 19700, 19704, 19708, 19712, 19716, 19720, 19724, 19728, 19732,
+19736, 19740, 12738, 19744, 19748, 19752, 19756, 19760, 19764, 14062, 19768,
+19772, 19776, 19780, 19784, 19788, 19792, 19796, 8146, 19800, 19804, 19808,
+19812, 19816, 19820, 19824, 19828, 19832, 19836, 19840, 14082, 14086, 8174,
+19844, 19848, 19852, 19856, 19860, 19864, 19868, 19872, 19876, 19880, 19884,
+19888, 14090, 19892, 19896, 19900, 19904, 19908, 19912, 19916, 19920, 19924,
+19928, 19932, 19936, 19940, 19944, 19948, 19952, 19956, 19960, 19964, 19968,
+19972, 19976, 19980, 19984, 19988, 19992, 19996, 20000, 20004, 20008, 14114,
+14114, 20012, 20016, 20020, 20024, 20028, 20032, 20036, 20040, 20044, 20048,
+14118, 20052, 20056, 20060, 20064, 20068, 20072, 20076, 20080, 20084, 20088,
+8366, 20092, 8382, 20096, 20100, 20104, 20108, 8402, 20112, 0, 0,
+};
@@ -0,0 +1,2028 @@
+const uint16_t _derived_core_properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 1216, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1344, 1408, 1472, 1536, 1600, 1664, 1728, 1792, 1856, 1920, 1984, 2048,
+1280, 1280, 832, 2112, 1280, 1280, 1280, 2176, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 2240, 2304, 832, 832, 832, 832, 832, 2368, 832, 2432, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 2496, 1280, 1280, 2560, 1280, 1280,
+1280, 1280, 2624, 2688, 2752, 1280, 2816, 1280, 2880, 2944, 3008, 3072, 3136,
+1280, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 3200, 832, 832, 832, 3264,
+3328, 832, 832, 832, 832, 3392, 832, 832, 832, 832, 832, 832, 3456, 1280, 1280,
+1280, 3520, 1280, 832, 832, 832, 832, 3584, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 3648, 3712, 3712, 3712, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+1280,
+};
+const uint16_t _derived_core_properties_stage2[] = {
+0, 0, 16, 32, 48, 64, 80, 96, 0, 0, 112, 128, 144, 160, 176, 192, 208, 208, 208,
+224, 240, 208, 208, 256, 272, 288, 304, 320, 336, 352, 208, 368, 208, 208, 384,
+400, 416, 432, 448, 464, 480, 496, 512, 528, 544, 560, 576, 592, 608, 608, 608,
+608, 624, 608, 608, 640, 656, 672, 688, 176, 704, 720, 208, 736, 144, 144, 144,
+176, 176, 176, 208, 208, 752, 208, 208, 208, 768, 208, 208, 208, 208, 208, 208,
+784, 144, 800, 816, 176, 832, 848, 608, 864, 880, 896, 912, 928, 944, 960, 896,
+896, 976, 992, 1008, 1024, 896, 896, 896, 896, 896, 1040, 1056, 1072, 1088,
+1104, 896, 1120, 1136, 896, 896, 896, 896, 896, 1152, 1168, 1184, 896, 1200,
+1216, 896, 1232, 1248, 1264, 896, 1280, 1296, 0, 0, 0, 896, 1312, 1328, 1344,
+1360, 1120, 1376, 896, 896, 1392, 1408, 1424, 1440, 1456, 1472, 1488, 1504,
+1520, 1536, 1552, 1568, 1584, 1600, 1488, 1504, 1616, 1632, 1648, 1664, 1680,
+1696, 1712, 1504, 1728, 1744, 1760, 1568, 1776, 1792, 1488, 1504, 1808, 1824,
+1840, 1568, 1856, 1872, 1888, 1904, 1920, 1936, 1952, 1664, 1968, 1984, 2000,
+1504, 2016, 2032, 2048, 1568, 2064, 2080, 2000, 1504, 2096, 2112, 2128, 1568,
+2144, 2160, 2000, 896, 2176, 2192, 2208, 1568, 2224, 2240, 2256, 896, 2272,
+2288, 2304, 1664, 2320, 2336, 896, 896, 2352, 2368, 2384, 0, 0, 2400, 896, 2416,
+2432, 2448, 2464, 0, 0, 2480, 2496, 2512, 2528, 2544, 896, 2560, 2576, 2592,
+2608, 1120, 2624, 2640, 1968, 0, 0, 896, 896, 2656, 2672, 2512, 2688, 2704,
+2720, 2736, 2752, 144, 144, 2768, 2784, 2784, 2800, 896, 896, 896, 896, 896,
+2816, 2832, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+2848, 2864, 896, 896, 2848, 896, 896, 2880, 2896, 2912, 896, 896, 896, 2896,
+896, 896, 896, 2928, 2944, 2960, 896, 2976, 2992, 2992, 2992, 2992, 2992, 3008,
+3024, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 3040, 896, 3024, 3056, 896, 896, 896, 896, 3072,
+3088, 3104, 3120, 896, 3136, 896, 3152, 3104, 3168, 896, 896, 896, 3184, 3200,
+3216, 3232, 2976, 3248, 3232, 896, 896, 3264, 896, 896, 3088, 3280, 896, 3296,
+896, 896, 896, 896, 3312, 896, 3328, 3344, 3360, 3376, 896, 3392, 3408, 896,
+896, 3424, 896, 3440, 3456, 3472, 3472, 896, 3488, 896, 896, 896, 3504, 3520,
+3536, 3232, 3232, 3552, 3568, 3584, 0, 0, 0, 3600, 896, 896, 3616, 3632, 2512,
+3648, 3664, 3680, 896, 3696, 1184, 896, 896, 3712, 3728, 896, 896, 3744, 3760,
+3776, 1184, 896, 3792, 3808, 144, 144, 3824, 3840, 3856, 3872, 3888, 512, 512,
+3904, 3920, 3920, 3920, 3936, 3952, 3968, 3984, 3920, 3920, 608, 608, 4000,
+4016, 208, 208, 208, 208, 208, 208, 208, 208, 208, 4032, 208, 208, 208, 208,
+208, 208, 4048, 4064, 4048, 4048, 4064, 4080, 4048, 4096, 4112, 4112, 4112,
+4128, 4144, 4160, 4176, 4192, 4208, 4224, 4240, 4256, 4272, 4288, 4304, 4320,
+4336, 4352, 3472, 3472, 0, 4368, 4384, 4400, 4416, 4432, 4448, 4464, 4480, 3472,
+144, 176, 4496, 4512, 4528, 4544, 4512, 4560, 4576, 4592, 4512, 4512, 4512,
+4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512,
+4608, 3472, 4624, 3472, 3472, 3472, 3472, 4640, 3472, 4656, 4512, 4672, 3472,
+4688, 4704, 3472, 3472, 3472, 4720, 0, 1968, 0, 3472, 3472, 3472, 3472, 3472,
+4736, 4752, 4768, 4784, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 4800, 4816, 4832, 4848, 4864, 4880, 4896, 3472, 3472, 3472, 4912,
+3472, 4928, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 4512, 4512, 4512,
+4512, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512,
+4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512,
+4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 4512, 3472, 3472, 3472,
+4512, 4944, 3472, 3472, 4960, 3472, 4976, 3472, 3472, 3472, 3472, 3472, 3472,
+144, 144, 4992, 176, 176, 5008, 5024, 5040, 208, 208, 208, 208, 208, 208, 5056,
+5072, 176, 176, 5088, 896, 896, 896, 5104, 5120, 896, 5136, 5152, 5152, 5152,
+5152, 1120, 1120, 3472, 3472, 5168, 3472, 3472, 5184, 0, 0, 3472, 5200, 3472,
+3472, 3472, 3472, 3472, 5216, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 5232, 0, 5248, 5264, 3472, 5280, 5296, 2336, 896,
+896, 896, 896, 5312, 3024, 896, 896, 896, 896, 5328, 5344, 896, 896, 2336, 896,
+896, 5360, 896, 3328, 3472, 896, 896, 3472, 3472, 5216, 896, 3472, 1264, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+3472, 3472, 3472, 3472, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 2560, 896, 5376, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 2560,
+3472, 3472, 3472, 4720, 896, 896, 3792, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 5392, 896, 5408, 0, 208, 208, 5424,
+5440, 208, 5456, 896, 896, 896, 896, 896, 5472, 592, 5488, 5504, 5520, 208, 208,
+208, 5536, 5552, 5568, 5584, 5600, 5616, 0, 0, 5632, 5648, 896, 5664, 2976, 896,
+896, 896, 5680, 5696, 896, 896, 5712, 5728, 3232, 608, 5744, 1184, 896, 5760,
+896, 5776, 5792, 896, 2560, 1376, 896, 896, 5808, 5824, 5840, 5856, 5872, 896,
+896, 5888, 5904, 5920, 5936, 896, 5952, 896, 896, 896, 5968, 5984, 6000, 6016,
+6032, 6048, 6064, 5152, 512, 512, 6080, 6096, 6112, 6112, 6112, 6112, 6112, 896,
+896, 6128, 3232, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 6144, 896,
+6160, 896, 896, 3424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 3392, 896, 896, 896, 896, 896,
+896, 3440, 0, 0, 6176, 6192, 6208, 6224, 6240, 896, 896, 896, 896, 896, 896,
+6256, 6272, 6288, 896, 896, 896, 896, 896, 896, 896, 6304, 6320, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 6336, 0, 896, 896, 896, 896, 6352,
+896, 896, 1328, 0, 0, 6368, 6384, 6400, 608, 6416, 6432, 6448, 6464, 6480, 896,
+896, 896, 896, 896, 896, 896, 6496, 6512, 32, 48, 6528, 80, 6544, 6560, 6576,
+896, 6592, 2832, 3328, 6608, 6624, 6640, 6656, 6672, 896, 2912, 6688, 3392,
+3392, 0, 0, 896, 896, 896, 896, 896, 896, 896, 1296, 6704, 3472, 3472, 6720,
+896, 896, 896, 6736, 1264, 6752, 6768, 0, 0, 3472, 3472, 6784, 0, 0, 0, 0, 0, 0,
+0, 0, 896, 2560, 896, 896, 896, 1760, 6800, 5248, 896, 896, 6816, 896, 1296,
+896, 896, 6832, 896, 6848, 896, 896, 6864, 6880, 0, 0, 144, 144, 6896, 176, 176,
+896, 896, 896, 896, 3392, 3232, 144, 144, 6912, 176, 6928, 896, 896, 1328, 896,
+896, 896, 6944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 5136, 896, 3312,
+1328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6960, 896, 896, 6976, 896, 6992, 896, 7008,
+896, 3328, 2064, 0, 0, 0, 896, 7024, 896, 7040, 896, 7056, 0, 0, 0, 0, 896, 896,
+896, 7072, 3472, 7088, 3472, 3472, 7104, 7120, 896, 7136, 7152, 7152, 896, 7168,
+896, 7168, 0, 0, 7184, 896, 7200, 4720, 896, 896, 896, 7216, 896, 7232, 896,
+7248, 896, 7264, 7280, 0, 0, 0, 0, 0, 896, 896, 896, 896, 3088, 0, 0, 0, 144,
+144, 144, 7296, 176, 176, 176, 7312, 896, 896, 7328, 3232, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3472, 1264, 896, 896, 7344, 7360, 0, 0, 0, 0,
+896, 7168, 7376, 896, 7392, 7408, 0, 0, 0, 0, 0, 896, 7424, 0, 896, 5136, 7440,
+896, 896, 7456, 7472, 7088, 7488, 7504, 7520, 896, 896, 7536, 7552, 896, 3088,
+3232, 7568, 896, 7584, 7600, 7616, 896, 896, 7632, 3680, 896, 896, 7648, 7664,
+7680, 7696, 7712, 896, 1712, 7728, 7744, 0, 0, 0, 0, 7760, 7776, 7792, 896, 896,
+7808, 7824, 3232, 7840, 1488, 1504, 7856, 7872, 7888, 7904, 7920, 0, 0, 0, 0, 0,
+0, 0, 0, 896, 896, 896, 7936, 7952, 7968, 7360, 0, 896, 896, 896, 7984, 8000,
+3232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 8016, 8032, 6800, 8048, 0, 0, 896,
+896, 896, 8064, 8080, 3232, 6752, 0, 896, 896, 8096, 8112, 3232, 0, 0, 0, 896,
+8128, 8144, 2512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 7728, 8160, 0,
+0, 0, 0, 0, 0, 144, 144, 176, 176, 2512, 8176, 8192, 8208, 896, 8224, 8240,
+3232, 0, 0, 0, 0, 8256, 896, 896, 8272, 8288, 0, 8304, 896, 896, 8320, 8336,
+8352, 896, 896, 8368, 8384, 5184, 0, 896, 896, 896, 3088, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1504, 896, 8400, 8416, 8432, 2512, 6752, 8448, 896,
+8464, 8480, 8496, 0, 0, 0, 0, 8512, 896, 896, 8528, 8544, 3232, 8560, 896, 8576,
+8592, 3232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 8608,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1760, 3472, 3472, 3472, 8624, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 3440, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 896,
+896, 3328, 7712, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+6144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 3328, 8640, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 5136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 3088, 896, 3328,
+5840, 0, 0, 0, 0, 0, 0, 896, 3392, 8656, 896, 896, 896, 8672, 8688, 8704, 8720,
+8736, 896, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 176, 176,
+3472, 1968, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 8752, 8768, 8784, 8784, 8800,
+8816, 0, 0, 0, 0, 8832, 8848, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 1328, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 3312, 0, 0, 3088, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 3328, 0, 0, 0, 8864, 8880, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 3424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 896,
+896, 896, 896, 1296, 2560, 3088, 8896, 8912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 5232, 3472, 3472, 8928,
+3472, 3472, 3472, 8944, 8960, 8976, 3472, 8992, 3472, 3472, 3472, 7152, 0, 3472,
+3472, 3472, 3472, 9008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3472, 5216, 3472, 3472, 3472,
+3472, 3472, 4720, 3472, 7152, 0, 0, 0, 0, 0, 0, 0, 0, 9024, 9040, 9056, 9072,
+9088, 9104, 9120, 9024, 9136, 9152, 9168, 9184, 9200, 9024, 9040, 9056, 9216,
+9232, 9056, 9248, 9264, 9280, 9296, 9024, 9312, 9056, 9024, 9040, 9056, 9072,
+9088, 9056, 9120, 9024, 9136, 9296, 9024, 9312, 9056, 9024, 9040, 9056, 9328,
+9024, 9344, 9360, 9376, 9392, 9056, 9408, 9024, 9424, 9440, 9456, 9472, 9056,
+9488, 9024, 9504, 9056, 9520, 9536, 9536, 9536, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 608, 608, 608, 9552, 608, 608, 9568, 9584, 9600, 9616, 848, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9632, 9648, 9664, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 2560, 9680, 9696, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 9712, 9728, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 9744, 9760, 0, 0, 144, 144, 9776, 176, 9792, 5840, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7696, 3472, 3472, 3472, 7712,
+0, 0, 0, 0, 7696, 3472, 3472, 9808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9824,
+9840, 9856, 9872, 9888, 9904, 9920, 9936, 9952, 9968, 9984, 9968, 0, 0, 0,
+10000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3472, 3472, 5248, 3472,
+3472, 3472, 3472, 3472, 3472, 5216, 1264, 7696, 7696, 7696, 3472, 5232, 3472,
+3472, 3472, 10016, 10032, 10016, 10032, 10016, 10032, 3472, 9808, 0, 0, 0,
+10048, 3472, 5184, 3472, 3472, 5248, 7152, 10064, 5232, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 10080, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3840, 6752, 6752, 3472,
+3472, 3472, 3472, 3472, 3472, 3472, 5216, 3472, 3472, 3472, 3472, 3472, 7152,
+5248, 0, 5248, 3472, 3472, 3472, 3840, 2976, 3472, 3472, 3840, 3472, 9808,
+10064, 0, 0, 0, 0, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 10096, 3472, 3472,
+3472, 3472, 10112, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 5216, 9808,
+10128, 4720, 3472, 7152, 4720, 5184, 4720, 0, 0, 3472, 3472, 3472, 3472, 3472,
+3472, 3472, 3472, 3472, 10144, 3472, 3472, 1968, 0, 0, 3232, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 3392, 0, 0, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 3408,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 3392, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 7360, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 1760, 0, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 3392, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896, 896,
+896, 896, 896, 896, 1296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10160, 10176, 10192,
+10192, 10192, 10192, 10192, 10192, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384,
+6384, 6384, 6384, 6384, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176, 10176,
+10176,
+};
+const uint32_t _derived_core_properties_stage3[] = {
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020020,
+0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020000, 0x00020000,
+0x00020020, 0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00020020, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020000,
+0x00020000, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00020000, 0x00020000, 0x00020000,
+0x00020021, 0x00025000, 0x00020020, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00020000,
+0x00020001, 0x00020000, 0x00020001, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020020, 0x00020000, 0x00027816, 0x00020000, 0x00020001, 0x00008020,
+0x00020000, 0x00020020, 0x00020000, 0x00020001, 0x00020000, 0x00020000,
+0x00020020, 0x00027F96, 0x00020000, 0x00025020, 0x00020020, 0x00020000,
+0x00027816, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00020001,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027F96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00020001, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027816, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027F96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027F96, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027816, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027816, 0x00027816, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027816, 0x00027802, 0x00027E5A, 0x00027D96, 0x00027816, 0x00027D96,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027F5A, 0x00027ED2,
+0x00027D96, 0x00027F5A, 0x00027ED2, 0x00027D96, 0x00027F5A, 0x00027ED2,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027D96, 0x00027F5A, 0x00027ED2, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027816, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027E5A, 0x00027D96, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027D96, 0x00027D96, 0x00027816, 0x00027D96, 0x00027816, 0x00027D96,
+0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027D96, 0x00027D96,
+0x00027816, 0x00027D96, 0x00027816, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027816, 0x00027D96, 0x00027816, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027816, 0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027D96, 0x00027816, 0x00027816,
+0x00027D96, 0x00027816, 0x00027D96, 0x00027D96, 0x00027816, 0x00027816,
+0x00027816, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027D96, 0x00027816, 0x00027802, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027D96,
+0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027836, 0x00027836,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00027822, 0x00020020, 0x00027822, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x000157B6,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x0001D020, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027822, 0x00020020, 0x00027E5A, 0x00027D96,
+0x00000000, 0x00000000, 0x00021836, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00020000, 0x00027E5A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020020, 0x00020020, 0x00027E5A, 0x00025020, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00000000, 0x00027E5A, 0x00000000, 0x00027E5A, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00000000, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027F96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027E5A,
+0x00027F97, 0x00027F97, 0x0002781B, 0x0002781A, 0x0002781A, 0x00027F97,
+0x00027F96, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027F97, 0x00027F97,
+0x00027D96, 0x00027D96, 0x00027E5B, 0x00027F97, 0x00020001, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027816, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00020000, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00010020, 0x00010020,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027D96, 0x00000000, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00000000, 0x00000000, 0x00027822,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020020,
+0x00027816, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027F96,
+0x00027816, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00020000, 0x00015022, 0x00020000, 0x00015022,
+0x00015022, 0x00020000, 0x00015022, 0x00015022, 0x00020000, 0x00015022,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020,
+0x00000020, 0x00000020, 0x00020001, 0x00020001, 0x00020001, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00020000,
+0x00008020, 0x00000000, 0x00020000, 0x00020000, 0x00027822, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015020, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00015022, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00020000, 0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000020, 0x00020000, 0x00015020,
+0x00015020, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027822,
+0x00027822, 0x00015022, 0x00015022, 0x00020000, 0x00015020, 0x00015020,
+0x00015020, 0x00015022, 0x00027802, 0x00027802, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00020000, 0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000020,
+0x00027802, 0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00027822, 0x00027822, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027822, 0x00000000, 0x00000000, 0x00015020,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015020, 0x00015020,
+0x00027822, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027822, 0x00015022,
+0x00015022, 0x00015022, 0x00027822, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015020, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020,
+0x00015020, 0x00015020, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015020, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015020, 0x00015020,
+0x00000020, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00025002,
+0x00015020, 0x00027802, 0x00025002, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00055020,
+0x00025002, 0x00025002, 0x00027802, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015022, 0x00015022, 0x00015022, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00020000, 0x00020000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00020000, 0x00027822,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00025002, 0x00025002,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00015020, 0x00027802, 0x00015002, 0x00025002,
+0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000,
+0x00000000, 0x00025002, 0x00025002, 0x00000000, 0x00000000, 0x00025002,
+0x00025002, 0x00055020, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015002,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022,
+0x00000000, 0x00000000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00020000, 0x00015020, 0x00000000, 0x00000000, 0x00015022,
+0x00015022, 0x00025002, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00015020, 0x00000000, 0x00025002, 0x00025002,
+0x00025002, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00015022,
+0x00015022, 0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00015022,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00015022, 0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015022,
+0x00015022, 0x00025002, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00015020, 0x00027802, 0x00025002, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00015022,
+0x00015022, 0x00025002, 0x00000000, 0x00025002, 0x00025002, 0x00055020,
+0x00000000, 0x00000000, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00015022, 0x00015022,
+0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00000000, 0x00015022,
+0x00025002, 0x00025002, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00015020, 0x00027802, 0x00015002, 0x00015022,
+0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000,
+0x00000000, 0x00025002, 0x00025002, 0x00000000, 0x00000000, 0x00025002,
+0x00025002, 0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015020, 0x00015022, 0x00015002,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00020000, 0x00027802, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00015022, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00015002, 0x00025002, 0x00015022, 0x00025002,
+0x00025002, 0x00000000, 0x00000000, 0x00000000, 0x00025002, 0x00025002,
+0x00025002, 0x00000000, 0x00025002, 0x00025002, 0x00025002, 0x00055020,
+0x00000000, 0x00000000, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015002, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00015020, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00000000, 0x00015022, 0x00015022,
+0x00015022, 0x00000000, 0x00015022, 0x00015022, 0x00015022, 0x00055020,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00015022, 0x00015022, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00015022,
+0x00025002, 0x00025002, 0x00020000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00015020, 0x00027802, 0x00025002, 0x00015022,
+0x00025002, 0x00025002, 0x00015002, 0x00025002, 0x00025002, 0x00000000,
+0x00015022, 0x00025002, 0x00025002, 0x00000000, 0x00025002, 0x00025002,
+0x00015022, 0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015002, 0x00015002, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00055020, 0x00055020, 0x00027802,
+0x00015002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00000000, 0x00025002, 0x00025002, 0x00025002, 0x00000000,
+0x00025002, 0x00025002, 0x00025002, 0x00055020, 0x00027802, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00015002, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00015022, 0x00025002, 0x00025002,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015002,
+0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00000000,
+0x00015022, 0x00000000, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00015002, 0x00000000, 0x00000000,
+0x00025002, 0x00025002, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00027802, 0x00025802, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00055022, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027822, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015022,
+0x00015020, 0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00027802, 0x00025802,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00055020, 0x00015022, 0x00015022, 0x00027802, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027822, 0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015022, 0x00000000, 0x00000000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00015020, 0x00015020, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00015020, 0x00020000, 0x00015020, 0x00020000, 0x00015020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00025000, 0x00025000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00015022, 0x00015022, 0x00015020, 0x00015020, 0x00055020, 0x00020000,
+0x00015020, 0x00015020, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00000000, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015020, 0x00025002, 0x00055020,
+0x00055020, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00027802,
+0x00025002, 0x00025002, 0x00025002, 0x00027802, 0x00027802, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00015022, 0x00027802, 0x00025002, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025002, 0x00025002, 0x00025002, 0x00015022,
+0x00020000, 0x00020000, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00000000, 0x00027E5A, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027E5A, 0x00000000, 0x00000000,
+0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96,
+0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96,
+0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96,
+0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96, 0x00027C96,
+0x00027C96, 0x00027C96, 0x00027C96, 0x00020000, 0x00027822, 0x00027C96,
+0x00027C96, 0x00027C96, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x0002F802,
+0x0002F802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027C5A, 0x00027C5A,
+0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A,
+0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A,
+0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A, 0x00027C5A,
+0x00027C5A, 0x00027C5A, 0x00000000, 0x00000000, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00000000, 0x00000000,
+0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00055020, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00015022, 0x00015022, 0x00055020, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00015022, 0x00015022,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00000000, 0x00015022, 0x00015022, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x0001D020, 0x0001D020, 0x00025002, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00015022, 0x00025002, 0x00025002, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00055020, 0x00015020, 0x00020000, 0x00020000,
+0x00020000, 0x00027822, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00015020, 0x00000000, 0x00000000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x0001D020, 0x0001D020, 0x0001D020, 0x00008020, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027822, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00017822, 0x00017822, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00025002, 0x00025002, 0x00015022, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00015020, 0x00015020, 0x00015020,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00015022, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025002,
+0x00015022, 0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00055020, 0x00025002,
+0x00015022, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00000000, 0x00000000, 0x00015020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00027822, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00010020, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015020, 0x00015002, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00015022, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00025002,
+0x00065000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00015022, 0x00015022, 0x00025002, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00065000, 0x00055020,
+0x00015022, 0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00025002,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00025002, 0x00015022,
+0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00065000, 0x00065000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00015022, 0x00015020,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027822, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00020000, 0x00020000, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00000000, 0x00000000, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015020, 0x00015020,
+0x00015020, 0x00020000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00025000, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00027802,
+0x00027802, 0x00025000, 0x00015020, 0x00015020, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027836, 0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027D96,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027D96, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027F96, 0x00027F96,
+0x00027816, 0x00027816, 0x00027E5A, 0x00027816, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00000000, 0x00000000, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00000000, 0x00000000,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00000000, 0x00027E5A, 0x00000000, 0x00027E5A,
+0x00000000, 0x00027E5A, 0x00000000, 0x00027E5A, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00000000, 0x00000000, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027ED2, 0x00027ED2,
+0x00027ED2, 0x00027ED2, 0x00027ED2, 0x00027ED2, 0x00027ED2, 0x00027ED2,
+0x00027D96, 0x00027D96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00000000,
+0x00027D96, 0x00027F96, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027ED2, 0x00020020, 0x00027D96, 0x00020020, 0x00020020, 0x00020020,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00000000, 0x00027D96, 0x00027F96,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027ED2, 0x00020020,
+0x00020020, 0x00020020, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00000000, 0x00000000, 0x00027D96, 0x00027D96, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00000000, 0x00020020, 0x00020020, 0x00020020,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00020020, 0x00020020, 0x00020020, 0x00000000, 0x00000000,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00000000, 0x00027D96, 0x00027F96,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027ED2, 0x00020020,
+0x00020020, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00008020, 0x00018020, 0x00008020, 0x00008020, 0x00008020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020001, 0x00020000, 0x00020020, 0x00020020, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020020, 0x00020000, 0x00020000, 0x00020020,
+0x00000000, 0x00000000, 0x00008020, 0x00008020, 0x00008020, 0x00008020,
+0x00008020, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001,
+0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00025000,
+0x00025001, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020001, 0x00020000, 0x00025000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00008020, 0x00008021, 0x00008021, 0x00008021,
+0x00008021, 0x00008000, 0x00008020, 0x00008020, 0x00008020, 0x00008020,
+0x00008020, 0x00008020, 0x00008020, 0x00008020, 0x00008020, 0x00008020,
+0x00020000, 0x00027836, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00027836, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00000000, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027836, 0x00027836, 0x00027836, 0x00000000, 0x00000000, 0x00000000,
+0x00015021, 0x00015021, 0x00015021, 0x00015021, 0x00015021, 0x00015021,
+0x00015021, 0x00015021, 0x00015021, 0x00015021, 0x00015021, 0x00015021,
+0x00015021, 0x00010020, 0x00010020, 0x00010020, 0x00010020, 0x00015021,
+0x00010020, 0x00010020, 0x00010020, 0x00015021, 0x00015021, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015021, 0x00015021, 0x00015021,
+0x00015021, 0x00015021, 0x00015020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x0002781B, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x0002781B, 0x00020000, 0x00020000, 0x00027817, 0x0002781B,
+0x0002781B, 0x0002781B, 0x00027817, 0x00027817, 0x0002781B, 0x0002781B,
+0x0002781B, 0x00027817, 0x00020000, 0x0002781B, 0x00020000, 0x00020000,
+0x00027801, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x0002781B, 0x00020000, 0x00027E5A, 0x00020000, 0x0002781B, 0x00020001,
+0x00027E5A, 0x00027E5A, 0x0002781B, 0x0002781B, 0x00027800, 0x00027817,
+0x0002781B, 0x0002781B, 0x00027E5A, 0x0002781B, 0x00027817, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027816, 0x00020000, 0x00020000,
+0x00027817, 0x00027817, 0x0002781B, 0x0002781B, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x0002781B, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00020000, 0x00020001, 0x00020000, 0x00020000,
+0x00027D96, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027E5A,
+0x00027D96, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020000, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A,
+0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A,
+0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A,
+0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A,
+0x0002065A, 0x0002065A, 0x0002065A, 0x0002065A, 0x00020596, 0x00020596,
+0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596,
+0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596,
+0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596,
+0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596, 0x00020596,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020001, 0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020001, 0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020001, 0x00020000, 0x00020001, 0x00020000, 0x00020000, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001,
+0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020000,
+0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000,
+0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00000000, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00000000, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027D96, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027816, 0x00027E5A, 0x00027D96, 0x00027816, 0x00027E5A,
+0x00027D96, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027836, 0x00027836, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027816, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027D96, 0x00015020, 0x00015020, 0x00015020, 0x00027E5A, 0x00027D96,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00000000, 0x00027D96, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027D96, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027822, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00055020,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020022,
+0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00027822, 0x00027802, 0x00027802, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015000, 0x00015000, 0x00020000, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027822, 0x00027802, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00015020,
+0x00015020, 0x00021820, 0x00021820, 0x00027822, 0x00027822, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00027822, 0x00027822, 0x00027822, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x0002F802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027822,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027822, 0x00020000,
+0x00020000, 0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027802, 0x00015020, 0x00010020, 0x00010020,
+0x00010020, 0x00020000, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015020, 0x00015020,
+0x00020000, 0x00027822, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027836, 0x00027836, 0x00015022, 0x00015022,
+0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00020020, 0x00020020, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027816, 0x00027816, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027836, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027822, 0x00020020,
+0x00020020, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027816, 0x00027802,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027D96, 0x00027816,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027816, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96,
+0x00000000, 0x00000000, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027E5A, 0x00027D96, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027E5A, 0x00027D96, 0x00027802,
+0x00027836, 0x00027836, 0x00027816, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00027802,
+0x00027802, 0x00027802, 0x00055020, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00025002, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00025002, 0x00025002, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00055020, 0x00015022, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00015020, 0x00015020, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000, 0x00020000,
+0x00020000, 0x00027802, 0x00020000, 0x00027802, 0x00027802, 0x00015022,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015020,
+0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00065000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00065000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00027822, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00027822, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00015022,
+0x00015022, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00025002,
+0x00000000, 0x00000000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027822, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00025002,
+0x00015022, 0x00025002, 0x00027802, 0x00027802, 0x00015022, 0x00027802,
+0x00015022, 0x00015022, 0x00015022, 0x00027802, 0x00027802, 0x00015022,
+0x00015022, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015022, 0x00015020, 0x00027802, 0x00015020, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802,
+0x00027802, 0x00027822, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00015022, 0x00015022,
+0x00025002, 0x00025002, 0x00020000, 0x00020000, 0x00027802, 0x00027822,
+0x00027822, 0x00025002, 0x00055020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027816, 0x00027816, 0x00027816, 0x00027D96,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00020020, 0x00027836, 0x00027836, 0x00027836, 0x00027836,
+0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816, 0x00027816,
+0x00027816, 0x00027816, 0x00027816, 0x00027822, 0x00020020, 0x00020020,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027802, 0x00027802, 0x00027802, 0x00025002,
+0x00025002, 0x00015022, 0x00025002, 0x00025002, 0x00015022, 0x00025002,
+0x00025002, 0x00020000, 0x00025000, 0x00055020, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027F96, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00027F96, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027F96, 0x00027F96, 0x00027F96,
+0x00027F96, 0x00027F96, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00015022, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020001, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00021802, 0x00021802, 0x00021802, 0x00021802, 0x00021802, 0x00021802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00021802, 0x00021802, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020,
+0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020,
+0x0001D020, 0x0001D020, 0x0001D020, 0x0001D020, 0x00020000, 0x00020000,
+0x00020000, 0x00020020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00025000,
+0x00025000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00025000, 0x00025000, 0x00025000, 0x00020000, 0x00020000,
+0x00020020, 0x00000000, 0x00020000, 0x00020020, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020001, 0x00020001, 0x00020001,
+0x00020001, 0x00020001, 0x00020001, 0x00000000, 0x00020001, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00021802, 0x00027802, 0x00021802, 0x00027802, 0x00021802, 0x00000000,
+0x00021802, 0x00027802, 0x00021802, 0x00027802, 0x00021802, 0x00027802,
+0x00021802, 0x00027802, 0x00021802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00008020, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020020, 0x00020000, 0x00020000,
+0x00020000, 0x00020001, 0x00020000, 0x00020000, 0x00020020, 0x00020000,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00020000,
+0x00020001, 0x00020000, 0x00020021, 0x00025000, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00020000, 0x00020001, 0x00020000,
+0x00020001, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027822, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015822, 0x00015822, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020001, 0x00020020, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00020000, 0x00020001, 0x00020001, 0x00020001, 0x00020001, 0x00020000,
+0x00020000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000020,
+0x00000020, 0x00000020, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020,
+0x00000000, 0x00000000, 0x00015020, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00015022,
+0x00015022, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00015020, 0x00015020,
+0x00015020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00055020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00020000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020,
+0x00015020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027E5A, 0x00027E5A, 0x00027E5A, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00015022,
+0x00015022, 0x00020000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00025002, 0x00015022, 0x00025002, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00055020, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00055020, 0x00015020, 0x00015020, 0x00025002, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00025002, 0x00055020, 0x00015020, 0x00020000,
+0x00020000, 0x00000020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020,
+0x00000000, 0x00000000, 0x00015022, 0x00015022, 0x00015022, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00055020, 0x00055020, 0x00000000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027802, 0x00025002, 0x00025002, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00020000, 0x00020000,
+0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00065000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00020000, 0x00025002, 0x00015022,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00027802, 0x00020000,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00025002, 0x00025002, 0x00015022, 0x00065000, 0x00015020, 0x00015022,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00015022, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015022,
+0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015020, 0x00055020, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015022, 0x00015022,
+0x00025002, 0x00025002, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00000000, 0x00015020, 0x00015020, 0x00027802, 0x00015002, 0x00025002,
+0x00015022, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00000000,
+0x00000000, 0x00025002, 0x00025002, 0x00000000, 0x00000000, 0x00025002,
+0x00025002, 0x00065000, 0x00000000, 0x00000000, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015002,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002,
+0x00000000, 0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00000000, 0x00000000, 0x00000000,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00055020, 0x00015022,
+0x00015022, 0x00025002, 0x00015020, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00020000, 0x00020000,
+0x00000000, 0x00020000, 0x00015020, 0x00027802, 0x00015002, 0x00025002,
+0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00015022, 0x00025002, 0x00025002, 0x00015002,
+0x00025002, 0x00015022, 0x00015022, 0x00025002, 0x00055020, 0x00015020,
+0x00027802, 0x00027802, 0x00020000, 0x00027802, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015002, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022,
+0x00025002, 0x00055020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00000000, 0x00000000,
+0x00025002, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00025002,
+0x00025002, 0x00015022, 0x00025002, 0x00055020, 0x00015022, 0x00020000,
+0x00020000, 0x00020000, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00025002, 0x00015022, 0x00025002, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00065000, 0x00015020, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00015022,
+0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00055020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00025002, 0x00055020, 0x00015020, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00027802,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00000000, 0x00025002,
+0x00025002, 0x00000000, 0x00000000, 0x00015022, 0x00015022, 0x00065000,
+0x00055020, 0x00027802, 0x00025002, 0x00027802, 0x00025002, 0x00015020,
+0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00025002,
+0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00000000, 0x00000000, 0x00015022, 0x00015022, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00055020, 0x00027802, 0x00020000, 0x00027802,
+0x00025002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00015020, 0x00055020, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00027802, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00055020, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00025002, 0x00015022, 0x00015022, 0x00015022,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00025002, 0x00015020, 0x00055020,
+0x00020000, 0x00020000, 0x00020000, 0x00027802, 0x00020000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00025002, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00025002, 0x00055020, 0x00027802, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00025002,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00025002, 0x00015022, 0x00015022, 0x00025002, 0x00015022,
+0x00015022, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00027802, 0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00000000,
+0x00015022, 0x00000000, 0x00015022, 0x00015022, 0x00000000, 0x00015022,
+0x00015022, 0x00015022, 0x00015020, 0x00015022, 0x00055020, 0x00055020,
+0x00027802, 0x00015022, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00027802,
+0x00027802, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00000000,
+0x00015022, 0x00015022, 0x00000000, 0x00025002, 0x00025002, 0x00015022,
+0x00025002, 0x00055020, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00015022, 0x00015022, 0x00025002, 0x00025002, 0x00020000,
+0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020,
+0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00015022, 0x00027802, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002, 0x00025002,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00020000, 0x00027822, 0x00015020, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00025002, 0x00025002,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00000000, 0x00000000, 0x00020000, 0x00015020,
+0x00015022, 0x00020000, 0x00008020, 0x00008020, 0x00008020, 0x00008020,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00015000, 0x00025000, 0x00015020,
+0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00025000,
+0x00015000, 0x00015000, 0x00015000, 0x00015000, 0x00015000, 0x00008020,
+0x00008020, 0x00008020, 0x00008020, 0x00008020, 0x00008020, 0x00008020,
+0x00008020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00020000, 0x00020000, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020, 0x00015020,
+0x00015020, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00000000, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x0002781B, 0x00000000, 0x0002781B, 0x0002781B,
+0x00000000, 0x00000000, 0x0002781B, 0x00000000, 0x00000000, 0x0002781B,
+0x0002781B, 0x00000000, 0x00000000, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x00000000, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00000000, 0x00027817, 0x00000000, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00000000, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x0002781B, 0x0002781B,
+0x00000000, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00000000,
+0x00000000, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x00000000, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00000000,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x0002781B, 0x0002781B,
+0x00000000, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00000000,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00000000,
+0x0002781B, 0x00000000, 0x00000000, 0x00000000, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x00000000,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00000000, 0x00000000,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x00020001, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00020001,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x00020001, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00020001,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x00020001, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00020001,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x00020001, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00020001,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B, 0x0002781B,
+0x0002781B, 0x0002781B, 0x0002781B, 0x00020001, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00020001, 0x00027817, 0x00027817, 0x00027817, 0x00027817,
+0x00027817, 0x00027817, 0x0002781B, 0x00027817, 0x00000000, 0x00000000,
+0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001,
+0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001,
+0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001, 0x00025001,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00015020, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022, 0x00015022,
+0x00000000, 0x00015022, 0x00015022, 0x00000000, 0x00015022, 0x00015022,
+0x00015022, 0x00015022, 0x00015022, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00015020, 0x00015020, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00027822, 0x00027822, 0x00027822,
+0x00027822, 0x00027822, 0x00027822, 0x00027822, 0x00000000, 0x00000000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027802, 0x00020000, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000, 0x00025000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00027802, 0x00000000,
+0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00015020, 0x00015020,
+0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00015020, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027E5A, 0x00027E5A, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96,
+0x00027D96, 0x00027D96, 0x00027D96, 0x00027D96, 0x00015020, 0x00015020,
+0x00015020, 0x00015022, 0x00015020, 0x00015020, 0x00015020, 0x00027822,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00000000, 0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803,
+0x00027803, 0x00000000, 0x00027803, 0x00000000, 0x00000000, 0x00027803,
+0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00000000,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803,
+0x00000000, 0x00027803, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00027803, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027803, 0x00000000, 0x00027803, 0x00000000, 0x00027803,
+0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803,
+0x00027803, 0x00000000, 0x00027803, 0x00000000, 0x00000000, 0x00027803,
+0x00000000, 0x00027803, 0x00000000, 0x00027803, 0x00000000, 0x00027803,
+0x00000000, 0x00027803, 0x00000000, 0x00027803, 0x00027803, 0x00000000,
+0x00027803, 0x00000000, 0x00000000, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00000000, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00000000, 0x00027803, 0x00000000, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00000000, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00027803,
+0x00027803, 0x00027803, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00000000, 0x00027803,
+0x00027803, 0x00027803, 0x00027803, 0x00027803, 0x00020001, 0x00020001,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A,
+0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A,
+0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A,
+0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A,
+0x0002001A, 0x0002001A, 0x0002001A, 0x0002001A, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020020,
+0x00020020, 0x00020020, 0x00020020, 0x00020020, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000,
+0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000, 0x00020000,
+0x00020000, 0x00020000, 0x00008000, 0x00008020, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00018020, 0x00018020,
+0x00018020, 0x00018020, 0x00018020, 0x00018020, 0x00018020, 0x00018020,
+0x00018020, 0x00018020, 0x00018020, 0x00018020, 0x00018020, 0x00018020,
+0x00018020, 0x00018020,
+};
@@ -0,0 +1,3884 @@
+static_assert(static_cast<int>(GeneralCategory::Lu) == 0, "");
+static_assert(static_cast<int>(GeneralCategory::Ll) == 1, "");
+static_assert(static_cast<int>(GeneralCategory::Lt) == 2, "");
+static_assert(static_cast<int>(GeneralCategory::Lm) == 3, "");
+static_assert(static_cast<int>(GeneralCategory::Lo) == 4, "");
+static_assert(static_cast<int>(GeneralCategory::Mn) == 5, "");
+static_assert(static_cast<int>(GeneralCategory::Mc) == 6, "");
+static_assert(static_cast<int>(GeneralCategory::Me) == 7, "");
+static_assert(static_cast<int>(GeneralCategory::Nd) == 8, "");
+static_assert(static_cast<int>(GeneralCategory::Nl) == 9, "");
+static_assert(static_cast<int>(GeneralCategory::No) == 10, "");
+static_assert(static_cast<int>(GeneralCategory::Pc) == 11, "");
+static_assert(static_cast<int>(GeneralCategory::Pd) == 12, "");
+static_assert(static_cast<int>(GeneralCategory::Ps) == 13, "");
+static_assert(static_cast<int>(GeneralCategory::Pe) == 14, "");
+static_assert(static_cast<int>(GeneralCategory::Pi) == 15, "");
+static_assert(static_cast<int>(GeneralCategory::Pf) == 16, "");
+static_assert(static_cast<int>(GeneralCategory::Po) == 17, "");
+static_assert(static_cast<int>(GeneralCategory::Sm) == 18, "");
+static_assert(static_cast<int>(GeneralCategory::Sc) == 19, "");
+static_assert(static_cast<int>(GeneralCategory::Sk) == 20, "");
+static_assert(static_cast<int>(GeneralCategory::So) == 21, "");
+static_assert(static_cast<int>(GeneralCategory::Zs) == 22, "");
+static_assert(static_cast<int>(GeneralCategory::Zl) == 23, "");
+static_assert(static_cast<int>(GeneralCategory::Zp) == 24, "");
+static_assert(static_cast<int>(GeneralCategory::Cc) == 25, "");
+static_assert(static_cast<int>(GeneralCategory::Cf) == 26, "");
+static_assert(static_cast<int>(GeneralCategory::Cs) == 27, "");
+static_assert(static_cast<int>(GeneralCategory::Co) == 28, "");
+static_assert(static_cast<int>(GeneralCategory::Cn) == 29, "");
+const uint16_t _general_category_properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 1216, 1280, 1280, 1344, 1344, 1344, 1344, 1344,
+1344, 1408, 1472, 1536, 1600, 1664, 1728, 1792, 1856, 1920, 1984, 2048, 2112,
+2176, 2176, 832, 2240, 2176, 2176, 2176, 2304, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2368, 2432, 832, 832, 832, 832, 832, 2496, 832, 2560, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2624, 2176, 2176, 2688, 2176, 2176,
+2176, 2176, 2752, 2816, 2880, 2176, 2944, 2176, 3008, 3072, 3136, 3200, 3264,
+2176, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 3328, 832, 832, 832, 3392,
+3456, 832, 832, 832, 832, 3520, 832, 832, 832, 832, 832, 832, 3584, 2176, 2176,
+2176, 3648, 2176, 832, 832, 832, 832, 3712, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 3776, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176, 2176,
+2176, 2176, 2176, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 3840, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+3840,
+};
+const uint16_t _general_category_properties_stage2[] = {
+0, 0, 16, 32, 48, 64, 80, 96, 0, 0, 112, 128, 144, 160, 176, 192, 208, 208, 208,
+224, 240, 208, 208, 256, 272, 288, 304, 320, 336, 352, 208, 368, 208, 208, 208,
+384, 400, 176, 176, 176, 176, 416, 176, 432, 448, 464, 480, 496, 512, 512, 512,
+512, 512, 512, 512, 528, 544, 560, 576, 176, 592, 608, 208, 624, 144, 144, 144,
+176, 176, 176, 208, 208, 640, 208, 208, 208, 656, 208, 208, 208, 208, 208, 208,
+672, 144, 688, 176, 176, 704, 720, 512, 736, 752, 768, 784, 800, 816, 832, 768,
+768, 848, 512, 864, 880, 768, 768, 768, 768, 768, 896, 912, 928, 944, 960, 768,
+512, 976, 768, 768, 768, 768, 768, 992, 1008, 1024, 768, 1040, 1056, 768, 1072,
+1088, 1104, 768, 1120, 1136, 1152, 1152, 1152, 768, 1168, 1184, 1200, 1216, 512,
+1232, 768, 768, 1248, 1264, 1280, 1296, 1312, 1328, 1344, 1360, 1376, 1392,
+1408, 1424, 1440, 1456, 1344, 1360, 1472, 1488, 1504, 1520, 1536, 1552, 1568,
+1360, 1584, 1600, 1616, 1424, 1632, 1648, 1344, 1360, 1664, 1680, 1696, 1424,
+1712, 1728, 1744, 1760, 1776, 1792, 1808, 1520, 1824, 1840, 1856, 1360, 1872,
+1888, 1904, 1424, 1920, 1936, 1856, 1360, 1952, 1968, 1984, 1424, 2000, 2016,
+1856, 768, 2032, 2048, 2064, 1424, 2080, 2096, 2112, 768, 2128, 2144, 2160,
+1520, 2176, 2192, 768, 768, 2208, 2224, 2240, 1152, 1152, 2256, 768, 2272, 2288,
+2304, 2320, 1152, 1152, 2336, 2352, 2368, 2384, 2400, 768, 2416, 2432, 2448,
+2464, 512, 2480, 2496, 2512, 1152, 1152, 768, 768, 2528, 2544, 2560, 2576, 2592,
+2608, 2624, 2640, 144, 144, 2656, 176, 176, 2672, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 2688,
+2704, 768, 768, 2688, 768, 768, 2720, 2736, 2752, 768, 768, 768, 2736, 768, 768,
+768, 2768, 2784, 2800, 768, 2816, 144, 144, 144, 144, 144, 2832, 2848, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 2864, 768, 2880, 2896, 768, 768, 768, 768, 2912, 2928, 2944,
+2960, 768, 2976, 768, 2992, 2944, 3008, 768, 768, 768, 3024, 3040, 3056, 3072,
+3088, 3104, 3072, 768, 768, 3120, 768, 768, 3136, 3152, 768, 3168, 768, 768,
+768, 768, 3184, 768, 3200, 3216, 3232, 3248, 768, 3264, 3280, 768, 768, 3296,
+768, 3312, 3328, 3344, 3344, 768, 3360, 768, 768, 768, 3376, 3392, 3408, 3072,
+3072, 3424, 3440, 3456, 1152, 1152, 1152, 3472, 768, 768, 3488, 3504, 2560,
+3520, 3536, 3552, 768, 3568, 1024, 768, 768, 3584, 3600, 768, 768, 3616, 3632,
+3648, 1024, 768, 3664, 3680, 144, 144, 3696, 3712, 3728, 3744, 3760, 176, 176,
+3776, 432, 432, 432, 3792, 3808, 176, 3824, 432, 432, 512, 512, 512, 3840, 208,
+208, 208, 208, 208, 208, 208, 208, 208, 3856, 208, 208, 208, 208, 208, 208,
+3872, 3888, 3872, 3872, 3888, 3904, 3872, 3920, 3936, 3936, 3936, 3952, 3968,
+3984, 4000, 4016, 4032, 4048, 4064, 4080, 4096, 4112, 4128, 4144, 4160, 4176,
+4192, 4192, 1152, 4208, 4224, 3456, 4240, 4256, 4272, 4288, 4304, 4320, 4336,
+4336, 4352, 4368, 4384, 3344, 4400, 4416, 3344, 4432, 4448, 4448, 4448, 4448,
+4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4464,
+3344, 4480, 3344, 3344, 3344, 3344, 4496, 3344, 4512, 4448, 4528, 3344, 4544,
+4560, 3344, 3344, 3344, 4576, 1152, 4592, 1152, 4320, 4320, 4320, 4608, 3344,
+3344, 3344, 3344, 4624, 4320, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 4640, 4656, 3344, 3344, 4672, 3344, 3344, 3344, 3344, 3344,
+3344, 4688, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 4704, 4720, 4320, 4736, 3344, 3344, 4752, 4448, 4768,
+4448, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4784,
+4800, 4448, 4448, 4448, 4816, 4448, 4832, 4448, 4448, 4448, 4448, 4448, 4448,
+4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 3344, 3344, 3344,
+4448, 4848, 3344, 3344, 4864, 3344, 4880, 3344, 3344, 3344, 3344, 3344, 3344,
+144, 144, 4896, 176, 176, 4912, 4928, 4944, 208, 208, 208, 208, 208, 208, 4960,
+4976, 176, 176, 4992, 768, 768, 768, 5008, 5024, 768, 5040, 5056, 5056, 5056,
+5056, 512, 512, 5072, 5088, 5104, 5120, 5136, 5152, 1152, 1152, 3344, 5168,
+3344, 3344, 3344, 3344, 3344, 5184, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 5200, 1152, 5216, 5232, 5248, 5264, 5280,
+2192, 768, 768, 768, 768, 5296, 2848, 768, 768, 768, 768, 5312, 5328, 768, 768,
+2192, 768, 768, 768, 768, 3200, 5344, 768, 768, 3344, 3344, 5184, 768, 3344,
+5360, 5376, 3344, 5392, 5408, 3344, 3344, 5376, 3344, 3344, 5408, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 3344, 3344, 3344, 3344, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 2416, 768, 5424, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+2416, 3344, 3344, 3344, 4576, 768, 768, 3664, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 5440, 768, 5456, 1152, 208, 208,
+5472, 5488, 208, 5504, 768, 768, 768, 768, 5520, 5536, 496, 5552, 5568, 5584,
+208, 208, 208, 5600, 5616, 5632, 5648, 5664, 5680, 1152, 1152, 5696, 5712, 768,
+5728, 5744, 768, 768, 768, 5760, 5776, 768, 768, 5792, 5808, 3072, 512, 5824,
+1024, 768, 5840, 768, 5856, 5872, 768, 2416, 1232, 768, 768, 5888, 5904, 5920,
+5936, 5952, 768, 768, 5968, 5984, 6000, 6016, 768, 6032, 768, 768, 768, 6048,
+6064, 6080, 6096, 6112, 6128, 6144, 5056, 176, 176, 6160, 6176, 176, 176, 176,
+176, 176, 768, 768, 6192, 3072, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 6208, 768, 6224, 768, 768, 3296, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
+6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
+6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
+6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
+6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
+6240, 6240, 6240, 6240, 6240, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3264,
+768, 768, 768, 768, 768, 768, 3312, 1152, 1152, 6272, 6288, 6304, 6320, 6336,
+768, 768, 768, 768, 768, 768, 6352, 6368, 6384, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 6400,
+1152, 768, 768, 768, 768, 6416, 768, 768, 1184, 1152, 1152, 6432, 512, 6448,
+512, 6464, 6480, 6496, 6512, 1168, 768, 768, 768, 768, 768, 768, 768, 6528,
+6544, 32, 48, 64, 80, 6560, 6576, 6592, 768, 6608, 768, 3200, 6624, 6640, 6656,
+6672, 6688, 768, 2752, 6704, 3264, 3264, 1152, 1152, 768, 768, 768, 768, 768,
+768, 768, 1136, 6720, 4320, 4320, 6736, 4336, 4336, 4336, 6752, 6768, 6784,
+6800, 1152, 1152, 3344, 3344, 6816, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 768, 2416, 768, 768, 768, 1616, 6832, 6848, 768, 768, 6864, 768, 6880,
+768, 768, 6896, 768, 6912, 768, 768, 6928, 6944, 1152, 1152, 144, 144, 6960,
+176, 176, 768, 768, 768, 768, 3264, 3072, 144, 144, 6976, 176, 6992, 768, 768,
+1184, 768, 768, 768, 7008, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 5040, 768, 3184, 1184, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 7024, 768, 768, 7040, 768, 7056, 768, 7072, 768, 3200, 7088, 1152,
+1152, 1152, 768, 7104, 768, 7120, 768, 7136, 1152, 1152, 1152, 1152, 768, 768,
+768, 7152, 4320, 7168, 4320, 4320, 7184, 7200, 768, 7216, 7232, 7248, 768, 7264,
+768, 7280, 1152, 1152, 7296, 768, 7312, 7328, 768, 768, 768, 7344, 768, 7360,
+768, 7376, 768, 7392, 7408, 1152, 1152, 1152, 1152, 1152, 768, 768, 768, 768,
+3136, 1152, 1152, 1152, 144, 144, 144, 7424, 176, 176, 176, 7440, 768, 768,
+7456, 3072, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 4320, 7472, 768, 768, 7488, 7504,
+1152, 1152, 1152, 1152, 768, 7280, 7520, 768, 992, 7536, 1152, 1152, 1152, 1152,
+1152, 768, 7552, 1152, 768, 5040, 7568, 768, 768, 7584, 7600, 7168, 7616, 7632,
+3552, 768, 768, 7648, 7664, 768, 3136, 3072, 7680, 768, 7696, 7712, 7728, 768,
+768, 7744, 3552, 768, 768, 7760, 7776, 7792, 7808, 7824, 768, 1568, 7840, 7856,
+1152, 1152, 1152, 1152, 7872, 7888, 7904, 768, 768, 7920, 7936, 3072, 7952,
+1344, 1360, 7968, 7984, 8000, 8016, 8032, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 768, 768, 768, 8048, 8064, 8080, 7504, 1152, 768, 768, 768, 8096,
+8112, 3072, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768,
+768, 8128, 8144, 8160, 8176, 1152, 1152, 768, 768, 768, 8192, 8208, 3072, 8224,
+1152, 768, 768, 8240, 8256, 3072, 1152, 1152, 1152, 768, 2768, 8272, 8288, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768, 768,
+7840, 8304, 1152, 1152, 1152, 1152, 1152, 1152, 144, 144, 176, 176, 2368, 8320,
+8336, 8352, 768, 8368, 8384, 3072, 1152, 1152, 1152, 1152, 8400, 768, 768, 8416,
+8432, 1152, 8448, 768, 768, 8464, 8480, 8496, 768, 768, 8512, 8528, 8544, 1152,
+768, 768, 768, 3136, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1360, 768, 8128, 8560, 8576, 2368, 2800,
+8592, 768, 8608, 8624, 8640, 1152, 1152, 1152, 1152, 8656, 768, 768, 8672, 8688,
+3072, 8704, 768, 8720, 8736, 3072, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768,
+8752, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1616,
+4320, 8768, 8784, 8800, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3312,
+1152, 1152, 1152, 1152, 1152, 1152, 4336, 4336, 4336, 4336, 4336, 4336, 8816,
+8832, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 6208, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 768, 768, 3200, 8848, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 5040, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3136, 768, 3200, 5920, 1152,
+1152, 1152, 1152, 1152, 1152, 768, 3264, 8864, 768, 768, 768, 8880, 8896, 8912,
+8928, 8944, 768, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 144, 144, 176, 176, 4320, 8960, 1152,
+1152, 1152, 1152, 1152, 1152, 768, 768, 768, 768, 8976, 8992, 9008, 9008, 9024,
+9040, 1152, 1152, 1152, 1152, 9056, 9072, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 1184, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 3184, 1152, 1152, 3136, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 3200, 1152, 1152, 1152, 9088, 9104, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 3296, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768, 768, 768, 768, 768, 768,
+1136, 2416, 3136, 9120, 9136, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 5200, 3344, 3344, 9152, 3344,
+3344, 3344, 9168, 9184, 9200, 3344, 9216, 3344, 3344, 3344, 9232, 1152, 3344,
+3344, 3344, 3344, 9248, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+4320, 9264, 3344, 3344, 3344, 3344, 3344, 4576, 4320, 7232, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 144, 9280, 176, 9296, 9312, 9328, 3872, 144, 9344,
+9360, 9376, 9392, 9408, 144, 9280, 176, 9424, 9440, 176, 9456, 9472, 9488, 9504,
+144, 9520, 176, 144, 9280, 176, 9296, 9312, 176, 3872, 144, 9344, 9504, 144,
+9520, 176, 144, 9280, 176, 9536, 144, 9552, 9568, 9584, 9600, 176, 9616, 144,
+9632, 9648, 9664, 9680, 176, 9696, 144, 9712, 176, 9728, 9744, 9744, 9744, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 512, 512, 512, 9760, 512, 512, 9776, 9792, 9808,
+9824, 720, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 9840, 9856, 9872,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+768, 768, 2416, 9888, 9904, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 768, 768, 9920, 9936, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 9952, 9968, 1152, 1152, 144, 144, 9344, 176,
+9984, 5920, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 7808,
+4320, 4320, 10000, 10016, 1152, 1152, 1152, 1152, 7808, 4320, 10032, 10048,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 10064,
+768, 10080, 10096, 10112, 10128, 10144, 10160, 10176, 3296, 10192, 3296, 1152,
+1152, 1152, 10208, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 3344, 3344, 5216, 3344, 3344, 3344, 3344,
+3344, 3344, 5184, 5360, 10224, 10224, 10224, 3344, 5200, 10240, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 10256, 1152, 1152, 1152, 10272, 3344,
+10288, 3344, 3344, 5216, 9232, 10304, 5200, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 10320, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 10336,
+6784, 6784, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 5184, 3344, 3344, 3344,
+3344, 3344, 9232, 5216, 1152, 5216, 3344, 3344, 3344, 10336, 2816, 3344, 3344,
+10336, 3344, 10256, 10304, 1152, 1152, 1152, 1152, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 10352, 3344, 3344, 3344, 3344, 10368, 3344, 3344, 3344, 3344, 3344,
+3344, 3344, 3344, 5184, 10256, 10384, 4576, 3344, 9232, 4576, 10288, 4576, 1152,
+1152, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 10400, 3344, 3344,
+4592, 1152, 1152, 3072, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 3264, 1152, 1152, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 3280, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 3264, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+7504, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 1616, 1152, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 3264, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 1136, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 10416, 1152, 10432, 10432, 10432, 10432, 10432, 10432, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+512, 512, 512, 512, 512, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
+6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 10448,
+};
+const GeneralCategory _general_category_properties_stage3[] = {
+GeneralCategory::Cc, GeneralCategory::Cc, GeneralCategory::Cc,
+GeneralCategory::Cc, GeneralCategory::Cc, GeneralCategory::Cc,
+GeneralCategory::Cc, GeneralCategory::Cc, GeneralCategory::Cc,
+GeneralCategory::Cc, GeneralCategory::Cc, GeneralCategory::Cc,
+GeneralCategory::Cc, GeneralCategory::Cc, GeneralCategory::Cc,
+GeneralCategory::Cc, GeneralCategory::Zs, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Sc,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Po,
+GeneralCategory::Sm, GeneralCategory::Po, GeneralCategory::Pd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ps, GeneralCategory::Po, GeneralCategory::Pe,
+GeneralCategory::Sk, GeneralCategory::Pc, GeneralCategory::Sk,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ps,
+GeneralCategory::Sm, GeneralCategory::Pe, GeneralCategory::Sm,
+GeneralCategory::Cc, GeneralCategory::Zs, GeneralCategory::Po,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::So, GeneralCategory::Po,
+GeneralCategory::Sk, GeneralCategory::So, GeneralCategory::Lo,
+GeneralCategory::Pi, GeneralCategory::Sm, GeneralCategory::Cf,
+GeneralCategory::So, GeneralCategory::Sk, GeneralCategory::So,
+GeneralCategory::Sm, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Sk, GeneralCategory::Ll, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Sk, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Pf, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Po,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Sm,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Sm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lo, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lu, GeneralCategory::Lt,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lt,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lt,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lt, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Lm, GeneralCategory::Sk, GeneralCategory::Lm,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lm, GeneralCategory::Sk,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Po,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Lu, GeneralCategory::Po,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Sm, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Me, GeneralCategory::Me, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lm, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Po,
+GeneralCategory::Pd, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sc,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Pd, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Sc,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Cf, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cf, GeneralCategory::So, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cf,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::So, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lm, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lm,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lm, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lm, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cf, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::Sc,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Sc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::So,
+GeneralCategory::Lo, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sc, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Sc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lm, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::So, GeneralCategory::Po, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::Mn,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Pd, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::So, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Zs, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lm, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Sc, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Pd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cf, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lm, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::No,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Me, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lm, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lt,
+GeneralCategory::Lt, GeneralCategory::Lt, GeneralCategory::Lt,
+GeneralCategory::Lt, GeneralCategory::Lt, GeneralCategory::Lt,
+GeneralCategory::Lt, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lt, GeneralCategory::Sk,
+GeneralCategory::Ll, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lt,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lt,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Cn,
+GeneralCategory::Zs, GeneralCategory::Zs, GeneralCategory::Zs,
+GeneralCategory::Zs, GeneralCategory::Zs, GeneralCategory::Zs,
+GeneralCategory::Zs, GeneralCategory::Zs, GeneralCategory::Zs,
+GeneralCategory::Zs, GeneralCategory::Zs, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Pd, GeneralCategory::Pd,
+GeneralCategory::Pd, GeneralCategory::Pd, GeneralCategory::Pd,
+GeneralCategory::Pd, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pi, GeneralCategory::Pf, GeneralCategory::Ps,
+GeneralCategory::Pi, GeneralCategory::Pi, GeneralCategory::Pf,
+GeneralCategory::Ps, GeneralCategory::Pi, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Zl, GeneralCategory::Zp,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Zs,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pi, GeneralCategory::Pf, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pc, GeneralCategory::Pc, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Sm,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Sm, GeneralCategory::Po,
+GeneralCategory::Pc, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Zs,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cn,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::No, GeneralCategory::Lm,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Lm, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Cn,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Me, GeneralCategory::Me, GeneralCategory::Me,
+GeneralCategory::Me, GeneralCategory::Mn, GeneralCategory::Me,
+GeneralCategory::Me, GeneralCategory::Me, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Lu, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Lu,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::So, GeneralCategory::Lu, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Lu, GeneralCategory::So,
+GeneralCategory::Lu, GeneralCategory::So, GeneralCategory::Lu,
+GeneralCategory::So, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::So,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Ll, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Ll, GeneralCategory::So,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sm, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sm, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::No, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lm, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Pi, GeneralCategory::Pf,
+GeneralCategory::Pi, GeneralCategory::Pf, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Pi,
+GeneralCategory::Pf, GeneralCategory::Po, GeneralCategory::Pi,
+GeneralCategory::Pf, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Pd, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Pd, GeneralCategory::Po,
+GeneralCategory::Pi, GeneralCategory::Pf, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Pi, GeneralCategory::Pf,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lm, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pd, GeneralCategory::Pd, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pd, GeneralCategory::Po, GeneralCategory::Ps,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Zs, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::So, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Nl, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Pd, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Pe, GeneralCategory::So,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Pd, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Me, GeneralCategory::Me,
+GeneralCategory::Me, GeneralCategory::Po, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Lm, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lm,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lm,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Ll, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Sc, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Lm, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lm, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Sk, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lm,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Po,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cs, GeneralCategory::Cs, GeneralCategory::Cs,
+GeneralCategory::Cs, GeneralCategory::Cs, GeneralCategory::Cs,
+GeneralCategory::Cs, GeneralCategory::Cs, GeneralCategory::Cs,
+GeneralCategory::Cs, GeneralCategory::Cs, GeneralCategory::Cs,
+GeneralCategory::Cs, GeneralCategory::Cs, GeneralCategory::Cs,
+GeneralCategory::Cs, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Sm, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Sc, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Pd, GeneralCategory::Pd, GeneralCategory::Pc,
+GeneralCategory::Pc, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Pc, GeneralCategory::Pc,
+GeneralCategory::Pc, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Pd, GeneralCategory::Ps, GeneralCategory::Pe,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Sm, GeneralCategory::Pd,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Sc,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cf, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Sc,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Ps, GeneralCategory::Pe, GeneralCategory::Po,
+GeneralCategory::Sm, GeneralCategory::Po, GeneralCategory::Pd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ps, GeneralCategory::Sm,
+GeneralCategory::Pe, GeneralCategory::Sm, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Po, GeneralCategory::Ps,
+GeneralCategory::Pe, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::Sm, GeneralCategory::Sk,
+GeneralCategory::So, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Sm, GeneralCategory::Sm,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Nl,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Nl,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::So,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Pd, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cf,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cf, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::So,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Lo, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Lo, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mc,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Sc, GeneralCategory::Sc, GeneralCategory::Sc,
+GeneralCategory::Sc, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Po, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Nl,
+GeneralCategory::Nl, GeneralCategory::Nl, GeneralCategory::Cn,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Po,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Lo, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Po, GeneralCategory::Lm,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Po, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Mc, GeneralCategory::Mc,
+GeneralCategory::Mc, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Cn, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Cn, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Sm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Sm, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Sm,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Sm, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Sm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Sm, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Sm,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Sm, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Lu, GeneralCategory::Lu,
+GeneralCategory::Lu, GeneralCategory::Sm, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Sm,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Mn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Mn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Po, GeneralCategory::Po,
+GeneralCategory::Po, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Lm,
+GeneralCategory::Lm, GeneralCategory::Lm, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::So, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Nd, GeneralCategory::Nd,
+GeneralCategory::Nd, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Sc, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Ll, GeneralCategory::Ll, GeneralCategory::Ll,
+GeneralCategory::Ll, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Mn,
+GeneralCategory::Mn, GeneralCategory::Mn, GeneralCategory::Lm,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::So, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::Sc,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Cn, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Cn, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Cn,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Lo,
+GeneralCategory::Lo, GeneralCategory::Lo, GeneralCategory::Sm,
+GeneralCategory::Sm, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::No,
+GeneralCategory::No, GeneralCategory::No, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::Sk, GeneralCategory::Sk,
+GeneralCategory::Sk, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::Cn,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::So, GeneralCategory::So, GeneralCategory::So,
+GeneralCategory::Cn, GeneralCategory::Cf, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cn, GeneralCategory::Cn,
+GeneralCategory::Cn, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Cf,
+GeneralCategory::Cf, GeneralCategory::Cf, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Co, GeneralCategory::Co,
+GeneralCategory::Co, GeneralCategory::Cn, GeneralCategory::Cn,
+};
@@ -1,943 +1,563 @@
-const std::unordered_map<std::u32string, char32_t> _normalization_composition = {
-{ U"\U00000041\U00000300", 0x000000C0 },
-{ U"\U00000041\U00000301", 0x000000C1 },
-{ U"\U00000041\U00000302", 0x000000C2 },
-{ U"\U00000041\U00000303", 0x000000C3 },
-{ U"\U00000041\U00000308", 0x000000C4 },
-{ U"\U00000041\U0000030A", 0x000000C5 },
-{ U"\U00000043\U00000327", 0x000000C7 },
-{ U"\U00000045\U00000300", 0x000000C8 },
-{ U"\U00000045\U00000301", 0x000000C9 },
-{ U"\U00000045\U00000302", 0x000000CA },
-{ U"\U00000045\U00000308", 0x000000CB },
-{ U"\U00000049\U00000300", 0x000000CC },
-{ U"\U00000049\U00000301", 0x000000CD },
-{ U"\U00000049\U00000302", 0x000000CE },
-{ U"\U00000049\U00000308", 0x000000CF },
-{ U"\U0000004E\U00000303", 0x000000D1 },
-{ U"\U0000004F\U00000300", 0x000000D2 },
-{ U"\U0000004F\U00000301", 0x000000D3 },
-{ U"\U0000004F\U00000302", 0x000000D4 },
-{ U"\U0000004F\U00000303", 0x000000D5 },
-{ U"\U0000004F\U00000308", 0x000000D6 },
-{ U"\U00000055\U00000300", 0x000000D9 },
-{ U"\U00000055\U00000301", 0x000000DA },
-{ U"\U00000055\U00000302", 0x000000DB },
-{ U"\U00000055\U00000308", 0x000000DC },
-{ U"\U00000059\U00000301", 0x000000DD },
-{ U"\U00000061\U00000300", 0x000000E0 },
-{ U"\U00000061\U00000301", 0x000000E1 },
-{ U"\U00000061\U00000302", 0x000000E2 },
-{ U"\U00000061\U00000303", 0x000000E3 },
-{ U"\U00000061\U00000308", 0x000000E4 },
-{ U"\U00000061\U0000030A", 0x000000E5 },
-{ U"\U00000063\U00000327", 0x000000E7 },
-{ U"\U00000065\U00000300", 0x000000E8 },
-{ U"\U00000065\U00000301", 0x000000E9 },
-{ U"\U00000065\U00000302", 0x000000EA },
-{ U"\U00000065\U00000308", 0x000000EB },
-{ U"\U00000069\U00000300", 0x000000EC },
-{ U"\U00000069\U00000301", 0x000000ED },
-{ U"\U00000069\U00000302", 0x000000EE },
-{ U"\U00000069\U00000308", 0x000000EF },
-{ U"\U0000006E\U00000303", 0x000000F1 },
-{ U"\U0000006F\U00000300", 0x000000F2 },
-{ U"\U0000006F\U00000301", 0x000000F3 },
-{ U"\U0000006F\U00000302", 0x000000F4 },
-{ U"\U0000006F\U00000303", 0x000000F5 },
-{ U"\U0000006F\U00000308", 0x000000F6 },
-{ U"\U00000075\U00000300", 0x000000F9 },
-{ U"\U00000075\U00000301", 0x000000FA },
-{ U"\U00000075\U00000302", 0x000000FB },
-{ U"\U00000075\U00000308", 0x000000FC },
-{ U"\U00000079\U00000301", 0x000000FD },
-{ U"\U00000079\U00000308", 0x000000FF },
-{ U"\U00000041\U00000304", 0x00000100 },
-{ U"\U00000061\U00000304", 0x00000101 },
-{ U"\U00000041\U00000306", 0x00000102 },
-{ U"\U00000061\U00000306", 0x00000103 },
-{ U"\U00000041\U00000328", 0x00000104 },
-{ U"\U00000061\U00000328", 0x00000105 },
-{ U"\U00000043\U00000301", 0x00000106 },
-{ U"\U00000063\U00000301", 0x00000107 },
-{ U"\U00000043\U00000302", 0x00000108 },
-{ U"\U00000063\U00000302", 0x00000109 },
-{ U"\U00000043\U00000307", 0x0000010A },
-{ U"\U00000063\U00000307", 0x0000010B },
-{ U"\U00000043\U0000030C", 0x0000010C },
-{ U"\U00000063\U0000030C", 0x0000010D },
-{ U"\U00000044\U0000030C", 0x0000010E },
-{ U"\U00000064\U0000030C", 0x0000010F },
-{ U"\U00000045\U00000304", 0x00000112 },
-{ U"\U00000065\U00000304", 0x00000113 },
-{ U"\U00000045\U00000306", 0x00000114 },
-{ U"\U00000065\U00000306", 0x00000115 },
-{ U"\U00000045\U00000307", 0x00000116 },
-{ U"\U00000065\U00000307", 0x00000117 },
-{ U"\U00000045\U00000328", 0x00000118 },
-{ U"\U00000065\U00000328", 0x00000119 },
-{ U"\U00000045\U0000030C", 0x0000011A },
-{ U"\U00000065\U0000030C", 0x0000011B },
-{ U"\U00000047\U00000302", 0x0000011C },
-{ U"\U00000067\U00000302", 0x0000011D },
-{ U"\U00000047\U00000306", 0x0000011E },
-{ U"\U00000067\U00000306", 0x0000011F },
-{ U"\U00000047\U00000307", 0x00000120 },
-{ U"\U00000067\U00000307", 0x00000121 },
-{ U"\U00000047\U00000327", 0x00000122 },
-{ U"\U00000067\U00000327", 0x00000123 },
-{ U"\U00000048\U00000302", 0x00000124 },
-{ U"\U00000068\U00000302", 0x00000125 },
-{ U"\U00000049\U00000303", 0x00000128 },
-{ U"\U00000069\U00000303", 0x00000129 },
-{ U"\U00000049\U00000304", 0x0000012A },
-{ U"\U00000069\U00000304", 0x0000012B },
-{ U"\U00000049\U00000306", 0x0000012C },
-{ U"\U00000069\U00000306", 0x0000012D },
-{ U"\U00000049\U00000328", 0x0000012E },
-{ U"\U00000069\U00000328", 0x0000012F },
-{ U"\U00000049\U00000307", 0x00000130 },
-{ U"\U0000004A\U00000302", 0x00000134 },
-{ U"\U0000006A\U00000302", 0x00000135 },
-{ U"\U0000004B\U00000327", 0x00000136 },
-{ U"\U0000006B\U00000327", 0x00000137 },
-{ U"\U0000004C\U00000301", 0x00000139 },
-{ U"\U0000006C\U00000301", 0x0000013A },
-{ U"\U0000004C\U00000327", 0x0000013B },
-{ U"\U0000006C\U00000327", 0x0000013C },
-{ U"\U0000004C\U0000030C", 0x0000013D },
-{ U"\U0000006C\U0000030C", 0x0000013E },
-{ U"\U0000004E\U00000301", 0x00000143 },
-{ U"\U0000006E\U00000301", 0x00000144 },
-{ U"\U0000004E\U00000327", 0x00000145 },
-{ U"\U0000006E\U00000327", 0x00000146 },
-{ U"\U0000004E\U0000030C", 0x00000147 },
-{ U"\U0000006E\U0000030C", 0x00000148 },
-{ U"\U0000004F\U00000304", 0x0000014C },
-{ U"\U0000006F\U00000304", 0x0000014D },
-{ U"\U0000004F\U00000306", 0x0000014E },
-{ U"\U0000006F\U00000306", 0x0000014F },
-{ U"\U0000004F\U0000030B", 0x00000150 },
-{ U"\U0000006F\U0000030B", 0x00000151 },
-{ U"\U00000052\U00000301", 0x00000154 },
-{ U"\U00000072\U00000301", 0x00000155 },
-{ U"\U00000052\U00000327", 0x00000156 },
-{ U"\U00000072\U00000327", 0x00000157 },
-{ U"\U00000052\U0000030C", 0x00000158 },
-{ U"\U00000072\U0000030C", 0x00000159 },
-{ U"\U00000053\U00000301", 0x0000015A },
-{ U"\U00000073\U00000301", 0x0000015B },
-{ U"\U00000053\U00000302", 0x0000015C },
-{ U"\U00000073\U00000302", 0x0000015D },
-{ U"\U00000053\U00000327", 0x0000015E },
-{ U"\U00000073\U00000327", 0x0000015F },
-{ U"\U00000053\U0000030C", 0x00000160 },
-{ U"\U00000073\U0000030C", 0x00000161 },
-{ U"\U00000054\U00000327", 0x00000162 },
-{ U"\U00000074\U00000327", 0x00000163 },
-{ U"\U00000054\U0000030C", 0x00000164 },
-{ U"\U00000074\U0000030C", 0x00000165 },
-{ U"\U00000055\U00000303", 0x00000168 },
-{ U"\U00000075\U00000303", 0x00000169 },
-{ U"\U00000055\U00000304", 0x0000016A },
-{ U"\U00000075\U00000304", 0x0000016B },
-{ U"\U00000055\U00000306", 0x0000016C },
-{ U"\U00000075\U00000306", 0x0000016D },
-{ U"\U00000055\U0000030A", 0x0000016E },
-{ U"\U00000075\U0000030A", 0x0000016F },
-{ U"\U00000055\U0000030B", 0x00000170 },
-{ U"\U00000075\U0000030B", 0x00000171 },
-{ U"\U00000055\U00000328", 0x00000172 },
-{ U"\U00000075\U00000328", 0x00000173 },
-{ U"\U00000057\U00000302", 0x00000174 },
-{ U"\U00000077\U00000302", 0x00000175 },
-{ U"\U00000059\U00000302", 0x00000176 },
-{ U"\U00000079\U00000302", 0x00000177 },
-{ U"\U00000059\U00000308", 0x00000178 },
-{ U"\U0000005A\U00000301", 0x00000179 },
-{ U"\U0000007A\U00000301", 0x0000017A },
-{ U"\U0000005A\U00000307", 0x0000017B },
-{ U"\U0000007A\U00000307", 0x0000017C },
-{ U"\U0000005A\U0000030C", 0x0000017D },
-{ U"\U0000007A\U0000030C", 0x0000017E },
-{ U"\U0000004F\U0000031B", 0x000001A0 },
-{ U"\U0000006F\U0000031B", 0x000001A1 },
-{ U"\U00000055\U0000031B", 0x000001AF },
-{ U"\U00000075\U0000031B", 0x000001B0 },
-{ U"\U00000041\U0000030C", 0x000001CD },
-{ U"\U00000061\U0000030C", 0x000001CE },
-{ U"\U00000049\U0000030C", 0x000001CF },
-{ U"\U00000069\U0000030C", 0x000001D0 },
-{ U"\U0000004F\U0000030C", 0x000001D1 },
-{ U"\U0000006F\U0000030C", 0x000001D2 },
-{ U"\U00000055\U0000030C", 0x000001D3 },
-{ U"\U00000075\U0000030C", 0x000001D4 },
-{ U"\U000000DC\U00000304", 0x000001D5 },
-{ U"\U000000FC\U00000304", 0x000001D6 },
-{ U"\U000000DC\U00000301", 0x000001D7 },
-{ U"\U000000FC\U00000301", 0x000001D8 },
-{ U"\U000000DC\U0000030C", 0x000001D9 },
-{ U"\U000000FC\U0000030C", 0x000001DA },
-{ U"\U000000DC\U00000300", 0x000001DB },
-{ U"\U000000FC\U00000300", 0x000001DC },
-{ U"\U000000C4\U00000304", 0x000001DE },
-{ U"\U000000E4\U00000304", 0x000001DF },
-{ U"\U00000226\U00000304", 0x000001E0 },
-{ U"\U00000227\U00000304", 0x000001E1 },
-{ U"\U000000C6\U00000304", 0x000001E2 },
-{ U"\U000000E6\U00000304", 0x000001E3 },
-{ U"\U00000047\U0000030C", 0x000001E6 },
-{ U"\U00000067\U0000030C", 0x000001E7 },
-{ U"\U0000004B\U0000030C", 0x000001E8 },
-{ U"\U0000006B\U0000030C", 0x000001E9 },
-{ U"\U0000004F\U00000328", 0x000001EA },
-{ U"\U0000006F\U00000328", 0x000001EB },
-{ U"\U000001EA\U00000304", 0x000001EC },
-{ U"\U000001EB\U00000304", 0x000001ED },
-{ U"\U000001B7\U0000030C", 0x000001EE },
-{ U"\U00000292\U0000030C", 0x000001EF },
-{ U"\U0000006A\U0000030C", 0x000001F0 },
-{ U"\U00000047\U00000301", 0x000001F4 },
-{ U"\U00000067\U00000301", 0x000001F5 },
-{ U"\U0000004E\U00000300", 0x000001F8 },
-{ U"\U0000006E\U00000300", 0x000001F9 },
-{ U"\U000000C5\U00000301", 0x000001FA },
-{ U"\U000000E5\U00000301", 0x000001FB },
-{ U"\U000000C6\U00000301", 0x000001FC },
-{ U"\U000000E6\U00000301", 0x000001FD },
-{ U"\U000000D8\U00000301", 0x000001FE },
-{ U"\U000000F8\U00000301", 0x000001FF },
-{ U"\U00000041\U0000030F", 0x00000200 },
-{ U"\U00000061\U0000030F", 0x00000201 },
-{ U"\U00000041\U00000311", 0x00000202 },
-{ U"\U00000061\U00000311", 0x00000203 },
-{ U"\U00000045\U0000030F", 0x00000204 },
-{ U"\U00000065\U0000030F", 0x00000205 },
-{ U"\U00000045\U00000311", 0x00000206 },
-{ U"\U00000065\U00000311", 0x00000207 },
-{ U"\U00000049\U0000030F", 0x00000208 },
-{ U"\U00000069\U0000030F", 0x00000209 },
-{ U"\U00000049\U00000311", 0x0000020A },
-{ U"\U00000069\U00000311", 0x0000020B },
-{ U"\U0000004F\U0000030F", 0x0000020C },
-{ U"\U0000006F\U0000030F", 0x0000020D },
-{ U"\U0000004F\U00000311", 0x0000020E },
-{ U"\U0000006F\U00000311", 0x0000020F },
-{ U"\U00000052\U0000030F", 0x00000210 },
-{ U"\U00000072\U0000030F", 0x00000211 },
-{ U"\U00000052\U00000311", 0x00000212 },
-{ U"\U00000072\U00000311", 0x00000213 },
-{ U"\U00000055\U0000030F", 0x00000214 },
-{ U"\U00000075\U0000030F", 0x00000215 },
-{ U"\U00000055\U00000311", 0x00000216 },
-{ U"\U00000075\U00000311", 0x00000217 },
-{ U"\U00000053\U00000326", 0x00000218 },
-{ U"\U00000073\U00000326", 0x00000219 },
-{ U"\U00000054\U00000326", 0x0000021A },
-{ U"\U00000074\U00000326", 0x0000021B },
-{ U"\U00000048\U0000030C", 0x0000021E },
-{ U"\U00000068\U0000030C", 0x0000021F },
-{ U"\U00000041\U00000307", 0x00000226 },
-{ U"\U00000061\U00000307", 0x00000227 },
-{ U"\U00000045\U00000327", 0x00000228 },
-{ U"\U00000065\U00000327", 0x00000229 },
-{ U"\U000000D6\U00000304", 0x0000022A },
-{ U"\U000000F6\U00000304", 0x0000022B },
-{ U"\U000000D5\U00000304", 0x0000022C },
-{ U"\U000000F5\U00000304", 0x0000022D },
-{ U"\U0000004F\U00000307", 0x0000022E },
-{ U"\U0000006F\U00000307", 0x0000022F },
-{ U"\U0000022E\U00000304", 0x00000230 },
-{ U"\U0000022F\U00000304", 0x00000231 },
-{ U"\U00000059\U00000304", 0x00000232 },
-{ U"\U00000079\U00000304", 0x00000233 },
-{ U"\U000000A8\U00000301", 0x00000385 },
-{ U"\U00000391\U00000301", 0x00000386 },
-{ U"\U00000395\U00000301", 0x00000388 },
-{ U"\U00000397\U00000301", 0x00000389 },
-{ U"\U00000399\U00000301", 0x0000038A },
-{ U"\U0000039F\U00000301", 0x0000038C },
-{ U"\U000003A5\U00000301", 0x0000038E },
-{ U"\U000003A9\U00000301", 0x0000038F },
-{ U"\U000003CA\U00000301", 0x00000390 },
-{ U"\U00000399\U00000308", 0x000003AA },
-{ U"\U000003A5\U00000308", 0x000003AB },
-{ U"\U000003B1\U00000301", 0x000003AC },
-{ U"\U000003B5\U00000301", 0x000003AD },
-{ U"\U000003B7\U00000301", 0x000003AE },
-{ U"\U000003B9\U00000301", 0x000003AF },
-{ U"\U000003CB\U00000301", 0x000003B0 },
-{ U"\U000003B9\U00000308", 0x000003CA },
-{ U"\U000003C5\U00000308", 0x000003CB },
-{ U"\U000003BF\U00000301", 0x000003CC },
-{ U"\U000003C5\U00000301", 0x000003CD },
-{ U"\U000003C9\U00000301", 0x000003CE },
-{ U"\U000003D2\U00000301", 0x000003D3 },
-{ U"\U000003D2\U00000308", 0x000003D4 },
-{ U"\U00000415\U00000300", 0x00000400 },
-{ U"\U00000415\U00000308", 0x00000401 },
-{ U"\U00000413\U00000301", 0x00000403 },
-{ U"\U00000406\U00000308", 0x00000407 },
-{ U"\U0000041A\U00000301", 0x0000040C },
-{ U"\U00000418\U00000300", 0x0000040D },
-{ U"\U00000423\U00000306", 0x0000040E },
-{ U"\U00000418\U00000306", 0x00000419 },
-{ U"\U00000438\U00000306", 0x00000439 },
-{ U"\U00000435\U00000300", 0x00000450 },
-{ U"\U00000435\U00000308", 0x00000451 },
-{ U"\U00000433\U00000301", 0x00000453 },
-{ U"\U00000456\U00000308", 0x00000457 },
-{ U"\U0000043A\U00000301", 0x0000045C },
-{ U"\U00000438\U00000300", 0x0000045D },
-{ U"\U00000443\U00000306", 0x0000045E },
-{ U"\U00000474\U0000030F", 0x00000476 },
-{ U"\U00000475\U0000030F", 0x00000477 },
-{ U"\U00000416\U00000306", 0x000004C1 },
-{ U"\U00000436\U00000306", 0x000004C2 },
-{ U"\U00000410\U00000306", 0x000004D0 },
-{ U"\U00000430\U00000306", 0x000004D1 },
-{ U"\U00000410\U00000308", 0x000004D2 },
-{ U"\U00000430\U00000308", 0x000004D3 },
-{ U"\U00000415\U00000306", 0x000004D6 },
-{ U"\U00000435\U00000306", 0x000004D7 },
-{ U"\U000004D8\U00000308", 0x000004DA },
-{ U"\U000004D9\U00000308", 0x000004DB },
-{ U"\U00000416\U00000308", 0x000004DC },
-{ U"\U00000436\U00000308", 0x000004DD },
-{ U"\U00000417\U00000308", 0x000004DE },
-{ U"\U00000437\U00000308", 0x000004DF },
-{ U"\U00000418\U00000304", 0x000004E2 },
-{ U"\U00000438\U00000304", 0x000004E3 },
-{ U"\U00000418\U00000308", 0x000004E4 },
-{ U"\U00000438\U00000308", 0x000004E5 },
-{ U"\U0000041E\U00000308", 0x000004E6 },
-{ U"\U0000043E\U00000308", 0x000004E7 },
-{ U"\U000004E8\U00000308", 0x000004EA },
-{ U"\U000004E9\U00000308", 0x000004EB },
-{ U"\U0000042D\U00000308", 0x000004EC },
-{ U"\U0000044D\U00000308", 0x000004ED },
-{ U"\U00000423\U00000304", 0x000004EE },
-{ U"\U00000443\U00000304", 0x000004EF },
-{ U"\U00000423\U00000308", 0x000004F0 },
-{ U"\U00000443\U00000308", 0x000004F1 },
-{ U"\U00000423\U0000030B", 0x000004F2 },
-{ U"\U00000443\U0000030B", 0x000004F3 },
-{ U"\U00000427\U00000308", 0x000004F4 },
-{ U"\U00000447\U00000308", 0x000004F5 },
-{ U"\U0000042B\U00000308", 0x000004F8 },
-{ U"\U0000044B\U00000308", 0x000004F9 },
-{ U"\U00000627\U00000653", 0x00000622 },
-{ U"\U00000627\U00000654", 0x00000623 },
-{ U"\U00000648\U00000654", 0x00000624 },
-{ U"\U00000627\U00000655", 0x00000625 },
-{ U"\U0000064A\U00000654", 0x00000626 },
-{ U"\U000006D5\U00000654", 0x000006C0 },
-{ U"\U000006C1\U00000654", 0x000006C2 },
-{ U"\U000006D2\U00000654", 0x000006D3 },
-{ U"\U00000928\U0000093C", 0x00000929 },
-{ U"\U00000930\U0000093C", 0x00000931 },
-{ U"\U00000933\U0000093C", 0x00000934 },
-{ U"\U000009C7\U000009BE", 0x000009CB },
-{ U"\U000009C7\U000009D7", 0x000009CC },
-{ U"\U00000B47\U00000B56", 0x00000B48 },
-{ U"\U00000B47\U00000B3E", 0x00000B4B },
-{ U"\U00000B47\U00000B57", 0x00000B4C },
-{ U"\U00000B92\U00000BD7", 0x00000B94 },
-{ U"\U00000BC6\U00000BBE", 0x00000BCA },
-{ U"\U00000BC7\U00000BBE", 0x00000BCB },
-{ U"\U00000BC6\U00000BD7", 0x00000BCC },
-{ U"\U00000C46\U00000C56", 0x00000C48 },
-{ U"\U00000CBF\U00000CD5", 0x00000CC0 },
-{ U"\U00000CC6\U00000CD5", 0x00000CC7 },
-{ U"\U00000CC6\U00000CD6", 0x00000CC8 },
-{ U"\U00000CC6\U00000CC2", 0x00000CCA },
-{ U"\U00000CCA\U00000CD5", 0x00000CCB },
-{ U"\U00000D46\U00000D3E", 0x00000D4A },
-{ U"\U00000D47\U00000D3E", 0x00000D4B },
-{ U"\U00000D46\U00000D57", 0x00000D4C },
-{ U"\U00000DD9\U00000DCA", 0x00000DDA },
-{ U"\U00000DD9\U00000DCF", 0x00000DDC },
-{ U"\U00000DDC\U00000DCA", 0x00000DDD },
-{ U"\U00000DD9\U00000DDF", 0x00000DDE },
-{ U"\U00001025\U0000102E", 0x00001026 },
-{ U"\U00001B05\U00001B35", 0x00001B06 },
-{ U"\U00001B07\U00001B35", 0x00001B08 },
-{ U"\U00001B09\U00001B35", 0x00001B0A },
-{ U"\U00001B0B\U00001B35", 0x00001B0C },
-{ U"\U00001B0D\U00001B35", 0x00001B0E },
-{ U"\U00001B11\U00001B35", 0x00001B12 },
-{ U"\U00001B3A\U00001B35", 0x00001B3B },
-{ U"\U00001B3C\U00001B35", 0x00001B3D },
-{ U"\U00001B3E\U00001B35", 0x00001B40 },
-{ U"\U00001B3F\U00001B35", 0x00001B41 },
-{ U"\U00001B42\U00001B35", 0x00001B43 },
-{ U"\U00000041\U00000325", 0x00001E00 },
-{ U"\U00000061\U00000325", 0x00001E01 },
-{ U"\U00000042\U00000307", 0x00001E02 },
-{ U"\U00000062\U00000307", 0x00001E03 },
-{ U"\U00000042\U00000323", 0x00001E04 },
-{ U"\U00000062\U00000323", 0x00001E05 },
-{ U"\U00000042\U00000331", 0x00001E06 },
-{ U"\U00000062\U00000331", 0x00001E07 },
-{ U"\U000000C7\U00000301", 0x00001E08 },
-{ U"\U000000E7\U00000301", 0x00001E09 },
-{ U"\U00000044\U00000307", 0x00001E0A },
-{ U"\U00000064\U00000307", 0x00001E0B },
-{ U"\U00000044\U00000323", 0x00001E0C },
-{ U"\U00000064\U00000323", 0x00001E0D },
-{ U"\U00000044\U00000331", 0x00001E0E },
-{ U"\U00000064\U00000331", 0x00001E0F },
-{ U"\U00000044\U00000327", 0x00001E10 },
-{ U"\U00000064\U00000327", 0x00001E11 },
-{ U"\U00000044\U0000032D", 0x00001E12 },
-{ U"\U00000064\U0000032D", 0x00001E13 },
-{ U"\U00000112\U00000300", 0x00001E14 },
-{ U"\U00000113\U00000300", 0x00001E15 },
-{ U"\U00000112\U00000301", 0x00001E16 },
-{ U"\U00000113\U00000301", 0x00001E17 },
-{ U"\U00000045\U0000032D", 0x00001E18 },
-{ U"\U00000065\U0000032D", 0x00001E19 },
-{ U"\U00000045\U00000330", 0x00001E1A },
-{ U"\U00000065\U00000330", 0x00001E1B },
-{ U"\U00000228\U00000306", 0x00001E1C },
-{ U"\U00000229\U00000306", 0x00001E1D },
-{ U"\U00000046\U00000307", 0x00001E1E },
-{ U"\U00000066\U00000307", 0x00001E1F },
-{ U"\U00000047\U00000304", 0x00001E20 },
-{ U"\U00000067\U00000304", 0x00001E21 },
-{ U"\U00000048\U00000307", 0x00001E22 },
-{ U"\U00000068\U00000307", 0x00001E23 },
-{ U"\U00000048\U00000323", 0x00001E24 },
-{ U"\U00000068\U00000323", 0x00001E25 },
-{ U"\U00000048\U00000308", 0x00001E26 },
-{ U"\U00000068\U00000308", 0x00001E27 },
-{ U"\U00000048\U00000327", 0x00001E28 },
-{ U"\U00000068\U00000327", 0x00001E29 },
-{ U"\U00000048\U0000032E", 0x00001E2A },
-{ U"\U00000068\U0000032E", 0x00001E2B },
-{ U"\U00000049\U00000330", 0x00001E2C },
-{ U"\U00000069\U00000330", 0x00001E2D },
-{ U"\U000000CF\U00000301", 0x00001E2E },
-{ U"\U000000EF\U00000301", 0x00001E2F },
-{ U"\U0000004B\U00000301", 0x00001E30 },
-{ U"\U0000006B\U00000301", 0x00001E31 },
-{ U"\U0000004B\U00000323", 0x00001E32 },
-{ U"\U0000006B\U00000323", 0x00001E33 },
-{ U"\U0000004B\U00000331", 0x00001E34 },
-{ U"\U0000006B\U00000331", 0x00001E35 },
-{ U"\U0000004C\U00000323", 0x00001E36 },
-{ U"\U0000006C\U00000323", 0x00001E37 },
-{ U"\U00001E36\U00000304", 0x00001E38 },
-{ U"\U00001E37\U00000304", 0x00001E39 },
-{ U"\U0000004C\U00000331", 0x00001E3A },
-{ U"\U0000006C\U00000331", 0x00001E3B },
-{ U"\U0000004C\U0000032D", 0x00001E3C },
-{ U"\U0000006C\U0000032D", 0x00001E3D },
-{ U"\U0000004D\U00000301", 0x00001E3E },
-{ U"\U0000006D\U00000301", 0x00001E3F },
-{ U"\U0000004D\U00000307", 0x00001E40 },
-{ U"\U0000006D\U00000307", 0x00001E41 },
-{ U"\U0000004D\U00000323", 0x00001E42 },
-{ U"\U0000006D\U00000323", 0x00001E43 },
-{ U"\U0000004E\U00000307", 0x00001E44 },
-{ U"\U0000006E\U00000307", 0x00001E45 },
-{ U"\U0000004E\U00000323", 0x00001E46 },
-{ U"\U0000006E\U00000323", 0x00001E47 },
-{ U"\U0000004E\U00000331", 0x00001E48 },
-{ U"\U0000006E\U00000331", 0x00001E49 },
-{ U"\U0000004E\U0000032D", 0x00001E4A },
-{ U"\U0000006E\U0000032D", 0x00001E4B },
-{ U"\U000000D5\U00000301", 0x00001E4C },
-{ U"\U000000F5\U00000301", 0x00001E4D },
-{ U"\U000000D5\U00000308", 0x00001E4E },
-{ U"\U000000F5\U00000308", 0x00001E4F },
-{ U"\U0000014C\U00000300", 0x00001E50 },
-{ U"\U0000014D\U00000300", 0x00001E51 },
-{ U"\U0000014C\U00000301", 0x00001E52 },
-{ U"\U0000014D\U00000301", 0x00001E53 },
-{ U"\U00000050\U00000301", 0x00001E54 },
-{ U"\U00000070\U00000301", 0x00001E55 },
-{ U"\U00000050\U00000307", 0x00001E56 },
-{ U"\U00000070\U00000307", 0x00001E57 },
-{ U"\U00000052\U00000307", 0x00001E58 },
-{ U"\U00000072\U00000307", 0x00001E59 },
-{ U"\U00000052\U00000323", 0x00001E5A },
-{ U"\U00000072\U00000323", 0x00001E5B },
-{ U"\U00001E5A\U00000304", 0x00001E5C },
-{ U"\U00001E5B\U00000304", 0x00001E5D },
-{ U"\U00000052\U00000331", 0x00001E5E },
-{ U"\U00000072\U00000331", 0x00001E5F },
-{ U"\U00000053\U00000307", 0x00001E60 },
-{ U"\U00000073\U00000307", 0x00001E61 },
-{ U"\U00000053\U00000323", 0x00001E62 },
-{ U"\U00000073\U00000323", 0x00001E63 },
-{ U"\U0000015A\U00000307", 0x00001E64 },
-{ U"\U0000015B\U00000307", 0x00001E65 },
-{ U"\U00000160\U00000307", 0x00001E66 },
-{ U"\U00000161\U00000307", 0x00001E67 },
-{ U"\U00001E62\U00000307", 0x00001E68 },
-{ U"\U00001E63\U00000307", 0x00001E69 },
-{ U"\U00000054\U00000307", 0x00001E6A },
-{ U"\U00000074\U00000307", 0x00001E6B },
-{ U"\U00000054\U00000323", 0x00001E6C },
-{ U"\U00000074\U00000323", 0x00001E6D },
-{ U"\U00000054\U00000331", 0x00001E6E },
-{ U"\U00000074\U00000331", 0x00001E6F },
-{ U"\U00000054\U0000032D", 0x00001E70 },
-{ U"\U00000074\U0000032D", 0x00001E71 },
-{ U"\U00000055\U00000324", 0x00001E72 },
-{ U"\U00000075\U00000324", 0x00001E73 },
-{ U"\U00000055\U00000330", 0x00001E74 },
-{ U"\U00000075\U00000330", 0x00001E75 },
-{ U"\U00000055\U0000032D", 0x00001E76 },
-{ U"\U00000075\U0000032D", 0x00001E77 },
-{ U"\U00000168\U00000301", 0x00001E78 },
-{ U"\U00000169\U00000301", 0x00001E79 },
-{ U"\U0000016A\U00000308", 0x00001E7A },
-{ U"\U0000016B\U00000308", 0x00001E7B },
-{ U"\U00000056\U00000303", 0x00001E7C },
-{ U"\U00000076\U00000303", 0x00001E7D },
-{ U"\U00000056\U00000323", 0x00001E7E },
-{ U"\U00000076\U00000323", 0x00001E7F },
-{ U"\U00000057\U00000300", 0x00001E80 },
-{ U"\U00000077\U00000300", 0x00001E81 },
-{ U"\U00000057\U00000301", 0x00001E82 },
-{ U"\U00000077\U00000301", 0x00001E83 },
-{ U"\U00000057\U00000308", 0x00001E84 },
-{ U"\U00000077\U00000308", 0x00001E85 },
-{ U"\U00000057\U00000307", 0x00001E86 },
-{ U"\U00000077\U00000307", 0x00001E87 },
-{ U"\U00000057\U00000323", 0x00001E88 },
-{ U"\U00000077\U00000323", 0x00001E89 },
-{ U"\U00000058\U00000307", 0x00001E8A },
-{ U"\U00000078\U00000307", 0x00001E8B },
-{ U"\U00000058\U00000308", 0x00001E8C },
-{ U"\U00000078\U00000308", 0x00001E8D },
-{ U"\U00000059\U00000307", 0x00001E8E },
-{ U"\U00000079\U00000307", 0x00001E8F },
-{ U"\U0000005A\U00000302", 0x00001E90 },
-{ U"\U0000007A\U00000302", 0x00001E91 },
-{ U"\U0000005A\U00000323", 0x00001E92 },
-{ U"\U0000007A\U00000323", 0x00001E93 },
-{ U"\U0000005A\U00000331", 0x00001E94 },
-{ U"\U0000007A\U00000331", 0x00001E95 },
-{ U"\U00000068\U00000331", 0x00001E96 },
-{ U"\U00000074\U00000308", 0x00001E97 },
-{ U"\U00000077\U0000030A", 0x00001E98 },
-{ U"\U00000079\U0000030A", 0x00001E99 },
-{ U"\U0000017F\U00000307", 0x00001E9B },
-{ U"\U00000041\U00000323", 0x00001EA0 },
-{ U"\U00000061\U00000323", 0x00001EA1 },
-{ U"\U00000041\U00000309", 0x00001EA2 },
-{ U"\U00000061\U00000309", 0x00001EA3 },
-{ U"\U000000C2\U00000301", 0x00001EA4 },
-{ U"\U000000E2\U00000301", 0x00001EA5 },
-{ U"\U000000C2\U00000300", 0x00001EA6 },
-{ U"\U000000E2\U00000300", 0x00001EA7 },
-{ U"\U000000C2\U00000309", 0x00001EA8 },
-{ U"\U000000E2\U00000309", 0x00001EA9 },
-{ U"\U000000C2\U00000303", 0x00001EAA },
-{ U"\U000000E2\U00000303", 0x00001EAB },
-{ U"\U00001EA0\U00000302", 0x00001EAC },
-{ U"\U00001EA1\U00000302", 0x00001EAD },
-{ U"\U00000102\U00000301", 0x00001EAE },
-{ U"\U00000103\U00000301", 0x00001EAF },
-{ U"\U00000102\U00000300", 0x00001EB0 },
-{ U"\U00000103\U00000300", 0x00001EB1 },
-{ U"\U00000102\U00000309", 0x00001EB2 },
-{ U"\U00000103\U00000309", 0x00001EB3 },
-{ U"\U00000102\U00000303", 0x00001EB4 },
-{ U"\U00000103\U00000303", 0x00001EB5 },
-{ U"\U00001EA0\U00000306", 0x00001EB6 },
-{ U"\U00001EA1\U00000306", 0x00001EB7 },
-{ U"\U00000045\U00000323", 0x00001EB8 },
-{ U"\U00000065\U00000323", 0x00001EB9 },
-{ U"\U00000045\U00000309", 0x00001EBA },
-{ U"\U00000065\U00000309", 0x00001EBB },
-{ U"\U00000045\U00000303", 0x00001EBC },
-{ U"\U00000065\U00000303", 0x00001EBD },
-{ U"\U000000CA\U00000301", 0x00001EBE },
-{ U"\U000000EA\U00000301", 0x00001EBF },
-{ U"\U000000CA\U00000300", 0x00001EC0 },
-{ U"\U000000EA\U00000300", 0x00001EC1 },
-{ U"\U000000CA\U00000309", 0x00001EC2 },
-{ U"\U000000EA\U00000309", 0x00001EC3 },
-{ U"\U000000CA\U00000303", 0x00001EC4 },
-{ U"\U000000EA\U00000303", 0x00001EC5 },
-{ U"\U00001EB8\U00000302", 0x00001EC6 },
-{ U"\U00001EB9\U00000302", 0x00001EC7 },
-{ U"\U00000049\U00000309", 0x00001EC8 },
-{ U"\U00000069\U00000309", 0x00001EC9 },
-{ U"\U00000049\U00000323", 0x00001ECA },
-{ U"\U00000069\U00000323", 0x00001ECB },
-{ U"\U0000004F\U00000323", 0x00001ECC },
-{ U"\U0000006F\U00000323", 0x00001ECD },
-{ U"\U0000004F\U00000309", 0x00001ECE },
-{ U"\U0000006F\U00000309", 0x00001ECF },
-{ U"\U000000D4\U00000301", 0x00001ED0 },
-{ U"\U000000F4\U00000301", 0x00001ED1 },
-{ U"\U000000D4\U00000300", 0x00001ED2 },
-{ U"\U000000F4\U00000300", 0x00001ED3 },
-{ U"\U000000D4\U00000309", 0x00001ED4 },
-{ U"\U000000F4\U00000309", 0x00001ED5 },
-{ U"\U000000D4\U00000303", 0x00001ED6 },
-{ U"\U000000F4\U00000303", 0x00001ED7 },
-{ U"\U00001ECC\U00000302", 0x00001ED8 },
-{ U"\U00001ECD\U00000302", 0x00001ED9 },
-{ U"\U000001A0\U00000301", 0x00001EDA },
-{ U"\U000001A1\U00000301", 0x00001EDB },
-{ U"\U000001A0\U00000300", 0x00001EDC },
-{ U"\U000001A1\U00000300", 0x00001EDD },
-{ U"\U000001A0\U00000309", 0x00001EDE },
-{ U"\U000001A1\U00000309", 0x00001EDF },
-{ U"\U000001A0\U00000303", 0x00001EE0 },
-{ U"\U000001A1\U00000303", 0x00001EE1 },
-{ U"\U000001A0\U00000323", 0x00001EE2 },
-{ U"\U000001A1\U00000323", 0x00001EE3 },
-{ U"\U00000055\U00000323", 0x00001EE4 },
-{ U"\U00000075\U00000323", 0x00001EE5 },
-{ U"\U00000055\U00000309", 0x00001EE6 },
-{ U"\U00000075\U00000309", 0x00001EE7 },
-{ U"\U000001AF\U00000301", 0x00001EE8 },
-{ U"\U000001B0\U00000301", 0x00001EE9 },
-{ U"\U000001AF\U00000300", 0x00001EEA },
-{ U"\U000001B0\U00000300", 0x00001EEB },
-{ U"\U000001AF\U00000309", 0x00001EEC },
-{ U"\U000001B0\U00000309", 0x00001EED },
-{ U"\U000001AF\U00000303", 0x00001EEE },
-{ U"\U000001B0\U00000303", 0x00001EEF },
-{ U"\U000001AF\U00000323", 0x00001EF0 },
-{ U"\U000001B0\U00000323", 0x00001EF1 },
-{ U"\U00000059\U00000300", 0x00001EF2 },
-{ U"\U00000079\U00000300", 0x00001EF3 },
-{ U"\U00000059\U00000323", 0x00001EF4 },
-{ U"\U00000079\U00000323", 0x00001EF5 },
-{ U"\U00000059\U00000309", 0x00001EF6 },
-{ U"\U00000079\U00000309", 0x00001EF7 },
-{ U"\U00000059\U00000303", 0x00001EF8 },
-{ U"\U00000079\U00000303", 0x00001EF9 },
-{ U"\U000003B1\U00000313", 0x00001F00 },
-{ U"\U000003B1\U00000314", 0x00001F01 },
-{ U"\U00001F00\U00000300", 0x00001F02 },
-{ U"\U00001F01\U00000300", 0x00001F03 },
-{ U"\U00001F00\U00000301", 0x00001F04 },
-{ U"\U00001F01\U00000301", 0x00001F05 },
-{ U"\U00001F00\U00000342", 0x00001F06 },
-{ U"\U00001F01\U00000342", 0x00001F07 },
-{ U"\U00000391\U00000313", 0x00001F08 },
-{ U"\U00000391\U00000314", 0x00001F09 },
-{ U"\U00001F08\U00000300", 0x00001F0A },
-{ U"\U00001F09\U00000300", 0x00001F0B },
-{ U"\U00001F08\U00000301", 0x00001F0C },
-{ U"\U00001F09\U00000301", 0x00001F0D },
-{ U"\U00001F08\U00000342", 0x00001F0E },
-{ U"\U00001F09\U00000342", 0x00001F0F },
-{ U"\U000003B5\U00000313", 0x00001F10 },
-{ U"\U000003B5\U00000314", 0x00001F11 },
-{ U"\U00001F10\U00000300", 0x00001F12 },
-{ U"\U00001F11\U00000300", 0x00001F13 },
-{ U"\U00001F10\U00000301", 0x00001F14 },
-{ U"\U00001F11\U00000301", 0x00001F15 },
-{ U"\U00000395\U00000313", 0x00001F18 },
-{ U"\U00000395\U00000314", 0x00001F19 },
-{ U"\U00001F18\U00000300", 0x00001F1A },
-{ U"\U00001F19\U00000300", 0x00001F1B },
-{ U"\U00001F18\U00000301", 0x00001F1C },
-{ U"\U00001F19\U00000301", 0x00001F1D },
-{ U"\U000003B7\U00000313", 0x00001F20 },
-{ U"\U000003B7\U00000314", 0x00001F21 },
-{ U"\U00001F20\U00000300", 0x00001F22 },
-{ U"\U00001F21\U00000300", 0x00001F23 },
-{ U"\U00001F20\U00000301", 0x00001F24 },
-{ U"\U00001F21\U00000301", 0x00001F25 },
-{ U"\U00001F20\U00000342", 0x00001F26 },
-{ U"\U00001F21\U00000342", 0x00001F27 },
-{ U"\U00000397\U00000313", 0x00001F28 },
-{ U"\U00000397\U00000314", 0x00001F29 },
-{ U"\U00001F28\U00000300", 0x00001F2A },
-{ U"\U00001F29\U00000300", 0x00001F2B },
-{ U"\U00001F28\U00000301", 0x00001F2C },
-{ U"\U00001F29\U00000301", 0x00001F2D },
-{ U"\U00001F28\U00000342", 0x00001F2E },
-{ U"\U00001F29\U00000342", 0x00001F2F },
-{ U"\U000003B9\U00000313", 0x00001F30 },
-{ U"\U000003B9\U00000314", 0x00001F31 },
-{ U"\U00001F30\U00000300", 0x00001F32 },
-{ U"\U00001F31\U00000300", 0x00001F33 },
-{ U"\U00001F30\U00000301", 0x00001F34 },
-{ U"\U00001F31\U00000301", 0x00001F35 },
-{ U"\U00001F30\U00000342", 0x00001F36 },
-{ U"\U00001F31\U00000342", 0x00001F37 },
-{ U"\U00000399\U00000313", 0x00001F38 },
-{ U"\U00000399\U00000314", 0x00001F39 },
-{ U"\U00001F38\U00000300", 0x00001F3A },
-{ U"\U00001F39\U00000300", 0x00001F3B },
-{ U"\U00001F38\U00000301", 0x00001F3C },
-{ U"\U00001F39\U00000301", 0x00001F3D },
-{ U"\U00001F38\U00000342", 0x00001F3E },
-{ U"\U00001F39\U00000342", 0x00001F3F },
-{ U"\U000003BF\U00000313", 0x00001F40 },
-{ U"\U000003BF\U00000314", 0x00001F41 },
-{ U"\U00001F40\U00000300", 0x00001F42 },
-{ U"\U00001F41\U00000300", 0x00001F43 },
-{ U"\U00001F40\U00000301", 0x00001F44 },
-{ U"\U00001F41\U00000301", 0x00001F45 },
-{ U"\U0000039F\U00000313", 0x00001F48 },
-{ U"\U0000039F\U00000314", 0x00001F49 },
-{ U"\U00001F48\U00000300", 0x00001F4A },
-{ U"\U00001F49\U00000300", 0x00001F4B },
-{ U"\U00001F48\U00000301", 0x00001F4C },
-{ U"\U00001F49\U00000301", 0x00001F4D },
-{ U"\U000003C5\U00000313", 0x00001F50 },
-{ U"\U000003C5\U00000314", 0x00001F51 },
-{ U"\U00001F50\U00000300", 0x00001F52 },
-{ U"\U00001F51\U00000300", 0x00001F53 },
-{ U"\U00001F50\U00000301", 0x00001F54 },
-{ U"\U00001F51\U00000301", 0x00001F55 },
-{ U"\U00001F50\U00000342", 0x00001F56 },
-{ U"\U00001F51\U00000342", 0x00001F57 },
-{ U"\U000003A5\U00000314", 0x00001F59 },
-{ U"\U00001F59\U00000300", 0x00001F5B },
-{ U"\U00001F59\U00000301", 0x00001F5D },
-{ U"\U00001F59\U00000342", 0x00001F5F },
-{ U"\U000003C9\U00000313", 0x00001F60 },
-{ U"\U000003C9\U00000314", 0x00001F61 },
-{ U"\U00001F60\U00000300", 0x00001F62 },
-{ U"\U00001F61\U00000300", 0x00001F63 },
-{ U"\U00001F60\U00000301", 0x00001F64 },
-{ U"\U00001F61\U00000301", 0x00001F65 },
-{ U"\U00001F60\U00000342", 0x00001F66 },
-{ U"\U00001F61\U00000342", 0x00001F67 },
-{ U"\U000003A9\U00000313", 0x00001F68 },
-{ U"\U000003A9\U00000314", 0x00001F69 },
-{ U"\U00001F68\U00000300", 0x00001F6A },
-{ U"\U00001F69\U00000300", 0x00001F6B },
-{ U"\U00001F68\U00000301", 0x00001F6C },
-{ U"\U00001F69\U00000301", 0x00001F6D },
-{ U"\U00001F68\U00000342", 0x00001F6E },
-{ U"\U00001F69\U00000342", 0x00001F6F },
-{ U"\U000003B1\U00000300", 0x00001F70 },
-{ U"\U000003B5\U00000300", 0x00001F72 },
-{ U"\U000003B7\U00000300", 0x00001F74 },
-{ U"\U000003B9\U00000300", 0x00001F76 },
-{ U"\U000003BF\U00000300", 0x00001F78 },
-{ U"\U000003C5\U00000300", 0x00001F7A },
-{ U"\U000003C9\U00000300", 0x00001F7C },
-{ U"\U00001F00\U00000345", 0x00001F80 },
-{ U"\U00001F01\U00000345", 0x00001F81 },
-{ U"\U00001F02\U00000345", 0x00001F82 },
-{ U"\U00001F03\U00000345", 0x00001F83 },
-{ U"\U00001F04\U00000345", 0x00001F84 },
-{ U"\U00001F05\U00000345", 0x00001F85 },
-{ U"\U00001F06\U00000345", 0x00001F86 },
-{ U"\U00001F07\U00000345", 0x00001F87 },
-{ U"\U00001F08\U00000345", 0x00001F88 },
-{ U"\U00001F09\U00000345", 0x00001F89 },
-{ U"\U00001F0A\U00000345", 0x00001F8A },
-{ U"\U00001F0B\U00000345", 0x00001F8B },
-{ U"\U00001F0C\U00000345", 0x00001F8C },
-{ U"\U00001F0D\U00000345", 0x00001F8D },
-{ U"\U00001F0E\U00000345", 0x00001F8E },
-{ U"\U00001F0F\U00000345", 0x00001F8F },
-{ U"\U00001F20\U00000345", 0x00001F90 },
-{ U"\U00001F21\U00000345", 0x00001F91 },
-{ U"\U00001F22\U00000345", 0x00001F92 },
-{ U"\U00001F23\U00000345", 0x00001F93 },
-{ U"\U00001F24\U00000345", 0x00001F94 },
-{ U"\U00001F25\U00000345", 0x00001F95 },
-{ U"\U00001F26\U00000345", 0x00001F96 },
-{ U"\U00001F27\U00000345", 0x00001F97 },
-{ U"\U00001F28\U00000345", 0x00001F98 },
-{ U"\U00001F29\U00000345", 0x00001F99 },
-{ U"\U00001F2A\U00000345", 0x00001F9A },
-{ U"\U00001F2B\U00000345", 0x00001F9B },
-{ U"\U00001F2C\U00000345", 0x00001F9C },
-{ U"\U00001F2D\U00000345", 0x00001F9D },
-{ U"\U00001F2E\U00000345", 0x00001F9E },
-{ U"\U00001F2F\U00000345", 0x00001F9F },
-{ U"\U00001F60\U00000345", 0x00001FA0 },
-{ U"\U00001F61\U00000345", 0x00001FA1 },
-{ U"\U00001F62\U00000345", 0x00001FA2 },
-{ U"\U00001F63\U00000345", 0x00001FA3 },
-{ U"\U00001F64\U00000345", 0x00001FA4 },
-{ U"\U00001F65\U00000345", 0x00001FA5 },
-{ U"\U00001F66\U00000345", 0x00001FA6 },
-{ U"\U00001F67\U00000345", 0x00001FA7 },
-{ U"\U00001F68\U00000345", 0x00001FA8 },
-{ U"\U00001F69\U00000345", 0x00001FA9 },
-{ U"\U00001F6A\U00000345", 0x00001FAA },
-{ U"\U00001F6B\U00000345", 0x00001FAB },
-{ U"\U00001F6C\U00000345", 0x00001FAC },
-{ U"\U00001F6D\U00000345", 0x00001FAD },
-{ U"\U00001F6E\U00000345", 0x00001FAE },
-{ U"\U00001F6F\U00000345", 0x00001FAF },
-{ U"\U000003B1\U00000306", 0x00001FB0 },
-{ U"\U000003B1\U00000304", 0x00001FB1 },
-{ U"\U00001F70\U00000345", 0x00001FB2 },
-{ U"\U000003B1\U00000345", 0x00001FB3 },
-{ U"\U000003AC\U00000345", 0x00001FB4 },
-{ U"\U000003B1\U00000342", 0x00001FB6 },
-{ U"\U00001FB6\U00000345", 0x00001FB7 },
-{ U"\U00000391\U00000306", 0x00001FB8 },
-{ U"\U00000391\U00000304", 0x00001FB9 },
-{ U"\U00000391\U00000300", 0x00001FBA },
-{ U"\U00000391\U00000345", 0x00001FBC },
-{ U"\U000000A8\U00000342", 0x00001FC1 },
-{ U"\U00001F74\U00000345", 0x00001FC2 },
-{ U"\U000003B7\U00000345", 0x00001FC3 },
-{ U"\U000003AE\U00000345", 0x00001FC4 },
-{ U"\U000003B7\U00000342", 0x00001FC6 },
-{ U"\U00001FC6\U00000345", 0x00001FC7 },
-{ U"\U00000395\U00000300", 0x00001FC8 },
-{ U"\U00000397\U00000300", 0x00001FCA },
-{ U"\U00000397\U00000345", 0x00001FCC },
-{ U"\U00001FBF\U00000300", 0x00001FCD },
-{ U"\U00001FBF\U00000301", 0x00001FCE },
-{ U"\U00001FBF\U00000342", 0x00001FCF },
-{ U"\U000003B9\U00000306", 0x00001FD0 },
-{ U"\U000003B9\U00000304", 0x00001FD1 },
-{ U"\U000003CA\U00000300", 0x00001FD2 },
-{ U"\U000003B9\U00000342", 0x00001FD6 },
-{ U"\U000003CA\U00000342", 0x00001FD7 },
-{ U"\U00000399\U00000306", 0x00001FD8 },
-{ U"\U00000399\U00000304", 0x00001FD9 },
-{ U"\U00000399\U00000300", 0x00001FDA },
-{ U"\U00001FFE\U00000300", 0x00001FDD },
-{ U"\U00001FFE\U00000301", 0x00001FDE },
-{ U"\U00001FFE\U00000342", 0x00001FDF },
-{ U"\U000003C5\U00000306", 0x00001FE0 },
-{ U"\U000003C5\U00000304", 0x00001FE1 },
-{ U"\U000003CB\U00000300", 0x00001FE2 },
-{ U"\U000003C1\U00000313", 0x00001FE4 },
-{ U"\U000003C1\U00000314", 0x00001FE5 },
-{ U"\U000003C5\U00000342", 0x00001FE6 },
-{ U"\U000003CB\U00000342", 0x00001FE7 },
-{ U"\U000003A5\U00000306", 0x00001FE8 },
-{ U"\U000003A5\U00000304", 0x00001FE9 },
-{ U"\U000003A5\U00000300", 0x00001FEA },
-{ U"\U000003A1\U00000314", 0x00001FEC },
-{ U"\U000000A8\U00000300", 0x00001FED },
-{ U"\U00001F7C\U00000345", 0x00001FF2 },
-{ U"\U000003C9\U00000345", 0x00001FF3 },
-{ U"\U000003CE\U00000345", 0x00001FF4 },
-{ U"\U000003C9\U00000342", 0x00001FF6 },
-{ U"\U00001FF6\U00000345", 0x00001FF7 },
-{ U"\U0000039F\U00000300", 0x00001FF8 },
-{ U"\U000003A9\U00000300", 0x00001FFA },
-{ U"\U000003A9\U00000345", 0x00001FFC },
-{ U"\U00002190\U00000338", 0x0000219A },
-{ U"\U00002192\U00000338", 0x0000219B },
-{ U"\U00002194\U00000338", 0x000021AE },
-{ U"\U000021D0\U00000338", 0x000021CD },
-{ U"\U000021D4\U00000338", 0x000021CE },
-{ U"\U000021D2\U00000338", 0x000021CF },
-{ U"\U00002203\U00000338", 0x00002204 },
-{ U"\U00002208\U00000338", 0x00002209 },
-{ U"\U0000220B\U00000338", 0x0000220C },
-{ U"\U00002223\U00000338", 0x00002224 },
-{ U"\U00002225\U00000338", 0x00002226 },
-{ U"\U0000223C\U00000338", 0x00002241 },
-{ U"\U00002243\U00000338", 0x00002244 },
-{ U"\U00002245\U00000338", 0x00002247 },
-{ U"\U00002248\U00000338", 0x00002249 },
-{ U"\U0000003D\U00000338", 0x00002260 },
-{ U"\U00002261\U00000338", 0x00002262 },
-{ U"\U0000224D\U00000338", 0x0000226D },
-{ U"\U0000003C\U00000338", 0x0000226E },
-{ U"\U0000003E\U00000338", 0x0000226F },
-{ U"\U00002264\U00000338", 0x00002270 },
-{ U"\U00002265\U00000338", 0x00002271 },
-{ U"\U00002272\U00000338", 0x00002274 },
-{ U"\U00002273\U00000338", 0x00002275 },
-{ U"\U00002276\U00000338", 0x00002278 },
-{ U"\U00002277\U00000338", 0x00002279 },
-{ U"\U0000227A\U00000338", 0x00002280 },
-{ U"\U0000227B\U00000338", 0x00002281 },
-{ U"\U00002282\U00000338", 0x00002284 },
-{ U"\U00002283\U00000338", 0x00002285 },
-{ U"\U00002286\U00000338", 0x00002288 },
-{ U"\U00002287\U00000338", 0x00002289 },
-{ U"\U000022A2\U00000338", 0x000022AC },
-{ U"\U000022A8\U00000338", 0x000022AD },
-{ U"\U000022A9\U00000338", 0x000022AE },
-{ U"\U000022AB\U00000338", 0x000022AF },
-{ U"\U0000227C\U00000338", 0x000022E0 },
-{ U"\U0000227D\U00000338", 0x000022E1 },
-{ U"\U00002291\U00000338", 0x000022E2 },
-{ U"\U00002292\U00000338", 0x000022E3 },
-{ U"\U000022B2\U00000338", 0x000022EA },
-{ U"\U000022B3\U00000338", 0x000022EB },
-{ U"\U000022B4\U00000338", 0x000022EC },
-{ U"\U000022B5\U00000338", 0x000022ED },
-{ U"\U0000304B\U00003099", 0x0000304C },
-{ U"\U0000304D\U00003099", 0x0000304E },
-{ U"\U0000304F\U00003099", 0x00003050 },
-{ U"\U00003051\U00003099", 0x00003052 },
-{ U"\U00003053\U00003099", 0x00003054 },
-{ U"\U00003055\U00003099", 0x00003056 },
-{ U"\U00003057\U00003099", 0x00003058 },
-{ U"\U00003059\U00003099", 0x0000305A },
-{ U"\U0000305B\U00003099", 0x0000305C },
-{ U"\U0000305D\U00003099", 0x0000305E },
-{ U"\U0000305F\U00003099", 0x00003060 },
-{ U"\U00003061\U00003099", 0x00003062 },
-{ U"\U00003064\U00003099", 0x00003065 },
-{ U"\U00003066\U00003099", 0x00003067 },
-{ U"\U00003068\U00003099", 0x00003069 },
-{ U"\U0000306F\U00003099", 0x00003070 },
-{ U"\U0000306F\U0000309A", 0x00003071 },
-{ U"\U00003072\U00003099", 0x00003073 },
-{ U"\U00003072\U0000309A", 0x00003074 },
-{ U"\U00003075\U00003099", 0x00003076 },
-{ U"\U00003075\U0000309A", 0x00003077 },
-{ U"\U00003078\U00003099", 0x00003079 },
-{ U"\U00003078\U0000309A", 0x0000307A },
-{ U"\U0000307B\U00003099", 0x0000307C },
-{ U"\U0000307B\U0000309A", 0x0000307D },
-{ U"\U00003046\U00003099", 0x00003094 },
-{ U"\U0000309D\U00003099", 0x0000309E },
-{ U"\U000030AB\U00003099", 0x000030AC },
-{ U"\U000030AD\U00003099", 0x000030AE },
-{ U"\U000030AF\U00003099", 0x000030B0 },
-{ U"\U000030B1\U00003099", 0x000030B2 },
-{ U"\U000030B3\U00003099", 0x000030B4 },
-{ U"\U000030B5\U00003099", 0x000030B6 },
-{ U"\U000030B7\U00003099", 0x000030B8 },
-{ U"\U000030B9\U00003099", 0x000030BA },
-{ U"\U000030BB\U00003099", 0x000030BC },
-{ U"\U000030BD\U00003099", 0x000030BE },
-{ U"\U000030BF\U00003099", 0x000030C0 },
-{ U"\U000030C1\U00003099", 0x000030C2 },
-{ U"\U000030C4\U00003099", 0x000030C5 },
-{ U"\U000030C6\U00003099", 0x000030C7 },
-{ U"\U000030C8\U00003099", 0x000030C9 },
-{ U"\U000030CF\U00003099", 0x000030D0 },
-{ U"\U000030CF\U0000309A", 0x000030D1 },
-{ U"\U000030D2\U00003099", 0x000030D3 },
-{ U"\U000030D2\U0000309A", 0x000030D4 },
-{ U"\U000030D5\U00003099", 0x000030D6 },
-{ U"\U000030D5\U0000309A", 0x000030D7 },
-{ U"\U000030D8\U00003099", 0x000030D9 },
-{ U"\U000030D8\U0000309A", 0x000030DA },
-{ U"\U000030DB\U00003099", 0x000030DC },
-{ U"\U000030DB\U0000309A", 0x000030DD },
-{ U"\U000030A6\U00003099", 0x000030F4 },
-{ U"\U000030EF\U00003099", 0x000030F7 },
-{ U"\U000030F0\U00003099", 0x000030F8 },
-{ U"\U000030F1\U00003099", 0x000030F9 },
-{ U"\U000030F2\U00003099", 0x000030FA },
-{ U"\U000030FD\U00003099", 0x000030FE },
-{ U"\U00011099\U000110BA", 0x0001109A },
-{ U"\U0001109B\U000110BA", 0x0001109C },
-{ U"\U000110A5\U000110BA", 0x000110AB },
-{ U"\U00011131\U00011127", 0x0001112E },
-{ U"\U00011132\U00011127", 0x0001112F },
-{ U"\U00011347\U0001133E", 0x0001134B },
-{ U"\U00011347\U00011357", 0x0001134C },
-{ U"\U000114B9\U000114BA", 0x000114BB },
-{ U"\U000114B9\U000114B0", 0x000114BC },
-{ U"\U000114B9\U000114BD", 0x000114BE },
-{ U"\U000115B8\U000115AF", 0x000115BA },
-{ U"\U000115B9\U000115AF", 0x000115BB },
-{ U"\U00011935\U00011930", 0x00011938 },
+const char32_t _normalization_composition_pairs[] = {
+0x00000000, 0x00000338, 0x0000226E, 0x00000000, 0x00000338, 0x00002260,
+0x00000000, 0x00000338, 0x0000226F, 0x00000000, 0x00000300, 0x000000C0,
+0x00000301, 0x000000C1, 0x00000302, 0x000000C2, 0x00000303, 0x000000C3,
+0x00000304, 0x00000100, 0x00000306, 0x00000102, 0x00000307, 0x00000226,
+0x00000308, 0x000000C4, 0x00000309, 0x00001EA2, 0x0000030A, 0x000000C5,
+0x0000030C, 0x000001CD, 0x0000030F, 0x00000200, 0x00000311, 0x00000202,
+0x00000323, 0x00001EA0, 0x00000325, 0x00001E00, 0x00000328, 0x00000104,
+0x00000000, 0x00000307, 0x00001E02, 0x00000323, 0x00001E04, 0x00000331,
+0x00001E06, 0x00000000, 0x00000301, 0x00000106, 0x00000302, 0x00000108,
+0x00000307, 0x0000010A, 0x0000030C, 0x0000010C, 0x00000327, 0x000000C7,
+0x00000000, 0x00000307, 0x00001E0A, 0x0000030C, 0x0000010E, 0x00000323,
+0x00001E0C, 0x00000327, 0x00001E10, 0x0000032D, 0x00001E12, 0x00000331,
+0x00001E0E, 0x00000000, 0x00000300, 0x000000C8, 0x00000301, 0x000000C9,
+0x00000302, 0x000000CA, 0x00000303, 0x00001EBC, 0x00000304, 0x00000112,
+0x00000306, 0x00000114, 0x00000307, 0x00000116, 0x00000308, 0x000000CB,
+0x00000309, 0x00001EBA, 0x0000030C, 0x0000011A, 0x0000030F, 0x00000204,
+0x00000311, 0x00000206, 0x00000323, 0x00001EB8, 0x00000327, 0x00000228,
+0x00000328, 0x00000118, 0x0000032D, 0x00001E18, 0x00000330, 0x00001E1A,
+0x00000000, 0x00000307, 0x00001E1E, 0x00000000, 0x00000301, 0x000001F4,
+0x00000302, 0x0000011C, 0x00000304, 0x00001E20, 0x00000306, 0x0000011E,
+0x00000307, 0x00000120, 0x0000030C, 0x000001E6, 0x00000327, 0x00000122,
+0x00000000, 0x00000302, 0x00000124, 0x00000307, 0x00001E22, 0x00000308,
+0x00001E26, 0x0000030C, 0x0000021E, 0x00000323, 0x00001E24, 0x00000327,
+0x00001E28, 0x0000032E, 0x00001E2A, 0x00000000, 0x00000300, 0x000000CC,
+0x00000301, 0x000000CD, 0x00000302, 0x000000CE, 0x00000303, 0x00000128,
+0x00000304, 0x0000012A, 0x00000306, 0x0000012C, 0x00000307, 0x00000130,
+0x00000308, 0x000000CF, 0x00000309, 0x00001EC8, 0x0000030C, 0x000001CF,
+0x0000030F, 0x00000208, 0x00000311, 0x0000020A, 0x00000323, 0x00001ECA,
+0x00000328, 0x0000012E, 0x00000330, 0x00001E2C, 0x00000000, 0x00000302,
+0x00000134, 0x00000000, 0x00000301, 0x00001E30, 0x0000030C, 0x000001E8,
+0x00000323, 0x00001E32, 0x00000327, 0x00000136, 0x00000331, 0x00001E34,
+0x00000000, 0x00000301, 0x00000139, 0x0000030C, 0x0000013D, 0x00000323,
+0x00001E36, 0x00000327, 0x0000013B, 0x0000032D, 0x00001E3C, 0x00000331,
+0x00001E3A, 0x00000000, 0x00000301, 0x00001E3E, 0x00000307, 0x00001E40,
+0x00000323, 0x00001E42, 0x00000000, 0x00000300, 0x000001F8, 0x00000301,
+0x00000143, 0x00000303, 0x000000D1, 0x00000307, 0x00001E44, 0x0000030C,
+0x00000147, 0x00000323, 0x00001E46, 0x00000327, 0x00000145, 0x0000032D,
+0x00001E4A, 0x00000331, 0x00001E48, 0x00000000, 0x00000300, 0x000000D2,
+0x00000301, 0x000000D3, 0x00000302, 0x000000D4, 0x00000303, 0x000000D5,
+0x00000304, 0x0000014C, 0x00000306, 0x0000014E, 0x00000307, 0x0000022E,
+0x00000308, 0x000000D6, 0x00000309, 0x00001ECE, 0x0000030B, 0x00000150,
+0x0000030C, 0x000001D1, 0x0000030F, 0x0000020C, 0x00000311, 0x0000020E,
+0x0000031B, 0x000001A0, 0x00000323, 0x00001ECC, 0x00000328, 0x000001EA,
+0x00000000, 0x00000301, 0x00001E54, 0x00000307, 0x00001E56, 0x00000000,
+0x00000301, 0x00000154, 0x00000307, 0x00001E58, 0x0000030C, 0x00000158,
+0x0000030F, 0x00000210, 0x00000311, 0x00000212, 0x00000323, 0x00001E5A,
+0x00000327, 0x00000156, 0x00000331, 0x00001E5E, 0x00000000, 0x00000301,
+0x0000015A, 0x00000302, 0x0000015C, 0x00000307, 0x00001E60, 0x0000030C,
+0x00000160, 0x00000323, 0x00001E62, 0x00000326, 0x00000218, 0x00000327,
+0x0000015E, 0x00000000, 0x00000307, 0x00001E6A, 0x0000030C, 0x00000164,
+0x00000323, 0x00001E6C, 0x00000326, 0x0000021A, 0x00000327, 0x00000162,
+0x0000032D, 0x00001E70, 0x00000331, 0x00001E6E, 0x00000000, 0x00000300,
+0x000000D9, 0x00000301, 0x000000DA, 0x00000302, 0x000000DB, 0x00000303,
+0x00000168, 0x00000304, 0x0000016A, 0x00000306, 0x0000016C, 0x00000308,
+0x000000DC, 0x00000309, 0x00001EE6, 0x0000030A, 0x0000016E, 0x0000030B,
+0x00000170, 0x0000030C, 0x000001D3, 0x0000030F, 0x00000214, 0x00000311,
+0x00000216, 0x0000031B, 0x000001AF, 0x00000323, 0x00001EE4, 0x00000324,
+0x00001E72, 0x00000328, 0x00000172, 0x0000032D, 0x00001E76, 0x00000330,
+0x00001E74, 0x00000000, 0x00000303, 0x00001E7C, 0x00000323, 0x00001E7E,
+0x00000000, 0x00000300, 0x00001E80, 0x00000301, 0x00001E82, 0x00000302,
+0x00000174, 0x00000307, 0x00001E86, 0x00000308, 0x00001E84, 0x00000323,
+0x00001E88, 0x00000000, 0x00000307, 0x00001E8A, 0x00000308, 0x00001E8C,
+0x00000000, 0x00000300, 0x00001EF2, 0x00000301, 0x000000DD, 0x00000302,
+0x00000176, 0x00000303, 0x00001EF8, 0x00000304, 0x00000232, 0x00000307,
+0x00001E8E, 0x00000308, 0x00000178, 0x00000309, 0x00001EF6, 0x00000323,
+0x00001EF4, 0x00000000, 0x00000301, 0x00000179, 0x00000302, 0x00001E90,
+0x00000307, 0x0000017B, 0x0000030C, 0x0000017D, 0x00000323, 0x00001E92,
+0x00000331, 0x00001E94, 0x00000000, 0x00000300, 0x000000E0, 0x00000301,
+0x000000E1, 0x00000302, 0x000000E2, 0x00000303, 0x000000E3, 0x00000304,
+0x00000101, 0x00000306, 0x00000103, 0x00000307, 0x00000227, 0x00000308,
+0x000000E4, 0x00000309, 0x00001EA3, 0x0000030A, 0x000000E5, 0x0000030C,
+0x000001CE, 0x0000030F, 0x00000201, 0x00000311, 0x00000203, 0x00000323,
+0x00001EA1, 0x00000325, 0x00001E01, 0x00000328, 0x00000105, 0x00000000,
+0x00000307, 0x00001E03, 0x00000323, 0x00001E05, 0x00000331, 0x00001E07,
+0x00000000, 0x00000301, 0x00000107, 0x00000302, 0x00000109, 0x00000307,
+0x0000010B, 0x0000030C, 0x0000010D, 0x00000327, 0x000000E7, 0x00000000,
+0x00000307, 0x00001E0B, 0x0000030C, 0x0000010F, 0x00000323, 0x00001E0D,
+0x00000327, 0x00001E11, 0x0000032D, 0x00001E13, 0x00000331, 0x00001E0F,
+0x00000000, 0x00000300, 0x000000E8, 0x00000301, 0x000000E9, 0x00000302,
+0x000000EA, 0x00000303, 0x00001EBD, 0x00000304, 0x00000113, 0x00000306,
+0x00000115, 0x00000307, 0x00000117, 0x00000308, 0x000000EB, 0x00000309,
+0x00001EBB, 0x0000030C, 0x0000011B, 0x0000030F, 0x00000205, 0x00000311,
+0x00000207, 0x00000323, 0x00001EB9, 0x00000327, 0x00000229, 0x00000328,
+0x00000119, 0x0000032D, 0x00001E19, 0x00000330, 0x00001E1B, 0x00000000,
+0x00000307, 0x00001E1F, 0x00000000, 0x00000301, 0x000001F5, 0x00000302,
+0x0000011D, 0x00000304, 0x00001E21, 0x00000306, 0x0000011F, 0x00000307,
+0x00000121, 0x0000030C, 0x000001E7, 0x00000327, 0x00000123, 0x00000000,
+0x00000302, 0x00000125, 0x00000307, 0x00001E23, 0x00000308, 0x00001E27,
+0x0000030C, 0x0000021F, 0x00000323, 0x00001E25, 0x00000327, 0x00001E29,
+0x0000032E, 0x00001E2B, 0x00000331, 0x00001E96, 0x00000000, 0x00000300,
+0x000000EC, 0x00000301, 0x000000ED, 0x00000302, 0x000000EE, 0x00000303,
+0x00000129, 0x00000304, 0x0000012B, 0x00000306, 0x0000012D, 0x00000308,
+0x000000EF, 0x00000309, 0x00001EC9, 0x0000030C, 0x000001D0, 0x0000030F,
+0x00000209, 0x00000311, 0x0000020B, 0x00000323, 0x00001ECB, 0x00000328,
+0x0000012F, 0x00000330, 0x00001E2D, 0x00000000, 0x00000302, 0x00000135,
+0x0000030C, 0x000001F0, 0x00000000, 0x00000301, 0x00001E31, 0x0000030C,
+0x000001E9, 0x00000323, 0x00001E33, 0x00000327, 0x00000137, 0x00000331,
+0x00001E35, 0x00000000, 0x00000301, 0x0000013A, 0x0000030C, 0x0000013E,
+0x00000323, 0x00001E37, 0x00000327, 0x0000013C, 0x0000032D, 0x00001E3D,
+0x00000331, 0x00001E3B, 0x00000000, 0x00000301, 0x00001E3F, 0x00000307,
+0x00001E41, 0x00000323, 0x00001E43, 0x00000000, 0x00000300, 0x000001F9,
+0x00000301, 0x00000144, 0x00000303, 0x000000F1, 0x00000307, 0x00001E45,
+0x0000030C, 0x00000148, 0x00000323, 0x00001E47, 0x00000327, 0x00000146,
+0x0000032D, 0x00001E4B, 0x00000331, 0x00001E49, 0x00000000, 0x00000300,
+0x000000F2, 0x00000301, 0x000000F3, 0x00000302, 0x000000F4, 0x00000303,
+0x000000F5, 0x00000304, 0x0000014D, 0x00000306, 0x0000014F, 0x00000307,
+0x0000022F, 0x00000308, 0x000000F6, 0x00000309, 0x00001ECF, 0x0000030B,
+0x00000151, 0x0000030C, 0x000001D2, 0x0000030F, 0x0000020D, 0x00000311,
+0x0000020F, 0x0000031B, 0x000001A1, 0x00000323, 0x00001ECD, 0x00000328,
+0x000001EB, 0x00000000, 0x00000301, 0x00001E55, 0x00000307, 0x00001E57,
+0x00000000, 0x00000301, 0x00000155, 0x00000307, 0x00001E59, 0x0000030C,
+0x00000159, 0x0000030F, 0x00000211, 0x00000311, 0x00000213, 0x00000323,
+0x00001E5B, 0x00000327, 0x00000157, 0x00000331, 0x00001E5F, 0x00000000,
+0x00000301, 0x0000015B, 0x00000302, 0x0000015D, 0x00000307, 0x00001E61,
+0x0000030C, 0x00000161, 0x00000323, 0x00001E63, 0x00000326, 0x00000219,
+0x00000327, 0x0000015F, 0x00000000, 0x00000307, 0x00001E6B, 0x00000308,
+0x00001E97, 0x0000030C, 0x00000165, 0x00000323, 0x00001E6D, 0x00000326,
+0x0000021B, 0x00000327, 0x00000163, 0x0000032D, 0x00001E71, 0x00000331,
+0x00001E6F, 0x00000000, 0x00000300, 0x000000F9, 0x00000301, 0x000000FA,
+0x00000302, 0x000000FB, 0x00000303, 0x00000169, 0x00000304, 0x0000016B,
+0x00000306, 0x0000016D, 0x00000308, 0x000000FC, 0x00000309, 0x00001EE7,
+0x0000030A, 0x0000016F, 0x0000030B, 0x00000171, 0x0000030C, 0x000001D4,
+0x0000030F, 0x00000215, 0x00000311, 0x00000217, 0x0000031B, 0x000001B0,
+0x00000323, 0x00001EE5, 0x00000324, 0x00001E73, 0x00000328, 0x00000173,
+0x0000032D, 0x00001E77, 0x00000330, 0x00001E75, 0x00000000, 0x00000303,
+0x00001E7D, 0x00000323, 0x00001E7F, 0x00000000, 0x00000300, 0x00001E81,
+0x00000301, 0x00001E83, 0x00000302, 0x00000175, 0x00000307, 0x00001E87,
+0x00000308, 0x00001E85, 0x0000030A, 0x00001E98, 0x00000323, 0x00001E89,
+0x00000000, 0x00000307, 0x00001E8B, 0x00000308, 0x00001E8D, 0x00000000,
+0x00000300, 0x00001EF3, 0x00000301, 0x000000FD, 0x00000302, 0x00000177,
+0x00000303, 0x00001EF9, 0x00000304, 0x00000233, 0x00000307, 0x00001E8F,
+0x00000308, 0x000000FF, 0x00000309, 0x00001EF7, 0x0000030A, 0x00001E99,
+0x00000323, 0x00001EF5, 0x00000000, 0x00000301, 0x0000017A, 0x00000302,
+0x00001E91, 0x00000307, 0x0000017C, 0x0000030C, 0x0000017E, 0x00000323,
+0x00001E93, 0x00000331, 0x00001E95, 0x00000000, 0x00000300, 0x00001FED,
+0x00000301, 0x00000385, 0x00000342, 0x00001FC1, 0x00000000, 0x00000300,
+0x00001EA6, 0x00000301, 0x00001EA4, 0x00000303, 0x00001EAA, 0x00000309,
+0x00001EA8, 0x00000000, 0x00000304, 0x000001DE, 0x00000000, 0x00000301,
+0x000001FA, 0x00000000, 0x00000301, 0x000001FC, 0x00000304, 0x000001E2,
+0x00000000, 0x00000301, 0x00001E08, 0x00000000, 0x00000300, 0x00001EC0,
+0x00000301, 0x00001EBE, 0x00000303, 0x00001EC4, 0x00000309, 0x00001EC2,
+0x00000000, 0x00000301, 0x00001E2E, 0x00000000, 0x00000300, 0x00001ED2,
+0x00000301, 0x00001ED0, 0x00000303, 0x00001ED6, 0x00000309, 0x00001ED4,
+0x00000000, 0x00000301, 0x00001E4C, 0x00000304, 0x0000022C, 0x00000308,
+0x00001E4E, 0x00000000, 0x00000304, 0x0000022A, 0x00000000, 0x00000301,
+0x000001FE, 0x00000000, 0x00000300, 0x000001DB, 0x00000301, 0x000001D7,
+0x00000304, 0x000001D5, 0x0000030C, 0x000001D9, 0x00000000, 0x00000300,
+0x00001EA7, 0x00000301, 0x00001EA5, 0x00000303, 0x00001EAB, 0x00000309,
+0x00001EA9, 0x00000000, 0x00000304, 0x000001DF, 0x00000000, 0x00000301,
+0x000001FB, 0x00000000, 0x00000301, 0x000001FD, 0x00000304, 0x000001E3,
+0x00000000, 0x00000301, 0x00001E09, 0x00000000, 0x00000300, 0x00001EC1,
+0x00000301, 0x00001EBF, 0x00000303, 0x00001EC5, 0x00000309, 0x00001EC3,
+0x00000000, 0x00000301, 0x00001E2F, 0x00000000, 0x00000300, 0x00001ED3,
+0x00000301, 0x00001ED1, 0x00000303, 0x00001ED7, 0x00000309, 0x00001ED5,
+0x00000000, 0x00000301, 0x00001E4D, 0x00000304, 0x0000022D, 0x00000308,
+0x00001E4F, 0x00000000, 0x00000304, 0x0000022B, 0x00000000, 0x00000301,
+0x000001FF, 0x00000000, 0x00000300, 0x000001DC, 0x00000301, 0x000001D8,
+0x00000304, 0x000001D6, 0x0000030C, 0x000001DA, 0x00000000, 0x00000300,
+0x00001EB0, 0x00000301, 0x00001EAE, 0x00000303, 0x00001EB4, 0x00000309,
+0x00001EB2, 0x00000000, 0x00000300, 0x00001EB1, 0x00000301, 0x00001EAF,
+0x00000303, 0x00001EB5, 0x00000309, 0x00001EB3, 0x00000000, 0x00000300,
+0x00001E14, 0x00000301, 0x00001E16, 0x00000000, 0x00000300, 0x00001E15,
+0x00000301, 0x00001E17, 0x00000000, 0x00000300, 0x00001E50, 0x00000301,
+0x00001E52, 0x00000000, 0x00000300, 0x00001E51, 0x00000301, 0x00001E53,
+0x00000000, 0x00000307, 0x00001E64, 0x00000000, 0x00000307, 0x00001E65,
+0x00000000, 0x00000307, 0x00001E66, 0x00000000, 0x00000307, 0x00001E67,
+0x00000000, 0x00000301, 0x00001E78, 0x00000000, 0x00000301, 0x00001E79,
+0x00000000, 0x00000308, 0x00001E7A, 0x00000000, 0x00000308, 0x00001E7B,
+0x00000000, 0x00000307, 0x00001E9B, 0x00000000, 0x00000300, 0x00001EDC,
+0x00000301, 0x00001EDA, 0x00000303, 0x00001EE0, 0x00000309, 0x00001EDE,
+0x00000323, 0x00001EE2, 0x00000000, 0x00000300, 0x00001EDD, 0x00000301,
+0x00001EDB, 0x00000303, 0x00001EE1, 0x00000309, 0x00001EDF, 0x00000323,
+0x00001EE3, 0x00000000, 0x00000300, 0x00001EEA, 0x00000301, 0x00001EE8,
+0x00000303, 0x00001EEE, 0x00000309, 0x00001EEC, 0x00000323, 0x00001EF0,
+0x00000000, 0x00000300, 0x00001EEB, 0x00000301, 0x00001EE9, 0x00000303,
+0x00001EEF, 0x00000309, 0x00001EED, 0x00000323, 0x00001EF1, 0x00000000,
+0x0000030C, 0x000001EE, 0x00000000, 0x00000304, 0x000001EC, 0x00000000,
+0x00000304, 0x000001ED, 0x00000000, 0x00000304, 0x000001E0, 0x00000000,
+0x00000304, 0x000001E1, 0x00000000, 0x00000306, 0x00001E1C, 0x00000000,
+0x00000306, 0x00001E1D, 0x00000000, 0x00000304, 0x00000230, 0x00000000,
+0x00000304, 0x00000231, 0x00000000, 0x0000030C, 0x000001EF, 0x00000000,
+0x00000300, 0x00001FBA, 0x00000301, 0x00000386, 0x00000304, 0x00001FB9,
+0x00000306, 0x00001FB8, 0x00000313, 0x00001F08, 0x00000314, 0x00001F09,
+0x00000345, 0x00001FBC, 0x00000000, 0x00000300, 0x00001FC8, 0x00000301,
+0x00000388, 0x00000313, 0x00001F18, 0x00000314, 0x00001F19, 0x00000000,
+0x00000300, 0x00001FCA, 0x00000301, 0x00000389, 0x00000313, 0x00001F28,
+0x00000314, 0x00001F29, 0x00000345, 0x00001FCC, 0x00000000, 0x00000300,
+0x00001FDA, 0x00000301, 0x0000038A, 0x00000304, 0x00001FD9, 0x00000306,
+0x00001FD8, 0x00000308, 0x000003AA, 0x00000313, 0x00001F38, 0x00000314,
+0x00001F39, 0x00000000, 0x00000300, 0x00001FF8, 0x00000301, 0x0000038C,
+0x00000313, 0x00001F48, 0x00000314, 0x00001F49, 0x00000000, 0x00000314,
+0x00001FEC, 0x00000000, 0x00000300, 0x00001FEA, 0x00000301, 0x0000038E,
+0x00000304, 0x00001FE9, 0x00000306, 0x00001FE8, 0x00000308, 0x000003AB,
+0x00000314, 0x00001F59, 0x00000000, 0x00000300, 0x00001FFA, 0x00000301,
+0x0000038F, 0x00000313, 0x00001F68, 0x00000314, 0x00001F69, 0x00000345,
+0x00001FFC, 0x00000000, 0x00000345, 0x00001FB4, 0x00000000, 0x00000345,
+0x00001FC4, 0x00000000, 0x00000300, 0x00001F70, 0x00000301, 0x000003AC,
+0x00000304, 0x00001FB1, 0x00000306, 0x00001FB0, 0x00000313, 0x00001F00,
+0x00000314, 0x00001F01, 0x00000342, 0x00001FB6, 0x00000345, 0x00001FB3,
+0x00000000, 0x00000300, 0x00001F72, 0x00000301, 0x000003AD, 0x00000313,
+0x00001F10, 0x00000314, 0x00001F11, 0x00000000, 0x00000300, 0x00001F74,
+0x00000301, 0x000003AE, 0x00000313, 0x00001F20, 0x00000314, 0x00001F21,
+0x00000342, 0x00001FC6, 0x00000345, 0x00001FC3, 0x00000000, 0x00000300,
+0x00001F76, 0x00000301, 0x000003AF, 0x00000304, 0x00001FD1, 0x00000306,
+0x00001FD0, 0x00000308, 0x000003CA, 0x00000313, 0x00001F30, 0x00000314,
+0x00001F31, 0x00000342, 0x00001FD6, 0x00000000, 0x00000300, 0x00001F78,
+0x00000301, 0x000003CC, 0x00000313, 0x00001F40, 0x00000314, 0x00001F41,
+0x00000000, 0x00000313, 0x00001FE4, 0x00000314, 0x00001FE5, 0x00000000,
+0x00000300, 0x00001F7A, 0x00000301, 0x000003CD, 0x00000304, 0x00001FE1,
+0x00000306, 0x00001FE0, 0x00000308, 0x000003CB, 0x00000313, 0x00001F50,
+0x00000314, 0x00001F51, 0x00000342, 0x00001FE6, 0x00000000, 0x00000300,
+0x00001F7C, 0x00000301, 0x000003CE, 0x00000313, 0x00001F60, 0x00000314,
+0x00001F61, 0x00000342, 0x00001FF6, 0x00000345, 0x00001FF3, 0x00000000,
+0x00000300, 0x00001FD2, 0x00000301, 0x00000390, 0x00000342, 0x00001FD7,
+0x00000000, 0x00000300, 0x00001FE2, 0x00000301, 0x000003B0, 0x00000342,
+0x00001FE7, 0x00000000, 0x00000345, 0x00001FF4, 0x00000000, 0x00000301,
+0x000003D3, 0x00000308, 0x000003D4, 0x00000000, 0x00000308, 0x00000407,
+0x00000000, 0x00000306, 0x000004D0, 0x00000308, 0x000004D2, 0x00000000,
+0x00000301, 0x00000403, 0x00000000, 0x00000300, 0x00000400, 0x00000306,
+0x000004D6, 0x00000308, 0x00000401, 0x00000000, 0x00000306, 0x000004C1,
+0x00000308, 0x000004DC, 0x00000000, 0x00000308, 0x000004DE, 0x00000000,
+0x00000300, 0x0000040D, 0x00000304, 0x000004E2, 0x00000306, 0x00000419,
+0x00000308, 0x000004E4, 0x00000000, 0x00000301, 0x0000040C, 0x00000000,
+0x00000308, 0x000004E6, 0x00000000, 0x00000304, 0x000004EE, 0x00000306,
+0x0000040E, 0x00000308, 0x000004F0, 0x0000030B, 0x000004F2, 0x00000000,
+0x00000308, 0x000004F4, 0x00000000, 0x00000308, 0x000004F8, 0x00000000,
+0x00000308, 0x000004EC, 0x00000000, 0x00000306, 0x000004D1, 0x00000308,
+0x000004D3, 0x00000000, 0x00000301, 0x00000453, 0x00000000, 0x00000300,
+0x00000450, 0x00000306, 0x000004D7, 0x00000308, 0x00000451, 0x00000000,
+0x00000306, 0x000004C2, 0x00000308, 0x000004DD, 0x00000000, 0x00000308,
+0x000004DF, 0x00000000, 0x00000300, 0x0000045D, 0x00000304, 0x000004E3,
+0x00000306, 0x00000439, 0x00000308, 0x000004E5, 0x00000000, 0x00000301,
+0x0000045C, 0x00000000, 0x00000308, 0x000004E7, 0x00000000, 0x00000304,
+0x000004EF, 0x00000306, 0x0000045E, 0x00000308, 0x000004F1, 0x0000030B,
+0x000004F3, 0x00000000, 0x00000308, 0x000004F5, 0x00000000, 0x00000308,
+0x000004F9, 0x00000000, 0x00000308, 0x000004ED, 0x00000000, 0x00000308,
+0x00000457, 0x00000000, 0x0000030F, 0x00000476, 0x00000000, 0x0000030F,
+0x00000477, 0x00000000, 0x00000308, 0x000004DA, 0x00000000, 0x00000308,
+0x000004DB, 0x00000000, 0x00000308, 0x000004EA, 0x00000000, 0x00000308,
+0x000004EB, 0x00000000, 0x00000653, 0x00000622, 0x00000654, 0x00000623,
+0x00000655, 0x00000625, 0x00000000, 0x00000654, 0x00000624, 0x00000000,
+0x00000654, 0x00000626, 0x00000000, 0x00000654, 0x000006C2, 0x00000000,
+0x00000654, 0x000006D3, 0x00000000, 0x00000654, 0x000006C0, 0x00000000,
+0x0000093C, 0x00000929, 0x00000000, 0x0000093C, 0x00000931, 0x00000000,
+0x0000093C, 0x00000934, 0x00000000, 0x000009BE, 0x000009CB, 0x000009D7,
+0x000009CC, 0x00000000, 0x00000B3E, 0x00000B4B, 0x00000B56, 0x00000B48,
+0x00000B57, 0x00000B4C, 0x00000000, 0x00000BD7, 0x00000B94, 0x00000000,
+0x00000BBE, 0x00000BCA, 0x00000BD7, 0x00000BCC, 0x00000000, 0x00000BBE,
+0x00000BCB, 0x00000000, 0x00000C56, 0x00000C48, 0x00000000, 0x00000CD5,
+0x00000CC0, 0x00000000, 0x00000CC2, 0x00000CCA, 0x00000CD5, 0x00000CC7,
+0x00000CD6, 0x00000CC8, 0x00000000, 0x00000CD5, 0x00000CCB, 0x00000000,
+0x00000D3E, 0x00000D4A, 0x00000D57, 0x00000D4C, 0x00000000, 0x00000D3E,
+0x00000D4B, 0x00000000, 0x00000DCA, 0x00000DDA, 0x00000DCF, 0x00000DDC,
+0x00000DDF, 0x00000DDE, 0x00000000, 0x00000DCA, 0x00000DDD, 0x00000000,
+0x0000102E, 0x00001026, 0x00000000, 0x00001B35, 0x00001B06, 0x00000000,
+0x00001B35, 0x00001B08, 0x00000000, 0x00001B35, 0x00001B0A, 0x00000000,
+0x00001B35, 0x00001B0C, 0x00000000, 0x00001B35, 0x00001B0E, 0x00000000,
+0x00001B35, 0x00001B12, 0x00000000, 0x00001B35, 0x00001B3B, 0x00000000,
+0x00001B35, 0x00001B3D, 0x00000000, 0x00001B35, 0x00001B40, 0x00000000,
+0x00001B35, 0x00001B41, 0x00000000, 0x00001B35, 0x00001B43, 0x00000000,
+0x00000304, 0x00001E38, 0x00000000, 0x00000304, 0x00001E39, 0x00000000,
+0x00000304, 0x00001E5C, 0x00000000, 0x00000304, 0x00001E5D, 0x00000000,
+0x00000307, 0x00001E68, 0x00000000, 0x00000307, 0x00001E69, 0x00000000,
+0x00000302, 0x00001EAC, 0x00000306, 0x00001EB6, 0x00000000, 0x00000302,
+0x00001EAD, 0x00000306, 0x00001EB7, 0x00000000, 0x00000302, 0x00001EC6,
+0x00000000, 0x00000302, 0x00001EC7, 0x00000000, 0x00000302, 0x00001ED8,
+0x00000000, 0x00000302, 0x00001ED9, 0x00000000, 0x00000300, 0x00001F02,
+0x00000301, 0x00001F04, 0x00000342, 0x00001F06, 0x00000345, 0x00001F80,
+0x00000000, 0x00000300, 0x00001F03, 0x00000301, 0x00001F05, 0x00000342,
+0x00001F07, 0x00000345, 0x00001F81, 0x00000000, 0x00000345, 0x00001F82,
+0x00000000, 0x00000345, 0x00001F83, 0x00000000, 0x00000345, 0x00001F84,
+0x00000000, 0x00000345, 0x00001F85, 0x00000000, 0x00000345, 0x00001F86,
+0x00000000, 0x00000345, 0x00001F87, 0x00000000, 0x00000300, 0x00001F0A,
+0x00000301, 0x00001F0C, 0x00000342, 0x00001F0E, 0x00000345, 0x00001F88,
+0x00000000, 0x00000300, 0x00001F0B, 0x00000301, 0x00001F0D, 0x00000342,
+0x00001F0F, 0x00000345, 0x00001F89, 0x00000000, 0x00000345, 0x00001F8A,
+0x00000000, 0x00000345, 0x00001F8B, 0x00000000, 0x00000345, 0x00001F8C,
+0x00000000, 0x00000345, 0x00001F8D, 0x00000000, 0x00000345, 0x00001F8E,
+0x00000000, 0x00000345, 0x00001F8F, 0x00000000, 0x00000300, 0x00001F12,
+0x00000301, 0x00001F14, 0x00000000, 0x00000300, 0x00001F13, 0x00000301,
+0x00001F15, 0x00000000, 0x00000300, 0x00001F1A, 0x00000301, 0x00001F1C,
+0x00000000, 0x00000300, 0x00001F1B, 0x00000301, 0x00001F1D, 0x00000000,
+0x00000300, 0x00001F22, 0x00000301, 0x00001F24, 0x00000342, 0x00001F26,
+0x00000345, 0x00001F90, 0x00000000, 0x00000300, 0x00001F23, 0x00000301,
+0x00001F25, 0x00000342, 0x00001F27, 0x00000345, 0x00001F91, 0x00000000,
+0x00000345, 0x00001F92, 0x00000000, 0x00000345, 0x00001F93, 0x00000000,
+0x00000345, 0x00001F94, 0x00000000, 0x00000345, 0x00001F95, 0x00000000,
+0x00000345, 0x00001F96, 0x00000000, 0x00000345, 0x00001F97, 0x00000000,
+0x00000300, 0x00001F2A, 0x00000301, 0x00001F2C, 0x00000342, 0x00001F2E,
+0x00000345, 0x00001F98, 0x00000000, 0x00000300, 0x00001F2B, 0x00000301,
+0x00001F2D, 0x00000342, 0x00001F2F, 0x00000345, 0x00001F99, 0x00000000,
+0x00000345, 0x00001F9A, 0x00000000, 0x00000345, 0x00001F9B, 0x00000000,
+0x00000345, 0x00001F9C, 0x00000000, 0x00000345, 0x00001F9D, 0x00000000,
+0x00000345, 0x00001F9E, 0x00000000, 0x00000345, 0x00001F9F, 0x00000000,
+0x00000300, 0x00001F32, 0x00000301, 0x00001F34, 0x00000342, 0x00001F36,
+0x00000000, 0x00000300, 0x00001F33, 0x00000301, 0x00001F35, 0x00000342,
+0x00001F37, 0x00000000, 0x00000300, 0x00001F3A, 0x00000301, 0x00001F3C,
+0x00000342, 0x00001F3E, 0x00000000, 0x00000300, 0x00001F3B, 0x00000301,
+0x00001F3D, 0x00000342, 0x00001F3F, 0x00000000, 0x00000300, 0x00001F42,
+0x00000301, 0x00001F44, 0x00000000, 0x00000300, 0x00001F43, 0x00000301,
+0x00001F45, 0x00000000, 0x00000300, 0x00001F4A, 0x00000301, 0x00001F4C,
+0x00000000, 0x00000300, 0x00001F4B, 0x00000301, 0x00001F4D, 0x00000000,
+0x00000300, 0x00001F52, 0x00000301, 0x00001F54, 0x00000342, 0x00001F56,
+0x00000000, 0x00000300, 0x00001F53, 0x00000301, 0x00001F55, 0x00000342,
+0x00001F57, 0x00000000, 0x00000300, 0x00001F5B, 0x00000301, 0x00001F5D,
+0x00000342, 0x00001F5F, 0x00000000, 0x00000300, 0x00001F62, 0x00000301,
+0x00001F64, 0x00000342, 0x00001F66, 0x00000345, 0x00001FA0, 0x00000000,
+0x00000300, 0x00001F63, 0x00000301, 0x00001F65, 0x00000342, 0x00001F67,
+0x00000345, 0x00001FA1, 0x00000000, 0x00000345, 0x00001FA2, 0x00000000,
+0x00000345, 0x00001FA3, 0x00000000, 0x00000345, 0x00001FA4, 0x00000000,
+0x00000345, 0x00001FA5, 0x00000000, 0x00000345, 0x00001FA6, 0x00000000,
+0x00000345, 0x00001FA7, 0x00000000, 0x00000300, 0x00001F6A, 0x00000301,
+0x00001F6C, 0x00000342, 0x00001F6E, 0x00000345, 0x00001FA8, 0x00000000,
+0x00000300, 0x00001F6B, 0x00000301, 0x00001F6D, 0x00000342, 0x00001F6F,
+0x00000345, 0x00001FA9, 0x00000000, 0x00000345, 0x00001FAA, 0x00000000,
+0x00000345, 0x00001FAB, 0x00000000, 0x00000345, 0x00001FAC, 0x00000000,
+0x00000345, 0x00001FAD, 0x00000000, 0x00000345, 0x00001FAE, 0x00000000,
+0x00000345, 0x00001FAF, 0x00000000, 0x00000345, 0x00001FB2, 0x00000000,
+0x00000345, 0x00001FC2, 0x00000000, 0x00000345, 0x00001FF2, 0x00000000,
+0x00000345, 0x00001FB7, 0x00000000, 0x00000300, 0x00001FCD, 0x00000301,
+0x00001FCE, 0x00000342, 0x00001FCF, 0x00000000, 0x00000345, 0x00001FC7,
+0x00000000, 0x00000345, 0x00001FF7, 0x00000000, 0x00000300, 0x00001FDD,
+0x00000301, 0x00001FDE, 0x00000342, 0x00001FDF, 0x00000000, 0x00000338,
+0x0000219A, 0x00000000, 0x00000338, 0x0000219B, 0x00000000, 0x00000338,
+0x000021AE, 0x00000000, 0x00000338, 0x000021CD, 0x00000000, 0x00000338,
+0x000021CF, 0x00000000, 0x00000338, 0x000021CE, 0x00000000, 0x00000338,
+0x00002204, 0x00000000, 0x00000338, 0x00002209, 0x00000000, 0x00000338,
+0x0000220C, 0x00000000, 0x00000338, 0x00002224, 0x00000000, 0x00000338,
+0x00002226, 0x00000000, 0x00000338, 0x00002241, 0x00000000, 0x00000338,
+0x00002244, 0x00000000, 0x00000338, 0x00002247, 0x00000000, 0x00000338,
+0x00002249, 0x00000000, 0x00000338, 0x0000226D, 0x00000000, 0x00000338,
+0x00002262, 0x00000000, 0x00000338, 0x00002270, 0x00000000, 0x00000338,
+0x00002271, 0x00000000, 0x00000338, 0x00002274, 0x00000000, 0x00000338,
+0x00002275, 0x00000000, 0x00000338, 0x00002278, 0x00000000, 0x00000338,
+0x00002279, 0x00000000, 0x00000338, 0x00002280, 0x00000000, 0x00000338,
+0x00002281, 0x00000000, 0x00000338, 0x000022E0, 0x00000000, 0x00000338,
+0x000022E1, 0x00000000, 0x00000338, 0x00002284, 0x00000000, 0x00000338,
+0x00002285, 0x00000000, 0x00000338, 0x00002288, 0x00000000, 0x00000338,
+0x00002289, 0x00000000, 0x00000338, 0x000022E2, 0x00000000, 0x00000338,
+0x000022E3, 0x00000000, 0x00000338, 0x000022AC, 0x00000000, 0x00000338,
+0x000022AD, 0x00000000, 0x00000338, 0x000022AE, 0x00000000, 0x00000338,
+0x000022AF, 0x00000000, 0x00000338, 0x000022EA, 0x00000000, 0x00000338,
+0x000022EB, 0x00000000, 0x00000338, 0x000022EC, 0x00000000, 0x00000338,
+0x000022ED, 0x00000000, 0x00003099, 0x00003094, 0x00000000, 0x00003099,
+0x0000304C, 0x00000000, 0x00003099, 0x0000304E, 0x00000000, 0x00003099,
+0x00003050, 0x00000000, 0x00003099, 0x00003052, 0x00000000, 0x00003099,
+0x00003054, 0x00000000, 0x00003099, 0x00003056, 0x00000000, 0x00003099,
+0x00003058, 0x00000000, 0x00003099, 0x0000305A, 0x00000000, 0x00003099,
+0x0000305C, 0x00000000, 0x00003099, 0x0000305E, 0x00000000, 0x00003099,
+0x00003060, 0x00000000, 0x00003099, 0x00003062, 0x00000000, 0x00003099,
+0x00003065, 0x00000000, 0x00003099, 0x00003067, 0x00000000, 0x00003099,
+0x00003069, 0x00000000, 0x00003099, 0x00003070, 0x0000309A, 0x00003071,
+0x00000000, 0x00003099, 0x00003073, 0x0000309A, 0x00003074, 0x00000000,
+0x00003099, 0x00003076, 0x0000309A, 0x00003077, 0x00000000, 0x00003099,
+0x00003079, 0x0000309A, 0x0000307A, 0x00000000, 0x00003099, 0x0000307C,
+0x0000309A, 0x0000307D, 0x00000000, 0x00003099, 0x0000309E, 0x00000000,
+0x00003099, 0x000030F4, 0x00000000, 0x00003099, 0x000030AC, 0x00000000,
+0x00003099, 0x000030AE, 0x00000000, 0x00003099, 0x000030B0, 0x00000000,
+0x00003099, 0x000030B2, 0x00000000, 0x00003099, 0x000030B4, 0x00000000,
+0x00003099, 0x000030B6, 0x00000000, 0x00003099, 0x000030B8, 0x00000000,
+0x00003099, 0x000030BA, 0x00000000, 0x00003099, 0x000030BC, 0x00000000,
+0x00003099, 0x000030BE, 0x00000000, 0x00003099, 0x000030C0, 0x00000000,
+0x00003099, 0x000030C2, 0x00000000, 0x00003099, 0x000030C5, 0x00000000,
+0x00003099, 0x000030C7, 0x00000000, 0x00003099, 0x000030C9, 0x00000000,
+0x00003099, 0x000030D0, 0x0000309A, 0x000030D1, 0x00000000, 0x00003099,
+0x000030D3, 0x0000309A, 0x000030D4, 0x00000000, 0x00003099, 0x000030D6,
+0x0000309A, 0x000030D7, 0x00000000, 0x00003099, 0x000030D9, 0x0000309A,
+0x000030DA, 0x00000000, 0x00003099, 0x000030DC, 0x0000309A, 0x000030DD,
+0x00000000, 0x00003099, 0x000030F7, 0x00000000, 0x00003099, 0x000030F8,
+0x00000000, 0x00003099, 0x000030F9, 0x00000000, 0x00003099, 0x000030FA,
+0x00000000, 0x00003099, 0x000030FE, 0x00000000, 0x000110BA, 0x0001109A,
+0x00000000, 0x000110BA, 0x0001109C, 0x00000000, 0x000110BA, 0x000110AB,
+0x00000000, 0x00011127, 0x0001112E, 0x00000000, 0x00011127, 0x0001112F,
+0x00000000, 0x0001133E, 0x0001134B, 0x00011357, 0x0001134C, 0x00000000,
+0x000114B0, 0x000114BC, 0x000114BA, 0x000114BB, 0x000114BD, 0x000114BE,
+0x00000000, 0x000115AF, 0x000115BA, 0x00000000, 0x000115AF, 0x000115BB,
+0x00000000, 0x00011930, 0x00011938, 0x00000000,
+};
+const uint16_t _normalization_composition_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 320, 320, 320, 576, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 640, 704, 768, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320,
+};
+const uint16_t _normalization_composition_stage2[] = {
+0, 0, 0, 16, 32, 48, 64, 80, 0, 0, 96, 0, 112, 128, 144, 160, 176, 192, 0, 0,
+208, 224, 240, 256, 0, 0, 272, 288, 0, 0, 304, 0, 0, 0, 320, 0, 0, 0, 0, 0, 0,
+336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 368, 384, 400, 416, 0, 0,
+432, 448, 464, 480, 496, 512, 0, 528, 0, 0, 0, 0, 0, 544, 560, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 576, 0, 592, 0, 0, 0, 0, 0, 0, 0, 608,
+624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 640, 656, 0, 0, 0, 0, 0, 0, 0, 0, 672, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 0, 0, 0, 0,
+704, 0, 0, 720, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 752, 768, 0, 0, 0,
+0, 0, 0, 0, 784, 0, 0, 0, 0, 0, 0, 0, 0, 800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 816,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 832, 848, 0, 864, 880, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 0, 912, 928, 0, 0, 0, 944, 960, 976, 0, 0,
+0, 992, 1008, 1024, 1040, 1056, 1072, 1088, 1104, 0, 0, 0, 1120, 1136, 0, 0,
+1152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1168, 0, 0, 0, 1184, 0, 0, 1200, 0, 1216, 1232, 1248, 0, 1264, 1280, 1296, 1312,
+1328, 1344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1360, 1376, 1392, 1408, 0, 1424, 1440, 1456, 1472, 1488, 1504, 1520, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1536, 1552, 0, 0, 0, 0, 0, 0, 0, 0, 1568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1584, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1600, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0,
+};
+const uint16_t _normalization_composition_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1, 4, 7, 0, 0, 10, 43, 50, 61, 74, 109, 112, 127, 142, 173, 176, 187, 200,
+207, 226, 259, 0, 264, 281, 296, 311, 350, 355, 368, 373, 392, 0, 0, 0, 0, 0, 0,
+405, 438, 445, 456, 469, 504, 507, 522, 539, 568, 573, 584, 597, 604, 623, 656,
+0, 661, 678, 693, 710, 749, 754, 769, 774, 795, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 815, 0, 824, 827, 830, 835, 0, 0, 838, 0,
+0, 0, 0, 847, 0, 0, 0, 0, 850, 859, 866, 0, 869, 0, 0, 0, 872, 0, 0, 0, 0, 0,
+881, 0, 890, 893, 896, 901, 0, 0, 904, 0, 0, 0, 0, 913, 0, 0, 0, 0, 916, 925,
+932, 0, 935, 0, 0, 0, 938, 0, 0, 0, 0, 0, 947, 956, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 965, 970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 975, 980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 988, 0, 0,
+0, 0, 991, 994, 0, 0, 0, 0, 0, 0, 997, 1000, 1003, 1006, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1009, 1012, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1034, 1045, 0, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1059, 1062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1065, 1068, 1071,
+1074, 0, 0, 0, 0, 1077, 1080, 0, 0, 1083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1086, 0, 0, 0, 1101, 0, 1110, 0, 1121, 0, 0, 0, 0, 0, 1136, 0, 1145, 0, 0, 0,
+1148, 0, 0, 0, 1161, 0, 0, 1172, 0, 1175, 0, 0, 1178, 0, 0, 0, 1195, 0, 1204, 0,
+1217, 0, 0, 0, 0, 0, 1234, 0, 1243, 0, 0, 0, 1248, 0, 0, 0, 1265, 1278, 1285, 0,
+0, 1292, 0, 0, 0, 1295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1303, 0, 0, 1308, 0, 1311, 1318, 1323, 1326, 0,
+1335, 0, 0, 0, 1338, 0, 0, 0, 0, 1341, 0, 0, 0, 1350, 0, 0, 0, 1353, 0, 1356, 0,
+0, 1359, 0, 0, 1364, 0, 1367, 1374, 1379, 1382, 0, 1391, 0, 0, 0, 1394, 0, 0, 0,
+0, 1397, 0, 0, 0, 1406, 0, 0, 0, 1409, 0, 1412, 0, 0, 0, 0, 0, 0, 0, 0, 1415, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1418, 1421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1424, 1427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1430,
+1433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1443, 0, 1446, 0, 0, 0, 0, 0, 0, 1449, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1452, 0, 0, 1455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 1458, 0, 0, 0, 0, 0, 0, 0, 1461, 0, 0, 1464, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1482, 1487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1490, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1493, 0, 0, 0, 0, 0, 0, 1496, 0, 0, 0, 1503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1506, 1511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1514, 0, 0, 1521,
+0, 0, 0, 0, 0, 0, 0, 0, 1524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1527,
+0, 1530, 0, 1533, 0, 1536, 0, 1539, 0, 0, 0, 1542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1545, 0, 1548, 0, 1551, 1554, 0, 0,
+1557, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1560, 1563, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1566, 1569, 0, 0, 0, 0, 0, 0,
+1572, 1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1578, 1583, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1588, 1591, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1594, 1597, 0, 0, 1600, 1609, 1618, 1621, 1624,
+1627, 1630, 1633, 1636, 1645, 1654, 1657, 1660, 1663, 1666, 1669, 1672, 1677, 0,
+0, 0, 0, 0, 0, 1682, 1687, 0, 0, 0, 0, 0, 0, 1692, 1701, 1710, 1713, 1716, 1719,
+1722, 1725, 1728, 1737, 1746, 1749, 1752, 1755, 1758, 1761, 1764, 1771, 0, 0, 0,
+0, 0, 0, 1778, 1785, 0, 0, 0, 0, 0, 0, 1792, 1797, 0, 0, 0, 0, 0, 0, 1802, 1807,
+0, 0, 0, 0, 0, 0, 1812, 1819, 0, 0, 0, 0, 0, 0, 0, 1826, 0, 0, 0, 0, 0, 0, 1833,
+1842, 1851, 1854, 1857, 1860, 1863, 1866, 1869, 1878, 1887, 1890, 1893, 1896,
+1899, 1902, 1905, 0, 0, 0, 1908, 0, 0, 0, 0, 0, 0, 0, 1911, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1914, 0, 0, 0, 0, 0, 0, 0, 0, 1917, 0, 0, 0, 0, 0, 0, 1924, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1927, 0, 0, 0, 0, 0, 0, 0, 1930, 0, 1937, 0, 1940,
+0, 1943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1946, 0, 1949, 0, 1952, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1955, 0, 0, 0, 0, 1958, 0, 0, 1961, 0, 0, 0, 0, 0, 0,
+0, 1964, 0, 1967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1970, 0, 0, 0, 0, 0, 0, 1973, 0, 1976, 0, 0, 1979, 0, 0, 0, 0, 1982, 0, 0, 0,
+1985, 0, 0, 1988, 1991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1994, 1997, 0, 0,
+2000, 2003, 0, 0, 2006, 2009, 2012, 2015, 0, 0, 0, 0, 2018, 2021, 0, 0, 2024,
+2027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2030, 2033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2036, 0, 0, 0, 0, 0, 2039, 2042, 0, 2045, 0, 0, 0, 0, 0, 0, 2048, 2051,
+2054, 2057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2060, 0, 0, 0, 0,
+2063, 0, 2066, 0, 2069, 0, 2072, 0, 2075, 0, 2078, 0, 2081, 0, 2084, 0, 2087, 0,
+2090, 0, 2093, 0, 2096, 0, 0, 2099, 0, 2102, 0, 2105, 0, 0, 0, 0, 0, 0, 2108, 0,
+0, 2113, 0, 0, 2118, 0, 0, 2123, 0, 0, 2128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 2133, 0, 0, 0, 0, 0, 0, 0, 0, 2136, 0, 0, 0, 0, 2139, 0, 2142, 0,
+2145, 0, 2148, 0, 2151, 0, 2154, 0, 2157, 0, 2160, 0, 2163, 0, 2166, 0, 2169, 0,
+2172, 0, 0, 2175, 0, 2178, 0, 2181, 0, 0, 0, 0, 0, 0, 2184, 0, 0, 2189, 0, 0,
+2194, 0, 0, 2199, 0, 0, 2204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 2209, 2212, 2215, 2218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2221, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 2224, 0, 2227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2230, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 2233, 2236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2244, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2251, 2254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+2257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
@@ -0,0 +1,1997 @@
+const uint16_t _properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1280, 1344, 1408, 1216, 1472, 1536, 1600, 1664, 1728, 1792,
+1216, 1856, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1920, 1984, 2048, 2048, 2048, 2048, 2048, 2112,
+2048, 2176, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2240, 1216, 1216,
+2304, 1216, 1216, 1216, 1216, 2368, 2432, 2496, 1216, 2560, 1216, 2624, 2688,
+2752, 1216, 1216, 2816, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 2880, 832,
+832, 832, 2944, 3008, 832, 832, 832, 832, 3072, 832, 832, 832, 832, 832, 832,
+3136, 1216, 1216, 1216, 3200, 2816, 832, 832, 832, 832, 3264, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 2816, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 2816, 3328, 3392, 3392, 3392, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 2816, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
+1216, 1216, 1216, 2816,
+};
+const uint16_t _properties_stage2[] = {
+0, 16, 32, 48, 64, 80, 96, 112, 128, 16, 144, 160, 16, 176, 16, 176, 16, 16,
+192, 16, 208, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 224,
+16, 240, 16, 16, 256, 16, 272, 288, 304, 320, 336, 336, 336, 336, 336, 352, 368,
+384, 400, 416, 16, 16, 16, 16, 432, 16, 448, 16, 16, 16, 16, 16, 464, 16, 16,
+480, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 496, 16, 16, 512, 528, 544,
+560, 576, 16, 16, 16, 592, 608, 16, 16, 624, 640, 16, 656, 16, 16, 16, 16, 16,
+672, 688, 16, 704, 720, 16, 736, 752, 16, 16, 16, 16, 16, 768, 784, 16, 16, 800,
+816, 16, 832, 848, 864, 16, 880, 16, 16, 16, 16, 16, 16, 16, 896, 912, 928, 944,
+16, 16, 960, 976, 992, 1008, 1024, 1040, 16, 16, 1056, 1072, 1088, 1104, 16,
+1040, 16, 16, 1120, 1136, 720, 16, 1152, 1040, 16, 16, 1120, 1168, 16, 1104,
+1184, 1040, 16, 16, 1056, 1072, 1200, 1104, 16, 1216, 16, 16, 1232, 1248, 1088,
+16, 16, 944, 16, 16, 1264, 1280, 1296, 1104, 16, 1040, 16, 16, 1120, 1312, 1328,
+1104, 16, 944, 16, 16, 1344, 1280, 1088, 1104, 16, 1040, 16, 16, 16, 1360, 1376,
+16, 1104, 16, 16, 16, 1392, 1408, 1424, 16, 16, 16, 16, 16, 1440, 1456, 16, 16,
+16, 1472, 1488, 16, 1504, 16, 16, 16, 1520, 1536, 1552, 1568, 1584, 1600, 16,
+16, 16, 16, 16, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 1744, 1760, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+1776, 1792, 1808, 16, 16, 16, 16, 16, 16, 16, 16, 1824, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 1840, 16, 1856, 16, 16, 16, 16, 16,
+1872, 16, 16, 1104, 16, 1888, 16, 1104, 16, 1104, 16, 16, 1904, 1920, 1936,
+1952, 16, 16, 1968, 16, 16, 16, 1984, 16, 16, 16, 2000, 16, 2016, 16, 16, 16,
+16, 16, 16, 16, 2032, 2048, 2064, 16, 16, 16, 16, 16, 16, 2080, 16, 2096, 16,
+16, 16, 2112, 16, 16, 16, 2128, 2144, 2160, 16, 16, 2176, 2192, 2208, 16, 16,
+16, 2224, 16, 16, 2240, 2256, 2272, 800, 2288, 2304, 16, 2320, 16, 16, 16, 2336,
+2352, 16, 16, 896, 2368, 16, 16, 16, 2384, 16, 16, 16, 16, 16, 336, 2400, 2416,
+16, 16, 2432, 2448, 2448, 2448, 2464, 2480, 16, 2496, 2512, 2528, 2544, 16,
+2336, 2560, 16, 16, 256, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2576, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2592, 2608, 1776, 1776, 2624, 2640,
+2656, 2672, 2688, 2704, 2720, 2736, 2752, 2768, 2784, 16, 16, 16, 2800, 2816,
+16, 2832, 2848, 2864, 2880, 2896, 16, 2912, 2528, 16, 2928, 2944, 2960, 2976,
+2992, 3008, 3024, 3024, 3040, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3056, 3024, 3072, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3088, 3024, 3104, 3120, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 16, 16, 16, 16, 16, 3136, 3152, 3168, 3184, 16, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3024, 3200, 3216, 3232, 3248, 3264, 3024,
+3280, 3024, 3024, 3024, 3296, 3024, 3312, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3328, 16, 3344,
+3024, 3024, 3280, 3024, 3360, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3376, 3392, 3024, 3024, 3024, 3056, 3024, 3408, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024, 3024,
+3024, 3024, 3024, 3024, 3024, 16, 16, 16, 16, 16, 16, 16, 3424, 16, 16, 16, 16,
+16, 16, 3440, 3456, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+1568, 1568, 3024, 3472, 3488, 3504, 3520, 3024, 3024, 3024, 3536, 3552, 3536,
+3536, 3536, 3536, 3536, 3568, 3536, 3536, 3536, 3536, 3536, 3536, 3536, 3536,
+3536, 3536, 3536, 3536, 3536, 3584, 16, 3600, 3616, 3632, 3648, 3664, 16, 16,
+16, 16, 16, 3680, 1824, 16, 16, 16, 16, 3696, 16, 16, 16, 16, 16, 16, 3712, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 16, 16, 16, 16, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3744, 16, 3760, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3776, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3792, 16, 16, 16, 16, 16, 3440,
+3808, 16, 3824, 16, 16, 16, 16, 16, 3840, 336, 336, 3456, 16, 16, 16, 16, 3856,
+3872, 16, 16, 16, 16, 16, 16, 3888, 3904, 16, 3920, 16, 16, 16, 16, 3936, 2352,
+16, 16, 896, 3952, 16, 336, 3968, 16, 16, 3984, 16, 2336, 4000, 16, 16, 944, 16,
+16, 4016, 4032, 16, 4048, 16, 16, 16, 4064, 4080, 4096, 4112, 16, 4128, 16, 16,
+16, 4144, 384, 4160, 1616, 4176, 16, 16, 16, 16, 16, 4192, 4208, 16, 16, 16, 16,
+16, 16, 16, 4224, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4256, 4272, 4288, 4240, 4240, 4240,
+4304, 4240, 4240, 4240, 4240, 4240, 4240, 4320, 16, 16, 16, 4336, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4352, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 4368, 4368, 16, 4384, 16, 336, 4400, 4416, 4432, 4448, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 4464, 4480, 4496, 4512, 4528, 16, 4544, 4560, 16, 4576, 1760,
+16, 16, 16, 4592, 4608, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4624, 16, 16, 16, 16, 16, 16,
+16, 16, 4640, 16, 4656, 16, 16, 16, 4672, 16, 16, 16, 16, 16, 16, 16, 4688, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4656, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 4704, 16, 16, 16, 16, 3936, 16, 16, 16, 16, 16, 16, 16,
+16, 4720, 4736, 16, 16, 16, 4752, 16, 16, 16, 16, 16, 4768, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+4784, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 4800, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4816, 4832, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 2304, 16, 16, 4848, 4864, 16, 16, 16, 1216,
+16, 16, 4880, 4896, 16, 16, 16, 2304, 16, 2336, 4912, 4928, 16, 16, 4592, 2304,
+16, 16, 4944, 4960, 4976, 16, 16, 16, 16, 4992, 5008, 16, 16, 16, 16, 16, 16,
+5024, 16, 16, 5040, 5056, 16, 944, 16, 16, 1056, 1072, 5072, 5088, 5104, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 5120, 5136, 1424, 16, 16, 16, 16, 16, 5152,
+5168, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5184, 5200, 5216,
+5232, 16, 16, 16, 16, 16, 5248, 5264, 16, 16, 16, 16, 16, 1616, 5280, 16, 16,
+16, 16, 16, 5296, 5312, 5328, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 4992, 5056, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+5344, 5360, 16, 16, 16, 16, 16, 16, 16, 16, 5376, 5392, 16, 5408, 16, 16, 5424,
+5440, 5456, 16, 16, 5472, 5488, 5504, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5040, 5520, 5536, 16, 16,
+5552, 16, 5568, 1552, 4080, 16, 16, 16, 16, 16, 16, 16, 5584, 5600, 16, 16, 16,
+5616, 5632, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 5648, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 5664, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 4976, 16, 16, 16, 16, 16, 16, 16, 16, 5680, 16, 16, 16,
+5696, 5712, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5728, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 5040, 2144, 1568, 1568, 5744, 5760, 16, 16, 16, 16,
+5776, 5792, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 5808,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+5824, 16, 16, 5840, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 5856, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+5872, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5888,
+5904, 5920, 16, 5936, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 5952, 5952, 5968, 5952, 5952, 5984, 5952, 5952, 6000, 6016, 6032,
+6048, 6064, 5952, 5952, 5968, 6080, 6096, 6112, 6128, 6144, 6160, 5952, 5952,
+6176, 5952, 5952, 5952, 5968, 5952, 5952, 6112, 5952, 5952, 6000, 5952, 5952,
+6176, 5952, 5952, 5952, 5968, 6192, 5952, 6208, 6224, 5952, 6224, 5952, 6240,
+5952, 6240, 6256, 5952, 6256, 5952, 6272, 5952, 6272, 5952, 6288, 5952, 5952,
+5952, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 6304, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 6320, 6336, 6352, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 6368, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 6384, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 6400, 16, 16, 16, 16, 16, 16, 6416, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 6064, 5952, 6432, 6448, 6464,
+6480, 6496, 6512, 6528, 6544, 6560, 6544, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3152, 6576, 3152, 6576, 3152, 6576, 16,
+16, 16, 16, 16, 6592, 6608, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 6624, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 6640, 16, 16, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 6656,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+6640, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 6672, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 6688, 16, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240,
+4240, 4240, 4240, 4304, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 6704, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 6720, 6736, 6752, 6752, 6752, 6752, 6752,
+6752, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 4384, 4384, 4384, 4384,
+4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736,
+6736, 6736, 6736, 6736,
+};
+const uint64_t _properties_stage3[] = {
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000040000001, 0x0000000040000001, 0x0000000040000001,
+0x0000000040000001, 0x0000000040000001, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000040000001, 0x0000000090000040, 0x0000000080000020, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000020,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000040, 0x0000000080000018, 0x0000000090000040, 0x0000000080000000,
+0x0000000000000300, 0x0000000000000300, 0x0000000000000300, 0x0000000000000300,
+0x0000000000000300, 0x0000000000000300, 0x0000000000000300, 0x0000000000000300,
+0x0000000000000300, 0x0000000000000300, 0x0000000080000040, 0x0000000080000040,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000090000040,
+0x0000000080000000, 0x0000000000000300, 0x0000000000000300, 0x0000000000000300,
+0x0000000000000300, 0x0000000000000300, 0x0000000000000300, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080001080, 0x0000000000000000,
+0x0000000080001000, 0x0000000000000300, 0x0000000000000300, 0x0000000000000300,
+0x0000000000000300, 0x0000000000000300, 0x0000000000000300, 0x0000000000000000,
+0x0000000000000000, 0x0000000001000000, 0x0000000001000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000040000001, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000001, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000000001000, 0x0000000080000000, 0x0000000000004000, 0x0000000080000020,
+0x0000000080000000, 0x0000000000000010, 0x0000000080000000, 0x0000000000001000,
+0x0000000080000000, 0x0000000080000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000000, 0x0000000080000000, 0x0000000008003000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000004000, 0x0000000080000020,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000001000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000800000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000001000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000001000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000001000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000005000, 0x0000000000005000, 0x0000000001005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000003000, 0x0000000000003000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000005400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000400000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000005000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000008000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000001000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000001000000, 0x0000000000000000,
+0x0000000001000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000000000018, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000000008, 0x0000000000001400,
+0x0000000000000000, 0x0000000000001400, 0x0000000000001400, 0x0000000000000040,
+0x0000000000001400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000100000000, 0x0000000100000000, 0x0000000100000000, 0x0000000100000000,
+0x0000000100000000, 0x0000000100000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000040,
+0x0000000000000002, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000002000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001400,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000800000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000100000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000100000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000010000040, 0x0000000000002000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000010000040,
+0x0000000000000040, 0x0000000010000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000010000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000100000000, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000020400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000003000, 0x0000000000000400, 0x0000000000020400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000020400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000020400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000020400, 0x0000000000020400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000020400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000020400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000002000000, 0x0000000002000000, 0x0000000002000000, 0x0000000002000000,
+0x0000000002000000, 0x0000000000000000, 0x0000000000002000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000002000000, 0x0000000002000000, 0x0000000002000000, 0x0000000002000000,
+0x0000000002000000, 0x0000000000000000, 0x0000000000002000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000800400,
+0x0000000000000400, 0x0000000000800400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000000000, 0x0000000000001400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001400, 0x0000000000001400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000040, 0x0000000010000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000008000000, 0x0000000008000000, 0x0000000008000000,
+0x0000000008000000, 0x0000000008000000, 0x0000000008000000, 0x0000000008000000,
+0x0000000008000000, 0x0000000008000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000008, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000800000,
+0x0000000000800000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000010000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000018, 0x0000000000000000,
+0x0000000000000040, 0x0000000010000040, 0x0000000000002000, 0x0000000020000000,
+0x0000000020000000, 0x0000000020000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000002000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000004000400, 0x0000000004000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000002000000, 0x0000000002000000, 0x0000000002000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000002000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000002000,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000020400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000003400, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000003000,
+0x0000000000001000, 0x0000000000001000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000001005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000004000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000001000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000001004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000001004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000001000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000001, 0x0000000000000001, 0x0000000000000001, 0x0000000000000001,
+0x0000000000000001, 0x0000000000000001, 0x0000000000000001, 0x0000000000000001,
+0x0000000000000001, 0x0000000000000001, 0x0000000000000001, 0x0000000000000000,
+0x0000000000020004, 0x0000000000000004, 0x0000000040000002, 0x0000000040000002,
+0x0000000080000018, 0x0000000080000018, 0x0000000080000008, 0x0000000080000008,
+0x0000000080000008, 0x0000000080000008, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000020, 0x0000000080000020, 0x0000000080000020, 0x0000000080000020,
+0x0000000080000020, 0x0000000080000020, 0x0000000080000020, 0x0000000080000020,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000040000001, 0x0000000040000001, 0x0000000000000002, 0x0000000000000002,
+0x0000000000000002, 0x0000000000000002, 0x0000000000000002, 0x0000000000000001,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000020, 0x0000000080000020, 0x0000000080000000,
+0x0000000090000040, 0x0000000090000040, 0x0000000080000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000090000040,
+0x0000000090000040, 0x0000000090000040, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000008,
+0x0000000000000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000000000001,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000400000, 0x0000000000000002, 0x0000000000000002,
+0x0000000000000002, 0x0000000000000002, 0x0000000000800000, 0x0000000000800000,
+0x0000000000800000, 0x0000000000800000, 0x0000000000800000, 0x0000000000800000,
+0x0000000000000000, 0x0000000001004000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000008,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000004000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000008,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000004000, 0x0000000000004000, 0x0000000000004000,
+0x0000000000004000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000004000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000004000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000001000080, 0x0000000001000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000008000, 0x0000000000008000, 0x0000000000008000, 0x0000000000008000,
+0x0000000000008000, 0x0000000000008000, 0x0000000000008000, 0x0000000000008000,
+0x0000000000008000, 0x0000000000008000, 0x0000000000008000, 0x0000000000008000,
+0x0000000000008000, 0x0000000000008000, 0x0000000000008000, 0x0000000000008000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000008, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080800000, 0x0000000080800000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000004400, 0x0000000000004400,
+0x0000000000004400, 0x0000000000004400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000080, 0x0000000080000080, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000080, 0x0000000080000080,
+0x0000000080000080, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000080, 0x0000000080000080, 0x0000000080000000, 0x0000000080000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000001004000, 0x0000000000004000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000018,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000008, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000090000040, 0x0000000080001000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000008, 0x0000000080000008,
+0x0000000090000040, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000008, 0x0000000080000040, 0x0000000080000020, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000040, 0x0000000080000000, 0x0000000080000040, 0x0000000080000040,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000000000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000100000, 0x0000000000100000,
+0x0000000000100000, 0x0000000000100000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000040000, 0x0000000000040000, 0x0000000000080000, 0x0000000000080000,
+0x0000000000040000, 0x0000000000040000, 0x0000000000040000, 0x0000000000040000,
+0x0000000000040000, 0x0000000000040000, 0x0000000000040000, 0x0000000000040000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000001, 0x0000000080000040, 0x0000000090000040, 0x0000000080000000,
+0x0000000000000000, 0x0000000000002000, 0x0000000000000800, 0x0000000000000800,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000020, 0x0000000080000020, 0x0000000080000020, 0x0000000080000020,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000000, 0x0000000080000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000080000008, 0x0000000080000020, 0x0000000080000020, 0x0000000080000020,
+0x0000000080000000, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000021000, 0x0000000000021000,
+0x0000000080000008, 0x0000000000002000, 0x0000000000002000, 0x0000000000002000,
+0x0000000000002000, 0x0000000000002000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000004001000,
+0x0000000004001000, 0x0000000000002000, 0x0000000000002000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000010,
+0x0000000000003000, 0x0000000000002000, 0x0000000000002000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000400000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000002000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000002000, 0x0000000000000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000010000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000004000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000010000040,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000002000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001400, 0x0000000000002000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000002000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000002000000, 0x0000000002000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000002000000, 0x0000000000000000, 0x0000000002000000,
+0x0000000002000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000002000, 0x0000000000000000, 0x0000000000000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000002000,
+0x0000000000002000, 0x0000000000000400, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000005000, 0x0000000000005000, 0x0000000000005000, 0x0000000000005000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000010000040,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000000800, 0x0000000000200800, 0x0000000000000800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000200800,
+0x0000000000000800, 0x0000000000200800, 0x0000000000000800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000000800, 0x0000000000000800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000080000000, 0x0000000080000000,
+0x0000000000010000, 0x0000000000010000, 0x0000000000010000, 0x0000000000010000,
+0x0000000000010000, 0x0000000000010000, 0x0000000000010000, 0x0000000000010000,
+0x0000000000010000, 0x0000000000010000, 0x0000000000010000, 0x0000000000010000,
+0x0000000000010000, 0x0000000000010000, 0x0000000000010000, 0x0000000000010000,
+0x0000000020000000, 0x0000000020000000, 0x0000000020000000, 0x0000000020000000,
+0x0000000020000000, 0x0000000020000000, 0x0000000020000000, 0x0000000020000000,
+0x0000000020000000, 0x0000000020000000, 0x0000000020000000, 0x0000000020000000,
+0x0000000020000000, 0x0000000020000000, 0x0000000020000000, 0x0000000020000000,
+0x0000000000000000, 0x0000000000000008, 0x0000000000000008, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000020, 0x0000000000000020, 0x0000000000000020,
+0x0000000000000020, 0x0000000080000000, 0x0000000080000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000008, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000098,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000000000020, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000020,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000018, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000100, 0x0000000000000100, 0x0000000000000100, 0x0000000000000100,
+0x0000000000000100, 0x0000000000000100, 0x0000000000000100, 0x0000000000000100,
+0x0000000000000100, 0x0000000000000100, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000100, 0x0000000000000100, 0x0000000000000100,
+0x0000000000000100, 0x0000000000000100, 0x0000000000000100, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000001080, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000100, 0x0000000000000100, 0x0000000000000100,
+0x0000000000000100, 0x0000000000000100, 0x0000000000000100, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000000000020, 0x0000000000000020,
+0x0000000000000040, 0x0000000000000010, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000003000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000021000, 0x0000000000021000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000010000, 0x0000000000010000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000008, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000100000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000100000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000010000040, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000400,
+0x0000000010000040, 0x0000000010000040, 0x0000000000000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000002000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000020400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000020400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000001000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000040, 0x0000000000000040, 0x0000000000002000, 0x0000000000002000,
+0x0000000000002000, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000400, 0x0000000010000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000010000040, 0x0000000010000040, 0x0000000010000040, 0x0000000000000000,
+0x0000000000020400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000001000,
+0x0000000010000040, 0x0000000000000000, 0x0000000010000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000001000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000010000040, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000002000, 0x0000000000001000, 0x0000000000000000, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000040, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000000, 0x0000000010000040, 0x0000000010000040, 0x0000000000000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000001000, 0x0000000000000400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000040,
+0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000010000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000010000040,
+0x0000000010000040, 0x0000000000000040, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000002000, 0x0000000000002000,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000010000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001400,
+0x0000000000001400, 0x0000000000001400, 0x0000000000001400, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000002000, 0x0000000000002000, 0x0000000000000000, 0x0000000000002000,
+0x0000000000000800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001400, 0x0000000000001400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000800, 0x0000000000000800, 0x0000000000000800, 0x0000000000000800,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000400, 0x0000000010000040,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000020000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000021000, 0x0000000000021000,
+0x0000000000021000, 0x0000000000021000, 0x0000000000021000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000001000080, 0x0000000001000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040,
+0x0000000010000040, 0x0000000000000040, 0x0000000000000040, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000000, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000000, 0x0000000000000400, 0x0000000000000400,
+0x0000000000000400, 0x0000000000000400, 0x0000000000000400, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000002000, 0x0000000000002000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000001000,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000003000, 0x0000000000003000, 0x0000000000003000, 0x0000000000000400,
+0x0000000000001000, 0x0000000000001000, 0x0000000000001000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000000, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000000, 0x0000000000000080,
+0x0000000000000080, 0x0000000000000080, 0x0000000000000080, 0x0000000000000080,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000008400, 0x0000000000008400,
+0x0000000000008400, 0x0000000000008400, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000200000000, 0x0000000200000000, 0x0000000200000000, 0x0000000200000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000010000, 0x0000000000010000,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000000000, 0x0000000000000000,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000200800, 0x0000000000200800, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000200800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000200800,
+0x0000000000200800, 0x0000000000200800, 0x0000000000200800, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000400000, 0x0000000000800000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000400000, 0x0000000000400000, 0x0000000000400000, 0x0000000000400000,
+0x0000000000020000, 0x0000000000020000, 0x0000000000020000, 0x0000000000020000,
+0x0000000000020000, 0x0000000000020000, 0x0000000000020000, 0x0000000000020000,
+0x0000000000020000, 0x0000000000020000, 0x0000000000020000, 0x0000000000020000,
+0x0000000000020000, 0x0000000000020000, 0x0000000000020000, 0x0000000000020000,
+};
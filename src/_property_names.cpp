@@ -0,0 +1,1637 @@
+static_assert(static_cast<int>(PropertyType::General_Category) == 0, "");
+static_assert(static_cast<int>(PropertyType::Script) == 1, "");
+static_assert(static_cast<int>(PropertyType::Block) == 2, "");
+static_assert(static_cast<int>(PropertyType::Grapheme_Cluster_Break) == 3, "");
+static_assert(static_cast<int>(PropertyType::Word_Break) == 4, "");
+static_assert(static_cast<int>(PropertyType::Sentence_Break) == 5, "");
+static_assert(static_cast<int>(PropertyType::Property) == 6, "");
+static_assert(static_cast<int>(PropertyType::Derived_Property) == 7, "");
+static_assert(GeneralCategoryMask_Letter == 0x1F, "");
+static_assert(GeneralCategoryMask_Cased_Letter == 0x7, "");
+static_assert(GeneralCategoryMask_Mark == 0xE0, "");
+static_assert(GeneralCategoryMask_Number == 0x700, "");
+static_assert(GeneralCategoryMask_Punctuation == 0x3F800, "");
+static_assert(GeneralCategoryMask_Symbol == 0x3C0000, "");
+static_assert(GeneralCategoryMask_Separator == 0x1C00000, "");
+static_assert(GeneralCategoryMask_Other == 0x3E000000, "");
+const char _property_name_pool[] = {
+108, 121, 99, 105, 97, 110, 99, 106, 107, 101, 120, 116, 102, 100, 105, 97, 99,
+114, 105, 116, 105, 99, 97, 108, 115, 101, 120, 116, 99, 104, 97, 109, 120, 115,
+117, 120, 108, 97, 116, 105, 110, 101, 120, 116, 98, 104, 97, 110, 103, 117,
+108, 115, 121, 108, 108, 97, 98, 108, 101, 115, 103, 101, 111, 114, 103, 105,
+97, 110, 109, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 115,
+121, 109, 98, 111, 108, 115, 112, 104, 108, 112, 101, 116, 104, 105, 109, 101,
+114, 111, 109, 97, 107, 97, 100, 105, 97, 99, 114, 105, 116, 105, 99, 97, 108,
+115, 102, 111, 114, 115, 121, 109, 98, 111, 108, 115, 112, 114, 105, 118, 97,
+116, 101, 117, 115, 101, 104, 105, 103, 104, 112, 114, 105, 118, 97, 116, 101,
+117, 115, 101, 115, 117, 114, 114, 111, 103, 97, 116, 101, 115, 115, 101, 112,
+97, 114, 97, 116, 111, 114, 110, 99, 104, 97, 114, 112, 101, 114, 109, 97, 108,
+112, 104, 97, 98, 101, 116, 105, 99, 112, 114, 101, 115, 101, 110, 116, 97, 116,
+105, 111, 110, 102, 111, 114, 109, 115, 99, 104, 101, 114, 111, 107, 101, 101,
+112, 99, 115, 121, 114, 105, 97, 99, 115, 117, 112, 112, 108, 101, 109, 101,
+110, 116, 98, 97, 109, 117, 109, 109, 117, 108, 116, 97, 110, 105, 108, 97, 111,
+116, 105, 102, 105, 110, 97, 103, 104, 115, 107, 99, 104, 97, 110, 103, 101,
+115, 119, 104, 101, 110, 117, 112, 112, 101, 114, 99, 97, 115, 101, 100, 116,
+97, 108, 101, 105, 109, 112, 101, 114, 105, 97, 108, 97, 114, 97, 109, 97, 105,
+99, 109, 97, 104, 97, 106, 97, 110, 105, 110, 117, 109, 101, 103, 114, 97, 110,
+99, 111, 109, 98, 105, 110, 105, 110, 103, 100, 105, 97, 99, 114, 105, 116, 105,
+99, 97, 108, 109, 97, 114, 107, 115, 102, 111, 114, 115, 121, 109, 98, 111, 108,
+115, 101, 120, 116, 101, 110, 100, 101, 114, 98, 97, 115, 115, 97, 118, 97, 104,
+110, 111, 98, 108, 111, 99, 107, 108, 97, 116, 105, 110, 101, 120, 116, 99, 110,
+97, 110, 100, 107, 104, 105, 116, 97, 110, 115, 109, 97, 108, 108, 115, 99, 114,
+105, 112, 116, 99, 119, 116, 99, 104, 97, 110, 103, 101, 115, 119, 104, 101,
+110, 108, 111, 119, 101, 114, 99, 97, 115, 101, 100, 97, 100, 108, 109, 103,
+101, 111, 109, 101, 116, 114, 105, 99, 115, 104, 97, 112, 101, 115, 99, 119,
+117, 101, 110, 99, 108, 111, 115, 101, 100, 97, 108, 112, 104, 97, 110, 117,
+109, 101, 114, 105, 99, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 111,
+116, 104, 101, 114, 109, 97, 116, 104, 120, 105, 100, 99, 111, 110, 116, 105,
+110, 117, 101, 99, 106, 107, 115, 121, 109, 98, 111, 108, 115, 122, 105, 110,
+104, 116, 97, 109, 108, 99, 97, 114, 105, 97, 110, 110, 108, 111, 116, 104, 101,
+114, 117, 112, 112, 101, 114, 99, 97, 115, 101, 112, 97, 117, 99, 105, 110, 104,
+97, 117, 108, 121, 99, 105, 97, 110, 104, 97, 110, 103, 112, 104, 111, 110, 101,
+116, 105, 99, 101, 120, 116, 115, 117, 112, 110, 101, 119, 97, 116, 97, 105,
+108, 101, 107, 97, 116, 97, 107, 97, 110, 97, 112, 104, 111, 110, 101, 116, 105,
+99, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 117, 110, 97, 115, 115,
+105, 103, 110, 101, 100, 109, 105, 115, 99, 112, 105, 99, 116, 111, 103, 114,
+97, 112, 104, 115, 100, 111, 103, 114, 103, 114, 101, 101, 107, 98, 108, 107,
+108, 101, 99, 111, 110, 110, 101, 99, 116, 111, 114, 112, 117, 110, 99, 116,
+117, 97, 116, 105, 111, 110, 99, 111, 109, 109, 111, 110, 105, 110, 100, 105,
+99, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 115, 97, 114, 109, 101,
+110, 105, 97, 110, 107, 104, 97, 114, 111, 115, 104, 116, 104, 105, 121, 105,
+112, 104, 97, 103, 115, 112, 97, 115, 109, 97, 108, 108, 107, 97, 110, 97, 101,
+120, 116, 101, 110, 115, 105, 111, 110, 115, 117, 112, 112, 108, 101, 109, 101,
+110, 116, 97, 108, 109, 97, 116, 104, 101, 109, 97, 116, 105, 99, 97, 108, 111,
+112, 101, 114, 97, 116, 111, 114, 115, 99, 108, 111, 115, 101, 112, 117, 110,
+99, 116, 117, 97, 116, 105, 111, 110, 97, 100, 108, 97, 109, 103, 114, 98, 97,
+115, 101, 105, 100, 99, 111, 110, 116, 105, 110, 117, 101, 97, 114, 97, 98, 105,
+99, 115, 117, 112, 118, 115, 115, 117, 112, 115, 101, 110, 116, 101, 110, 99,
+101, 98, 114, 101, 97, 107, 110, 117, 109, 98, 101, 114, 98, 97, 108, 105, 110,
+101, 115, 101, 104, 101, 98, 114, 101, 119, 98, 97, 116, 107, 109, 101, 101,
+116, 101, 105, 109, 97, 121, 101, 107, 101, 120, 116, 101, 110, 115, 105, 111,
+110, 115, 109, 101, 110, 100, 116, 97, 110, 103, 117, 116, 111, 108, 100, 112,
+101, 114, 115, 105, 97, 110, 100, 117, 112, 108, 98, 114, 97, 104, 98, 114, 97,
+104, 109, 105, 97, 114, 97, 98, 105, 99, 112, 114, 101, 115, 101, 110, 116, 97,
+116, 105, 111, 110, 102, 111, 114, 109, 115, 98, 117, 105, 100, 101, 111, 116,
+97, 109, 105, 108, 112, 97, 117, 99, 108, 118, 108, 97, 116, 105, 110, 101, 120,
+116, 101, 115, 109, 107, 104, 117, 100, 97, 119, 97, 100, 105, 103, 114, 101,
+101, 107, 101, 120, 116, 101, 110, 100, 101, 100, 116, 97, 107, 114, 105, 108,
+105, 110, 101, 97, 114, 98, 115, 121, 108, 108, 97, 98, 97, 114, 121, 110, 98,
+116, 108, 97, 116, 105, 110, 49, 110, 97, 110, 99, 105, 101, 110, 116, 103, 114,
+101, 101, 107, 109, 117, 115, 105, 99, 99, 106, 107, 99, 111, 109, 112, 97, 116,
+105, 98, 105, 108, 105, 116, 121, 112, 108, 97, 121, 105, 110, 103, 99, 97, 114,
+100, 115, 109, 117, 115, 105, 99, 107, 110, 100, 97, 115, 117, 112, 115, 121,
+109, 98, 111, 108, 115, 97, 110, 100, 112, 105, 99, 116, 111, 103, 114, 97, 112,
+104, 115, 109, 111, 100, 105, 98, 117, 103, 105, 110, 101, 115, 101, 99, 114,
+107, 104, 111, 106, 108, 107, 104, 97, 114, 111, 115, 104, 116, 104, 105, 116,
+105, 98, 101, 116, 97, 110, 103, 101, 111, 114, 103, 105, 97, 110, 101, 120,
+116, 101, 110, 100, 101, 100, 111, 108, 100, 115, 111, 103, 100, 105, 97, 110,
+99, 106, 107, 114, 97, 100, 105, 99, 97, 108, 115, 115, 117, 112, 112, 108, 101,
+109, 101, 110, 116, 99, 111, 109, 98, 105, 110, 105, 110, 103, 100, 105, 97, 99,
+114, 105, 116, 105, 99, 97, 108, 109, 97, 114, 107, 115, 115, 117, 112, 112,
+108, 101, 109, 101, 110, 116, 103, 117, 114, 109, 117, 107, 104, 105, 119, 98,
+109, 105, 115, 99, 109, 97, 116, 104, 115, 121, 109, 98, 111, 108, 115, 98, 115,
+97, 114, 98, 101, 120, 108, 101, 116, 116, 101, 114, 108, 105, 107, 101, 115,
+121, 109, 98, 111, 108, 115, 105, 100, 115, 116, 97, 114, 116, 116, 105, 114,
+104, 104, 97, 116, 114, 97, 110, 104, 101, 120, 103, 101, 111, 109, 101, 116,
+114, 105, 99, 115, 104, 97, 112, 101, 115, 101, 120, 116, 101, 110, 100, 101,
+100, 105, 110, 100, 105, 99, 115, 105, 121, 97, 113, 110, 117, 109, 98, 101,
+114, 115, 105, 109, 112, 101, 114, 105, 97, 108, 97, 114, 97, 109, 97, 105, 99,
+109, 101, 114, 111, 105, 116, 105, 99, 99, 117, 114, 115, 105, 118, 101, 105,
+100, 99, 116, 102, 110, 103, 97, 108, 99, 104, 101, 109, 105, 99, 97, 108, 115,
+121, 109, 98, 111, 108, 115, 107, 97, 106, 97, 109, 111, 104, 97, 108, 102, 109,
+97, 114, 107, 115, 118, 97, 114, 105, 97, 116, 105, 111, 110, 115, 101, 108,
+101, 99, 116, 111, 114, 115, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116,
+98, 111, 112, 111, 120, 105, 100, 115, 116, 97, 114, 116, 104, 105, 103, 104,
+115, 117, 114, 114, 111, 103, 97, 116, 101, 115, 104, 97, 108, 102, 97, 110,
+100, 102, 117, 108, 108, 102, 111, 114, 109, 115, 99, 121, 114, 105, 108, 108,
+105, 99, 101, 120, 116, 101, 110, 100, 101, 100, 97, 115, 117, 112, 112, 108,
+101, 109, 101, 110, 116, 97, 108, 97, 114, 114, 111, 119, 115, 97, 99, 104, 97,
+107, 109, 97, 101, 103, 121, 112, 116, 105, 97, 110, 104, 105, 101, 114, 111,
+103, 108, 121, 112, 104, 102, 111, 114, 109, 97, 116, 99, 111, 110, 116, 114,
+111, 108, 115, 107, 104, 109, 101, 114, 118, 101, 114, 116, 105, 99, 97, 108,
+102, 111, 114, 109, 115, 111, 108, 100, 112, 101, 114, 115, 105, 97, 110, 109,
+97, 116, 104, 97, 108, 112, 104, 97, 110, 117, 109, 98, 111, 112, 111, 109, 111,
+102, 111, 115, 112, 101, 99, 105, 97, 108, 115, 101, 120, 116, 97, 110, 103,
+103, 114, 101, 101, 107, 97, 110, 100, 99, 111, 112, 116, 105, 99, 100, 101,
+118, 97, 112, 117, 97, 98, 104, 97, 105, 107, 115, 117, 107, 105, 115, 117, 110,
+100, 97, 110, 101, 115, 101, 111, 116, 104, 101, 114, 115, 121, 109, 98, 111,
+108, 103, 117, 114, 109, 117, 107, 104, 105, 116, 104, 97, 105, 99, 111, 112,
+116, 105, 99, 104, 101, 98, 114, 101, 119, 107, 97, 121, 97, 104, 108, 105, 99,
+111, 110, 116, 114, 111, 108, 98, 111, 112, 111, 109, 111, 102, 111, 101, 120,
+116, 101, 110, 100, 101, 100, 99, 117, 110, 101, 105, 102, 111, 114, 109, 110,
+117, 109, 98, 101, 114, 115, 116, 101, 108, 117, 103, 117, 116, 105, 98, 116,
+97, 104, 111, 109, 99, 106, 107, 117, 110, 105, 102, 105, 101, 100, 105, 100,
+101, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116, 101, 110, 115, 105, 111,
+110, 101, 99, 119, 99, 109, 109, 97, 110, 100, 97, 116, 108, 116, 99, 97, 110,
+97, 100, 105, 97, 110, 97, 98, 111, 114, 105, 103, 105, 110, 97, 108, 103, 114,
+97, 110, 116, 104, 97, 108, 105, 110, 101, 97, 114, 97, 99, 106, 107, 101, 120,
+116, 97, 116, 97, 105, 120, 117, 97, 110, 106, 105, 110, 103, 115, 121, 109, 98,
+111, 108, 115, 116, 97, 103, 98, 97, 110, 119, 97, 112, 104, 110, 120, 99, 111,
+112, 116, 105, 99, 97, 104, 101, 120, 105, 110, 105, 116, 105, 97, 108, 112,
+117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 108, 101, 112, 99, 104, 97, 107,
+97, 110, 110, 97, 100, 97, 103, 117, 114, 117, 109, 121, 109, 114, 99, 106, 107,
+99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 105, 100, 101,
+111, 103, 114, 97, 112, 104, 115, 115, 117, 112, 112, 108, 101, 109, 101, 110,
+116, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 109, 111, 100, 105,
+102, 105, 101, 114, 108, 101, 116, 116, 101, 114, 108, 97, 116, 105, 110, 101,
+120, 116, 101, 110, 100, 101, 100, 99, 122, 108, 107, 104, 111, 106, 107, 105,
+111, 108, 101, 116, 116, 101, 114, 113, 109, 97, 114, 107, 99, 121, 114, 105,
+108, 108, 105, 99, 101, 120, 116, 101, 110, 100, 101, 100, 99, 118, 97, 105,
+108, 105, 110, 101, 97, 114, 98, 105, 100, 101, 111, 103, 114, 97, 109, 115,
+115, 104, 111, 114, 116, 104, 97, 110, 100, 102, 111, 114, 109, 97, 116, 99,
+111, 110, 116, 114, 111, 108, 115, 116, 97, 107, 114, 105, 114, 101, 106, 97,
+110, 103, 107, 105, 116, 115, 109, 97, 115, 97, 114, 97, 109, 103, 111, 110,
+100, 105, 112, 102, 99, 97, 117, 99, 97, 115, 105, 97, 110, 97, 108, 98, 97,
+110, 105, 97, 110, 99, 117, 110, 101, 105, 102, 111, 114, 109, 110, 117, 109,
+98, 101, 114, 115, 97, 110, 100, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111,
+110, 116, 97, 105, 120, 117, 97, 110, 106, 105, 110, 103, 101, 120, 116, 101,
+110, 100, 117, 112, 108, 102, 120, 105, 100, 99, 114, 101, 103, 105, 111, 110,
+97, 108, 105, 110, 100, 105, 99, 97, 116, 111, 114, 103, 101, 110, 101, 114, 97,
+108, 99, 97, 116, 101, 103, 111, 114, 121, 99, 111, 112, 116, 105, 99, 101, 112,
+97, 99, 116, 110, 117, 109, 98, 101, 114, 115, 109, 121, 97, 110, 109, 97, 114,
+101, 120, 116, 97, 101, 109, 111, 116, 105, 99, 111, 110, 115, 111, 116, 104,
+101, 114, 108, 111, 119, 101, 114, 99, 97, 115, 101, 104, 97, 110, 103, 117,
+108, 106, 97, 109, 111, 115, 121, 108, 111, 115, 104, 114, 100, 115, 97, 109,
+114, 99, 97, 110, 97, 100, 105, 97, 110, 115, 121, 108, 108, 97, 98, 105, 99,
+115, 108, 111, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 97, 114, 121,
+112, 114, 105, 118, 97, 116, 101, 117, 115, 101, 97, 114, 101, 97, 98, 111, 116,
+104, 101, 114, 105, 100, 115, 116, 97, 114, 116, 122, 122, 122, 122, 109, 101,
+114, 111, 105, 116, 105, 99, 99, 117, 114, 115, 105, 118, 101, 107, 97, 110, 98,
+117, 110, 99, 110, 105, 110, 104, 101, 114, 105, 116, 101, 100, 111, 108, 100,
+112, 101, 114, 109, 105, 99, 119, 97, 114, 97, 110, 103, 99, 105, 116, 105, 115,
+117, 112, 97, 114, 114, 111, 119, 115, 97, 105, 116, 97, 108, 117, 99, 97, 115,
+97, 108, 112, 104, 97, 108, 105, 115, 117, 114, 117, 110, 114, 110, 117, 109,
+98, 101, 114, 102, 111, 114, 109, 115, 115, 105, 100, 100, 112, 104, 97, 103,
+115, 112, 97, 108, 97, 116, 105, 110, 118, 97, 114, 105, 97, 116, 105, 111, 110,
+115, 101, 108, 101, 99, 116, 111, 114, 115, 108, 121, 100, 105, 120, 120, 101,
+103, 121, 112, 108, 97, 116, 105, 110, 101, 120, 116, 100, 116, 105, 114, 104,
+117, 116, 97, 114, 117, 109, 105, 115, 117, 112, 112, 108, 101, 109, 101, 110,
+116, 97, 108, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 108, 105,
+110, 98, 102, 111, 114, 109, 97, 116, 104, 101, 98, 114, 101, 119, 108, 101,
+116, 116, 101, 114, 119, 97, 110, 99, 104, 111, 100, 105, 97, 107, 115, 99, 111,
+110, 116, 105, 110, 117, 101, 109, 97, 110, 105, 112, 104, 111, 110, 101, 116,
+105, 99, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 115, 117, 112, 112,
+108, 101, 109, 101, 110, 116, 105, 100, 115, 116, 114, 105, 110, 97, 114, 121,
+111, 112, 101, 114, 97, 116, 111, 114, 104, 97, 110, 103, 117, 108, 99, 111,
+109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 106, 97, 109, 111, 115,
+117, 112, 97, 114, 114, 111, 119, 115, 99, 99, 106, 107, 101, 120, 109, 121, 97,
+110, 109, 97, 114, 101, 120, 116, 98, 115, 99, 99, 106, 107, 99, 111, 109, 112,
+97, 116, 105, 100, 101, 111, 103, 114, 97, 112, 104, 115, 116, 97, 103, 115,
+114, 105, 118, 97, 105, 105, 111, 116, 104, 101, 114, 110, 117, 109, 98, 101,
+114, 103, 117, 110, 106, 97, 108, 97, 103, 111, 110, 100, 105, 97, 115, 99, 105,
+105, 104, 101, 120, 100, 105, 103, 105, 116, 99, 104, 101, 115, 115, 115, 121,
+109, 98, 111, 108, 115, 115, 112, 97, 99, 105, 110, 103, 109, 111, 100, 105,
+102, 105, 101, 114, 108, 101, 116, 116, 101, 114, 115, 98, 105, 100, 105, 99,
+109, 97, 110, 100, 97, 105, 99, 100, 105, 118, 101, 115, 97, 107, 117, 114, 117,
+98, 101, 110, 103, 109, 97, 107, 97, 115, 97, 114, 110, 117, 115, 104, 117, 119,
+99, 104, 111, 111, 100, 105, 101, 108, 98, 97, 115, 97, 110, 108, 97, 116, 105,
+110, 101, 120, 116, 101, 110, 100, 101, 100, 98, 113, 97, 97, 99, 100, 105, 97,
+99, 114, 105, 116, 105, 99, 97, 108, 115, 115, 117, 112, 107, 97, 110, 103, 120,
+105, 112, 111, 99, 97, 114, 105, 108, 101, 116, 116, 101, 114, 103, 111, 110,
+103, 108, 101, 112, 99, 104, 97, 115, 111, 121, 111, 109, 98, 111, 115, 121,
+108, 111, 116, 105, 110, 97, 103, 114, 105, 99, 106, 107, 101, 120, 116, 103,
+104, 109, 110, 103, 98, 111, 112, 111, 109, 111, 102, 111, 101, 120, 116, 104,
+97, 110, 103, 117, 108, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 97,
+114, 121, 112, 114, 105, 118, 97, 116, 101, 117, 115, 101, 97, 114, 101, 97, 97,
+108, 101, 112, 99, 115, 117, 112, 97, 114, 114, 111, 119, 115, 98, 109, 101,
+100, 101, 102, 97, 105, 100, 114, 105, 110, 115, 101, 112, 115, 121, 109, 98,
+111, 108, 115, 97, 110, 100, 112, 105, 99, 116, 111, 103, 114, 97, 112, 104,
+115, 101, 120, 116, 101, 110, 100, 101, 100, 97, 103, 117, 110, 106, 97, 108,
+97, 103, 111, 110, 100, 105, 101, 108, 121, 109, 97, 105, 99, 105, 110, 115, 99,
+114, 105, 112, 116, 105, 111, 110, 97, 108, 112, 97, 104, 108, 97, 118, 105,
+115, 104, 97, 114, 97, 100, 97, 99, 99, 99, 106, 107, 117, 110, 105, 102, 105,
+101, 100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116, 101,
+110, 115, 105, 111, 110, 97, 99, 117, 110, 101, 105, 102, 111, 114, 109, 109,
+111, 110, 103, 111, 108, 105, 97, 110, 99, 117, 114, 114, 101, 110, 99, 121,
+115, 121, 109, 98, 111, 108, 99, 111, 109, 98, 105, 110, 105, 110, 103, 100,
+105, 97, 99, 114, 105, 116, 105, 99, 97, 108, 109, 97, 114, 107, 115, 100, 105,
+110, 103, 98, 97, 116, 115, 109, 110, 109, 117, 115, 105, 99, 97, 108, 115, 121,
+109, 98, 111, 108, 115, 115, 116, 101, 114, 109, 117, 110, 97, 115, 115, 105,
+103, 110, 101, 100, 99, 97, 115, 101, 105, 103, 110, 111, 114, 97, 98, 108, 101,
+97, 103, 104, 98, 116, 105, 114, 104, 117, 116, 97, 98, 97, 109, 117, 109, 111,
+108, 100, 110, 111, 114, 116, 104, 97, 114, 97, 98, 105, 97, 110, 113, 97, 97,
+105, 109, 114, 111, 112, 104, 108, 105, 97, 101, 103, 101, 97, 110, 110, 117,
+109, 98, 101, 114, 115, 109, 98, 99, 121, 114, 105, 108, 108, 105, 99, 101, 120,
+116, 101, 110, 100, 101, 100, 98, 118, 112, 97, 104, 97, 119, 104, 104, 109,
+111, 110, 103, 111, 116, 104, 101, 114, 115, 117, 112, 101, 114, 97, 110, 100,
+115, 117, 98, 99, 111, 109, 112, 97, 116, 106, 97, 109, 111, 109, 97, 121, 97,
+110, 110, 117, 109, 101, 114, 97, 108, 115, 100, 111, 109, 105, 110, 111, 116,
+105, 108, 101, 115, 109, 97, 114, 107, 104, 97, 110, 105, 115, 111, 114, 97,
+107, 97, 110, 110, 97, 100, 97, 104, 97, 110, 101, 116, 104, 105, 111, 112, 105,
+99, 101, 120, 116, 101, 110, 100, 101, 100, 97, 108, 105, 109, 98, 117, 114,
+105, 108, 121, 100, 105, 97, 110, 97, 118, 101, 115, 116, 97, 110, 109, 97, 116,
+104, 101, 109, 97, 116, 105, 99, 97, 108, 111, 112, 101, 114, 97, 116, 111, 114,
+115, 117, 110, 97, 115, 115, 105, 103, 110, 101, 100, 103, 111, 110, 109, 97,
+114, 97, 98, 105, 99, 97, 118, 101, 115, 116, 97, 110, 100, 105, 97, 99, 114,
+105, 116, 105, 99, 97, 108, 115, 103, 111, 116, 104, 105, 99, 98, 104, 97, 105,
+107, 115, 117, 107, 105, 109, 121, 97, 110, 109, 97, 114, 101, 120, 116, 101,
+110, 100, 101, 100, 97, 101, 108, 98, 97, 114, 117, 110, 105, 99, 115, 112, 97,
+99, 101, 115, 101, 112, 97, 114, 97, 116, 111, 114, 116, 97, 107, 114, 109, 114,
+111, 98, 97, 109, 117, 109, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116,
+107, 97, 116, 97, 107, 97, 110, 97, 101, 120, 116, 109, 97, 108, 97, 121, 97,
+108, 97, 109, 109, 105, 100, 110, 117, 109, 108, 101, 116, 109, 111, 100, 105,
+102, 105, 101, 114, 116, 111, 110, 101, 108, 101, 116, 116, 101, 114, 115, 111,
+108, 100, 110, 111, 114, 116, 104, 97, 114, 97, 98, 105, 97, 110, 99, 97, 117,
+99, 97, 115, 105, 97, 110, 97, 108, 98, 97, 110, 105, 97, 110, 111, 116, 104,
+101, 114, 100, 105, 103, 105, 116, 115, 111, 121, 111, 116, 114, 97, 110, 115,
+112, 111, 114, 116, 97, 110, 100, 109, 97, 112, 100, 111, 117, 98, 108, 101,
+113, 117, 111, 116, 101, 108, 99, 122, 97, 110, 97, 98, 97, 122, 97, 114, 115,
+113, 117, 97, 114, 101, 115, 117, 110, 100, 97, 110, 101, 115, 101, 115, 117,
+112, 112, 108, 101, 109, 101, 110, 116, 112, 99, 109, 112, 104, 111, 110, 101,
+116, 105, 99, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 98, 111, 112,
+111, 109, 111, 102, 111, 110, 108, 100, 101, 99, 105, 109, 97, 108, 110, 117,
+109, 98, 101, 114, 99, 111, 109, 98, 105, 110, 105, 110, 103, 109, 97, 114, 107,
+115, 102, 111, 114, 115, 121, 109, 98, 111, 108, 115, 115, 112, 97, 99, 105,
+110, 103, 109, 97, 114, 107, 99, 121, 114, 108, 112, 97, 108, 109, 121, 114,
+101, 110, 101, 108, 118, 116, 108, 111, 103, 105, 99, 97, 108, 111, 114, 100,
+101, 114, 101, 120, 99, 101, 112, 116, 105, 111, 110, 111, 116, 104, 101, 114,
+112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 99, 104, 101, 114, 111,
+107, 101, 101, 115, 117, 112, 122, 97, 110, 98, 115, 112, 115, 111, 103, 111,
+116, 104, 97, 105, 116, 97, 105, 118, 105, 101, 116, 108, 105, 115, 117, 108,
+97, 116, 105, 110, 101, 120, 116, 101, 110, 100, 101, 100, 101, 99, 121, 114,
+105, 108, 108, 105, 99, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 97,
+114, 121, 109, 101, 101, 116, 101, 105, 109, 97, 121, 101, 107, 99, 115, 111,
+108, 100, 112, 101, 114, 109, 105, 99, 99, 111, 109, 98, 105, 110, 105, 110,
+103, 109, 97, 114, 107, 107, 104, 117, 100, 97, 119, 97, 100, 105, 112, 97, 116,
+116, 101, 114, 110, 119, 104, 105, 116, 101, 115, 112, 97, 99, 101, 104, 97,
+110, 105, 102, 105, 114, 111, 104, 105, 110, 103, 121, 97, 114, 97, 100, 105,
+99, 97, 108, 99, 106, 107, 114, 97, 100, 105, 99, 97, 108, 115, 115, 117, 112,
+99, 119, 99, 102, 116, 97, 103, 98, 97, 110, 119, 97, 103, 117, 106, 97, 114,
+97, 116, 105, 99, 121, 112, 114, 105, 111, 116, 116, 97, 118, 116, 121, 105,
+114, 97, 100, 105, 99, 97, 108, 115, 108, 102, 99, 111, 109, 98, 105, 110, 105,
+110, 103, 104, 97, 108, 102, 109, 97, 114, 107, 115, 109, 105, 115, 99, 115,
+121, 109, 98, 111, 108, 115, 116, 97, 105, 108, 101, 109, 97, 104, 97, 106, 97,
+110, 105, 104, 117, 110, 103, 112, 97, 116, 116, 101, 114, 110, 115, 121, 110,
+116, 97, 120, 103, 117, 106, 97, 114, 97, 116, 105, 109, 105, 115, 99, 101, 108,
+108, 97, 110, 101, 111, 117, 115, 109, 97, 116, 104, 101, 109, 97, 116, 105, 99,
+97, 108, 115, 121, 109, 98, 111, 108, 115, 97, 101, 110, 99, 108, 111, 115, 101,
+100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 105, 99, 115, 117, 112, 112,
+108, 101, 109, 101, 110, 116, 115, 101, 99, 104, 97, 110, 103, 101, 115, 119,
+104, 101, 110, 116, 105, 116, 108, 101, 99, 97, 115, 101, 100, 115, 121, 114,
+105, 97, 99, 103, 108, 97, 103, 111, 108, 105, 116, 105, 99, 107, 104, 109, 101,
+114, 115, 121, 109, 98, 111, 108, 115, 111, 108, 100, 116, 117, 114, 107, 105,
+99, 100, 101, 102, 97, 117, 108, 116, 105, 103, 110, 111, 114, 97, 98, 108, 101,
+99, 111, 100, 101, 112, 111, 105, 110, 116, 115, 105, 110, 104, 97, 108, 97,
+109, 117, 108, 116, 97, 110, 105, 112, 114, 105, 118, 97, 116, 101, 117, 115,
+101, 97, 114, 101, 97, 115, 121, 109, 98, 111, 108, 115, 97, 110, 100, 112, 105,
+99, 116, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116, 97, 109, 110, 101,
+108, 98, 97, 115, 97, 110, 119, 97, 114, 97, 98, 97, 115, 105, 99, 108, 97, 116,
+105, 110, 109, 105, 97, 111, 107, 97, 108, 105, 111, 116, 116, 111, 109, 97,
+110, 115, 105, 121, 97, 113, 110, 117, 109, 98, 101, 114, 115, 118, 97, 105,
+100, 111, 103, 114, 97, 108, 105, 109, 98, 117, 109, 101, 114, 99, 104, 97, 116,
+114, 109, 105, 115, 99, 109, 97, 116, 104, 115, 121, 109, 98, 111, 108, 115, 97,
+110, 101, 119, 116, 97, 105, 108, 117, 101, 109, 116, 101, 105, 117, 110, 105,
+102, 105, 101, 100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 109, 111, 110,
+103, 111, 108, 105, 97, 110, 110, 117, 97, 114, 97, 98, 105, 99, 109, 97, 116,
+104, 101, 109, 97, 116, 105, 99, 97, 108, 97, 108, 112, 104, 97, 98, 101, 116,
+105, 99, 115, 121, 109, 98, 111, 108, 115, 122, 97, 110, 97, 98, 97, 122, 97,
+114, 115, 113, 117, 97, 114, 101, 114, 101, 103, 105, 111, 110, 97, 108, 105,
+110, 100, 105, 99, 97, 116, 111, 114, 99, 121, 114, 105, 108, 108, 105, 99, 115,
+117, 112, 112, 108, 101, 109, 101, 110, 116, 98, 97, 108, 105, 114, 117, 109,
+105, 110, 117, 109, 101, 114, 97, 108, 115, 121, 109, 98, 111, 108, 115, 101,
+120, 116, 101, 110, 100, 100, 101, 118, 97, 110, 97, 103, 97, 114, 105, 109,
+101, 100, 102, 103, 114, 97, 112, 104, 101, 109, 101, 101, 120, 116, 101, 110,
+100, 108, 105, 110, 101, 97, 114, 97, 110, 97, 98, 97, 116, 97, 101, 97, 110,
+110, 101, 119, 108, 105, 110, 101, 110, 97, 110, 100, 105, 110, 97, 103, 97,
+114, 105, 105, 100, 101, 111, 103, 114, 97, 112, 104, 105, 99, 115, 121, 109,
+98, 111, 108, 115, 97, 110, 100, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111,
+110, 106, 97, 118, 97, 99, 111, 112, 116, 98, 114, 97, 105, 107, 97, 105, 116,
+104, 105, 97, 116, 101, 114, 109, 99, 104, 101, 114, 109, 101, 101, 116, 101,
+105, 109, 97, 121, 101, 107, 101, 120, 116, 117, 103, 97, 114, 105, 116, 105,
+99, 105, 112, 97, 101, 120, 116, 104, 101, 98, 114, 109, 114, 111, 111, 106, 97,
+109, 111, 101, 120, 116, 98, 104, 105, 103, 104, 112, 117, 115, 117, 114, 114,
+111, 103, 97, 116, 101, 115, 108, 97, 110, 97, 99, 111, 116, 97, 105, 116, 104,
+97, 109, 112, 97, 104, 97, 119, 104, 104, 109, 111, 110, 103, 111, 115, 109, 97,
+99, 121, 114, 105, 108, 108, 105, 99, 101, 120, 116, 99, 107, 104, 105, 116, 97,
+110, 115, 109, 97, 108, 108, 115, 99, 114, 105, 112, 116, 111, 108, 100, 104,
+117, 110, 103, 97, 114, 105, 97, 110, 97, 114, 97, 98, 105, 99, 115, 117, 112,
+112, 108, 101, 109, 101, 110, 116, 114, 101, 106, 97, 110, 103, 117, 110, 97,
+115, 115, 105, 103, 110, 101, 100, 119, 115, 112, 97, 99, 101, 115, 105, 110,
+104, 99, 104, 111, 114, 97, 115, 109, 105, 97, 110, 97, 114, 109, 105, 116, 97,
+103, 97, 108, 111, 103, 110, 98, 97, 116, 117, 99, 97, 115, 101, 120, 116, 99,
+106, 107, 101, 120, 116, 98, 109, 101, 100, 101, 102, 97, 105, 100, 114, 105,
+110, 109, 97, 114, 99, 104, 101, 110, 108, 104, 97, 110, 103, 117, 108, 106, 97,
+109, 111, 101, 120, 116, 101, 110, 100, 101, 100, 98, 112, 108, 114, 100, 112,
+114, 116, 105, 98, 111, 120, 100, 114, 97, 119, 105, 110, 103, 115, 117, 112,
+112, 117, 97, 97, 101, 116, 104, 105, 111, 112, 105, 99, 103, 114, 97, 110, 116,
+104, 97, 111, 108, 99, 107, 99, 104, 111, 114, 97, 115, 109, 105, 97, 110, 98,
+117, 103, 105, 110, 101, 115, 101, 104, 121, 112, 104, 101, 110, 116, 97, 110,
+103, 117, 116, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 101, 110, 99,
+108, 111, 115, 101, 100, 99, 106, 107, 108, 101, 116, 116, 101, 114, 115, 97,
+110, 100, 109, 111, 110, 116, 104, 115, 100, 101, 118, 97, 110, 97, 103, 97,
+114, 105, 101, 120, 116, 108, 97, 116, 105, 110, 101, 120, 116, 97, 111, 112,
+116, 105, 99, 97, 108, 99, 104, 97, 114, 97, 99, 116, 101, 114, 114, 101, 99,
+111, 103, 110, 105, 116, 105, 111, 110, 101, 116, 104, 105, 111, 112, 105, 99,
+101, 120, 116, 97, 112, 115, 97, 108, 116, 101, 114, 112, 97, 104, 108, 97, 118,
+105, 115, 105, 110, 104, 97, 108, 97, 99, 97, 115, 101, 100, 108, 101, 116, 116,
+101, 114, 109, 97, 114, 99, 104, 101, 110, 97, 114, 109, 110, 105, 110, 100,
+105, 99, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 115, 103, 114, 108,
+105, 110, 107, 117, 110, 97, 115, 115, 105, 103, 110, 101, 100, 109, 97, 108,
+97, 121, 97, 108, 97, 109, 99, 114, 112, 114, 101, 112, 101, 110, 100, 99, 106,
+107, 117, 110, 105, 102, 105, 101, 100, 105, 100, 101, 111, 103, 114, 97, 112,
+104, 115, 115, 121, 114, 99, 99, 97, 114, 105, 97, 110, 116, 97, 109, 105, 108,
+115, 117, 112, 115, 121, 114, 105, 97, 99, 115, 117, 112, 103, 108, 97, 103,
+111, 108, 105, 116, 105, 99, 115, 117, 112, 99, 106, 107, 101, 120, 116, 101,
+112, 114, 105, 118, 97, 116, 101, 117, 115, 101, 108, 111, 110, 117, 109, 101,
+114, 105, 99, 105, 110, 115, 99, 114, 105, 112, 116, 105, 111, 110, 97, 108,
+112, 97, 114, 116, 104, 105, 97, 110, 98, 101, 110, 103, 97, 108, 105, 108, 97,
+111, 111, 111, 103, 104, 97, 109, 108, 101, 99, 114, 99, 112, 114, 116, 99, 121,
+114, 105, 108, 108, 105, 99, 109, 97, 115, 97, 114, 97, 109, 103, 111, 110, 100,
+105, 115, 111, 103, 100, 103, 101, 111, 114, 103, 105, 97, 110, 101, 120, 116,
+115, 98, 97, 110, 99, 105, 101, 110, 116, 115, 121, 109, 98, 111, 108, 115, 110,
+101, 119, 97, 111, 108, 100, 116, 117, 114, 107, 105, 99, 115, 121, 114, 105,
+97, 99, 101, 97, 114, 108, 121, 100, 121, 110, 97, 115, 116, 105, 99, 99, 117,
+110, 101, 105, 102, 111, 114, 109, 100, 101, 112, 114, 101, 99, 97, 116, 101,
+100, 99, 106, 107, 99, 111, 109, 112, 97, 116, 102, 111, 114, 109, 115, 103,
+108, 97, 103, 111, 108, 105, 116, 105, 99, 102, 111, 114, 109, 97, 116, 110,
+117, 115, 104, 117, 112, 97, 116, 115, 121, 110, 111, 103, 114, 101, 120, 116,
+121, 105, 106, 105, 110, 103, 110, 115, 104, 117, 105, 100, 115, 114, 105, 104,
+108, 117, 119, 115, 109, 97, 108, 108, 102, 111, 114, 109, 115, 109, 108, 111,
+119, 101, 114, 99, 97, 115, 101, 108, 101, 116, 116, 101, 114, 103, 111, 116,
+104, 111, 116, 104, 101, 114, 108, 101, 116, 116, 101, 114, 97, 114, 97, 98,
+105, 99, 109, 97, 116, 104, 109, 121, 97, 110, 109, 97, 114, 101, 120, 116, 101,
+110, 100, 101, 100, 98, 109, 101, 114, 111, 105, 116, 105, 99, 104, 105, 101,
+114, 111, 103, 108, 121, 112, 104, 115, 111, 108, 99, 104, 105, 107, 105, 101,
+116, 104, 105, 111, 112, 105, 99, 111, 97, 108, 112, 104, 97, 111, 105, 100, 99,
+107, 104, 109, 101, 114, 99, 104, 114, 115, 109, 97, 110, 105, 99, 104, 97, 101,
+97, 110, 112, 104, 111, 110, 101, 116, 105, 99, 101, 120, 116, 99, 117, 110,
+101, 105, 102, 111, 114, 109, 105, 100, 101, 111, 103, 114, 97, 112, 104, 105,
+99, 100, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 99, 104, 97, 114, 97,
+99, 116, 101, 114, 115, 106, 97, 109, 111, 101, 120, 116, 97, 104, 97, 108, 102,
+119, 105, 100, 116, 104, 97, 110, 100, 102, 117, 108, 108, 119, 105, 100, 116,
+104, 102, 111, 114, 109, 115, 110, 107, 111, 111, 97, 108, 112, 104, 97, 98,
+101, 116, 105, 99, 112, 102, 98, 101, 110, 103, 97, 108, 105, 119, 97, 110, 99,
+104, 111, 111, 116, 104, 101, 114, 109, 97, 114, 99, 106, 111, 105, 110, 99,
+111, 110, 116, 114, 111, 108, 109, 105, 100, 108, 101, 116, 116, 101, 114, 101,
+103, 121, 112, 116, 105, 97, 110, 104, 105, 101, 114, 111, 103, 108, 121, 112,
+104, 115, 122, 119, 106, 104, 97, 110, 117, 110, 111, 111, 117, 112, 112, 101,
+114, 111, 108, 100, 115, 111, 103, 100, 105, 97, 110, 111, 114, 105, 121, 97,
+99, 108, 107, 104, 109, 114, 109, 108, 121, 109, 109, 108, 108, 97, 116, 105,
+110, 101, 120, 116, 97, 100, 100, 105, 116, 105, 111, 110, 97, 108, 105, 100,
+115, 98, 99, 106, 107, 115, 121, 109, 98, 111, 108, 115, 97, 110, 100, 112, 117,
+110, 99, 116, 117, 97, 116, 105, 111, 110, 108, 105, 109, 98, 111, 109, 97, 116,
+104, 100, 105, 97, 114, 106, 110, 103, 97, 114, 97, 98, 105, 99, 109, 111, 110,
+103, 111, 108, 105, 97, 110, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116,
+115, 109, 97, 108, 108, 107, 97, 110, 97, 101, 120, 116, 99, 97, 110, 115, 98,
+117, 103, 105, 119, 115, 101, 103, 115, 112, 97, 99, 101, 100, 101, 115, 101,
+114, 101, 116, 110, 107, 111, 104, 97, 110, 103, 117, 108, 110, 101, 119, 116,
+97, 105, 108, 117, 101, 98, 104, 107, 115, 106, 111, 105, 110, 99, 99, 106, 107,
+99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 105, 100, 101,
+111, 103, 114, 97, 112, 104, 115, 115, 97, 109, 97, 114, 105, 116, 97, 110, 109,
+101, 101, 116, 101, 105, 109, 97, 121, 101, 107, 117, 112, 112, 101, 114, 99,
+97, 115, 101, 108, 101, 116, 116, 101, 114, 112, 97, 117, 99, 105, 110, 104, 97,
+117, 112, 100, 108, 105, 110, 97, 111, 114, 110, 97, 109, 101, 110, 116, 97,
+108, 100, 105, 110, 103, 98, 97, 116, 115, 100, 113, 103, 99, 98, 112, 97, 108,
+109, 121, 114, 101, 110, 101, 99, 121, 114, 105, 108, 108, 105, 99, 108, 102,
+99, 104, 97, 110, 103, 101, 115, 119, 104, 101, 110, 99, 97, 115, 101, 102, 111,
+108, 100, 101, 100, 115, 104, 97, 118, 105, 97, 110, 99, 121, 112, 114, 105,
+111, 116, 115, 121, 108, 108, 97, 98, 97, 114, 121, 100, 105, 118, 101, 115, 97,
+107, 117, 114, 117, 109, 97, 110, 105, 99, 104, 97, 101, 97, 110, 114, 111, 104,
+103, 103, 114, 97, 112, 104, 101, 109, 101, 99, 108, 117, 115, 116, 101, 114,
+98, 114, 101, 97, 107, 112, 101, 116, 97, 110, 103, 117, 116, 108, 38, 116, 97,
+103, 97, 108, 111, 103, 103, 117, 106, 114, 118, 97, 114, 105, 97, 116, 105,
+111, 110, 115, 101, 108, 101, 99, 116, 111, 114, 98, 108, 111, 99, 107, 101,
+108, 101, 109, 101, 110, 116, 115, 109, 99, 109, 97, 116, 104, 102, 105, 110,
+97, 108, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 103, 114, 97, 112,
+104, 101, 109, 101, 98, 97, 115, 101, 108, 105, 110, 101, 115, 101, 112, 97,
+114, 97, 116, 111, 114, 110, 100, 99, 106, 107, 117, 110, 105, 102, 105, 101,
+100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116, 101, 110,
+115, 105, 111, 110, 98, 99, 104, 101, 114, 111, 107, 101, 101, 121, 105, 115,
+121, 108, 108, 97, 98, 108, 101, 115, 101, 120, 116, 101, 110, 100, 111, 103,
+104, 97, 109, 117, 110, 107, 110, 111, 119, 110, 115, 111, 102, 116, 100, 111,
+116, 116, 101, 100, 107, 97, 110, 97, 115, 117, 112, 112, 108, 101, 109, 101,
+110, 116, 108, 97, 116, 105, 110, 101, 120, 116, 101, 110, 100, 101, 100, 100,
+109, 97, 104, 106, 115, 99, 114, 105, 112, 116, 115, 105, 110, 100, 111, 108,
+100, 115, 111, 117, 116, 104, 97, 114, 97, 98, 105, 97, 110, 97, 114, 97, 98,
+97, 114, 114, 111, 119, 115, 98, 114, 97, 105, 108, 108, 101, 111, 108, 100,
+105, 116, 97, 108, 105, 99, 111, 99, 114, 100, 111, 103, 114, 97, 101, 110, 99,
+108, 111, 115, 101, 100, 97, 108, 112, 104, 97, 110, 117, 109, 115, 117, 112,
+116, 105, 98, 101, 116, 97, 110, 121, 101, 122, 105, 100, 105, 101, 110, 99,
+108, 111, 115, 105, 110, 103, 109, 97, 114, 107, 116, 97, 110, 103, 117, 116,
+99, 111, 109, 112, 111, 110, 101, 110, 116, 115, 115, 112, 97, 99, 105, 110,
+103, 109, 97, 114, 107, 99, 106, 107, 99, 111, 109, 112, 97, 116, 105, 98, 105,
+108, 105, 116, 121, 102, 111, 114, 109, 115, 99, 106, 107, 117, 110, 105, 102,
+105, 101, 100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116,
+101, 110, 115, 105, 111, 110, 99, 105, 100, 115, 98, 105, 110, 97, 114, 121,
+111, 112, 101, 114, 97, 116, 111, 114, 115, 104, 97, 114, 97, 100, 97, 114, 117,
+110, 105, 99, 115, 111, 114, 97, 115, 111, 109, 112, 101, 110, 103, 97, 114, 97,
+98, 105, 99, 112, 102, 97, 111, 117, 112, 112, 101, 114, 115, 97, 117, 114, 107,
+104, 97, 114, 107, 104, 111, 106, 107, 105, 99, 106, 107, 101, 120, 116, 100,
+115, 99, 119, 108, 106, 97, 118, 97, 110, 101, 115, 101, 101, 116, 104, 105,
+111, 112, 105, 99, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 115, 111,
+121, 111, 109, 98, 111, 100, 101, 112, 100, 115, 114, 116, 111, 103, 97, 109,
+115, 111, 114, 97, 115, 111, 109, 112, 101, 110, 103, 99, 111, 110, 116, 114,
+111, 108, 112, 105, 99, 116, 117, 114, 101, 115, 111, 115, 103, 101, 117, 103,
+97, 114, 103, 101, 111, 114, 103, 105, 97, 110, 115, 117, 112, 112, 108, 101,
+109, 101, 110, 116, 121, 101, 122, 105, 100, 105, 115, 117, 112, 112, 108, 101,
+109, 101, 110, 116, 97, 108, 97, 114, 114, 111, 119, 115, 99, 99, 111, 117, 110,
+116, 105, 110, 103, 114, 111, 100, 98, 97, 109, 117, 98, 97, 108, 105, 110, 101,
+115, 101, 103, 101, 111, 114, 103, 105, 97, 110, 112, 104, 97, 105, 115, 116,
+111, 115, 100, 105, 115, 99, 110, 97, 110, 100, 105, 110, 97, 103, 97, 114, 105,
+100, 97, 115, 104, 112, 114, 101, 112, 101, 110, 100, 101, 100, 99, 111, 110,
+99, 97, 116, 101, 110, 97, 116, 105, 111, 110, 109, 97, 114, 107, 99, 103, 108,
+97, 103, 111, 108, 105, 116, 105, 99, 115, 117, 112, 112, 108, 101, 109, 101,
+110, 116, 99, 104, 101, 114, 111, 107, 101, 101, 115, 117, 112, 112, 108, 101,
+109, 101, 110, 116, 108, 111, 119, 101, 114, 111, 114, 121, 97, 103, 114, 101,
+101, 107, 101, 120, 116, 97, 104, 111, 109, 107, 97, 110, 97, 101, 120, 116,
+101, 110, 100, 101, 100, 97, 115, 109, 116, 103, 108, 103, 100, 111, 109, 105,
+110, 111, 111, 112, 101, 110, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111,
+110, 97, 114, 97, 98, 105, 99, 112, 114, 101, 115, 101, 110, 116, 97, 116, 105,
+111, 110, 102, 111, 114, 109, 115, 97, 122, 119, 106, 121, 101, 122, 105, 118,
+115, 116, 114, 97, 110, 115, 112, 111, 114, 116, 97, 110, 100, 109, 97, 112,
+115, 121, 109, 98, 111, 108, 115, 99, 121, 114, 105, 108, 108, 105, 99, 115,
+117, 112, 122, 115, 99, 104, 109, 110, 112, 115, 117, 116, 116, 111, 110, 115,
+105, 103, 110, 119, 114, 105, 116, 105, 110, 103, 115, 117, 112, 112, 117, 110,
+99, 116, 117, 97, 116, 105, 111, 110, 109, 97, 110, 100, 97, 105, 99, 109, 97,
+116, 104, 115, 121, 109, 98, 111, 108, 115, 121, 109, 98, 111, 108, 115, 102,
+111, 114, 108, 101, 103, 97, 99, 121, 99, 111, 109, 112, 117, 116, 105, 110,
+103, 101, 108, 121, 109, 119, 111, 114, 100, 98, 114, 101, 97, 107, 111, 115,
+97, 103, 101, 115, 109, 97, 108, 108, 102, 111, 114, 109, 118, 97, 114, 105, 97,
+110, 116, 115, 99, 104, 97, 107, 109, 97, 104, 105, 114, 97, 103, 97, 110, 97,
+115, 112, 97, 99, 101, 111, 114, 105, 121, 97, 112, 99, 110, 101, 110, 99, 108,
+111, 115, 101, 100, 97, 108, 112, 104, 97, 110, 117, 109, 101, 114, 105, 99,
+115, 99, 105, 101, 110, 99, 108, 111, 115, 101, 100, 105, 100, 101, 111, 103,
+114, 97, 112, 104, 105, 99, 115, 117, 112, 115, 97, 117, 114, 97, 115, 104, 116,
+114, 97, 115, 116, 101, 114, 109, 98, 117, 104, 100, 104, 105, 114, 97, 99, 121,
+114, 105, 108, 108, 105, 99, 101, 120, 116, 97, 109, 121, 97, 110, 109, 97, 114,
+98, 117, 104, 105, 100, 116, 104, 97, 97, 107, 97, 116, 97, 107, 97, 110, 97,
+108, 111, 119, 115, 117, 114, 114, 111, 103, 97, 116, 101, 115, 99, 110, 116,
+114, 108, 103, 114, 101, 101, 107, 110, 97, 114, 98, 115, 117, 114, 114, 111,
+103, 97, 116, 101, 101, 116, 104, 105, 111, 112, 105, 99, 101, 120, 116, 97,
+110, 99, 105, 101, 110, 116, 103, 114, 101, 101, 107, 110, 117, 109, 98, 101,
+114, 115, 121, 105, 105, 105, 115, 105, 100, 100, 104, 97, 109, 107, 97, 121,
+97, 104, 108, 105, 104, 105, 114, 97, 103, 97, 110, 97, 115, 117, 112, 101, 114,
+115, 99, 114, 105, 112, 116, 115, 97, 110, 100, 115, 117, 98, 115, 99, 114, 105,
+112, 116, 115, 115, 97, 109, 97, 114, 105, 116, 97, 110, 104, 97, 116, 114, 97,
+110, 116, 101, 108, 117, 103, 117, 112, 97, 114, 97, 103, 114, 97, 112, 104,
+115, 101, 112, 97, 114, 97, 116, 111, 114, 106, 97, 118, 97, 110, 101, 115, 101,
+112, 97, 108, 109, 116, 101, 108, 117, 115, 105, 103, 110, 119, 114, 105, 116,
+105, 110, 103, 108, 97, 116, 105, 110, 49, 115, 117, 112, 112, 108, 101, 109,
+101, 110, 116, 111, 105, 100, 115, 103, 108, 97, 103, 111, 116, 104, 101, 114,
+103, 114, 97, 112, 104, 101, 109, 101, 101, 120, 116, 101, 110, 100, 110, 121,
+105, 97, 107, 101, 110, 103, 112, 117, 97, 99, 104, 117, 101, 104, 109, 111,
+110, 103, 117, 110, 97, 115, 115, 105, 103, 110, 101, 100, 116, 105, 102, 105,
+110, 97, 103, 104, 115, 101, 110, 116, 101, 110, 99, 101, 116, 101, 114, 109,
+105, 110, 97, 108, 108, 97, 116, 105, 110, 101, 120, 116, 101, 110, 100, 101,
+100, 97, 100, 100, 105, 116, 105, 111, 110, 97, 108, 105, 110, 115, 99, 114,
+105, 112, 116, 105, 111, 110, 97, 108, 112, 97, 104, 108, 97, 118, 105, 115,
+111, 103, 100, 105, 97, 110, 111, 108, 100, 105, 116, 97, 108, 105, 99, 111,
+115, 97, 103, 101, 105, 100, 115, 116, 109, 105, 115, 99, 101, 108, 108, 97,
+110, 101, 111, 117, 115, 115, 121, 109, 98, 111, 108, 115, 97, 110, 100, 97,
+114, 114, 111, 119, 115, 109, 105, 115, 99, 116, 101, 99, 104, 110, 105, 99, 97,
+108, 108, 111, 119, 101, 114, 99, 97, 115, 101, 107, 97, 110, 97, 101, 120, 116,
+97, 111, 108, 99, 104, 105, 107, 105, 110, 111, 105, 100, 101, 111, 103, 114,
+97, 112, 104, 105, 99, 110, 121, 105, 97, 107, 101, 110, 103, 112, 117, 97, 99,
+104, 117, 101, 104, 109, 111, 110, 103, 116, 101, 114, 109, 105, 110, 97, 108,
+112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 116, 97, 105, 118, 105,
+101, 116, 103, 101, 110, 101, 114, 97, 108, 112, 117, 110, 99, 116, 117, 97,
+116, 105, 111, 110, 108, 97, 116, 105, 110, 101, 120, 116, 101, 110, 100, 101,
+100, 97, 118, 101, 100, 105, 99, 101, 120, 116, 101, 110, 115, 105, 111, 110,
+115, 110, 97, 98, 97, 116, 97, 101, 97, 110, 108, 97, 116, 105, 110, 49, 115,
+117, 112, 103, 99, 98, 97, 116, 97, 107, 116, 101, 114, 109, 112, 97, 116, 119,
+115, 100, 105, 97, 99, 114, 105, 116, 105, 99, 108, 97, 116, 110, 120, 120, 119,
+97, 114, 97, 110, 103, 99, 105, 116, 105, 104, 97, 110, 103, 117, 108, 106, 97,
+109, 111, 101, 120, 116, 101, 110, 100, 101, 100, 97, 99, 111, 117, 110, 116,
+105, 110, 103, 114, 111, 100, 110, 117, 109, 101, 114, 97, 108, 115, 115, 117,
+112, 112, 108, 101, 109, 101, 110, 116, 97, 108, 115, 121, 109, 98, 111, 108,
+115, 97, 110, 100, 112, 105, 99, 116, 111, 103, 114, 97, 112, 104, 115, 108, 97,
+111, 115, 111, 103, 100, 105, 97, 110, 109, 111, 110, 103, 111, 108, 105, 97,
+110, 115, 117, 112, 115, 104, 97, 119, 104, 101, 120, 100, 105, 103, 105, 116,
+109, 97, 116, 104, 101, 109, 97, 116, 105, 99, 97, 108, 97, 108, 112, 104, 97,
+110, 117, 109, 101, 114, 105, 99, 115, 121, 109, 98, 111, 108, 115, 109, 97,
+104, 106, 111, 110, 103, 117, 110, 105, 102, 105, 101, 100, 99, 97, 110, 97,
+100, 105, 97, 110, 97, 98, 111, 114, 105, 103, 105, 110, 97, 108, 115, 121, 108,
+108, 97, 98, 105, 99, 115, 121, 105, 106, 105, 110, 103, 104, 101, 120, 97, 103,
+114, 97, 109, 115, 121, 109, 98, 111, 108, 115, 119, 104, 105, 116, 101, 115,
+112, 97, 99, 101, 99, 104, 97, 110, 103, 101, 115, 119, 104, 101, 110, 99, 97,
+115, 101, 109, 97, 112, 112, 101, 100, 107, 97, 110, 97, 116, 97, 109, 105, 108,
+115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 98, 121, 122, 97, 110, 116,
+105, 110, 101, 109, 117, 115, 105, 99, 97, 108, 115, 121, 109, 98, 111, 108,
+115, 98, 97, 116, 97, 107, 107, 97, 105, 116, 104, 105, 115, 117, 112, 109, 97,
+116, 104, 111, 112, 101, 114, 97, 116, 111, 114, 115, 99, 102, 115, 111, 117,
+112, 112, 101, 114, 122, 121, 121, 121, 101, 116, 104, 105, 111, 112, 105, 99,
+101, 120, 116, 101, 110, 100, 101, 100, 116, 97, 105, 116, 104, 97, 109, 107,
+116, 104, 105, 111, 116, 104, 101, 114, 100, 101, 102, 97, 117, 108, 116, 105,
+103, 110, 111, 114, 97, 98, 108, 101, 99, 111, 100, 101, 112, 111, 105, 110,
+116, 104, 97, 110, 105, 102, 105, 114, 111, 104, 105, 110, 103, 121, 97, 105,
+112, 97, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 97, 110, 97, 116,
+111, 108, 105, 97, 110, 104, 105, 101, 114, 111, 103, 108, 121, 112, 104, 115,
+108, 111, 101, 103, 114, 101, 107, 98, 121, 122, 97, 110, 116, 105, 110, 101,
+109, 117, 115, 105, 99, 101, 110, 99, 108, 111, 115, 101, 100, 97, 108, 112,
+104, 97, 110, 117, 109, 110, 111, 110, 99, 104, 97, 114, 97, 99, 116, 101, 114,
+99, 111, 100, 101, 112, 111, 105, 110, 116, 99, 106, 107, 117, 110, 105, 102,
+105, 101, 100, 105, 100, 101, 111, 103, 114, 97, 112, 104, 115, 101, 120, 116,
+101, 110, 115, 105, 111, 110, 103, 110, 111, 110, 115, 112, 97, 99, 105, 110,
+103, 109, 97, 114, 107, 98, 114, 97, 105, 108, 108, 101, 112, 97, 116, 116, 101,
+114, 110, 115, 109, 97, 104, 106, 111, 110, 103, 116, 105, 108, 101, 115, 101,
+110, 99, 108, 111, 115, 101, 100, 99, 106, 107, 117, 103, 97, 114, 105, 116,
+105, 99, 104, 97, 110, 111, 116, 104, 97, 97, 110, 97, 102, 111, 109, 111, 100,
+105, 102, 105, 101, 114, 115, 121, 109, 98, 111, 108, 112, 104, 111, 101, 110,
+105, 99, 105, 97, 110, 112, 104, 97, 103, 108, 109, 112, 117, 110, 99, 116, 107,
+97, 116, 97, 107, 97, 110, 97, 115, 117, 112, 112, 117, 97, 98, 109, 105, 100,
+110, 117, 109, 115, 117, 110, 100, 97, 110, 101, 115, 101, 115, 117, 112, 118,
+101, 100, 105, 99, 101, 120, 116, 110, 117, 109, 101, 114, 105, 99, 100, 101,
+115, 101, 114, 101, 116, 99, 106, 107, 99, 111, 109, 112, 97, 116, 105, 100,
+101, 111, 103, 114, 97, 112, 104, 115, 115, 117, 112, 109, 101, 114, 111, 105,
+116, 105, 99, 104, 105, 101, 114, 111, 103, 108, 121, 112, 104, 115, 109, 105,
+115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 109, 97, 116, 104, 101,
+109, 97, 116, 105, 99, 97, 108, 115, 121, 109, 98, 111, 108, 115, 98, 100, 97,
+115, 104, 112, 117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 98, 97, 109, 117,
+109, 115, 117, 112, 99, 106, 107, 115, 116, 114, 111, 107, 101, 115, 111, 116,
+104, 101, 114, 97, 108, 112, 104, 97, 98, 101, 116, 105, 99, 110, 107, 111, 99,
+106, 107, 117, 110, 105, 102, 105, 101, 100, 105, 100, 101, 111, 103, 114, 97,
+112, 104, 115, 101, 120, 116, 101, 110, 115, 105, 111, 110, 102, 104, 108, 117,
+112, 112, 101, 114, 99, 97, 115, 101, 109, 111, 100, 105, 115, 104, 97, 118,
+105, 97, 110, 97, 108, 101, 116, 116, 101, 114, 97, 110, 99, 105, 101, 110, 116,
+103, 114, 101, 101, 107, 109, 117, 115, 105, 99, 97, 108, 110, 111, 116, 97,
+116, 105, 111, 110, 99, 111, 110, 116, 114, 111, 108, 99, 106, 107, 101, 120,
+116, 99, 115, 117, 110, 100, 99, 121, 114, 105, 108, 108, 105, 99, 101, 120,
+116, 98, 104, 97, 110, 117, 110, 111, 111, 108, 108, 97, 110, 97, 116, 111, 108,
+105, 97, 110, 104, 105, 101, 114, 111, 103, 108, 121, 112, 104, 115, 100, 101,
+118, 97, 110, 97, 103, 97, 114, 105, 98, 97, 115, 115, 97, 118, 97, 104, 116,
+104, 97, 97, 110, 97, 102, 111, 100, 117, 112, 108, 111, 121, 97, 110, 99, 111,
+109, 98, 105, 110, 105, 110, 103, 100, 105, 97, 99, 114, 105, 116, 105, 99, 97,
+108, 109, 97, 114, 107, 115, 101, 120, 116, 101, 110, 100, 101, 100, 97, 114,
+97, 98, 105, 99, 112, 102, 98, 122, 115, 109, 97, 107, 97, 115, 97, 114, 97,
+114, 97, 98, 105, 99, 101, 120, 116, 97, 99, 104, 97, 109, 115, 100, 98, 105,
+100, 105, 99, 111, 110, 116, 114, 111, 108, 107, 97, 110, 97, 115, 117, 112,
+101, 120, 116, 101, 110, 100, 110, 117, 109, 108, 101, 116, 101, 120, 116, 115,
+99, 108, 111, 119, 101, 114, 115, 97, 117, 114, 97, 115, 104, 116, 114, 97, 111,
+115, 109, 97, 110, 121, 97, 103, 101, 111, 114, 103, 105, 97, 110, 115, 117,
+112, 101, 108, 121, 109, 97, 105, 99, 97, 114, 97, 98, 105, 99, 101, 120, 116,
+101, 110, 100, 101, 100, 97, 115, 113, 112, 112, 97, 108, 112, 104, 97, 98, 101,
+116, 105, 99, 113, 117, 111, 116, 97, 116, 105, 111, 110, 109, 97, 114, 107,
+103, 101, 111, 114, 109, 105, 115, 99, 97, 114, 114, 111, 119, 115, 109, 105,
+97, 111, 115, 121, 109, 98, 111, 108, 97, 108, 99, 104, 101, 109, 105, 99, 97,
+108, 98, 117, 104, 105, 100, 115, 105, 110, 103, 108, 101, 113, 117, 111, 116,
+101, 109, 121, 97, 110, 109, 97, 114, 115, 121, 108, 111, 116, 105, 110, 97,
+103, 114, 105, 107, 97, 110, 103, 120, 105, 114, 97, 100, 105, 99, 97, 108, 115,
+120, 105, 100, 115, 97, 114, 109, 101, 110, 105, 97, 110, 120, 120, 112, 117,
+110, 99, 116, 117, 97, 116, 105, 111, 110, 111, 115, 109, 97, 110, 121, 97, 109,
+117, 108, 116, 98, 108, 111, 99, 107, 103, 101, 111, 109, 101, 116, 114, 105,
+99, 115, 104, 97, 112, 101, 115, 101, 120, 116, 111, 114, 107, 104, 111, 108,
+100, 115, 111, 117, 116, 104, 97, 114, 97, 98, 105, 97, 110, 99, 111, 109, 109,
+111, 110, 105, 110, 115, 99, 114, 105, 112, 116, 105, 111, 110, 97, 108, 112,
+97, 114, 116, 104, 105, 97, 110, 115, 105, 100, 100, 104, 97, 109, 109, 101,
+110, 100, 101, 107, 105, 107, 97, 107, 117, 105, 105, 100, 99, 116, 97, 103, 98,
+109, 97, 116, 104, 111, 112, 101, 114, 97, 116, 111, 114, 115, 116, 97, 108,
+117, 99, 106, 107, 117, 110, 105, 102, 105, 101, 100, 105, 100, 101, 111, 103,
+114, 97, 112, 104, 115, 101, 120, 116, 101, 110, 115, 105, 111, 110, 100, 118,
+115, 112, 115, 103, 114, 97, 112, 104, 101, 109, 101, 108, 105, 110, 107, 112,
+105, 112, 104, 97, 105, 115, 116, 111, 115, 102, 111, 114, 109, 97, 116, 108,
+121, 99, 105, 97, 100, 108, 97, 109, 109, 111, 100, 105, 102, 105, 101, 114,
+108, 101, 116, 116, 101, 114, 115, 111, 116, 104, 101, 114, 108, 117, 107, 97,
+116, 97, 107, 97, 110, 97, 115, 116, 101, 116, 104, 105, 111, 112, 105, 99, 115,
+117, 112, 105, 100, 101, 111, 122, 112, 97, 115, 99, 105, 105, 115, 117, 112,
+112, 108, 101, 109, 101, 110, 116, 97, 108, 97, 114, 114, 111, 119, 115, 98, 98,
+97, 115, 115, 103, 114, 101, 120, 116, 111, 108, 111, 119, 101, 114, 97, 118,
+115, 116, 99, 106, 107, 99, 111, 109, 112, 97, 116, 116, 97, 109, 105, 108, 103,
+111, 116, 104, 105, 99, 98, 114, 97, 104, 109, 105, 120, 112, 101, 111, 109,
+105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 115, 121, 109, 98,
+111, 108, 115, 97, 110, 100, 112, 105, 99, 116, 111, 103, 114, 97, 112, 104,
+115, 109, 111, 110, 103, 108, 105, 110, 101, 97, 114, 98, 111, 108, 100, 104,
+117, 110, 103, 97, 114, 105, 97, 110, 115, 117, 110, 100, 97, 110, 101, 115,
+101, 108, 101, 116, 116, 101, 114, 110, 117, 109, 98, 101, 114, 115, 103, 110,
+119, 108, 105, 115, 117, 115, 117, 112, 112, 108, 101, 109, 101, 110, 116, 117,
+110, 105, 102, 105, 101, 100, 99, 97, 110, 97, 100, 105, 97, 110, 97, 98, 111,
+114, 105, 103, 105, 110, 97, 108, 115, 121, 108, 108, 97, 98, 105, 99, 115, 101,
+120, 116, 101, 110, 100, 101, 100, 98, 114, 97, 105, 108, 108, 101, 100, 101,
+118, 97, 110, 97, 103, 97, 114, 105, 101, 120, 116, 101, 110, 100, 101, 100,
+116, 97, 110, 103, 117, 116, 115, 117, 112, 99, 108, 111, 115, 101, 99, 117,
+114, 114, 101, 110, 99, 121, 115, 121, 109, 98, 111, 108, 115, 108, 121, 100,
+105, 97, 110, 116, 105, 116, 108, 101, 99, 97, 115, 101, 108, 101, 116, 116,
+101, 114, 114, 101, 103, 105, 111, 110, 97, 108, 105, 110, 100, 105, 99, 97,
+116, 111, 114, 112, 104, 111, 101, 110, 105, 99, 105, 97, 110, 115, 105, 110,
+104, 97, 108, 97, 97, 114, 99, 104, 97, 105, 99, 110, 117, 109, 98, 101, 114,
+115, 99, 97, 115, 101, 100, 111, 116, 104, 101, 114, 105, 100, 99, 111, 110,
+116, 105, 110, 117, 101, 99, 97, 107, 109, 105, 100, 101, 111, 103, 114, 97,
+112, 104, 105, 99, 115, 121, 109, 98, 111, 108, 115, 100, 117, 112, 108, 111,
+121, 97, 110, 109, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115,
+116, 101, 99, 104, 110, 105, 99, 97, 108, 100, 105, 101, 103, 121, 112, 116,
+105, 97, 110, 104, 105, 101, 114, 111, 103, 108, 121, 112, 104, 115, 108, 105,
+115, 117, 115, 117, 112, 112, 115, 97, 108, 116, 101, 114, 112, 97, 104, 108,
+97, 118, 105, 109, 101, 110, 100, 101, 107, 105, 107, 97, 107, 117, 105,
+};
+const PropertyNameEntry _property_names[] = {
+{0, 6, 2, PropertyType::Script, 0x4A}, {6, 7, 3, PropertyType::Block, 0x12E},
+{13, 15, 3, PropertyType::Block, 0x39}, {28, 4, 2, PropertyType::Script, 0x4D},
+{32, 4, 2, PropertyType::Script, 0x3F}, {36, 9, 3, PropertyType::Block, 0x4},
+{45, 15, 3, PropertyType::Block, 0x93}, {60, 8, 3, PropertyType::Block, 0x24},
+{68, 20, 3, PropertyType::Block, 0x57}, {88, 4, 2, PropertyType::Script, 0x79},
+{92, 4, 2, PropertyType::Script, 0x1A}, {96, 4, 2, PropertyType::Script, 0x62},
+{100, 4, 2, PropertyType::Script, 0x90},
+{104, 22, 3, PropertyType::Block, 0x4B},
+{126, 10, 3, PropertyType::Block, 0x98},
+{136, 24, 3, PropertyType::Block, 0x96},
+{160, 9, 1, PropertyType::General_Category, 0x1C00000},
+{169, 5, 0, PropertyType::Property, 0x10000},
+{174, 4, 2, PropertyType::Script, 0x78},
+{178, 27, 3, PropertyType::Block, 0x9A},
+{205, 8, 2, PropertyType::Script, 0x1B},
+{213, 2, 1, PropertyType::General_Category, 0x800},
+{215, 16, 3, PropertyType::Block, 0x14}, {231, 5, 3, PropertyType::Block, 0x7E},
+{236, 7, 2, PropertyType::Script, 0x81},
+{243, 3, 2, PropertyType::Script, 0x15},
+{246, 8, 2, PropertyType::Script, 0x3A},
+{254, 2, 1, PropertyType::General_Category, 0x100000},
+{256, 21, 0, PropertyType::Derived_Property, 0x80},
+{277, 4, 2, PropertyType::Script, 0x2F},
+{281, 15, 3, PropertyType::Block, 0xBA},
+{296, 8, 2, PropertyType::Script, 0x6F},
+{304, 2, 5, PropertyType::Word_Break, 0xF},
+{306, 2, 1, PropertyType::General_Category, 0x80},
+{308, 4, 2, PropertyType::Script, 0x6B},
+{312, 35, 3, PropertyType::Block, 0x4B},
+{347, 8, 0, PropertyType::Property, 0x2000},
+{355, 8, 3, PropertyType::Block, 0xFB}, {363, 7, 3, PropertyType::Block, 0x0},
+{370, 9, 3, PropertyType::Block, 0x61}, {379, 4, 2, PropertyType::Script, 0x96},
+{383, 17, 2, PropertyType::Script, 0x9B},
+{400, 3, 0, PropertyType::Derived_Property, 0x100},
+{403, 21, 0, PropertyType::Derived_Property, 0x40},
+{424, 4, 2, PropertyType::Script, 0x84},
+{428, 15, 3, PropertyType::Block, 0x56},
+{443, 3, 0, PropertyType::Derived_Property, 0x80},
+{446, 30, 3, PropertyType::Block, 0x11D},
+{476, 9, 0, PropertyType::Property, 0x80},
+{485, 11, 0, PropertyType::Derived_Property, 0x4000},
+{496, 10, 3, PropertyType::Block, 0x6B},
+{506, 4, 2, PropertyType::Script, 0x29}, {510, 4, 2, PropertyType::Script, 0xF},
+{514, 6, 2, PropertyType::Script, 0x4B},
+{520, 2, 1, PropertyType::General_Category, 0x200},
+{522, 14, 0, PropertyType::Property, 0x8000},
+{536, 9, 2, PropertyType::Script, 0x77}, {545, 6, 3, PropertyType::Block, 0xAA},
+{551, 4, 2, PropertyType::Script, 0x19},
+{555, 14, 3, PropertyType::Block, 0x44},
+{569, 4, 2, PropertyType::Script, 0x87}, {573, 5, 3, PropertyType::Block, 0x34},
+{578, 26, 3, PropertyType::Block, 0x73},
+{604, 10, 5, PropertyType::Word_Break, 0x0},
+{614, 15, 3, PropertyType::Block, 0x11F},
+{629, 4, 2, PropertyType::Script, 0x8E}, {633, 5, 2, PropertyType::Script, 0x3},
+{638, 3, 0, PropertyType::Block, 0x0},
+{641, 2, 6, PropertyType::Sentence_Break, 0x9},
+{643, 20, 1, PropertyType::General_Category, 0x800},
+{663, 22, 3, PropertyType::Block, 0x82}, {685, 8, 2, PropertyType::Script, 0x5},
+{693, 10, 3, PropertyType::Block, 0xC2},
+{703, 2, 2, PropertyType::Script, 0x25}, {705, 7, 3, PropertyType::Block, 0x83},
+{712, 18, 3, PropertyType::Block, 0x106},
+{730, 33, 3, PropertyType::Block, 0x5E},
+{763, 16, 1, PropertyType::General_Category, 0x4000},
+{779, 5, 2, PropertyType::Script, 0x84},
+{784, 6, 0, PropertyType::Derived_Property, 0x20000},
+{790, 10, 0, PropertyType::Derived_Property, 0x1000},
+{800, 9, 3, PropertyType::Block, 0xF}, {809, 5, 3, PropertyType::Block, 0x132},
+{814, 13, 0, PropertyType::Sentence_Break, 0x0},
+{827, 6, 1, PropertyType::General_Category, 0x700},
+{833, 8, 3, PropertyType::Block, 0x3A}, {841, 6, 3, PropertyType::Block, 0xC},
+{847, 4, 2, PropertyType::Script, 0x5D},
+{851, 21, 3, PropertyType::Block, 0x8E},
+{872, 4, 2, PropertyType::Script, 0x71},
+{876, 6, 2, PropertyType::Script, 0x89},
+{882, 10, 2, PropertyType::Script, 0x3C},
+{892, 4, 2, PropertyType::Script, 0x69},
+{896, 4, 2, PropertyType::Script, 0x5E}, {900, 6, 3, PropertyType::Block, 0xD3},
+{906, 24, 3, PropertyType::Block, 0xA1},
+{930, 5, 0, PropertyType::Property, 0x200000},
+{935, 5, 2, PropertyType::Script, 0xF}, {940, 4, 2, PropertyType::Script, 0x77},
+{944, 2, 4, PropertyType::Grapheme_Cluster_Break, 0xB},
+{946, 9, 3, PropertyType::Block, 0x90},
+{955, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x7},
+{957, 9, 3, PropertyType::Block, 0xDC}, {966, 13, 3, PropertyType::Block, 0x47},
+{979, 5, 3, PropertyType::Block, 0xE3}, {984, 16, 3, PropertyType::Block, 0xA4},
+{1000, 2, 3, PropertyType::Block, 0x0},
+{1002, 1, 4, PropertyType::Grapheme_Cluster_Break, 0xA},
+{1003, 6, 3, PropertyType::Block, 0x2},
+{1009, 1, 1, PropertyType::General_Category, 0x700},
+{1010, 17, 3, PropertyType::Block, 0x10C},
+{1027, 16, 3, PropertyType::Block, 0x75},
+{1043, 12, 3, PropertyType::Block, 0x11C},
+{1055, 5, 3, PropertyType::Block, 0x10B},
+{1060, 4, 2, PropertyType::Script, 0x11},
+{1064, 24, 3, PropertyType::Block, 0x126},
+{1088, 4, 2, PropertyType::Script, 0x72},
+{1092, 8, 2, PropertyType::Script, 0x36},
+{1100, 2, 6, PropertyType::Sentence_Break, 0x1},
+{1102, 4, 2, PropertyType::Script, 0x6D},
+{1106, 1, 4, PropertyType::Grapheme_Cluster_Break, 0x8},
+{1107, 10, 2, PropertyType::Script, 0x3D},
+{1117, 7, 3, PropertyType::Block, 0x22},
+{1124, 16, 3, PropertyType::Block, 0x40},
+{1140, 10, 2, PropertyType::Script, 0x94},
+{1150, 21, 3, PropertyType::Block, 0x68},
+{1171, 35, 3, PropertyType::Block, 0x45},
+{1206, 8, 3, PropertyType::Block, 0x18},
+{1214, 2, 0, PropertyType::Word_Break, 0x0},
+{1216, 16, 3, PropertyType::Block, 0x5D},
+{1232, 4, 2, PropertyType::Script, 0x58},
+{1236, 2, 6, PropertyType::Sentence_Break, 0x3},
+{1238, 17, 3, PropertyType::Block, 0x4C},
+{1255, 7, 0, PropertyType::Derived_Property, 0x800},
+{1262, 4, 2, PropertyType::Script, 0x7C},
+{1266, 6, 3, PropertyType::Block, 0xBD},
+{1272, 3, 0, PropertyType::Property, 0x100},
+{1275, 23, 3, PropertyType::Block, 0x124},
+{1298, 17, 3, PropertyType::Block, 0x117},
+{1315, 15, 2, PropertyType::Script, 0x57},
+{1330, 15, 3, PropertyType::Block, 0xC1},
+{1345, 3, 0, PropertyType::Derived_Property, 0x1000},
+{1348, 4, 2, PropertyType::Script, 0x3A},
+{1352, 17, 3, PropertyType::Block, 0x123},
+{1369, 2, 5, PropertyType::Word_Break, 0xA},
+{1371, 4, 3, PropertyType::Block, 0x25},
+{1375, 9, 3, PropertyType::Block, 0x9E},
+{1384, 28, 3, PropertyType::Block, 0x132},
+{1412, 4, 2, PropertyType::Script, 0x23},
+{1416, 8, 0, PropertyType::Derived_Property, 0x2000},
+{1424, 14, 3, PropertyType::Block, 0x95},
+{1438, 16, 3, PropertyType::Block, 0xA2},
+{1454, 17, 3, PropertyType::Block, 0x66},
+{1471, 19, 3, PropertyType::Block, 0x5A},
+{1490, 6, 2, PropertyType::Script, 0x60},
+{1496, 32, 3, PropertyType::Block, 0xF7},
+{1528, 5, 3, PropertyType::Block, 0x30},
+{1533, 13, 3, PropertyType::Block, 0x9D},
+{1546, 10, 3, PropertyType::Block, 0xB1},
+{1556, 12, 3, PropertyType::Block, 0x110},
+{1568, 8, 3, PropertyType::Block, 0x6E},
+{1576, 8, 3, PropertyType::Block, 0xA3},
+{1584, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x5},
+{1586, 4, 2, PropertyType::Script, 0x89},
+{1590, 14, 3, PropertyType::Block, 0x8},
+{1604, 4, 2, PropertyType::Script, 0xA},
+{1608, 3, 3, PropertyType::Block, 0x98},
+{1611, 9, 3, PropertyType::Block, 0xEC},
+{1620, 9, 3, PropertyType::Block, 0x3B},
+{1629, 11, 1, PropertyType::General_Category, 0x200000},
+{1640, 8, 2, PropertyType::Script, 0xC},
+{1648, 4, 3, PropertyType::Block, 0x20},
+{1652, 6, 2, PropertyType::Script, 0x37},
+{1658, 6, 2, PropertyType::Script, 0x6},
+{1664, 7, 3, PropertyType::Block, 0x86},
+{1671, 7, 1, PropertyType::General_Category, 0x2000000},
+{1678, 16, 3, PropertyType::Block, 0x71},
+{1694, 16, 3, PropertyType::Block, 0xF4},
+{1710, 6, 2, PropertyType::Script, 0x10},
+{1716, 4, 2, PropertyType::Script, 0x16},
+{1720, 4, 2, PropertyType::Script, 0x7E},
+{1724, 30, 3, PropertyType::Block, 0x12D},
+{1754, 4, 0, PropertyType::Derived_Property, 0x400},
+{1758, 4, 2, PropertyType::Script, 0x5F},
+{1762, 2, 6, PropertyType::Sentence_Break, 0xB},
+{1764, 2, 1, PropertyType::General_Category, 0x4},
+{1766, 18, 2, PropertyType::Script, 0x1C},
+{1784, 7, 2, PropertyType::Script, 0x6B},
+{1791, 7, 3, PropertyType::Block, 0xB8},
+{1798, 7, 3, PropertyType::Block, 0x76},
+{1805, 18, 3, PropertyType::Block, 0x10E},
+{1823, 8, 3, PropertyType::Block, 0x2F},
+{1831, 4, 2, PropertyType::Script, 0x40},
+{1835, 6, 3, PropertyType::Block, 0x62},
+{1841, 4, 0, PropertyType::Property, 0x200},
+{1845, 18, 1, PropertyType::General_Category, 0x8000},
+{1863, 6, 3, PropertyType::Block, 0x3D},
+{1869, 7, 2, PropertyType::Script, 0x11},
+{1876, 4, 2, PropertyType::Script, 0xC},
+{1880, 4, 2, PropertyType::Script, 0x17},
+{1884, 36, 3, PropertyType::Block, 0x12F},
+{1920, 11, 1, PropertyType::General_Category, 0x3F800},
+{1931, 14, 1, PropertyType::General_Category, 0x8},
+{1945, 14, 3, PropertyType::Block, 0x61},
+{1959, 2, 1, PropertyType::General_Category, 0x800000},
+{1961, 6, 2, PropertyType::Script, 0x6D},
+{1967, 7, 6, PropertyType::Sentence_Break, 0x9},
+{1974, 5, 0, PropertyType::Property, 0x20},
+{1979, 17, 3, PropertyType::Block, 0x3F},
+{1996, 3, 2, PropertyType::Script, 0x46},
+{1999, 16, 3, PropertyType::Block, 0xA5},
+{2015, 23, 3, PropertyType::Block, 0x109},
+{2038, 5, 2, PropertyType::Script, 0x66},
+{2043, 6, 2, PropertyType::Script, 0x49},
+{2049, 4, 2, PropertyType::Script, 0x9B},
+{2053, 12, 2, PropertyType::Script, 0x8A},
+{2065, 2, 1, PropertyType::General_Category, 0x10000},
+{2067, 17, 3, PropertyType::Block, 0xB7},
+{2084, 30, 3, PropertyType::Block, 0xF4},
+{2114, 11, 3, PropertyType::Block, 0x10E},
+{2125, 6, 5, PropertyType::Word_Break, 0x7},
+{2131, 2, 6, PropertyType::Sentence_Break, 0x8},
+{2133, 2, 6, PropertyType::Sentence_Break, 0x2},
+{2135, 4, 0, PropertyType::Derived_Property, 0x4000},
+{2139, 17, 4, PropertyType::Grapheme_Cluster_Break, 0x6},
+{2156, 15, 0, PropertyType::General_Category, 0x0},
+{2171, 18, 3, PropertyType::Block, 0xAC},
+{2189, 11, 3, PropertyType::Block, 0x8C},
+{2200, 9, 3, PropertyType::Block, 0x120},
+{2209, 14, 0, PropertyType::Property, 0x4000},
+{2223, 10, 3, PropertyType::Block, 0x25},
+{2233, 4, 2, PropertyType::Script, 0x3B},
+{2237, 4, 2, PropertyType::Script, 0x64},
+{2241, 4, 2, PropertyType::Script, 0x52},
+{2245, 17, 3, PropertyType::Block, 0x29},
+{2262, 2, 6, PropertyType::Sentence_Break, 0x7},
+{2264, 28, 3, PropertyType::Block, 0x134},
+{2292, 12, 0, PropertyType::Property, 0x4000000},
+{2304, 4, 2, PropertyType::Script, 0x0},
+{2308, 15, 2, PropertyType::Script, 0x61},
+{2323, 6, 3, PropertyType::Block, 0x70},
+{2329, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x4},
+{2331, 9, 2, PropertyType::Script, 0x29},
+{2340, 9, 3, PropertyType::Block, 0xAF},
+{2349, 10, 2, PropertyType::Script, 0x7D},
+{2359, 10, 3, PropertyType::Block, 0x5A},
+{2369, 4, 2, PropertyType::Script, 0x26},
+{2373, 4, 3, PropertyType::Block, 0x29},
+{2377, 5, 0, PropertyType::Derived_Property, 0x2},
+{2382, 4, 2, PropertyType::Script, 0x53},
+{2386, 4, 2, PropertyType::Script, 0x1E},
+{2390, 11, 3, PropertyType::Block, 0x4D},
+{2401, 4, 2, PropertyType::Script, 0x7A},
+{2405, 7, 2, PropertyType::Script, 0x41},
+{2412, 5, 2, PropertyType::Script, 0x2},
+{2417, 18, 3, PropertyType::Block, 0x9C},
+{2435, 4, 2, PropertyType::Script, 0x4C},
+{2439, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x0},
+{2441, 4, 2, PropertyType::Script, 0x51},
+{2445, 9, 3, PropertyType::Block, 0x80},
+{2454, 7, 3, PropertyType::Block, 0xDF},
+{2461, 4, 3, PropertyType::Block, 0xCD},
+{2465, 23, 3, PropertyType::Block, 0x67},
+{2488, 4, 2, PropertyType::Script, 0x30},
+{2492, 6, 1, PropertyType::General_Category, 0x4000000},
+{2498, 12, 5, PropertyType::Word_Break, 0x3},
+{2510, 6, 3, PropertyType::Block, 0x114},
+{2516, 4, 2, PropertyType::Script, 0x9A},
+{2520, 9, 6, PropertyType::Sentence_Break, 0xE},
+{2529, 4, 2, PropertyType::Script, 0x70},
+{2533, 28, 3, PropertyType::Block, 0x44},
+{2561, 18, 0, PropertyType::Property, 0x80000},
+{2579, 23, 3, PropertyType::Block, 0x6F},
+{2602, 10, 3, PropertyType::Block, 0x125},
+{2612, 3, 3, PropertyType::Block, 0x78},
+{2615, 2, 5, PropertyType::Word_Break, 0x10},
+{2617, 11, 3, PropertyType::Block, 0x8A},
+{2628, 2, 1, PropertyType::General_Category, 0x80000},
+{2630, 19, 3, PropertyType::Block, 0x99},
+{2649, 4, 3, PropertyType::Block, 0x131},
+{2653, 2, 0, PropertyType::Property, 0x200000000},
+{2655, 4, 2, PropertyType::Script, 0x46},
+{2659, 11, 1, PropertyType::General_Category, 0x400},
+{2670, 12, 3, PropertyType::Block, 0xEF},
+{2682, 13, 0, PropertyType::Property, 0x200},
+{2695, 12, 3, PropertyType::Block, 0x127},
+{2707, 22, 3, PropertyType::Block, 0x6},
+{2729, 5, 0, PropertyType::Property, 0x2},
+{2734, 7, 3, PropertyType::Block, 0x13},
+{2741, 10, 2, PropertyType::Script, 0x9A},
+{2751, 4, 2, PropertyType::Script, 0xB},
+{2755, 7, 3, PropertyType::Block, 0xF0},
+{2762, 5, 2, PropertyType::Script, 0x8B},
+{2767, 4, 2, PropertyType::Script, 0x98},
+{2771, 3, 0, PropertyType::Property, 0x400000},
+{2774, 7, 2, PropertyType::Script, 0x6A},
+{2781, 14, 3, PropertyType::Block, 0x4},
+{2795, 4, 2, PropertyType::Script, 0x37},
+{2799, 15, 3, PropertyType::Block, 0x45},
+{2814, 6, 3, PropertyType::Block, 0x69},
+{2820, 2, 1, PropertyType::General_Category, 0x20000},
+{2822, 4, 2, PropertyType::Script, 0x4B},
+{2826, 6, 1, PropertyType::General_Category, 0x1F},
+{2832, 4, 2, PropertyType::Script, 0x8F},
+{2836, 6, 2, PropertyType::Script, 0x44},
+{2842, 7, 2, PropertyType::Script, 0x8C},
+{2849, 11, 2, PropertyType::Script, 0x3B},
+{2860, 7, 3, PropertyType::Block, 0x130},
+{2867, 4, 2, PropertyType::Script, 0x6C},
+{2871, 11, 3, PropertyType::Block, 0x71},
+{2882, 6, 2, PropertyType::Script, 0x19},
+{2888, 28, 3, PropertyType::Block, 0x133},
+{2916, 4, 2, PropertyType::Script, 0x44},
+{2920, 10, 3, PropertyType::Block, 0x5C},
+{2930, 11, 3, PropertyType::Block, 0xFD},
+{2941, 3, 6, PropertyType::Sentence_Break, 0x4},
+{2944, 30, 3, PropertyType::Block, 0x128},
+{2974, 12, 2, PropertyType::Script, 0x8F},
+{2986, 7, 3, PropertyType::Block, 0xD2},
+{2993, 20, 3, PropertyType::Block, 0xC8},
+{3013, 7, 3, PropertyType::Block, 0xD8},
+{3020, 2, 1, PropertyType::General_Category, 0x2000000},
+{3022, 30, 3, PropertyType::Block, 0x76},
+{3052, 9, 2, PropertyType::Script, 0x3F},
+{3061, 9, 3, PropertyType::Block, 0x31},
+{3070, 14, 1, PropertyType::General_Category, 0x80000},
+{3084, 25, 3, PropertyType::Block, 0x7},
+{3109, 8, 3, PropertyType::Block, 0x58},
+{3117, 2, 5, PropertyType::Word_Break, 0xD},
+{3119, 14, 3, PropertyType::Block, 0x10B},
+{3133, 5, 0, PropertyType::Property, 0x10000000},
+{3138, 10, 6, PropertyType::Sentence_Break, 0x0},
+{3148, 13, 0, PropertyType::Derived_Property, 0x20},
+{3161, 4, 2, PropertyType::Script, 0x67},
+{3165, 7, 2, PropertyType::Script, 0x7C},
+{3172, 5, 2, PropertyType::Script, 0x54},
+{3177, 15, 3, PropertyType::Block, 0xC4},
+{3192, 4, 2, PropertyType::Script, 0x29},
+{3196, 3, 2, PropertyType::Script, 0x73},
+{3199, 4, 2, PropertyType::Script, 0x5A},
+{3203, 13, 3, PropertyType::Block, 0xA6},
+{3216, 2, 5, PropertyType::Word_Break, 0xE},
+{3218, 17, 3, PropertyType::Block, 0x7D},
+{3235, 1, 4, PropertyType::Grapheme_Cluster_Break, 0x9},
+{3236, 11, 2, PropertyType::Script, 0x6C},
+{3247, 5, 4, PropertyType::Grapheme_Cluster_Break, 0x0},
+{3252, 11, 3, PropertyType::Block, 0x49},
+{3263, 10, 3, PropertyType::Block, 0x6F},
+{3273, 13, 3, PropertyType::Block, 0x10D},
+{3286, 11, 3, PropertyType::Block, 0x11B},
+{3297, 4, 1, PropertyType::General_Category, 0xE0},
+{3301, 4, 2, PropertyType::Script, 0x24},
+{3305, 4, 2, PropertyType::Script, 0x65},
+{3309, 7, 3, PropertyType::Block, 0x1D},
+{3316, 3, 2, PropertyType::Script, 0x24},
+{3319, 17, 3, PropertyType::Block, 0x8F},
+{3336, 5, 2, PropertyType::Script, 0x2E},
+{3341, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x6},
+{3343, 6, 2, PropertyType::Script, 0x4C},
+{3349, 7, 3, PropertyType::Block, 0xC6},
+{3356, 21, 3, PropertyType::Block, 0x4F},
+{3377, 10, 4, PropertyType::Grapheme_Cluster_Break, 0x0},
+{3387, 4, 2, PropertyType::Script, 0x8A},
+{3391, 6, 2, PropertyType::Script, 0x7},
+{3397, 7, 2, PropertyType::Script, 0x50},
+{3404, 12, 3, PropertyType::Block, 0x7},
+{3416, 6, 2, PropertyType::Script, 0x27},
+{3422, 9, 2, PropertyType::Script, 0x85},
+{3431, 16, 3, PropertyType::Block, 0x8C},
+{3447, 4, 2, PropertyType::Script, 0x6A},
+{3451, 5, 3, PropertyType::Block, 0x2B},
+{3456, 14, 1, PropertyType::General_Category, 0x400000},
+{3470, 4, 2, PropertyType::Script, 0x66},
+{3474, 3, 3, PropertyType::Block, 0xFA},
+{3477, 15, 3, PropertyType::Block, 0xF9},
+{3492, 11, 3, PropertyType::Block, 0x73},
+{3503, 9, 2, PropertyType::Script, 0x12},
+{3512, 9, 5, PropertyType::Word_Break, 0xE},
+{3521, 19, 3, PropertyType::Block, 0x7F},
+{3540, 15, 2, PropertyType::Script, 0x74},
+{3555, 17, 2, PropertyType::Script, 0x67},
+{3572, 5, 6, PropertyType::Sentence_Break, 0x0},
+{3577, 5, 1, PropertyType::General_Category, 0x100},
+{3582, 4, 2, PropertyType::Script, 0x8C},
+{3586, 15, 3, PropertyType::Block, 0x122},
+{3601, 11, 5, PropertyType::Word_Break, 0x1},
+{3612, 2, 1, PropertyType::General_Category, 0x7},
+{3614, 15, 2, PropertyType::Script, 0x8D},
+{3629, 19, 3, PropertyType::Block, 0x41},
+{3648, 3, 0, PropertyType::Property, 0x100000000},
+{3651, 18, 3, PropertyType::Block, 0x43},
+{3669, 8, 2, PropertyType::Script, 0x23},
+{3677, 2, 5, PropertyType::Word_Break, 0x6},
+{3679, 13, 1, PropertyType::General_Category, 0x100},
+{3692, 24, 3, PropertyType::Block, 0x4B},
+{3716, 11, 4, PropertyType::Grapheme_Cluster_Break, 0x7},
+{3727, 4, 2, PropertyType::Script, 0x4},
+{3731, 9, 2, PropertyType::Script, 0x76},
+{3740, 3, 4, PropertyType::Grapheme_Cluster_Break, 0xC},
+{3743, 21, 0, PropertyType::Property, 0x2000000},
+{3764, 16, 1, PropertyType::General_Category, 0x20000},
+{3780, 11, 3, PropertyType::Block, 0x91},
+{3791, 4, 2, PropertyType::Script, 0x8D},
+{3795, 2, 6, PropertyType::Sentence_Break, 0x6},
+{3797, 4, 2, PropertyType::Script, 0x94},
+{3801, 4, 2, PropertyType::Script, 0x14},
+{3805, 7, 3, PropertyType::Block, 0x8D},
+{3812, 4, 3, PropertyType::Block, 0x7B},
+{3816, 14, 3, PropertyType::Block, 0x90},
+{3830, 21, 3, PropertyType::Block, 0xA},
+{3851, 11, 3, PropertyType::Block, 0x92},
+{3862, 2, 1, PropertyType::General_Category, 0x8000000},
+{3864, 9, 2, PropertyType::Script, 0x78},
+{3873, 13, 1, PropertyType::General_Category, 0xE0},
+{3886, 9, 2, PropertyType::Script, 0x7B},
+{3895, 17, 0, PropertyType::Property, 0x40000000},
+{3912, 14, 2, PropertyType::Script, 0x92},
+{3926, 7, 0, PropertyType::Property, 0x100000},
+{3933, 14, 3, PropertyType::Block, 0x68},
+{3947, 4, 0, PropertyType::Derived_Property, 0x200},
+{3951, 8, 2, PropertyType::Script, 0x2D},
+{3959, 8, 2, PropertyType::Script, 0xD},
+{3967, 7, 2, PropertyType::Script, 0x34},
+{3974, 4, 2, PropertyType::Script, 0x4F},
+{3978, 10, 3, PropertyType::Block, 0x7A},
+{3988, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x3},
+{3990, 18, 3, PropertyType::Block, 0x9E},
+{4008, 11, 3, PropertyType::Block, 0x57},
+{4019, 5, 2, PropertyType::Script, 0x2F},
+{4024, 8, 3, PropertyType::Block, 0xD7},
+{4032, 4, 2, PropertyType::Script, 0x82},
+{4036, 13, 0, PropertyType::Property, 0x80000000},
+{4049, 8, 3, PropertyType::Block, 0x19},
+{4057, 33, 3, PropertyType::Block, 0x59},
+{4090, 29, 3, PropertyType::Block, 0x11E},
+{4119, 2, 6, PropertyType::Sentence_Break, 0x4},
+{4121, 21, 0, PropertyType::Derived_Property, 0x100},
+{4142, 6, 3, PropertyType::Block, 0xE},
+{4148, 10, 3, PropertyType::Block, 0x60},
+{4158, 12, 3, PropertyType::Block, 0x36},
+{4170, 9, 2, PropertyType::Script, 0x5B},
+{4179, 25, 0, PropertyType::Derived_Property, 0x8000},
+{4204, 7, 3, PropertyType::Block, 0x1F},
+{4211, 7, 3, PropertyType::Block, 0xDB},
+{4218, 14, 3, PropertyType::Block, 0x98},
+{4232, 25, 3, PropertyType::Block, 0x128},
+{4257, 2, 1, PropertyType::General_Category, 0x20},
+{4259, 7, 3, PropertyType::Block, 0xB6},
+{4266, 4, 2, PropertyType::Script, 0x7D},
+{4270, 10, 3, PropertyType::Block, 0x1},
+{4280, 4, 2, PropertyType::Script, 0x63},
+{4284, 4, 2, PropertyType::Script, 0x48},
+{4288, 19, 3, PropertyType::Block, 0x118},
+{4307, 3, 3, PropertyType::Block, 0x7C},
+{4310, 5, 3, PropertyType::Block, 0xE5},
+{4315, 5, 3, PropertyType::Block, 0x33},
+{4320, 4, 2, PropertyType::Script, 0x61},
+{4324, 4, 2, PropertyType::Script, 0x80},
+{4328, 16, 3, PropertyType::Block, 0x59},
+{4344, 9, 2, PropertyType::Script, 0x38},
+{4353, 4, 2, PropertyType::Script, 0x56},
+{4357, 16, 0, PropertyType::Property, 0x200000},
+{4373, 9, 2, PropertyType::Script, 0x20},
+{4382, 2, 6, PropertyType::Sentence_Break, 0xA},
+{4384, 35, 3, PropertyType::Block, 0x119},
+{4419, 15, 3, PropertyType::Block, 0xE9},
+{4434, 17, 0, PropertyType::Property, 0x200000000},
+{4451, 18, 3, PropertyType::Block, 0xA},
+{4469, 4, 2, PropertyType::Script, 0x3E},
+{4473, 18, 3, PropertyType::Block, 0xCD},
+{4491, 6, 4, PropertyType::Grapheme_Cluster_Break, 0x5},
+{4497, 10, 3, PropertyType::Block, 0x16},
+{4507, 4, 2, PropertyType::Script, 0x91},
+{4511, 14, 0, PropertyType::Derived_Property, 0x10000},
+{4525, 7, 2, PropertyType::Script, 0x6E},
+{4532, 9, 2, PropertyType::Script, 0x75},
+{4541, 7, 5, PropertyType::Word_Break, 0x6},
+{4548, 11, 2, PropertyType::Script, 0x96},
+{4559, 32, 3, PropertyType::Block, 0xFF},
+{4591, 4, 2, PropertyType::Script, 0x55},
+{4595, 4, 2, PropertyType::Script, 0x37},
+{4599, 4, 2, PropertyType::Script, 0x35},
+{4603, 6, 2, PropertyType::Script, 0x5C},
+{4609, 5, 6, PropertyType::Sentence_Break, 0xB},
+{4614, 4, 2, PropertyType::Script, 0x1B},
+{4618, 14, 3, PropertyType::Block, 0x8E},
+{4632, 8, 3, PropertyType::Block, 0xB0}, {4640, 6, 3, PropertyType::Block, 0x5},
+{4646, 4, 2, PropertyType::Script, 0x6},
+{4650, 4, 2, PropertyType::Script, 0x73},
+{4654, 8, 3, PropertyType::Block, 0x94},
+{4662, 16, 3, PropertyType::Block, 0x96},
+{4678, 4, 2, PropertyType::Script, 0x4E},
+{4682, 2, 1, PropertyType::General_Category, 0x10000000},
+{4684, 7, 3, PropertyType::Block, 0x38},
+{4691, 11, 3, PropertyType::Block, 0xFC},
+{4702, 4, 2, PropertyType::Script, 0x33},
+{4706, 12, 3, PropertyType::Block, 0x3F},
+{4718, 17, 3, PropertyType::Block, 0x102},
+{4735, 12, 2, PropertyType::Script, 0x82},
+{4747, 16, 3, PropertyType::Block, 0xF},
+{4763, 6, 3, PropertyType::Block, 0x87},
+{4769, 10, 1, PropertyType::General_Category, 0x20000000},
+{4779, 6, 0, PropertyType::Property, 0x1},
+{4785, 4, 2, PropertyType::Script, 0x13},
+{4789, 10, 2, PropertyType::Script, 0x99},
+{4799, 4, 2, PropertyType::Script, 0x57},
+{4803, 7, 2, PropertyType::Script, 0x2A},
+{4810, 4, 2, PropertyType::Script, 0x75},
+{4814, 7, 3, PropertyType::Block, 0x32},
+{4821, 7, 3, PropertyType::Block, 0x12A},
+{4828, 11, 2, PropertyType::Script, 0x91},
+{4839, 7, 2, PropertyType::Script, 0x86},
+{4846, 1, 1, PropertyType::General_Category, 0x1F},
+{4847, 19, 3, PropertyType::Block, 0x94},
+{4866, 4, 2, PropertyType::Script, 0x63},
+{4870, 4, 2, PropertyType::Script, 0x59},
+{4874, 10, 3, PropertyType::Block, 0x54},
+{4884, 7, 3, PropertyType::Block, 0x133},
+{4891, 8, 3, PropertyType::Block, 0x26},
+{4899, 7, 3, PropertyType::Block, 0xDD},
+{4906, 4, 2, PropertyType::Script, 0x45},
+{4910, 10, 3, PropertyType::Block, 0xD1},
+{4920, 8, 3, PropertyType::Block, 0x37},
+{4928, 6, 0, PropertyType::Property, 0x10},
+{4934, 16, 3, PropertyType::Block, 0x103},
+{4950, 27, 3, PropertyType::Block, 0x74},
+{4977, 13, 3, PropertyType::Block, 0x85},
+{4990, 9, 3, PropertyType::Block, 0x3},
+{4999, 27, 3, PropertyType::Block, 0x52},
+{5026, 12, 3, PropertyType::Block, 0x8F},
+{5038, 14, 3, PropertyType::Block, 0xC9},
+{5052, 7, 2, PropertyType::Script, 0x13},
+{5059, 11, 1, PropertyType::General_Category, 0x7},
+{5070, 7, 3, PropertyType::Block, 0xED},
+{5077, 4, 2, PropertyType::Script, 0x5},
+{5081, 16, 3, PropertyType::Block, 0x82},
+{5097, 6, 0, PropertyType::Derived_Property, 0x40000},
+{5103, 10, 2, PropertyType::Script, 0x0},
+{5113, 9, 3, PropertyType::Block, 0x1E},
+{5122, 2, 5, PropertyType::Word_Break, 0x4},
+{5124, 7, 4, PropertyType::Grapheme_Cluster_Break, 0x1},
+{5131, 20, 3, PropertyType::Block, 0x78},
+{5151, 4, 2, PropertyType::Script, 0x8},
+{5155, 6, 3, PropertyType::Block, 0xAB},
+{5161, 8, 3, PropertyType::Block, 0xF2},
+{5169, 9, 3, PropertyType::Block, 0x14},
+{5178, 13, 3, PropertyType::Block, 0x112},
+{5191, 7, 3, PropertyType::Block, 0x12D},
+{5198, 10, 1, PropertyType::General_Category, 0x10000000},
+{5208, 2, 1, PropertyType::General_Category, 0x10},
+{5210, 7, 6, PropertyType::Sentence_Break, 0xA},
+{5217, 21, 3, PropertyType::Block, 0xC7},
+{5238, 7, 3, PropertyType::Block, 0x17},
+{5245, 4, 2, PropertyType::Script, 0x15},
+{5249, 5, 3, PropertyType::Block, 0x2A},
+{5254, 2, 5, PropertyType::Word_Break, 0xB},
+{5256, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x2},
+{5258, 4, 2, PropertyType::Script, 0x34},
+{5262, 8, 3, PropertyType::Block, 0x9},
+{5270, 12, 3, PropertyType::Block, 0xEE},
+{5282, 4, 2, PropertyType::Script, 0x93},
+{5286, 11, 3, PropertyType::Block, 0x40},
+{5297, 2, 0, PropertyType::Sentence_Break, 0x0},
+{5299, 14, 3, PropertyType::Block, 0xA8},
+{5313, 4, 3, PropertyType::Block, 0xDE},
+{5317, 9, 3, PropertyType::Block, 0xCA},
+{5326, 6, 2, PropertyType::Script, 0x8},
+{5332, 22, 3, PropertyType::Block, 0xF5},
+{5354, 10, 0, PropertyType::Property, 0x800000},
+{5364, 14, 3, PropertyType::Block, 0x9F},
+{5378, 10, 2, PropertyType::Script, 0x39},
+{5388, 6, 5, PropertyType::Word_Break, 0x9},
+{5394, 5, 3, PropertyType::Block, 0x107},
+{5399, 6, 0, PropertyType::Property, 0x80000000},
+{5405, 6, 0, PropertyType::Property, 0x20000},
+{5411, 6, 3, PropertyType::Block, 0x77},
+{5417, 4, 2, PropertyType::Script, 0x8B},
+{5421, 3, 0, PropertyType::Derived_Property, 0x800},
+{5424, 2, 5, PropertyType::Word_Break, 0x8},
+{5426, 4, 2, PropertyType::Script, 0x7F},
+{5430, 10, 3, PropertyType::Block, 0xA0},
+{5440, 1, 1, PropertyType::General_Category, 0xE0},
+{5441, 15, 1, PropertyType::General_Category, 0x2},
+{5456, 4, 2, PropertyType::Script, 0x27},
+{5460, 11, 1, PropertyType::General_Category, 0x10},
+{5471, 10, 3, PropertyType::Block, 0x119},
+{5481, 16, 3, PropertyType::Block, 0x8A},
+{5497, 19, 2, PropertyType::Script, 0x62},
+{5516, 7, 3, PropertyType::Block, 0x3E},
+{5523, 8, 2, PropertyType::Script, 0x1A},
+{5531, 6, 0, PropertyType::Property, 0x400},
+{5537, 4, 0, PropertyType::Property, 0x8000000},
+{5541, 5, 2, PropertyType::Script, 0x1F},
+{5546, 4, 2, PropertyType::Script, 0x99},
+{5550, 10, 3, PropertyType::Block, 0xC5},
+{5560, 11, 3, PropertyType::Block, 0x43},
+{5571, 9, 3, PropertyType::Block, 0xF3},
+{5580, 32, 3, PropertyType::Block, 0x6A},
+{5612, 8, 3, PropertyType::Block, 0x88},
+{5620, 26, 3, PropertyType::Block, 0xA2},
+{5646, 4, 2, PropertyType::Script, 0x42},
+{5650, 12, 3, PropertyType::Block, 0x9A},
+{5662, 7, 2, PropertyType::Script, 0xB},
+{5669, 6, 2, PropertyType::Script, 0x98},
+{5675, 5, 5, PropertyType::Word_Break, 0x0},
+{5680, 4, 2, PropertyType::Script, 0x86},
+{5684, 11, 0, PropertyType::Property, 0x4},
+{5695, 9, 5, PropertyType::Word_Break, 0xC},
+{5704, 19, 3, PropertyType::Block, 0xF6},
+{5723, 3, 5, PropertyType::Word_Break, 0x11},
+{5726, 7, 2, PropertyType::Script, 0x2B},
+{5733, 5, 0, PropertyType::Derived_Property, 0x8},
+{5738, 10, 3, PropertyType::Block, 0xCF},
+{5748, 5, 3, PropertyType::Block, 0x1A},
+{5753, 2, 6, PropertyType::Sentence_Break, 0xD},
+{5755, 4, 2, PropertyType::Script, 0x1F},
+{5759, 4, 2, PropertyType::Script, 0x12},
+{5763, 2, 5, PropertyType::Word_Break, 0xC},
+{5765, 18, 3, PropertyType::Block, 0x46},
+{5783, 4, 0, PropertyType::Property, 0x40000},
+{5787, 24, 3, PropertyType::Block, 0x6B},
+{5811, 4, 2, PropertyType::Script, 0x2E},
+{5815, 5, 0, PropertyType::Property, 0x80},
+{5820, 3, 0, PropertyType::Property, 0x1000},
+{5823, 4, 2, PropertyType::Script, 0x49},
+{5827, 6, 3, PropertyType::Block, 0xD},
+{5833, 19, 3, PropertyType::Block, 0xE2},
+{5852, 12, 3, PropertyType::Block, 0x106},
+{5864, 4, 2, PropertyType::Script, 0x1C},
+{5868, 4, 2, PropertyType::Script, 0x36},
+{5872, 9, 5, PropertyType::Word_Break, 0x12},
+{5881, 7, 3, PropertyType::Block, 0xB2},
+{5888, 3, 3, PropertyType::Block, 0x11},
+{5891, 6, 3, PropertyType::Block, 0x93},
+{5897, 9, 3, PropertyType::Block, 0x35},
+{5906, 4, 2, PropertyType::Script, 0x85},
+{5910, 5, 0, PropertyType::Property, 0x4},
+{5915, 26, 3, PropertyType::Block, 0x99},
+{5941, 9, 3, PropertyType::Block, 0x12},
+{5950, 11, 2, PropertyType::Script, 0x56},
+{5961, 15, 1, PropertyType::General_Category, 0x1},
+{5976, 9, 3, PropertyType::Block, 0xEB},
+{5985, 2, 1, PropertyType::General_Category, 0x1000},
+{5987, 4, 2, PropertyType::Script, 0x6E},
+{5991, 18, 3, PropertyType::Block, 0x121},
+{6009, 2, 5, PropertyType::Word_Break, 0x1},
+{6011, 3, 0, PropertyType::Grapheme_Cluster_Break, 0x0},
+{6014, 9, 3, PropertyType::Block, 0xBB},
+{6023, 8, 2, PropertyType::Script, 0x4},
+{6031, 2, 5, PropertyType::Word_Break, 0x5},
+{6033, 21, 0, PropertyType::Derived_Property, 0x200},
+{6054, 7, 3, PropertyType::Block, 0xB3},
+{6061, 16, 3, PropertyType::Block, 0xB9},
+{6077, 10, 3, PropertyType::Block, 0xE7},
+{6087, 10, 2, PropertyType::Script, 0x70},
+{6097, 4, 2, PropertyType::Script, 0x92},
+{6101, 20, 0, PropertyType::Grapheme_Cluster_Break, 0x0},
+{6121, 2, 1, PropertyType::General_Category, 0x4000},
+{6123, 6, 3, PropertyType::Block, 0x100},
+{6129, 2, 1, PropertyType::General_Category, 0x7},
+{6131, 7, 3, PropertyType::Block, 0x2C},
+{6138, 4, 2, PropertyType::Script, 0xD},
+{6142, 17, 0, PropertyType::Property, 0x20000000},
+{6159, 13, 3, PropertyType::Block, 0x55},
+{6172, 2, 1, PropertyType::General_Category, 0x40},
+{6174, 4, 0, PropertyType::Derived_Property, 0x1},
+{6178, 16, 1, PropertyType::General_Category, 0x10000},
+{6194, 12, 0, PropertyType::Derived_Property, 0x20000},
+{6206, 13, 1, PropertyType::General_Category, 0x800000},
+{6219, 2, 1, PropertyType::General_Category, 0x100},
+{6221, 30, 3, PropertyType::Block, 0x12A},
+{6251, 8, 3, PropertyType::Block, 0x28},
+{6259, 11, 3, PropertyType::Block, 0x79},
+{6270, 6, 6, PropertyType::Sentence_Break, 0x3},
+{6276, 5, 2, PropertyType::Script, 0x1D},
+{6281, 7, 2, PropertyType::Script, 0x0},
+{6288, 10, 0, PropertyType::Property, 0x1000000},
+{6298, 14, 3, PropertyType::Block, 0x104},
+{6312, 14, 3, PropertyType::Block, 0x80},
+{6326, 4, 2, PropertyType::Script, 0x6F},
+{6330, 6, 0, PropertyType::Script, 0x0},
+{6336, 4, 2, PropertyType::Script, 0x7B},
+{6340, 15, 2, PropertyType::Script, 0x58},
+{6355, 4, 2, PropertyType::Script, 0x7},
+{6359, 6, 3, PropertyType::Block, 0x4E},
+{6365, 7, 3, PropertyType::Block, 0x5B},
+{6372, 9, 3, PropertyType::Block, 0xAD},
+{6381, 3, 3, PropertyType::Block, 0x52},
+{6384, 5, 2, PropertyType::Script, 0x8E},
+{6389, 19, 3, PropertyType::Block, 0x11D},
+{6408, 7, 2, PropertyType::Script, 0x16},
+{6415, 6, 3, PropertyType::Block, 0xCE},
+{6421, 13, 1, PropertyType::General_Category, 0x80},
+{6434, 16, 3, PropertyType::Block, 0x101},
+{6450, 11, 1, PropertyType::General_Category, 0x40},
+{6461, 21, 3, PropertyType::Block, 0x9F},
+{6482, 30, 3, PropertyType::Block, 0x12B},
+{6512, 17, 0, PropertyType::Property, 0x40000},
+{6529, 7, 2, PropertyType::Script, 0x64},
+{6536, 5, 2, PropertyType::Script, 0x1E},
+{6541, 11, 2, PropertyType::Script, 0x65},
+{6552, 9, 3, PropertyType::Block, 0x9B},
+{6561, 6, 0, PropertyType::Property, 0x8000},
+{6567, 4, 2, PropertyType::Script, 0x47},
+{6571, 4, 2, PropertyType::Script, 0x3D},
+{6575, 6, 3, PropertyType::Block, 0xDA},
+{6581, 7, 3, PropertyType::Block, 0x12C},
+{6588, 1, 1, PropertyType::General_Category, 0x3C0000},
+{6589, 3, 0, PropertyType::Derived_Property, 0x40},
+{6592, 8, 2, PropertyType::Script, 0x55},
+{6600, 18, 3, PropertyType::Block, 0x27},
+{6618, 7, 3, PropertyType::Block, 0xEA},
+{6625, 3, 0, PropertyType::Property, 0x800000},
+{6628, 4, 2, PropertyType::Script, 0x28},
+{6632, 4, 2, PropertyType::Script, 0x1D},
+{6636, 11, 3, PropertyType::Block, 0xD5},
+{6647, 15, 3, PropertyType::Block, 0x51},
+{6662, 4, 2, PropertyType::Script, 0x88},
+{6666, 4, 2, PropertyType::Script, 0x31},
+{6670, 18, 3, PropertyType::Block, 0x63},
+{6688, 6, 2, PropertyType::Script, 0x9C},
+{6694, 19, 3, PropertyType::Block, 0x125},
+{6713, 11, 3, PropertyType::Block, 0x10F},
+{6724, 4, 2, PropertyType::Script, 0x54},
+{6728, 8, 2, PropertyType::Script, 0x3E},
+{6736, 8, 2, PropertyType::Script, 0x18},
+{6744, 12, 3, PropertyType::Block, 0xA9},
+{6756, 11, 3, PropertyType::Block, 0xE8},
+{6767, 4, 0, PropertyType::Property, 0x8},
+{6771, 26, 0, PropertyType::Property, 0x100000000},
+{6797, 1, 1, PropertyType::General_Category, 0x3E000000},
+{6798, 20, 3, PropertyType::Block, 0x112},
+{6818, 18, 3, PropertyType::Block, 0x91},
+{6836, 5, 0, PropertyType::Derived_Property, 0x4},
+{6841, 4, 2, PropertyType::Script, 0xE},
+{6845, 8, 3, PropertyType::Block, 0x47},
+{6853, 4, 3, PropertyType::Block, 0xE4},
+{6857, 13, 3, PropertyType::Block, 0x105},
+{6870, 2, 1, PropertyType::General_Category, 0x40000},
+{6872, 4, 2, PropertyType::Script, 0x2A},
+{6876, 6, 3, PropertyType::Block, 0x11B},
+{6882, 15, 1, PropertyType::General_Category, 0x2000},
+{6897, 24, 3, PropertyType::Block, 0x9B},
+{6921, 3, 4, PropertyType::Grapheme_Cluster_Break, 0xD},
+{6924, 4, 2, PropertyType::Script, 0x9C},
+{6928, 2, 3, PropertyType::Block, 0x9C},
+{6930, 22, 3, PropertyType::Block, 0x122},
+{6952, 11, 3, PropertyType::Block, 0xA},
+{6963, 1, 1, PropertyType::General_Category, 0x1C00000},
+{6964, 2, 6, PropertyType::Sentence_Break, 0xE},
+{6966, 4, 2, PropertyType::Script, 0x97},
+{6970, 17, 3, PropertyType::Block, 0x111},
+{6987, 14, 3, PropertyType::Block, 0x67},
+{7001, 7, 2, PropertyType::Script, 0x5F},
+{7008, 10, 1, PropertyType::General_Category, 0x40000},
+{7018, 25, 3, PropertyType::Block, 0x129},
+{7043, 4, 2, PropertyType::Script, 0x95},
+{7047, 9, 0, PropertyType::Word_Break, 0x0},
+{7056, 5, 2, PropertyType::Script, 0x88},
+{7061, 17, 3, PropertyType::Block, 0xA0},
+{7078, 6, 3, PropertyType::Block, 0xD6},
+{7084, 8, 3, PropertyType::Block, 0x6C},
+{7092, 5, 0, PropertyType::Property, 0x1},
+{7097, 5, 2, PropertyType::Script, 0xE},
+{7102, 1, 1, PropertyType::General_Category, 0x3F800},
+{7103, 2, 1, PropertyType::General_Category, 0x20000000},
+{7105, 21, 3, PropertyType::Block, 0x53},
+{7126, 2, 0, PropertyType::Derived_Property, 0x20},
+{7128, 22, 3, PropertyType::Block, 0x11E},
+{7150, 10, 3, PropertyType::Block, 0x84},
+{7160, 5, 6, PropertyType::Sentence_Break, 0xC},
+{7165, 4, 2, PropertyType::Script, 0x2C},
+{7169, 4, 2, PropertyType::Script, 0x21},
+{7173, 12, 3, PropertyType::Block, 0x66},
+{7185, 7, 2, PropertyType::Script, 0x17},
+{7192, 5, 2, PropertyType::Script, 0x2C},
+{7197, 4, 2, PropertyType::Script, 0x9},
+{7201, 8, 3, PropertyType::Block, 0x6D},
+{7209, 13, 3, PropertyType::Block, 0x97},
+{7222, 5, 1, PropertyType::General_Category, 0x2000000},
+{7227, 5, 3, PropertyType::Block, 0x8},
+{7232, 4, 2, PropertyType::Script, 0x74},
+{7236, 9, 1, PropertyType::General_Category, 0x8000000},
+{7245, 11, 3, PropertyType::Block, 0x65},
+{7256, 19, 3, PropertyType::Block, 0xA7},
+{7275, 4, 2, PropertyType::Script, 0x25},
+{7279, 7, 3, PropertyType::Block, 0xE0},
+{7286, 7, 2, PropertyType::Script, 0x48},
+{7293, 8, 2, PropertyType::Script, 0x21},
+{7301, 25, 3, PropertyType::Block, 0x49},
+{7326, 9, 2, PropertyType::Script, 0x52},
+{7335, 6, 2, PropertyType::Script, 0x80},
+{7341, 6, 3, PropertyType::Block, 0x1C},
+{7347, 18, 1, PropertyType::General_Category, 0x1000000},
+{7365, 8, 3, PropertyType::Block, 0x89},
+{7373, 4, 2, PropertyType::Script, 0x76},
+{7377, 4, 2, PropertyType::Script, 0x10},
+{7381, 11, 2, PropertyType::Script, 0x83},
+{7392, 16, 3, PropertyType::Block, 0x2},
+{7408, 4, 0, PropertyType::Property, 0x4000000},
+{7412, 4, 2, PropertyType::Script, 0x39},
+{7416, 19, 0, PropertyType::Property, 0x20000},
+{7435, 20, 3, PropertyType::Block, 0x113},
+{7455, 10, 3, PropertyType::Block, 0x0},
+{7465, 8, 3, PropertyType::Block, 0x64},
+{7473, 16, 0, PropertyType::Property, 0x10000000},
+{7489, 23, 3, PropertyType::Block, 0x46},
+{7512, 20, 2, PropertyType::Script, 0x5A},
+{7532, 7, 2, PropertyType::Script, 0x93},
+{7539, 9, 2, PropertyType::Script, 0x26},
+{7548, 5, 3, PropertyType::Block, 0xB5},
+{7553, 4, 0, PropertyType::Property, 0x80000},
+{7557, 29, 3, PropertyType::Block, 0x5F},
+{7586, 13, 3, PropertyType::Block, 0x50},
+{7599, 9, 0, PropertyType::Derived_Property, 0x4},
+{7608, 8, 3, PropertyType::Block, 0x105},
+{7616, 7, 2, PropertyType::Script, 0x45},
+{7623, 2, 1, PropertyType::General_Category, 0x400},
+{7625, 11, 0, PropertyType::Property, 0x800},
+{7636, 20, 2, PropertyType::Script, 0x97},
+{7656, 19, 0, PropertyType::Property, 0x40},
+{7675, 7, 2, PropertyType::Script, 0x4F},
+{7682, 18, 3, PropertyType::Block, 0x48},
+{7700, 14, 3, PropertyType::Block, 0x3},
+{7714, 15, 3, PropertyType::Block, 0x42},
+{7729, 9, 3, PropertyType::Block, 0xBC}, {7738, 9, 3, PropertyType::Block, 0x2},
+{7747, 2, 0, PropertyType::General_Category, 0x0},
+{7749, 5, 3, PropertyType::Block, 0x3C},
+{7754, 4, 0, PropertyType::Property, 0x40},
+{7758, 5, 0, PropertyType::Property, 0x40000000},
+{7763, 9, 0, PropertyType::Property, 0x1000},
+{7772, 4, 2, PropertyType::Script, 0x2},
+{7776, 2, 5, PropertyType::Word_Break, 0x0},
+{7778, 10, 3, PropertyType::Block, 0xE6},
+{7788, 19, 3, PropertyType::Block, 0x88},
+{7807, 19, 3, PropertyType::Block, 0x10F},
+{7826, 33, 3, PropertyType::Block, 0x126},
+{7859, 3, 3, PropertyType::Block, 0x21},
+{7862, 7, 3, PropertyType::Block, 0xD0},
+{7869, 12, 3, PropertyType::Block, 0xE2},
+{7881, 4, 2, PropertyType::Script, 0x32},
+{7885, 8, 0, PropertyType::Property, 0x100},
+{7893, 31, 3, PropertyType::Block, 0x110},
+{7924, 7, 3, PropertyType::Block, 0x11A},
+{7931, 34, 3, PropertyType::Block, 0x29},
+{7965, 21, 3, PropertyType::Block, 0x77},
+{7986, 10, 0, PropertyType::Property, 0x1},
+{7996, 21, 0, PropertyType::Derived_Property, 0x400},
+{8017, 4, 2, PropertyType::Script, 0x22},
+{8021, 15, 3, PropertyType::Block, 0xF2},
+{8036, 23, 3, PropertyType::Block, 0x10A},
+{8059, 5, 2, PropertyType::Script, 0x5D},
+{8064, 6, 3, PropertyType::Block, 0xD4},
+{8070, 16, 3, PropertyType::Block, 0x5E},
+{8086, 2, 1, PropertyType::General_Category, 0x4000000},
+{8088, 2, 1, PropertyType::General_Category, 0x200000},
+{8090, 5, 6, PropertyType::Sentence_Break, 0x8},
+{8095, 4, 2, PropertyType::Script, 0x1},
+{8099, 16, 3, PropertyType::Block, 0x65},
+{8115, 7, 2, PropertyType::Script, 0x4E},
+{8122, 4, 2, PropertyType::Script, 0x5C},
+{8126, 30, 0, PropertyType::Property, 0x400000},
+{8156, 14, 3, PropertyType::Block, 0xCC},
+{8170, 13, 3, PropertyType::Block, 0x5},
+{8183, 20, 2, PropertyType::Script, 0x7F},
+{8203, 3, 0, PropertyType::Property, 0x2000000},
+{8206, 4, 2, PropertyType::Script, 0x3},
+{8210, 14, 3, PropertyType::Block, 0x10A},
+{8224, 16, 3, PropertyType::Block, 0x53},
+{8240, 21, 0, PropertyType::Property, 0x10000},
+{8261, 30, 3, PropertyType::Block, 0x130},
+{8291, 14, 1, PropertyType::General_Category, 0x20},
+{8305, 15, 3, PropertyType::Block, 0x5B},
+{8320, 12, 3, PropertyType::Block, 0x11A},
+{8332, 11, 3, PropertyType::Block, 0x74},
+{8343, 8, 2, PropertyType::Script, 0x31},
+{8351, 4, 2, PropertyType::Script, 0x2B},
+{8355, 6, 3, PropertyType::Block, 0x10},
+{8361, 2, 6, PropertyType::Sentence_Break, 0x5},
+{8363, 14, 1, PropertyType::General_Category, 0x100000},
+{8377, 10, 3, PropertyType::Block, 0xBE},
+{8387, 4, 2, PropertyType::Script, 0x41},
+{8391, 2, 1, PropertyType::General_Category, 0x8},
+{8393, 5, 1, PropertyType::General_Category, 0x3F800},
+{8398, 8, 2, PropertyType::Script, 0x22},
+{8406, 7, 3, PropertyType::Block, 0x134},
+{8413, 6, 5, PropertyType::Word_Break, 0xD},
+{8419, 12, 3, PropertyType::Block, 0x41},
+{8431, 8, 3, PropertyType::Block, 0x42},
+{8439, 7, 5, PropertyType::Word_Break, 0xF},
+{8446, 7, 2, PropertyType::Script, 0x28},
+{8453, 22, 3, PropertyType::Block, 0x12F},
+{8475, 19, 3, PropertyType::Block, 0xC0},
+{8494, 33, 3, PropertyType::Block, 0x5D},
+{8527, 15, 1, PropertyType::General_Category, 0x1000},
+{8542, 8, 3, PropertyType::Block, 0xF9},
+{8550, 10, 3, PropertyType::Block, 0x72},
+{8560, 15, 0, PropertyType::Property, 0x400},
+{8575, 3, 2, PropertyType::Script, 0x42},
+{8578, 30, 3, PropertyType::Block, 0x12E},
+{8608, 2, 5, PropertyType::Word_Break, 0x3},
+{8610, 9, 0, PropertyType::Derived_Property, 0x8},
+{8619, 4, 3, PropertyType::Block, 0xE1},
+{8623, 7, 2, PropertyType::Script, 0x32},
+{8630, 7, 5, PropertyType::Word_Break, 0xB},
+{8637, 27, 3, PropertyType::Block, 0x10C},
+{8664, 7, 4, PropertyType::Grapheme_Cluster_Break, 0x4},
+{8671, 7, 3, PropertyType::Block, 0x12B},
+{8678, 4, 2, PropertyType::Script, 0x43},
+{8682, 12, 3, PropertyType::Block, 0x7D},
+{8694, 7, 3, PropertyType::Block, 0x2D},
+{8701, 2, 1, PropertyType::General_Category, 0x2},
+{8703, 20, 3, PropertyType::Block, 0xF8},
+{8723, 10, 2, PropertyType::Script, 0xA},
+{8733, 8, 2, PropertyType::Script, 0x68},
+{8741, 6, 2, PropertyType::Script, 0x9},
+{8747, 2, 5, PropertyType::Word_Break, 0x9},
+{8749, 8, 2, PropertyType::Script, 0x69},
+{8757, 33, 3, PropertyType::Block, 0x39},
+{8790, 9, 3, PropertyType::Block, 0xA1},
+{8799, 2, 1, PropertyType::General_Category, 0x400000},
+{8801, 7, 2, PropertyType::Script, 0x90},
+{8808, 10, 3, PropertyType::Block, 0x15},
+{8818, 4, 3, PropertyType::Block, 0x8B},
+{8822, 2, 0, PropertyType::Property, 0x1000000},
+{8824, 11, 0, PropertyType::Property, 0x2},
+{8835, 7, 3, PropertyType::Block, 0x104},
+{8842, 12, 5, PropertyType::Word_Break, 0x10},
+{8854, 3, 0, PropertyType::Property, 0x2000},
+{8857, 2, 0, PropertyType::Script, 0x0},
+{8859, 5, 6, PropertyType::Sentence_Break, 0x7},
+{8864, 10, 2, PropertyType::Script, 0x47},
+{8874, 7, 3, PropertyType::Block, 0xB4},
+{8881, 11, 3, PropertyType::Block, 0x63},
+{8892, 7, 2, PropertyType::Script, 0x95},
+{8899, 15, 3, PropertyType::Block, 0x15},
+{8914, 2, 5, PropertyType::Word_Break, 0x2},
+{8916, 2, 4, PropertyType::Grapheme_Cluster_Break, 0x1},
+{8918, 10, 0, PropertyType::Derived_Property, 0x2},
+{8928, 13, 0, PropertyType::Property, 0x20},
+{8941, 4, 2, PropertyType::Script, 0x18},
+{8945, 10, 3, PropertyType::Block, 0x5F},
+{8955, 4, 3, PropertyType::Block, 0xFE},
+{8959, 6, 1, PropertyType::General_Category, 0x3C0000},
+{8965, 10, 3, PropertyType::Block, 0x123},
+{8975, 5, 3, PropertyType::Block, 0x2E},
+{8980, 11, 5, PropertyType::Word_Break, 0x2},
+{8991, 7, 3, PropertyType::Block, 0x23},
+{8998, 11, 3, PropertyType::Block, 0x81},
+{9009, 14, 3, PropertyType::Block, 0x69},
+{9023, 4, 0, PropertyType::Derived_Property, 0x2000},
+{9027, 8, 3, PropertyType::Block, 0xB},
+{9035, 2, 6, PropertyType::Sentence_Break, 0x0},
+{9037, 11, 3, PropertyType::Block, 0x48},
+{9048, 7, 2, PropertyType::Script, 0x33},
+{9055, 4, 2, PropertyType::Script, 0x81},
+{9059, 5, 0, PropertyType::Block, 0x0},
+{9064, 18, 3, PropertyType::Block, 0x124},
+{9082, 4, 2, PropertyType::Script, 0x5B},
+{9086, 15, 3, PropertyType::Block, 0xC3},
+{9101, 6, 2, PropertyType::Script, 0x1},
+{9107, 21, 2, PropertyType::Script, 0x59},
+{9128, 7, 2, PropertyType::Script, 0x7A},
+{9135, 12, 3, PropertyType::Block, 0x115},
+{9147, 3, 3, PropertyType::Block, 0x6A},
+{9150, 4, 2, PropertyType::Script, 0x2D},
+{9154, 13, 3, PropertyType::Block, 0x4F},
+{9167, 4, 2, PropertyType::Script, 0x38},
+{9171, 30, 3, PropertyType::Block, 0x12C},
+{9201, 2, 0, PropertyType::Property, 0x20000000},
+{9203, 2, 1, PropertyType::General_Category, 0x2000},
+{9205, 12, 0, PropertyType::Derived_Property, 0x40000},
+{9217, 2, 1, PropertyType::General_Category, 0x8000},
+{9219, 8, 3, PropertyType::Block, 0xA9},
+{9227, 6, 6, PropertyType::Sentence_Break, 0x5},
+{9233, 4, 2, PropertyType::Script, 0x4A},
+{9237, 5, 3, PropertyType::Block, 0x116},
+{9242, 15, 3, PropertyType::Block, 0x6},
+{9257, 5, 1, PropertyType::General_Category, 0x3E000000},
+{9262, 2, 1, PropertyType::General_Category, 0x1},
+{9264, 8, 5, PropertyType::Word_Break, 0xA},
+{9272, 2, 6, PropertyType::Sentence_Break, 0xC},
+{9274, 11, 3, PropertyType::Block, 0x27},
+{9285, 4, 0, PropertyType::Property, 0x800},
+{9289, 2, 1, PropertyType::General_Category, 0x1000000},
+{9291, 5, 3, PropertyType::Block, 0x1},
+{9296, 19, 3, PropertyType::Block, 0x5C},
+{9315, 4, 2, PropertyType::Script, 0x68},
+{9319, 5, 0, PropertyType::Derived_Property, 0x10000},
+{9324, 6, 0, PropertyType::Property, 0x4000},
+{9330, 4, 2, PropertyType::Script, 0x50},
+{9334, 9, 3, PropertyType::Block, 0x75},
+{9343, 5, 3, PropertyType::Block, 0x1B},
+{9348, 6, 3, PropertyType::Block, 0xAE},
+{9354, 6, 2, PropertyType::Script, 0x5E},
+{9360, 4, 2, PropertyType::Script, 0x3C},
+{9364, 34, 3, PropertyType::Block, 0x11F},
+{9398, 4, 2, PropertyType::Script, 0x20},
+{9402, 7, 2, PropertyType::Script, 0x30},
+{9409, 12, 3, PropertyType::Block, 0xCB},
+{9421, 9, 2, PropertyType::Script, 0x43},
+{9430, 12, 1, PropertyType::General_Category, 0x200},
+{9442, 4, 2, PropertyType::Script, 0x83},
+{9446, 14, 3, PropertyType::Block, 0xF1},
+{9460, 42, 3, PropertyType::Block, 0x32},
+{9502, 7, 2, PropertyType::Script, 0x35},
+{9509, 18, 3, PropertyType::Block, 0x85},
+{9527, 9, 3, PropertyType::Block, 0x103},
+{9536, 5, 6, PropertyType::Sentence_Break, 0xD},
+{9541, 15, 3, PropertyType::Block, 0x4A},
+{9556, 6, 3, PropertyType::Block, 0xBF},
+{9562, 15, 1, PropertyType::General_Category, 0x4},
+{9577, 17, 5, PropertyType::Word_Break, 0x8},
+{9594, 10, 2, PropertyType::Script, 0x40},
+{9604, 21, 3, PropertyType::Block, 0xD9},
+{9625, 5, 0, PropertyType::Derived_Property, 0x10},
+{9630, 15, 0, PropertyType::Property, 0x8000000},
+{9645, 4, 2, PropertyType::Script, 0x60},
+{9649, 18, 3, PropertyType::Block, 0xFF},
+{9667, 8, 3, PropertyType::Block, 0x108},
+{9675, 22, 3, PropertyType::Block, 0x50},
+{9697, 2, 0, PropertyType::Derived_Property, 0x8000},
+{9699, 19, 2, PropertyType::Script, 0x51},
+{9718, 7, 3, PropertyType::Block, 0xF1},
+{9725, 14, 2, PropertyType::Script, 0x79},
+{9739, 12, 2, PropertyType::Script, 0x71},
+};
+const uint16_t _property_name_seeds[] = {
+9, 6, 131, 21, 17, 7, 2, 16, 425, 22, 1, 46, 5, 1, 2, 35, 2, 43, 1, 5, 10, 56,
+14, 119, 7, 35, 7, 375, 3, 126, 153, 42, 1, 66, 4, 245, 207, 1, 13, 10, 13, 60,
+1, 115, 2, 38, 5, 91, 9, 1, 26, 72, 1, 6, 14, 9, 224, 7, 0, 4, 2, 5, 1, 130, 14,
+61, 3, 227, 169, 67, 35, 1, 67, 29, 23, 28, 91, 9, 145, 8, 111, 3, 4, 6, 41, 15,
+13, 50, 55, 348, 79, 11, 0, 40, 359, 1, 7, 3, 14, 3, 163, 125, 342, 2, 77, 2, 0,
+20, 70, 2, 28, 78, 723, 215, 72, 2, 2, 1, 11, 11, 48, 16, 15, 84, 66, 72, 122,
+207, 80, 0, 66, 5, 7, 317, 1, 393, 636, 605, 5, 42, 1, 12, 83, 1, 132, 250, 135,
+10, 21, 8, 8, 34, 93, 680, 473, 492, 102, 160, 135, 16, 5, 42, 376, 3, 156, 652,
+1, 1, 790, 1, 1, 14, 261, 218, 258, 43, 31, 834, 137, 14, 0, 6, 7, 4, 26, 55,
+87, 607, 259, 5, 20, 103, 131, 1, 23, 93, 1819, 141, 1620, 89, 1252, 68, 24, 0,
+419, 2, 122, 8, 85, 52, 210, 1251, 301, 367, 221, 2413, 193, 1250, 124, 13, 196,
+122, 144, 831, 7, 58, 57, 1539, 307, 38, 252, 358, 6, 0, 1, 22, 33, 858, 120,
+77, 2, 1008, 456, 2109, 420, 664, 1216, 153, 2537, 6, 638, 872, 758, 0, 60, 0,
+3706,
+};
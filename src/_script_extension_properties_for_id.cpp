@@ -1,354 +0,0 @@
-const std::vector<std::vector<Script>> _script_extension_properties_for_id = {
-{
-    Script::Bengali, 
-},
-{
-    Script::Devanagari, 
-},
-{
-    Script::Duployan, 
-},
-{
-    Script::Greek, 
-},
-{
-    Script::Han, 
-},
-{
-    Script::Latin, 
-},
-{
-    Script::Nandinagari, 
-},
-{
-    Script::Arabic, 
-    Script::Coptic, 
-},
-{
-    Script::Arabic, 
-    Script::Hanifi_Rohingya, 
-},
-{
-    Script::Arabic, 
-    Script::Syriac, 
-},
-{
-    Script::Arabic, 
-    Script::Thaana, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-},
-{
-    Script::Bopomofo, 
-    Script::Han, 
-},
-{
-    Script::Buginese, 
-    Script::Javanese, 
-},
-{
-    Script::Cypriot, 
-    Script::Linear_B, 
-},
-{
-    Script::Cyrillic, 
-    Script::Glagolitic, 
-},
-{
-    Script::Cyrillic, 
-    Script::Latin, 
-},
-{
-    Script::Cyrillic, 
-    Script::Old_Permic, 
-},
-{
-    Script::Cyrillic, 
-    Script::Syriac, 
-},
-{
-    Script::Devanagari, 
-    Script::Grantha, 
-},
-{
-    Script::Devanagari, 
-    Script::Nandinagari, 
-},
-{
-    Script::Devanagari, 
-    Script::Sharada, 
-},
-{
-    Script::Devanagari, 
-    Script::Tamil, 
-},
-{
-    Script::Georgian, 
-    Script::Latin, 
-},
-{
-    Script::Grantha, 
-    Script::Tamil, 
-},
-{
-    Script::Gujarati, 
-    Script::Khojki, 
-},
-{
-    Script::Gurmukhi, 
-    Script::Multani, 
-},
-{
-    Script::Han, 
-    Script::Latin, 
-},
-{
-    Script::Hiragana, 
-    Script::Katakana, 
-},
-{
-    Script::Kannada, 
-    Script::Nandinagari, 
-},
-{
-    Script::Latin, 
-    Script::Mongolian, 
-},
-{
-    Script::Mongolian, 
-    Script::Phags_Pa, 
-},
-{
-    Script::Arabic, 
-    Script::Syriac, 
-    Script::Thaana, 
-},
-{
-    Script::Arabic, 
-    Script::Thaana, 
-    Script::Yezidi, 
-},
-{
-    Script::Bengali, 
-    Script::Chakma, 
-    Script::Syloti_Nagri, 
-},
-{
-    Script::Chakma, 
-    Script::Myanmar, 
-    Script::Tai_Le, 
-},
-{
-    Script::Cypriot, 
-    Script::Linear_A, 
-    Script::Linear_B, 
-},
-{
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Kannada, 
-},
-{
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Latin, 
-},
-{
-    Script::Han, 
-    Script::Hiragana, 
-    Script::Katakana, 
-},
-{
-    Script::Kayah_Li, 
-    Script::Latin, 
-    Script::Myanmar, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Kannada, 
-},
-{
-    Script::Buhid, 
-    Script::Hanunoo, 
-    Script::Tagbanwa, 
-    Script::Tagalog, 
-},
-{
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Kaithi, 
-    Script::Mahajani, 
-},
-{
-    Script::Arabic, 
-    Script::Hanifi_Rohingya, 
-    Script::Syriac, 
-    Script::Thaana, 
-    Script::Yezidi, 
-},
-{
-    Script::Bopomofo, 
-    Script::Hangul, 
-    Script::Han, 
-    Script::Hiragana, 
-    Script::Katakana, 
-},
-{
-    Script::Bopomofo, 
-    Script::Hangul, 
-    Script::Han, 
-    Script::Hiragana, 
-    Script::Katakana, 
-    Script::Yi, 
-},
-{
-    Script::Devanagari, 
-    Script::Kannada, 
-    Script::Malayalam, 
-    Script::Oriya, 
-    Script::Tamil, 
-    Script::Telugu, 
-},
-{
-    Script::Adlam, 
-    Script::Arabic, 
-    Script::Mandaic, 
-    Script::Manichaean, 
-    Script::Psalter_Pahlavi, 
-    Script::Hanifi_Rohingya, 
-    Script::Sogdian, 
-    Script::Syriac, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Kannada, 
-    Script::Nandinagari, 
-    Script::Oriya, 
-    Script::Telugu, 
-    Script::Tirhuta, 
-},
-{
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Khojki, 
-    Script::Kaithi, 
-    Script::Mahajani, 
-    Script::Modi, 
-    Script::Khudawadi, 
-    Script::Takri, 
-    Script::Tirhuta, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Kannada, 
-    Script::Latin, 
-    Script::Malayalam, 
-    Script::Oriya, 
-    Script::Tamil, 
-    Script::Telugu, 
-    Script::Tirhuta, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Grantha, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Kannada, 
-    Script::Latin, 
-    Script::Malayalam, 
-    Script::Oriya, 
-    Script::Sharada, 
-    Script::Tamil, 
-    Script::Telugu, 
-    Script::Tirhuta, 
-},
-{
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Khojki, 
-    Script::Kannada, 
-    Script::Kaithi, 
-    Script::Mahajani, 
-    Script::Modi, 
-    Script::Nandinagari, 
-    Script::Khudawadi, 
-    Script::Takri, 
-    Script::Tirhuta, 
-},
-{
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Khojki, 
-    Script::Kannada, 
-    Script::Kaithi, 
-    Script::Mahajani, 
-    Script::Malayalam, 
-    Script::Modi, 
-    Script::Nandinagari, 
-    Script::Khudawadi, 
-    Script::Takri, 
-    Script::Tirhuta, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Gunjala_Gondi, 
-    Script::Masaram_Gondi, 
-    Script::Grantha, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Kannada, 
-    Script::Mahajani, 
-    Script::Malayalam, 
-    Script::Nandinagari, 
-    Script::Oriya, 
-    Script::Khudawadi, 
-    Script::Sinhala, 
-    Script::Syloti_Nagri, 
-    Script::Takri, 
-    Script::Tamil, 
-    Script::Telugu, 
-    Script::Tirhuta, 
-},
-{
-    Script::Bengali, 
-    Script::Devanagari, 
-    Script::Dogra, 
-    Script::Gunjala_Gondi, 
-    Script::Masaram_Gondi, 
-    Script::Grantha, 
-    Script::Gujarati, 
-    Script::Gurmukhi, 
-    Script::Kannada, 
-    Script::Limbu, 
-    Script::Mahajani, 
-    Script::Malayalam, 
-    Script::Nandinagari, 
-    Script::Oriya, 
-    Script::Khudawadi, 
-    Script::Sinhala, 
-    Script::Syloti_Nagri, 
-    Script::Takri, 
-    Script::Tamil, 
-    Script::Telugu, 
-    Script::Tirhuta, 
-},
-};
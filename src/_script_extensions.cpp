@@ -0,0 +1,1096 @@
+const ScriptSet _script_extension_sets[] = {
+{{0x0000000000000001, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000002, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000004, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000008, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000010, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000020, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000040, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000080, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000100, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000200, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000400, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000800, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000001000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000002000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000004000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000008000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000010000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000020000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000040000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000080000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000100000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000200000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000400000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000800000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000001000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000002000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000004000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000008000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000010000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000020000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000040000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000080000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000100000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000200000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000400000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000800000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000001000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000002000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000004000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000008000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000010000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000020000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000040000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000080000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000100000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000200000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000400000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000800000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0001000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0002000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0004000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0008000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0010000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0020000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0040000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0080000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0100000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0200000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0400000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0800000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x1000000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x2000000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x4000000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x8000000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000001, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000002, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000004, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000008, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000010, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000020, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000040, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000080, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000100, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000200, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000400, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000800, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000001000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000002000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000004000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000008000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000010000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000020000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000040000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000080000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000100000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000200000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000400000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000800000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000001000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000002000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000004000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000008000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000010000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000020000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000040000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000080000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000100000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000200000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000400000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000800000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000001000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000002000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000004000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000008000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000010000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000020000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000040000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000080000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000100000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000200000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000400000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000800000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0001000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0002000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0004000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0008000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0010000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0020000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0040000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0080000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0100000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0200000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0400000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0800000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x1000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x2000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x4000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x8000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000001}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000002}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000004}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000008}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000010}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000020}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000040}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000080}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000100}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000200}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000400}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000000800}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000001000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000002000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000004000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000008000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000010000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000020000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000040000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000080000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000100000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000200000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000400000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000800000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000001000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000002000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000004000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000008000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000010000000}},
+{{0x0000000000000800, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000400, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000020000000000, 0x0000000000000000}},
+{{0x0000000000000008, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000001000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000004, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000000, 0x0000000000000000, 0x0000000000400000}},
+{{0x0080000000000080, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000080, 0x0000000000000000, 0x0000000000040000}},
+{{0x0000000000000180, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000280, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000C00, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000001800000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0040000000000000, 0x0000000000200000, 0x0000000000000000}},
+{{0x0011000000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0200000000000010, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000014, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000010, 0x0100000000000000, 0x0000000000000000}},
+{{0x0000000000000110, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000400, 0x0000080000000000, 0x0000000000000000}},
+{{0x0000000000000400, 0x0000000000000000, 0x0000000000400000}},
+{{0x0000000000000400, 0x0000001000000000, 0x0000000000000000}},
+{{0x0000000000008400, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000001000004, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000008000, 0x0000080000000000, 0x0000000000000000}},
+{{0x0000000000002000, 0x0000200000000000, 0x0000000000000000}},
+{{0x0000000000001000, 0x0000000000000000, 0x0000000000000002}},
+{{0x0000001000000004, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000600000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000020000, 0x0000000000000000, 0x0000000000400000}},
+{{0x0000000100000004, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000100000000, 0x0000000000000002, 0x0000000000000000}},
+{{0x0000000000000380, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000280, 0x0000000000000000, 0x0000000010000000}},
+{{0x0800000000000800, 0x0000000100000000, 0x0000000000000000}},
+{{0x0000800000800000, 0x0000000100000000, 0x0000000000000000}},
+{{0x0011000000000000, 0x0000400000000000, 0x0000000000000000}},
+{{0x0000000000020400, 0x0000080000000000, 0x0000000000000000}},
+{{0x0000000000000404, 0x0000080000000000, 0x0000000000000000}},
+{{0x0000001600000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000800004, 0x0000000000000100, 0x0000000000000000}},
+{{0x0000000000020C00, 0x0000080000000000, 0x0000000000000000}},
+{{0x00003C0000000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000400, 0x0000800010000000, 0x0000000000004000}},
+{{0x0000000000000380, 0x0000000000000000, 0x0000000010040000}},
+{{0x0000001E02000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000003E02000000, 0x0000000000000000, 0x0000000000000000}},
+{{0x000000000007C400, 0x0000000000000000, 0x0000000000000000}},
+{{0x0000000000000180, 0x0201000080000000, 0x00000000000C0010}},
+{{0x0000000000034C00, 0x1000080000000000, 0x0000000000400000}},
+{{0x0000000000003400, 0x1804A04010000000, 0x0000000000004000}},
+{{0x000000000007FC04, 0x1000080000000000, 0x0000000000000000}},
+{{0x000000000007FC04, 0x1000081000000000, 0x0000000000000000}},
+{{0x0000000000023400, 0x1804A04010000000, 0x0000000000404000}},
+{{0x0000000000063400, 0x1804A04010000000, 0x0000000000404000}},
+{{0x08000000000FFC00, 0x1800884000000000, 0x000000000040C400}},
+{{0x08004000000FFC00, 0x1800884000000000, 0x000000000040C400}},
+};
+const uint16_t _script_extension_ids_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1280, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1408, 1472, 1536, 1600, 1664, 1728, 1792, 1856, 1920, 1984,
+2048, 2112, 1344, 1344, 2176, 2240, 1344, 1344, 1344, 2304, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 2368, 2432, 2496, 2496, 2496, 2496, 2496, 2560,
+2624, 2688, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 2752, 1344, 1344,
+2816, 1344, 1344, 1344, 1344, 2880, 2944, 3008, 1344, 3072, 1344, 3136, 3200,
+3264, 3328, 3392, 1344, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 3456, 832,
+832, 832, 3520, 3584, 832, 832, 832, 832, 3648, 832, 832, 832, 832, 832, 832,
+3712, 1344, 1344, 1344, 3776, 1344, 832, 832, 832, 832, 3840, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 3904, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344,
+};
+const uint16_t _script_extension_ids_stage2[] = {
+0, 0, 0, 0, 16, 32, 16, 32, 0, 0, 48, 48, 64, 80, 64, 80, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 96, 0, 0, 112, 0, 128, 128, 128, 128, 144, 128, 160, 176, 192, 208, 224,
+208, 208, 208, 240, 208, 256, 256, 256, 256, 256, 256, 256, 256, 272, 256, 256,
+256, 256, 256, 256, 256, 256, 256, 256, 288, 304, 320, 304, 304, 336, 352, 368,
+368, 384, 368, 400, 416, 432, 448, 464, 464, 480, 496, 512, 528, 464, 464, 464,
+464, 464, 544, 464, 464, 560, 576, 576, 576, 592, 464, 464, 464, 608, 608, 608,
+624, 640, 640, 640, 656, 672, 672, 688, 704, 720, 736, 752, 768, 768, 768, 464,
+784, 800, 816, 832, 464, 848, 848, 848, 848, 848, 864, 880, 848, 896, 912, 928,
+944, 960, 976, 992, 1008, 1024, 1040, 1056, 1072, 1088, 1104, 1120, 1136, 1152,
+1168, 1184, 1200, 1216, 1232, 1248, 1264, 1280, 1296, 1312, 1328, 1344, 1360,
+1376, 1392, 1408, 1424, 1440, 1456, 1472, 1488, 1504, 1520, 1536, 1552, 1568,
+1584, 1600, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728, 1744, 1760, 1776,
+1792, 1808, 1824, 1824, 1840, 1856, 1872, 1824, 1888, 1904, 1920, 1936, 1952,
+1968, 1984, 2000, 2016, 2032, 2032, 2048, 2032, 2064, 768, 768, 2080, 2096,
+2112, 2128, 2144, 2160, 768, 768, 2176, 2176, 2176, 2176, 2192, 2176, 2208,
+2224, 2176, 2192, 2176, 2240, 2240, 2256, 768, 768, 2272, 2272, 2272, 2272,
+2288, 2272, 2272, 2272, 2272, 2272, 2304, 2304, 2320, 2304, 2304, 2336, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2368, 2368, 2368, 2368, 2384, 2400, 2368, 2368, 2384, 2368, 2368,
+2416, 2432, 2448, 2368, 2368, 2368, 2432, 2368, 2368, 2368, 2464, 2368, 2480,
+2368, 2496, 2512, 2512, 2512, 2512, 2512, 2528, 2544, 2544, 2544, 2544, 2544,
+2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544,
+2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544,
+2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2544, 2560, 2576, 2592, 2592,
+2592, 2592, 2608, 2624, 2640, 2656, 2672, 2688, 2704, 2720, 2736, 2752, 2768,
+2768, 2768, 2768, 2768, 2784, 2800, 2800, 2816, 2832, 2848, 2848, 2848, 2848,
+2848, 2864, 2848, 2848, 2880, 2544, 2544, 2544, 2544, 2896, 2912, 2928, 2944,
+2944, 2960, 2976, 2992, 3008, 3024, 3024, 3040, 3024, 3056, 3072, 2768, 2768,
+3088, 3104, 3120, 3120, 3120, 3136, 3120, 3152, 3168, 3168, 3184, 128, 3200,
+768, 768, 768, 3216, 3216, 3216, 3216, 3232, 3216, 3216, 3248, 3264, 3264, 3264,
+3264, 3280, 3280, 3280, 3296, 3312, 3312, 3312, 3328, 3344, 3360, 3360, 3360,
+3376, 2304, 2304, 3392, 3408, 3424, 3440, 3456, 64, 64, 3472, 64, 64, 3488,
+3504, 3520, 64, 64, 64, 3536, 3552, 128, 128, 3568, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 208, 3584, 208, 208, 3584, 3600, 208, 3616,
+208, 208, 208, 3632, 3632, 3648, 208, 3664, 3680, 0, 3696, 0, 0, 0, 3712, 3728,
+3744, 3760, 0, 0, 768, 128, 128, 3776, 0, 0, 3792, 3808, 3824, 0, 64, 64, 3840,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3856, 768, 3872, 768, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888, 3888,
+3888, 3888, 3888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3904, 0, 3920, 0, 0, 0, 0,
+0, 0, 3936, 3936, 3952, 3936, 3936, 3952, 64, 64, 3968, 3968, 3968, 3968, 3968,
+3968, 3968, 3984, 2304, 2304, 2320, 4000, 4000, 4000, 4016, 4032, 2368, 4048,
+4064, 4064, 4064, 4064, 256, 256, 0, 0, 0, 0, 4080, 4096, 768, 768, 4112, 4128,
+4112, 4112, 4112, 4112, 4112, 4144, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4160, 768, 4176, 4192, 4208, 4224, 4240,
+4256, 4272, 4272, 4272, 4272, 4288, 4304, 4320, 4320, 4320, 4320, 4336, 4352,
+4368, 4368, 4384, 2352, 2352, 2352, 2352, 4400, 4416, 4368, 4368, 4416, 4416,
+4432, 4320, 2352, 4400, 4416, 4416, 4448, 0, 2352, 4464, 4416, 4416, 4416, 4480,
+4496, 4320, 4320, 4512, 4320, 4320, 4320, 4320, 4320, 4528, 4416, 4544, 0, 0, 0,
+0, 0, 0, 4416, 4560, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 0, 0, 0, 0, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4576, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592, 4592,
+4592, 4592, 4592, 4592, 4592, 4608, 4592, 4592, 4592, 4624, 4640, 4640, 4640,
+4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656, 4656,
+4656, 4656, 4656, 4656, 4656, 4672, 768, 256, 256, 4688, 256, 256, 256, 4704,
+4704, 4704, 4704, 4704, 4720, 4736, 0, 4752, 64, 64, 64, 64, 64, 4768, 64, 64,
+64, 4784, 768, 768, 4800, 4816, 4816, 4832, 4848, 4864, 4864, 4864, 4880, 4896,
+4896, 4896, 4896, 4912, 4928, 848, 4944, 4960, 4960, 4976, 4992, 4992, 5008,
+2352, 5024, 5040, 5040, 5040, 5040, 5056, 5072, 2272, 5088, 5104, 5104, 5104,
+5120, 5136, 5152, 2272, 2272, 5168, 5168, 5168, 5168, 5184, 5200, 5216, 5232,
+5248, 5264, 4064, 64, 64, 5280, 5296, 2512, 2512, 2512, 2512, 2512, 5216, 5216,
+5312, 5328, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
+2352, 2352, 2352, 2352, 2352, 2352, 2352, 5344, 2352, 5360, 2352, 2352, 5376,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 5392, 4112, 4112, 4112,
+4112, 4112, 4112, 5408, 768, 768, 5424, 5440, 368, 5456, 5472, 464, 464, 464,
+464, 464, 464, 464, 5488, 816, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464,
+464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 5504, 768, 464, 464, 464,
+464, 5520, 464, 464, 800, 768, 768, 5536, 128, 5552, 5568, 0, 5584, 5600, 5616,
+784, 464, 464, 464, 464, 464, 464, 464, 5632, 5648, 0, 16, 32, 16, 32, 5664,
+4304, 4320, 5680, 2352, 4400, 5696, 5712, 5728, 5744, 5760, 5776, 5792, 5808,
+5824, 5824, 768, 768, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5840, 5856,
+5872, 5872, 5888, 208, 208, 208, 208, 5904, 5920, 5936, 768, 768, 0, 0, 5952,
+768, 768, 768, 768, 768, 768, 768, 768, 5968, 5984, 6000, 6000, 6000, 6016,
+6032, 6048, 6064, 6064, 6080, 6096, 6112, 6128, 6128, 6144, 6160, 6176, 6192,
+6192, 6208, 6224, 768, 768, 6240, 6240, 6240, 6240, 6240, 6256, 6256, 6256,
+6272, 6288, 6304, 6320, 6320, 6336, 6320, 6352, 6368, 6368, 6384, 6400, 6400,
+6400, 6416, 768, 768, 768, 768, 768, 768, 768, 768, 768, 6432, 6432, 6432, 6432,
+6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432, 6432,
+6432, 6432, 6448, 6432, 6464, 6480, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+6496, 6512, 6512, 6528, 6544, 6560, 6576, 6576, 6592, 6608, 6624, 768, 768, 768,
+6640, 6656, 6672, 6688, 6704, 6720, 768, 768, 768, 768, 6736, 6736, 6752, 6768,
+6752, 6784, 6752, 6752, 6800, 6816, 6832, 6848, 6864, 6864, 6880, 6880, 6896,
+6896, 768, 768, 6912, 6912, 6928, 6944, 6960, 6960, 6960, 6976, 6992, 7008,
+7024, 7040, 7056, 7072, 7088, 768, 768, 768, 768, 768, 7104, 7104, 7104, 7104,
+7120, 768, 768, 768, 7136, 7136, 7136, 7152, 7136, 7136, 7136, 7168, 7184, 7184,
+7200, 7216, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 464, 7232, 7248, 7248, 7264, 7280, 768, 768, 768, 768,
+7296, 7296, 7312, 7328, 7328, 7344, 768, 768, 768, 768, 768, 7360, 7376, 768,
+7392, 7408, 7424, 7424, 7424, 7424, 7440, 7456, 7424, 7472, 7488, 7488, 7488,
+7488, 7504, 7520, 7536, 7552, 7568, 7568, 7568, 7584, 7600, 7616, 7616, 7632,
+7648, 7648, 7648, 7648, 7648, 7648, 7664, 7680, 7696, 7712, 7696, 7728, 768,
+768, 768, 768, 7744, 7760, 7776, 7792, 7792, 7792, 7808, 7824, 7840, 7856, 7872,
+7888, 7904, 7920, 7936, 7952, 768, 768, 768, 768, 768, 768, 768, 768, 7968,
+7968, 7968, 7968, 7968, 7984, 8000, 768, 8016, 8016, 8016, 8016, 8032, 8048,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 8064, 8064, 8064, 8080, 8064,
+8096, 768, 768, 8112, 8112, 8112, 8112, 8128, 8144, 8160, 768, 8176, 8176, 8176,
+8192, 8208, 768, 768, 768, 8224, 8240, 8256, 8224, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 8272, 8272, 8272, 8288, 768, 768, 768, 768, 768,
+768, 8304, 8304, 8304, 8304, 8304, 8320, 8336, 8352, 8368, 8384, 8400, 8416,
+768, 768, 768, 768, 8432, 8448, 8448, 8432, 8464, 768, 8480, 8480, 8480, 8480,
+8496, 8512, 8512, 8512, 8512, 8512, 8528, 768, 8544, 8544, 8544, 8560, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 8576,
+8592, 8592, 8608, 8624, 8592, 8640, 8656, 8656, 8672, 8688, 8704, 768, 768, 768,
+768, 8720, 8736, 8736, 8752, 8768, 8784, 8800, 8816, 8832, 8848, 8864, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 8880, 8896, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 8912,
+8928, 8944, 8928, 8960, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976,
+8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976,
+8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976,
+8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976,
+8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8992, 768, 768, 768, 768,
+768, 768, 8976, 8976, 8976, 8976, 8976, 8976, 9008, 9024, 8976, 8976, 8976,
+8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 8976, 9040, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 9056, 9056, 9056, 9056, 9056, 9056, 9056,
+9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056,
+9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056,
+9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056,
+9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056, 9056,
+9056, 9056, 9056, 9056, 9056, 9056, 9056, 9072, 9088, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 9104, 9104, 9104, 9104, 9104, 9104, 9104,
+9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104,
+9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104,
+9104, 9104, 9104, 9120, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704,
+4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704,
+4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 4704, 9136, 9152, 9168, 9184,
+768, 768, 768, 768, 768, 768, 9200, 9216, 9232, 9248, 9248, 9248, 9248, 9264,
+9280, 9296, 9312, 9248, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+9328, 9328, 9328, 9328, 9328, 9344, 768, 768, 768, 768, 768, 768, 9360, 9360,
+9360, 9360, 9376, 9360, 9360, 9360, 9392, 9360, 768, 768, 768, 768, 9408, 9424,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9456, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440, 9440,
+9440, 9440, 9440, 9440, 9440, 9440, 9440, 9472, 9472, 9472, 9472, 9472, 9472,
+9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472,
+9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9472, 9488, 768, 768,
+9504, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+9520, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272, 4272,
+4272, 4272, 4272, 4272, 9536, 768, 768, 768, 9552, 9568, 9584, 9584, 9584, 9584,
+9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584, 9584,
+9584, 9584, 9584, 9584, 9584, 9584, 9584, 9600, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 9616, 9616, 9616, 9616, 9616,
+9616, 9632, 9648, 9664, 9680, 9696, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 9712, 0, 0, 9728, 0, 0, 0, 9744, 9760, 9776, 0, 9792, 0,
+0, 0, 9808, 768, 208, 208, 208, 208, 9824, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 0, 9840, 0, 0, 0, 0, 0, 3856, 4416, 9856, 768, 768, 768, 768, 768,
+768, 768, 768, 0, 0, 0, 0, 0, 3712, 0, 0, 0, 9872, 9888, 9904, 9920, 0, 0, 0,
+9936, 9952, 0, 9968, 9984, 10000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 10016, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10032,
+0, 0, 0, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048,
+10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048,
+10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048,
+10048, 10048, 10048, 10048, 10048, 10048, 10048, 10048, 10064, 10080, 10096,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 10112, 10128, 10144, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 10160, 10160, 10176, 10192, 10208, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 10224, 10224, 10224, 10240, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 10256, 10256, 10256, 10256,
+10256, 10256, 10256, 10256, 10256, 10256, 10256, 10256, 10272, 10288, 768, 768,
+10304, 10304, 10304, 10304, 10320, 10336, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 5648, 0, 0, 0, 10352, 768,
+768, 768, 768, 5648, 0, 0, 10368, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 10384, 464, 10400, 10416, 10432, 10448, 10464, 10480, 10496,
+10512, 10528, 10512, 768, 768, 768, 5488, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 4176, 0, 0, 0, 0, 0, 0, 9840,
+3744, 5648, 5648, 5648, 0, 9712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10368, 768, 768,
+768, 10544, 0, 10560, 0, 0, 4176, 9808, 10576, 9712, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10592, 5920, 5920, 0, 0, 0, 0, 0, 0,
+0, 9840, 0, 0, 0, 0, 0, 9808, 4176, 768, 4176, 0, 0, 0, 10592, 5552, 0, 0,
+10592, 0, 10368, 10608, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 10624, 0, 0, 0,
+0, 10640, 0, 0, 0, 0, 0, 0, 0, 0, 9840, 10368, 10656, 3856, 0, 9808, 3856, 4096,
+3856, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5600, 0, 0, 3872, 768, 768, 5552,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 5392, 768, 768, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 10672, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 5392,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+9424, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 10688, 768, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 5392, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 10704, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 10720,
+768, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+};
+const uint16_t _script_extension_ids_stage3[] = {
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 35, 35, 1, 1, 1, 1, 41, 41, 41, 41,
+41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 160, 41, 41, 160, 41,
+41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 162, 162, 162, 162, 162, 162,
+162, 162, 162, 162, 162, 162, 162, 3, 3, 3, 3, 1, 3, 3, 3, 0, 0, 3, 3, 3, 3, 1,
+3, 0, 0, 0, 0, 3, 1, 3, 1, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 55, 55,
+55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 174, 172, 173, 173, 172, 4, 4, 4, 4, 4, 4, 4, 4, 0, 5,
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+5, 5, 5, 0, 0, 5, 5, 5, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0,
+0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 1, 7, 7, 7, 7, 7, 7, 201, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 201, 189, 0, 7, 201, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 205, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 166, 166, 166, 166, 166, 166,
+166, 166, 166, 166, 166, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 190, 190, 190, 190, 190,
+190, 190, 190, 190, 190, 7, 7, 7, 7, 7, 7, 166, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 165, 7, 7, 7, 7, 7, 7, 7, 7, 1, 7, 7, 8, 8, 8, 8, 8, 8,
+8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 66, 66, 66, 66,
+66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+66, 66, 0, 0, 66, 66, 66, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 0, 0, 82,
+82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 0, 95, 95, 95, 95, 95,
+95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+95, 95, 95, 0, 0, 95, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 1, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 209, 208, 41, 41,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 212, 213, 200, 200,
+200, 200, 200, 200, 200, 200, 200, 200, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11,
+11, 11, 11, 0, 0, 11, 11, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 11, 11, 11, 11, 11, 11, 11, 0, 11, 0,
+0, 0, 11, 11, 11, 11, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 11, 11, 0,
+0, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 11, 11, 0, 11, 11,
+11, 11, 11, 0, 0, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 11, 11, 11,
+11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 12, 12, 12, 0, 12, 12, 12,
+12, 12, 12, 0, 0, 0, 0, 12, 12, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12,
+0, 12, 12, 0, 12, 12, 0, 12, 12, 0, 0, 12, 0, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+12, 12, 0, 0, 12, 12, 12, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 0,
+12, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 12,
+12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 0, 13, 13, 13,
+13, 13, 13, 13, 13, 13, 0, 13, 13, 13, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 13, 13, 13, 13, 13, 13,
+13, 0, 13, 13, 0, 13, 13, 13, 13, 13, 0, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+13, 0, 13, 13, 13, 0, 13, 13, 13, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 13, 13, 13, 13, 0, 0, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+13, 13, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 13, 13, 0, 14, 14, 14, 0, 14,
+14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14,
+14, 14, 0, 14, 14, 0, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+14, 0, 0, 14, 14, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0,
+14, 14, 0, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 15, 15, 15,
+15, 15, 15, 0, 0, 0, 15, 15, 15, 0, 15, 15, 15, 15, 0, 0, 0, 15, 15, 0, 15, 0,
+15, 15, 0, 0, 0, 15, 15, 0, 0, 0, 15, 15, 15, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 15, 15, 15, 15, 15, 0, 0, 0, 15, 15, 15, 0,
+15, 15, 15, 15, 0, 0, 15, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 0, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 0,
+16, 16, 16, 0, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 16, 16, 16, 0, 0,
+0, 0, 0, 16, 16, 16, 16, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0,
+0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 0, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+0, 17, 17, 17, 0, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0,
+0, 17, 0, 17, 17, 17, 17, 0, 0, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+186, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 0, 19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19,
+19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19,
+19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 19, 19,
+19, 19, 19, 19, 19, 19, 19, 0, 19, 0, 0, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+19, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 0, 19, 0, 19, 19, 19, 19, 19, 19, 19,
+19, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 19, 19, 19,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 1, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 21, 21, 0, 21, 0, 21, 21, 21, 21, 21,
+0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 0, 21, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 21, 21, 21, 21, 21, 0, 21, 0,
+21, 21, 21, 21, 21, 21, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 21,
+21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+22, 22, 22, 22, 22, 22, 22, 1, 1, 1, 1, 22, 22, 0, 0, 0, 0, 0, 23, 23, 23, 23,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 192, 192, 192, 192, 192, 192,
+192, 192, 192, 192, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 24, 0, 0, 0, 0, 0, 24, 0,
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 180, 24, 24, 24, 24, 25, 25, 25,
+25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 26,
+26, 26, 26, 0, 0, 26, 26, 26, 26, 26, 26, 26, 0, 26, 0, 26, 26, 26, 26, 0, 0,
+26, 0, 26, 26, 26, 26, 0, 0, 26, 26, 26, 26, 26, 26, 26, 0, 26, 0, 26, 26, 26,
+26, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 26, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0, 27, 27, 27, 27,
+27, 27, 0, 0, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 1, 1, 1,
+30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 42, 42, 42, 42,
+42, 42, 42, 42, 42, 42, 42, 42, 42, 0, 42, 42, 42, 42, 42, 42, 42, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+43, 43, 43, 43, 43, 43, 199, 199, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45,
+45, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+31, 31, 31, 0, 0, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 0, 0, 0, 0, 0, 0, 32,
+32, 188, 188, 32, 188, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0,
+0, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0, 28, 28, 28, 28,
+28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+46, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 0, 0, 0, 0, 46, 0, 0, 0,
+46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47,
+47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+47, 47, 0, 0, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56,
+56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+56, 56, 56, 56, 56, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0,
+0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 56, 56, 54, 54,
+54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+78, 0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 78, 78, 78, 78,
+78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78,
+78, 78, 78, 78, 78, 78, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 0, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+67, 67, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+93, 93, 0, 0, 0, 0, 0, 0, 0, 0, 93, 93, 93, 93, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 68, 68, 68, 69, 69,
+69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24,
+24, 24, 67, 67, 67, 67, 67, 67, 67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 198, 158, 198,
+176, 158, 168, 168, 178, 168, 178, 204, 158, 178, 178, 158, 158, 178, 168, 158,
+158, 158, 158, 158, 158, 158, 177, 168, 158, 158, 168, 158, 158, 158, 158, 206,
+176, 194, 168, 168, 157, 176, 176, 163, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 3, 3,
+3, 3, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2,
+2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 160, 160, 41, 41, 41, 41,
+41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 175, 41,
+0, 41, 41, 41, 41, 41, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3,
+3, 3, 3, 3, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+0, 0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3,
+3, 3, 3, 0, 3, 3, 3, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 41, 41, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 187, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53,
+53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 57, 57, 57, 57, 57, 57,
+57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+57, 57, 57, 57, 57, 0, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+55, 55, 55, 55, 55, 55, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 55, 58, 58, 58,
+58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+58, 0, 0, 0, 0, 0, 0, 0, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58,
+26, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26,
+26, 0, 26, 26, 26, 26, 26, 26, 26, 0, 1, 1, 1, 172, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+36, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 0, 0, 0, 0, 1, 203, 203, 202, 1, 36, 161, 36, 203, 203, 203, 203, 203,
+203, 203, 203, 203, 203, 1, 202, 203, 203, 203, 203, 203, 203, 203, 203, 202,
+202, 202, 202, 1, 36, 36, 36, 36, 36, 36, 36, 36, 36, 169, 169, 169, 169, 25,
+25, 202, 185, 185, 185, 185, 185, 1, 202, 36, 36, 36, 36, 196, 196, 161, 161, 0,
+33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0,
+185, 185, 185, 185, 33, 33, 33, 185, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 203, 185, 34, 34, 34, 0, 0, 0, 0, 0,
+35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+35, 35, 35, 35, 35, 35, 35, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 161,
+161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+161, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 161, 161, 161, 161, 161,
+161, 161, 1, 1, 1, 1, 1, 1, 1, 1, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+25, 25, 25, 25, 1, 161, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 161, 161,
+161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 1, 1, 1, 1, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 161, 34, 34, 34, 34, 34, 34, 34, 34,
+161, 161, 161, 161, 161, 161, 161, 161, 161, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 161,
+161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+161, 161, 161, 1, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+83, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 172, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 0, 0, 0, 0, 0, 0, 0, 0, 184, 184, 184, 184, 184,
+184, 184, 184, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2,
+2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 59, 59, 59,
+59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+59, 59, 59, 59, 59, 59, 0, 0, 0, 211, 211, 211, 210, 210, 210, 207, 207, 207,
+207, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71,
+71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0,
+0, 0, 0, 0, 0, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0,
+10, 168, 10, 179, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 72, 72, 72,
+72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+72, 72, 72, 72, 72, 72, 72, 197, 72, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+73, 73, 73, 73, 73, 73, 73, 73, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 25, 25,
+25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85,
+85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+85, 85, 85, 0, 170, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0, 85, 85,
+23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 0, 77, 77, 77, 77,
+77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+0, 0, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 77, 77, 77, 77, 79, 79, 79,
+79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 79, 79, 79, 79, 86,
+86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+86, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 0, 0, 26, 26, 26,
+26, 26, 26, 0, 0, 26, 26, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 1, 1, 0, 0, 0,
+0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 0, 0, 86, 86, 86, 86,
+86, 86, 86, 86, 86, 86, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25,
+25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 36, 36, 36, 36, 36, 36,
+36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0,
+0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+5, 5, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6, 6, 6, 0, 6, 0, 6,
+6, 0, 6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 1, 1, 0, 0, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 167, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 167, 0, 0,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41,
+41, 41, 41, 41, 41, 41, 4, 4, 1, 1, 1, 1, 1, 202, 202, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+1, 1, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 1, 0, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 203, 203, 203, 203, 203, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 185,
+185, 0, 0, 25, 25, 25, 25, 25, 25, 0, 0, 25, 25, 25, 25, 25, 25, 0, 0, 25, 25,
+25, 25, 25, 25, 0, 0, 25, 25, 25, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 48, 48, 48, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 48, 48, 0, 48, 48,
+48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 0, 48, 48, 48, 48, 48,
+48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0, 171, 171, 171, 0, 0, 0, 0, 193, 193, 193,
+193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 0, 0, 0, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 41, 0, 0, 74, 74, 74, 74, 74,
+74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+74, 74, 74, 74, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 164, 164, 164,
+164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+164, 164, 164, 164, 164, 164, 164, 164, 0, 0, 0, 0, 38, 38, 38, 38, 38, 38, 38,
+38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 120, 120, 120, 120, 120,
+120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+120, 120, 120, 120, 120, 120, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+49, 0, 49, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+60, 60, 60, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+40, 40, 40, 40, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 0, 0, 0, 0, 0, 0, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+136, 136, 136, 136, 136, 136, 136, 136, 136, 0, 0, 0, 0, 136, 136, 136, 136,
+136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+0, 0, 0, 0, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0,
+103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+103, 103, 103, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 110, 110, 110, 110,
+110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+110, 110, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 110, 110, 110, 110, 110, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 110, 110, 110, 110, 110, 110, 110, 110, 0, 0, 0, 0, 0, 0,
+0, 0, 52, 52, 52, 52, 52, 52, 0, 0, 52, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0,
+52, 52, 0, 0, 0, 52, 0, 0, 52, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 0, 0,
+0, 0, 0, 0, 0, 0, 117, 117, 117, 117, 117, 117, 117, 117, 117, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+0, 128, 128, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 0, 0, 0, 64, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 0, 0, 0, 0, 0, 76, 98, 98, 98, 98, 98,
+98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 97, 97,
+97, 97, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 61, 61,
+61, 61, 0, 61, 61, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 0, 61, 61, 61,
+0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 0, 0, 61, 61, 61, 0, 0, 0, 0, 61, 61,
+61, 61, 61, 61, 61, 61, 61, 61, 0, 0, 0, 0, 0, 0, 0, 88, 88, 88, 88, 88, 88, 88,
+88, 88, 88, 88, 88, 88, 88, 88, 88, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+116, 116, 116, 116, 116, 116, 116, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 0, 0, 0,
+0, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+80, 80, 80, 80, 0, 0, 0, 80, 80, 80, 80, 80, 80, 80, 89, 89, 89, 89, 89, 89, 89,
+89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 0, 0, 89, 89, 89,
+89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+90, 90, 90, 90, 0, 0, 0, 0, 0, 90, 90, 90, 90, 90, 90, 90, 90, 121, 121, 121,
+121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 0, 0,
+0, 0, 0, 0, 0, 121, 121, 121, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 121,
+121, 121, 121, 121, 121, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 0, 0, 0, 0, 0, 0, 0, 130, 130, 130,
+130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 130, 130, 0, 0, 0, 0, 0, 0, 0, 130,
+130, 130, 130, 130, 130, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 0, 0, 0, 0, 0,
+0, 0, 0, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 0, 0, 0, 0, 0, 0, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 156, 156, 156, 156, 156, 156, 156,
+156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+156, 156, 156, 0, 156, 156, 156, 0, 0, 156, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 0, 0, 0, 0, 0, 0, 0,
+147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 0, 0, 0, 0, 0, 0, 153, 153,
+153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 149, 149, 149,
+149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+149, 149, 149, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94,
+94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+94, 94, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 92, 92, 92, 92, 92, 92, 92, 92,
+92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 0,
+0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 0, 101, 101,
+101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96,
+96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 96, 96, 96,
+96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0,
+0, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+111, 111, 111, 111, 111, 111, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 100,
+100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 19, 19,
+19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+109, 109, 109, 109, 109, 109, 109, 0, 109, 109, 109, 109, 109, 109, 109, 109,
+109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+109, 109, 109, 109, 0, 129, 129, 129, 129, 129, 129, 129, 0, 129, 0, 129, 129,
+129, 129, 0, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+129, 129, 0, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 0, 0, 0, 0,
+0, 0, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 0, 0, 0, 123,
+123, 123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 0, 0, 0, 0, 107, 181, 107,
+181, 0, 107, 107, 107, 107, 107, 107, 107, 107, 0, 0, 107, 107, 0, 0, 107, 107,
+107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+107, 107, 107, 107, 0, 107, 107, 107, 107, 107, 107, 107, 0, 107, 107, 0, 107,
+107, 107, 107, 107, 0, 181, 181, 107, 107, 107, 107, 107, 107, 107, 107, 0, 0,
+107, 107, 0, 0, 107, 107, 107, 0, 0, 107, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0,
+107, 107, 107, 107, 107, 107, 107, 0, 0, 107, 107, 107, 107, 107, 107, 107, 0,
+0, 0, 107, 107, 107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135,
+135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+135, 135, 135, 135, 135, 135, 135, 135, 135, 0, 135, 135, 135, 135, 135, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 0, 0,
+0, 0, 0, 0, 0, 0, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 0, 0, 0, 0,
+0, 0, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+122, 122, 122, 122, 122, 122, 122, 0, 0, 122, 122, 122, 122, 122, 122, 122, 122,
+122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 0, 0, 114,
+114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+114, 114, 114, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 114, 114, 114, 114,
+114, 114, 114, 114, 114, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0,
+0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0,
+126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 0, 126, 126, 126, 126,
+126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 0, 0, 0, 142, 142,
+142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 0, 0, 0, 0, 125, 125, 125,
+125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 154, 154, 154, 154, 154, 154, 154, 0,
+0, 154, 0, 0, 154, 154, 154, 154, 154, 154, 154, 154, 0, 154, 154, 0, 154, 154,
+154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 0, 154, 154, 0, 0,
+154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 0, 0, 0, 0, 0, 0, 150,
+150, 150, 150, 150, 150, 150, 150, 0, 0, 150, 150, 150, 150, 150, 150, 150, 150,
+150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+150, 150, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 141, 141, 141, 141, 141, 141,
+141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+141, 141, 0, 0, 0, 0, 0, 0, 0, 0, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 0, 0, 0, 0, 0, 0, 0, 133,
+133, 133, 133, 133, 133, 133, 133, 133, 0, 133, 133, 133, 133, 133, 133, 133,
+133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+133, 133, 133, 133, 133, 133, 0, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+133, 133, 133, 133, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 133, 133, 133, 133,
+133, 133, 133, 133, 133, 133, 133, 133, 0, 0, 0, 134, 134, 134, 134, 134, 134,
+134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 134, 134, 134, 134, 134,
+134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+134, 0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 138, 138, 138, 138, 138, 138, 138, 0, 138, 138, 0, 138,
+138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0, 0, 0, 138, 0, 138,
+138, 0, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0, 0, 0, 0, 0, 0, 0, 0,
+138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0, 0, 0, 0, 0, 0, 143, 143,
+143, 143, 143, 143, 0, 143, 143, 0, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 0, 143, 143, 0, 143,
+143, 143, 143, 143, 143, 0, 0, 0, 0, 0, 0, 0, 143, 143, 143, 143, 143, 143, 143,
+143, 143, 143, 0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 181, 181, 15, 181, 15,
+15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 15, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0, 63, 63, 63, 63, 63,
+63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 0, 63, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81,
+81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+81, 81, 81, 81, 81, 81, 81, 81, 0, 81, 81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0,
+0, 0, 0, 0, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 0, 0, 0, 0, 0, 0, 0, 115, 115, 115, 115, 115,
+115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 115, 115, 115, 115, 115,
+115, 115, 115, 115, 115, 0, 0, 0, 0, 115, 115, 104, 104, 104, 104, 104, 104,
+104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+104, 104, 104, 104, 104, 104, 104, 104, 0, 0, 104, 104, 104, 104, 104, 104, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 108, 108, 108,
+108, 108, 108, 108, 0, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 0, 0, 0, 0, 0, 108, 108, 108,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 0, 0, 0, 0, 0, 99, 99,
+99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+99, 99, 99, 99, 99, 0, 0, 0, 0, 99, 99, 99, 99, 99, 99, 99, 99, 99, 0, 0, 0, 0,
+0, 0, 0, 99, 137, 139, 1, 1, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 0, 0,
+0, 0, 0, 0, 0, 0, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+137, 137, 137, 137, 137, 137, 137, 137, 137, 0, 0, 0, 0, 0, 0, 0, 34, 33, 33,
+33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+33, 33, 33, 33, 33, 33, 33, 33, 0, 33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139,
+139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+139, 139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0, 105, 105, 105, 105, 105,
+105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+105, 105, 105, 105, 105, 105, 0, 0, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105,
+105, 105, 105, 105, 105, 105, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105,
+105, 0, 0, 0, 0, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 0,
+0, 105, 105, 105, 105, 159, 159, 159, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 41, 41, 41, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 41, 41, 41, 41, 41, 41, 41, 41, 1, 1, 41, 41, 41, 41, 41, 41,
+41, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 41, 41, 41, 41, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 161, 1, 1, 1, 1, 1, 1,
+1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1,
+0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1,
+1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1,
+1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 131, 131, 131,
+131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+131, 131, 131, 131, 131, 131, 131, 131, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 131, 131, 131, 131, 131, 0, 131, 131, 131, 131, 131, 131, 131, 131,
+131, 131, 131, 131, 131, 131, 131, 57, 57, 57, 57, 57, 57, 57, 0, 57, 57, 57,
+57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 0, 0, 57, 57, 57, 57,
+57, 57, 57, 0, 57, 57, 0, 57, 57, 57, 57, 57, 0, 0, 0, 0, 0, 151, 151, 151, 151,
+151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+151, 151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 0, 151, 151, 151, 151, 151,
+151, 151, 151, 151, 151, 151, 151, 151, 151, 0, 0, 151, 151, 151, 151, 151, 151,
+151, 151, 151, 151, 0, 0, 0, 0, 151, 151, 152, 152, 152, 152, 152, 152, 152,
+152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+152, 152, 152, 0, 0, 0, 0, 0, 152, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0, 0, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 0,
+0, 0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 0, 0, 0, 132, 132, 1,
+1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 0, 0, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 0, 7, 0, 0,
+7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 0, 7, 0, 7, 0, 0, 0, 0, 0, 0,
+7, 0, 0, 0, 0, 7, 0, 7, 0, 7, 0, 7, 7, 7, 0, 7, 7, 0, 7, 0, 0, 7, 0, 7, 0, 7, 0,
+7, 0, 7, 0, 7, 7, 0, 7, 0, 0, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7,
+0, 7, 7, 7, 7, 0, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 7, 7, 7, 0, 7, 7, 7, 7, 7, 0, 7, 7, 7,
+7, 7, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 33, 1, 1, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 36,
+36, 36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0, 0, 0,
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
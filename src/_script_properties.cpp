@@ -0,0 +1,3082 @@
+static_assert(static_cast<int>(Script::Unassigned) == 0, "");
+static_assert(static_cast<int>(Script::Common) == 1, "");
+static_assert(static_cast<int>(Script::Latin) == 2, "");
+static_assert(static_cast<int>(Script::Greek) == 3, "");
+static_assert(static_cast<int>(Script::Cyrillic) == 4, "");
+static_assert(static_cast<int>(Script::Armenian) == 5, "");
+static_assert(static_cast<int>(Script::Hebrew) == 6, "");
+static_assert(static_cast<int>(Script::Arabic) == 7, "");
+static_assert(static_cast<int>(Script::Syriac) == 8, "");
+static_assert(static_cast<int>(Script::Thaana) == 9, "");
+static_assert(static_cast<int>(Script::Devanagari) == 10, "");
+static_assert(static_cast<int>(Script::Bengali) == 11, "");
+static_assert(static_cast<int>(Script::Gurmukhi) == 12, "");
+static_assert(static_cast<int>(Script::Gujarati) == 13, "");
+static_assert(static_cast<int>(Script::Oriya) == 14, "");
+static_assert(static_cast<int>(Script::Tamil) == 15, "");
+static_assert(static_cast<int>(Script::Telugu) == 16, "");
+static_assert(static_cast<int>(Script::Kannada) == 17, "");
+static_assert(static_cast<int>(Script::Malayalam) == 18, "");
+static_assert(static_cast<int>(Script::Sinhala) == 19, "");
+static_assert(static_cast<int>(Script::Thai) == 20, "");
+static_assert(static_cast<int>(Script::Lao) == 21, "");
+static_assert(static_cast<int>(Script::Tibetan) == 22, "");
+static_assert(static_cast<int>(Script::Myanmar) == 23, "");
+static_assert(static_cast<int>(Script::Georgian) == 24, "");
+static_assert(static_cast<int>(Script::Hangul) == 25, "");
+static_assert(static_cast<int>(Script::Ethiopic) == 26, "");
+static_assert(static_cast<int>(Script::Cherokee) == 27, "");
+static_assert(static_cast<int>(Script::Canadian_Aboriginal) == 28, "");
+static_assert(static_cast<int>(Script::Ogham) == 29, "");
+static_assert(static_cast<int>(Script::Runic) == 30, "");
+static_assert(static_cast<int>(Script::Khmer) == 31, "");
+static_assert(static_cast<int>(Script::Mongolian) == 32, "");
+static_assert(static_cast<int>(Script::Hiragana) == 33, "");
+static_assert(static_cast<int>(Script::Katakana) == 34, "");
+static_assert(static_cast<int>(Script::Bopomofo) == 35, "");
+static_assert(static_cast<int>(Script::Han) == 36, "");
+static_assert(static_cast<int>(Script::Yi) == 37, "");
+static_assert(static_cast<int>(Script::Old_Italic) == 38, "");
+static_assert(static_cast<int>(Script::Gothic) == 39, "");
+static_assert(static_cast<int>(Script::Deseret) == 40, "");
+static_assert(static_cast<int>(Script::Inherited) == 41, "");
+static_assert(static_cast<int>(Script::Tagalog) == 42, "");
+static_assert(static_cast<int>(Script::Hanunoo) == 43, "");
+static_assert(static_cast<int>(Script::Buhid) == 44, "");
+static_assert(static_cast<int>(Script::Tagbanwa) == 45, "");
+static_assert(static_cast<int>(Script::Limbu) == 46, "");
+static_assert(static_cast<int>(Script::Tai_Le) == 47, "");
+static_assert(static_cast<int>(Script::Linear_B) == 48, "");
+static_assert(static_cast<int>(Script::Ugaritic) == 49, "");
+static_assert(static_cast<int>(Script::Shavian) == 50, "");
+static_assert(static_cast<int>(Script::Osmanya) == 51, "");
+static_assert(static_cast<int>(Script::Cypriot) == 52, "");
+static_assert(static_cast<int>(Script::Braille) == 53, "");
+static_assert(static_cast<int>(Script::Buginese) == 54, "");
+static_assert(static_cast<int>(Script::Coptic) == 55, "");
+static_assert(static_cast<int>(Script::New_Tai_Lue) == 56, "");
+static_assert(static_cast<int>(Script::Glagolitic) == 57, "");
+static_assert(static_cast<int>(Script::Tifinagh) == 58, "");
+static_assert(static_cast<int>(Script::Syloti_Nagri) == 59, "");
+static_assert(static_cast<int>(Script::Old_Persian) == 60, "");
+static_assert(static_cast<int>(Script::Kharoshthi) == 61, "");
+static_assert(static_cast<int>(Script::Balinese) == 62, "");
+static_assert(static_cast<int>(Script::Cuneiform) == 63, "");
+static_assert(static_cast<int>(Script::Phoenician) == 64, "");
+static_assert(static_cast<int>(Script::Phags_Pa) == 65, "");
+static_assert(static_cast<int>(Script::Nko) == 66, "");
+static_assert(static_cast<int>(Script::Sundanese) == 67, "");
+static_assert(static_cast<int>(Script::Lepcha) == 68, "");
+static_assert(static_cast<int>(Script::Ol_Chiki) == 69, "");
+static_assert(static_cast<int>(Script::Vai) == 70, "");
+static_assert(static_cast<int>(Script::Saurashtra) == 71, "");
+static_assert(static_cast<int>(Script::Kayah_Li) == 72, "");
+static_assert(static_cast<int>(Script::Rejang) == 73, "");
+static_assert(static_cast<int>(Script::Lycian) == 74, "");
+static_assert(static_cast<int>(Script::Carian) == 75, "");
+static_assert(static_cast<int>(Script::Lydian) == 76, "");
+static_assert(static_cast<int>(Script::Cham) == 77, "");
+static_assert(static_cast<int>(Script::Tai_Tham) == 78, "");
+static_assert(static_cast<int>(Script::Tai_Viet) == 79, "");
+static_assert(static_cast<int>(Script::Avestan) == 80, "");
+static_assert(static_cast<int>(Script::Egyptian_Hieroglyphs) == 81, "");
+static_assert(static_cast<int>(Script::Samaritan) == 82, "");
+static_assert(static_cast<int>(Script::Lisu) == 83, "");
+static_assert(static_cast<int>(Script::Bamum) == 84, "");
+static_assert(static_cast<int>(Script::Javanese) == 85, "");
+static_assert(static_cast<int>(Script::Meetei_Mayek) == 86, "");
+static_assert(static_cast<int>(Script::Imperial_Aramaic) == 87, "");
+static_assert(static_cast<int>(Script::Old_South_Arabian) == 88, "");
+static_assert(static_cast<int>(Script::Inscriptional_Parthian) == 89, "");
+static_assert(static_cast<int>(Script::Inscriptional_Pahlavi) == 90, "");
+static_assert(static_cast<int>(Script::Old_Turkic) == 91, "");
+static_assert(static_cast<int>(Script::Kaithi) == 92, "");
+static_assert(static_cast<int>(Script::Batak) == 93, "");
+static_assert(static_cast<int>(Script::Brahmi) == 94, "");
+static_assert(static_cast<int>(Script::Mandaic) == 95, "");
+static_assert(static_cast<int>(Script::Chakma) == 96, "");
+static_assert(static_cast<int>(Script::Meroitic_Cursive) == 97, "");
+static_assert(static_cast<int>(Script::Meroitic_Hieroglyphs) == 98, "");
+static_assert(static_cast<int>(Script::Miao) == 99, "");
+static_assert(static_cast<int>(Script::Sharada) == 100, "");
+static_assert(static_cast<int>(Script::Sora_Sompeng) == 101, "");
+static_assert(static_cast<int>(Script::Takri) == 102, "");
+static_assert(static_cast<int>(Script::Caucasian_Albanian) == 103, "");
+static_assert(static_cast<int>(Script::Bassa_Vah) == 104, "");
+static_assert(static_cast<int>(Script::Duployan) == 105, "");
+static_assert(static_cast<int>(Script::Elbasan) == 106, "");
+static_assert(static_cast<int>(Script::Grantha) == 107, "");
+static_assert(static_cast<int>(Script::Pahawh_Hmong) == 108, "");
+static_assert(static_cast<int>(Script::Khojki) == 109, "");
+static_assert(static_cast<int>(Script::Linear_A) == 110, "");
+static_assert(static_cast<int>(Script::Mahajani) == 111, "");
+static_assert(static_cast<int>(Script::Manichaean) == 112, "");
+static_assert(static_cast<int>(Script::Mende_Kikakui) == 113, "");
+static_assert(static_cast<int>(Script::Modi) == 114, "");
+static_assert(static_cast<int>(Script::Mro) == 115, "");
+static_assert(static_cast<int>(Script::Old_North_Arabian) == 116, "");
+static_assert(static_cast<int>(Script::Nabataean) == 117, "");
+static_assert(static_cast<int>(Script::Palmyrene) == 118, "");
+static_assert(static_cast<int>(Script::Pau_Cin_Hau) == 119, "");
+static_assert(static_cast<int>(Script::Old_Permic) == 120, "");
+static_assert(static_cast<int>(Script::Psalter_Pahlavi) == 121, "");
+static_assert(static_cast<int>(Script::Siddham) == 122, "");
+static_assert(static_cast<int>(Script::Khudawadi) == 123, "");
+static_assert(static_cast<int>(Script::Tirhuta) == 124, "");
+static_assert(static_cast<int>(Script::Warang_Citi) == 125, "");
+static_assert(static_cast<int>(Script::Ahom) == 126, "");
+static_assert(static_cast<int>(Script::Anatolian_Hieroglyphs) == 127, "");
+static_assert(static_cast<int>(Script::Hatran) == 128, "");
+static_assert(static_cast<int>(Script::Multani) == 129, "");
+static_assert(static_cast<int>(Script::Old_Hungarian) == 130, "");
+static_assert(static_cast<int>(Script::SignWriting) == 131, "");
+static_assert(static_cast<int>(Script::Adlam) == 132, "");
+static_assert(static_cast<int>(Script::Bhaiksuki) == 133, "");
+static_assert(static_cast<int>(Script::Marchen) == 134, "");
+static_assert(static_cast<int>(Script::Newa) == 135, "");
+static_assert(static_cast<int>(Script::Osage) == 136, "");
+static_assert(static_cast<int>(Script::Tangut) == 137, "");
+static_assert(static_cast<int>(Script::Masaram_Gondi) == 138, "");
+static_assert(static_cast<int>(Script::Nushu) == 139, "");
+static_assert(static_cast<int>(Script::Soyombo) == 140, "");
+static_assert(static_cast<int>(Script::Zanabazar_Square) == 141, "");
+static_assert(static_cast<int>(Script::Dogra) == 142, "");
+static_assert(static_cast<int>(Script::Gunjala_Gondi) == 143, "");
+static_assert(static_cast<int>(Script::Makasar) == 144, "");
+static_assert(static_cast<int>(Script::Medefaidrin) == 145, "");
+static_assert(static_cast<int>(Script::Hanifi_Rohingya) == 146, "");
+static_assert(static_cast<int>(Script::Sogdian) == 147, "");
+static_assert(static_cast<int>(Script::Old_Sogdian) == 148, "");
+static_assert(static_cast<int>(Script::Elymaic) == 149, "");
+static_assert(static_cast<int>(Script::Nandinagari) == 150, "");
+static_assert(static_cast<int>(Script::Nyiakeng_Puachue_Hmong) == 151, "");
+static_assert(static_cast<int>(Script::Wancho) == 152, "");
+static_assert(static_cast<int>(Script::Chorasmian) == 153, "");
+static_assert(static_cast<int>(Script::Dives_Akuru) == 154, "");
+static_assert(static_cast<int>(Script::Khitan_Small_Script) == 155, "");
+static_assert(static_cast<int>(Script::Yezidi) == 156, "");
+const uint16_t _script_properties_stage1[] = {
+0, 64, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 832, 832, 832,
+832, 832, 832, 896, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 960, 1024, 1088, 1152, 1216, 1216, 1216,
+1216, 1216, 1216, 1216, 1216, 1216, 1216, 1280, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1408, 1472, 1536, 1600, 1664, 1728, 1792, 1856, 1920, 1984,
+2048, 2112, 1344, 1344, 2176, 2240, 1344, 1344, 1344, 2304, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 2368, 2432, 2496, 2496, 2496, 2496, 2496, 2560,
+2624, 2688, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 2752, 1344, 1344,
+2816, 1344, 1344, 1344, 1344, 2880, 2944, 3008, 1344, 3072, 1344, 3136, 3200,
+3264, 3328, 3392, 1344, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832,
+832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 832, 3456, 832,
+832, 832, 3520, 3584, 832, 832, 832, 832, 3648, 832, 832, 832, 832, 832, 832,
+3712, 1344, 1344, 1344, 3776, 1344, 832, 832, 832, 832, 3840, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 3904, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+1344, 1344, 1344, 1344,
+};
+const uint16_t _script_properties_stage2[] = {
+0, 0, 0, 0, 16, 32, 16, 32, 0, 0, 48, 48, 64, 80, 64, 80, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 96, 0, 0, 112, 0, 128, 128, 128, 128, 128, 128, 128, 144, 160, 176, 192,
+176, 176, 176, 208, 176, 224, 224, 224, 224, 224, 224, 224, 224, 240, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 256, 272, 288, 272, 272, 304, 320, 336,
+336, 352, 336, 368, 384, 400, 416, 432, 432, 448, 464, 432, 480, 432, 432, 432,
+432, 432, 496, 432, 432, 512, 528, 528, 528, 544, 432, 432, 432, 560, 560, 560,
+576, 592, 592, 592, 608, 624, 624, 640, 656, 672, 688, 704, 720, 720, 720, 432,
+736, 752, 768, 784, 432, 800, 800, 800, 800, 800, 816, 832, 800, 848, 864, 880,
+896, 912, 928, 944, 960, 976, 992, 1008, 1024, 1040, 1056, 1072, 1088, 1104,
+1120, 1136, 1152, 1168, 1184, 1200, 1216, 1232, 1248, 1264, 1280, 1296, 1312,
+1328, 1344, 1360, 1376, 1392, 1408, 1424, 1440, 1456, 1472, 1488, 1504, 1520,
+1536, 1552, 1568, 1584, 1600, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728,
+1744, 1760, 1776, 1776, 1792, 1808, 1824, 1776, 1840, 1856, 1872, 1888, 1904,
+1920, 1936, 1952, 1968, 1984, 1984, 2000, 1984, 2016, 720, 720, 2032, 2048,
+2064, 2080, 2096, 2112, 720, 720, 2128, 2128, 2128, 2128, 2144, 2128, 2160,
+2176, 2128, 2144, 2128, 2192, 2192, 2208, 720, 720, 2224, 2224, 2224, 2224,
+2224, 2224, 2224, 2224, 2224, 2224, 2240, 2240, 2256, 2240, 2240, 2272, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2304, 2304, 2304, 2304, 2320, 2336, 2304, 2304, 2320, 2304, 2304,
+2352, 2368, 2384, 2304, 2304, 2304, 2368, 2304, 2304, 2304, 2400, 2304, 2416,
+2304, 2432, 2448, 2448, 2448, 2448, 2448, 2464, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480,
+2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2496, 2512, 2528, 2528,
+2528, 2528, 2544, 2560, 2576, 2592, 2608, 2624, 2640, 2656, 2672, 2688, 2704,
+2704, 2704, 2704, 2704, 2720, 2736, 2736, 2752, 2768, 2784, 2784, 2784, 2784,
+2784, 2800, 2784, 2784, 2816, 2480, 2480, 2480, 2480, 2832, 2848, 2864, 2880,
+2880, 2896, 2912, 2928, 2944, 2960, 2960, 2976, 2960, 2992, 3008, 2704, 2704,
+3024, 3040, 3056, 3056, 3056, 3072, 3056, 3088, 3104, 3104, 3120, 128, 3136,
+720, 720, 720, 3152, 3152, 3152, 3152, 3168, 3152, 3152, 3184, 3200, 3200, 3200,
+3200, 3216, 3216, 3216, 3232, 3248, 3248, 3248, 3264, 3280, 3296, 3296, 3296,
+3312, 2240, 2240, 3328, 3344, 3360, 3376, 3392, 64, 64, 3408, 64, 64, 3424,
+3440, 3456, 64, 64, 64, 3472, 128, 128, 128, 3488, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 176, 3504, 176, 176, 3504, 3520, 176, 3536,
+176, 176, 176, 3552, 3552, 3568, 176, 3584, 3600, 0, 0, 0, 0, 0, 3616, 3632,
+3648, 3664, 0, 0, 720, 128, 128, 3136, 0, 0, 3680, 3696, 3712, 0, 64, 64, 3728,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3744, 720, 3760, 720, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
+3776, 3776, 3776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3792, 0, 3808, 0, 0, 0, 0,
+0, 0, 3824, 3824, 3840, 3824, 3824, 3840, 64, 64, 3856, 3856, 3856, 3856, 3856,
+3856, 3856, 3872, 2240, 2240, 2256, 3888, 3888, 3888, 3904, 3920, 2304, 3936,
+3952, 3952, 3952, 3952, 224, 224, 0, 0, 0, 0, 0, 3968, 720, 720, 3984, 4000,
+3984, 3984, 3984, 3984, 3984, 4016, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 4032, 720, 4048, 4064, 0, 4080, 4096, 4112,
+4128, 4128, 4128, 4128, 4144, 4160, 4176, 4176, 4176, 4176, 4192, 4208, 4224,
+4224, 4240, 2288, 2288, 2288, 2288, 4256, 0, 4224, 4224, 0, 0, 4272, 4176, 2288,
+4256, 0, 0, 0, 0, 2288, 4288, 0, 0, 0, 0, 0, 4176, 4176, 4304, 4176, 4176, 4176,
+4176, 4176, 4320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 0, 0, 0, 0, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 4336, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352,
+4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4352, 4368, 4352, 4352,
+4352, 4384, 4400, 4400, 4400, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
+4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4432, 720, 224, 224,
+224, 224, 224, 224, 4448, 4448, 4448, 4448, 4448, 4464, 0, 0, 4480, 64, 64, 64,
+64, 64, 4496, 64, 64, 64, 4512, 720, 720, 4528, 4544, 4544, 4560, 4576, 4592,
+4592, 4592, 4608, 4624, 4624, 4624, 4624, 4640, 4656, 800, 800, 4672, 4672,
+4688, 4704, 4704, 4720, 2288, 4736, 4752, 4752, 4752, 4752, 4768, 4784, 2224,
+4800, 4816, 4816, 4816, 4832, 4848, 4864, 2224, 2224, 4880, 4880, 4880, 4880,
+4896, 4912, 4928, 4944, 4960, 4976, 3952, 64, 64, 4992, 5008, 2448, 2448, 2448,
+2448, 2448, 4928, 4928, 5024, 5040, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288,
+2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 5056, 2288,
+5072, 2288, 2288, 5088, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+5104, 3984, 3984, 3984, 3984, 3984, 3984, 5120, 720, 720, 5136, 5152, 336, 5168,
+5184, 432, 432, 432, 432, 432, 432, 432, 5200, 768, 432, 432, 432, 432, 432,
+432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432,
+5216, 720, 432, 432, 432, 432, 5232, 432, 432, 752, 720, 720, 5248, 128, 4576,
+5264, 0, 0, 5280, 5296, 736, 432, 432, 432, 432, 432, 432, 432, 5312, 5328, 0,
+16, 32, 16, 32, 5344, 4160, 4176, 5360, 2288, 4256, 5376, 5392, 5408, 5424,
+5440, 5456, 5472, 5488, 5504, 5504, 720, 720, 5456, 5456, 5456, 5456, 5456,
+5456, 5456, 5520, 5536, 0, 0, 5552, 176, 176, 176, 176, 5568, 5584, 5600, 720,
+720, 0, 0, 5616, 720, 720, 720, 720, 720, 720, 720, 720, 5632, 5648, 5664, 5664,
+5664, 5680, 5696, 4048, 5712, 5712, 5728, 5744, 5760, 5776, 5776, 5792, 5808,
+5824, 5840, 5840, 5856, 5872, 720, 720, 5888, 5888, 5888, 5888, 5888, 5904,
+5904, 5904, 5920, 5936, 5952, 5968, 5968, 5984, 5968, 6000, 6016, 6016, 6032,
+6048, 6048, 6048, 6064, 720, 720, 720, 720, 720, 720, 720, 720, 720, 6080, 6080,
+6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080, 6080,
+6080, 6080, 6080, 6080, 6096, 6080, 6112, 6128, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 6144, 6160, 6160, 6176, 6192, 6208, 6224, 6224, 6240, 6256, 6272,
+720, 720, 720, 6288, 6304, 6320, 6336, 6352, 6368, 720, 720, 720, 720, 6384,
+6384, 6400, 6416, 6400, 6432, 6400, 6400, 6448, 6464, 6480, 6496, 6512, 6512,
+6528, 6528, 6544, 6544, 720, 720, 6560, 6560, 6576, 6592, 6608, 6608, 6608,
+6624, 6640, 6656, 6672, 6688, 6704, 6720, 6736, 720, 720, 720, 720, 720, 6752,
+6752, 6752, 6752, 6768, 720, 720, 720, 6784, 6784, 6784, 6800, 6784, 6784, 6784,
+6816, 6832, 6832, 6848, 6864, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 432, 6880, 6896, 6896, 6912, 6928, 720,
+720, 720, 720, 6944, 6944, 6960, 6976, 6976, 6992, 720, 720, 720, 720, 720,
+7008, 7024, 720, 7040, 7056, 7072, 7072, 7072, 7072, 7088, 7104, 7072, 7120,
+7136, 7136, 7136, 7136, 7152, 7168, 7184, 7200, 7216, 7216, 7216, 7232, 7248,
+7264, 7264, 7280, 7296, 7296, 7296, 7296, 7296, 7296, 7312, 7328, 7344, 7360,
+7344, 7376, 720, 720, 720, 720, 7392, 7408, 7424, 7440, 7440, 7440, 7456, 7472,
+7488, 7504, 7520, 7536, 7552, 7568, 7584, 7600, 720, 720, 720, 720, 720, 720,
+720, 720, 7616, 7616, 7616, 7616, 7616, 7632, 7648, 720, 7664, 7664, 7664, 7664,
+7680, 7696, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 7712, 7712, 7712,
+7728, 7712, 7744, 720, 720, 7760, 7760, 7760, 7760, 7776, 7792, 7808, 720, 7824,
+7824, 7824, 7840, 7856, 720, 720, 720, 7872, 7888, 7904, 7872, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 7920, 7920, 7920, 7936, 720, 720,
+720, 720, 720, 720, 7952, 7952, 7952, 7952, 7952, 7968, 7984, 8000, 8016, 8032,
+8048, 8064, 720, 720, 720, 720, 8080, 8096, 8096, 8080, 8112, 720, 8128, 8128,
+8128, 8128, 8144, 8160, 8160, 8160, 8160, 8160, 8176, 720, 8192, 8192, 8192,
+8208, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 8224, 8240, 8240, 8256, 8272, 8240, 8288, 8304, 8304, 8320, 8336, 8352,
+720, 720, 720, 720, 8368, 8384, 8384, 8400, 8416, 8432, 8448, 8464, 8480, 8496,
+8512, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 8528, 8544, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 8560, 8576, 8576, 8576, 8592, 8608, 8608, 8608, 8608, 8608, 8608,
+8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608,
+8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608,
+8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608,
+8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8624,
+720, 720, 720, 720, 720, 720, 8608, 8608, 8608, 8608, 8608, 8608, 8640, 8656,
+8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8608, 8672,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 8688, 8688, 8688, 8688,
+8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688,
+8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688,
+8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688,
+8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688,
+8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8688, 8704, 8720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 8736, 8736, 8736, 8736,
+8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736,
+8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736, 8736,
+8736, 8736, 8736, 8736, 8736, 8736, 8752, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448,
+4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448,
+4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 4448, 8768,
+8784, 8800, 8816, 720, 720, 720, 720, 720, 720, 8832, 8848, 8864, 8880, 8880,
+8880, 8880, 8896, 8912, 8928, 8944, 8880, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 8960, 8960, 8960, 8960, 8960, 8976, 720, 720, 720, 720, 720,
+720, 8992, 8992, 8992, 8992, 9008, 8992, 8992, 8992, 9024, 8992, 720, 720, 720,
+720, 9040, 9056, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9088, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072,
+9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9072, 9104, 9104, 9104,
+9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104,
+9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104, 9104,
+9120, 720, 720, 9136, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 9152, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128, 4128,
+4128, 4128, 4128, 4128, 4128, 4128, 4128, 9168, 720, 720, 720, 9184, 9200, 9216,
+9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216,
+9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9216, 9232, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 9248, 9248,
+9248, 9248, 9248, 9248, 9264, 9280, 9296, 9312, 4272, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9328, 0, 0, 9344, 0, 0, 0, 9360,
+9376, 9392, 0, 9408, 0, 0, 0, 9424, 720, 176, 176, 176, 176, 9440, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 0, 4272, 0, 0, 0, 0, 0, 3744, 0, 9424, 720,
+720, 720, 720, 720, 720, 720, 720, 0, 0, 0, 0, 0, 3616, 0, 0, 0, 9456, 9472,
+9488, 9504, 0, 0, 0, 9520, 9536, 0, 9552, 9568, 9584, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 9616, 0, 0, 0, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632,
+9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632,
+9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632, 9632,
+9632, 9632, 9632, 9632, 9632, 9648, 9664, 9680, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 9696,
+9712, 9728, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+9744, 9744, 9760, 9776, 9792, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 9808, 9808,
+9808, 9824, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 9840, 9840, 9840, 9840, 9840, 9840, 9840, 9840, 9840, 9840, 9840,
+9840, 9856, 9872, 720, 720, 9888, 9888, 9888, 9888, 9904, 9920, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 5328, 0,
+0, 0, 9936, 720, 720, 720, 720, 5328, 0, 0, 9952, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 9968, 432, 9984, 10000, 10016, 10032, 10048,
+10064, 10080, 10096, 10112, 10096, 720, 720, 720, 5200, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 0, 0, 4048, 0, 0, 0, 0,
+0, 0, 4272, 3648, 5328, 5328, 5328, 0, 9328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9952,
+720, 720, 720, 10128, 0, 10144, 0, 0, 4048, 9424, 10160, 9328, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10176, 5584, 5584, 0, 0, 0,
+0, 0, 0, 0, 4272, 0, 0, 0, 0, 0, 9424, 4048, 720, 4048, 0, 0, 0, 10176, 4576, 0,
+0, 10176, 0, 9952, 10160, 720, 720, 720, 720, 0, 0, 0, 0, 0, 0, 0, 10192, 0, 0,
+0, 0, 10208, 0, 0, 0, 0, 0, 0, 0, 0, 4272, 9952, 10224, 3744, 0, 9424, 3744,
+3968, 3744, 720, 720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5280, 0, 0, 3760, 720, 720,
+4576, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 5104, 720, 720, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 10240,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+5104, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 9056, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 10256, 720, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 5104, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
+3984, 3984, 10272, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 10288,
+720, 0, 0, 0, 0, 0, 0, 720, 720, 720, 720, 720, 720, 720, 720, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+};
+const Script _script_properties_stage3[] = {
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Latin, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Common, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Bopomofo, Script::Bopomofo,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Common,
+Script::Greek, Script::Greek, Script::Greek, Script::Unassigned,
+Script::Unassigned, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Common, Script::Greek, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Greek, Script::Common,
+Script::Greek, Script::Common, Script::Greek, Script::Greek, Script::Greek,
+Script::Unassigned, Script::Greek, Script::Unassigned, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Unassigned,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Inherited, Script::Inherited, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Unassigned, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Unassigned,
+Script::Unassigned, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Armenian, Script::Unassigned,
+Script::Unassigned, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Unassigned, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Common,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Common, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Common, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Common, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Common, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Inherited, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Common, Script::Arabic, Script::Arabic, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Unassigned, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Unassigned, Script::Unassigned,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Thaana, Script::Thaana,
+Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana,
+Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana,
+Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana, Script::Thaana,
+Script::Thaana, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Nko,
+Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko,
+Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko,
+Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko,
+Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko, Script::Nko,
+Script::Nko, Script::Nko, Script::Unassigned, Script::Unassigned, Script::Nko,
+Script::Nko, Script::Nko, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Unassigned, Script::Unassigned, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Samaritan, Script::Samaritan, Script::Samaritan,
+Script::Samaritan, Script::Unassigned, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Mandaic, Script::Mandaic,
+Script::Mandaic, Script::Mandaic, Script::Unassigned, Script::Unassigned,
+Script::Mandaic, Script::Unassigned, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Syriac, Script::Syriac, Script::Syriac, Script::Syriac,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Common, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Common, Script::Common, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Devanagari, Script::Devanagari, Script::Devanagari,
+Script::Devanagari, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Unassigned, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Unassigned,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Unassigned,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Bengali,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Unassigned,
+Script::Unassigned, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Unassigned,
+Script::Bengali, Script::Bengali, Script::Unassigned, Script::Unassigned,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Bengali, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Bengali, Script::Bengali, Script::Unassigned,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Unassigned, Script::Unassigned, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Bengali, Script::Bengali, Script::Bengali, Script::Bengali,
+Script::Unassigned, Script::Unassigned, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned, Script::Unassigned,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi,
+Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi, Script::Gurmukhi,
+Script::Unassigned, Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned,
+Script::Unassigned, Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned, Script::Unassigned,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Gurmukhi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Unassigned, Script::Gurmukhi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi, Script::Gurmukhi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Unassigned, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Unassigned, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Unassigned, Script::Gujarati,
+Script::Gujarati, Script::Unassigned, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Unassigned, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Unassigned, Script::Gujarati, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Unassigned, Script::Unassigned, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Gujarati, Script::Gujarati, Script::Gujarati,
+Script::Gujarati, Script::Unassigned, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Unassigned, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Unassigned, Script::Unassigned, Script::Oriya, Script::Oriya,
+Script::Unassigned, Script::Unassigned, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Unassigned, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Unassigned, Script::Oriya,
+Script::Oriya, Script::Unassigned, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Unassigned, Script::Unassigned,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Unassigned,
+Script::Unassigned, Script::Oriya, Script::Oriya, Script::Unassigned,
+Script::Unassigned, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Oriya, Script::Oriya,
+Script::Unassigned, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Unassigned, Script::Unassigned, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya, Script::Oriya,
+Script::Oriya, Script::Oriya, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tamil, Script::Tamil, Script::Unassigned, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Unassigned, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tamil, Script::Tamil, Script::Unassigned, Script::Tamil,
+Script::Unassigned, Script::Tamil, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tamil, Script::Tamil,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Unassigned, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Unassigned, Script::Unassigned, Script::Tamil,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Telugu, Script::Telugu,
+Script::Unassigned, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Unassigned, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu, Script::Telugu,
+Script::Telugu, Script::Telugu, Script::Telugu, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Unassigned,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Unassigned, Script::Unassigned, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Kannada, Script::Kannada, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Kannada, Script::Unassigned, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Unassigned,
+Script::Unassigned, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Kannada,
+Script::Kannada, Script::Kannada, Script::Kannada, Script::Unassigned,
+Script::Kannada, Script::Kannada, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Unassigned, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Unassigned, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Unassigned, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Unassigned, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Unassigned,
+Script::Unassigned, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Malayalam,
+Script::Malayalam, Script::Malayalam, Script::Malayalam, Script::Unassigned,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Unassigned,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Unassigned, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Unassigned,
+Script::Sinhala, Script::Unassigned, Script::Unassigned, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Sinhala, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Unassigned, Script::Sinhala, Script::Unassigned, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Unassigned,
+Script::Unassigned, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Thai, Script::Thai, Script::Thai, Script::Thai,
+Script::Thai, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Lao, Script::Lao,
+Script::Unassigned, Script::Lao, Script::Unassigned, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Unassigned, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Unassigned, Script::Lao, Script::Unassigned, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Unassigned, Script::Unassigned,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Unassigned, Script::Lao, Script::Unassigned, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Unassigned,
+Script::Unassigned, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao, Script::Lao,
+Script::Unassigned, Script::Unassigned, Script::Lao, Script::Lao, Script::Lao,
+Script::Lao, Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Unassigned, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Unassigned, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Tibetan, Script::Tibetan, Script::Tibetan,
+Script::Tibetan, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Tibetan, Script::Tibetan, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Unassigned, Script::Georgian, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Georgian, Script::Unassigned, Script::Unassigned, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Common, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Unassigned, Script::Unassigned,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Unassigned,
+Script::Ethiopic, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Unassigned, Script::Unassigned,
+Script::Ethiopic, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Unassigned, Script::Unassigned,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Unassigned,
+Script::Ethiopic, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Unassigned, Script::Unassigned,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Unassigned,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Unassigned,
+Script::Unassigned, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Unassigned, Script::Unassigned,
+Script::Cherokee, Script::Cherokee, Script::Cherokee, Script::Cherokee,
+Script::Cherokee, Script::Cherokee, Script::Unassigned, Script::Unassigned,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham, Script::Ogham,
+Script::Ogham, Script::Ogham, Script::Ogham, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Common, Script::Common, Script::Common, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Runic,
+Script::Runic, Script::Runic, Script::Runic, Script::Runic, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tagalog, Script::Tagalog,
+Script::Tagalog, Script::Tagalog, Script::Tagalog, Script::Tagalog,
+Script::Tagalog, Script::Tagalog, Script::Tagalog, Script::Tagalog,
+Script::Tagalog, Script::Tagalog, Script::Tagalog, Script::Unassigned,
+Script::Tagalog, Script::Tagalog, Script::Tagalog, Script::Tagalog,
+Script::Tagalog, Script::Tagalog, Script::Tagalog, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Hanunoo, Script::Hanunoo,
+Script::Hanunoo, Script::Hanunoo, Script::Hanunoo, Script::Hanunoo,
+Script::Hanunoo, Script::Hanunoo, Script::Hanunoo, Script::Hanunoo,
+Script::Hanunoo, Script::Hanunoo, Script::Hanunoo, Script::Hanunoo,
+Script::Hanunoo, Script::Hanunoo, Script::Hanunoo, Script::Hanunoo,
+Script::Hanunoo, Script::Hanunoo, Script::Hanunoo, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Buhid, Script::Buhid,
+Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid,
+Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid,
+Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid, Script::Buhid,
+Script::Buhid, Script::Buhid, Script::Buhid, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Tagbanwa,
+Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa,
+Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa,
+Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa,
+Script::Unassigned, Script::Tagbanwa, Script::Tagbanwa, Script::Tagbanwa,
+Script::Unassigned, Script::Tagbanwa, Script::Tagbanwa, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Unassigned,
+Script::Unassigned, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer, Script::Khmer,
+Script::Khmer, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Mongolian,
+Script::Mongolian, Script::Common, Script::Common, Script::Mongolian,
+Script::Common, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Unassigned, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal,
+Script::Canadian_Aboriginal, Script::Canadian_Aboriginal, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Unassigned, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Limbu, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu, Script::Limbu,
+Script::Limbu, Script::Limbu, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Tai_Le, Script::Tai_Le, Script::Unassigned, Script::Unassigned,
+Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le, Script::Tai_Le,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::New_Tai_Lue,
+Script::New_Tai_Lue, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::New_Tai_Lue, Script::New_Tai_Lue, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Buginese, Script::Buginese,
+Script::Buginese, Script::Buginese, Script::Unassigned, Script::Unassigned,
+Script::Buginese, Script::Buginese, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Unassigned, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Unassigned,
+Script::Unassigned, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham, Script::Tai_Tham,
+Script::Unassigned, Script::Unassigned, Script::Inherited, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Balinese,
+Script::Balinese, Script::Balinese, Script::Balinese, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Sundanese, Script::Sundanese,
+Script::Sundanese, Script::Sundanese, Script::Sundanese, Script::Sundanese,
+Script::Sundanese, Script::Sundanese, Script::Sundanese, Script::Sundanese,
+Script::Sundanese, Script::Sundanese, Script::Sundanese, Script::Sundanese,
+Script::Sundanese, Script::Sundanese, Script::Batak, Script::Batak,
+Script::Batak, Script::Batak, Script::Batak, Script::Batak, Script::Batak,
+Script::Batak, Script::Batak, Script::Batak, Script::Batak, Script::Batak,
+Script::Batak, Script::Batak, Script::Batak, Script::Batak, Script::Batak,
+Script::Batak, Script::Batak, Script::Batak, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Batak,
+Script::Batak, Script::Batak, Script::Batak, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Lepcha, Script::Lepcha, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Lepcha, Script::Lepcha, Script::Lepcha,
+Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki,
+Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki,
+Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki,
+Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki, Script::Ol_Chiki,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Cyrillic, Script::Cyrillic, Script::Cyrillic,
+Script::Cyrillic, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Georgian, Script::Georgian, Script::Georgian, Script::Unassigned,
+Script::Unassigned, Script::Georgian, Script::Georgian, Script::Georgian,
+Script::Sundanese, Script::Sundanese, Script::Sundanese, Script::Sundanese,
+Script::Sundanese, Script::Sundanese, Script::Sundanese, Script::Sundanese,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Common,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Common, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Inherited, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Inherited, Script::Common, Script::Common, Script::Common,
+Script::Inherited, Script::Inherited, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Cyrillic, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Cyrillic, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Greek,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Unassigned, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Unassigned, Script::Unassigned, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Unassigned, Script::Unassigned, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Unassigned, Script::Greek, Script::Unassigned,
+Script::Greek, Script::Unassigned, Script::Greek, Script::Unassigned,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Unassigned, Script::Unassigned, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Unassigned, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Unassigned,
+Script::Unassigned, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Unassigned, Script::Greek, Script::Greek,
+Script::Greek, Script::Unassigned, Script::Unassigned, Script::Greek,
+Script::Greek, Script::Greek, Script::Unassigned, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Inherited, Script::Inherited, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Latin,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Latin,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Greek,
+Script::Common, Script::Common, Script::Common, Script::Latin, Script::Latin,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Latin, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Latin,
+Script::Common, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Braille, Script::Braille, Script::Braille,
+Script::Braille, Script::Braille, Script::Braille, Script::Braille,
+Script::Braille, Script::Braille, Script::Braille, Script::Braille,
+Script::Braille, Script::Braille, Script::Braille, Script::Braille,
+Script::Braille, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Unassigned, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Coptic,
+Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic, Script::Coptic,
+Script::Coptic, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Tifinagh, Script::Tifinagh, Script::Tifinagh,
+Script::Tifinagh, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tifinagh, Script::Tifinagh, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tifinagh, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Unassigned,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Han, Script::Common,
+Script::Han, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Hangul, Script::Hangul,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Unassigned, Script::Unassigned, Script::Inherited, Script::Inherited,
+Script::Common, Script::Common, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Common, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Common, Script::Common, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Bopomofo, Script::Bopomofo, Script::Bopomofo,
+Script::Bopomofo, Script::Unassigned, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Common, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Common, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Yi, Script::Yi, Script::Yi,
+Script::Yi, Script::Yi, Script::Yi, Script::Yi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu,
+Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu,
+Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu, Script::Lisu,
+Script::Lisu, Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai,
+Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai,
+Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai,
+Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai,
+Script::Vai, Script::Vai, Script::Vai, Script::Vai, Script::Vai,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Common, Script::Common,
+Script::Common, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Unassigned, Script::Unassigned, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Syloti_Nagri, Script::Syloti_Nagri, Script::Syloti_Nagri,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa, Script::Phags_Pa,
+Script::Phags_Pa, Script::Phags_Pa, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Saurashtra, Script::Saurashtra, Script::Saurashtra, Script::Saurashtra,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li, Script::Kayah_Li,
+Script::Common, Script::Kayah_Li, Script::Rejang, Script::Rejang,
+Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang,
+Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang,
+Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang, Script::Rejang,
+Script::Rejang, Script::Rejang, Script::Rejang, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Rejang, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Unassigned,
+Script::Common, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Javanese,
+Script::Javanese, Script::Javanese, Script::Javanese, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Javanese,
+Script::Javanese, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Myanmar, Script::Myanmar, Script::Myanmar, Script::Myanmar,
+Script::Unassigned, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Unassigned,
+Script::Unassigned, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Cham, Script::Cham,
+Script::Cham, Script::Unassigned, Script::Unassigned, Script::Cham,
+Script::Cham, Script::Cham, Script::Cham, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tai_Viet, Script::Tai_Viet, Script::Tai_Viet,
+Script::Tai_Viet, Script::Tai_Viet, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Unassigned, Script::Ethiopic, Script::Ethiopic,
+Script::Ethiopic, Script::Ethiopic, Script::Ethiopic, Script::Ethiopic,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Common, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Greek, Script::Latin, Script::Latin,
+Script::Latin, Script::Latin, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Unassigned,
+Script::Unassigned, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Meetei_Mayek,
+Script::Meetei_Mayek, Script::Meetei_Mayek, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Unassigned, Script::Unassigned, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Latin,
+Script::Latin, Script::Latin, Script::Latin, Script::Latin, Script::Latin,
+Script::Latin, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Armenian, Script::Armenian, Script::Armenian,
+Script::Armenian, Script::Armenian, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Unassigned, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Unassigned, Script::Hebrew,
+Script::Unassigned, Script::Hebrew, Script::Hebrew, Script::Unassigned,
+Script::Hebrew, Script::Hebrew, Script::Unassigned, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew,
+Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Hebrew, Script::Arabic,
+Script::Arabic, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Unassigned, Script::Unassigned, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Cyrillic, Script::Cyrillic, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Common, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Unassigned, Script::Unassigned, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Unassigned, Script::Unassigned, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Hangul, Script::Hangul, Script::Hangul,
+Script::Unassigned, Script::Unassigned, Script::Hangul, Script::Hangul,
+Script::Hangul, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Unassigned, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Unassigned, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Unassigned, Script::Linear_B, Script::Linear_B,
+Script::Unassigned, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Unassigned, Script::Unassigned, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Linear_B, Script::Linear_B, Script::Linear_B,
+Script::Linear_B, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Greek, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Inherited, Script::Unassigned, Script::Unassigned, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian, Script::Lycian,
+Script::Lycian, Script::Lycian, Script::Lycian, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Carian, Script::Carian,
+Script::Carian, Script::Carian, Script::Carian, Script::Carian, Script::Carian,
+Script::Carian, Script::Carian, Script::Carian, Script::Carian, Script::Carian,
+Script::Carian, Script::Carian, Script::Carian, Script::Carian, Script::Carian,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Inherited,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Old_Italic, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Old_Italic, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Old_Italic, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Old_Italic, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Old_Italic, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Old_Italic, Script::Old_Italic, Script::Old_Italic,
+Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic,
+Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic,
+Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic,
+Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic,
+Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic, Script::Gothic,
+Script::Gothic, Script::Gothic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Old_Permic, Script::Old_Permic,
+Script::Old_Permic, Script::Old_Permic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Ugaritic, Script::Ugaritic, Script::Ugaritic,
+Script::Ugaritic, Script::Unassigned, Script::Ugaritic, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Old_Persian, Script::Old_Persian, Script::Old_Persian,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Deseret, Script::Deseret,
+Script::Deseret, Script::Deseret, Script::Deseret, Script::Deseret,
+Script::Deseret, Script::Deseret, Script::Deseret, Script::Deseret,
+Script::Deseret, Script::Deseret, Script::Deseret, Script::Deseret,
+Script::Deseret, Script::Deseret, Script::Shavian, Script::Shavian,
+Script::Shavian, Script::Shavian, Script::Shavian, Script::Shavian,
+Script::Shavian, Script::Shavian, Script::Shavian, Script::Shavian,
+Script::Shavian, Script::Shavian, Script::Shavian, Script::Shavian,
+Script::Shavian, Script::Shavian, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Unassigned, Script::Unassigned, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Osmanya, Script::Osmanya, Script::Osmanya, Script::Osmanya,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Osage,
+Script::Osage, Script::Osage, Script::Osage, Script::Osage, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Elbasan,
+Script::Elbasan, Script::Elbasan, Script::Elbasan, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian,
+Script::Caucasian_Albanian, Script::Caucasian_Albanian, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Caucasian_Albanian,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Linear_A, Script::Linear_A, Script::Linear_A, Script::Linear_A,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Unassigned, Script::Unassigned,
+Script::Cypriot, Script::Unassigned, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Cypriot, Script::Cypriot,
+Script::Cypriot, Script::Cypriot, Script::Unassigned, Script::Cypriot,
+Script::Cypriot, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Cypriot, Script::Unassigned, Script::Unassigned, Script::Cypriot,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Unassigned, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Imperial_Aramaic,
+Script::Imperial_Aramaic, Script::Imperial_Aramaic, Script::Palmyrene,
+Script::Palmyrene, Script::Palmyrene, Script::Palmyrene, Script::Palmyrene,
+Script::Palmyrene, Script::Palmyrene, Script::Palmyrene, Script::Palmyrene,
+Script::Palmyrene, Script::Palmyrene, Script::Palmyrene, Script::Palmyrene,
+Script::Palmyrene, Script::Palmyrene, Script::Palmyrene, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Nabataean,
+Script::Nabataean, Script::Nabataean, Script::Nabataean, Script::Hatran,
+Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran,
+Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran,
+Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran,
+Script::Hatran, Script::Hatran, Script::Hatran, Script::Unassigned,
+Script::Hatran, Script::Hatran, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Hatran,
+Script::Hatran, Script::Hatran, Script::Hatran, Script::Hatran,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Phoenician, Script::Phoenician, Script::Phoenician, Script::Phoenician,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Phoenician,
+Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian,
+Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian,
+Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian,
+Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian,
+Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian, Script::Lydian,
+Script::Lydian, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Lydian,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Hieroglyphs, Script::Meroitic_Hieroglyphs,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Unassigned, Script::Unassigned,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Meroitic_Cursive,
+Script::Meroitic_Cursive, Script::Meroitic_Cursive, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Unassigned,
+Script::Kharoshthi, Script::Kharoshthi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Unassigned,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Unassigned,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Unassigned, Script::Unassigned, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi, Script::Kharoshthi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Old_South_Arabian, Script::Old_South_Arabian, Script::Old_South_Arabian,
+Script::Old_South_Arabian, Script::Old_South_Arabian, Script::Old_South_Arabian,
+Script::Old_South_Arabian, Script::Old_South_Arabian, Script::Old_South_Arabian,
+Script::Old_South_Arabian, Script::Old_South_Arabian, Script::Old_South_Arabian,
+Script::Old_South_Arabian, Script::Old_South_Arabian, Script::Old_South_Arabian,
+Script::Old_South_Arabian, Script::Old_North_Arabian, Script::Old_North_Arabian,
+Script::Old_North_Arabian, Script::Old_North_Arabian, Script::Old_North_Arabian,
+Script::Old_North_Arabian, Script::Old_North_Arabian, Script::Old_North_Arabian,
+Script::Old_North_Arabian, Script::Old_North_Arabian, Script::Old_North_Arabian,
+Script::Old_North_Arabian, Script::Old_North_Arabian, Script::Old_North_Arabian,
+Script::Old_North_Arabian, Script::Old_North_Arabian, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Manichaean, Script::Manichaean,
+Script::Manichaean, Script::Manichaean, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Avestan, Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Avestan, Script::Avestan, Script::Avestan,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Unassigned, Script::Unassigned, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Parthian,
+Script::Inscriptional_Parthian, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Inscriptional_Pahlavi,
+Script::Inscriptional_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Psalter_Pahlavi, Script::Psalter_Pahlavi,
+Script::Psalter_Pahlavi, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic,
+Script::Old_Turkic, Script::Old_Turkic, Script::Old_Turkic, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Old_Hungarian, Script::Old_Hungarian,
+Script::Old_Hungarian, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Hanifi_Rohingya, Script::Hanifi_Rohingya, Script::Hanifi_Rohingya,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Unassigned, Script::Yezidi, Script::Yezidi,
+Script::Yezidi, Script::Unassigned, Script::Unassigned, Script::Yezidi,
+Script::Yezidi, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Old_Sogdian,
+Script::Old_Sogdian, Script::Old_Sogdian, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Sogdian, Script::Sogdian, Script::Sogdian,
+Script::Sogdian, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Chorasmian,
+Script::Chorasmian, Script::Chorasmian, Script::Chorasmian, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Elymaic, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Elymaic, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Elymaic, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Elymaic, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Elymaic, Script::Elymaic,
+Script::Elymaic, Script::Elymaic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Brahmi, Script::Brahmi, Script::Brahmi, Script::Brahmi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Brahmi,
+Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi,
+Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi,
+Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Kaithi,
+Script::Kaithi, Script::Kaithi, Script::Kaithi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Kaithi, Script::Unassigned,
+Script::Unassigned, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Sora_Sompeng, Script::Sora_Sompeng, Script::Sora_Sompeng,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Unassigned, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma, Script::Chakma,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Mahajani,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Mahajani,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Mahajani,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Mahajani,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Mahajani,
+Script::Mahajani, Script::Mahajani, Script::Mahajani, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Sharada, Script::Sharada, Script::Sharada, Script::Sharada,
+Script::Sharada, Script::Sharada, Script::Sharada, Script::Sharada,
+Script::Sharada, Script::Sharada, Script::Sharada, Script::Sharada,
+Script::Sharada, Script::Sharada, Script::Sharada, Script::Sharada,
+Script::Unassigned, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Sinhala, Script::Sinhala, Script::Sinhala,
+Script::Sinhala, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Unassigned,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki, Script::Khojki,
+Script::Khojki, Script::Khojki, Script::Khojki, Script::Unassigned,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Unassigned,
+Script::Multani, Script::Unassigned, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Unassigned, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Unassigned, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Multani, Script::Multani,
+Script::Multani, Script::Multani, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Khudawadi, Script::Khudawadi,
+Script::Khudawadi, Script::Khudawadi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Unassigned, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Grantha, Script::Grantha,
+Script::Unassigned, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Unassigned, Script::Inherited,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Unassigned, Script::Unassigned,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Grantha,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Unassigned, Script::Unassigned, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Grantha, Script::Grantha, Script::Grantha, Script::Grantha,
+Script::Grantha, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Unassigned, Script::Newa,
+Script::Newa, Script::Newa, Script::Newa, Script::Newa, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Tirhuta,
+Script::Tirhuta, Script::Tirhuta, Script::Tirhuta, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Unassigned,
+Script::Unassigned, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Siddham,
+Script::Siddham, Script::Siddham, Script::Siddham, Script::Unassigned,
+Script::Unassigned, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Modi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Modi, Script::Modi, Script::Modi, Script::Modi,
+Script::Modi, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Mongolian, Script::Mongolian, Script::Mongolian, Script::Mongolian,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Takri, Script::Takri,
+Script::Takri, Script::Takri, Script::Takri, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Unassigned,
+Script::Unassigned, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom, Script::Ahom,
+Script::Ahom, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra,
+Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra,
+Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra,
+Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra,
+Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra,
+Script::Dogra, Script::Dogra, Script::Dogra, Script::Dogra, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Warang_Citi, Script::Warang_Citi, Script::Warang_Citi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Warang_Citi, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Unassigned,
+Script::Unassigned, Script::Dives_Akuru, Script::Unassigned, Script::Unassigned,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Unassigned,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Unassigned,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Unassigned, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Unassigned, Script::Unassigned, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Dives_Akuru, Script::Dives_Akuru,
+Script::Dives_Akuru, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Unassigned, Script::Unassigned,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Nandinagari, Script::Nandinagari, Script::Nandinagari,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Zanabazar_Square, Script::Zanabazar_Square, Script::Zanabazar_Square,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Soyombo, Script::Soyombo, Script::Soyombo, Script::Soyombo,
+Script::Soyombo, Script::Soyombo, Script::Soyombo, Script::Soyombo,
+Script::Soyombo, Script::Soyombo, Script::Soyombo, Script::Soyombo,
+Script::Soyombo, Script::Soyombo, Script::Soyombo, Script::Soyombo,
+Script::Soyombo, Script::Soyombo, Script::Soyombo, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Pau_Cin_Hau, Script::Pau_Cin_Hau,
+Script::Pau_Cin_Hau, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Unassigned, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Unassigned,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki, Script::Bhaiksuki,
+Script::Bhaiksuki, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Unassigned, Script::Unassigned, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Unassigned, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Marchen,
+Script::Marchen, Script::Marchen, Script::Marchen, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Unassigned, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Unassigned, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Masaram_Gondi, Script::Unassigned, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Unassigned, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Masaram_Gondi, Script::Masaram_Gondi,
+Script::Masaram_Gondi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Unassigned, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Unassigned, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Unassigned,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Unassigned,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Gunjala_Gondi, Script::Gunjala_Gondi,
+Script::Gunjala_Gondi, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Makasar, Script::Makasar, Script::Makasar,
+Script::Makasar, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Lisu, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil, Script::Tamil,
+Script::Tamil, Script::Tamil, Script::Tamil, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Tamil, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Unassigned, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Cuneiform, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Cuneiform, Script::Cuneiform, Script::Cuneiform,
+Script::Cuneiform, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Unassigned, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs,
+Script::Egyptian_Hieroglyphs, Script::Egyptian_Hieroglyphs, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Anatolian_Hieroglyphs, Script::Anatolian_Hieroglyphs,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum, Script::Bamum,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Unassigned, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro, Script::Mro,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Mro, Script::Mro, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Unassigned, Script::Unassigned, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah, Script::Bassa_Vah,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Unassigned, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Unassigned,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Pahawh_Hmong, Script::Pahawh_Hmong,
+Script::Pahawh_Hmong, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Medefaidrin, Script::Medefaidrin,
+Script::Medefaidrin, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Miao,
+Script::Miao, Script::Miao, Script::Miao, Script::Miao, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Miao, Script::Tangut,
+Script::Nushu, Script::Common, Script::Common, Script::Khitan_Small_Script,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Han,
+Script::Han, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script,
+Script::Khitan_Small_Script, Script::Khitan_Small_Script, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut, Script::Tangut,
+Script::Tangut, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Katakana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Hiragana,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Unassigned,
+Script::Hiragana, Script::Hiragana, Script::Hiragana, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Katakana, Script::Katakana, Script::Katakana, Script::Katakana,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu, Script::Nushu,
+Script::Nushu, Script::Nushu, Script::Nushu, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Duployan,
+Script::Duployan, Script::Unassigned, Script::Unassigned, Script::Duployan,
+Script::Duployan, Script::Duployan, Script::Duployan, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Common, Script::Common, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Inherited, Script::Inherited, Script::Inherited,
+Script::Inherited, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Greek, Script::Greek,
+Script::Greek, Script::Greek, Script::Greek, Script::Greek, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Common, Script::Common, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::Unassigned, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::SignWriting,
+Script::SignWriting, Script::SignWriting, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Unassigned, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Unassigned, Script::Unassigned, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Unassigned, Script::Glagolitic, Script::Glagolitic,
+Script::Unassigned, Script::Glagolitic, Script::Glagolitic, Script::Glagolitic,
+Script::Glagolitic, Script::Glagolitic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Unassigned, Script::Unassigned,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Nyiakeng_Puachue_Hmong, Script::Nyiakeng_Puachue_Hmong, Script::Wancho,
+Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho,
+Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho,
+Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho,
+Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho,
+Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho, Script::Wancho,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Wancho, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Unassigned,
+Script::Unassigned, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Mende_Kikakui,
+Script::Mende_Kikakui, Script::Mende_Kikakui, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam,
+Script::Adlam, Script::Adlam, Script::Adlam, Script::Adlam, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Adlam,
+Script::Adlam, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Unassigned, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Unassigned, Script::Arabic,
+Script::Unassigned, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Arabic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Unassigned, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Unassigned, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Unassigned,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Unassigned, Script::Arabic, Script::Arabic, Script::Arabic,
+Script::Arabic, Script::Arabic, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Hiragana, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Common, Script::Common, Script::Common, Script::Common, Script::Common,
+Script::Common, Script::Common, Script::Common, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Common, Script::Common,
+Script::Common, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Han, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Han, Script::Han, Script::Han, Script::Han, Script::Han,
+Script::Han, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Common,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned, Script::Unassigned, Script::Unassigned,
+Script::Unassigned, Script::Unassigned,
+};
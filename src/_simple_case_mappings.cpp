@@ -1,2801 +1,255 @@
-const std::unordered_map<char32_t, const char32_t*> _simple_case_mappings = {
-{ 0x00000041, U"\U00000041\U00000061\U00000041" },
-{ 0x00000042, U"\U00000042\U00000062\U00000042" },
-{ 0x00000043, U"\U00000043\U00000063\U00000043" },
-{ 0x00000044, U"\U00000044\U00000064\U00000044" },
-{ 0x00000045, U"\U00000045\U00000065\U00000045" },
-{ 0x00000046, U"\U00000046\U00000066\U00000046" },
-{ 0x00000047, U"\U00000047\U00000067\U00000047" },
-{ 0x00000048, U"\U00000048\U00000068\U00000048" },
-{ 0x00000049, U"\U00000049\U00000069\U00000049" },
-{ 0x0000004A, U"\U0000004A\U0000006A\U0000004A" },
-{ 0x0000004B, U"\U0000004B\U0000006B\U0000004B" },
-{ 0x0000004C, U"\U0000004C\U0000006C\U0000004C" },
-{ 0x0000004D, U"\U0000004D\U0000006D\U0000004D" },
-{ 0x0000004E, U"\U0000004E\U0000006E\U0000004E" },
-{ 0x0000004F, U"\U0000004F\U0000006F\U0000004F" },
-{ 0x00000050, U"\U00000050\U00000070\U00000050" },
-{ 0x00000051, U"\U00000051\U00000071\U00000051" },
-{ 0x00000052, U"\U00000052\U00000072\U00000052" },
-{ 0x00000053, U"\U00000053\U00000073\U00000053" },
-{ 0x00000054, U"\U00000054\U00000074\U00000054" },
-{ 0x00000055, U"\U00000055\U00000075\U00000055" },
-{ 0x00000056, U"\U00000056\U00000076\U00000056" },
-{ 0x00000057, U"\U00000057\U00000077\U00000057" },
-{ 0x00000058, U"\U00000058\U00000078\U00000058" },
-{ 0x00000059, U"\U00000059\U00000079\U00000059" },
-{ 0x0000005A, U"\U0000005A\U0000007A\U0000005A" },
-{ 0x00000061, U"\U00000041\U00000061\U00000041" },
-{ 0x00000062, U"\U00000042\U00000062\U00000042" },
-{ 0x00000063, U"\U00000043\U00000063\U00000043" },
-{ 0x00000064, U"\U00000044\U00000064\U00000044" },
-{ 0x00000065, U"\U00000045\U00000065\U00000045" },
-{ 0x00000066, U"\U00000046\U00000066\U00000046" },
-{ 0x00000067, U"\U00000047\U00000067\U00000047" },
-{ 0x00000068, U"\U00000048\U00000068\U00000048" },
-{ 0x00000069, U"\U00000049\U00000069\U00000049" },
-{ 0x0000006A, U"\U0000004A\U0000006A\U0000004A" },
-{ 0x0000006B, U"\U0000004B\U0000006B\U0000004B" },
-{ 0x0000006C, U"\U0000004C\U0000006C\U0000004C" },
-{ 0x0000006D, U"\U0000004D\U0000006D\U0000004D" },
-{ 0x0000006E, U"\U0000004E\U0000006E\U0000004E" },
-{ 0x0000006F, U"\U0000004F\U0000006F\U0000004F" },
-{ 0x00000070, U"\U00000050\U00000070\U00000050" },
-{ 0x00000071, U"\U00000051\U00000071\U00000051" },
-{ 0x00000072, U"\U00000052\U00000072\U00000052" },
-{ 0x00000073, U"\U00000053\U00000073\U00000053" },
-{ 0x00000074, U"\U00000054\U00000074\U00000054" },
-{ 0x00000075, U"\U00000055\U00000075\U00000055" },
-{ 0x00000076, U"\U00000056\U00000076\U00000056" },
-{ 0x00000077, U"\U00000057\U00000077\U00000057" },
-{ 0x00000078, U"\U00000058\U00000078\U00000058" },
-{ 0x00000079, U"\U00000059\U00000079\U00000059" },
-{ 0x0000007A, U"\U0000005A\U0000007A\U0000005A" },
-{ 0x000000B5, U"\U0000039C\U000000B5\U0000039C" },
-{ 0x000000C0, U"\U000000C0\U000000E0\U000000C0" },
-{ 0x000000C1, U"\U000000C1\U000000E1\U000000C1" },
-{ 0x000000C2, U"\U000000C2\U000000E2\U000000C2" },
-{ 0x000000C3, U"\U000000C3\U000000E3\U000000C3" },
-{ 0x000000C4, U"\U000000C4\U000000E4\U000000C4" },
-{ 0x000000C5, U"\U000000C5\U000000E5\U000000C5" },
-{ 0x000000C6, U"\U000000C6\U000000E6\U000000C6" },
-{ 0x000000C7, U"\U000000C7\U000000E7\U000000C7" },
-{ 0x000000C8, U"\U000000C8\U000000E8\U000000C8" },
-{ 0x000000C9, U"\U000000C9\U000000E9\U000000C9" },
-{ 0x000000CA, U"\U000000CA\U000000EA\U000000CA" },
-{ 0x000000CB, U"\U000000CB\U000000EB\U000000CB" },
-{ 0x000000CC, U"\U000000CC\U000000EC\U000000CC" },
-{ 0x000000CD, U"\U000000CD\U000000ED\U000000CD" },
-{ 0x000000CE, U"\U000000CE\U000000EE\U000000CE" },
-{ 0x000000CF, U"\U000000CF\U000000EF\U000000CF" },
-{ 0x000000D0, U"\U000000D0\U000000F0\U000000D0" },
-{ 0x000000D1, U"\U000000D1\U000000F1\U000000D1" },
-{ 0x000000D2, U"\U000000D2\U000000F2\U000000D2" },
-{ 0x000000D3, U"\U000000D3\U000000F3\U000000D3" },
-{ 0x000000D4, U"\U000000D4\U000000F4\U000000D4" },
-{ 0x000000D5, U"\U000000D5\U000000F5\U000000D5" },
-{ 0x000000D6, U"\U000000D6\U000000F6\U000000D6" },
-{ 0x000000D8, U"\U000000D8\U000000F8\U000000D8" },
-{ 0x000000D9, U"\U000000D9\U000000F9\U000000D9" },
-{ 0x000000DA, U"\U000000DA\U000000FA\U000000DA" },
-{ 0x000000DB, U"\U000000DB\U000000FB\U000000DB" },
-{ 0x000000DC, U"\U000000DC\U000000FC\U000000DC" },
-{ 0x000000DD, U"\U000000DD\U000000FD\U000000DD" },
-{ 0x000000DE, U"\U000000DE\U000000FE\U000000DE" },
-{ 0x000000E0, U"\U000000C0\U000000E0\U000000C0" },
-{ 0x000000E1, U"\U000000C1\U000000E1\U000000C1" },
-{ 0x000000E2, U"\U000000C2\U000000E2\U000000C2" },
-{ 0x000000E3, U"\U000000C3\U000000E3\U000000C3" },
-{ 0x000000E4, U"\U000000C4\U000000E4\U000000C4" },
-{ 0x000000E5, U"\U000000C5\U000000E5\U000000C5" },
-{ 0x000000E6, U"\U000000C6\U000000E6\U000000C6" },
-{ 0x000000E7, U"\U000000C7\U000000E7\U000000C7" },
-{ 0x000000E8, U"\U000000C8\U000000E8\U000000C8" },
-{ 0x000000E9, U"\U000000C9\U000000E9\U000000C9" },
-{ 0x000000EA, U"\U000000CA\U000000EA\U000000CA" },
-{ 0x000000EB, U"\U000000CB\U000000EB\U000000CB" },
-{ 0x000000EC, U"\U000000CC\U000000EC\U000000CC" },
-{ 0x000000ED, U"\U000000CD\U000000ED\U000000CD" },
-{ 0x000000EE, U"\U000000CE\U000000EE\U000000CE" },
-{ 0x000000EF, U"\U000000CF\U000000EF\U000000CF" },
-{ 0x000000F0, U"\U000000D0\U000000F0\U000000D0" },
-{ 0x000000F1, U"\U000000D1\U000000F1\U000000D1" },
-{ 0x000000F2, U"\U000000D2\U000000F2\U000000D2" },
-{ 0x000000F3, U"\U000000D3\U000000F3\U000000D3" },
-{ 0x000000F4, U"\U000000D4\U000000F4\U000000D4" },
-{ 0x000000F5, U"\U000000D5\U000000F5\U000000D5" },
-{ 0x000000F6, U"\U000000D6\U000000F6\U000000D6" },
-{ 0x000000F8, U"\U000000D8\U000000F8\U000000D8" },
-{ 0x000000F9, U"\U000000D9\U000000F9\U000000D9" },
-{ 0x000000FA, U"\U000000DA\U000000FA\U000000DA" },
-{ 0x000000FB, U"\U000000DB\U000000FB\U000000DB" },
-{ 0x000000FC, U"\U000000DC\U000000FC\U000000DC" },
-{ 0x000000FD, U"\U000000DD\U000000FD\U000000DD" },
-{ 0x000000FE, U"\U000000DE\U000000FE\U000000DE" },
-{ 0x000000FF, U"\U00000178\U000000FF\U00000178" },
-{ 0x00000100, U"\U00000100\U00000101\U00000100" },
-{ 0x00000101, U"\U00000100\U00000101\U00000100" },
-{ 0x00000102, U"\U00000102\U00000103\U00000102" },
-{ 0x00000103, U"\U00000102\U00000103\U00000102" },
-{ 0x00000104, U"\U00000104\U00000105\U00000104" },
-{ 0x00000105, U"\U00000104\U00000105\U00000104" },
-{ 0x00000106, U"\U00000106\U00000107\U00000106" },
-{ 0x00000107, U"\U00000106\U00000107\U00000106" },
-{ 0x00000108, U"\U00000108\U00000109\U00000108" },
-{ 0x00000109, U"\U00000108\U00000109\U00000108" },
-{ 0x0000010A, U"\U0000010A\U0000010B\U0000010A" },
-{ 0x0000010B, U"\U0000010A\U0000010B\U0000010A" },
-{ 0x0000010C, U"\U0000010C\U0000010D\U0000010C" },
-{ 0x0000010D, U"\U0000010C\U0000010D\U0000010C" },
-{ 0x0000010E, U"\U0000010E\U0000010F\U0000010E" },
-{ 0x0000010F, U"\U0000010E\U0000010F\U0000010E" },
-{ 0x00000110, U"\U00000110\U00000111\U00000110" },
-{ 0x00000111, U"\U00000110\U00000111\U00000110" },
-{ 0x00000112, U"\U00000112\U00000113\U00000112" },
-{ 0x00000113, U"\U00000112\U00000113\U00000112" },
-{ 0x00000114, U"\U00000114\U00000115\U00000114" },
-{ 0x00000115, U"\U00000114\U00000115\U00000114" },
-{ 0x00000116, U"\U00000116\U00000117\U00000116" },
-{ 0x00000117, U"\U00000116\U00000117\U00000116" },
-{ 0x00000118, U"\U00000118\U00000119\U00000118" },
-{ 0x00000119, U"\U00000118\U00000119\U00000118" },
-{ 0x0000011A, U"\U0000011A\U0000011B\U0000011A" },
-{ 0x0000011B, U"\U0000011A\U0000011B\U0000011A" },
-{ 0x0000011C, U"\U0000011C\U0000011D\U0000011C" },
-{ 0x0000011D, U"\U0000011C\U0000011D\U0000011C" },
-{ 0x0000011E, U"\U0000011E\U0000011F\U0000011E" },
-{ 0x0000011F, U"\U0000011E\U0000011F\U0000011E" },
-{ 0x00000120, U"\U00000120\U00000121\U00000120" },
-{ 0x00000121, U"\U00000120\U00000121\U00000120" },
-{ 0x00000122, U"\U00000122\U00000123\U00000122" },
-{ 0x00000123, U"\U00000122\U00000123\U00000122" },
-{ 0x00000124, U"\U00000124\U00000125\U00000124" },
-{ 0x00000125, U"\U00000124\U00000125\U00000124" },
-{ 0x00000126, U"\U00000126\U00000127\U00000126" },
-{ 0x00000127, U"\U00000126\U00000127\U00000126" },
-{ 0x00000128, U"\U00000128\U00000129\U00000128" },
-{ 0x00000129, U"\U00000128\U00000129\U00000128" },
-{ 0x0000012A, U"\U0000012A\U0000012B\U0000012A" },
-{ 0x0000012B, U"\U0000012A\U0000012B\U0000012A" },
-{ 0x0000012C, U"\U0000012C\U0000012D\U0000012C" },
-{ 0x0000012D, U"\U0000012C\U0000012D\U0000012C" },
-{ 0x0000012E, U"\U0000012E\U0000012F\U0000012E" },
-{ 0x0000012F, U"\U0000012E\U0000012F\U0000012E" },
-{ 0x00000130, U"\U00000130\U00000069\U00000130" },
-{ 0x00000131, U"\U00000049\U00000131\U00000049" },
-{ 0x00000132, U"\U00000132\U00000133\U00000132" },
-{ 0x00000133, U"\U00000132\U00000133\U00000132" },
-{ 0x00000134, U"\U00000134\U00000135\U00000134" },
-{ 0x00000135, U"\U00000134\U00000135\U00000134" },
-{ 0x00000136, U"\U00000136\U00000137\U00000136" },
-{ 0x00000137, U"\U00000136\U00000137\U00000136" },
-{ 0x00000139, U"\U00000139\U0000013A\U00000139" },
-{ 0x0000013A, U"\U00000139\U0000013A\U00000139" },
-{ 0x0000013B, U"\U0000013B\U0000013C\U0000013B" },
-{ 0x0000013C, U"\U0000013B\U0000013C\U0000013B" },
-{ 0x0000013D, U"\U0000013D\U0000013E\U0000013D" },
-{ 0x0000013E, U"\U0000013D\U0000013E\U0000013D" },
-{ 0x0000013F, U"\U0000013F\U00000140\U0000013F" },
-{ 0x00000140, U"\U0000013F\U00000140\U0000013F" },
-{ 0x00000141, U"\U00000141\U00000142\U00000141" },
-{ 0x00000142, U"\U00000141\U00000142\U00000141" },
-{ 0x00000143, U"\U00000143\U00000144\U00000143" },
-{ 0x00000144, U"\U00000143\U00000144\U00000143" },
-{ 0x00000145, U"\U00000145\U00000146\U00000145" },
-{ 0x00000146, U"\U00000145\U00000146\U00000145" },
-{ 0x00000147, U"\U00000147\U00000148\U00000147" },
-{ 0x00000148, U"\U00000147\U00000148\U00000147" },
-{ 0x0000014A, U"\U0000014A\U0000014B\U0000014A" },
-{ 0x0000014B, U"\U0000014A\U0000014B\U0000014A" },
-{ 0x0000014C, U"\U0000014C\U0000014D\U0000014C" },
-{ 0x0000014D, U"\U0000014C\U0000014D\U0000014C" },
-{ 0x0000014E, U"\U0000014E\U0000014F\U0000014E" },
-{ 0x0000014F, U"\U0000014E\U0000014F\U0000014E" },
-{ 0x00000150, U"\U00000150\U00000151\U00000150" },
-{ 0x00000151, U"\U00000150\U00000151\U00000150" },
-{ 0x00000152, U"\U00000152\U00000153\U00000152" },
-{ 0x00000153, U"\U00000152\U00000153\U00000152" },
-{ 0x00000154, U"\U00000154\U00000155\U00000154" },
-{ 0x00000155, U"\U00000154\U00000155\U00000154" },
-{ 0x00000156, U"\U00000156\U00000157\U00000156" },
-{ 0x00000157, U"\U00000156\U00000157\U00000156" },
-{ 0x00000158, U"\U00000158\U00000159\U00000158" },
-{ 0x00000159, U"\U00000158\U00000159\U00000158" },
-{ 0x0000015A, U"\U0000015A\U0000015B\U0000015A" },
-{ 0x0000015B, U"\U0000015A\U0000015B\U0000015A" },
-{ 0x0000015C, U"\U0000015C\U0000015D\U0000015C" },
-{ 0x0000015D, U"\U0000015C\U0000015D\U0000015C" },
-{ 0x0000015E, U"\U0000015E\U0000015F\U0000015E" },
-{ 0x0000015F, U"\U0000015E\U0000015F\U0000015E" },
-{ 0x00000160, U"\U00000160\U00000161\U00000160" },
-{ 0x00000161, U"\U00000160\U00000161\U00000160" },
-{ 0x00000162, U"\U00000162\U00000163\U00000162" },
-{ 0x00000163, U"\U00000162\U00000163\U00000162" },
-{ 0x00000164, U"\U00000164\U00000165\U00000164" },
-{ 0x00000165, U"\U00000164\U00000165\U00000164" },
-{ 0x00000166, U"\U00000166\U00000167\U00000166" },
-{ 0x00000167, U"\U00000166\U00000167\U00000166" },
-{ 0x00000168, U"\U00000168\U00000169\U00000168" },
-{ 0x00000169, U"\U00000168\U00000169\U00000168" },
-{ 0x0000016A, U"\U0000016A\U0000016B\U0000016A" },
-{ 0x0000016B, U"\U0000016A\U0000016B\U0000016A" },
-{ 0x0000016C, U"\U0000016C\U0000016D\U0000016C" },
-{ 0x0000016D, U"\U0000016C\U0000016D\U0000016C" },
-{ 0x0000016E, U"\U0000016E\U0000016F\U0000016E" },
-{ 0x0000016F, U"\U0000016E\U0000016F\U0000016E" },
-{ 0x00000170, U"\U00000170\U00000171\U00000170" },
-{ 0x00000171, U"\U00000170\U00000171\U00000170" },
-{ 0x00000172, U"\U00000172\U00000173\U00000172" },
-{ 0x00000173, U"\U00000172\U00000173\U00000172" },
-{ 0x00000174, U"\U00000174\U00000175\U00000174" },
-{ 0x00000175, U"\U00000174\U00000175\U00000174" },
-{ 0x00000176, U"\U00000176\U00000177\U00000176" },
-{ 0x00000177, U"\U00000176\U00000177\U00000176" },
-{ 0x00000178, U"\U00000178\U000000FF\U00000178" },
-{ 0x00000179, U"\U00000179\U0000017A\U00000179" },
-{ 0x0000017A, U"\U00000179\U0000017A\U00000179" },
-{ 0x0000017B, U"\U0000017B\U0000017C\U0000017B" },
-{ 0x0000017C, U"\U0000017B\U0000017C\U0000017B" },
-{ 0x0000017D, U"\U0000017D\U0000017E\U0000017D" },
-{ 0x0000017E, U"\U0000017D\U0000017E\U0000017D" },
-{ 0x0000017F, U"\U00000053\U0000017F\U00000053" },
-{ 0x00000180, U"\U00000243\U00000180\U00000243" },
-{ 0x00000181, U"\U00000181\U00000253\U00000181" },
-{ 0x00000182, U"\U00000182\U00000183\U00000182" },
-{ 0x00000183, U"\U00000182\U00000183\U00000182" },
-{ 0x00000184, U"\U00000184\U00000185\U00000184" },
-{ 0x00000185, U"\U00000184\U00000185\U00000184" },
-{ 0x00000186, U"\U00000186\U00000254\U00000186" },
-{ 0x00000187, U"\U00000187\U00000188\U00000187" },
-{ 0x00000188, U"\U00000187\U00000188\U00000187" },
-{ 0x00000189, U"\U00000189\U00000256\U00000189" },
-{ 0x0000018A, U"\U0000018A\U00000257\U0000018A" },
-{ 0x0000018B, U"\U0000018B\U0000018C\U0000018B" },
-{ 0x0000018C, U"\U0000018B\U0000018C\U0000018B" },
-{ 0x0000018E, U"\U0000018E\U000001DD\U0000018E" },
-{ 0x0000018F, U"\U0000018F\U00000259\U0000018F" },
-{ 0x00000190, U"\U00000190\U0000025B\U00000190" },
-{ 0x00000191, U"\U00000191\U00000192\U00000191" },
-{ 0x00000192, U"\U00000191\U00000192\U00000191" },
-{ 0x00000193, U"\U00000193\U00000260\U00000193" },
-{ 0x00000194, U"\U00000194\U00000263\U00000194" },
-{ 0x00000195, U"\U000001F6\U00000195\U000001F6" },
-{ 0x00000196, U"\U00000196\U00000269\U00000196" },
-{ 0x00000197, U"\U00000197\U00000268\U00000197" },
-{ 0x00000198, U"\U00000198\U00000199\U00000198" },
-{ 0x00000199, U"\U00000198\U00000199\U00000198" },
-{ 0x0000019A, U"\U0000023D\U0000019A\U0000023D" },
-{ 0x0000019C, U"\U0000019C\U0000026F\U0000019C" },
-{ 0x0000019D, U"\U0000019D\U00000272\U0000019D" },
-{ 0x0000019E, U"\U00000220\U0000019E\U00000220" },
-{ 0x0000019F, U"\U0000019F\U00000275\U0000019F" },
-{ 0x000001A0, U"\U000001A0\U000001A1\U000001A0" },
-{ 0x000001A1, U"\U000001A0\U000001A1\U000001A0" },
-{ 0x000001A2, U"\U000001A2\U000001A3\U000001A2" },
-{ 0x000001A3, U"\U000001A2\U000001A3\U000001A2" },
-{ 0x000001A4, U"\U000001A4\U000001A5\U000001A4" },
-{ 0x000001A5, U"\U000001A4\U000001A5\U000001A4" },
-{ 0x000001A6, U"\U000001A6\U00000280\U000001A6" },
-{ 0x000001A7, U"\U000001A7\U000001A8\U000001A7" },
-{ 0x000001A8, U"\U000001A7\U000001A8\U000001A7" },
-{ 0x000001A9, U"\U000001A9\U00000283\U000001A9" },
-{ 0x000001AC, U"\U000001AC\U000001AD\U000001AC" },
-{ 0x000001AD, U"\U000001AC\U000001AD\U000001AC" },
-{ 0x000001AE, U"\U000001AE\U00000288\U000001AE" },
-{ 0x000001AF, U"\U000001AF\U000001B0\U000001AF" },
-{ 0x000001B0, U"\U000001AF\U000001B0\U000001AF" },
-{ 0x000001B1, U"\U000001B1\U0000028A\U000001B1" },
-{ 0x000001B2, U"\U000001B2\U0000028B\U000001B2" },
-{ 0x000001B3, U"\U000001B3\U000001B4\U000001B3" },
-{ 0x000001B4, U"\U000001B3\U000001B4\U000001B3" },
-{ 0x000001B5, U"\U000001B5\U000001B6\U000001B5" },
-{ 0x000001B6, U"\U000001B5\U000001B6\U000001B5" },
-{ 0x000001B7, U"\U000001B7\U00000292\U000001B7" },
-{ 0x000001B8, U"\U000001B8\U000001B9\U000001B8" },
-{ 0x000001B9, U"\U000001B8\U000001B9\U000001B8" },
-{ 0x000001BC, U"\U000001BC\U000001BD\U000001BC" },
-{ 0x000001BD, U"\U000001BC\U000001BD\U000001BC" },
-{ 0x000001BF, U"\U000001F7\U000001BF\U000001F7" },
-{ 0x000001C4, U"\U000001C4\U000001C6\U000001C5" },
-{ 0x000001C5, U"\U000001C4\U000001C6\U000001C5" },
-{ 0x000001C6, U"\U000001C4\U000001C6\U000001C5" },
-{ 0x000001C7, U"\U000001C7\U000001C9\U000001C8" },
-{ 0x000001C8, U"\U000001C7\U000001C9\U000001C8" },
-{ 0x000001C9, U"\U000001C7\U000001C9\U000001C8" },
-{ 0x000001CA, U"\U000001CA\U000001CC\U000001CB" },
-{ 0x000001CB, U"\U000001CA\U000001CC\U000001CB" },
-{ 0x000001CC, U"\U000001CA\U000001CC\U000001CB" },
-{ 0x000001CD, U"\U000001CD\U000001CE\U000001CD" },
-{ 0x000001CE, U"\U000001CD\U000001CE\U000001CD" },
-{ 0x000001CF, U"\U000001CF\U000001D0\U000001CF" },
-{ 0x000001D0, U"\U000001CF\U000001D0\U000001CF" },
-{ 0x000001D1, U"\U000001D1\U000001D2\U000001D1" },
-{ 0x000001D2, U"\U000001D1\U000001D2\U000001D1" },
-{ 0x000001D3, U"\U000001D3\U000001D4\U000001D3" },
-{ 0x000001D4, U"\U000001D3\U000001D4\U000001D3" },
-{ 0x000001D5, U"\U000001D5\U000001D6\U000001D5" },
-{ 0x000001D6, U"\U000001D5\U000001D6\U000001D5" },
-{ 0x000001D7, U"\U000001D7\U000001D8\U000001D7" },
-{ 0x000001D8, U"\U000001D7\U000001D8\U000001D7" },
-{ 0x000001D9, U"\U000001D9\U000001DA\U000001D9" },
-{ 0x000001DA, U"\U000001D9\U000001DA\U000001D9" },
-{ 0x000001DB, U"\U000001DB\U000001DC\U000001DB" },
-{ 0x000001DC, U"\U000001DB\U000001DC\U000001DB" },
-{ 0x000001DD, U"\U0000018E\U000001DD\U0000018E" },
-{ 0x000001DE, U"\U000001DE\U000001DF\U000001DE" },
-{ 0x000001DF, U"\U000001DE\U000001DF\U000001DE" },
-{ 0x000001E0, U"\U000001E0\U000001E1\U000001E0" },
-{ 0x000001E1, U"\U000001E0\U000001E1\U000001E0" },
-{ 0x000001E2, U"\U000001E2\U000001E3\U000001E2" },
-{ 0x000001E3, U"\U000001E2\U000001E3\U000001E2" },
-{ 0x000001E4, U"\U000001E4\U000001E5\U000001E4" },
-{ 0x000001E5, U"\U000001E4\U000001E5\U000001E4" },
-{ 0x000001E6, U"\U000001E6\U000001E7\U000001E6" },
-{ 0x000001E7, U"\U000001E6\U000001E7\U000001E6" },
-{ 0x000001E8, U"\U000001E8\U000001E9\U000001E8" },
-{ 0x000001E9, U"\U000001E8\U000001E9\U000001E8" },
-{ 0x000001EA, U"\U000001EA\U000001EB\U000001EA" },
-{ 0x000001EB, U"\U000001EA\U000001EB\U000001EA" },
-{ 0x000001EC, U"\U000001EC\U000001ED\U000001EC" },
-{ 0x000001ED, U"\U000001EC\U000001ED\U000001EC" },
-{ 0x000001EE, U"\U000001EE\U000001EF\U000001EE" },
-{ 0x000001EF, U"\U000001EE\U000001EF\U000001EE" },
-{ 0x000001F1, U"\U000001F1\U000001F3\U000001F2" },
-{ 0x000001F2, U"\U000001F1\U000001F3\U000001F2" },
-{ 0x000001F3, U"\U000001F1\U000001F3\U000001F2" },
-{ 0x000001F4, U"\U000001F4\U000001F5\U000001F4" },
-{ 0x000001F5, U"\U000001F4\U000001F5\U000001F4" },
-{ 0x000001F6, U"\U000001F6\U00000195\U000001F6" },
-{ 0x000001F7, U"\U000001F7\U000001BF\U000001F7" },
-{ 0x000001F8, U"\U000001F8\U000001F9\U000001F8" },
-{ 0x000001F9, U"\U000001F8\U000001F9\U000001F8" },
-{ 0x000001FA, U"\U000001FA\U000001FB\U000001FA" },
-{ 0x000001FB, U"\U000001FA\U000001FB\U000001FA" },
-{ 0x000001FC, U"\U000001FC\U000001FD\U000001FC" },
-{ 0x000001FD, U"\U000001FC\U000001FD\U000001FC" },
-{ 0x000001FE, U"\U000001FE\U000001FF\U000001FE" },
-{ 0x000001FF, U"\U000001FE\U000001FF\U000001FE" },
-{ 0x00000200, U"\U00000200\U00000201\U00000200" },
-{ 0x00000201, U"\U00000200\U00000201\U00000200" },
-{ 0x00000202, U"\U00000202\U00000203\U00000202" },
-{ 0x00000203, U"\U00000202\U00000203\U00000202" },
-{ 0x00000204, U"\U00000204\U00000205\U00000204" },
-{ 0x00000205, U"\U00000204\U00000205\U00000204" },
-{ 0x00000206, U"\U00000206\U00000207\U00000206" },
-{ 0x00000207, U"\U00000206\U00000207\U00000206" },
-{ 0x00000208, U"\U00000208\U00000209\U00000208" },
-{ 0x00000209, U"\U00000208\U00000209\U00000208" },
-{ 0x0000020A, U"\U0000020A\U0000020B\U0000020A" },
-{ 0x0000020B, U"\U0000020A\U0000020B\U0000020A" },
-{ 0x0000020C, U"\U0000020C\U0000020D\U0000020C" },
-{ 0x0000020D, U"\U0000020C\U0000020D\U0000020C" },
-{ 0x0000020E, U"\U0000020E\U0000020F\U0000020E" },
-{ 0x0000020F, U"\U0000020E\U0000020F\U0000020E" },
-{ 0x00000210, U"\U00000210\U00000211\U00000210" },
-{ 0x00000211, U"\U00000210\U00000211\U00000210" },
-{ 0x00000212, U"\U00000212\U00000213\U00000212" },
-{ 0x00000213, U"\U00000212\U00000213\U00000212" },
-{ 0x00000214, U"\U00000214\U00000215\U00000214" },
-{ 0x00000215, U"\U00000214\U00000215\U00000214" },
-{ 0x00000216, U"\U00000216\U00000217\U00000216" },
-{ 0x00000217, U"\U00000216\U00000217\U00000216" },
-{ 0x00000218, U"\U00000218\U00000219\U00000218" },
-{ 0x00000219, U"\U00000218\U00000219\U00000218" },
-{ 0x0000021A, U"\U0000021A\U0000021B\U0000021A" },
-{ 0x0000021B, U"\U0000021A\U0000021B\U0000021A" },
-{ 0x0000021C, U"\U0000021C\U0000021D\U0000021C" },
-{ 0x0000021D, U"\U0000021C\U0000021D\U0000021C" },
-{ 0x0000021E, U"\U0000021E\U0000021F\U0000021E" },
-{ 0x0000021F, U"\U0000021E\U0000021F\U0000021E" },
-{ 0x00000220, U"\U00000220\U0000019E\U00000220" },
-{ 0x00000222, U"\U00000222\U00000223\U00000222" },
-{ 0x00000223, U"\U00000222\U00000223\U00000222" },
-{ 0x00000224, U"\U00000224\U00000225\U00000224" },
-{ 0x00000225, U"\U00000224\U00000225\U00000224" },
-{ 0x00000226, U"\U00000226\U00000227\U00000226" },
-{ 0x00000227, U"\U00000226\U00000227\U00000226" },
-{ 0x00000228, U"\U00000228\U00000229\U00000228" },
-{ 0x00000229, U"\U00000228\U00000229\U00000228" },
-{ 0x0000022A, U"\U0000022A\U0000022B\U0000022A" },
-{ 0x0000022B, U"\U0000022A\U0000022B\U0000022A" },
-{ 0x0000022C, U"\U0000022C\U0000022D\U0000022C" },
-{ 0x0000022D, U"\U0000022C\U0000022D\U0000022C" },
-{ 0x0000022E, U"\U0000022E\U0000022F\U0000022E" },
-{ 0x0000022F, U"\U0000022E\U0000022F\U0000022E" },
-{ 0x00000230, U"\U00000230\U00000231\U00000230" },
-{ 0x00000231, U"\U00000230\U00000231\U00000230" },
-{ 0x00000232, U"\U00000232\U00000233\U00000232" },
-{ 0x00000233, U"\U00000232\U00000233\U00000232" },
-{ 0x0000023A, U"\U0000023A\U00002C65\U0000023A" },
-{ 0x0000023B, U"\U0000023B\U0000023C\U0000023B" },
-{ 0x0000023C, U"\U0000023B\U0000023C\U0000023B" },
-{ 0x0000023D, U"\U0000023D\U0000019A\U0000023D" },
-{ 0x0000023E, U"\U0000023E\U00002C66\U0000023E" },
-{ 0x0000023F, U"\U00002C7E\U0000023F\U00002C7E" },
-{ 0x00000240, U"\U00002C7F\U00000240\U00002C7F" },
-{ 0x00000241, U"\U00000241\U00000242\U00000241" },
-{ 0x00000242, U"\U00000241\U00000242\U00000241" },
-{ 0x00000243, U"\U00000243\U00000180\U00000243" },
-{ 0x00000244, U"\U00000244\U00000289\U00000244" },
-{ 0x00000245, U"\U00000245\U0000028C\U00000245" },
-{ 0x00000246, U"\U00000246\U00000247\U00000246" },
-{ 0x00000247, U"\U00000246\U00000247\U00000246" },
-{ 0x00000248, U"\U00000248\U00000249\U00000248" },
-{ 0x00000249, U"\U00000248\U00000249\U00000248" },
-{ 0x0000024A, U"\U0000024A\U0000024B\U0000024A" },
-{ 0x0000024B, U"\U0000024A\U0000024B\U0000024A" },
-{ 0x0000024C, U"\U0000024C\U0000024D\U0000024C" },
-{ 0x0000024D, U"\U0000024C\U0000024D\U0000024C" },
-{ 0x0000024E, U"\U0000024E\U0000024F\U0000024E" },
-{ 0x0000024F, U"\U0000024E\U0000024F\U0000024E" },
-{ 0x00000250, U"\U00002C6F\U00000250\U00002C6F" },
-{ 0x00000251, U"\U00002C6D\U00000251\U00002C6D" },
-{ 0x00000252, U"\U00002C70\U00000252\U00002C70" },
-{ 0x00000253, U"\U00000181\U00000253\U00000181" },
-{ 0x00000254, U"\U00000186\U00000254\U00000186" },
-{ 0x00000256, U"\U00000189\U00000256\U00000189" },
-{ 0x00000257, U"\U0000018A\U00000257\U0000018A" },
-{ 0x00000259, U"\U0000018F\U00000259\U0000018F" },
-{ 0x0000025B, U"\U00000190\U0000025B\U00000190" },
-{ 0x0000025C, U"\U0000A7AB\U0000025C\U0000A7AB" },
-{ 0x00000260, U"\U00000193\U00000260\U00000193" },
-{ 0x00000261, U"\U0000A7AC\U00000261\U0000A7AC" },
-{ 0x00000263, U"\U00000194\U00000263\U00000194" },
-{ 0x00000265, U"\U0000A78D\U00000265\U0000A78D" },
-{ 0x00000266, U"\U0000A7AA\U00000266\U0000A7AA" },
-{ 0x00000268, U"\U00000197\U00000268\U00000197" },
-{ 0x00000269, U"\U00000196\U00000269\U00000196" },
-{ 0x0000026A, U"\U0000A7AE\U0000026A\U0000A7AE" },
-{ 0x0000026B, U"\U00002C62\U0000026B\U00002C62" },
-{ 0x0000026C, U"\U0000A7AD\U0000026C\U0000A7AD" },
-{ 0x0000026F, U"\U0000019C\U0000026F\U0000019C" },
-{ 0x00000271, U"\U00002C6E\U00000271\U00002C6E" },
-{ 0x00000272, U"\U0000019D\U00000272\U0000019D" },
-{ 0x00000275, U"\U0000019F\U00000275\U0000019F" },
-{ 0x0000027D, U"\U00002C64\U0000027D\U00002C64" },
-{ 0x00000280, U"\U000001A6\U00000280\U000001A6" },
-{ 0x00000282, U"\U0000A7C5\U00000282\U0000A7C5" },
-{ 0x00000283, U"\U000001A9\U00000283\U000001A9" },
-{ 0x00000287, U"\U0000A7B1\U00000287\U0000A7B1" },
-{ 0x00000288, U"\U000001AE\U00000288\U000001AE" },
-{ 0x00000289, U"\U00000244\U00000289\U00000244" },
-{ 0x0000028A, U"\U000001B1\U0000028A\U000001B1" },
-{ 0x0000028B, U"\U000001B2\U0000028B\U000001B2" },
-{ 0x0000028C, U"\U00000245\U0000028C\U00000245" },
-{ 0x00000292, U"\U000001B7\U00000292\U000001B7" },
-{ 0x0000029D, U"\U0000A7B2\U0000029D\U0000A7B2" },
-{ 0x0000029E, U"\U0000A7B0\U0000029E\U0000A7B0" },
-{ 0x00000345, U"\U00000399\U00000345\U00000399" },
-{ 0x00000370, U"\U00000370\U00000371\U00000370" },
-{ 0x00000371, U"\U00000370\U00000371\U00000370" },
-{ 0x00000372, U"\U00000372\U00000373\U00000372" },
-{ 0x00000373, U"\U00000372\U00000373\U00000372" },
-{ 0x00000376, U"\U00000376\U00000377\U00000376" },
-{ 0x00000377, U"\U00000376\U00000377\U00000376" },
-{ 0x0000037B, U"\U000003FD\U0000037B\U000003FD" },
-{ 0x0000037C, U"\U000003FE\U0000037C\U000003FE" },
-{ 0x0000037D, U"\U000003FF\U0000037D\U000003FF" },
-{ 0x0000037F, U"\U0000037F\U000003F3\U0000037F" },
-{ 0x00000386, U"\U00000386\U000003AC\U00000386" },
-{ 0x00000388, U"\U00000388\U000003AD\U00000388" },
-{ 0x00000389, U"\U00000389\U000003AE\U00000389" },
-{ 0x0000038A, U"\U0000038A\U000003AF\U0000038A" },
-{ 0x0000038C, U"\U0000038C\U000003CC\U0000038C" },
-{ 0x0000038E, U"\U0000038E\U000003CD\U0000038E" },
-{ 0x0000038F, U"\U0000038F\U000003CE\U0000038F" },
-{ 0x00000391, U"\U00000391\U000003B1\U00000391" },
-{ 0x00000392, U"\U00000392\U000003B2\U00000392" },
-{ 0x00000393, U"\U00000393\U000003B3\U00000393" },
-{ 0x00000394, U"\U00000394\U000003B4\U00000394" },
-{ 0x00000395, U"\U00000395\U000003B5\U00000395" },
-{ 0x00000396, U"\U00000396\U000003B6\U00000396" },
-{ 0x00000397, U"\U00000397\U000003B7\U00000397" },
-{ 0x00000398, U"\U00000398\U000003B8\U00000398" },
-{ 0x00000399, U"\U00000399\U000003B9\U00000399" },
-{ 0x0000039A, U"\U0000039A\U000003BA\U0000039A" },
-{ 0x0000039B, U"\U0000039B\U000003BB\U0000039B" },
-{ 0x0000039C, U"\U0000039C\U000003BC\U0000039C" },
-{ 0x0000039D, U"\U0000039D\U000003BD\U0000039D" },
-{ 0x0000039E, U"\U0000039E\U000003BE\U0000039E" },
-{ 0x0000039F, U"\U0000039F\U000003BF\U0000039F" },
-{ 0x000003A0, U"\U000003A0\U000003C0\U000003A0" },
-{ 0x000003A1, U"\U000003A1\U000003C1\U000003A1" },
-{ 0x000003A3, U"\U000003A3\U000003C3\U000003A3" },
-{ 0x000003A4, U"\U000003A4\U000003C4\U000003A4" },
-{ 0x000003A5, U"\U000003A5\U000003C5\U000003A5" },
-{ 0x000003A6, U"\U000003A6\U000003C6\U000003A6" },
-{ 0x000003A7, U"\U000003A7\U000003C7\U000003A7" },
-{ 0x000003A8, U"\U000003A8\U000003C8\U000003A8" },
-{ 0x000003A9, U"\U000003A9\U000003C9\U000003A9" },
-{ 0x000003AA, U"\U000003AA\U000003CA\U000003AA" },
-{ 0x000003AB, U"\U000003AB\U000003CB\U000003AB" },
-{ 0x000003AC, U"\U00000386\U000003AC\U00000386" },
-{ 0x000003AD, U"\U00000388\U000003AD\U00000388" },
-{ 0x000003AE, U"\U00000389\U000003AE\U00000389" },
-{ 0x000003AF, U"\U0000038A\U000003AF\U0000038A" },
-{ 0x000003B1, U"\U00000391\U000003B1\U00000391" },
-{ 0x000003B2, U"\U00000392\U000003B2\U00000392" },
-{ 0x000003B3, U"\U00000393\U000003B3\U00000393" },
-{ 0x000003B4, U"\U00000394\U000003B4\U00000394" },
-{ 0x000003B5, U"\U00000395\U000003B5\U00000395" },
-{ 0x000003B6, U"\U00000396\U000003B6\U00000396" },
-{ 0x000003B7, U"\U00000397\U000003B7\U00000397" },
-{ 0x000003B8, U"\U00000398\U000003B8\U00000398" },
-{ 0x000003B9, U"\U00000399\U000003B9\U00000399" },
-{ 0x000003BA, U"\U0000039A\U000003BA\U0000039A" },
-{ 0x000003BB, U"\U0000039B\U000003BB\U0000039B" },
-{ 0x000003BC, U"\U0000039C\U000003BC\U0000039C" },
-{ 0x000003BD, U"\U0000039D\U000003BD\U0000039D" },
-{ 0x000003BE, U"\U0000039E\U000003BE\U0000039E" },
-{ 0x000003BF, U"\U0000039F\U000003BF\U0000039F" },
-{ 0x000003C0, U"\U000003A0\U000003C0\U000003A0" },
-{ 0x000003C1, U"\U000003A1\U000003C1\U000003A1" },
-{ 0x000003C2, U"\U000003A3\U000003C2\U000003A3" },
-{ 0x000003C3, U"\U000003A3\U000003C3\U000003A3" },
-{ 0x000003C4, U"\U000003A4\U000003C4\U000003A4" },
-{ 0x000003C5, U"\U000003A5\U000003C5\U000003A5" },
-{ 0x000003C6, U"\U000003A6\U000003C6\U000003A6" },
-{ 0x000003C7, U"\U000003A7\U000003C7\U000003A7" },
-{ 0x000003C8, U"\U000003A8\U000003C8\U000003A8" },
-{ 0x000003C9, U"\U000003A9\U000003C9\U000003A9" },
-{ 0x000003CA, U"\U000003AA\U000003CA\U000003AA" },
-{ 0x000003CB, U"\U000003AB\U000003CB\U000003AB" },
-{ 0x000003CC, U"\U0000038C\U000003CC\U0000038C" },
-{ 0x000003CD, U"\U0000038E\U000003CD\U0000038E" },
-{ 0x000003CE, U"\U0000038F\U000003CE\U0000038F" },
-{ 0x000003CF, U"\U000003CF\U000003D7\U000003CF" },
-{ 0x000003D0, U"\U00000392\U000003D0\U00000392" },
-{ 0x000003D1, U"\U00000398\U000003D1\U00000398" },
-{ 0x000003D5, U"\U000003A6\U000003D5\U000003A6" },
-{ 0x000003D6, U"\U000003A0\U000003D6\U000003A0" },
-{ 0x000003D7, U"\U000003CF\U000003D7\U000003CF" },
-{ 0x000003D8, U"\U000003D8\U000003D9\U000003D8" },
-{ 0x000003D9, U"\U000003D8\U000003D9\U000003D8" },
-{ 0x000003DA, U"\U000003DA\U000003DB\U000003DA" },
-{ 0x000003DB, U"\U000003DA\U000003DB\U000003DA" },
-{ 0x000003DC, U"\U000003DC\U000003DD\U000003DC" },
-{ 0x000003DD, U"\U000003DC\U000003DD\U000003DC" },
-{ 0x000003DE, U"\U000003DE\U000003DF\U000003DE" },
-{ 0x000003DF, U"\U000003DE\U000003DF\U000003DE" },
-{ 0x000003E0, U"\U000003E0\U000003E1\U000003E0" },
-{ 0x000003E1, U"\U000003E0\U000003E1\U000003E0" },
-{ 0x000003E2, U"\U000003E2\U000003E3\U000003E2" },
-{ 0x000003E3, U"\U000003E2\U000003E3\U000003E2" },
-{ 0x000003E4, U"\U000003E4\U000003E5\U000003E4" },
-{ 0x000003E5, U"\U000003E4\U000003E5\U000003E4" },
-{ 0x000003E6, U"\U000003E6\U000003E7\U000003E6" },
-{ 0x000003E7, U"\U000003E6\U000003E7\U000003E6" },
-{ 0x000003E8, U"\U000003E8\U000003E9\U000003E8" },
-{ 0x000003E9, U"\U000003E8\U000003E9\U000003E8" },
-{ 0x000003EA, U"\U000003EA\U000003EB\U000003EA" },
-{ 0x000003EB, U"\U000003EA\U000003EB\U000003EA" },
-{ 0x000003EC, U"\U000003EC\U000003ED\U000003EC" },
-{ 0x000003ED, U"\U000003EC\U000003ED\U000003EC" },
-{ 0x000003EE, U"\U000003EE\U000003EF\U000003EE" },
-{ 0x000003EF, U"\U000003EE\U000003EF\U000003EE" },
-{ 0x000003F0, U"\U0000039A\U000003F0\U0000039A" },
-{ 0x000003F1, U"\U000003A1\U000003F1\U000003A1" },
-{ 0x000003F2, U"\U000003F9\U000003F2\U000003F9" },
-{ 0x000003F3, U"\U0000037F\U000003F3\U0000037F" },
-{ 0x000003F4, U"\U000003F4\U000003B8\U000003F4" },
-{ 0x000003F5, U"\U00000395\U000003F5\U00000395" },
-{ 0x000003F7, U"\U000003F7\U000003F8\U000003F7" },
-{ 0x000003F8, U"\U000003F7\U000003F8\U000003F7" },
-{ 0x000003F9, U"\U000003F9\U000003F2\U000003F9" },
-{ 0x000003FA, U"\U000003FA\U000003FB\U000003FA" },
-{ 0x000003FB, U"\U000003FA\U000003FB\U000003FA" },
-{ 0x000003FD, U"\U000003FD\U0000037B\U000003FD" },
-{ 0x000003FE, U"\U000003FE\U0000037C\U000003FE" },
-{ 0x000003FF, U"\U000003FF\U0000037D\U000003FF" },
-{ 0x00000400, U"\U00000400\U00000450\U00000400" },
-{ 0x00000401, U"\U00000401\U00000451\U00000401" },
-{ 0x00000402, U"\U00000402\U00000452\U00000402" },
-{ 0x00000403, U"\U00000403\U00000453\U00000403" },
-{ 0x00000404, U"\U00000404\U00000454\U00000404" },
-{ 0x00000405, U"\U00000405\U00000455\U00000405" },
-{ 0x00000406, U"\U00000406\U00000456\U00000406" },
-{ 0x00000407, U"\U00000407\U00000457\U00000407" },
-{ 0x00000408, U"\U00000408\U00000458\U00000408" },
-{ 0x00000409, U"\U00000409\U00000459\U00000409" },
-{ 0x0000040A, U"\U0000040A\U0000045A\U0000040A" },
-{ 0x0000040B, U"\U0000040B\U0000045B\U0000040B" },
-{ 0x0000040C, U"\U0000040C\U0000045C\U0000040C" },
-{ 0x0000040D, U"\U0000040D\U0000045D\U0000040D" },
-{ 0x0000040E, U"\U0000040E\U0000045E\U0000040E" },
-{ 0x0000040F, U"\U0000040F\U0000045F\U0000040F" },
-{ 0x00000410, U"\U00000410\U00000430\U00000410" },
-{ 0x00000411, U"\U00000411\U00000431\U00000411" },
-{ 0x00000412, U"\U00000412\U00000432\U00000412" },
-{ 0x00000413, U"\U00000413\U00000433\U00000413" },
-{ 0x00000414, U"\U00000414\U00000434\U00000414" },
-{ 0x00000415, U"\U00000415\U00000435\U00000415" },
-{ 0x00000416, U"\U00000416\U00000436\U00000416" },
-{ 0x00000417, U"\U00000417\U00000437\U00000417" },
-{ 0x00000418, U"\U00000418\U00000438\U00000418" },
-{ 0x00000419, U"\U00000419\U00000439\U00000419" },
-{ 0x0000041A, U"\U0000041A\U0000043A\U0000041A" },
-{ 0x0000041B, U"\U0000041B\U0000043B\U0000041B" },
-{ 0x0000041C, U"\U0000041C\U0000043C\U0000041C" },
-{ 0x0000041D, U"\U0000041D\U0000043D\U0000041D" },
-{ 0x0000041E, U"\U0000041E\U0000043E\U0000041E" },
-{ 0x0000041F, U"\U0000041F\U0000043F\U0000041F" },
-{ 0x00000420, U"\U00000420\U00000440\U00000420" },
-{ 0x00000421, U"\U00000421\U00000441\U00000421" },
-{ 0x00000422, U"\U00000422\U00000442\U00000422" },
-{ 0x00000423, U"\U00000423\U00000443\U00000423" },
-{ 0x00000424, U"\U00000424\U00000444\U00000424" },
-{ 0x00000425, U"\U00000425\U00000445\U00000425" },
-{ 0x00000426, U"\U00000426\U00000446\U00000426" },
-{ 0x00000427, U"\U00000427\U00000447\U00000427" },
-{ 0x00000428, U"\U00000428\U00000448\U00000428" },
-{ 0x00000429, U"\U00000429\U00000449\U00000429" },
-{ 0x0000042A, U"\U0000042A\U0000044A\U0000042A" },
-{ 0x0000042B, U"\U0000042B\U0000044B\U0000042B" },
-{ 0x0000042C, U"\U0000042C\U0000044C\U0000042C" },
-{ 0x0000042D, U"\U0000042D\U0000044D\U0000042D" },
-{ 0x0000042E, U"\U0000042E\U0000044E\U0000042E" },
-{ 0x0000042F, U"\U0000042F\U0000044F\U0000042F" },
-{ 0x00000430, U"\U00000410\U00000430\U00000410" },
-{ 0x00000431, U"\U00000411\U00000431\U00000411" },
-{ 0x00000432, U"\U00000412\U00000432\U00000412" },
-{ 0x00000433, U"\U00000413\U00000433\U00000413" },
-{ 0x00000434, U"\U00000414\U00000434\U00000414" },
-{ 0x00000435, U"\U00000415\U00000435\U00000415" },
-{ 0x00000436, U"\U00000416\U00000436\U00000416" },
-{ 0x00000437, U"\U00000417\U00000437\U00000417" },
-{ 0x00000438, U"\U00000418\U00000438\U00000418" },
-{ 0x00000439, U"\U00000419\U00000439\U00000419" },
-{ 0x0000043A, U"\U0000041A\U0000043A\U0000041A" },
-{ 0x0000043B, U"\U0000041B\U0000043B\U0000041B" },
-{ 0x0000043C, U"\U0000041C\U0000043C\U0000041C" },
-{ 0x0000043D, U"\U0000041D\U0000043D\U0000041D" },
-{ 0x0000043E, U"\U0000041E\U0000043E\U0000041E" },
-{ 0x0000043F, U"\U0000041F\U0000043F\U0000041F" },
-{ 0x00000440, U"\U00000420\U00000440\U00000420" },
-{ 0x00000441, U"\U00000421\U00000441\U00000421" },
-{ 0x00000442, U"\U00000422\U00000442\U00000422" },
-{ 0x00000443, U"\U00000423\U00000443\U00000423" },
-{ 0x00000444, U"\U00000424\U00000444\U00000424" },
-{ 0x00000445, U"\U00000425\U00000445\U00000425" },
-{ 0x00000446, U"\U00000426\U00000446\U00000426" },
-{ 0x00000447, U"\U00000427\U00000447\U00000427" },
-{ 0x00000448, U"\U00000428\U00000448\U00000428" },
-{ 0x00000449, U"\U00000429\U00000449\U00000429" },
-{ 0x0000044A, U"\U0000042A\U0000044A\U0000042A" },
-{ 0x0000044B, U"\U0000042B\U0000044B\U0000042B" },
-{ 0x0000044C, U"\U0000042C\U0000044C\U0000042C" },
-{ 0x0000044D, U"\U0000042D\U0000044D\U0000042D" },
-{ 0x0000044E, U"\U0000042E\U0000044E\U0000042E" },
-{ 0x0000044F, U"\U0000042F\U0000044F\U0000042F" },
-{ 0x00000450, U"\U00000400\U00000450\U00000400" },
-{ 0x00000451, U"\U00000401\U00000451\U00000401" },
-{ 0x00000452, U"\U00000402\U00000452\U00000402" },
-{ 0x00000453, U"\U00000403\U00000453\U00000403" },
-{ 0x00000454, U"\U00000404\U00000454\U00000404" },
-{ 0x00000455, U"\U00000405\U00000455\U00000405" },
-{ 0x00000456, U"\U00000406\U00000456\U00000406" },
-{ 0x00000457, U"\U00000407\U00000457\U00000407" },
-{ 0x00000458, U"\U00000408\U00000458\U00000408" },
-{ 0x00000459, U"\U00000409\U00000459\U00000409" },
-{ 0x0000045A, U"\U0000040A\U0000045A\U0000040A" },
-{ 0x0000045B, U"\U0000040B\U0000045B\U0000040B" },
-{ 0x0000045C, U"\U0000040C\U0000045C\U0000040C" },
-{ 0x0000045D, U"\U0000040D\U0000045D\U0000040D" },
-{ 0x0000045E, U"\U0000040E\U0000045E\U0000040E" },
-{ 0x0000045F, U"\U0000040F\U0000045F\U0000040F" },
-{ 0x00000460, U"\U00000460\U00000461\U00000460" },
-{ 0x00000461, U"\U00000460\U00000461\U00000460" },
-{ 0x00000462, U"\U00000462\U00000463\U00000462" },
-{ 0x00000463, U"\U00000462\U00000463\U00000462" },
-{ 0x00000464, U"\U00000464\U00000465\U00000464" },
-{ 0x00000465, U"\U00000464\U00000465\U00000464" },
-{ 0x00000466, U"\U00000466\U00000467\U00000466" },
-{ 0x00000467, U"\U00000466\U00000467\U00000466" },
-{ 0x00000468, U"\U00000468\U00000469\U00000468" },
-{ 0x00000469, U"\U00000468\U00000469\U00000468" },
-{ 0x0000046A, U"\U0000046A\U0000046B\U0000046A" },
-{ 0x0000046B, U"\U0000046A\U0000046B\U0000046A" },
-{ 0x0000046C, U"\U0000046C\U0000046D\U0000046C" },
-{ 0x0000046D, U"\U0000046C\U0000046D\U0000046C" },
-{ 0x0000046E, U"\U0000046E\U0000046F\U0000046E" },
-{ 0x0000046F, U"\U0000046E\U0000046F\U0000046E" },
-{ 0x00000470, U"\U00000470\U00000471\U00000470" },
-{ 0x00000471, U"\U00000470\U00000471\U00000470" },
-{ 0x00000472, U"\U00000472\U00000473\U00000472" },
-{ 0x00000473, U"\U00000472\U00000473\U00000472" },
-{ 0x00000474, U"\U00000474\U00000475\U00000474" },
-{ 0x00000475, U"\U00000474\U00000475\U00000474" },
-{ 0x00000476, U"\U00000476\U00000477\U00000476" },
-{ 0x00000477, U"\U00000476\U00000477\U00000476" },
-{ 0x00000478, U"\U00000478\U00000479\U00000478" },
-{ 0x00000479, U"\U00000478\U00000479\U00000478" },
-{ 0x0000047A, U"\U0000047A\U0000047B\U0000047A" },
-{ 0x0000047B, U"\U0000047A\U0000047B\U0000047A" },
-{ 0x0000047C, U"\U0000047C\U0000047D\U0000047C" },
-{ 0x0000047D, U"\U0000047C\U0000047D\U0000047C" },
-{ 0x0000047E, U"\U0000047E\U0000047F\U0000047E" },
-{ 0x0000047F, U"\U0000047E\U0000047F\U0000047E" },
-{ 0x00000480, U"\U00000480\U00000481\U00000480" },
-{ 0x00000481, U"\U00000480\U00000481\U00000480" },
-{ 0x0000048A, U"\U0000048A\U0000048B\U0000048A" },
-{ 0x0000048B, U"\U0000048A\U0000048B\U0000048A" },
-{ 0x0000048C, U"\U0000048C\U0000048D\U0000048C" },
-{ 0x0000048D, U"\U0000048C\U0000048D\U0000048C" },
-{ 0x0000048E, U"\U0000048E\U0000048F\U0000048E" },
-{ 0x0000048F, U"\U0000048E\U0000048F\U0000048E" },
-{ 0x00000490, U"\U00000490\U00000491\U00000490" },
-{ 0x00000491, U"\U00000490\U00000491\U00000490" },
-{ 0x00000492, U"\U00000492\U00000493\U00000492" },
-{ 0x00000493, U"\U00000492\U00000493\U00000492" },
-{ 0x00000494, U"\U00000494\U00000495\U00000494" },
-{ 0x00000495, U"\U00000494\U00000495\U00000494" },
-{ 0x00000496, U"\U00000496\U00000497\U00000496" },
-{ 0x00000497, U"\U00000496\U00000497\U00000496" },
-{ 0x00000498, U"\U00000498\U00000499\U00000498" },
-{ 0x00000499, U"\U00000498\U00000499\U00000498" },
-{ 0x0000049A, U"\U0000049A\U0000049B\U0000049A" },
-{ 0x0000049B, U"\U0000049A\U0000049B\U0000049A" },
-{ 0x0000049C, U"\U0000049C\U0000049D\U0000049C" },
-{ 0x0000049D, U"\U0000049C\U0000049D\U0000049C" },
-{ 0x0000049E, U"\U0000049E\U0000049F\U0000049E" },
-{ 0x0000049F, U"\U0000049E\U0000049F\U0000049E" },
-{ 0x000004A0, U"\U000004A0\U000004A1\U000004A0" },
-{ 0x000004A1, U"\U000004A0\U000004A1\U000004A0" },
-{ 0x000004A2, U"\U000004A2\U000004A3\U000004A2" },
-{ 0x000004A3, U"\U000004A2\U000004A3\U000004A2" },
-{ 0x000004A4, U"\U000004A4\U000004A5\U000004A4" },
-{ 0x000004A5, U"\U000004A4\U000004A5\U000004A4" },
-{ 0x000004A6, U"\U000004A6\U000004A7\U000004A6" },
-{ 0x000004A7, U"\U000004A6\U000004A7\U000004A6" },
-{ 0x000004A8, U"\U000004A8\U000004A9\U000004A8" },
-{ 0x000004A9, U"\U000004A8\U000004A9\U000004A8" },
-{ 0x000004AA, U"\U000004AA\U000004AB\U000004AA" },
-{ 0x000004AB, U"\U000004AA\U000004AB\U000004AA" },
-{ 0x000004AC, U"\U000004AC\U000004AD\U000004AC" },
-{ 0x000004AD, U"\U000004AC\U000004AD\U000004AC" },
-{ 0x000004AE, U"\U000004AE\U000004AF\U000004AE" },
-{ 0x000004AF, U"\U000004AE\U000004AF\U000004AE" },
-{ 0x000004B0, U"\U000004B0\U000004B1\U000004B0" },
-{ 0x000004B1, U"\U000004B0\U000004B1\U000004B0" },
-{ 0x000004B2, U"\U000004B2\U000004B3\U000004B2" },
-{ 0x000004B3, U"\U000004B2\U000004B3\U000004B2" },
-{ 0x000004B4, U"\U000004B4\U000004B5\U000004B4" },
-{ 0x000004B5, U"\U000004B4\U000004B5\U000004B4" },
-{ 0x000004B6, U"\U000004B6\U000004B7\U000004B6" },
-{ 0x000004B7, U"\U000004B6\U000004B7\U000004B6" },
-{ 0x000004B8, U"\U000004B8\U000004B9\U000004B8" },
-{ 0x000004B9, U"\U000004B8\U000004B9\U000004B8" },
-{ 0x000004BA, U"\U000004BA\U000004BB\U000004BA" },
-{ 0x000004BB, U"\U000004BA\U000004BB\U000004BA" },
-{ 0x000004BC, U"\U000004BC\U000004BD\U000004BC" },
-{ 0x000004BD, U"\U000004BC\U000004BD\U000004BC" },
-{ 0x000004BE, U"\U000004BE\U000004BF\U000004BE" },
-{ 0x000004BF, U"\U000004BE\U000004BF\U000004BE" },
-{ 0x000004C0, U"\U000004C0\U000004CF\U000004C0" },
-{ 0x000004C1, U"\U000004C1\U000004C2\U000004C1" },
-{ 0x000004C2, U"\U000004C1\U000004C2\U000004C1" },
-{ 0x000004C3, U"\U000004C3\U000004C4\U000004C3" },
-{ 0x000004C4, U"\U000004C3\U000004C4\U000004C3" },
-{ 0x000004C5, U"\U000004C5\U000004C6\U000004C5" },
-{ 0x000004C6, U"\U000004C5\U000004C6\U000004C5" },
-{ 0x000004C7, U"\U000004C7\U000004C8\U000004C7" },
-{ 0x000004C8, U"\U000004C7\U000004C8\U000004C7" },
-{ 0x000004C9, U"\U000004C9\U000004CA\U000004C9" },
-{ 0x000004CA, U"\U000004C9\U000004CA\U000004C9" },
-{ 0x000004CB, U"\U000004CB\U000004CC\U000004CB" },
-{ 0x000004CC, U"\U000004CB\U000004CC\U000004CB" },
-{ 0x000004CD, U"\U000004CD\U000004CE\U000004CD" },
-{ 0x000004CE, U"\U000004CD\U000004CE\U000004CD" },
-{ 0x000004CF, U"\U000004C0\U000004CF\U000004C0" },
-{ 0x000004D0, U"\U000004D0\U000004D1\U000004D0" },
-{ 0x000004D1, U"\U000004D0\U000004D1\U000004D0" },
-{ 0x000004D2, U"\U000004D2\U000004D3\U000004D2" },
-{ 0x000004D3, U"\U000004D2\U000004D3\U000004D2" },
-{ 0x000004D4, U"\U000004D4\U000004D5\U000004D4" },
-{ 0x000004D5, U"\U000004D4\U000004D5\U000004D4" },
-{ 0x000004D6, U"\U000004D6\U000004D7\U000004D6" },
-{ 0x000004D7, U"\U000004D6\U000004D7\U000004D6" },
-{ 0x000004D8, U"\U000004D8\U000004D9\U000004D8" },
-{ 0x000004D9, U"\U000004D8\U000004D9\U000004D8" },
-{ 0x000004DA, U"\U000004DA\U000004DB\U000004DA" },
-{ 0x000004DB, U"\U000004DA\U000004DB\U000004DA" },
-{ 0x000004DC, U"\U000004DC\U000004DD\U000004DC" },
-{ 0x000004DD, U"\U000004DC\U000004DD\U000004DC" },
-{ 0x000004DE, U"\U000004DE\U000004DF\U000004DE" },
-{ 0x000004DF, U"\U000004DE\U000004DF\U000004DE" },
-{ 0x000004E0, U"\U000004E0\U000004E1\U000004E0" },
-{ 0x000004E1, U"\U000004E0\U000004E1\U000004E0" },
-{ 0x000004E2, U"\U000004E2\U000004E3\U000004E2" },
-{ 0x000004E3, U"\U000004E2\U000004E3\U000004E2" },
-{ 0x000004E4, U"\U000004E4\U000004E5\U000004E4" },
-{ 0x000004E5, U"\U000004E4\U000004E5\U000004E4" },
-{ 0x000004E6, U"\U000004E6\U000004E7\U000004E6" },
-{ 0x000004E7, U"\U000004E6\U000004E7\U000004E6" },
-{ 0x000004E8, U"\U000004E8\U000004E9\U000004E8" },
-{ 0x000004E9, U"\U000004E8\U000004E9\U000004E8" },
-{ 0x000004EA, U"\U000004EA\U000004EB\U000004EA" },
-{ 0x000004EB, U"\U000004EA\U000004EB\U000004EA" },
-{ 0x000004EC, U"\U000004EC\U000004ED\U000004EC" },
-{ 0x000004ED, U"\U000004EC\U000004ED\U000004EC" },
-{ 0x000004EE, U"\U000004EE\U000004EF\U000004EE" },
-{ 0x000004EF, U"\U000004EE\U000004EF\U000004EE" },
-{ 0x000004F0, U"\U000004F0\U000004F1\U000004F0" },
-{ 0x000004F1, U"\U000004F0\U000004F1\U000004F0" },
-{ 0x000004F2, U"\U000004F2\U000004F3\U000004F2" },
-{ 0x000004F3, U"\U000004F2\U000004F3\U000004F2" },
-{ 0x000004F4, U"\U000004F4\U000004F5\U000004F4" },
-{ 0x000004F5, U"\U000004F4\U000004F5\U000004F4" },
-{ 0x000004F6, U"\U000004F6\U000004F7\U000004F6" },
-{ 0x000004F7, U"\U000004F6\U000004F7\U000004F6" },
-{ 0x000004F8, U"\U000004F8\U000004F9\U000004F8" },
-{ 0x000004F9, U"\U000004F8\U000004F9\U000004F8" },
-{ 0x000004FA, U"\U000004FA\U000004FB\U000004FA" },
-{ 0x000004FB, U"\U000004FA\U000004FB\U000004FA" },
-{ 0x000004FC, U"\U000004FC\U000004FD\U000004FC" },
-{ 0x000004FD, U"\U000004FC\U000004FD\U000004FC" },
-{ 0x000004FE, U"\U000004FE\U000004FF\U000004FE" },
-{ 0x000004FF, U"\U000004FE\U000004FF\U000004FE" },
-{ 0x00000500, U"\U00000500\U00000501\U00000500" },
-{ 0x00000501, U"\U00000500\U00000501\U00000500" },
-{ 0x00000502, U"\U00000502\U00000503\U00000502" },
-{ 0x00000503, U"\U00000502\U00000503\U00000502" },
-{ 0x00000504, U"\U00000504\U00000505\U00000504" },
-{ 0x00000505, U"\U00000504\U00000505\U00000504" },
-{ 0x00000506, U"\U00000506\U00000507\U00000506" },
-{ 0x00000507, U"\U00000506\U00000507\U00000506" },
-{ 0x00000508, U"\U00000508\U00000509\U00000508" },
-{ 0x00000509, U"\U00000508\U00000509\U00000508" },
-{ 0x0000050A, U"\U0000050A\U0000050B\U0000050A" },
-{ 0x0000050B, U"\U0000050A\U0000050B\U0000050A" },
-{ 0x0000050C, U"\U0000050C\U0000050D\U0000050C" },
-{ 0x0000050D, U"\U0000050C\U0000050D\U0000050C" },
-{ 0x0000050E, U"\U0000050E\U0000050F\U0000050E" },
-{ 0x0000050F, U"\U0000050E\U0000050F\U0000050E" },
-{ 0x00000510, U"\U00000510\U00000511\U00000510" },
-{ 0x00000511, U"\U00000510\U00000511\U00000510" },
-{ 0x00000512, U"\U00000512\U00000513\U00000512" },
-{ 0x00000513, U"\U00000512\U00000513\U00000512" },
-{ 0x00000514, U"\U00000514\U00000515\U00000514" },
-{ 0x00000515, U"\U00000514\U00000515\U00000514" },
-{ 0x00000516, U"\U00000516\U00000517\U00000516" },
-{ 0x00000517, U"\U00000516\U00000517\U00000516" },
-{ 0x00000518, U"\U00000518\U00000519\U00000518" },
-{ 0x00000519, U"\U00000518\U00000519\U00000518" },
-{ 0x0000051A, U"\U0000051A\U0000051B\U0000051A" },
-{ 0x0000051B, U"\U0000051A\U0000051B\U0000051A" },
-{ 0x0000051C, U"\U0000051C\U0000051D\U0000051C" },
-{ 0x0000051D, U"\U0000051C\U0000051D\U0000051C" },
-{ 0x0000051E, U"\U0000051E\U0000051F\U0000051E" },
-{ 0x0000051F, U"\U0000051E\U0000051F\U0000051E" },
-{ 0x00000520, U"\U00000520\U00000521\U00000520" },
-{ 0x00000521, U"\U00000520\U00000521\U00000520" },
-{ 0x00000522, U"\U00000522\U00000523\U00000522" },
-{ 0x00000523, U"\U00000522\U00000523\U00000522" },
-{ 0x00000524, U"\U00000524\U00000525\U00000524" },
-{ 0x00000525, U"\U00000524\U00000525\U00000524" },
-{ 0x00000526, U"\U00000526\U00000527\U00000526" },
-{ 0x00000527, U"\U00000526\U00000527\U00000526" },
-{ 0x00000528, U"\U00000528\U00000529\U00000528" },
-{ 0x00000529, U"\U00000528\U00000529\U00000528" },
-{ 0x0000052A, U"\U0000052A\U0000052B\U0000052A" },
-{ 0x0000052B, U"\U0000052A\U0000052B\U0000052A" },
-{ 0x0000052C, U"\U0000052C\U0000052D\U0000052C" },
-{ 0x0000052D, U"\U0000052C\U0000052D\U0000052C" },
-{ 0x0000052E, U"\U0000052E\U0000052F\U0000052E" },
-{ 0x0000052F, U"\U0000052E\U0000052F\U0000052E" },
-{ 0x00000531, U"\U00000531\U00000561\U00000531" },
-{ 0x00000532, U"\U00000532\U00000562\U00000532" },
-{ 0x00000533, U"\U00000533\U00000563\U00000533" },
-{ 0x00000534, U"\U00000534\U00000564\U00000534" },
-{ 0x00000535, U"\U00000535\U00000565\U00000535" },
-{ 0x00000536, U"\U00000536\U00000566\U00000536" },
-{ 0x00000537, U"\U00000537\U00000567\U00000537" },
-{ 0x00000538, U"\U00000538\U00000568\U00000538" },
-{ 0x00000539, U"\U00000539\U00000569\U00000539" },
-{ 0x0000053A, U"\U0000053A\U0000056A\U0000053A" },
-{ 0x0000053B, U"\U0000053B\U0000056B\U0000053B" },
-{ 0x0000053C, U"\U0000053C\U0000056C\U0000053C" },
-{ 0x0000053D, U"\U0000053D\U0000056D\U0000053D" },
-{ 0x0000053E, U"\U0000053E\U0000056E\U0000053E" },
-{ 0x0000053F, U"\U0000053F\U0000056F\U0000053F" },
-{ 0x00000540, U"\U00000540\U00000570\U00000540" },
-{ 0x00000541, U"\U00000541\U00000571\U00000541" },
-{ 0x00000542, U"\U00000542\U00000572\U00000542" },
-{ 0x00000543, U"\U00000543\U00000573\U00000543" },
-{ 0x00000544, U"\U00000544\U00000574\U00000544" },
-{ 0x00000545, U"\U00000545\U00000575\U00000545" },
-{ 0x00000546, U"\U00000546\U00000576\U00000546" },
-{ 0x00000547, U"\U00000547\U00000577\U00000547" },
-{ 0x00000548, U"\U00000548\U00000578\U00000548" },
-{ 0x00000549, U"\U00000549\U00000579\U00000549" },
-{ 0x0000054A, U"\U0000054A\U0000057A\U0000054A" },
-{ 0x0000054B, U"\U0000054B\U0000057B\U0000054B" },
-{ 0x0000054C, U"\U0000054C\U0000057C\U0000054C" },
-{ 0x0000054D, U"\U0000054D\U0000057D\U0000054D" },
-{ 0x0000054E, U"\U0000054E\U0000057E\U0000054E" },
-{ 0x0000054F, U"\U0000054F\U0000057F\U0000054F" },
-{ 0x00000550, U"\U00000550\U00000580\U00000550" },
-{ 0x00000551, U"\U00000551\U00000581\U00000551" },
-{ 0x00000552, U"\U00000552\U00000582\U00000552" },
-{ 0x00000553, U"\U00000553\U00000583\U00000553" },
-{ 0x00000554, U"\U00000554\U00000584\U00000554" },
-{ 0x00000555, U"\U00000555\U00000585\U00000555" },
-{ 0x00000556, U"\U00000556\U00000586\U00000556" },
-{ 0x00000561, U"\U00000531\U00000561\U00000531" },
-{ 0x00000562, U"\U00000532\U00000562\U00000532" },
-{ 0x00000563, U"\U00000533\U00000563\U00000533" },
-{ 0x00000564, U"\U00000534\U00000564\U00000534" },
-{ 0x00000565, U"\U00000535\U00000565\U00000535" },
-{ 0x00000566, U"\U00000536\U00000566\U00000536" },
-{ 0x00000567, U"\U00000537\U00000567\U00000537" },
-{ 0x00000568, U"\U00000538\U00000568\U00000538" },
-{ 0x00000569, U"\U00000539\U00000569\U00000539" },
-{ 0x0000056A, U"\U0000053A\U0000056A\U0000053A" },
-{ 0x0000056B, U"\U0000053B\U0000056B\U0000053B" },
-{ 0x0000056C, U"\U0000053C\U0000056C\U0000053C" },
-{ 0x0000056D, U"\U0000053D\U0000056D\U0000053D" },
-{ 0x0000056E, U"\U0000053E\U0000056E\U0000053E" },
-{ 0x0000056F, U"\U0000053F\U0000056F\U0000053F" },
-{ 0x00000570, U"\U00000540\U00000570\U00000540" },
-{ 0x00000571, U"\U00000541\U00000571\U00000541" },
-{ 0x00000572, U"\U00000542\U00000572\U00000542" },
-{ 0x00000573, U"\U00000543\U00000573\U00000543" },
-{ 0x00000574, U"\U00000544\U00000574\U00000544" },
-{ 0x00000575, U"\U00000545\U00000575\U00000545" },
-{ 0x00000576, U"\U00000546\U00000576\U00000546" },
-{ 0x00000577, U"\U00000547\U00000577\U00000547" },
-{ 0x00000578, U"\U00000548\U00000578\U00000548" },
-{ 0x00000579, U"\U00000549\U00000579\U00000549" },
-{ 0x0000057A, U"\U0000054A\U0000057A\U0000054A" },
-{ 0x0000057B, U"\U0000054B\U0000057B\U0000054B" },
-{ 0x0000057C, U"\U0000054C\U0000057C\U0000054C" },
-{ 0x0000057D, U"\U0000054D\U0000057D\U0000054D" },
-{ 0x0000057E, U"\U0000054E\U0000057E\U0000054E" },
-{ 0x0000057F, U"\U0000054F\U0000057F\U0000054F" },
-{ 0x00000580, U"\U00000550\U00000580\U00000550" },
-{ 0x00000581, U"\U00000551\U00000581\U00000551" },
-{ 0x00000582, U"\U00000552\U00000582\U00000552" },
-{ 0x00000583, U"\U00000553\U00000583\U00000553" },
-{ 0x00000584, U"\U00000554\U00000584\U00000554" },
-{ 0x00000585, U"\U00000555\U00000585\U00000555" },
-{ 0x00000586, U"\U00000556\U00000586\U00000556" },
-{ 0x000010A0, U"\U000010A0\U00002D00\U000010A0" },
-{ 0x000010A1, U"\U000010A1\U00002D01\U000010A1" },
-{ 0x000010A2, U"\U000010A2\U00002D02\U000010A2" },
-{ 0x000010A3, U"\U000010A3\U00002D03\U000010A3" },
-{ 0x000010A4, U"\U000010A4\U00002D04\U000010A4" },
-{ 0x000010A5, U"\U000010A5\U00002D05\U000010A5" },
-{ 0x000010A6, U"\U000010A6\U00002D06\U000010A6" },
-{ 0x000010A7, U"\U000010A7\U00002D07\U000010A7" },
-{ 0x000010A8, U"\U000010A8\U00002D08\U000010A8" },
-{ 0x000010A9, U"\U000010A9\U00002D09\U000010A9" },
-{ 0x000010AA, U"\U000010AA\U00002D0A\U000010AA" },
-{ 0x000010AB, U"\U000010AB\U00002D0B\U000010AB" },
-{ 0x000010AC, U"\U000010AC\U00002D0C\U000010AC" },
-{ 0x000010AD, U"\U000010AD\U00002D0D\U000010AD" },
-{ 0x000010AE, U"\U000010AE\U00002D0E\U000010AE" },
-{ 0x000010AF, U"\U000010AF\U00002D0F\U000010AF" },
-{ 0x000010B0, U"\U000010B0\U00002D10\U000010B0" },
-{ 0x000010B1, U"\U000010B1\U00002D11\U000010B1" },
-{ 0x000010B2, U"\U000010B2\U00002D12\U000010B2" },
-{ 0x000010B3, U"\U000010B3\U00002D13\U000010B3" },
-{ 0x000010B4, U"\U000010B4\U00002D14\U000010B4" },
-{ 0x000010B5, U"\U000010B5\U00002D15\U000010B5" },
-{ 0x000010B6, U"\U000010B6\U00002D16\U000010B6" },
-{ 0x000010B7, U"\U000010B7\U00002D17\U000010B7" },
-{ 0x000010B8, U"\U000010B8\U00002D18\U000010B8" },
-{ 0x000010B9, U"\U000010B9\U00002D19\U000010B9" },
-{ 0x000010BA, U"\U000010BA\U00002D1A\U000010BA" },
-{ 0x000010BB, U"\U000010BB\U00002D1B\U000010BB" },
-{ 0x000010BC, U"\U000010BC\U00002D1C\U000010BC" },
-{ 0x000010BD, U"\U000010BD\U00002D1D\U000010BD" },
-{ 0x000010BE, U"\U000010BE\U00002D1E\U000010BE" },
-{ 0x000010BF, U"\U000010BF\U00002D1F\U000010BF" },
-{ 0x000010C0, U"\U000010C0\U00002D20\U000010C0" },
-{ 0x000010C1, U"\U000010C1\U00002D21\U000010C1" },
-{ 0x000010C2, U"\U000010C2\U00002D22\U000010C2" },
-{ 0x000010C3, U"\U000010C3\U00002D23\U000010C3" },
-{ 0x000010C4, U"\U000010C4\U00002D24\U000010C4" },
-{ 0x000010C5, U"\U000010C5\U00002D25\U000010C5" },
-{ 0x000010C7, U"\U000010C7\U00002D27\U000010C7" },
-{ 0x000010CD, U"\U000010CD\U00002D2D\U000010CD" },
-{ 0x000010D0, U"\U00001C90\U000010D0\U000010D0" },
-{ 0x000010D1, U"\U00001C91\U000010D1\U000010D1" },
-{ 0x000010D2, U"\U00001C92\U000010D2\U000010D2" },
-{ 0x000010D3, U"\U00001C93\U000010D3\U000010D3" },
-{ 0x000010D4, U"\U00001C94\U000010D4\U000010D4" },
-{ 0x000010D5, U"\U00001C95\U000010D5\U000010D5" },
-{ 0x000010D6, U"\U00001C96\U000010D6\U000010D6" },
-{ 0x000010D7, U"\U00001C97\U000010D7\U000010D7" },
-{ 0x000010D8, U"\U00001C98\U000010D8\U000010D8" },
-{ 0x000010D9, U"\U00001C99\U000010D9\U000010D9" },
-{ 0x000010DA, U"\U00001C9A\U000010DA\U000010DA" },
-{ 0x000010DB, U"\U00001C9B\U000010DB\U000010DB" },
-{ 0x000010DC, U"\U00001C9C\U000010DC\U000010DC" },
-{ 0x000010DD, U"\U00001C9D\U000010DD\U000010DD" },
-{ 0x000010DE, U"\U00001C9E\U000010DE\U000010DE" },
-{ 0x000010DF, U"\U00001C9F\U000010DF\U000010DF" },
-{ 0x000010E0, U"\U00001CA0\U000010E0\U000010E0" },
-{ 0x000010E1, U"\U00001CA1\U000010E1\U000010E1" },
-{ 0x000010E2, U"\U00001CA2\U000010E2\U000010E2" },
-{ 0x000010E3, U"\U00001CA3\U000010E3\U000010E3" },
-{ 0x000010E4, U"\U00001CA4\U000010E4\U000010E4" },
-{ 0x000010E5, U"\U00001CA5\U000010E5\U000010E5" },
-{ 0x000010E6, U"\U00001CA6\U000010E6\U000010E6" },
-{ 0x000010E7, U"\U00001CA7\U000010E7\U000010E7" },
-{ 0x000010E8, U"\U00001CA8\U000010E8\U000010E8" },
-{ 0x000010E9, U"\U00001CA9\U000010E9\U000010E9" },
-{ 0x000010EA, U"\U00001CAA\U000010EA\U000010EA" },
-{ 0x000010EB, U"\U00001CAB\U000010EB\U000010EB" },
-{ 0x000010EC, U"\U00001CAC\U000010EC\U000010EC" },
-{ 0x000010ED, U"\U00001CAD\U000010ED\U000010ED" },
-{ 0x000010EE, U"\U00001CAE\U000010EE\U000010EE" },
-{ 0x000010EF, U"\U00001CAF\U000010EF\U000010EF" },
-{ 0x000010F0, U"\U00001CB0\U000010F0\U000010F0" },
-{ 0x000010F1, U"\U00001CB1\U000010F1\U000010F1" },
-{ 0x000010F2, U"\U00001CB2\U000010F2\U000010F2" },
-{ 0x000010F3, U"\U00001CB3\U000010F3\U000010F3" },
-{ 0x000010F4, U"\U00001CB4\U000010F4\U000010F4" },
-{ 0x000010F5, U"\U00001CB5\U000010F5\U000010F5" },
-{ 0x000010F6, U"\U00001CB6\U000010F6\U000010F6" },
-{ 0x000010F7, U"\U00001CB7\U000010F7\U000010F7" },
-{ 0x000010F8, U"\U00001CB8\U000010F8\U000010F8" },
-{ 0x000010F9, U"\U00001CB9\U000010F9\U000010F9" },
-{ 0x000010FA, U"\U00001CBA\U000010FA\U000010FA" },
-{ 0x000010FD, U"\U00001CBD\U000010FD\U000010FD" },
-{ 0x000010FE, U"\U00001CBE\U000010FE\U000010FE" },
-{ 0x000010FF, U"\U00001CBF\U000010FF\U000010FF" },
-{ 0x000013A0, U"\U000013A0\U0000AB70\U000013A0" },
-{ 0x000013A1, U"\U000013A1\U0000AB71\U000013A1" },
-{ 0x000013A2, U"\U000013A2\U0000AB72\U000013A2" },
-{ 0x000013A3, U"\U000013A3\U0000AB73\U000013A3" },
-{ 0x000013A4, U"\U000013A4\U0000AB74\U000013A4" },
-{ 0x000013A5, U"\U000013A5\U0000AB75\U000013A5" },
-{ 0x000013A6, U"\U000013A6\U0000AB76\U000013A6" },
-{ 0x000013A7, U"\U000013A7\U0000AB77\U000013A7" },
-{ 0x000013A8, U"\U000013A8\U0000AB78\U000013A8" },
-{ 0x000013A9, U"\U000013A9\U0000AB79\U000013A9" },
-{ 0x000013AA, U"\U000013AA\U0000AB7A\U000013AA" },
-{ 0x000013AB, U"\U000013AB\U0000AB7B\U000013AB" },
-{ 0x000013AC, U"\U000013AC\U0000AB7C\U000013AC" },
-{ 0x000013AD, U"\U000013AD\U0000AB7D\U000013AD" },
-{ 0x000013AE, U"\U000013AE\U0000AB7E\U000013AE" },
-{ 0x000013AF, U"\U000013AF\U0000AB7F\U000013AF" },
-{ 0x000013B0, U"\U000013B0\U0000AB80\U000013B0" },
-{ 0x000013B1, U"\U000013B1\U0000AB81\U000013B1" },
-{ 0x000013B2, U"\U000013B2\U0000AB82\U000013B2" },
-{ 0x000013B3, U"\U000013B3\U0000AB83\U000013B3" },
-{ 0x000013B4, U"\U000013B4\U0000AB84\U000013B4" },
-{ 0x000013B5, U"\U000013B5\U0000AB85\U000013B5" },
-{ 0x000013B6, U"\U000013B6\U0000AB86\U000013B6" },
-{ 0x000013B7, U"\U000013B7\U0000AB87\U000013B7" },
-{ 0x000013B8, U"\U000013B8\U0000AB88\U000013B8" },
-{ 0x000013B9, U"\U000013B9\U0000AB89\U000013B9" },
-{ 0x000013BA, U"\U000013BA\U0000AB8A\U000013BA" },
-{ 0x000013BB, U"\U000013BB\U0000AB8B\U000013BB" },
-{ 0x000013BC, U"\U000013BC\U0000AB8C\U000013BC" },
-{ 0x000013BD, U"\U000013BD\U0000AB8D\U000013BD" },
-{ 0x000013BE, U"\U000013BE\U0000AB8E\U000013BE" },
-{ 0x000013BF, U"\U000013BF\U0000AB8F\U000013BF" },
-{ 0x000013C0, U"\U000013C0\U0000AB90\U000013C0" },
-{ 0x000013C1, U"\U000013C1\U0000AB91\U000013C1" },
-{ 0x000013C2, U"\U000013C2\U0000AB92\U000013C2" },
-{ 0x000013C3, U"\U000013C3\U0000AB93\U000013C3" },
-{ 0x000013C4, U"\U000013C4\U0000AB94\U000013C4" },
-{ 0x000013C5, U"\U000013C5\U0000AB95\U000013C5" },
-{ 0x000013C6, U"\U000013C6\U0000AB96\U000013C6" },
-{ 0x000013C7, U"\U000013C7\U0000AB97\U000013C7" },
-{ 0x000013C8, U"\U000013C8\U0000AB98\U000013C8" },
-{ 0x000013C9, U"\U000013C9\U0000AB99\U000013C9" },
-{ 0x000013CA, U"\U000013CA\U0000AB9A\U000013CA" },
-{ 0x000013CB, U"\U000013CB\U0000AB9B\U000013CB" },
-{ 0x000013CC, U"\U000013CC\U0000AB9C\U000013CC" },
-{ 0x000013CD, U"\U000013CD\U0000AB9D\U000013CD" },
-{ 0x000013CE, U"\U000013CE\U0000AB9E\U000013CE" },
-{ 0x000013CF, U"\U000013CF\U0000AB9F\U000013CF" },
-{ 0x000013D0, U"\U000013D0\U0000ABA0\U000013D0" },
-{ 0x000013D1, U"\U000013D1\U0000ABA1\U000013D1" },
-{ 0x000013D2, U"\U000013D2\U0000ABA2\U000013D2" },
-{ 0x000013D3, U"\U000013D3\U0000ABA3\U000013D3" },
-{ 0x000013D4, U"\U000013D4\U0000ABA4\U000013D4" },
-{ 0x000013D5, U"\U000013D5\U0000ABA5\U000013D5" },
-{ 0x000013D6, U"\U000013D6\U0000ABA6\U000013D6" },
-{ 0x000013D7, U"\U000013D7\U0000ABA7\U000013D7" },
-{ 0x000013D8, U"\U000013D8\U0000ABA8\U000013D8" },
-{ 0x000013D9, U"\U000013D9\U0000ABA9\U000013D9" },
-{ 0x000013DA, U"\U000013DA\U0000ABAA\U000013DA" },
-{ 0x000013DB, U"\U000013DB\U0000ABAB\U000013DB" },
-{ 0x000013DC, U"\U000013DC\U0000ABAC\U000013DC" },
-{ 0x000013DD, U"\U000013DD\U0000ABAD\U000013DD" },
-{ 0x000013DE, U"\U000013DE\U0000ABAE\U000013DE" },
-{ 0x000013DF, U"\U000013DF\U0000ABAF\U000013DF" },
-{ 0x000013E0, U"\U000013E0\U0000ABB0\U000013E0" },
-{ 0x000013E1, U"\U000013E1\U0000ABB1\U000013E1" },
-{ 0x000013E2, U"\U000013E2\U0000ABB2\U000013E2" },
-{ 0x000013E3, U"\U000013E3\U0000ABB3\U000013E3" },
-{ 0x000013E4, U"\U000013E4\U0000ABB4\U000013E4" },
-{ 0x000013E5, U"\U000013E5\U0000ABB5\U000013E5" },
-{ 0x000013E6, U"\U000013E6\U0000ABB6\U000013E6" },
-{ 0x000013E7, U"\U000013E7\U0000ABB7\U000013E7" },
-{ 0x000013E8, U"\U000013E8\U0000ABB8\U000013E8" },
-{ 0x000013E9, U"\U000013E9\U0000ABB9\U000013E9" },
-{ 0x000013EA, U"\U000013EA\U0000ABBA\U000013EA" },
-{ 0x000013EB, U"\U000013EB\U0000ABBB\U000013EB" },
-{ 0x000013EC, U"\U000013EC\U0000ABBC\U000013EC" },
-{ 0x000013ED, U"\U000013ED\U0000ABBD\U000013ED" },
-{ 0x000013EE, U"\U000013EE\U0000ABBE\U000013EE" },
-{ 0x000013EF, U"\U000013EF\U0000ABBF\U000013EF" },
-{ 0x000013F0, U"\U000013F0\U000013F8\U000013F0" },
-{ 0x000013F1, U"\U000013F1\U000013F9\U000013F1" },
-{ 0x000013F2, U"\U000013F2\U000013FA\U000013F2" },
-{ 0x000013F3, U"\U000013F3\U000013FB\U000013F3" },
-{ 0x000013F4, U"\U000013F4\U000013FC\U000013F4" },
-{ 0x000013F5, U"\U000013F5\U000013FD\U000013F5" },
-{ 0x000013F8, U"\U000013F0\U000013F8\U000013F0" },
-{ 0x000013F9, U"\U000013F1\U000013F9\U000013F1" },
-{ 0x000013FA, U"\U000013F2\U000013FA\U000013F2" },
-{ 0x000013FB, U"\U000013F3\U000013FB\U000013F3" },
-{ 0x000013FC, U"\U000013F4\U000013FC\U000013F4" },
-{ 0x000013FD, U"\U000013F5\U000013FD\U000013F5" },
-{ 0x00001C80, U"\U00000412\U00001C80\U00000412" },
-{ 0x00001C81, U"\U00000414\U00001C81\U00000414" },
-{ 0x00001C82, U"\U0000041E\U00001C82\U0000041E" },
-{ 0x00001C83, U"\U00000421\U00001C83\U00000421" },
-{ 0x00001C84, U"\U00000422\U00001C84\U00000422" },
-{ 0x00001C85, U"\U00000422\U00001C85\U00000422" },
-{ 0x00001C86, U"\U0000042A\U00001C86\U0000042A" },
-{ 0x00001C87, U"\U00000462\U00001C87\U00000462" },
-{ 0x00001C88, U"\U0000A64A\U00001C88\U0000A64A" },
-{ 0x00001C90, U"\U00001C90\U000010D0\U00001C90" },
-{ 0x00001C91, U"\U00001C91\U000010D1\U00001C91" },
-{ 0x00001C92, U"\U00001C92\U000010D2\U00001C92" },
-{ 0x00001C93, U"\U00001C93\U000010D3\U00001C93" },
-{ 0x00001C94, U"\U00001C94\U000010D4\U00001C94" },
-{ 0x00001C95, U"\U00001C95\U000010D5\U00001C95" },
-{ 0x00001C96, U"\U00001C96\U000010D6\U00001C96" },
-{ 0x00001C97, U"\U00001C97\U000010D7\U00001C97" },
-{ 0x00001C98, U"\U00001C98\U000010D8\U00001C98" },
-{ 0x00001C99, U"\U00001C99\U000010D9\U00001C99" },
-{ 0x00001C9A, U"\U00001C9A\U000010DA\U00001C9A" },
-{ 0x00001C9B, U"\U00001C9B\U000010DB\U00001C9B" },
-{ 0x00001C9C, U"\U00001C9C\U000010DC\U00001C9C" },
-{ 0x00001C9D, U"\U00001C9D\U000010DD\U00001C9D" },
-{ 0x00001C9E, U"\U00001C9E\U000010DE\U00001C9E" },
-{ 0x00001C9F, U"\U00001C9F\U000010DF\U00001C9F" },
-{ 0x00001CA0, U"\U00001CA0\U000010E0\U00001CA0" },
-{ 0x00001CA1, U"\U00001CA1\U000010E1\U00001CA1" },
-{ 0x00001CA2, U"\U00001CA2\U000010E2\U00001CA2" },
-{ 0x00001CA3, U"\U00001CA3\U000010E3\U00001CA3" },
-{ 0x00001CA4, U"\U00001CA4\U000010E4\U00001CA4" },
-{ 0x00001CA5, U"\U00001CA5\U000010E5\U00001CA5" },
-{ 0x00001CA6, U"\U00001CA6\U000010E6\U00001CA6" },
-{ 0x00001CA7, U"\U00001CA7\U000010E7\U00001CA7" },
-{ 0x00001CA8, U"\U00001CA8\U000010E8\U00001CA8" },
-{ 0x00001CA9, U"\U00001CA9\U000010E9\U00001CA9" },
-{ 0x00001CAA, U"\U00001CAA\U000010EA\U00001CAA" },
-{ 0x00001CAB, U"\U00001CAB\U000010EB\U00001CAB" },
-{ 0x00001CAC, U"\U00001CAC\U000010EC\U00001CAC" },
-{ 0x00001CAD, U"\U00001CAD\U000010ED\U00001CAD" },
-{ 0x00001CAE, U"\U00001CAE\U000010EE\U00001CAE" },
-{ 0x00001CAF, U"\U00001CAF\U000010EF\U00001CAF" },
-{ 0x00001CB0, U"\U00001CB0\U000010F0\U00001CB0" },
-{ 0x00001CB1, U"\U00001CB1\U000010F1\U00001CB1" },
-{ 0x00001CB2, U"\U00001CB2\U000010F2\U00001CB2" },
-{ 0x00001CB3, U"\U00001CB3\U000010F3\U00001CB3" },
-{ 0x00001CB4, U"\U00001CB4\U000010F4\U00001CB4" },
-{ 0x00001CB5, U"\U00001CB5\U000010F5\U00001CB5" },
-{ 0x00001CB6, U"\U00001CB6\U000010F6\U00001CB6" },
-{ 0x00001CB7, U"\U00001CB7\U000010F7\U00001CB7" },
-{ 0x00001CB8, U"\U00001CB8\U000010F8\U00001CB8" },
-{ 0x00001CB9, U"\U00001CB9\U000010F9\U00001CB9" },
-{ 0x00001CBA, U"\U00001CBA\U000010FA\U00001CBA" },
-{ 0x00001CBD, U"\U00001CBD\U000010FD\U00001CBD" },
-{ 0x00001CBE, U"\U00001CBE\U000010FE\U00001CBE" },
-{ 0x00001CBF, U"\U00001CBF\U000010FF\U00001CBF" },
-{ 0x00001D79, U"\U0000A77D\U00001D79\U0000A77D" },
-{ 0x00001D7D, U"\U00002C63\U00001D7D\U00002C63" },
-{ 0x00001D8E, U"\U0000A7C6\U00001D8E\U0000A7C6" },
-{ 0x00001E00, U"\U00001E00\U00001E01\U00001E00" },
-{ 0x00001E01, U"\U00001E00\U00001E01\U00001E00" },
-{ 0x00001E02, U"\U00001E02\U00001E03\U00001E02" },
-{ 0x00001E03, U"\U00001E02\U00001E03\U00001E02" },
-{ 0x00001E04, U"\U00001E04\U00001E05\U00001E04" },
-{ 0x00001E05, U"\U00001E04\U00001E05\U00001E04" },
-{ 0x00001E06, U"\U00001E06\U00001E07\U00001E06" },
-{ 0x00001E07, U"\U00001E06\U00001E07\U00001E06" },
-{ 0x00001E08, U"\U00001E08\U00001E09\U00001E08" },
-{ 0x00001E09, U"\U00001E08\U00001E09\U00001E08" },
-{ 0x00001E0A, U"\U00001E0A\U00001E0B\U00001E0A" },
-{ 0x00001E0B, U"\U00001E0A\U00001E0B\U00001E0A" },
-{ 0x00001E0C, U"\U00001E0C\U00001E0D\U00001E0C" },
-{ 0x00001E0D, U"\U00001E0C\U00001E0D\U00001E0C" },
-{ 0x00001E0E, U"\U00001E0E\U00001E0F\U00001E0E" },
-{ 0x00001E0F, U"\U00001E0E\U00001E0F\U00001E0E" },
-{ 0x00001E10, U"\U00001E10\U00001E11\U00001E10" },
-{ 0x00001E11, U"\U00001E10\U00001E11\U00001E10" },
-{ 0x00001E12, U"\U00001E12\U00001E13\U00001E12" },
-{ 0x00001E13, U"\U00001E12\U00001E13\U00001E12" },
-{ 0x00001E14, U"\U00001E14\U00001E15\U00001E14" },
-{ 0x00001E15, U"\U00001E14\U00001E15\U00001E14" },
-{ 0x00001E16, U"\U00001E16\U00001E17\U00001E16" },
-{ 0x00001E17, U"\U00001E16\U00001E17\U00001E16" },
-{ 0x00001E18, U"\U00001E18\U00001E19\U00001E18" },
-{ 0x00001E19, U"\U00001E18\U00001E19\U00001E18" },
-{ 0x00001E1A, U"\U00001E1A\U00001E1B\U00001E1A" },
-{ 0x00001E1B, U"\U00001E1A\U00001E1B\U00001E1A" },
-{ 0x00001E1C, U"\U00001E1C\U00001E1D\U00001E1C" },
-{ 0x00001E1D, U"\U00001E1C\U00001E1D\U00001E1C" },
-{ 0x00001E1E, U"\U00001E1E\U00001E1F\U00001E1E" },
-{ 0x00001E1F, U"\U00001E1E\U00001E1F\U00001E1E" },
-{ 0x00001E20, U"\U00001E20\U00001E21\U00001E20" },
-{ 0x00001E21, U"\U00001E20\U00001E21\U00001E20" },
-{ 0x00001E22, U"\U00001E22\U00001E23\U00001E22" },
-{ 0x00001E23, U"\U00001E22\U00001E23\U00001E22" },
-{ 0x00001E24, U"\U00001E24\U00001E25\U00001E24" },
-{ 0x00001E25, U"\U00001E24\U00001E25\U00001E24" },
-{ 0x00001E26, U"\U00001E26\U00001E27\U00001E26" },
-{ 0x00001E27, U"\U00001E26\U00001E27\U00001E26" },
-{ 0x00001E28, U"\U00001E28\U00001E29\U00001E28" },
-{ 0x00001E29, U"\U00001E28\U00001E29\U00001E28" },
-{ 0x00001E2A, U"\U00001E2A\U00001E2B\U00001E2A" },
-{ 0x00001E2B, U"\U00001E2A\U00001E2B\U00001E2A" },
-{ 0x00001E2C, U"\U00001E2C\U00001E2D\U00001E2C" },
-{ 0x00001E2D, U"\U00001E2C\U00001E2D\U00001E2C" },
-{ 0x00001E2E, U"\U00001E2E\U00001E2F\U00001E2E" },
-{ 0x00001E2F, U"\U00001E2E\U00001E2F\U00001E2E" },
-{ 0x00001E30, U"\U00001E30\U00001E31\U00001E30" },
-{ 0x00001E31, U"\U00001E30\U00001E31\U00001E30" },
-{ 0x00001E32, U"\U00001E32\U00001E33\U00001E32" },
-{ 0x00001E33, U"\U00001E32\U00001E33\U00001E32" },
-{ 0x00001E34, U"\U00001E34\U00001E35\U00001E34" },
-{ 0x00001E35, U"\U00001E34\U00001E35\U00001E34" },
-{ 0x00001E36, U"\U00001E36\U00001E37\U00001E36" },
-{ 0x00001E37, U"\U00001E36\U00001E37\U00001E36" },
-{ 0x00001E38, U"\U00001E38\U00001E39\U00001E38" },
-{ 0x00001E39, U"\U00001E38\U00001E39\U00001E38" },
-{ 0x00001E3A, U"\U00001E3A\U00001E3B\U00001E3A" },
-{ 0x00001E3B, U"\U00001E3A\U00001E3B\U00001E3A" },
-{ 0x00001E3C, U"\U00001E3C\U00001E3D\U00001E3C" },
-{ 0x00001E3D, U"\U00001E3C\U00001E3D\U00001E3C" },
-{ 0x00001E3E, U"\U00001E3E\U00001E3F\U00001E3E" },
-{ 0x00001E3F, U"\U00001E3E\U00001E3F\U00001E3E" },
-{ 0x00001E40, U"\U00001E40\U00001E41\U00001E40" },
-{ 0x00001E41, U"\U00001E40\U00001E41\U00001E40" },
-{ 0x00001E42, U"\U00001E42\U00001E43\U00001E42" },
-{ 0x00001E43, U"\U00001E42\U00001E43\U00001E42" },
-{ 0x00001E44, U"\U00001E44\U00001E45\U00001E44" },
-{ 0x00001E45, U"\U00001E44\U00001E45\U00001E44" },
-{ 0x00001E46, U"\U00001E46\U00001E47\U00001E46" },
-{ 0x00001E47, U"\U00001E46\U00001E47\U00001E46" },
-{ 0x00001E48, U"\U00001E48\U00001E49\U00001E48" },
-{ 0x00001E49, U"\U00001E48\U00001E49\U00001E48" },
-{ 0x00001E4A, U"\U00001E4A\U00001E4B\U00001E4A" },
-{ 0x00001E4B, U"\U00001E4A\U00001E4B\U00001E4A" },
-{ 0x00001E4C, U"\U00001E4C\U00001E4D\U00001E4C" },
-{ 0x00001E4D, U"\U00001E4C\U00001E4D\U00001E4C" },
-{ 0x00001E4E, U"\U00001E4E\U00001E4F\U00001E4E" },
-{ 0x00001E4F, U"\U00001E4E\U00001E4F\U00001E4E" },
-{ 0x00001E50, U"\U00001E50\U00001E51\U00001E50" },
-{ 0x00001E51, U"\U00001E50\U00001E51\U00001E50" },
-{ 0x00001E52, U"\U00001E52\U00001E53\U00001E52" },
-{ 0x00001E53, U"\U00001E52\U00001E53\U00001E52" },
-{ 0x00001E54, U"\U00001E54\U00001E55\U00001E54" },
-{ 0x00001E55, U"\U00001E54\U00001E55\U00001E54" },
-{ 0x00001E56, U"\U00001E56\U00001E57\U00001E56" },
-{ 0x00001E57, U"\U00001E56\U00001E57\U00001E56" },
-{ 0x00001E58, U"\U00001E58\U00001E59\U00001E58" },
-{ 0x00001E59, U"\U00001E58\U00001E59\U00001E58" },
-{ 0x00001E5A, U"\U00001E5A\U00001E5B\U00001E5A" },
-{ 0x00001E5B, U"\U00001E5A\U00001E5B\U00001E5A" },
-{ 0x00001E5C, U"\U00001E5C\U00001E5D\U00001E5C" },
-{ 0x00001E5D, U"\U00001E5C\U00001E5D\U00001E5C" },
-{ 0x00001E5E, U"\U00001E5E\U00001E5F\U00001E5E" },
-{ 0x00001E5F, U"\U00001E5E\U00001E5F\U00001E5E" },
-{ 0x00001E60, U"\U00001E60\U00001E61\U00001E60" },
-{ 0x00001E61, U"\U00001E60\U00001E61\U00001E60" },
-{ 0x00001E62, U"\U00001E62\U00001E63\U00001E62" },
-{ 0x00001E63, U"\U00001E62\U00001E63\U00001E62" },
-{ 0x00001E64, U"\U00001E64\U00001E65\U00001E64" },
-{ 0x00001E65, U"\U00001E64\U00001E65\U00001E64" },
-{ 0x00001E66, U"\U00001E66\U00001E67\U00001E66" },
-{ 0x00001E67, U"\U00001E66\U00001E67\U00001E66" },
-{ 0x00001E68, U"\U00001E68\U00001E69\U00001E68" },
-{ 0x00001E69, U"\U00001E68\U00001E69\U00001E68" },
-{ 0x00001E6A, U"\U00001E6A\U00001E6B\U00001E6A" },
-{ 0x00001E6B, U"\U00001E6A\U00001E6B\U00001E6A" },
-{ 0x00001E6C, U"\U00001E6C\U00001E6D\U00001E6C" },
-{ 0x00001E6D, U"\U00001E6C\U00001E6D\U00001E6C" },
-{ 0x00001E6E, U"\U00001E6E\U00001E6F\U00001E6E" },
-{ 0x00001E6F, U"\U00001E6E\U00001E6F\U00001E6E" },
-{ 0x00001E70, U"\U00001E70\U00001E71\U00001E70" },
-{ 0x00001E71, U"\U00001E70\U00001E71\U00001E70" },
-{ 0x00001E72, U"\U00001E72\U00001E73\U00001E72" },
-{ 0x00001E73, U"\U00001E72\U00001E73\U00001E72" },
-{ 0x00001E74, U"\U00001E74\U00001E75\U00001E74" },
-{ 0x00001E75, U"\U00001E74\U00001E75\U00001E74" },
-{ 0x00001E76, U"\U00001E76\U00001E77\U00001E76" },
-{ 0x00001E77, U"\U00001E76\U00001E77\U00001E76" },
-{ 0x00001E78, U"\U00001E78\U00001E79\U00001E78" },
-{ 0x00001E79, U"\U00001E78\U00001E79\U00001E78" },
-{ 0x00001E7A, U"\U00001E7A\U00001E7B\U00001E7A" },
-{ 0x00001E7B, U"\U00001E7A\U00001E7B\U00001E7A" },
-{ 0x00001E7C, U"\U00001E7C\U00001E7D\U00001E7C" },
-{ 0x00001E7D, U"\U00001E7C\U00001E7D\U00001E7C" },
-{ 0x00001E7E, U"\U00001E7E\U00001E7F\U00001E7E" },
-{ 0x00001E7F, U"\U00001E7E\U00001E7F\U00001E7E" },
-{ 0x00001E80, U"\U00001E80\U00001E81\U00001E80" },
-{ 0x00001E81, U"\U00001E80\U00001E81\U00001E80" },
-{ 0x00001E82, U"\U00001E82\U00001E83\U00001E82" },
-{ 0x00001E83, U"\U00001E82\U00001E83\U00001E82" },
-{ 0x00001E84, U"\U00001E84\U00001E85\U00001E84" },
-{ 0x00001E85, U"\U00001E84\U00001E85\U00001E84" },
-{ 0x00001E86, U"\U00001E86\U00001E87\U00001E86" },
-{ 0x00001E87, U"\U00001E86\U00001E87\U00001E86" },
-{ 0x00001E88, U"\U00001E88\U00001E89\U00001E88" },
-{ 0x00001E89, U"\U00001E88\U00001E89\U00001E88" },
-{ 0x00001E8A, U"\U00001E8A\U00001E8B\U00001E8A" },
-{ 0x00001E8B, U"\U00001E8A\U00001E8B\U00001E8A" },
-{ 0x00001E8C, U"\U00001E8C\U00001E8D\U00001E8C" },
-{ 0x00001E8D, U"\U00001E8C\U00001E8D\U00001E8C" },
-{ 0x00001E8E, U"\U00001E8E\U00001E8F\U00001E8E" },
-{ 0x00001E8F, U"\U00001E8E\U00001E8F\U00001E8E" },
-{ 0x00001E90, U"\U00001E90\U00001E91\U00001E90" },
-{ 0x00001E91, U"\U00001E90\U00001E91\U00001E90" },
-{ 0x00001E92, U"\U00001E92\U00001E93\U00001E92" },
-{ 0x00001E93, U"\U00001E92\U00001E93\U00001E92" },
-{ 0x00001E94, U"\U00001E94\U00001E95\U00001E94" },
-{ 0x00001E95, U"\U00001E94\U00001E95\U00001E94" },
-{ 0x00001E9B, U"\U00001E60\U00001E9B\U00001E60" },
-{ 0x00001E9E, U"\U00001E9E\U000000DF\U00001E9E" },
-{ 0x00001EA0, U"\U00001EA0\U00001EA1\U00001EA0" },
-{ 0x00001EA1, U"\U00001EA0\U00001EA1\U00001EA0" },
-{ 0x00001EA2, U"\U00001EA2\U00001EA3\U00001EA2" },
-{ 0x00001EA3, U"\U00001EA2\U00001EA3\U00001EA2" },
-{ 0x00001EA4, U"\U00001EA4\U00001EA5\U00001EA4" },
-{ 0x00001EA5, U"\U00001EA4\U00001EA5\U00001EA4" },
-{ 0x00001EA6, U"\U00001EA6\U00001EA7\U00001EA6" },
-{ 0x00001EA7, U"\U00001EA6\U00001EA7\U00001EA6" },
-{ 0x00001EA8, U"\U00001EA8\U00001EA9\U00001EA8" },
-{ 0x00001EA9, U"\U00001EA8\U00001EA9\U00001EA8" },
-{ 0x00001EAA, U"\U00001EAA\U00001EAB\U00001EAA" },
-{ 0x00001EAB, U"\U00001EAA\U00001EAB\U00001EAA" },
-{ 0x00001EAC, U"\U00001EAC\U00001EAD\U00001EAC" },
-{ 0x00001EAD, U"\U00001EAC\U00001EAD\U00001EAC" },
-{ 0x00001EAE, U"\U00001EAE\U00001EAF\U00001EAE" },
-{ 0x00001EAF, U"\U00001EAE\U00001EAF\U00001EAE" },
-{ 0x00001EB0, U"\U00001EB0\U00001EB1\U00001EB0" },
-{ 0x00001EB1, U"\U00001EB0\U00001EB1\U00001EB0" },
-{ 0x00001EB2, U"\U00001EB2\U00001EB3\U00001EB2" },
-{ 0x00001EB3, U"\U00001EB2\U00001EB3\U00001EB2" },
-{ 0x00001EB4, U"\U00001EB4\U00001EB5\U00001EB4" },
-{ 0x00001EB5, U"\U00001EB4\U00001EB5\U00001EB4" },
-{ 0x00001EB6, U"\U00001EB6\U00001EB7\U00001EB6" },
-{ 0x00001EB7, U"\U00001EB6\U00001EB7\U00001EB6" },
-{ 0x00001EB8, U"\U00001EB8\U00001EB9\U00001EB8" },
-{ 0x00001EB9, U"\U00001EB8\U00001EB9\U00001EB8" },
-{ 0x00001EBA, U"\U00001EBA\U00001EBB\U00001EBA" },
-{ 0x00001EBB, U"\U00001EBA\U00001EBB\U00001EBA" },
-{ 0x00001EBC, U"\U00001EBC\U00001EBD\U00001EBC" },
-{ 0x00001EBD, U"\U00001EBC\U00001EBD\U00001EBC" },
-{ 0x00001EBE, U"\U00001EBE\U00001EBF\U00001EBE" },
-{ 0x00001EBF, U"\U00001EBE\U00001EBF\U00001EBE" },
-{ 0x00001EC0, U"\U00001EC0\U00001EC1\U00001EC0" },
-{ 0x00001EC1, U"\U00001EC0\U00001EC1\U00001EC0" },
-{ 0x00001EC2, U"\U00001EC2\U00001EC3\U00001EC2" },
-{ 0x00001EC3, U"\U00001EC2\U00001EC3\U00001EC2" },
-{ 0x00001EC4, U"\U00001EC4\U00001EC5\U00001EC4" },
-{ 0x00001EC5, U"\U00001EC4\U00001EC5\U00001EC4" },
-{ 0x00001EC6, U"\U00001EC6\U00001EC7\U00001EC6" },
-{ 0x00001EC7, U"\U00001EC6\U00001EC7\U00001EC6" },
-{ 0x00001EC8, U"\U00001EC8\U00001EC9\U00001EC8" },
-{ 0x00001EC9, U"\U00001EC8\U00001EC9\U00001EC8" },
-{ 0x00001ECA, U"\U00001ECA\U00001ECB\U00001ECA" },
-{ 0x00001ECB, U"\U00001ECA\U00001ECB\U00001ECA" },
-{ 0x00001ECC, U"\U00001ECC\U00001ECD\U00001ECC" },
-{ 0x00001ECD, U"\U00001ECC\U00001ECD\U00001ECC" },
-{ 0x00001ECE, U"\U00001ECE\U00001ECF\U00001ECE" },
-{ 0x00001ECF, U"\U00001ECE\U00001ECF\U00001ECE" },
-{ 0x00001ED0, U"\U00001ED0\U00001ED1\U00001ED0" },
-{ 0x00001ED1, U"\U00001ED0\U00001ED1\U00001ED0" },
-{ 0x00001ED2, U"\U00001ED2\U00001ED3\U00001ED2" },
-{ 0x00001ED3, U"\U00001ED2\U00001ED3\U00001ED2" },
-{ 0x00001ED4, U"\U00001ED4\U00001ED5\U00001ED4" },
-{ 0x00001ED5, U"\U00001ED4\U00001ED5\U00001ED4" },
-{ 0x00001ED6, U"\U00001ED6\U00001ED7\U00001ED6" },
-{ 0x00001ED7, U"\U00001ED6\U00001ED7\U00001ED6" },
-{ 0x00001ED8, U"\U00001ED8\U00001ED9\U00001ED8" },
-{ 0x00001ED9, U"\U00001ED8\U00001ED9\U00001ED8" },
-{ 0x00001EDA, U"\U00001EDA\U00001EDB\U00001EDA" },
-{ 0x00001EDB, U"\U00001EDA\U00001EDB\U00001EDA" },
-{ 0x00001EDC, U"\U00001EDC\U00001EDD\U00001EDC" },
-{ 0x00001EDD, U"\U00001EDC\U00001EDD\U00001EDC" },
-{ 0x00001EDE, U"\U00001EDE\U00001EDF\U00001EDE" },
-{ 0x00001EDF, U"\U00001EDE\U00001EDF\U00001EDE" },
-{ 0x00001EE0, U"\U00001EE0\U00001EE1\U00001EE0" },
-{ 0x00001EE1, U"\U00001EE0\U00001EE1\U00001EE0" },
-{ 0x00001EE2, U"\U00001EE2\U00001EE3\U00001EE2" },
-{ 0x00001EE3, U"\U00001EE2\U00001EE3\U00001EE2" },
-{ 0x00001EE4, U"\U00001EE4\U00001EE5\U00001EE4" },
-{ 0x00001EE5, U"\U00001EE4\U00001EE5\U00001EE4" },
-{ 0x00001EE6, U"\U00001EE6\U00001EE7\U00001EE6" },
-{ 0x00001EE7, U"\U00001EE6\U00001EE7\U00001EE6" },
-{ 0x00001EE8, U"\U00001EE8\U00001EE9\U00001EE8" },
-{ 0x00001EE9, U"\U00001EE8\U00001EE9\U00001EE8" },
-{ 0x00001EEA, U"\U00001EEA\U00001EEB\U00001EEA" },
-{ 0x00001EEB, U"\U00001EEA\U00001EEB\U00001EEA" },
-{ 0x00001EEC, U"\U00001EEC\U00001EED\U00001EEC" },
-{ 0x00001EED, U"\U00001EEC\U00001EED\U00001EEC" },
-{ 0x00001EEE, U"\U00001EEE\U00001EEF\U00001EEE" },
-{ 0x00001EEF, U"\U00001EEE\U00001EEF\U00001EEE" },
-{ 0x00001EF0, U"\U00001EF0\U00001EF1\U00001EF0" },
-{ 0x00001EF1, U"\U00001EF0\U00001EF1\U00001EF0" },
-{ 0x00001EF2, U"\U00001EF2\U00001EF3\U00001EF2" },
-{ 0x00001EF3, U"\U00001EF2\U00001EF3\U00001EF2" },
-{ 0x00001EF4, U"\U00001EF4\U00001EF5\U00001EF4" },
-{ 0x00001EF5, U"\U00001EF4\U00001EF5\U00001EF4" },
-{ 0x00001EF6, U"\U00001EF6\U00001EF7\U00001EF6" },
-{ 0x00001EF7, U"\U00001EF6\U00001EF7\U00001EF6" },
-{ 0x00001EF8, U"\U00001EF8\U00001EF9\U00001EF8" },
-{ 0x00001EF9, U"\U00001EF8\U00001EF9\U00001EF8" },
-{ 0x00001EFA, U"\U00001EFA\U00001EFB\U00001EFA" },
-{ 0x00001EFB, U"\U00001EFA\U00001EFB\U00001EFA" },
-{ 0x00001EFC, U"\U00001EFC\U00001EFD\U00001EFC" },
-{ 0x00001EFD, U"\U00001EFC\U00001EFD\U00001EFC" },
-{ 0x00001EFE, U"\U00001EFE\U00001EFF\U00001EFE" },
-{ 0x00001EFF, U"\U00001EFE\U00001EFF\U00001EFE" },
-{ 0x00001F00, U"\U00001F08\U00001F00\U00001F08" },
-{ 0x00001F01, U"\U00001F09\U00001F01\U00001F09" },
-{ 0x00001F02, U"\U00001F0A\U00001F02\U00001F0A" },
-{ 0x00001F03, U"\U00001F0B\U00001F03\U00001F0B" },
-{ 0x00001F04, U"\U00001F0C\U00001F04\U00001F0C" },
-{ 0x00001F05, U"\U00001F0D\U00001F05\U00001F0D" },
-{ 0x00001F06, U"\U00001F0E\U00001F06\U00001F0E" },
-{ 0x00001F07, U"\U00001F0F\U00001F07\U00001F0F" },
-{ 0x00001F08, U"\U00001F08\U00001F00\U00001F08" },
-{ 0x00001F09, U"\U00001F09\U00001F01\U00001F09" },
-{ 0x00001F0A, U"\U00001F0A\U00001F02\U00001F0A" },
-{ 0x00001F0B, U"\U00001F0B\U00001F03\U00001F0B" },
-{ 0x00001F0C, U"\U00001F0C\U00001F04\U00001F0C" },
-{ 0x00001F0D, U"\U00001F0D\U00001F05\U00001F0D" },
-{ 0x00001F0E, U"\U00001F0E\U00001F06\U00001F0E" },
-{ 0x00001F0F, U"\U00001F0F\U00001F07\U00001F0F" },
-{ 0x00001F10, U"\U00001F18\U00001F10\U00001F18" },
-{ 0x00001F11, U"\U00001F19\U00001F11\U00001F19" },
-{ 0x00001F12, U"\U00001F1A\U00001F12\U00001F1A" },
-{ 0x00001F13, U"\U00001F1B\U00001F13\U00001F1B" },
-{ 0x00001F14, U"\U00001F1C\U00001F14\U00001F1C" },
-{ 0x00001F15, U"\U00001F1D\U00001F15\U00001F1D" },
-{ 0x00001F18, U"\U00001F18\U00001F10\U00001F18" },
-{ 0x00001F19, U"\U00001F19\U00001F11\U00001F19" },
-{ 0x00001F1A, U"\U00001F1A\U00001F12\U00001F1A" },
-{ 0x00001F1B, U"\U00001F1B\U00001F13\U00001F1B" },
-{ 0x00001F1C, U"\U00001F1C\U00001F14\U00001F1C" },
-{ 0x00001F1D, U"\U00001F1D\U00001F15\U00001F1D" },
-{ 0x00001F20, U"\U00001F28\U00001F20\U00001F28" },
-{ 0x00001F21, U"\U00001F29\U00001F21\U00001F29" },
-{ 0x00001F22, U"\U00001F2A\U00001F22\U00001F2A" },
-{ 0x00001F23, U"\U00001F2B\U00001F23\U00001F2B" },
-{ 0x00001F24, U"\U00001F2C\U00001F24\U00001F2C" },
-{ 0x00001F25, U"\U00001F2D\U00001F25\U00001F2D" },
-{ 0x00001F26, U"\U00001F2E\U00001F26\U00001F2E" },
-{ 0x00001F27, U"\U00001F2F\U00001F27\U00001F2F" },
-{ 0x00001F28, U"\U00001F28\U00001F20\U00001F28" },
-{ 0x00001F29, U"\U00001F29\U00001F21\U00001F29" },
-{ 0x00001F2A, U"\U00001F2A\U00001F22\U00001F2A" },
-{ 0x00001F2B, U"\U00001F2B\U00001F23\U00001F2B" },
-{ 0x00001F2C, U"\U00001F2C\U00001F24\U00001F2C" },
-{ 0x00001F2D, U"\U00001F2D\U00001F25\U00001F2D" },
-{ 0x00001F2E, U"\U00001F2E\U00001F26\U00001F2E" },
-{ 0x00001F2F, U"\U00001F2F\U00001F27\U00001F2F" },
-{ 0x00001F30, U"\U00001F38\U00001F30\U00001F38" },
-{ 0x00001F31, U"\U00001F39\U00001F31\U00001F39" },
-{ 0x00001F32, U"\U00001F3A\U00001F32\U00001F3A" },
-{ 0x00001F33, U"\U00001F3B\U00001F33\U00001F3B" },
-{ 0x00001F34, U"\U00001F3C\U00001F34\U00001F3C" },
-{ 0x00001F35, U"\U00001F3D\U00001F35\U00001F3D" },
-{ 0x00001F36, U"\U00001F3E\U00001F36\U00001F3E" },
-{ 0x00001F37, U"\U00001F3F\U00001F37\U00001F3F" },
-{ 0x00001F38, U"\U00001F38\U00001F30\U00001F38" },
-{ 0x00001F39, U"\U00001F39\U00001F31\U00001F39" },
-{ 0x00001F3A, U"\U00001F3A\U00001F32\U00001F3A" },
-{ 0x00001F3B, U"\U00001F3B\U00001F33\U00001F3B" },
-{ 0x00001F3C, U"\U00001F3C\U00001F34\U00001F3C" },
-{ 0x00001F3D, U"\U00001F3D\U00001F35\U00001F3D" },
-{ 0x00001F3E, U"\U00001F3E\U00001F36\U00001F3E" },
-{ 0x00001F3F, U"\U00001F3F\U00001F37\U00001F3F" },
-{ 0x00001F40, U"\U00001F48\U00001F40\U00001F48" },
-{ 0x00001F41, U"\U00001F49\U00001F41\U00001F49" },
-{ 0x00001F42, U"\U00001F4A\U00001F42\U00001F4A" },
-{ 0x00001F43, U"\U00001F4B\U00001F43\U00001F4B" },
-{ 0x00001F44, U"\U00001F4C\U00001F44\U00001F4C" },
-{ 0x00001F45, U"\U00001F4D\U00001F45\U00001F4D" },
-{ 0x00001F48, U"\U00001F48\U00001F40\U00001F48" },
-{ 0x00001F49, U"\U00001F49\U00001F41\U00001F49" },
-{ 0x00001F4A, U"\U00001F4A\U00001F42\U00001F4A" },
-{ 0x00001F4B, U"\U00001F4B\U00001F43\U00001F4B" },
-{ 0x00001F4C, U"\U00001F4C\U00001F44\U00001F4C" },
-{ 0x00001F4D, U"\U00001F4D\U00001F45\U00001F4D" },
-{ 0x00001F51, U"\U00001F59\U00001F51\U00001F59" },
-{ 0x00001F53, U"\U00001F5B\U00001F53\U00001F5B" },
-{ 0x00001F55, U"\U00001F5D\U00001F55\U00001F5D" },
-{ 0x00001F57, U"\U00001F5F\U00001F57\U00001F5F" },
-{ 0x00001F59, U"\U00001F59\U00001F51\U00001F59" },
-{ 0x00001F5B, U"\U00001F5B\U00001F53\U00001F5B" },
-{ 0x00001F5D, U"\U00001F5D\U00001F55\U00001F5D" },
-{ 0x00001F5F, U"\U00001F5F\U00001F57\U00001F5F" },
-{ 0x00001F60, U"\U00001F68\U00001F60\U00001F68" },
-{ 0x00001F61, U"\U00001F69\U00001F61\U00001F69" },
-{ 0x00001F62, U"\U00001F6A\U00001F62\U00001F6A" },
-{ 0x00001F63, U"\U00001F6B\U00001F63\U00001F6B" },
-{ 0x00001F64, U"\U00001F6C\U00001F64\U00001F6C" },
-{ 0x00001F65, U"\U00001F6D\U00001F65\U00001F6D" },
-{ 0x00001F66, U"\U00001F6E\U00001F66\U00001F6E" },
-{ 0x00001F67, U"\U00001F6F\U00001F67\U00001F6F" },
-{ 0x00001F68, U"\U00001F68\U00001F60\U00001F68" },
-{ 0x00001F69, U"\U00001F69\U00001F61\U00001F69" },
-{ 0x00001F6A, U"\U00001F6A\U00001F62\U00001F6A" },
-{ 0x00001F6B, U"\U00001F6B\U00001F63\U00001F6B" },
-{ 0x00001F6C, U"\U00001F6C\U00001F64\U00001F6C" },
-{ 0x00001F6D, U"\U00001F6D\U00001F65\U00001F6D" },
-{ 0x00001F6E, U"\U00001F6E\U00001F66\U00001F6E" },
-{ 0x00001F6F, U"\U00001F6F\U00001F67\U00001F6F" },
-{ 0x00001F70, U"\U00001FBA\U00001F70\U00001FBA" },
-{ 0x00001F71, U"\U00001FBB\U00001F71\U00001FBB" },
-{ 0x00001F72, U"\U00001FC8\U00001F72\U00001FC8" },
-{ 0x00001F73, U"\U00001FC9\U00001F73\U00001FC9" },
-{ 0x00001F74, U"\U00001FCA\U00001F74\U00001FCA" },
-{ 0x00001F75, U"\U00001FCB\U00001F75\U00001FCB" },
-{ 0x00001F76, U"\U00001FDA\U00001F76\U00001FDA" },
-{ 0x00001F77, U"\U00001FDB\U00001F77\U00001FDB" },
-{ 0x00001F78, U"\U00001FF8\U00001F78\U00001FF8" },
-{ 0x00001F79, U"\U00001FF9\U00001F79\U00001FF9" },
-{ 0x00001F7A, U"\U00001FEA\U00001F7A\U00001FEA" },
-{ 0x00001F7B, U"\U00001FEB\U00001F7B\U00001FEB" },
-{ 0x00001F7C, U"\U00001FFA\U00001F7C\U00001FFA" },
-{ 0x00001F7D, U"\U00001FFB\U00001F7D\U00001FFB" },
-{ 0x00001F80, U"\U00001F88\U00001F80\U00001F88" },
-{ 0x00001F81, U"\U00001F89\U00001F81\U00001F89" },
-{ 0x00001F82, U"\U00001F8A\U00001F82\U00001F8A" },
-{ 0x00001F83, U"\U00001F8B\U00001F83\U00001F8B" },
-{ 0x00001F84, U"\U00001F8C\U00001F84\U00001F8C" },
-{ 0x00001F85, U"\U00001F8D\U00001F85\U00001F8D" },
-{ 0x00001F86, U"\U00001F8E\U00001F86\U00001F8E" },
-{ 0x00001F87, U"\U00001F8F\U00001F87\U00001F8F" },
-{ 0x00001F88, U"\U00001F88\U00001F80\U00001F88" },
-{ 0x00001F89, U"\U00001F89\U00001F81\U00001F89" },
-{ 0x00001F8A, U"\U00001F8A\U00001F82\U00001F8A" },
-{ 0x00001F8B, U"\U00001F8B\U00001F83\U00001F8B" },
-{ 0x00001F8C, U"\U00001F8C\U00001F84\U00001F8C" },
-{ 0x00001F8D, U"\U00001F8D\U00001F85\U00001F8D" },
-{ 0x00001F8E, U"\U00001F8E\U00001F86\U00001F8E" },
-{ 0x00001F8F, U"\U00001F8F\U00001F87\U00001F8F" },
-{ 0x00001F90, U"\U00001F98\U00001F90\U00001F98" },
-{ 0x00001F91, U"\U00001F99\U00001F91\U00001F99" },
-{ 0x00001F92, U"\U00001F9A\U00001F92\U00001F9A" },
-{ 0x00001F93, U"\U00001F9B\U00001F93\U00001F9B" },
-{ 0x00001F94, U"\U00001F9C\U00001F94\U00001F9C" },
-{ 0x00001F95, U"\U00001F9D\U00001F95\U00001F9D" },
-{ 0x00001F96, U"\U00001F9E\U00001F96\U00001F9E" },
-{ 0x00001F97, U"\U00001F9F\U00001F97\U00001F9F" },
-{ 0x00001F98, U"\U00001F98\U00001F90\U00001F98" },
-{ 0x00001F99, U"\U00001F99\U00001F91\U00001F99" },
-{ 0x00001F9A, U"\U00001F9A\U00001F92\U00001F9A" },
-{ 0x00001F9B, U"\U00001F9B\U00001F93\U00001F9B" },
-{ 0x00001F9C, U"\U00001F9C\U00001F94\U00001F9C" },
-{ 0x00001F9D, U"\U00001F9D\U00001F95\U00001F9D" },
-{ 0x00001F9E, U"\U00001F9E\U00001F96\U00001F9E" },
-{ 0x00001F9F, U"\U00001F9F\U00001F97\U00001F9F" },
-{ 0x00001FA0, U"\U00001FA8\U00001FA0\U00001FA8" },
-{ 0x00001FA1, U"\U00001FA9\U00001FA1\U00001FA9" },
-{ 0x00001FA2, U"\U00001FAA\U00001FA2\U00001FAA" },
-{ 0x00001FA3, U"\U00001FAB\U00001FA3\U00001FAB" },
-{ 0x00001FA4, U"\U00001FAC\U00001FA4\U00001FAC" },
-{ 0x00001FA5, U"\U00001FAD\U00001FA5\U00001FAD" },
-{ 0x00001FA6, U"\U00001FAE\U00001FA6\U00001FAE" },
-{ 0x00001FA7, U"\U00001FAF\U00001FA7\U00001FAF" },
-{ 0x00001FA8, U"\U00001FA8\U00001FA0\U00001FA8" },
-{ 0x00001FA9, U"\U00001FA9\U00001FA1\U00001FA9" },
-{ 0x00001FAA, U"\U00001FAA\U00001FA2\U00001FAA" },
-{ 0x00001FAB, U"\U00001FAB\U00001FA3\U00001FAB" },
-{ 0x00001FAC, U"\U00001FAC\U00001FA4\U00001FAC" },
-{ 0x00001FAD, U"\U00001FAD\U00001FA5\U00001FAD" },
-{ 0x00001FAE, U"\U00001FAE\U00001FA6\U00001FAE" },
-{ 0x00001FAF, U"\U00001FAF\U00001FA7\U00001FAF" },
-{ 0x00001FB0, U"\U00001FB8\U00001FB0\U00001FB8" },
-{ 0x00001FB1, U"\U00001FB9\U00001FB1\U00001FB9" },
-{ 0x00001FB3, U"\U00001FBC\U00001FB3\U00001FBC" },
-{ 0x00001FB8, U"\U00001FB8\U00001FB0\U00001FB8" },
-{ 0x00001FB9, U"\U00001FB9\U00001FB1\U00001FB9" },
-{ 0x00001FBA, U"\U00001FBA\U00001F70\U00001FBA" },
-{ 0x00001FBB, U"\U00001FBB\U00001F71\U00001FBB" },
-{ 0x00001FBC, U"\U00001FBC\U00001FB3\U00001FBC" },
-{ 0x00001FBE, U"\U00000399\U00001FBE\U00000399" },
-{ 0x00001FC3, U"\U00001FCC\U00001FC3\U00001FCC" },
-{ 0x00001FC8, U"\U00001FC8\U00001F72\U00001FC8" },
-{ 0x00001FC9, U"\U00001FC9\U00001F73\U00001FC9" },
-{ 0x00001FCA, U"\U00001FCA\U00001F74\U00001FCA" },
-{ 0x00001FCB, U"\U00001FCB\U00001F75\U00001FCB" },
-{ 0x00001FCC, U"\U00001FCC\U00001FC3\U00001FCC" },
-{ 0x00001FD0, U"\U00001FD8\U00001FD0\U00001FD8" },
-{ 0x00001FD1, U"\U00001FD9\U00001FD1\U00001FD9" },
-{ 0x00001FD8, U"\U00001FD8\U00001FD0\U00001FD8" },
-{ 0x00001FD9, U"\U00001FD9\U00001FD1\U00001FD9" },
-{ 0x00001FDA, U"\U00001FDA\U00001F76\U00001FDA" },
-{ 0x00001FDB, U"\U00001FDB\U00001F77\U00001FDB" },
-{ 0x00001FE0, U"\U00001FE8\U00001FE0\U00001FE8" },
-{ 0x00001FE1, U"\U00001FE9\U00001FE1\U00001FE9" },
-{ 0x00001FE5, U"\U00001FEC\U00001FE5\U00001FEC" },
-{ 0x00001FE8, U"\U00001FE8\U00001FE0\U00001FE8" },
-{ 0x00001FE9, U"\U00001FE9\U00001FE1\U00001FE9" },
-{ 0x00001FEA, U"\U00001FEA\U00001F7A\U00001FEA" },
-{ 0x00001FEB, U"\U00001FEB\U00001F7B\U00001FEB" },
-{ 0x00001FEC, U"\U00001FEC\U00001FE5\U00001FEC" },
-{ 0x00001FF3, U"\U00001FFC\U00001FF3\U00001FFC" },
-{ 0x00001FF8, U"\U00001FF8\U00001F78\U00001FF8" },
-{ 0x00001FF9, U"\U00001FF9\U00001F79\U00001FF9" },
-{ 0x00001FFA, U"\U00001FFA\U00001F7C\U00001FFA" },
-{ 0x00001FFB, U"\U00001FFB\U00001F7D\U00001FFB" },
-{ 0x00001FFC, U"\U00001FFC\U00001FF3\U00001FFC" },
-{ 0x00002126, U"\U00002126\U000003C9\U00002126" },
-{ 0x0000212A, U"\U0000212A\U0000006B\U0000212A" },
-{ 0x0000212B, U"\U0000212B\U000000E5\U0000212B" },
-{ 0x00002132, U"\U00002132\U0000214E\U00002132" },
-{ 0x0000214E, U"\U00002132\U0000214E\U00002132" },
-{ 0x00002160, U"\U00002160\U00002170\U00002160" },
-{ 0x00002161, U"\U00002161\U00002171\U00002161" },
-{ 0x00002162, U"\U00002162\U00002172\U00002162" },
-{ 0x00002163, U"\U00002163\U00002173\U00002163" },
-{ 0x00002164, U"\U00002164\U00002174\U00002164" },
-{ 0x00002165, U"\U00002165\U00002175\U00002165" },
-{ 0x00002166, U"\U00002166\U00002176\U00002166" },
-{ 0x00002167, U"\U00002167\U00002177\U00002167" },
-{ 0x00002168, U"\U00002168\U00002178\U00002168" },
-{ 0x00002169, U"\U00002169\U00002179\U00002169" },
-{ 0x0000216A, U"\U0000216A\U0000217A\U0000216A" },
-{ 0x0000216B, U"\U0000216B\U0000217B\U0000216B" },
-{ 0x0000216C, U"\U0000216C\U0000217C\U0000216C" },
-{ 0x0000216D, U"\U0000216D\U0000217D\U0000216D" },
-{ 0x0000216E, U"\U0000216E\U0000217E\U0000216E" },
-{ 0x0000216F, U"\U0000216F\U0000217F\U0000216F" },
-{ 0x00002170, U"\U00002160\U00002170\U00002160" },
-{ 0x00002171, U"\U00002161\U00002171\U00002161" },
-{ 0x00002172, U"\U00002162\U00002172\U00002162" },
-{ 0x00002173, U"\U00002163\U00002173\U00002163" },
-{ 0x00002174, U"\U00002164\U00002174\U00002164" },
-{ 0x00002175, U"\U00002165\U00002175\U00002165" },
-{ 0x00002176, U"\U00002166\U00002176\U00002166" },
-{ 0x00002177, U"\U00002167\U00002177\U00002167" },
-{ 0x00002178, U"\U00002168\U00002178\U00002168" },
-{ 0x00002179, U"\U00002169\U00002179\U00002169" },
-{ 0x0000217A, U"\U0000216A\U0000217A\U0000216A" },
-{ 0x0000217B, U"\U0000216B\U0000217B\U0000216B" },
-{ 0x0000217C, U"\U0000216C\U0000217C\U0000216C" },
-{ 0x0000217D, U"\U0000216D\U0000217D\U0000216D" },
-{ 0x0000217E, U"\U0000216E\U0000217E\U0000216E" },
-{ 0x0000217F, U"\U0000216F\U0000217F\U0000216F" },
-{ 0x00002183, U"\U00002183\U00002184\U00002183" },
-{ 0x00002184, U"\U00002183\U00002184\U00002183" },
-{ 0x000024B6, U"\U000024B6\U000024D0\U000024B6" },
-{ 0x000024B7, U"\U000024B7\U000024D1\U000024B7" },
-{ 0x000024B8, U"\U000024B8\U000024D2\U000024B8" },
-{ 0x000024B9, U"\U000024B9\U000024D3\U000024B9" },
-{ 0x000024BA, U"\U000024BA\U000024D4\U000024BA" },
-{ 0x000024BB, U"\U000024BB\U000024D5\U000024BB" },
-{ 0x000024BC, U"\U000024BC\U000024D6\U000024BC" },
-{ 0x000024BD, U"\U000024BD\U000024D7\U000024BD" },
-{ 0x000024BE, U"\U000024BE\U000024D8\U000024BE" },
-{ 0x000024BF, U"\U000024BF\U000024D9\U000024BF" },
-{ 0x000024C0, U"\U000024C0\U000024DA\U000024C0" },
-{ 0x000024C1, U"\U000024C1\U000024DB\U000024C1" },
-{ 0x000024C2, U"\U000024C2\U000024DC\U000024C2" },
-{ 0x000024C3, U"\U000024C3\U000024DD\U000024C3" },
-{ 0x000024C4, U"\U000024C4\U000024DE\U000024C4" },
-{ 0x000024C5, U"\U000024C5\U000024DF\U000024C5" },
-{ 0x000024C6, U"\U000024C6\U000024E0\U000024C6" },
-{ 0x000024C7, U"\U000024C7\U000024E1\U000024C7" },
-{ 0x000024C8, U"\U000024C8\U000024E2\U000024C8" },
-{ 0x000024C9, U"\U000024C9\U000024E3\U000024C9" },
-{ 0x000024CA, U"\U000024CA\U000024E4\U000024CA" },
-{ 0x000024CB, U"\U000024CB\U000024E5\U000024CB" },
-{ 0x000024CC, U"\U000024CC\U000024E6\U000024CC" },
-{ 0x000024CD, U"\U000024CD\U000024E7\U000024CD" },
-{ 0x000024CE, U"\U000024CE\U000024E8\U000024CE" },
-{ 0x000024CF, U"\U000024CF\U000024E9\U000024CF" },
-{ 0x000024D0, U"\U000024B6\U000024D0\U000024B6" },
-{ 0x000024D1, U"\U000024B7\U000024D1\U000024B7" },
-{ 0x000024D2, U"\U000024B8\U000024D2\U000024B8" },
-{ 0x000024D3, U"\U000024B9\U000024D3\U000024B9" },
-{ 0x000024D4, U"\U000024BA\U000024D4\U000024BA" },
-{ 0x000024D5, U"\U000024BB\U000024D5\U000024BB" },
-{ 0x000024D6, U"\U000024BC\U000024D6\U000024BC" },
-{ 0x000024D7, U"\U000024BD\U000024D7\U000024BD" },
-{ 0x000024D8, U"\U000024BE\U000024D8\U000024BE" },
-{ 0x000024D9, U"\U000024BF\U000024D9\U000024BF" },
-{ 0x000024DA, U"\U000024C0\U000024DA\U000024C0" },
-{ 0x000024DB, U"\U000024C1\U000024DB\U000024C1" },
-{ 0x000024DC, U"\U000024C2\U000024DC\U000024C2" },
-{ 0x000024DD, U"\U000024C3\U000024DD\U000024C3" },
-{ 0x000024DE, U"\U000024C4\U000024DE\U000024C4" },
-{ 0x000024DF, U"\U000024C5\U000024DF\U000024C5" },
-{ 0x000024E0, U"\U000024C6\U000024E0\U000024C6" },
-{ 0x000024E1, U"\U000024C7\U000024E1\U000024C7" },
-{ 0x000024E2, U"\U000024C8\U000024E2\U000024C8" },
-{ 0x000024E3, U"\U000024C9\U000024E3\U000024C9" },
-{ 0x000024E4, U"\U000024CA\U000024E4\U000024CA" },
-{ 0x000024E5, U"\U000024CB\U000024E5\U000024CB" },
-{ 0x000024E6, U"\U000024CC\U000024E6\U000024CC" },
-{ 0x000024E7, U"\U000024CD\U000024E7\U000024CD" },
-{ 0x000024E8, U"\U000024CE\U000024E8\U000024CE" },
-{ 0x000024E9, U"\U000024CF\U000024E9\U000024CF" },
-{ 0x00002C00, U"\U00002C00\U00002C30\U00002C00" },
-{ 0x00002C01, U"\U00002C01\U00002C31\U00002C01" },
-{ 0x00002C02, U"\U00002C02\U00002C32\U00002C02" },
-{ 0x00002C03, U"\U00002C03\U00002C33\U00002C03" },
-{ 0x00002C04, U"\U00002C04\U00002C34\U00002C04" },
-{ 0x00002C05, U"\U00002C05\U00002C35\U00002C05" },
-{ 0x00002C06, U"\U00002C06\U00002C36\U00002C06" },
-{ 0x00002C07, U"\U00002C07\U00002C37\U00002C07" },
-{ 0x00002C08, U"\U00002C08\U00002C38\U00002C08" },
-{ 0x00002C09, U"\U00002C09\U00002C39\U00002C09" },
-{ 0x00002C0A, U"\U00002C0A\U00002C3A\U00002C0A" },
-{ 0x00002C0B, U"\U00002C0B\U00002C3B\U00002C0B" },
-{ 0x00002C0C, U"\U00002C0C\U00002C3C\U00002C0C" },
-{ 0x00002C0D, U"\U00002C0D\U00002C3D\U00002C0D" },
-{ 0x00002C0E, U"\U00002C0E\U00002C3E\U00002C0E" },
-{ 0x00002C0F, U"\U00002C0F\U00002C3F\U00002C0F" },
-{ 0x00002C10, U"\U00002C10\U00002C40\U00002C10" },
-{ 0x00002C11, U"\U00002C11\U00002C41\U00002C11" },
-{ 0x00002C12, U"\U00002C12\U00002C42\U00002C12" },
-{ 0x00002C13, U"\U00002C13\U00002C43\U00002C13" },
-{ 0x00002C14, U"\U00002C14\U00002C44\U00002C14" },
-{ 0x00002C15, U"\U00002C15\U00002C45\U00002C15" },
-{ 0x00002C16, U"\U00002C16\U00002C46\U00002C16" },
-{ 0x00002C17, U"\U00002C17\U00002C47\U00002C17" },
-{ 0x00002C18, U"\U00002C18\U00002C48\U00002C18" },
-{ 0x00002C19, U"\U00002C19\U00002C49\U00002C19" },
-{ 0x00002C1A, U"\U00002C1A\U00002C4A\U00002C1A" },
-{ 0x00002C1B, U"\U00002C1B\U00002C4B\U00002C1B" },
-{ 0x00002C1C, U"\U00002C1C\U00002C4C\U00002C1C" },
-{ 0x00002C1D, U"\U00002C1D\U00002C4D\U00002C1D" },
-{ 0x00002C1E, U"\U00002C1E\U00002C4E\U00002C1E" },
-{ 0x00002C1F, U"\U00002C1F\U00002C4F\U00002C1F" },
-{ 0x00002C20, U"\U00002C20\U00002C50\U00002C20" },
-{ 0x00002C21, U"\U00002C21\U00002C51\U00002C21" },
-{ 0x00002C22, U"\U00002C22\U00002C52\U00002C22" },
-{ 0x00002C23, U"\U00002C23\U00002C53\U00002C23" },
-{ 0x00002C24, U"\U00002C24\U00002C54\U00002C24" },
-{ 0x00002C25, U"\U00002C25\U00002C55\U00002C25" },
-{ 0x00002C26, U"\U00002C26\U00002C56\U00002C26" },
-{ 0x00002C27, U"\U00002C27\U00002C57\U00002C27" },
-{ 0x00002C28, U"\U00002C28\U00002C58\U00002C28" },
-{ 0x00002C29, U"\U00002C29\U00002C59\U00002C29" },
-{ 0x00002C2A, U"\U00002C2A\U00002C5A\U00002C2A" },
-{ 0x00002C2B, U"\U00002C2B\U00002C5B\U00002C2B" },
-{ 0x00002C2C, U"\U00002C2C\U00002C5C\U00002C2C" },
-{ 0x00002C2D, U"\U00002C2D\U00002C5D\U00002C2D" },
-{ 0x00002C2E, U"\U00002C2E\U00002C5E\U00002C2E" },
-{ 0x00002C30, U"\U00002C00\U00002C30\U00002C00" },
-{ 0x00002C31, U"\U00002C01\U00002C31\U00002C01" },
-{ 0x00002C32, U"\U00002C02\U00002C32\U00002C02" },
-{ 0x00002C33, U"\U00002C03\U00002C33\U00002C03" },
-{ 0x00002C34, U"\U00002C04\U00002C34\U00002C04" },
-{ 0x00002C35, U"\U00002C05\U00002C35\U00002C05" },
-{ 0x00002C36, U"\U00002C06\U00002C36\U00002C06" },
-{ 0x00002C37, U"\U00002C07\U00002C37\U00002C07" },
-{ 0x00002C38, U"\U00002C08\U00002C38\U00002C08" },
-{ 0x00002C39, U"\U00002C09\U00002C39\U00002C09" },
-{ 0x00002C3A, U"\U00002C0A\U00002C3A\U00002C0A" },
-{ 0x00002C3B, U"\U00002C0B\U00002C3B\U00002C0B" },
-{ 0x00002C3C, U"\U00002C0C\U00002C3C\U00002C0C" },
-{ 0x00002C3D, U"\U00002C0D\U00002C3D\U00002C0D" },
-{ 0x00002C3E, U"\U00002C0E\U00002C3E\U00002C0E" },
-{ 0x00002C3F, U"\U00002C0F\U00002C3F\U00002C0F" },
-{ 0x00002C40, U"\U00002C10\U00002C40\U00002C10" },
-{ 0x00002C41, U"\U00002C11\U00002C41\U00002C11" },
-{ 0x00002C42, U"\U00002C12\U00002C42\U00002C12" },
-{ 0x00002C43, U"\U00002C13\U00002C43\U00002C13" },
-{ 0x00002C44, U"\U00002C14\U00002C44\U00002C14" },
-{ 0x00002C45, U"\U00002C15\U00002C45\U00002C15" },
-{ 0x00002C46, U"\U00002C16\U00002C46\U00002C16" },
-{ 0x00002C47, U"\U00002C17\U00002C47\U00002C17" },
-{ 0x00002C48, U"\U00002C18\U00002C48\U00002C18" },
-{ 0x00002C49, U"\U00002C19\U00002C49\U00002C19" },
-{ 0x00002C4A, U"\U00002C1A\U00002C4A\U00002C1A" },
-{ 0x00002C4B, U"\U00002C1B\U00002C4B\U00002C1B" },
-{ 0x00002C4C, U"\U00002C1C\U00002C4C\U00002C1C" },
-{ 0x00002C4D, U"\U00002C1D\U00002C4D\U00002C1D" },
-{ 0x00002C4E, U"\U00002C1E\U00002C4E\U00002C1E" },
-{ 0x00002C4F, U"\U00002C1F\U00002C4F\U00002C1F" },
-{ 0x00002C50, U"\U00002C20\U00002C50\U00002C20" },
-{ 0x00002C51, U"\U00002C21\U00002C51\U00002C21" },
-{ 0x00002C52, U"\U00002C22\U00002C52\U00002C22" },
-{ 0x00002C53, U"\U00002C23\U00002C53\U00002C23" },
-{ 0x00002C54, U"\U00002C24\U00002C54\U00002C24" },
-{ 0x00002C55, U"\U00002C25\U00002C55\U00002C25" },
-{ 0x00002C56, U"\U00002C26\U00002C56\U00002C26" },
-{ 0x00002C57, U"\U00002C27\U00002C57\U00002C27" },
-{ 0x00002C58, U"\U00002C28\U00002C58\U00002C28" },
-{ 0x00002C59, U"\U00002C29\U00002C59\U00002C29" },
-{ 0x00002C5A, U"\U00002C2A\U00002C5A\U00002C2A" },
-{ 0x00002C5B, U"\U00002C2B\U00002C5B\U00002C2B" },
-{ 0x00002C5C, U"\U00002C2C\U00002C5C\U00002C2C" },
-{ 0x00002C5D, U"\U00002C2D\U00002C5D\U00002C2D" },
-{ 0x00002C5E, U"\U00002C2E\U00002C5E\U00002C2E" },
-{ 0x00002C60, U"\U00002C60\U00002C61\U00002C60" },
-{ 0x00002C61, U"\U00002C60\U00002C61\U00002C60" },
-{ 0x00002C62, U"\U00002C62\U0000026B\U00002C62" },
-{ 0x00002C63, U"\U00002C63\U00001D7D\U00002C63" },
-{ 0x00002C64, U"\U00002C64\U0000027D\U00002C64" },
-{ 0x00002C65, U"\U0000023A\U00002C65\U0000023A" },
-{ 0x00002C66, U"\U0000023E\U00002C66\U0000023E" },
-{ 0x00002C67, U"\U00002C67\U00002C68\U00002C67" },
-{ 0x00002C68, U"\U00002C67\U00002C68\U00002C67" },
-{ 0x00002C69, U"\U00002C69\U00002C6A\U00002C69" },
-{ 0x00002C6A, U"\U00002C69\U00002C6A\U00002C69" },
-{ 0x00002C6B, U"\U00002C6B\U00002C6C\U00002C6B" },
-{ 0x00002C6C, U"\U00002C6B\U00002C6C\U00002C6B" },
-{ 0x00002C6D, U"\U00002C6D\U00000251\U00002C6D" },
-{ 0x00002C6E, U"\U00002C6E\U00000271\U00002C6E" },
-{ 0x00002C6F, U"\U00002C6F\U00000250\U00002C6F" },
-{ 0x00002C70, U"\U00002C70\U00000252\U00002C70" },
-{ 0x00002C72, U"\U00002C72\U00002C73\U00002C72" },
-{ 0x00002C73, U"\U00002C72\U00002C73\U00002C72" },
-{ 0x00002C75, U"\U00002C75\U00002C76\U00002C75" },
-{ 0x00002C76, U"\U00002C75\U00002C76\U00002C75" },
-{ 0x00002C7E, U"\U00002C7E\U0000023F\U00002C7E" },
-{ 0x00002C7F, U"\U00002C7F\U00000240\U00002C7F" },
-{ 0x00002C80, U"\U00002C80\U00002C81\U00002C80" },
-{ 0x00002C81, U"\U00002C80\U00002C81\U00002C80" },
-{ 0x00002C82, U"\U00002C82\U00002C83\U00002C82" },
-{ 0x00002C83, U"\U00002C82\U00002C83\U00002C82" },
-{ 0x00002C84, U"\U00002C84\U00002C85\U00002C84" },
-{ 0x00002C85, U"\U00002C84\U00002C85\U00002C84" },
-{ 0x00002C86, U"\U00002C86\U00002C87\U00002C86" },
-{ 0x00002C87, U"\U00002C86\U00002C87\U00002C86" },
-{ 0x00002C88, U"\U00002C88\U00002C89\U00002C88" },
-{ 0x00002C89, U"\U00002C88\U00002C89\U00002C88" },
-{ 0x00002C8A, U"\U00002C8A\U00002C8B\U00002C8A" },
-{ 0x00002C8B, U"\U00002C8A\U00002C8B\U00002C8A" },
-{ 0x00002C8C, U"\U00002C8C\U00002C8D\U00002C8C" },
-{ 0x00002C8D, U"\U00002C8C\U00002C8D\U00002C8C" },
-{ 0x00002C8E, U"\U00002C8E\U00002C8F\U00002C8E" },
-{ 0x00002C8F, U"\U00002C8E\U00002C8F\U00002C8E" },
-{ 0x00002C90, U"\U00002C90\U00002C91\U00002C90" },
-{ 0x00002C91, U"\U00002C90\U00002C91\U00002C90" },
-{ 0x00002C92, U"\U00002C92\U00002C93\U00002C92" },
-{ 0x00002C93, U"\U00002C92\U00002C93\U00002C92" },
-{ 0x00002C94, U"\U00002C94\U00002C95\U00002C94" },
-{ 0x00002C95, U"\U00002C94\U00002C95\U00002C94" },
-{ 0x00002C96, U"\U00002C96\U00002C97\U00002C96" },
-{ 0x00002C97, U"\U00002C96\U00002C97\U00002C96" },
-{ 0x00002C98, U"\U00002C98\U00002C99\U00002C98" },
-{ 0x00002C99, U"\U00002C98\U00002C99\U00002C98" },
-{ 0x00002C9A, U"\U00002C9A\U00002C9B\U00002C9A" },
-{ 0x00002C9B, U"\U00002C9A\U00002C9B\U00002C9A" },
-{ 0x00002C9C, U"\U00002C9C\U00002C9D\U00002C9C" },
-{ 0x00002C9D, U"\U00002C9C\U00002C9D\U00002C9C" },
-{ 0x00002C9E, U"\U00002C9E\U00002C9F\U00002C9E" },
-{ 0x00002C9F, U"\U00002C9E\U00002C9F\U00002C9E" },
-{ 0x00002CA0, U"\U00002CA0\U00002CA1\U00002CA0" },
-{ 0x00002CA1, U"\U00002CA0\U00002CA1\U00002CA0" },
-{ 0x00002CA2, U"\U00002CA2\U00002CA3\U00002CA2" },
-{ 0x00002CA3, U"\U00002CA2\U00002CA3\U00002CA2" },
-{ 0x00002CA4, U"\U00002CA4\U00002CA5\U00002CA4" },
-{ 0x00002CA5, U"\U00002CA4\U00002CA5\U00002CA4" },
-{ 0x00002CA6, U"\U00002CA6\U00002CA7\U00002CA6" },
-{ 0x00002CA7, U"\U00002CA6\U00002CA7\U00002CA6" },
-{ 0x00002CA8, U"\U00002CA8\U00002CA9\U00002CA8" },
-{ 0x00002CA9, U"\U00002CA8\U00002CA9\U00002CA8" },
-{ 0x00002CAA, U"\U00002CAA\U00002CAB\U00002CAA" },
-{ 0x00002CAB, U"\U00002CAA\U00002CAB\U00002CAA" },
-{ 0x00002CAC, U"\U00002CAC\U00002CAD\U00002CAC" },
-{ 0x00002CAD, U"\U00002CAC\U00002CAD\U00002CAC" },
-{ 0x00002CAE, U"\U00002CAE\U00002CAF\U00002CAE" },
-{ 0x00002CAF, U"\U00002CAE\U00002CAF\U00002CAE" },
-{ 0x00002CB0, U"\U00002CB0\U00002CB1\U00002CB0" },
-{ 0x00002CB1, U"\U00002CB0\U00002CB1\U00002CB0" },
-{ 0x00002CB2, U"\U00002CB2\U00002CB3\U00002CB2" },
-{ 0x00002CB3, U"\U00002CB2\U00002CB3\U00002CB2" },
-{ 0x00002CB4, U"\U00002CB4\U00002CB5\U00002CB4" },
-{ 0x00002CB5, U"\U00002CB4\U00002CB5\U00002CB4" },
-{ 0x00002CB6, U"\U00002CB6\U00002CB7\U00002CB6" },
-{ 0x00002CB7, U"\U00002CB6\U00002CB7\U00002CB6" },
-{ 0x00002CB8, U"\U00002CB8\U00002CB9\U00002CB8" },
-{ 0x00002CB9, U"\U00002CB8\U00002CB9\U00002CB8" },
-{ 0x00002CBA, U"\U00002CBA\U00002CBB\U00002CBA" },
-{ 0x00002CBB, U"\U00002CBA\U00002CBB\U00002CBA" },
-{ 0x00002CBC, U"\U00002CBC\U00002CBD\U00002CBC" },
-{ 0x00002CBD, U"\U00002CBC\U00002CBD\U00002CBC" },
-{ 0x00002CBE, U"\U00002CBE\U00002CBF\U00002CBE" },
-{ 0x00002CBF, U"\U00002CBE\U00002CBF\U00002CBE" },
-{ 0x00002CC0, U"\U00002CC0\U00002CC1\U00002CC0" },
-{ 0x00002CC1, U"\U00002CC0\U00002CC1\U00002CC0" },
-{ 0x00002CC2, U"\U00002CC2\U00002CC3\U00002CC2" },
-{ 0x00002CC3, U"\U00002CC2\U00002CC3\U00002CC2" },
-{ 0x00002CC4, U"\U00002CC4\U00002CC5\U00002CC4" },
-{ 0x00002CC5, U"\U00002CC4\U00002CC5\U00002CC4" },
-{ 0x00002CC6, U"\U00002CC6\U00002CC7\U00002CC6" },
-{ 0x00002CC7, U"\U00002CC6\U00002CC7\U00002CC6" },
-{ 0x00002CC8, U"\U00002CC8\U00002CC9\U00002CC8" },
-{ 0x00002CC9, U"\U00002CC8\U00002CC9\U00002CC8" },
-{ 0x00002CCA, U"\U00002CCA\U00002CCB\U00002CCA" },
-{ 0x00002CCB, U"\U00002CCA\U00002CCB\U00002CCA" },
-{ 0x00002CCC, U"\U00002CCC\U00002CCD\U00002CCC" },
-{ 0x00002CCD, U"\U00002CCC\U00002CCD\U00002CCC" },
-{ 0x00002CCE, U"\U00002CCE\U00002CCF\U00002CCE" },
-{ 0x00002CCF, U"\U00002CCE\U00002CCF\U00002CCE" },
-{ 0x00002CD0, U"\U00002CD0\U00002CD1\U00002CD0" },
-{ 0x00002CD1, U"\U00002CD0\U00002CD1\U00002CD0" },
-{ 0x00002CD2, U"\U00002CD2\U00002CD3\U00002CD2" },
-{ 0x00002CD3, U"\U00002CD2\U00002CD3\U00002CD2" },
-{ 0x00002CD4, U"\U00002CD4\U00002CD5\U00002CD4" },
-{ 0x00002CD5, U"\U00002CD4\U00002CD5\U00002CD4" },
-{ 0x00002CD6, U"\U00002CD6\U00002CD7\U00002CD6" },
-{ 0x00002CD7, U"\U00002CD6\U00002CD7\U00002CD6" },
-{ 0x00002CD8, U"\U00002CD8\U00002CD9\U00002CD8" },
-{ 0x00002CD9, U"\U00002CD8\U00002CD9\U00002CD8" },
-{ 0x00002CDA, U"\U00002CDA\U00002CDB\U00002CDA" },
-{ 0x00002CDB, U"\U00002CDA\U00002CDB\U00002CDA" },
-{ 0x00002CDC, U"\U00002CDC\U00002CDD\U00002CDC" },
-{ 0x00002CDD, U"\U00002CDC\U00002CDD\U00002CDC" },
-{ 0x00002CDE, U"\U00002CDE\U00002CDF\U00002CDE" },
-{ 0x00002CDF, U"\U00002CDE\U00002CDF\U00002CDE" },
-{ 0x00002CE0, U"\U00002CE0\U00002CE1\U00002CE0" },
-{ 0x00002CE1, U"\U00002CE0\U00002CE1\U00002CE0" },
-{ 0x00002CE2, U"\U00002CE2\U00002CE3\U00002CE2" },
-{ 0x00002CE3, U"\U00002CE2\U00002CE3\U00002CE2" },
-{ 0x00002CEB, U"\U00002CEB\U00002CEC\U00002CEB" },
-{ 0x00002CEC, U"\U00002CEB\U00002CEC\U00002CEB" },
-{ 0x00002CED, U"\U00002CED\U00002CEE\U00002CED" },
-{ 0x00002CEE, U"\U00002CED\U00002CEE\U00002CED" },
-{ 0x00002CF2, U"\U00002CF2\U00002CF3\U00002CF2" },
-{ 0x00002CF3, U"\U00002CF2\U00002CF3\U00002CF2" },
-{ 0x00002D00, U"\U000010A0\U00002D00\U000010A0" },
-{ 0x00002D01, U"\U000010A1\U00002D01\U000010A1" },
-{ 0x00002D02, U"\U000010A2\U00002D02\U000010A2" },
-{ 0x00002D03, U"\U000010A3\U00002D03\U000010A3" },
-{ 0x00002D04, U"\U000010A4\U00002D04\U000010A4" },
-{ 0x00002D05, U"\U000010A5\U00002D05\U000010A5" },
-{ 0x00002D06, U"\U000010A6\U00002D06\U000010A6" },
-{ 0x00002D07, U"\U000010A7\U00002D07\U000010A7" },
-{ 0x00002D08, U"\U000010A8\U00002D08\U000010A8" },
-{ 0x00002D09, U"\U000010A9\U00002D09\U000010A9" },
-{ 0x00002D0A, U"\U000010AA\U00002D0A\U000010AA" },
-{ 0x00002D0B, U"\U000010AB\U00002D0B\U000010AB" },
-{ 0x00002D0C, U"\U000010AC\U00002D0C\U000010AC" },
-{ 0x00002D0D, U"\U000010AD\U00002D0D\U000010AD" },
-{ 0x00002D0E, U"\U000010AE\U00002D0E\U000010AE" },
-{ 0x00002D0F, U"\U000010AF\U00002D0F\U000010AF" },
-{ 0x00002D10, U"\U000010B0\U00002D10\U000010B0" },
-{ 0x00002D11, U"\U000010B1\U00002D11\U000010B1" },
-{ 0x00002D12, U"\U000010B2\U00002D12\U000010B2" },
-{ 0x00002D13, U"\U000010B3\U00002D13\U000010B3" },
-{ 0x00002D14, U"\U000010B4\U00002D14\U000010B4" },
-{ 0x00002D15, U"\U000010B5\U00002D15\U000010B5" },
-{ 0x00002D16, U"\U000010B6\U00002D16\U000010B6" },
-{ 0x00002D17, U"\U000010B7\U00002D17\U000010B7" },
-{ 0x00002D18, U"\U000010B8\U00002D18\U000010B8" },
-{ 0x00002D19, U"\U000010B9\U00002D19\U000010B9" },
-{ 0x00002D1A, U"\U000010BA\U00002D1A\U000010BA" },
-{ 0x00002D1B, U"\U000010BB\U00002D1B\U000010BB" },
-{ 0x00002D1C, U"\U000010BC\U00002D1C\U000010BC" },
-{ 0x00002D1D, U"\U000010BD\U00002D1D\U000010BD" },
-{ 0x00002D1E, U"\U000010BE\U00002D1E\U000010BE" },
-{ 0x00002D1F, U"\U000010BF\U00002D1F\U000010BF" },
-{ 0x00002D20, U"\U000010C0\U00002D20\U000010C0" },
-{ 0x00002D21, U"\U000010C1\U00002D21\U000010C1" },
-{ 0x00002D22, U"\U000010C2\U00002D22\U000010C2" },
-{ 0x00002D23, U"\U000010C3\U00002D23\U000010C3" },
-{ 0x00002D24, U"\U000010C4\U00002D24\U000010C4" },
-{ 0x00002D25, U"\U000010C5\U00002D25\U000010C5" },
-{ 0x00002D27, U"\U000010C7\U00002D27\U000010C7" },
-{ 0x00002D2D, U"\U000010CD\U00002D2D\U000010CD" },
-{ 0x0000A640, U"\U0000A640\U0000A641\U0000A640" },
-{ 0x0000A641, U"\U0000A640\U0000A641\U0000A640" },
-{ 0x0000A642, U"\U0000A642\U0000A643\U0000A642" },
-{ 0x0000A643, U"\U0000A642\U0000A643\U0000A642" },
-{ 0x0000A644, U"\U0000A644\U0000A645\U0000A644" },
-{ 0x0000A645, U"\U0000A644\U0000A645\U0000A644" },
-{ 0x0000A646, U"\U0000A646\U0000A647\U0000A646" },
-{ 0x0000A647, U"\U0000A646\U0000A647\U0000A646" },
-{ 0x0000A648, U"\U0000A648\U0000A649\U0000A648" },
-{ 0x0000A649, U"\U0000A648\U0000A649\U0000A648" },
-{ 0x0000A64A, U"\U0000A64A\U0000A64B\U0000A64A" },
-{ 0x0000A64B, U"\U0000A64A\U0000A64B\U0000A64A" },
-{ 0x0000A64C, U"\U0000A64C\U0000A64D\U0000A64C" },
-{ 0x0000A64D, U"\U0000A64C\U0000A64D\U0000A64C" },
-{ 0x0000A64E, U"\U0000A64E\U0000A64F\U0000A64E" },
-{ 0x0000A64F, U"\U0000A64E\U0000A64F\U0000A64E" },
-{ 0x0000A650, U"\U0000A650\U0000A651\U0000A650" },
-{ 0x0000A651, U"\U0000A650\U0000A651\U0000A650" },
-{ 0x0000A652, U"\U0000A652\U0000A653\U0000A652" },
-{ 0x0000A653, U"\U0000A652\U0000A653\U0000A652" },
-{ 0x0000A654, U"\U0000A654\U0000A655\U0000A654" },
-{ 0x0000A655, U"\U0000A654\U0000A655\U0000A654" },
-{ 0x0000A656, U"\U0000A656\U0000A657\U0000A656" },
-{ 0x0000A657, U"\U0000A656\U0000A657\U0000A656" },
-{ 0x0000A658, U"\U0000A658\U0000A659\U0000A658" },
-{ 0x0000A659, U"\U0000A658\U0000A659\U0000A658" },
-{ 0x0000A65A, U"\U0000A65A\U0000A65B\U0000A65A" },
-{ 0x0000A65B, U"\U0000A65A\U0000A65B\U0000A65A" },
-{ 0x0000A65C, U"\U0000A65C\U0000A65D\U0000A65C" },
-{ 0x0000A65D, U"\U0000A65C\U0000A65D\U0000A65C" },
-{ 0x0000A65E, U"\U0000A65E\U0000A65F\U0000A65E" },
-{ 0x0000A65F, U"\U0000A65E\U0000A65F\U0000A65E" },
-{ 0x0000A660, U"\U0000A660\U0000A661\U0000A660" },
-{ 0x0000A661, U"\U0000A660\U0000A661\U0000A660" },
-{ 0x0000A662, U"\U0000A662\U0000A663\U0000A662" },
-{ 0x0000A663, U"\U0000A662\U0000A663\U0000A662" },
-{ 0x0000A664, U"\U0000A664\U0000A665\U0000A664" },
-{ 0x0000A665, U"\U0000A664\U0000A665\U0000A664" },
-{ 0x0000A666, U"\U0000A666\U0000A667\U0000A666" },
-{ 0x0000A667, U"\U0000A666\U0000A667\U0000A666" },
-{ 0x0000A668, U"\U0000A668\U0000A669\U0000A668" },
-{ 0x0000A669, U"\U0000A668\U0000A669\U0000A668" },
-{ 0x0000A66A, U"\U0000A66A\U0000A66B\U0000A66A" },
-{ 0x0000A66B, U"\U0000A66A\U0000A66B\U0000A66A" },
-{ 0x0000A66C, U"\U0000A66C\U0000A66D\U0000A66C" },
-{ 0x0000A66D, U"\U0000A66C\U0000A66D\U0000A66C" },
-{ 0x0000A680, U"\U0000A680\U0000A681\U0000A680" },
-{ 0x0000A681, U"\U0000A680\U0000A681\U0000A680" },
-{ 0x0000A682, U"\U0000A682\U0000A683\U0000A682" },
-{ 0x0000A683, U"\U0000A682\U0000A683\U0000A682" },
-{ 0x0000A684, U"\U0000A684\U0000A685\U0000A684" },
-{ 0x0000A685, U"\U0000A684\U0000A685\U0000A684" },
-{ 0x0000A686, U"\U0000A686\U0000A687\U0000A686" },
-{ 0x0000A687, U"\U0000A686\U0000A687\U0000A686" },
-{ 0x0000A688, U"\U0000A688\U0000A689\U0000A688" },
-{ 0x0000A689, U"\U0000A688\U0000A689\U0000A688" },
-{ 0x0000A68A, U"\U0000A68A\U0000A68B\U0000A68A" },
-{ 0x0000A68B, U"\U0000A68A\U0000A68B\U0000A68A" },
-{ 0x0000A68C, U"\U0000A68C\U0000A68D\U0000A68C" },
-{ 0x0000A68D, U"\U0000A68C\U0000A68D\U0000A68C" },
-{ 0x0000A68E, U"\U0000A68E\U0000A68F\U0000A68E" },
-{ 0x0000A68F, U"\U0000A68E\U0000A68F\U0000A68E" },
-{ 0x0000A690, U"\U0000A690\U0000A691\U0000A690" },
-{ 0x0000A691, U"\U0000A690\U0000A691\U0000A690" },
-{ 0x0000A692, U"\U0000A692\U0000A693\U0000A692" },
-{ 0x0000A693, U"\U0000A692\U0000A693\U0000A692" },
-{ 0x0000A694, U"\U0000A694\U0000A695\U0000A694" },
-{ 0x0000A695, U"\U0000A694\U0000A695\U0000A694" },
-{ 0x0000A696, U"\U0000A696\U0000A697\U0000A696" },
-{ 0x0000A697, U"\U0000A696\U0000A697\U0000A696" },
-{ 0x0000A698, U"\U0000A698\U0000A699\U0000A698" },
-{ 0x0000A699, U"\U0000A698\U0000A699\U0000A698" },
-{ 0x0000A69A, U"\U0000A69A\U0000A69B\U0000A69A" },
-{ 0x0000A69B, U"\U0000A69A\U0000A69B\U0000A69A" },
-{ 0x0000A722, U"\U0000A722\U0000A723\U0000A722" },
-{ 0x0000A723, U"\U0000A722\U0000A723\U0000A722" },
-{ 0x0000A724, U"\U0000A724\U0000A725\U0000A724" },
-{ 0x0000A725, U"\U0000A724\U0000A725\U0000A724" },
-{ 0x0000A726, U"\U0000A726\U0000A727\U0000A726" },
-{ 0x0000A727, U"\U0000A726\U0000A727\U0000A726" },
-{ 0x0000A728, U"\U0000A728\U0000A729\U0000A728" },
-{ 0x0000A729, U"\U0000A728\U0000A729\U0000A728" },
-{ 0x0000A72A, U"\U0000A72A\U0000A72B\U0000A72A" },
-{ 0x0000A72B, U"\U0000A72A\U0000A72B\U0000A72A" },
-{ 0x0000A72C, U"\U0000A72C\U0000A72D\U0000A72C" },
-{ 0x0000A72D, U"\U0000A72C\U0000A72D\U0000A72C" },
-{ 0x0000A72E, U"\U0000A72E\U0000A72F\U0000A72E" },
-{ 0x0000A72F, U"\U0000A72E\U0000A72F\U0000A72E" },
-{ 0x0000A732, U"\U0000A732\U0000A733\U0000A732" },
-{ 0x0000A733, U"\U0000A732\U0000A733\U0000A732" },
-{ 0x0000A734, U"\U0000A734\U0000A735\U0000A734" },
-{ 0x0000A735, U"\U0000A734\U0000A735\U0000A734" },
-{ 0x0000A736, U"\U0000A736\U0000A737\U0000A736" },
-{ 0x0000A737, U"\U0000A736\U0000A737\U0000A736" },
-{ 0x0000A738, U"\U0000A738\U0000A739\U0000A738" },
-{ 0x0000A739, U"\U0000A738\U0000A739\U0000A738" },
-{ 0x0000A73A, U"\U0000A73A\U0000A73B\U0000A73A" },
-{ 0x0000A73B, U"\U0000A73A\U0000A73B\U0000A73A" },
-{ 0x0000A73C, U"\U0000A73C\U0000A73D\U0000A73C" },
-{ 0x0000A73D, U"\U0000A73C\U0000A73D\U0000A73C" },
-{ 0x0000A73E, U"\U0000A73E\U0000A73F\U0000A73E" },
-{ 0x0000A73F, U"\U0000A73E\U0000A73F\U0000A73E" },
-{ 0x0000A740, U"\U0000A740\U0000A741\U0000A740" },
-{ 0x0000A741, U"\U0000A740\U0000A741\U0000A740" },
-{ 0x0000A742, U"\U0000A742\U0000A743\U0000A742" },
-{ 0x0000A743, U"\U0000A742\U0000A743\U0000A742" },
-{ 0x0000A744, U"\U0000A744\U0000A745\U0000A744" },
-{ 0x0000A745, U"\U0000A744\U0000A745\U0000A744" },
-{ 0x0000A746, U"\U0000A746\U0000A747\U0000A746" },
-{ 0x0000A747, U"\U0000A746\U0000A747\U0000A746" },
-{ 0x0000A748, U"\U0000A748\U0000A749\U0000A748" },
-{ 0x0000A749, U"\U0000A748\U0000A749\U0000A748" },
-{ 0x0000A74A, U"\U0000A74A\U0000A74B\U0000A74A" },
-{ 0x0000A74B, U"\U0000A74A\U0000A74B\U0000A74A" },
-{ 0x0000A74C, U"\U0000A74C\U0000A74D\U0000A74C" },
-{ 0x0000A74D, U"\U0000A74C\U0000A74D\U0000A74C" },
-{ 0x0000A74E, U"\U0000A74E\U0000A74F\U0000A74E" },
-{ 0x0000A74F, U"\U0000A74E\U0000A74F\U0000A74E" },
-{ 0x0000A750, U"\U0000A750\U0000A751\U0000A750" },
-{ 0x0000A751, U"\U0000A750\U0000A751\U0000A750" },
-{ 0x0000A752, U"\U0000A752\U0000A753\U0000A752" },
-{ 0x0000A753, U"\U0000A752\U0000A753\U0000A752" },
-{ 0x0000A754, U"\U0000A754\U0000A755\U0000A754" },
-{ 0x0000A755, U"\U0000A754\U0000A755\U0000A754" },
-{ 0x0000A756, U"\U0000A756\U0000A757\U0000A756" },
-{ 0x0000A757, U"\U0000A756\U0000A757\U0000A756" },
-{ 0x0000A758, U"\U0000A758\U0000A759\U0000A758" },
-{ 0x0000A759, U"\U0000A758\U0000A759\U0000A758" },
-{ 0x0000A75A, U"\U0000A75A\U0000A75B\U0000A75A" },
-{ 0x0000A75B, U"\U0000A75A\U0000A75B\U0000A75A" },
-{ 0x0000A75C, U"\U0000A75C\U0000A75D\U0000A75C" },
-{ 0x0000A75D, U"\U0000A75C\U0000A75D\U0000A75C" },
-{ 0x0000A75E, U"\U0000A75E\U0000A75F\U0000A75E" },
-{ 0x0000A75F, U"\U0000A75E\U0000A75F\U0000A75E" },
-{ 0x0000A760, U"\U0000A760\U0000A761\U0000A760" },
-{ 0x0000A761, U"\U0000A760\U0000A761\U0000A760" },
-{ 0x0000A762, U"\U0000A762\U0000A763\U0000A762" },
-{ 0x0000A763, U"\U0000A762\U0000A763\U0000A762" },
-{ 0x0000A764, U"\U0000A764\U0000A765\U0000A764" },
-{ 0x0000A765, U"\U0000A764\U0000A765\U0000A764" },
-{ 0x0000A766, U"\U0000A766\U0000A767\U0000A766" },
-{ 0x0000A767, U"\U0000A766\U0000A767\U0000A766" },
-{ 0x0000A768, U"\U0000A768\U0000A769\U0000A768" },
-{ 0x0000A769, U"\U0000A768\U0000A769\U0000A768" },
-{ 0x0000A76A, U"\U0000A76A\U0000A76B\U0000A76A" },
-{ 0x0000A76B, U"\U0000A76A\U0000A76B\U0000A76A" },
-{ 0x0000A76C, U"\U0000A76C\U0000A76D\U0000A76C" },
-{ 0x0000A76D, U"\U0000A76C\U0000A76D\U0000A76C" },
-{ 0x0000A76E, U"\U0000A76E\U0000A76F\U0000A76E" },
-{ 0x0000A76F, U"\U0000A76E\U0000A76F\U0000A76E" },
-{ 0x0000A779, U"\U0000A779\U0000A77A\U0000A779" },
-{ 0x0000A77A, U"\U0000A779\U0000A77A\U0000A779" },
-{ 0x0000A77B, U"\U0000A77B\U0000A77C\U0000A77B" },
-{ 0x0000A77C, U"\U0000A77B\U0000A77C\U0000A77B" },
-{ 0x0000A77D, U"\U0000A77D\U00001D79\U0000A77D" },
-{ 0x0000A77E, U"\U0000A77E\U0000A77F\U0000A77E" },
-{ 0x0000A77F, U"\U0000A77E\U0000A77F\U0000A77E" },
-{ 0x0000A780, U"\U0000A780\U0000A781\U0000A780" },
-{ 0x0000A781, U"\U0000A780\U0000A781\U0000A780" },
-{ 0x0000A782, U"\U0000A782\U0000A783\U0000A782" },
-{ 0x0000A783, U"\U0000A782\U0000A783\U0000A782" },
-{ 0x0000A784, U"\U0000A784\U0000A785\U0000A784" },
-{ 0x0000A785, U"\U0000A784\U0000A785\U0000A784" },
-{ 0x0000A786, U"\U0000A786\U0000A787\U0000A786" },
-{ 0x0000A787, U"\U0000A786\U0000A787\U0000A786" },
-{ 0x0000A78B, U"\U0000A78B\U0000A78C\U0000A78B" },
-{ 0x0000A78C, U"\U0000A78B\U0000A78C\U0000A78B" },
-{ 0x0000A78D, U"\U0000A78D\U00000265\U0000A78D" },
-{ 0x0000A790, U"\U0000A790\U0000A791\U0000A790" },
-{ 0x0000A791, U"\U0000A790\U0000A791\U0000A790" },
-{ 0x0000A792, U"\U0000A792\U0000A793\U0000A792" },
-{ 0x0000A793, U"\U0000A792\U0000A793\U0000A792" },
-{ 0x0000A794, U"\U0000A7C4\U0000A794\U0000A7C4" },
-{ 0x0000A796, U"\U0000A796\U0000A797\U0000A796" },
-{ 0x0000A797, U"\U0000A796\U0000A797\U0000A796" },
-{ 0x0000A798, U"\U0000A798\U0000A799\U0000A798" },
-{ 0x0000A799, U"\U0000A798\U0000A799\U0000A798" },
-{ 0x0000A79A, U"\U0000A79A\U0000A79B\U0000A79A" },
-{ 0x0000A79B, U"\U0000A79A\U0000A79B\U0000A79A" },
-{ 0x0000A79C, U"\U0000A79C\U0000A79D\U0000A79C" },
-{ 0x0000A79D, U"\U0000A79C\U0000A79D\U0000A79C" },
-{ 0x0000A79E, U"\U0000A79E\U0000A79F\U0000A79E" },
-{ 0x0000A79F, U"\U0000A79E\U0000A79F\U0000A79E" },
-{ 0x0000A7A0, U"\U0000A7A0\U0000A7A1\U0000A7A0" },
-{ 0x0000A7A1, U"\U0000A7A0\U0000A7A1\U0000A7A0" },
-{ 0x0000A7A2, U"\U0000A7A2\U0000A7A3\U0000A7A2" },
-{ 0x0000A7A3, U"\U0000A7A2\U0000A7A3\U0000A7A2" },
-{ 0x0000A7A4, U"\U0000A7A4\U0000A7A5\U0000A7A4" },
-{ 0x0000A7A5, U"\U0000A7A4\U0000A7A5\U0000A7A4" },
-{ 0x0000A7A6, U"\U0000A7A6\U0000A7A7\U0000A7A6" },
-{ 0x0000A7A7, U"\U0000A7A6\U0000A7A7\U0000A7A6" },
-{ 0x0000A7A8, U"\U0000A7A8\U0000A7A9\U0000A7A8" },
-{ 0x0000A7A9, U"\U0000A7A8\U0000A7A9\U0000A7A8" },
-{ 0x0000A7AA, U"\U0000A7AA\U00000266\U0000A7AA" },
-{ 0x0000A7AB, U"\U0000A7AB\U0000025C\U0000A7AB" },
-{ 0x0000A7AC, U"\U0000A7AC\U00000261\U0000A7AC" },
-{ 0x0000A7AD, U"\U0000A7AD\U0000026C\U0000A7AD" },
-{ 0x0000A7AE, U"\U0000A7AE\U0000026A\U0000A7AE" },
-{ 0x0000A7B0, U"\U0000A7B0\U0000029E\U0000A7B0" },
-{ 0x0000A7B1, U"\U0000A7B1\U00000287\U0000A7B1" },
-{ 0x0000A7B2, U"\U0000A7B2\U0000029D\U0000A7B2" },
-{ 0x0000A7B3, U"\U0000A7B3\U0000AB53\U0000A7B3" },
-{ 0x0000A7B4, U"\U0000A7B4\U0000A7B5\U0000A7B4" },
-{ 0x0000A7B5, U"\U0000A7B4\U0000A7B5\U0000A7B4" },
-{ 0x0000A7B6, U"\U0000A7B6\U0000A7B7\U0000A7B6" },
-{ 0x0000A7B7, U"\U0000A7B6\U0000A7B7\U0000A7B6" },
-{ 0x0000A7B8, U"\U0000A7B8\U0000A7B9\U0000A7B8" },
-{ 0x0000A7B9, U"\U0000A7B8\U0000A7B9\U0000A7B8" },
-{ 0x0000A7BA, U"\U0000A7BA\U0000A7BB\U0000A7BA" },
-{ 0x0000A7BB, U"\U0000A7BA\U0000A7BB\U0000A7BA" },
-{ 0x0000A7BC, U"\U0000A7BC\U0000A7BD\U0000A7BC" },
-{ 0x0000A7BD, U"\U0000A7BC\U0000A7BD\U0000A7BC" },
-{ 0x0000A7BE, U"\U0000A7BE\U0000A7BF\U0000A7BE" },
-{ 0x0000A7BF, U"\U0000A7BE\U0000A7BF\U0000A7BE" },
-{ 0x0000A7C2, U"\U0000A7C2\U0000A7C3\U0000A7C2" },
-{ 0x0000A7C3, U"\U0000A7C2\U0000A7C3\U0000A7C2" },
-{ 0x0000A7C4, U"\U0000A7C4\U0000A794\U0000A7C4" },
-{ 0x0000A7C5, U"\U0000A7C5\U00000282\U0000A7C5" },
-{ 0x0000A7C6, U"\U0000A7C6\U00001D8E\U0000A7C6" },
-{ 0x0000A7C7, U"\U0000A7C7\U0000A7C8\U0000A7C7" },
-{ 0x0000A7C8, U"\U0000A7C7\U0000A7C8\U0000A7C7" },
-{ 0x0000A7C9, U"\U0000A7C9\U0000A7CA\U0000A7C9" },
-{ 0x0000A7CA, U"\U0000A7C9\U0000A7CA\U0000A7C9" },
-{ 0x0000A7F5, U"\U0000A7F5\U0000A7F6\U0000A7F5" },
-{ 0x0000A7F6, U"\U0000A7F5\U0000A7F6\U0000A7F5" },
-{ 0x0000AB53, U"\U0000A7B3\U0000AB53\U0000A7B3" },
-{ 0x0000AB70, U"\U000013A0\U0000AB70\U000013A0" },
-{ 0x0000AB71, U"\U000013A1\U0000AB71\U000013A1" },
-{ 0x0000AB72, U"\U000013A2\U0000AB72\U000013A2" },
-{ 0x0000AB73, U"\U000013A3\U0000AB73\U000013A3" },
-{ 0x0000AB74, U"\U000013A4\U0000AB74\U000013A4" },
-{ 0x0000AB75, U"\U000013A5\U0000AB75\U000013A5" },
-{ 0x0000AB76, U"\U000013A6\U0000AB76\U000013A6" },
-{ 0x0000AB77, U"\U000013A7\U0000AB77\U000013A7" },
-{ 0x0000AB78, U"\U000013A8\U0000AB78\U000013A8" },
-{ 0x0000AB79, U"\U000013A9\U0000AB79\U000013A9" },
-{ 0x0000AB7A, U"\U000013AA\U0000AB7A\U000013AA" },
-{ 0x0000AB7B, U"\U000013AB\U0000AB7B\U000013AB" },
-{ 0x0000AB7C, U"\U000013AC\U0000AB7C\U000013AC" },
-{ 0x0000AB7D, U"\U000013AD\U0000AB7D\U000013AD" },
-{ 0x0000AB7E, U"\U000013AE\U0000AB7E\U000013AE" },
-{ 0x0000AB7F, U"\U000013AF\U0000AB7F\U000013AF" },
-{ 0x0000AB80, U"\U000013B0\U0000AB80\U000013B0" },
-{ 0x0000AB81, U"\U000013B1\U0000AB81\U000013B1" },
-{ 0x0000AB82, U"\U000013B2\U0000AB82\U000013B2" },
-{ 0x0000AB83, U"\U000013B3\U0000AB83\U000013B3" },
-{ 0x0000AB84, U"\U000013B4\U0000AB84\U000013B4" },
-{ 0x0000AB85, U"\U000013B5\U0000AB85\U000013B5" },
-{ 0x0000AB86, U"\U000013B6\U0000AB86\U000013B6" },
-{ 0x0000AB87, U"\U000013B7\U0000AB87\U000013B7" },
-{ 0x0000AB88, U"\U000013B8\U0000AB88\U000013B8" },
-{ 0x0000AB89, U"\U000013B9\U0000AB89\U000013B9" },
-{ 0x0000AB8A, U"\U000013BA\U0000AB8A\U000013BA" },
-{ 0x0000AB8B, U"\U000013BB\U0000AB8B\U000013BB" },
-{ 0x0000AB8C, U"\U000013BC\U0000AB8C\U000013BC" },
-{ 0x0000AB8D, U"\U000013BD\U0000AB8D\U000013BD" },
-{ 0x0000AB8E, U"\U000013BE\U0000AB8E\U000013BE" },
-{ 0x0000AB8F, U"\U000013BF\U0000AB8F\U000013BF" },
-{ 0x0000AB90, U"\U000013C0\U0000AB90\U000013C0" },
-{ 0x0000AB91, U"\U000013C1\U0000AB91\U000013C1" },
-{ 0x0000AB92, U"\U000013C2\U0000AB92\U000013C2" },
-{ 0x0000AB93, U"\U000013C3\U0000AB93\U000013C3" },
-{ 0x0000AB94, U"\U000013C4\U0000AB94\U000013C4" },
-{ 0x0000AB95, U"\U000013C5\U0000AB95\U000013C5" },
-{ 0x0000AB96, U"\U000013C6\U0000AB96\U000013C6" },
-{ 0x0000AB97, U"\U000013C7\U0000AB97\U000013C7" },
-{ 0x0000AB98, U"\U000013C8\U0000AB98\U000013C8" },
-{ 0x0000AB99, U"\U000013C9\U0000AB99\U000013C9" },
-{ 0x0000AB9A, U"\U000013CA\U0000AB9A\U000013CA" },
-{ 0x0000AB9B, U"\U000013CB\U0000AB9B\U000013CB" },
-{ 0x0000AB9C, U"\U000013CC\U0000AB9C\U000013CC" },
-{ 0x0000AB9D, U"\U000013CD\U0000AB9D\U000013CD" },
-{ 0x0000AB9E, U"\U000013CE\U0000AB9E\U000013CE" },
-{ 0x0000AB9F, U"\U000013CF\U0000AB9F\U000013CF" },
-{ 0x0000ABA0, U"\U000013D0\U0000ABA0\U000013D0" },
-{ 0x0000ABA1, U"\U000013D1\U0000ABA1\U000013D1" },
-{ 0x0000ABA2, U"\U000013D2\U0000ABA2\U000013D2" },
-{ 0x0000ABA3, U"\U000013D3\U0000ABA3\U000013D3" },
-{ 0x0000ABA4, U"\U000013D4\U0000ABA4\U000013D4" },
-{ 0x0000ABA5, U"\U000013D5\U0000ABA5\U000013D5" },
-{ 0x0000ABA6, U"\U000013D6\U0000ABA6\U000013D6" },
-{ 0x0000ABA7, U"\U000013D7\U0000ABA7\U000013D7" },
-{ 0x0000ABA8, U"\U000013D8\U0000ABA8\U000013D8" },
-{ 0x0000ABA9, U"\U000013D9\U0000ABA9\U000013D9" },
-{ 0x0000ABAA, U"\U000013DA\U0000ABAA\U000013DA" },
-{ 0x0000ABAB, U"\U000013DB\U0000ABAB\U000013DB" },
-{ 0x0000ABAC, U"\U000013DC\U0000ABAC\U000013DC" },
-{ 0x0000ABAD, U"\U000013DD\U0000ABAD\U000013DD" },
-{ 0x0000ABAE, U"\U000013DE\U0000ABAE\U000013DE" },
-{ 0x0000ABAF, U"\U000013DF\U0000ABAF\U000013DF" },
-{ 0x0000ABB0, U"\U000013E0\U0000ABB0\U000013E0" },
-{ 0x0000ABB1, U"\U000013E1\U0000ABB1\U000013E1" },
-{ 0x0000ABB2, U"\U000013E2\U0000ABB2\U000013E2" },
-{ 0x0000ABB3, U"\U000013E3\U0000ABB3\U000013E3" },
-{ 0x0000ABB4, U"\U000013E4\U0000ABB4\U000013E4" },
-{ 0x0000ABB5, U"\U000013E5\U0000ABB5\U000013E5" },
-{ 0x0000ABB6, U"\U000013E6\U0000ABB6\U000013E6" },
-{ 0x0000ABB7, U"\U000013E7\U0000ABB7\U000013E7" },
-{ 0x0000ABB8, U"\U000013E8\U0000ABB8\U000013E8" },
-{ 0x0000ABB9, U"\U000013E9\U0000ABB9\U000013E9" },
-{ 0x0000ABBA, U"\U000013EA\U0000ABBA\U000013EA" },
-{ 0x0000ABBB, U"\U000013EB\U0000ABBB\U000013EB" },
-{ 0x0000ABBC, U"\U000013EC\U0000ABBC\U000013EC" },
-{ 0x0000ABBD, U"\U000013ED\U0000ABBD\U000013ED" },
-{ 0x0000ABBE, U"\U000013EE\U0000ABBE\U000013EE" },
-{ 0x0000ABBF, U"\U000013EF\U0000ABBF\U000013EF" },
-{ 0x0000FF21, U"\U0000FF21\U0000FF41\U0000FF21" },
-{ 0x0000FF22, U"\U0000FF22\U0000FF42\U0000FF22" },
-{ 0x0000FF23, U"\U0000FF23\U0000FF43\U0000FF23" },
-{ 0x0000FF24, U"\U0000FF24\U0000FF44\U0000FF24" },
-{ 0x0000FF25, U"\U0000FF25\U0000FF45\U0000FF25" },
-{ 0x0000FF26, U"\U0000FF26\U0000FF46\U0000FF26" },
-{ 0x0000FF27, U"\U0000FF27\U0000FF47\U0000FF27" },
-{ 0x0000FF28, U"\U0000FF28\U0000FF48\U0000FF28" },
-{ 0x0000FF29, U"\U0000FF29\U0000FF49\U0000FF29" },
-{ 0x0000FF2A, U"\U0000FF2A\U0000FF4A\U0000FF2A" },
-{ 0x0000FF2B, U"\U0000FF2B\U0000FF4B\U0000FF2B" },
-{ 0x0000FF2C, U"\U0000FF2C\U0000FF4C\U0000FF2C" },
-{ 0x0000FF2D, U"\U0000FF2D\U0000FF4D\U0000FF2D" },
-{ 0x0000FF2E, U"\U0000FF2E\U0000FF4E\U0000FF2E" },
-{ 0x0000FF2F, U"\U0000FF2F\U0000FF4F\U0000FF2F" },
-{ 0x0000FF30, U"\U0000FF30\U0000FF50\U0000FF30" },
-{ 0x0000FF31, U"\U0000FF31\U0000FF51\U0000FF31" },
-{ 0x0000FF32, U"\U0000FF32\U0000FF52\U0000FF32" },
-{ 0x0000FF33, U"\U0000FF33\U0000FF53\U0000FF33" },
-{ 0x0000FF34, U"\U0000FF34\U0000FF54\U0000FF34" },
-{ 0x0000FF35, U"\U0000FF35\U0000FF55\U0000FF35" },
-{ 0x0000FF36, U"\U0000FF36\U0000FF56\U0000FF36" },
-{ 0x0000FF37, U"\U0000FF37\U0000FF57\U0000FF37" },
-{ 0x0000FF38, U"\U0000FF38\U0000FF58\U0000FF38" },
-{ 0x0000FF39, U"\U0000FF39\U0000FF59\U0000FF39" },
-{ 0x0000FF3A, U"\U0000FF3A\U0000FF5A\U0000FF3A" },
-{ 0x0000FF41, U"\U0000FF21\U0000FF41\U0000FF21" },
-{ 0x0000FF42, U"\U0000FF22\U0000FF42\U0000FF22" },
-{ 0x0000FF43, U"\U0000FF23\U0000FF43\U0000FF23" },
-{ 0x0000FF44, U"\U0000FF24\U0000FF44\U0000FF24" },
-{ 0x0000FF45, U"\U0000FF25\U0000FF45\U0000FF25" },
-{ 0x0000FF46, U"\U0000FF26\U0000FF46\U0000FF26" },
-{ 0x0000FF47, U"\U0000FF27\U0000FF47\U0000FF27" },
-{ 0x0000FF48, U"\U0000FF28\U0000FF48\U0000FF28" },
-{ 0x0000FF49, U"\U0000FF29\U0000FF49\U0000FF29" },
-{ 0x0000FF4A, U"\U0000FF2A\U0000FF4A\U0000FF2A" },
-{ 0x0000FF4B, U"\U0000FF2B\U0000FF4B\U0000FF2B" },
-{ 0x0000FF4C, U"\U0000FF2C\U0000FF4C\U0000FF2C" },
-{ 0x0000FF4D, U"\U0000FF2D\U0000FF4D\U0000FF2D" },
-{ 0x0000FF4E, U"\U0000FF2E\U0000FF4E\U0000FF2E" },
-{ 0x0000FF4F, U"\U0000FF2F\U0000FF4F\U0000FF2F" },
-{ 0x0000FF50, U"\U0000FF30\U0000FF50\U0000FF30" },
-{ 0x0000FF51, U"\U0000FF31\U0000FF51\U0000FF31" },
-{ 0x0000FF52, U"\U0000FF32\U0000FF52\U0000FF32" },
-{ 0x0000FF53, U"\U0000FF33\U0000FF53\U0000FF33" },
-{ 0x0000FF54, U"\U0000FF34\U0000FF54\U0000FF34" },
-{ 0x0000FF55, U"\U0000FF35\U0000FF55\U0000FF35" },
-{ 0x0000FF56, U"\U0000FF36\U0000FF56\U0000FF36" },
-{ 0x0000FF57, U"\U0000FF37\U0000FF57\U0000FF37" },
-{ 0x0000FF58, U"\U0000FF38\U0000FF58\U0000FF38" },
-{ 0x0000FF59, U"\U0000FF39\U0000FF59\U0000FF39" },
-{ 0x0000FF5A, U"\U0000FF3A\U0000FF5A\U0000FF3A" },
-{ 0x00010400, U"\U00010400\U00010428\U00010400" },
-{ 0x00010401, U"\U00010401\U00010429\U00010401" },
-{ 0x00010402, U"\U00010402\U0001042A\U00010402" },
-{ 0x00010403, U"\U00010403\U0001042B\U00010403" },
-{ 0x00010404, U"\U00010404\U0001042C\U00010404" },
-{ 0x00010405, U"\U00010405\U0001042D\U00010405" },
-{ 0x00010406, U"\U00010406\U0001042E\U00010406" },
-{ 0x00010407, U"\U00010407\U0001042F\U00010407" },
-{ 0x00010408, U"\U00010408\U00010430\U00010408" },
-{ 0x00010409, U"\U00010409\U00010431\U00010409" },
-{ 0x0001040A, U"\U0001040A\U00010432\U0001040A" },
-{ 0x0001040B, U"\U0001040B\U00010433\U0001040B" },
-{ 0x0001040C, U"\U0001040C\U00010434\U0001040C" },
-{ 0x0001040D, U"\U0001040D\U00010435\U0001040D" },
-{ 0x0001040E, U"\U0001040E\U00010436\U0001040E" },
-{ 0x0001040F, U"\U0001040F\U00010437\U0001040F" },
-{ 0x00010410, U"\U00010410\U00010438\U00010410" },
-{ 0x00010411, U"\U00010411\U00010439\U00010411" },
-{ 0x00010412, U"\U00010412\U0001043A\U00010412" },
-{ 0x00010413, U"\U00010413\U0001043B\U00010413" },
-{ 0x00010414, U"\U00010414\U0001043C\U00010414" },
-{ 0x00010415, U"\U00010415\U0001043D\U00010415" },
-{ 0x00010416, U"\U00010416\U0001043E\U00010416" },
-{ 0x00010417, U"\U00010417\U0001043F\U00010417" },
-{ 0x00010418, U"\U00010418\U00010440\U00010418" },
-{ 0x00010419, U"\U00010419\U00010441\U00010419" },
-{ 0x0001041A, U"\U0001041A\U00010442\U0001041A" },
-{ 0x0001041B, U"\U0001041B\U00010443\U0001041B" },
-{ 0x0001041C, U"\U0001041C\U00010444\U0001041C" },
-{ 0x0001041D, U"\U0001041D\U00010445\U0001041D" },
-{ 0x0001041E, U"\U0001041E\U00010446\U0001041E" },
-{ 0x0001041F, U"\U0001041F\U00010447\U0001041F" },
-{ 0x00010420, U"\U00010420\U00010448\U00010420" },
-{ 0x00010421, U"\U00010421\U00010449\U00010421" },
-{ 0x00010422, U"\U00010422\U0001044A\U00010422" },
-{ 0x00010423, U"\U00010423\U0001044B\U00010423" },
-{ 0x00010424, U"\U00010424\U0001044C\U00010424" },
-{ 0x00010425, U"\U00010425\U0001044D\U00010425" },
-{ 0x00010426, U"\U00010426\U0001044E\U00010426" },
-{ 0x00010427, U"\U00010427\U0001044F\U00010427" },
-{ 0x00010428, U"\U00010400\U00010428\U00010400" },
-{ 0x00010429, U"\U00010401\U00010429\U00010401" },
-{ 0x0001042A, U"\U00010402\U0001042A\U00010402" },
-{ 0x0001042B, U"\U00010403\U0001042B\U00010403" },
-{ 0x0001042C, U"\U00010404\U0001042C\U00010404" },
-{ 0x0001042D, U"\U00010405\U0001042D\U00010405" },
-{ 0x0001042E, U"\U00010406\U0001042E\U00010406" },
-{ 0x0001042F, U"\U00010407\U0001042F\U00010407" },
-{ 0x00010430, U"\U00010408\U00010430\U00010408" },
-{ 0x00010431, U"\U00010409\U00010431\U00010409" },
-{ 0x00010432, U"\U0001040A\U00010432\U0001040A" },
-{ 0x00010433, U"\U0001040B\U00010433\U0001040B" },
-{ 0x00010434, U"\U0001040C\U00010434\U0001040C" },
-{ 0x00010435, U"\U0001040D\U00010435\U0001040D" },
-{ 0x00010436, U"\U0001040E\U00010436\U0001040E" },
-{ 0x00010437, U"\U0001040F\U00010437\U0001040F" },
-{ 0x00010438, U"\U00010410\U00010438\U00010410" },
-{ 0x00010439, U"\U00010411\U00010439\U00010411" },
-{ 0x0001043A, U"\U00010412\U0001043A\U00010412" },
-{ 0x0001043B, U"\U00010413\U0001043B\U00010413" },
-{ 0x0001043C, U"\U00010414\U0001043C\U00010414" },
-{ 0x0001043D, U"\U00010415\U0001043D\U00010415" },
-{ 0x0001043E, U"\U00010416\U0001043E\U00010416" },
-{ 0x0001043F, U"\U00010417\U0001043F\U00010417" },
-{ 0x00010440, U"\U00010418\U00010440\U00010418" },
-{ 0x00010441, U"\U00010419\U00010441\U00010419" },
-{ 0x00010442, U"\U0001041A\U00010442\U0001041A" },
-{ 0x00010443, U"\U0001041B\U00010443\U0001041B" },
-{ 0x00010444, U"\U0001041C\U00010444\U0001041C" },
-{ 0x00010445, U"\U0001041D\U00010445\U0001041D" },
-{ 0x00010446, U"\U0001041E\U00010446\U0001041E" },
-{ 0x00010447, U"\U0001041F\U00010447\U0001041F" },
-{ 0x00010448, U"\U00010420\U00010448\U00010420" },
-{ 0x00010449, U"\U00010421\U00010449\U00010421" },
-{ 0x0001044A, U"\U00010422\U0001044A\U00010422" },
-{ 0x0001044B, U"\U00010423\U0001044B\U00010423" },
-{ 0x0001044C, U"\U00010424\U0001044C\U00010424" },
-{ 0x0001044D, U"\U00010425\U0001044D\U00010425" },
-{ 0x0001044E, U"\U00010426\U0001044E\U00010426" },
-{ 0x0001044F, U"\U00010427\U0001044F\U00010427" },
-{ 0x000104B0, U"\U000104B0\U000104D8\U000104B0" },
-{ 0x000104B1, U"\U000104B1\U000104D9\U000104B1" },
-{ 0x000104B2, U"\U000104B2\U000104DA\U000104B2" },
-{ 0x000104B3, U"\U000104B3\U000104DB\U000104B3" },
-{ 0x000104B4, U"\U000104B4\U000104DC\U000104B4" },
-{ 0x000104B5, U"\U000104B5\U000104DD\U000104B5" },
-{ 0x000104B6, U"\U000104B6\U000104DE\U000104B6" },
-{ 0x000104B7, U"\U000104B7\U000104DF\U000104B7" },
-{ 0x000104B8, U"\U000104B8\U000104E0\U000104B8" },
-{ 0x000104B9, U"\U000104B9\U000104E1\U000104B9" },
-{ 0x000104BA, U"\U000104BA\U000104E2\U000104BA" },
-{ 0x000104BB, U"\U000104BB\U000104E3\U000104BB" },
-{ 0x000104BC, U"\U000104BC\U000104E4\U000104BC" },
-{ 0x000104BD, U"\U000104BD\U000104E5\U000104BD" },
-{ 0x000104BE, U"\U000104BE\U000104E6\U000104BE" },
-{ 0x000104BF, U"\U000104BF\U000104E7\U000104BF" },
-{ 0x000104C0, U"\U000104C0\U000104E8\U000104C0" },
-{ 0x000104C1, U"\U000104C1\U000104E9\U000104C1" },
-{ 0x000104C2, U"\U000104C2\U000104EA\U000104C2" },
-{ 0x000104C3, U"\U000104C3\U000104EB\U000104C3" },
-{ 0x000104C4, U"\U000104C4\U000104EC\U000104C4" },
-{ 0x000104C5, U"\U000104C5\U000104ED\U000104C5" },
-{ 0x000104C6, U"\U000104C6\U000104EE\U000104C6" },
-{ 0x000104C7, U"\U000104C7\U000104EF\U000104C7" },
-{ 0x000104C8, U"\U000104C8\U000104F0\U000104C8" },
-{ 0x000104C9, U"\U000104C9\U000104F1\U000104C9" },
-{ 0x000104CA, U"\U000104CA\U000104F2\U000104CA" },
-{ 0x000104CB, U"\U000104CB\U000104F3\U000104CB" },
-{ 0x000104CC, U"\U000104CC\U000104F4\U000104CC" },
-{ 0x000104CD, U"\U000104CD\U000104F5\U000104CD" },
-{ 0x000104CE, U"\U000104CE\U000104F6\U000104CE" },
-{ 0x000104CF, U"\U000104CF\U000104F7\U000104CF" },
-{ 0x000104D0, U"\U000104D0\U000104F8\U000104D0" },
-{ 0x000104D1, U"\U000104D1\U000104F9\U000104D1" },
-{ 0x000104D2, U"\U000104D2\U000104FA\U000104D2" },
-{ 0x000104D3, U"\U000104D3\U000104FB\U000104D3" },
-{ 0x000104D8, U"\U000104B0\U000104D8\U000104B0" },
-{ 0x000104D9, U"\U000104B1\U000104D9\U000104B1" },
-{ 0x000104DA, U"\U000104B2\U000104DA\U000104B2" },
-{ 0x000104DB, U"\U000104B3\U000104DB\U000104B3" },
-{ 0x000104DC, U"\U000104B4\U000104DC\U000104B4" },
-{ 0x000104DD, U"\U000104B5\U000104DD\U000104B5" },
-{ 0x000104DE, U"\U000104B6\U000104DE\U000104B6" },
-{ 0x000104DF, U"\U000104B7\U000104DF\U000104B7" },
-{ 0x000104E0, U"\U000104B8\U000104E0\U000104B8" },
-{ 0x000104E1, U"\U000104B9\U000104E1\U000104B9" },
-{ 0x000104E2, U"\U000104BA\U000104E2\U000104BA" },
-{ 0x000104E3, U"\U000104BB\U000104E3\U000104BB" },
-{ 0x000104E4, U"\U000104BC\U000104E4\U000104BC" },
-{ 0x000104E5, U"\U000104BD\U000104E5\U000104BD" },
-{ 0x000104E6, U"\U000104BE\U000104E6\U000104BE" },
-{ 0x000104E7, U"\U000104BF\U000104E7\U000104BF" },
-{ 0x000104E8, U"\U000104C0\U000104E8\U000104C0" },
-{ 0x000104E9, U"\U000104C1\U000104E9\U000104C1" },
-{ 0x000104EA, U"\U000104C2\U000104EA\U000104C2" },
-{ 0x000104EB, U"\U000104C3\U000104EB\U000104C3" },
-{ 0x000104EC, U"\U000104C4\U000104EC\U000104C4" },
-{ 0x000104ED, U"\U000104C5\U000104ED\U000104C5" },
-{ 0x000104EE, U"\U000104C6\U000104EE\U000104C6" },
-{ 0x000104EF, U"\U000104C7\U000104EF\U000104C7" },
-{ 0x000104F0, U"\U000104C8\U000104F0\U000104C8" },
-{ 0x000104F1, U"\U000104C9\U000104F1\U000104C9" },
-{ 0x000104F2, U"\U000104CA\U000104F2\U000104CA" },
-{ 0x000104F3, U"\U000104CB\U000104F3\U000104CB" },
-{ 0x000104F4, U"\U000104CC\U000104F4\U000104CC" },
-{ 0x000104F5, U"\U000104CD\U000104F5\U000104CD" },
-{ 0x000104F6, U"\U000104CE\U000104F6\U000104CE" },
-{ 0x000104F7, U"\U000104CF\U000104F7\U000104CF" },
-{ 0x000104F8, U"\U000104D0\U000104F8\U000104D0" },
-{ 0x000104F9, U"\U000104D1\U000104F9\U000104D1" },
-{ 0x000104FA, U"\U000104D2\U000104FA\U000104D2" },
-{ 0x000104FB, U"\U000104D3\U000104FB\U000104D3" },
-{ 0x00010C80, U"\U00010C80\U00010CC0\U00010C80" },
-{ 0x00010C81, U"\U00010C81\U00010CC1\U00010C81" },
-{ 0x00010C82, U"\U00010C82\U00010CC2\U00010C82" },
-{ 0x00010C83, U"\U00010C83\U00010CC3\U00010C83" },
-{ 0x00010C84, U"\U00010C84\U00010CC4\U00010C84" },
-{ 0x00010C85, U"\U00010C85\U00010CC5\U00010C85" },
-{ 0x00010C86, U"\U00010C86\U00010CC6\U00010C86" },
-{ 0x00010C87, U"\U00010C87\U00010CC7\U00010C87" },
-{ 0x00010C88, U"\U00010C88\U00010CC8\U00010C88" },
-{ 0x00010C89, U"\U00010C89\U00010CC9\U00010C89" },
-{ 0x00010C8A, U"\U00010C8A\U00010CCA\U00010C8A" },
-{ 0x00010C8B, U"\U00010C8B\U00010CCB\U00010C8B" },
-{ 0x00010C8C, U"\U00010C8C\U00010CCC\U00010C8C" },
-{ 0x00010C8D, U"\U00010C8D\U00010CCD\U00010C8D" },
-{ 0x00010C8E, U"\U00010C8E\U00010CCE\U00010C8E" },
-{ 0x00010C8F, U"\U00010C8F\U00010CCF\U00010C8F" },
-{ 0x00010C90, U"\U00010C90\U00010CD0\U00010C90" },
-{ 0x00010C91, U"\U00010C91\U00010CD1\U00010C91" },
-{ 0x00010C92, U"\U00010C92\U00010CD2\U00010C92" },
-{ 0x00010C93, U"\U00010C93\U00010CD3\U00010C93" },
-{ 0x00010C94, U"\U00010C94\U00010CD4\U00010C94" },
-{ 0x00010C95, U"\U00010C95\U00010CD5\U00010C95" },
-{ 0x00010C96, U"\U00010C96\U00010CD6\U00010C96" },
-{ 0x00010C97, U"\U00010C97\U00010CD7\U00010C97" },
-{ 0x00010C98, U"\U00010C98\U00010CD8\U00010C98" },
-{ 0x00010C99, U"\U00010C99\U00010CD9\U00010C99" },
-{ 0x00010C9A, U"\U00010C9A\U00010CDA\U00010C9A" },
-{ 0x00010C9B, U"\U00010C9B\U00010CDB\U00010C9B" },
-{ 0x00010C9C, U"\U00010C9C\U00010CDC\U00010C9C" },
-{ 0x00010C9D, U"\U00010C9D\U00010CDD\U00010C9D" },
-{ 0x00010C9E, U"\U00010C9E\U00010CDE\U00010C9E" },
-{ 0x00010C9F, U"\U00010C9F\U00010CDF\U00010C9F" },
-{ 0x00010CA0, U"\U00010CA0\U00010CE0\U00010CA0" },
-{ 0x00010CA1, U"\U00010CA1\U00010CE1\U00010CA1" },
-{ 0x00010CA2, U"\U00010CA2\U00010CE2\U00010CA2" },
-{ 0x00010CA3, U"\U00010CA3\U00010CE3\U00010CA3" },
-{ 0x00010CA4, U"\U00010CA4\U00010CE4\U00010CA4" },
-{ 0x00010CA5, U"\U00010CA5\U00010CE5\U00010CA5" },
-{ 0x00010CA6, U"\U00010CA6\U00010CE6\U00010CA6" },
-{ 0x00010CA7, U"\U00010CA7\U00010CE7\U00010CA7" },
-{ 0x00010CA8, U"\U00010CA8\U00010CE8\U00010CA8" },
-{ 0x00010CA9, U"\U00010CA9\U00010CE9\U00010CA9" },
-{ 0x00010CAA, U"\U00010CAA\U00010CEA\U00010CAA" },
-{ 0x00010CAB, U"\U00010CAB\U00010CEB\U00010CAB" },
-{ 0x00010CAC, U"\U00010CAC\U00010CEC\U00010CAC" },
-{ 0x00010CAD, U"\U00010CAD\U00010CED\U00010CAD" },
-{ 0x00010CAE, U"\U00010CAE\U00010CEE\U00010CAE" },
-{ 0x00010CAF, U"\U00010CAF\U00010CEF\U00010CAF" },
-{ 0x00010CB0, U"\U00010CB0\U00010CF0\U00010CB0" },
-{ 0x00010CB1, U"\U00010CB1\U00010CF1\U00010CB1" },
-{ 0x00010CB2, U"\U00010CB2\U00010CF2\U00010CB2" },
-{ 0x00010CC0, U"\U00010C80\U00010CC0\U00010C80" },
-{ 0x00010CC1, U"\U00010C81\U00010CC1\U00010C81" },
-{ 0x00010CC2, U"\U00010C82\U00010CC2\U00010C82" },
-{ 0x00010CC3, U"\U00010C83\U00010CC3\U00010C83" },
-{ 0x00010CC4, U"\U00010C84\U00010CC4\U00010C84" },
-{ 0x00010CC5, U"\U00010C85\U00010CC5\U00010C85" },
-{ 0x00010CC6, U"\U00010C86\U00010CC6\U00010C86" },
-{ 0x00010CC7, U"\U00010C87\U00010CC7\U00010C87" },
-{ 0x00010CC8, U"\U00010C88\U00010CC8\U00010C88" },
-{ 0x00010CC9, U"\U00010C89\U00010CC9\U00010C89" },
-{ 0x00010CCA, U"\U00010C8A\U00010CCA\U00010C8A" },
-{ 0x00010CCB, U"\U00010C8B\U00010CCB\U00010C8B" },
-{ 0x00010CCC, U"\U00010C8C\U00010CCC\U00010C8C" },
-{ 0x00010CCD, U"\U00010C8D\U00010CCD\U00010C8D" },
-{ 0x00010CCE, U"\U00010C8E\U00010CCE\U00010C8E" },
-{ 0x00010CCF, U"\U00010C8F\U00010CCF\U00010C8F" },
-{ 0x00010CD0, U"\U00010C90\U00010CD0\U00010C90" },
-{ 0x00010CD1, U"\U00010C91\U00010CD1\U00010C91" },
-{ 0x00010CD2, U"\U00010C92\U00010CD2\U00010C92" },
-{ 0x00010CD3, U"\U00010C93\U00010CD3\U00010C93" },
-{ 0x00010CD4, U"\U00010C94\U00010CD4\U00010C94" },
-{ 0x00010CD5, U"\U00010C95\U00010CD5\U00010C95" },
-{ 0x00010CD6, U"\U00010C96\U00010CD6\U00010C96" },
-{ 0x00010CD7, U"\U00010C97\U00010CD7\U00010C97" },
-{ 0x00010CD8, U"\U00010C98\U00010CD8\U00010C98" },
-{ 0x00010CD9, U"\U00010C99\U00010CD9\U00010C99" },
-{ 0x00010CDA, U"\U00010C9A\U00010CDA\U00010C9A" },
-{ 0x00010CDB, U"\U00010C9B\U00010CDB\U00010C9B" },
-{ 0x00010CDC, U"\U00010C9C\U00010CDC\U00010C9C" },
-{ 0x00010CDD, U"\U00010C9D\U00010CDD\U00010C9D" },
-{ 0x00010CDE, U"\U00010C9E\U00010CDE\U00010C9E" },
-{ 0x00010CDF, U"\U00010C9F\U00010CDF\U00010C9F" },
-{ 0x00010CE0, U"\U00010CA0\U00010CE0\U00010CA0" },
-{ 0x00010CE1, U"\U00010CA1\U00010CE1\U00010CA1" },
-{ 0x00010CE2, U"\U00010CA2\U00010CE2\U00010CA2" },
-{ 0x00010CE3, U"\U00010CA3\U00010CE3\U00010CA3" },
-{ 0x00010CE4, U"\U00010CA4\U00010CE4\U00010CA4" },
-{ 0x00010CE5, U"\U00010CA5\U00010CE5\U00010CA5" },
-{ 0x00010CE6, U"\U00010CA6\U00010CE6\U00010CA6" },
-{ 0x00010CE7, U"\U00010CA7\U00010CE7\U00010CA7" },
-{ 0x00010CE8, U"\U00010CA8\U00010CE8\U00010CA8" },
-{ 0x00010CE9, U"\U00010CA9\U00010CE9\U00010CA9" },
-{ 0x00010CEA, U"\U00010CAA\U00010CEA\U00010CAA" },
-{ 0x00010CEB, U"\U00010CAB\U00010CEB\U00010CAB" },
-{ 0x00010CEC, U"\U00010CAC\U00010CEC\U00010CAC" },
-{ 0x00010CED, U"\U00010CAD\U00010CED\U00010CAD" },
-{ 0x00010CEE, U"\U00010CAE\U00010CEE\U00010CAE" },
-{ 0x00010CEF, U"\U00010CAF\U00010CEF\U00010CAF" },
-{ 0x00010CF0, U"\U00010CB0\U00010CF0\U00010CB0" },
-{ 0x00010CF1, U"\U00010CB1\U00010CF1\U00010CB1" },
-{ 0x00010CF2, U"\U00010CB2\U00010CF2\U00010CB2" },
-{ 0x000118A0, U"\U000118A0\U000118C0\U000118A0" },
-{ 0x000118A1, U"\U000118A1\U000118C1\U000118A1" },
-{ 0x000118A2, U"\U000118A2\U000118C2\U000118A2" },
-{ 0x000118A3, U"\U000118A3\U000118C3\U000118A3" },
-{ 0x000118A4, U"\U000118A4\U000118C4\U000118A4" },
-{ 0x000118A5, U"\U000118A5\U000118C5\U000118A5" },
-{ 0x000118A6, U"\U000118A6\U000118C6\U000118A6" },
-{ 0x000118A7, U"\U000118A7\U000118C7\U000118A7" },
-{ 0x000118A8, U"\U000118A8\U000118C8\U000118A8" },
-{ 0x000118A9, U"\U000118A9\U000118C9\U000118A9" },
-{ 0x000118AA, U"\U000118AA\U000118CA\U000118AA" },
-{ 0x000118AB, U"\U000118AB\U000118CB\U000118AB" },
-{ 0x000118AC, U"\U000118AC\U000118CC\U000118AC" },
-{ 0x000118AD, U"\U000118AD\U000118CD\U000118AD" },
-{ 0x000118AE, U"\U000118AE\U000118CE\U000118AE" },
-{ 0x000118AF, U"\U000118AF\U000118CF\U000118AF" },
-{ 0x000118B0, U"\U000118B0\U000118D0\U000118B0" },
-{ 0x000118B1, U"\U000118B1\U000118D1\U000118B1" },
-{ 0x000118B2, U"\U000118B2\U000118D2\U000118B2" },
-{ 0x000118B3, U"\U000118B3\U000118D3\U000118B3" },
-{ 0x000118B4, U"\U000118B4\U000118D4\U000118B4" },
-{ 0x000118B5, U"\U000118B5\U000118D5\U000118B5" },
-{ 0x000118B6, U"\U000118B6\U000118D6\U000118B6" },
-{ 0x000118B7, U"\U000118B7\U000118D7\U000118B7" },
-{ 0x000118B8, U"\U000118B8\U000118D8\U000118B8" },
-{ 0x000118B9, U"\U000118B9\U000118D9\U000118B9" },
-{ 0x000118BA, U"\U000118BA\U000118DA\U000118BA" },
-{ 0x000118BB, U"\U000118BB\U000118DB\U000118BB" },
-{ 0x000118BC, U"\U000118BC\U000118DC\U000118BC" },
-{ 0x000118BD, U"\U000118BD\U000118DD\U000118BD" },
-{ 0x000118BE, U"\U000118BE\U000118DE\U000118BE" },
-{ 0x000118BF, U"\U000118BF\U000118DF\U000118BF" },
-{ 0x000118C0, U"\U000118A0\U000118C0\U000118A0" },
-{ 0x000118C1, U"\U000118A1\U000118C1\U000118A1" },
-{ 0x000118C2, U"\U000118A2\U000118C2\U000118A2" },
-{ 0x000118C3, U"\U000118A3\U000118C3\U000118A3" },
-{ 0x000118C4, U"\U000118A4\U000118C4\U000118A4" },
-{ 0x000118C5, U"\U000118A5\U000118C5\U000118A5" },
-{ 0x000118C6, U"\U000118A6\U000118C6\U000118A6" },
-{ 0x000118C7, U"\U000118A7\U000118C7\U000118A7" },
-{ 0x000118C8, U"\U000118A8\U000118C8\U000118A8" },
-{ 0x000118C9, U"\U000118A9\U000118C9\U000118A9" },
-{ 0x000118CA, U"\U000118AA\U000118CA\U000118AA" },
-{ 0x000118CB, U"\U000118AB\U000118CB\U000118AB" },
-{ 0x000118CC, U"\U000118AC\U000118CC\U000118AC" },
-{ 0x000118CD, U"\U000118AD\U000118CD\U000118AD" },
-{ 0x000118CE, U"\U000118AE\U000118CE\U000118AE" },
-{ 0x000118CF, U"\U000118AF\U000118CF\U000118AF" },
-{ 0x000118D0, U"\U000118B0\U000118D0\U000118B0" },
-{ 0x000118D1, U"\U000118B1\U000118D1\U000118B1" },
-{ 0x000118D2, U"\U000118B2\U000118D2\U000118B2" },
-{ 0x000118D3, U"\U000118B3\U000118D3\U000118B3" },
-{ 0x000118D4, U"\U000118B4\U000118D4\U000118B4" },
-{ 0x000118D5, U"\U000118B5\U000118D5\U000118B5" },
-{ 0x000118D6, U"\U000118B6\U000118D6\U000118B6" },
-{ 0x000118D7, U"\U000118B7\U000118D7\U000118B7" },
-{ 0x000118D8, U"\U000118B8\U000118D8\U000118B8" },
-{ 0x000118D9, U"\U000118B9\U000118D9\U000118B9" },
-{ 0x000118DA, U"\U000118BA\U000118DA\U000118BA" },
-{ 0x000118DB, U"\U000118BB\U000118DB\U000118BB" },
-{ 0x000118DC, U"\U000118BC\U000118DC\U000118BC" },
-{ 0x000118DD, U"\U000118BD\U000118DD\U000118BD" },
-{ 0x000118DE, U"\U000118BE\U000118DE\U000118BE" },
-{ 0x000118DF, U"\U000118BF\U000118DF\U000118BF" },
-{ 0x00016E40, U"\U00016E40\U00016E60\U00016E40" },
-{ 0x00016E41, U"\U00016E41\U00016E61\U00016E41" },
-{ 0x00016E42, U"\U00016E42\U00016E62\U00016E42" },
-{ 0x00016E43, U"\U00016E43\U00016E63\U00016E43" },
-{ 0x00016E44, U"\U00016E44\U00016E64\U00016E44" },
-{ 0x00016E45, U"\U00016E45\U00016E65\U00016E45" },
-{ 0x00016E46, U"\U00016E46\U00016E66\U00016E46" },
-{ 0x00016E47, U"\U00016E47\U00016E67\U00016E47" },
-{ 0x00016E48, U"\U00016E48\U00016E68\U00016E48" },
-{ 0x00016E49, U"\U00016E49\U00016E69\U00016E49" },
-{ 0x00016E4A, U"\U00016E4A\U00016E6A\U00016E4A" },
-{ 0x00016E4B, U"\U00016E4B\U00016E6B\U00016E4B" },
-{ 0x00016E4C, U"\U00016E4C\U00016E6C\U00016E4C" },
-{ 0x00016E4D, U"\U00016E4D\U00016E6D\U00016E4D" },
-{ 0x00016E4E, U"\U00016E4E\U00016E6E\U00016E4E" },
-{ 0x00016E4F, U"\U00016E4F\U00016E6F\U00016E4F" },
-{ 0x00016E50, U"\U00016E50\U00016E70\U00016E50" },
-{ 0x00016E51, U"\U00016E51\U00016E71\U00016E51" },
-{ 0x00016E52, U"\U00016E52\U00016E72\U00016E52" },
-{ 0x00016E53, U"\U00016E53\U00016E73\U00016E53" },
-{ 0x00016E54, U"\U00016E54\U00016E74\U00016E54" },
-{ 0x00016E55, U"\U00016E55\U00016E75\U00016E55" },
-{ 0x00016E56, U"\U00016E56\U00016E76\U00016E56" },
-{ 0x00016E57, U"\U00016E57\U00016E77\U00016E57" },
-{ 0x00016E58, U"\U00016E58\U00016E78\U00016E58" },
-{ 0x00016E59, U"\U00016E59\U00016E79\U00016E59" },
-{ 0x00016E5A, U"\U00016E5A\U00016E7A\U00016E5A" },
-{ 0x00016E5B, U"\U00016E5B\U00016E7B\U00016E5B" },
-{ 0x00016E5C, U"\U00016E5C\U00016E7C\U00016E5C" },
-{ 0x00016E5D, U"\U00016E5D\U00016E7D\U00016E5D" },
-{ 0x00016E5E, U"\U00016E5E\U00016E7E\U00016E5E" },
-{ 0x00016E5F, U"\U00016E5F\U00016E7F\U00016E5F" },
-{ 0x00016E60, U"\U00016E40\U00016E60\U00016E40" },
-{ 0x00016E61, U"\U00016E41\U00016E61\U00016E41" },
-{ 0x00016E62, U"\U00016E42\U00016E62\U00016E42" },
-{ 0x00016E63, U"\U00016E43\U00016E63\U00016E43" },
-{ 0x00016E64, U"\U00016E44\U00016E64\U00016E44" },
-{ 0x00016E65, U"\U00016E45\U00016E65\U00016E45" },
-{ 0x00016E66, U"\U00016E46\U00016E66\U00016E46" },
-{ 0x00016E67, U"\U00016E47\U00016E67\U00016E47" },
-{ 0x00016E68, U"\U00016E48\U00016E68\U00016E48" },
-{ 0x00016E69, U"\U00016E49\U00016E69\U00016E49" },
-{ 0x00016E6A, U"\U00016E4A\U00016E6A\U00016E4A" },
-{ 0x00016E6B, U"\U00016E4B\U00016E6B\U00016E4B" },
-{ 0x00016E6C, U"\U00016E4C\U00016E6C\U00016E4C" },
-{ 0x00016E6D, U"\U00016E4D\U00016E6D\U00016E4D" },
-{ 0x00016E6E, U"\U00016E4E\U00016E6E\U00016E4E" },
-{ 0x00016E6F, U"\U00016E4F\U00016E6F\U00016E4F" },
-{ 0x00016E70, U"\U00016E50\U00016E70\U00016E50" },
-{ 0x00016E71, U"\U00016E51\U00016E71\U00016E51" },
-{ 0x00016E72, U"\U00016E52\U00016E72\U00016E52" },
-{ 0x00016E73, U"\U00016E53\U00016E73\U00016E53" },
-{ 0x00016E74, U"\U00016E54\U00016E74\U00016E54" },
-{ 0x00016E75, U"\U00016E55\U00016E75\U00016E55" },
-{ 0x00016E76, U"\U00016E56\U00016E76\U00016E56" },
-{ 0x00016E77, U"\U00016E57\U00016E77\U00016E57" },
-{ 0x00016E78, U"\U00016E58\U00016E78\U00016E58" },
-{ 0x00016E79, U"\U00016E59\U00016E79\U00016E59" },
-{ 0x00016E7A, U"\U00016E5A\U00016E7A\U00016E5A" },
-{ 0x00016E7B, U"\U00016E5B\U00016E7B\U00016E5B" },
-{ 0x00016E7C, U"\U00016E5C\U00016E7C\U00016E5C" },
-{ 0x00016E7D, U"\U00016E5D\U00016E7D\U00016E5D" },
-{ 0x00016E7E, U"\U00016E5E\U00016E7E\U00016E5E" },
-{ 0x00016E7F, U"\U00016E5F\U00016E7F\U00016E5F" },
-{ 0x0001E900, U"\U0001E900\U0001E922\U0001E900" },
-{ 0x0001E901, U"\U0001E901\U0001E923\U0001E901" },
-{ 0x0001E902, U"\U0001E902\U0001E924\U0001E902" },
-{ 0x0001E903, U"\U0001E903\U0001E925\U0001E903" },
-{ 0x0001E904, U"\U0001E904\U0001E926\U0001E904" },
-{ 0x0001E905, U"\U0001E905\U0001E927\U0001E905" },
-{ 0x0001E906, U"\U0001E906\U0001E928\U0001E906" },
-{ 0x0001E907, U"\U0001E907\U0001E929\U0001E907" },
-{ 0x0001E908, U"\U0001E908\U0001E92A\U0001E908" },
-{ 0x0001E909, U"\U0001E909\U0001E92B\U0001E909" },
-{ 0x0001E90A, U"\U0001E90A\U0001E92C\U0001E90A" },
-{ 0x0001E90B, U"\U0001E90B\U0001E92D\U0001E90B" },
-{ 0x0001E90C, U"\U0001E90C\U0001E92E\U0001E90C" },
-{ 0x0001E90D, U"\U0001E90D\U0001E92F\U0001E90D" },
-{ 0x0001E90E, U"\U0001E90E\U0001E930\U0001E90E" },
-{ 0x0001E90F, U"\U0001E90F\U0001E931\U0001E90F" },
-{ 0x0001E910, U"\U0001E910\U0001E932\U0001E910" },
-{ 0x0001E911, U"\U0001E911\U0001E933\U0001E911" },
-{ 0x0001E912, U"\U0001E912\U0001E934\U0001E912" },
-{ 0x0001E913, U"\U0001E913\U0001E935\U0001E913" },
-{ 0x0001E914, U"\U0001E914\U0001E936\U0001E914" },
-{ 0x0001E915, U"\U0001E915\U0001E937\U0001E915" },
-{ 0x0001E916, U"\U0001E916\U0001E938\U0001E916" },
-{ 0x0001E917, U"\U0001E917\U0001E939\U0001E917" },
-{ 0x0001E918, U"\U0001E918\U0001E93A\U0001E918" },
-{ 0x0001E919, U"\U0001E919\U0001E93B\U0001E919" },
-{ 0x0001E91A, U"\U0001E91A\U0001E93C\U0001E91A" },
-{ 0x0001E91B, U"\U0001E91B\U0001E93D\U0001E91B" },
-{ 0x0001E91C, U"\U0001E91C\U0001E93E\U0001E91C" },
-{ 0x0001E91D, U"\U0001E91D\U0001E93F\U0001E91D" },
-{ 0x0001E91E, U"\U0001E91E\U0001E940\U0001E91E" },
-{ 0x0001E91F, U"\U0001E91F\U0001E941\U0001E91F" },
-{ 0x0001E920, U"\U0001E920\U0001E942\U0001E920" },
-{ 0x0001E921, U"\U0001E921\U0001E943\U0001E921" },
-{ 0x0001E922, U"\U0001E900\U0001E922\U0001E900" },
-{ 0x0001E923, U"\U0001E901\U0001E923\U0001E901" },
-{ 0x0001E924, U"\U0001E902\U0001E924\U0001E902" },
-{ 0x0001E925, U"\U0001E903\U0001E925\U0001E903" },
-{ 0x0001E926, U"\U0001E904\U0001E926\U0001E904" },
-{ 0x0001E927, U"\U0001E905\U0001E927\U0001E905" },
-{ 0x0001E928, U"\U0001E906\U0001E928\U0001E906" },
-{ 0x0001E929, U"\U0001E907\U0001E929\U0001E907" },
-{ 0x0001E92A, U"\U0001E908\U0001E92A\U0001E908" },
-{ 0x0001E92B, U"\U0001E909\U0001E92B\U0001E909" },
-{ 0x0001E92C, U"\U0001E90A\U0001E92C\U0001E90A" },
-{ 0x0001E92D, U"\U0001E90B\U0001E92D\U0001E90B" },
-{ 0x0001E92E, U"\U0001E90C\U0001E92E\U0001E90C" },
-{ 0x0001E92F, U"\U0001E90D\U0001E92F\U0001E90D" },
-{ 0x0001E930, U"\U0001E90E\U0001E930\U0001E90E" },
-{ 0x0001E931, U"\U0001E90F\U0001E931\U0001E90F" },
-{ 0x0001E932, U"\U0001E910\U0001E932\U0001E910" },
-{ 0x0001E933, U"\U0001E911\U0001E933\U0001E911" },
-{ 0x0001E934, U"\U0001E912\U0001E934\U0001E912" },
-{ 0x0001E935, U"\U0001E913\U0001E935\U0001E913" },
-{ 0x0001E936, U"\U0001E914\U0001E936\U0001E914" },
-{ 0x0001E937, U"\U0001E915\U0001E937\U0001E915" },
-{ 0x0001E938, U"\U0001E916\U0001E938\U0001E916" },
-{ 0x0001E939, U"\U0001E917\U0001E939\U0001E917" },
-{ 0x0001E93A, U"\U0001E918\U0001E93A\U0001E918" },
-{ 0x0001E93B, U"\U0001E919\U0001E93B\U0001E919" },
-{ 0x0001E93C, U"\U0001E91A\U0001E93C\U0001E91A" },
-{ 0x0001E93D, U"\U0001E91B\U0001E93D\U0001E91B" },
-{ 0x0001E93E, U"\U0001E91C\U0001E93E\U0001E91C" },
-{ 0x0001E93F, U"\U0001E91D\U0001E93F\U0001E91D" },
-{ 0x0001E940, U"\U0001E91E\U0001E940\U0001E91E" },
-{ 0x0001E941, U"\U0001E91F\U0001E941\U0001E91F" },
-{ 0x0001E942, U"\U0001E920\U0001E942\U0001E920" },
-{ 0x0001E943, U"\U0001E921\U0001E943\U0001E921" },
+const SimpleCaseDelta _simple_case_deltas[] = {
+{0, 0, 0, 0}, {0, 32, 0, 32}, {-32, 0, -32, 0}, {743, 0, 743, 775},
+{121, 0, 121, 0}, {0, 1, 0, 1}, {-1, 0, -1, 0}, {0, -199, 0, 0},
+{-232, 0, -232, 0}, {0, -121, 0, -121}, {-300, 0, -300, -268}, {195, 0, 195, 0},
+{0, 210, 0, 210}, {0, 206, 0, 206}, {0, 205, 0, 205}, {0, 79, 0, 79},
+{0, 202, 0, 202}, {0, 203, 0, 203}, {0, 207, 0, 207}, {97, 0, 97, 0},
+{0, 211, 0, 211}, {0, 209, 0, 209}, {163, 0, 163, 0}, {0, 213, 0, 213},
+{130, 0, 130, 0}, {0, 214, 0, 214}, {0, 218, 0, 218}, {0, 217, 0, 217},
+{0, 219, 0, 219}, {56, 0, 56, 0}, {0, 2, 1, 2}, {-1, 1, 0, 1}, {-2, 0, -1, 0},
+{-79, 0, -79, 0}, {0, -97, 0, -97}, {0, -56, 0, -56}, {0, -130, 0, -130},
+{0, 10795, 0, 10795}, {0, -163, 0, -163}, {0, 10792, 0, 10792},
+{10815, 0, 10815, 0}, {0, -195, 0, -195}, {0, 69, 0, 69}, {0, 71, 0, 71},
+{10783, 0, 10783, 0}, {10780, 0, 10780, 0}, {10782, 0, 10782, 0},
+{-210, 0, -210, 0}, {-206, 0, -206, 0}, {-205, 0, -205, 0}, {-202, 0, -202, 0},
+{-203, 0, -203, 0}, {42319, 0, 42319, 0}, {42315, 0, 42315, 0},
+{-207, 0, -207, 0}, {42280, 0, 42280, 0}, {42308, 0, 42308, 0},
+{-209, 0, -209, 0}, {-211, 0, -211, 0}, {10743, 0, 10743, 0},
+{42305, 0, 42305, 0}, {10749, 0, 10749, 0}, {-213, 0, -213, 0},
+{-214, 0, -214, 0}, {10727, 0, 10727, 0}, {-218, 0, -218, 0},
+{42307, 0, 42307, 0}, {42282, 0, 42282, 0}, {-69, 0, -69, 0},
+{-217, 0, -217, 0}, {-71, 0, -71, 0}, {-219, 0, -219, 0}, {42261, 0, 42261, 0},
+{42258, 0, 42258, 0}, {84, 0, 84, 116}, {0, 116, 0, 116}, {0, 38, 0, 38},
+{0, 37, 0, 37}, {0, 64, 0, 64}, {0, 63, 0, 63}, {-38, 0, -38, 0},
+{-37, 0, -37, 0}, {-31, 0, -31, 1}, {-64, 0, -64, 0}, {-63, 0, -63, 0},
+{0, 8, 0, 8}, {-62, 0, -62, -30}, {-57, 0, -57, -25}, {-47, 0, -47, -15},
+{-54, 0, -54, -22}, {-8, 0, -8, 0}, {-86, 0, -86, -54}, {-80, 0, -80, -48},
+{7, 0, 7, 0}, {-116, 0, -116, 0}, {0, -60, 0, -60}, {-96, 0, -96, -64},
+{0, -7, 0, -7}, {0, 80, 0, 80}, {-80, 0, -80, 0}, {0, 15, 0, 15},
+{-15, 0, -15, 0}, {0, 48, 0, 48}, {-48, 0, -48, 0}, {0, 7264, 0, 7264},
+{3008, 0, 0, 0}, {0, 38864, 0, 0}, {0, 8, 0, 0}, {-8, 0, -8, -8},
+{-6254, 0, -6254, -6222}, {-6253, 0, -6253, -6221}, {-6244, 0, -6244, -6212},
+{-6242, 0, -6242, -6210}, {-6243, 0, -6243, -6211}, {-6236, 0, -6236, -6204},
+{-6181, 0, -6181, -6180}, {35266, 0, 35266, 35267}, {0, -3008, 0, -3008},
+{35332, 0, 35332, 0}, {3814, 0, 3814, 0}, {35384, 0, 35384, 0},
+{-59, 0, -59, -58}, {0, -7615, 0, -7615}, {8, 0, 8, 0}, {0, -8, 0, -8},
+{74, 0, 74, 0}, {86, 0, 86, 0}, {100, 0, 100, 0}, {128, 0, 128, 0},
+{112, 0, 112, 0}, {126, 0, 126, 0}, {9, 0, 9, 0}, {0, -74, 0, -74},
+{0, -9, 0, -9}, {-7205, 0, -7205, -7173}, {0, -86, 0, -86}, {0, -100, 0, -100},
+{0, -112, 0, -112}, {0, -128, 0, -128}, {0, -126, 0, -126},
+{0, -7517, 0, -7517}, {0, -8383, 0, -8383}, {0, -8262, 0, -8262},
+{0, 28, 0, 28}, {-28, 0, -28, 0}, {0, 16, 0, 16}, {-16, 0, -16, 0},
+{0, 26, 0, 26}, {-26, 0, -26, 0}, {0, -10743, 0, -10743}, {0, -3814, 0, -3814},
+{0, -10727, 0, -10727}, {-10795, 0, -10795, 0}, {-10792, 0, -10792, 0},
+{0, -10780, 0, -10780}, {0, -10749, 0, -10749}, {0, -10783, 0, -10783},
+{0, -10782, 0, -10782}, {0, -10815, 0, -10815}, {-7264, 0, -7264, 0},
+{0, -35332, 0, -35332}, {0, -42280, 0, -42280}, {48, 0, 48, 0},
+{0, -42308, 0, -42308}, {0, -42319, 0, -42319}, {0, -42315, 0, -42315},
+{0, -42305, 0, -42305}, {0, -42258, 0, -42258}, {0, -42282, 0, -42282},
+{0, -42261, 0, -42261}, {0, 928, 0, 928}, {0, -48, 0, -48},
+{0, -42307, 0, -42307}, {0, -35384, 0, -35384}, {-928, 0, -928, 0},
+{-38864, 0, -38864, -38864}, {0, 40, 0, 40}, {-40, 0, -40, 0}, {0, 34, 0, 34},
+{-34, 0, -34, 0},
+};
+const uint16_t _simple_case_delta_ids_stage1[] = {
+0, 64, 128, 128, 192, 128, 128, 256, 320, 384, 128, 448, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 512, 576, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 640,
+128, 704, 128, 768, 128, 128, 832, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 896, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 960, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+};
+const uint16_t _simple_case_delta_ids_stage2[] = {
+0, 0, 0, 0, 16, 32, 48, 64, 0, 0, 0, 80, 96, 112, 128, 144, 160, 160, 160, 176,
+192, 160, 160, 208, 224, 240, 256, 272, 288, 304, 160, 320, 160, 160, 336, 352,
+368, 384, 400, 416, 432, 448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 464, 0, 0, 480, 496,
+16, 512, 48, 528, 544, 160, 560, 576, 96, 96, 128, 128, 592, 160, 160, 608, 160,
+160, 160, 624, 160, 160, 160, 160, 160, 160, 640, 656, 672, 688, 704, 720, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 736, 736, 752, 768, 768, 784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 800, 800, 800, 800, 800, 816, 0, 0, 0, 0, 0, 0, 0, 0, 832, 848, 848, 864, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 880, 896, 0, 0, 0, 0, 0, 0, 0, 160, 160, 160, 160,
+160, 160, 160, 160, 160, 912, 160, 160, 160, 160, 160, 160, 928, 944, 928, 928,
+944, 960, 928, 976, 928, 928, 928, 992, 1008, 1024, 1040, 1056, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1072, 1088, 1104, 0, 1120, 1136, 1152, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1168, 1184,
+1200, 1216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+656, 656, 1232, 704, 704, 1248, 1264, 1280, 160, 160, 160, 160, 160, 160, 1296,
+1312, 1328, 1328, 1344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 160, 160, 1360, 0, 160, 1376, 0, 0, 0, 0, 0, 0, 0, 0,
+1392, 1392, 160, 160, 160, 1408, 1424, 1440, 1456, 1472, 1488, 0, 0, 1504, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1520, 0,
+1536, 1536, 1536, 1536, 1536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 32, 48, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1552, 1552, 1568, 1584, 1584, 0, 0, 0, 0, 0, 0, 1552, 1552, 1600, 1584, 1616, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1632, 1632, 1632, 1648, 1664, 1664, 1664, 1680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 128, 128,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 96, 96, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1696,
+1696, 1712, 1728, 1744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+const uint8_t _simple_case_delta_ids_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2,
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 4, 5, 6,
+5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 8, 5, 6, 5, 6, 5, 6, 0, 5, 6, 5, 6,
+5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+9, 5, 6, 5, 6, 5, 6, 10, 11, 12, 5, 6, 5, 6, 13, 5, 6, 14, 14, 5, 6, 0, 15, 16,
+17, 5, 6, 14, 18, 19, 20, 21, 5, 6, 22, 0, 20, 23, 24, 25, 5, 6, 5, 6, 5, 6, 26,
+5, 6, 26, 0, 0, 5, 6, 26, 5, 6, 27, 27, 5, 6, 5, 6, 28, 5, 6, 0, 0, 5, 6, 0, 29,
+0, 0, 0, 0, 30, 31, 32, 30, 31, 32, 30, 31, 32, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+6, 5, 6, 5, 6, 33, 5, 6, 0, 30, 31, 32, 5, 6, 34, 35, 5, 6, 5, 6, 5, 6, 5, 6,
+36, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0,
+37, 5, 6, 38, 39, 40, 40, 5, 6, 41, 42, 43, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 44,
+45, 46, 47, 48, 0, 49, 49, 0, 50, 0, 51, 52, 0, 0, 0, 49, 53, 0, 54, 0, 55, 56,
+0, 57, 58, 56, 59, 60, 0, 0, 58, 0, 61, 62, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 64,
+0, 0, 65, 0, 66, 65, 0, 0, 0, 67, 65, 68, 69, 69, 70, 0, 0, 0, 0, 0, 71, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 72, 73, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 5, 6, 5, 6, 0, 0, 5, 6, 0, 0, 0, 24, 24, 24, 0, 75, 0, 0, 0, 0, 0, 0, 76, 0,
+77, 77, 77, 0, 78, 0, 79, 79, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 80, 81, 81,
+81, 2, 2, 82, 2, 2, 2, 2, 2, 2, 2, 2, 2, 83, 84, 84, 85, 86, 87, 0, 0, 0, 88,
+89, 90, 5, 6, 5, 6, 5, 6, 5, 6, 91, 92, 93, 94, 95, 96, 0, 5, 6, 97, 5, 6, 0,
+36, 36, 36, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 99,
+99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 5, 6, 0, 0, 0, 0, 0,
+0, 0, 0, 5, 6, 5, 6, 5, 6, 100, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 101,
+0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 103,
+103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+103, 103, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 104, 104, 104, 104, 104, 104,
+104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0,
+104, 0, 0, 0, 0, 0, 104, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+105, 0, 0, 105, 105, 105, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 0, 0, 108, 108, 108, 108,
+108, 108, 0, 0, 109, 110, 111, 112, 112, 113, 114, 115, 116, 0, 0, 0, 0, 0, 0,
+0, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 0, 0, 117, 117, 117,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 120, 0, 5, 6, 5, 6, 5, 6, 0, 0, 0, 0, 0, 121, 0, 0, 122, 0, 123,
+123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 123,
+123, 123, 123, 123, 123, 0, 0, 124, 124, 124, 124, 124, 124, 0, 0, 0, 123, 0,
+123, 0, 123, 0, 123, 0, 124, 0, 124, 0, 124, 0, 124, 125, 125, 126, 126, 126,
+126, 127, 127, 128, 128, 129, 129, 130, 130, 0, 0, 123, 123, 0, 131, 0, 0, 0, 0,
+124, 124, 132, 132, 133, 0, 134, 0, 0, 0, 0, 131, 0, 0, 0, 0, 135, 135, 135,
+135, 133, 0, 0, 0, 123, 123, 0, 0, 0, 0, 0, 0, 124, 124, 136, 136, 0, 0, 0, 0,
+123, 123, 0, 0, 0, 93, 0, 0, 124, 124, 137, 137, 97, 0, 0, 0, 0, 0, 0, 131, 0,
+0, 0, 0, 138, 138, 139, 139, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 0, 0, 0, 141,
+142, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 0, 0, 0, 0, 0, 0, 102, 102,
+102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 103, 103,
+103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 5, 6, 149,
+150, 151, 152, 153, 5, 6, 5, 6, 5, 6, 154, 155, 156, 157, 0, 5, 6, 0, 5, 6, 0,
+0, 0, 0, 0, 0, 0, 158, 158, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 5, 6, 5, 6, 0, 0,
+0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159, 159, 159, 159, 159, 159, 159,
+159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 0,
+159, 0, 0, 0, 0, 0, 159, 0, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0,
+5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+6, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 5, 6, 160, 5, 6, 5, 6, 5, 6, 5,
+6, 5, 6, 0, 0, 0, 5, 6, 161, 0, 0, 5, 6, 5, 6, 162, 0, 5, 6, 5, 6, 5, 6, 5, 6,
+5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 163, 164, 165, 166, 163, 0, 167, 168, 169,
+170, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 5, 6, 171, 172, 173, 5, 6, 5, 6,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177,
+177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+177, 177, 177, 177, 177, 177, 177, 176, 176, 176, 176, 0, 0, 0, 0, 177, 177,
+177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+177, 177, 0, 0, 0, 0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 83, 83, 83, 83,
+83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+179, 179, 179, 179, 179, 179, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
@@ -1,18 +1,330 @@
-const std::unordered_multimap<char32_t, SpecialCasing> _special_case_mappings = {
-{ 0x000003A3, { U"\U000003C2", U"\U000003A3", U"\U000003A3", nullptr, SpecialCasingContext::Final_Sigma } },
-{ 0x00000307, { U"\U00000307", nullptr, nullptr, "lt", SpecialCasingContext::After_Soft_Dotted } },
-{ 0x00000049, { U"\U00000069\U00000307", U"\U00000049", U"\U00000049", "lt", SpecialCasingContext::More_Above } },
-{ 0x0000004A, { U"\U0000006A\U00000307", U"\U0000004A", U"\U0000004A", "lt", SpecialCasingContext::More_Above } },
-{ 0x0000012E, { U"\U0000012F\U00000307", U"\U0000012E", U"\U0000012E", "lt", SpecialCasingContext::More_Above } },
-{ 0x000000CC, { U"\U00000069\U00000307\U00000300", U"\U000000CC", U"\U000000CC", "lt", SpecialCasingContext::Unassigned } },
-{ 0x000000CD, { U"\U00000069\U00000307\U00000301", U"\U000000CD", U"\U000000CD", "lt", SpecialCasingContext::Unassigned } },
-{ 0x00000128, { U"\U00000069\U00000307\U00000303", U"\U00000128", U"\U00000128", "lt", SpecialCasingContext::Unassigned } },
-{ 0x00000130, { U"\U00000069", U"\U00000130", U"\U00000130", "tr", SpecialCasingContext::Unassigned } },
-{ 0x00000130, { U"\U00000069", U"\U00000130", U"\U00000130", "az", SpecialCasingContext::Unassigned } },
-{ 0x00000307, { nullptr, U"\U00000307", U"\U00000307", "tr", SpecialCasingContext::After_I } },
-{ 0x00000307, { nullptr, U"\U00000307", U"\U00000307", "az", SpecialCasingContext::After_I } },
-{ 0x00000049, { U"\U00000131", U"\U00000049", U"\U00000049", "tr", SpecialCasingContext::Not_Before_Dot } },
-{ 0x00000049, { U"\U00000131", U"\U00000049", U"\U00000049", "az", SpecialCasingContext::Not_Before_Dot } },
-{ 0x00000069, { U"\U00000069", U"\U00000130", U"\U00000130", "tr", SpecialCasingContext::Unassigned } },
-{ 0x00000069, { U"\U00000069", U"\U00000130", U"\U00000130", "az", SpecialCasingContext::Unassigned } },
+static_assert(static_cast<int>(SpecialCasingContext::Unassigned) == 0, "");
+static_assert(static_cast<int>(SpecialCasingContext::Final_Sigma) == 1, "");
+static_assert(static_cast<int>(SpecialCasingContext::Not_Final_Sigma) == 2, "");
+static_assert(static_cast<int>(SpecialCasingContext::After_Soft_Dotted) == 3, "");
+static_assert(static_cast<int>(SpecialCasingContext::More_Above) == 4, "");
+static_assert(static_cast<int>(SpecialCasingContext::Before_Dot) == 5, "");
+static_assert(static_cast<int>(SpecialCasingContext::Not_Before_Dot) == 6, "");
+static_assert(static_cast<int>(SpecialCasingContext::After_I) == 7, "");
+const char32_t _special_case_mapping_pool[] = {
+0x00000000, 0x00000069, 0x00000307, 0x00000000, 0x00000049, 0x00000000,
+0x00000131, 0x00000000, 0x0000006A, 0x00000307, 0x00000000, 0x0000004A,
+0x00000000, 0x00000069, 0x00000000, 0x00000130, 0x00000000, 0x00000069,
+0x00000307, 0x00000300, 0x00000000, 0x000000CC, 0x00000000, 0x00000069,
+0x00000307, 0x00000301, 0x00000000, 0x000000CD, 0x00000000, 0x000000DF,
+0x00000000, 0x00000053, 0x00000073, 0x00000000, 0x00000053, 0x00000053,
+0x00000000, 0x00000069, 0x00000307, 0x00000303, 0x00000000, 0x00000128,
+0x00000000, 0x0000012F, 0x00000307, 0x00000000, 0x0000012E, 0x00000000,
+0x00000149, 0x00000000, 0x000002BC, 0x0000004E, 0x00000000, 0x000001F0,
+0x00000000, 0x0000004A, 0x0000030C, 0x00000000, 0x00000307, 0x00000000,
+0x00000390, 0x00000000, 0x00000399, 0x00000308, 0x00000301, 0x00000000,
+0x000003C2, 0x00000000, 0x000003A3, 0x00000000, 0x000003B0, 0x00000000,
+0x000003A5, 0x00000308, 0x00000301, 0x00000000, 0x00000587, 0x00000000,
+0x00000535, 0x00000582, 0x00000000, 0x00000535, 0x00000552, 0x00000000,
+0x00001E96, 0x00000000, 0x00000048, 0x00000331, 0x00000000, 0x00001E97,
+0x00000000, 0x00000054, 0x00000308, 0x00000000, 0x00001E98, 0x00000000,
+0x00000057, 0x0000030A, 0x00000000, 0x00001E99, 0x00000000, 0x00000059,
+0x0000030A, 0x00000000, 0x00001E9A, 0x00000000, 0x00000041, 0x000002BE,
+0x00000000, 0x00001F50, 0x00000000, 0x000003A5, 0x00000313, 0x00000000,
+0x00001F52, 0x00000000, 0x000003A5, 0x00000313, 0x00000300, 0x00000000,
+0x00001F54, 0x00000000, 0x000003A5, 0x00000313, 0x00000301, 0x00000000,
+0x00001F56, 0x00000000, 0x000003A5, 0x00000313, 0x00000342, 0x00000000,
+0x00001F80, 0x00000000, 0x00001F88, 0x00000000, 0x00001F08, 0x00000399,
+0x00000000, 0x00001F81, 0x00000000, 0x00001F89, 0x00000000, 0x00001F09,
+0x00000399, 0x00000000, 0x00001F82, 0x00000000, 0x00001F8A, 0x00000000,
+0x00001F0A, 0x00000399, 0x00000000, 0x00001F83, 0x00000000, 0x00001F8B,
+0x00000000, 0x00001F0B, 0x00000399, 0x00000000, 0x00001F84, 0x00000000,
+0x00001F8C, 0x00000000, 0x00001F0C, 0x00000399, 0x00000000, 0x00001F85,
+0x00000000, 0x00001F8D, 0x00000000, 0x00001F0D, 0x00000399, 0x00000000,
+0x00001F86, 0x00000000, 0x00001F8E, 0x00000000, 0x00001F0E, 0x00000399,
+0x00000000, 0x00001F87, 0x00000000, 0x00001F8F, 0x00000000, 0x00001F0F,
+0x00000399, 0x00000000, 0x00001F90, 0x00000000, 0x00001F98, 0x00000000,
+0x00001F28, 0x00000399, 0x00000000, 0x00001F91, 0x00000000, 0x00001F99,
+0x00000000, 0x00001F29, 0x00000399, 0x00000000, 0x00001F92, 0x00000000,
+0x00001F9A, 0x00000000, 0x00001F2A, 0x00000399, 0x00000000, 0x00001F93,
+0x00000000, 0x00001F9B, 0x00000000, 0x00001F2B, 0x00000399, 0x00000000,
+0x00001F94, 0x00000000, 0x00001F9C, 0x00000000, 0x00001F2C, 0x00000399,
+0x00000000, 0x00001F95, 0x00000000, 0x00001F9D, 0x00000000, 0x00001F2D,
+0x00000399, 0x00000000, 0x00001F96, 0x00000000, 0x00001F9E, 0x00000000,
+0x00001F2E, 0x00000399, 0x00000000, 0x00001F97, 0x00000000, 0x00001F9F,
+0x00000000, 0x00001F2F, 0x00000399, 0x00000000, 0x00001FA0, 0x00000000,
+0x00001FA8, 0x00000000, 0x00001F68, 0x00000399, 0x00000000, 0x00001FA1,
+0x00000000, 0x00001FA9, 0x00000000, 0x00001F69, 0x00000399, 0x00000000,
+0x00001FA2, 0x00000000, 0x00001FAA, 0x00000000, 0x00001F6A, 0x00000399,
+0x00000000, 0x00001FA3, 0x00000000, 0x00001FAB, 0x00000000, 0x00001F6B,
+0x00000399, 0x00000000, 0x00001FA4, 0x00000000, 0x00001FAC, 0x00000000,
+0x00001F6C, 0x00000399, 0x00000000, 0x00001FA5, 0x00000000, 0x00001FAD,
+0x00000000, 0x00001F6D, 0x00000399, 0x00000000, 0x00001FA6, 0x00000000,
+0x00001FAE, 0x00000000, 0x00001F6E, 0x00000399, 0x00000000, 0x00001FA7,
+0x00000000, 0x00001FAF, 0x00000000, 0x00001F6F, 0x00000399, 0x00000000,
+0x00001FB2, 0x00000000, 0x00001FBA, 0x00000345, 0x00000000, 0x00001FBA,
+0x00000399, 0x00000000, 0x00001FB3, 0x00000000, 0x00001FBC, 0x00000000,
+0x00000391, 0x00000399, 0x00000000, 0x00001FB4, 0x00000000, 0x00000386,
+0x00000345, 0x00000000, 0x00000386, 0x00000399, 0x00000000, 0x00001FB6,
+0x00000000, 0x00000391, 0x00000342, 0x00000000, 0x00001FB7, 0x00000000,
+0x00000391, 0x00000342, 0x00000345, 0x00000000, 0x00000391, 0x00000342,
+0x00000399, 0x00000000, 0x00001FC2, 0x00000000, 0x00001FCA, 0x00000345,
+0x00000000, 0x00001FCA, 0x00000399, 0x00000000, 0x00001FC3, 0x00000000,
+0x00001FCC, 0x00000000, 0x00000397, 0x00000399, 0x00000000, 0x00001FC4,
+0x00000000, 0x00000389, 0x00000345, 0x00000000, 0x00000389, 0x00000399,
+0x00000000, 0x00001FC6, 0x00000000, 0x00000397, 0x00000342, 0x00000000,
+0x00001FC7, 0x00000000, 0x00000397, 0x00000342, 0x00000345, 0x00000000,
+0x00000397, 0x00000342, 0x00000399, 0x00000000, 0x00001FD2, 0x00000000,
+0x00000399, 0x00000308, 0x00000300, 0x00000000, 0x00001FD3, 0x00000000,
+0x00001FD6, 0x00000000, 0x00000399, 0x00000342, 0x00000000, 0x00001FD7,
+0x00000000, 0x00000399, 0x00000308, 0x00000342, 0x00000000, 0x00001FE2,
+0x00000000, 0x000003A5, 0x00000308, 0x00000300, 0x00000000, 0x00001FE3,
+0x00000000, 0x00001FE4, 0x00000000, 0x000003A1, 0x00000313, 0x00000000,
+0x00001FE6, 0x00000000, 0x000003A5, 0x00000342, 0x00000000, 0x00001FE7,
+0x00000000, 0x000003A5, 0x00000308, 0x00000342, 0x00000000, 0x00001FF2,
+0x00000000, 0x00001FFA, 0x00000345, 0x00000000, 0x00001FFA, 0x00000399,
+0x00000000, 0x00001FF3, 0x00000000, 0x00001FFC, 0x00000000, 0x000003A9,
+0x00000399, 0x00000000, 0x00001FF4, 0x00000000, 0x0000038F, 0x00000345,
+0x00000000, 0x0000038F, 0x00000399, 0x00000000, 0x00001FF6, 0x00000000,
+0x000003A9, 0x00000342, 0x00000000, 0x00001FF7, 0x00000000, 0x000003A9,
+0x00000342, 0x00000345, 0x00000000, 0x000003A9, 0x00000342, 0x00000399,
+0x00000000, 0x0000FB00, 0x00000000, 0x00000046, 0x00000066, 0x00000000,
+0x00000046, 0x00000046, 0x00000000, 0x0000FB01, 0x00000000, 0x00000046,
+0x00000069, 0x00000000, 0x00000046, 0x00000049, 0x00000000, 0x0000FB02,
+0x00000000, 0x00000046, 0x0000006C, 0x00000000, 0x00000046, 0x0000004C,
+0x00000000, 0x0000FB03, 0x00000000, 0x00000046, 0x00000066, 0x00000069,
+0x00000000, 0x00000046, 0x00000046, 0x00000049, 0x00000000, 0x0000FB04,
+0x00000000, 0x00000046, 0x00000066, 0x0000006C, 0x00000000, 0x00000046,
+0x00000046, 0x0000004C, 0x00000000, 0x0000FB05, 0x00000000, 0x00000053,
+0x00000074, 0x00000000, 0x00000053, 0x00000054, 0x00000000, 0x0000FB06,
+0x00000000, 0x0000FB13, 0x00000000, 0x00000544, 0x00000576, 0x00000000,
+0x00000544, 0x00000546, 0x00000000, 0x0000FB14, 0x00000000, 0x00000544,
+0x00000565, 0x00000000, 0x00000544, 0x00000535, 0x00000000, 0x0000FB15,
+0x00000000, 0x00000544, 0x0000056B, 0x00000000, 0x00000544, 0x0000053B,
+0x00000000, 0x0000FB16, 0x00000000, 0x0000054E, 0x00000576, 0x00000000,
+0x0000054E, 0x00000546, 0x00000000, 0x0000FB17, 0x00000000, 0x00000544,
+0x0000056D, 0x00000000, 0x00000544, 0x0000053D, 0x00000000,
+};
+const SpecialCasing _special_case_mappings[] = {
+{ 0x00000000, 0, 0, 0, "", SpecialCasingContext::Unassigned },
+{ 0x00000049, 1, 4, 4, "lt", SpecialCasingContext::More_Above },
+{ 0x00000049, 6, 4, 4, "tr", SpecialCasingContext::Not_Before_Dot },
+{ 0x00000049, 6, 4, 4, "az", SpecialCasingContext::Not_Before_Dot },
+{ 0x0000004A, 8, 11, 11, "lt", SpecialCasingContext::More_Above },
+{ 0x00000069, 13, 15, 15, "tr", SpecialCasingContext::Unassigned },
+{ 0x00000069, 13, 15, 15, "az", SpecialCasingContext::Unassigned },
+{ 0x000000CC, 17, 21, 21, "lt", SpecialCasingContext::Unassigned },
+{ 0x000000CD, 23, 27, 27, "lt", SpecialCasingContext::Unassigned },
+{ 0x000000DF, 29, 31, 34, "", SpecialCasingContext::Unassigned },
+{ 0x00000128, 37, 41, 41, "lt", SpecialCasingContext::Unassigned },
+{ 0x0000012E, 43, 46, 46, "lt", SpecialCasingContext::More_Above },
+{ 0x00000130, 13, 15, 15, "tr", SpecialCasingContext::Unassigned },
+{ 0x00000130, 13, 15, 15, "az", SpecialCasingContext::Unassigned },
+{ 0x00000130, 1, 15, 15, "", SpecialCasingContext::Unassigned },
+{ 0x00000149, 48, 50, 50, "", SpecialCasingContext::Unassigned },
+{ 0x000001F0, 53, 55, 55, "", SpecialCasingContext::Unassigned },
+{ 0x00000307, 58, 0, 0, "lt", SpecialCasingContext::After_Soft_Dotted },
+{ 0x00000307, 0, 58, 58, "tr", SpecialCasingContext::After_I },
+{ 0x00000307, 0, 58, 58, "az", SpecialCasingContext::After_I },
+{ 0x00000390, 60, 62, 62, "", SpecialCasingContext::Unassigned },
+{ 0x000003A3, 66, 68, 68, "", SpecialCasingContext::Final_Sigma },
+{ 0x000003B0, 70, 72, 72, "", SpecialCasingContext::Unassigned },
+{ 0x00000587, 76, 78, 81, "", SpecialCasingContext::Unassigned },
+{ 0x00001E96, 84, 86, 86, "", SpecialCasingContext::Unassigned },
+{ 0x00001E97, 89, 91, 91, "", SpecialCasingContext::Unassigned },
+{ 0x00001E98, 94, 96, 96, "", SpecialCasingContext::Unassigned },
+{ 0x00001E99, 99, 101, 101, "", SpecialCasingContext::Unassigned },
+{ 0x00001E9A, 104, 106, 106, "", SpecialCasingContext::Unassigned },
+{ 0x00001F50, 109, 111, 111, "", SpecialCasingContext::Unassigned },
+{ 0x00001F52, 114, 116, 116, "", SpecialCasingContext::Unassigned },
+{ 0x00001F54, 120, 122, 122, "", SpecialCasingContext::Unassigned },
+{ 0x00001F56, 126, 128, 128, "", SpecialCasingContext::Unassigned },
+{ 0x00001F80, 132, 134, 136, "", SpecialCasingContext::Unassigned },
+{ 0x00001F81, 139, 141, 143, "", SpecialCasingContext::Unassigned },
+{ 0x00001F82, 146, 148, 150, "", SpecialCasingContext::Unassigned },
+{ 0x00001F83, 153, 155, 157, "", SpecialCasingContext::Unassigned },
+{ 0x00001F84, 160, 162, 164, "", SpecialCasingContext::Unassigned },
+{ 0x00001F85, 167, 169, 171, "", SpecialCasingContext::Unassigned },
+{ 0x00001F86, 174, 176, 178, "", SpecialCasingContext::Unassigned },
+{ 0x00001F87, 181, 183, 185, "", SpecialCasingContext::Unassigned },
+{ 0x00001F88, 132, 134, 136, "", SpecialCasingContext::Unassigned },
+{ 0x00001F89, 139, 141, 143, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8A, 146, 148, 150, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8B, 153, 155, 157, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8C, 160, 162, 164, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8D, 167, 169, 171, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8E, 174, 176, 178, "", SpecialCasingContext::Unassigned },
+{ 0x00001F8F, 181, 183, 185, "", SpecialCasingContext::Unassigned },
+{ 0x00001F90, 188, 190, 192, "", SpecialCasingContext::Unassigned },
+{ 0x00001F91, 195, 197, 199, "", SpecialCasingContext::Unassigned },
+{ 0x00001F92, 202, 204, 206, "", SpecialCasingContext::Unassigned },
+{ 0x00001F93, 209, 211, 213, "", SpecialCasingContext::Unassigned },
+{ 0x00001F94, 216, 218, 220, "", SpecialCasingContext::Unassigned },
+{ 0x00001F95, 223, 225, 227, "", SpecialCasingContext::Unassigned },
+{ 0x00001F96, 230, 232, 234, "", SpecialCasingContext::Unassigned },
+{ 0x00001F97, 237, 239, 241, "", SpecialCasingContext::Unassigned },
+{ 0x00001F98, 188, 190, 192, "", SpecialCasingContext::Unassigned },
+{ 0x00001F99, 195, 197, 199, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9A, 202, 204, 206, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9B, 209, 211, 213, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9C, 216, 218, 220, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9D, 223, 225, 227, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9E, 230, 232, 234, "", SpecialCasingContext::Unassigned },
+{ 0x00001F9F, 237, 239, 241, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA0, 244, 246, 248, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA1, 251, 253, 255, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA2, 258, 260, 262, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA3, 265, 267, 269, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA4, 272, 274, 276, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA5, 279, 281, 283, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA6, 286, 288, 290, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA7, 293, 295, 297, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA8, 244, 246, 248, "", SpecialCasingContext::Unassigned },
+{ 0x00001FA9, 251, 253, 255, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAA, 258, 260, 262, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAB, 265, 267, 269, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAC, 272, 274, 276, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAD, 279, 281, 283, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAE, 286, 288, 290, "", SpecialCasingContext::Unassigned },
+{ 0x00001FAF, 293, 295, 297, "", SpecialCasingContext::Unassigned },
+{ 0x00001FB2, 300, 302, 305, "", SpecialCasingContext::Unassigned },
+{ 0x00001FB3, 308, 310, 312, "", SpecialCasingContext::Unassigned },
+{ 0x00001FB4, 315, 317, 320, "", SpecialCasingContext::Unassigned },
+{ 0x00001FB6, 323, 325, 325, "", SpecialCasingContext::Unassigned },
+{ 0x00001FB7, 328, 330, 334, "", SpecialCasingContext::Unassigned },
+{ 0x00001FBC, 308, 310, 312, "", SpecialCasingContext::Unassigned },
+{ 0x00001FC2, 338, 340, 343, "", SpecialCasingContext::Unassigned },
+{ 0x00001FC3, 346, 348, 350, "", SpecialCasingContext::Unassigned },
+{ 0x00001FC4, 353, 355, 358, "", SpecialCasingContext::Unassigned },
+{ 0x00001FC6, 361, 363, 363, "", SpecialCasingContext::Unassigned },
+{ 0x00001FC7, 366, 368, 372, "", SpecialCasingContext::Unassigned },
+{ 0x00001FCC, 346, 348, 350, "", SpecialCasingContext::Unassigned },
+{ 0x00001FD2, 376, 378, 378, "", SpecialCasingContext::Unassigned },
+{ 0x00001FD3, 382, 62, 62, "", SpecialCasingContext::Unassigned },
+{ 0x00001FD6, 384, 386, 386, "", SpecialCasingContext::Unassigned },
+{ 0x00001FD7, 389, 391, 391, "", SpecialCasingContext::Unassigned },
+{ 0x00001FE2, 395, 397, 397, "", SpecialCasingContext::Unassigned },
+{ 0x00001FE3, 401, 72, 72, "", SpecialCasingContext::Unassigned },
+{ 0x00001FE4, 403, 405, 405, "", SpecialCasingContext::Unassigned },
+{ 0x00001FE6, 408, 410, 410, "", SpecialCasingContext::Unassigned },
+{ 0x00001FE7, 413, 415, 415, "", SpecialCasingContext::Unassigned },
+{ 0x00001FF2, 419, 421, 424, "", SpecialCasingContext::Unassigned },
+{ 0x00001FF3, 427, 429, 431, "", SpecialCasingContext::Unassigned },
+{ 0x00001FF4, 434, 436, 439, "", SpecialCasingContext::Unassigned },
+{ 0x00001FF6, 442, 444, 444, "", SpecialCasingContext::Unassigned },
+{ 0x00001FF7, 447, 449, 453, "", SpecialCasingContext::Unassigned },
+{ 0x00001FFC, 427, 429, 431, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB00, 457, 459, 462, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB01, 465, 467, 470, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB02, 473, 475, 478, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB03, 481, 483, 487, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB04, 491, 493, 497, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB05, 501, 503, 506, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB06, 509, 503, 506, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB13, 511, 513, 516, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB14, 519, 521, 524, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB15, 527, 529, 532, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB16, 535, 537, 540, "", SpecialCasingContext::Unassigned },
+{ 0x0000FB17, 543, 545, 548, "", SpecialCasingContext::Unassigned },
+{ 0x00000000, 0, 0, 0, "", SpecialCasingContext::Unassigned },
+};
+const uint16_t _special_case_mapping_ids_stage1[] = {
+0, 64, 128, 128, 128, 128, 128, 192, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 256, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+};
+const uint16_t _special_case_mapping_ids_stage2[] = {
+0, 0, 0, 0, 16, 0, 32, 0, 0, 0, 0, 0, 48, 64, 0, 0, 0, 0, 80, 96, 112, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144,
+0, 0, 0, 0, 0, 0, 0, 0, 160, 176, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 256, 272, 288, 304, 320, 336, 352,
+368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 400,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+const uint8_t _special_case_mapping_ids_stage3[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 11, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0,
+0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 28, 0,
+0, 0, 0, 0, 29, 0, 30, 0, 31, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 34, 35, 36,
+37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+77, 78, 79, 80, 0, 0, 81, 82, 83, 0, 84, 85, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 87,
+88, 89, 0, 90, 91, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 93, 94, 0, 0, 95, 96, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 97, 98, 99, 0, 100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+103, 104, 0, 105, 106, 0, 0, 0, 0, 107, 0, 0, 0, 108, 109, 110, 111, 112, 113,
+114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 116, 117, 118, 119, 0, 0, 0, 0, 0,
+0, 0, 0,
 };
@@ -0,0 +1 @@
+const char _unicode_version[] = "13.0.0";
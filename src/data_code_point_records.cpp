@@ -1,7 +1,7 @@
 #include "unicodelib_data.h"
 
 namespace unicode {
-#include "_script_extension_ids.cpp"
+#include "_code_point_records.cpp"
 }  // namespace unicode
 
 // vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -1,7 +1,7 @@
 #include "unicodelib_data.h"
 
 namespace unicode {
-#include "_sentence_break_properties.cpp"
+#include "_combining_class_properties.cpp"
 }  // namespace unicode
 
 // vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -1,7 +1,7 @@
 #include "unicodelib_data.h"
 
 namespace unicode {
-#include "_normalization_properties.cpp"
+#include "_decomposition_properties.cpp"
 }  // namespace unicode
 
 // vim: et ts=2 sw=2 cin cino=\:0 ff=unix
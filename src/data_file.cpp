@@ -0,0 +1,489 @@
+#include "unicodelib_data.h"
+
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Data Context
+//-----------------------------------------------------------------------------
+
+// The layout written by 'write_data_file' in 'scripts/gen_tables.py'. A header
+// is followed by the section entries, and each section is an array of the
+// element type the library uses, so that it can be read in place.
+struct DataFileHeader {
+  char magic[8];
+  uint32_t format_version;
+  uint32_t byte_order;
+  char unicode_version[16];
+  uint32_t section_count;
+  uint32_t reserved;
+};
+
+struct DataFileSection {
+  char name[48];
+  uint32_t element_size;
+  uint32_t count;
+  uint32_t offset;
+  uint32_t reserved;
+};
+
+static const char DataFileMagic[8] = {'U', 'C', 'D', 'T', 'A', 'B', 'L', 'E'};
+static const uint32_t DataFileFormatVersion = 4;
+static const uint32_t DataFileByteOrder = 0x01020304;
+
+static const size_t TrieStage1Count = 0x110000 >> CodePointTrie<int>::Shift1;
+static const size_t TrieStage2BlockSize =
+    1 << (CodePointTrie<int>::Shift1 - CodePointTrie<int>::Shift2);
+static const size_t TrieStage3BlockSize = 1 << CodePointTrie<int>::Shift2;
+
+// The number of values of each enum that a file stores, so that a value the
+// library would index a table or shift a mask with is in range.
+static const size_t GeneralCategoryCount =
+    static_cast<size_t>(GeneralCategory::Cn) + 1;
+static const size_t GraphemeBreakCount =
+    static_cast<size_t>(GraphemeBreak::ZWJ) + 1;
+static const size_t WordBreakCount =
+    static_cast<size_t>(WordBreak::WSegSpace) + 1;
+static const size_t SentenceBreakCount =
+    static_cast<size_t>(SentenceBreak::SContinue) + 1;
+static const size_t BlockCount =
+    static_cast<size_t>(Block::SupplementaryPrivateUseAreaB) + 1;
+static const size_t ScriptCount = static_cast<size_t>(Script::Yezidi) + 1;
+
+struct DataFile {
+  const char *data;
+  size_t size;
+  const DataFileHeader *header;
+};
+
+static bool read_header(const char *data, size_t size, DataFile &file) {
+  if (size < sizeof(DataFileHeader)) {
+    return false;
+  }
+  auto header = reinterpret_cast<const DataFileHeader *>(data);
+  if (memcmp(header->magic, DataFileMagic, sizeof(DataFileMagic)) ||
+      header->format_version != DataFileFormatVersion ||
+      header->byte_order != DataFileByteOrder ||
+      header->unicode_version[sizeof(header->unicode_version) - 1] != 0 ||
+      header->section_count >
+          (size - sizeof(DataFileHeader)) / sizeof(DataFileSection)) {
+    return false;
+  }
+  file.data = data;
+  file.size = size;
+  file.header = header;
+  return true;
+}
+
+template <typename T>
+static bool read_array(const DataFile &file, const std::string &name,
+                       const T *&values, size_t &count) {
+  auto sections = reinterpret_cast<const DataFileSection *>(file.header + 1);
+  for (uint32_t i = 0; i < file.header->section_count; i++) {
+    const auto &section = sections[i];
+    if (strncmp(section.name, name.c_str(), sizeof(section.name))) {
+      continue;
+    }
+    if (section.element_size != sizeof(T) || section.count == 0 ||
+        section.offset % alignof(T) != 0 || section.offset > file.size ||
+        section.count > (file.size - section.offset) / sizeof(T)) {
+      return false;
+    }
+    values = reinterpret_cast<const T *>(file.data + section.offset);
+    count = section.count;
+    return true;
+  }
+  return false;
+}
+
+template <typename T>
+static bool all_below(const T *values, size_t count, size_t limit) {
+  for (size_t i = 0; i < count; i++) {
+    if (static_cast<size_t>(values[i]) >= limit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks that every stage refers to a whole block of the next stage. 'values'
+// and 'count' are set to the last stage.
+template <typename T>
+static bool read_trie(const DataFile &file, const std::string &name,
+                      CodePointTrie<T> &trie, const T *&values,
+                      size_t &count) {
+  size_t count1 = 0;
+  size_t count2 = 0;
+  if (!read_array(file, name + "_stage1", trie.stage1, count1) ||
+      !read_array(file, name + "_stage2", trie.stage2, count2) ||
+      !read_array(file, name + "_stage3", trie.stage3, count) ||
+      count1 != TrieStage1Count || count2 < TrieStage2BlockSize ||
+      count < TrieStage3BlockSize) {
+    return false;
+  }
+  values = trie.stage3;
+  return all_below(trie.stage1, count1, count2 - TrieStage2BlockSize + 1) &&
+         all_below(trie.stage2, count2, count - TrieStage3BlockSize + 1);
+}
+
+template <typename T>
+static bool read_trie(const DataFile &file, const std::string &name,
+                      CodePointTrie<T> &trie) {
+  const T *values = nullptr;
+  size_t count = 0;
+  return read_trie(file, name, trie, values, count);
+}
+
+// A trie of indexes into an array of 'limit' elements, or of enum values
+// below 'limit'.
+template <typename T>
+static bool read_index_trie(const DataFile &file, const std::string &name,
+                            CodePointTrie<T> &trie, size_t limit) {
+  const T *values = nullptr;
+  size_t count = 0;
+  return read_trie(file, name, trie, values, count) &&
+         all_below(values, count, limit);
+}
+
+// Zero-terminated strings in a pool can't run past its end.
+static bool is_terminated(const char32_t *pool, size_t count) {
+  return pool[count - 1] == 0;
+}
+
+// The offsets must be increasing and end at the number of ranges, and every
+// range must be in the code space.
+static bool read_ranges(const DataFile &file, const std::string &name,
+                        PropertyRanges &index) {
+  size_t count = 0;
+  size_t offset_count = 0;
+  if (!read_array(file, name + "_ranges", index.ranges, count) ||
+      !read_array(file, name + "_range_offsets", index.offsets, offset_count) ||
+      index.offsets[0] != 0 || index.offsets[offset_count - 1] != count) {
+    return false;
+  }
+  for (size_t i = 1; i < offset_count; i++) {
+    if (index.offsets[i] < index.offsets[i - 1]) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < count; i++) {
+    const auto &r = index.ranges[i];
+    if (r.first > r.last || r.last > 0x10FFFF) {
+      return false;
+    }
+  }
+  index.value_count = offset_count - 1;
+  return true;
+}
+
+static const size_t RangeIndexCount = 8;
+
+static bool read_range_indexes(const DataFile &file, DataTables &t,
+                               PropertyRanges *indexes) {
+  static const char *const names[RangeIndexCount] = {
+      "_general_category", "_property",       "_derived_core_property",
+      "_grapheme_break",   "_word_break",     "_sentence_break",
+      "_block",            "_script",
+  };
+  const PropertyRanges **fields[RangeIndexCount] = {
+      &t.general_category_ranges, &t.property_ranges,
+      &t.derived_core_property_ranges, &t.grapheme_break_ranges,
+      &t.word_break_ranges, &t.sentence_break_ranges,
+      &t.block_ranges, &t.script_ranges,
+  };
+  for (size_t i = 0; i < RangeIndexCount; i++) {
+    if (!read_ranges(file, names[i], indexes[i])) {
+      return false;
+    }
+    *fields[i] = &indexes[i];
+  }
+  return true;
+}
+
+// Decompositions are expanded recursively, so one must not lead back to a
+// code point it started from, and every code point in one must be in the code
+// space. 'state' is 1 while the decomposition of a code point is expanded and
+// 2 once it is known to end. The expansion keeps its own stack, as a file may
+// chain decompositions deeply.
+static bool has_acyclic_decompositions(const DataTables &t) {
+  std::vector<uint8_t> state(0x110000);
+  std::vector<std::pair<char32_t, size_t>> stack;
+  auto expand = [&](char32_t cp) {
+    if (auto decomposition = t.decomposition_properties[cp]) {
+      state[cp] = 1;
+      stack.emplace_back(cp, decomposition >> 1);
+    } else {
+      state[cp] = 2;
+    }
+  };
+  for (char32_t cp = 0; cp < 0x110000; cp++) {
+    if (state[cp]) {
+      continue;
+    }
+    expand(cp);
+    while (!stack.empty()) {
+      auto &top = stack.back();
+      auto code = t.decomposition_pool[top.second];
+      if (!code) {
+        state[top.first] = 2;
+        stack.pop_back();
+        continue;
+      }
+      top.second++;
+      if (code > 0x10FFFF || state[code] == 1) {
+        return false;
+      }
+      if (!state[code]) {
+        expand(code);
+      }
+    }
+  }
+  return true;
+}
+
+// Builds the records of the inline fast paths from the other tables, as
+// 'genLatin1RecordTable' in 'scripts/gen_tables.py' does.
+static bool build_latin1_records(const DataTables &t, Latin1Record *records) {
+  for (char32_t cp = 0; cp < 0x100; cp++) {
+    auto &r = records[cp];
+    r.properties = t.properties[cp];
+    r.derived_properties = t.derived_core_properties[cp];
+    r.general_category = t.general_category_properties[cp];
+
+    const auto &d = t.simple_case_deltas[t.simple_case_delta_ids[cp]];
+    auto upper = static_cast<char32_t>(static_cast<int32_t>(cp) + d.upper);
+    auto lower = static_cast<char32_t>(static_cast<int32_t>(cp) + d.lower);
+    auto title = static_cast<char32_t>(static_cast<int32_t>(cp) + d.title);
+    auto folding = static_cast<char32_t>(static_cast<int32_t>(cp) + d.folding);
+    if (upper > 0xFFFF || lower > 0xFFFF || title > 0xFFFF ||
+        folding > 0xFFFF) {
+      return false;
+    }
+    r.simple_uppercase_mapping = static_cast<uint16_t>(upper);
+    r.simple_lowercase_mapping = static_cast<uint16_t>(lower);
+    r.simple_titlecase_mapping = static_cast<uint16_t>(title);
+    r.simple_case_folding = static_cast<uint16_t>(folding);
+  }
+  return true;
+}
+
+static bool read_tables(const DataFile &file, DataTables &t) {
+  t.unicode_version = file.header->unicode_version;
+
+  if (!read_index_trie(file, "_general_category_properties",
+                       t.general_category_properties, GeneralCategoryCount) ||
+      !read_trie(file, "_properties", t.properties) ||
+      !read_trie(file, "_derived_core_properties",
+                 t.derived_core_properties) ||
+      !read_index_trie(file, "_block_properties", t.block_properties,
+                       BlockCount) ||
+      !read_index_trie(file, "_script_properties", t.script_properties,
+                       ScriptCount) ||
+      !read_trie(file, "_combining_class_properties",
+                 t.combining_class_properties) ||
+      !read_trie(file, "_emoji_properties", t.emoji_properties)) {
+    return false;
+  }
+
+  size_t count = 0;
+  size_t pool_count = 0;
+
+  // Simple case mappings
+  if (!read_array(file, "_simple_case_deltas", t.simple_case_deltas, count) ||
+      !read_index_trie(file, "_simple_case_delta_ids", t.simple_case_delta_ids,
+                       count)) {
+    return false;
+  }
+
+  // Special case mappings. The rows of a code point are read up to a row of
+  // another code point, so the last row must be the zero terminator.
+  if (!read_array(file, "_special_case_mapping_pool",
+                  t.special_case_mapping_pool, pool_count) ||
+      !is_terminated(t.special_case_mapping_pool, pool_count) ||
+      !read_array(file, "_special_case_mappings", t.special_case_mappings,
+                  count) ||
+      t.special_case_mappings[count - 1].code != 0 ||
+      !read_index_trie(file, "_special_case_mapping_ids",
+                       t.special_case_mapping_ids, count)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    const auto &sc = t.special_case_mappings[i];
+    if (sc.lower >= pool_count || sc.title >= pool_count ||
+        sc.upper >= pool_count || sc.language[sizeof(sc.language) - 1]) {
+      return false;
+    }
+  }
+  // Row 0 is the empty row, and the rows up to the terminator are sorted by
+  // their code points, which the ASCII scan in 'has_ascii_special_casing'
+  // relies on. The id of a code point must lead to its own rows, as they are
+  // read while the code point matches.
+  if (count < 2 || t.special_case_mappings[0].code != 0) {
+    return false;
+  }
+  for (size_t i = 1; i + 1 < count; i++) {
+    auto code = t.special_case_mappings[i].code;
+    if (code == 0 || code < t.special_case_mappings[i - 1].code) {
+      return false;
+    }
+  }
+  for (char32_t cp = 0; cp < 0x110000; cp++) {
+    auto id = t.special_case_mapping_ids[cp];
+    if (id && t.special_case_mappings[id].code != cp) {
+      return false;
+    }
+  }
+
+  // Case foldings
+  if (!read_array(file, "_case_folding_pool", t.case_folding_pool,
+                  pool_count) ||
+      !is_terminated(t.case_folding_pool, pool_count) ||
+      !read_array(file, "_case_folding_values", t.case_folding_values,
+                  count) ||
+      !read_index_trie(file, "_case_foldings", t.case_foldings, count)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (t.case_folding_values[i].F >= pool_count) {
+      return false;
+    }
+  }
+
+  // Script extensions
+  if (!read_array(file, "_script_extension_sets", t.script_extension_sets,
+                  count) ||
+      !read_index_trie(file, "_script_extension_ids", t.script_extension_ids,
+                       count)) {
+    return false;
+  }
+
+  // Decompositions, stored as 'offset << 1 | compat'
+  if (!read_array(file, "_decomposition_pool", t.decomposition_pool,
+                  pool_count) ||
+      !is_terminated(t.decomposition_pool, pool_count) ||
+      !read_index_trie(file, "_decomposition_properties",
+                       t.decomposition_properties, pool_count * 2) ||
+      !has_acyclic_decompositions(t)) {
+    return false;
+  }
+
+  // Compositions. The pairs of a code point are read two at a time up to a
+  // zero.
+  const uint16_t *offsets = nullptr;
+  if (!read_array(file, "_normalization_composition_pairs",
+                  t.normalization_composition_pairs, pool_count) ||
+      !read_trie(file, "_normalization_composition",
+                 t.normalization_composition, offsets, count)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    size_t offset = offsets[i];
+    while (offset < pool_count && t.normalization_composition_pairs[offset]) {
+      offset += 2;
+    }
+    if (offset >= pool_count) {
+      return false;
+    }
+  }
+
+  // Code point records
+  if (!read_array(file, "_code_point_records", t.code_point_records,
+                  count) ||
+      !read_index_trie(file, "_code_point_record_ids", t.code_point_record_ids,
+                       count)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    const auto &r = t.code_point_records[i];
+    if (static_cast<size_t>(r.general_category) >= GeneralCategoryCount ||
+        static_cast<size_t>(r.grapheme_break) >= GraphemeBreakCount ||
+        static_cast<size_t>(r.word_break) >= WordBreakCount ||
+        static_cast<size_t>(r.sentence_break) >= SentenceBreakCount) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+DataContext builtin_data_context() { return &_builtin_tables; }
+
+DataContext load_data_context(const char *path) {
+#if defined(_WIN32)
+  (void)path;
+  return nullptr;
+#else
+  auto fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  auto size = static_cast<size_t>(st.st_size);
+  auto addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+
+  // The tables point into the mapping, so neither is ever released.
+  struct MappedTables {
+    DataTables tables;
+    Latin1Record latin1_records[0x100];
+    PropertyRanges range_indexes[RangeIndexCount];
+  };
+  DataFile file;
+  auto mapped = new (std::nothrow) MappedTables();
+  if (!mapped || !read_header(static_cast<const char *>(addr), size, file) ||
+      !read_tables(file, mapped->tables) ||
+      !read_range_indexes(file, mapped->tables, mapped->range_indexes) ||
+      !build_latin1_records(mapped->tables, mapped->latin1_records)) {
+    delete mapped;
+    munmap(addr, size);
+    return nullptr;
+  }
+  mapped->tables.latin1_records = mapped->latin1_records;
+  return &mapped->tables;
+#endif
+}
+
+DataContext default_data_context() { return _tables; }
+
+void set_default_data_context(DataContext ctx) {
+  _tables = ctx;
+  _default_latin1_records = ctx->latin1_records;
+}
+
+bool load_data_file(const char *path) {
+  auto ctx = load_data_context(path);
+  if (!ctx) {
+    return false;
+  }
+  set_default_data_context(ctx);
+  return true;
+}
+
+void use_builtin_data() { set_default_data_context(&_builtin_tables); }
+
+const char *unicode_version(DataContext ctx) { return ctx->unicode_version; }
+
+const char *unicode_version() { return _tables->unicode_version; }
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
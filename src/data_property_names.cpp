@@ -0,0 +1,13 @@
+#include "unicodelib_data.h"
+
+namespace unicode {
+#include "_property_names.cpp"
+
+const size_t _property_name_count =
+    sizeof(_property_names) / sizeof(_property_names[0]);
+const size_t _property_name_seed_count =
+    sizeof(_property_name_seeds) / sizeof(_property_name_seeds[0]);
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
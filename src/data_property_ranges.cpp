@@ -0,0 +1,25 @@
+#include "unicodelib_data.h"
+
+namespace unicode {
+#include "_property_ranges.cpp"
+
+#define UNICODELIB_RANGES(name)                                                \
+  {name##_ranges, name##_range_offsets,                                        \
+   sizeof(name##_range_offsets) / sizeof(name##_range_offsets[0]) - 1}
+
+const PropertyRanges _general_category_range_index =
+    UNICODELIB_RANGES(_general_category);
+const PropertyRanges _property_range_index = UNICODELIB_RANGES(_property);
+const PropertyRanges _derived_core_property_range_index =
+    UNICODELIB_RANGES(_derived_core_property);
+const PropertyRanges _grapheme_break_range_index =
+    UNICODELIB_RANGES(_grapheme_break);
+const PropertyRanges _word_break_range_index = UNICODELIB_RANGES(_word_break);
+const PropertyRanges _sentence_break_range_index =
+    UNICODELIB_RANGES(_sentence_break);
+
+#undef UNICODELIB_RANGES
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -1,7 +0,0 @@
-#include "unicodelib_data.h"
-
-namespace unicode {
-#include "_script_extension_properties_for_id.cpp"
-}  // namespace unicode
-
-// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
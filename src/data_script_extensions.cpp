@@ -1,7 +1,7 @@
 #include "unicodelib_data.h"
 
 namespace unicode {
-#include "_word_break_properties.cpp"
+#include "_script_extensions.cpp"
 }  // namespace unicode
 
 // vim: et ts=2 sw=2 cin cino=\:0 ff=unix
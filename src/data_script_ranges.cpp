@@ -0,0 +1,17 @@
+#include "unicodelib_data.h"
+
+namespace unicode {
+#include "_script_ranges.cpp"
+
+#define UNICODELIB_RANGES(name)                                                \
+  {name##_ranges, name##_range_offsets,                                        \
+   sizeof(name##_range_offsets) / sizeof(name##_range_offsets[0]) - 1}
+
+const PropertyRanges _block_range_index = UNICODELIB_RANGES(_block);
+const PropertyRanges _script_range_index = UNICODELIB_RANGES(_script);
+
+#undef UNICODELIB_RANGES
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
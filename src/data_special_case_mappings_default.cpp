@@ -1,7 +0,0 @@
-#include "unicodelib_data.h"
-
-namespace unicode {
-#include "_special_case_mappings_default.cpp"
-}  // namespace unicode
-
-// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
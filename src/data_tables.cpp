@@ -0,0 +1,102 @@
+#include "unicodelib_data.h"
+
+namespace unicode {
+#include "_latin1_records.cpp"
+#include "_unicode_version.cpp"
+
+#define UNICODELIB_TRIE(name) {name##_stage1, name##_stage2, name##_stage3}
+
+// Built only from addresses of the generated arrays, so that it is constant
+// initialized. The tables of a family left out of the build with a
+// 'UNICODELIB_NO_*' definition are null, so that they are never linked.
+const DataTables _builtin_tables = {
+    _unicode_version,
+    UNICODELIB_TRIE(_general_category_properties),
+    UNICODELIB_TRIE(_properties),
+    UNICODELIB_TRIE(_derived_core_properties),
+#if !defined(UNICODELIB_NO_CASING)
+    _simple_case_deltas,
+    UNICODELIB_TRIE(_simple_case_delta_ids),
+    _special_case_mapping_pool,
+    _special_case_mappings,
+    UNICODELIB_TRIE(_special_case_mapping_ids),
+    _case_folding_pool,
+    _case_folding_values,
+    UNICODELIB_TRIE(_case_foldings),
+#else
+    nullptr,
+    {},
+    nullptr,
+    nullptr,
+    {},
+    nullptr,
+    nullptr,
+    {},
+#endif
+#if !defined(UNICODELIB_NO_SCRIPTS)
+    UNICODELIB_TRIE(_block_properties),
+    UNICODELIB_TRIE(_script_properties),
+    _script_extension_sets,
+    UNICODELIB_TRIE(_script_extension_ids),
+#else
+    {},
+    {},
+    nullptr,
+    {},
+#endif
+    UNICODELIB_TRIE(_combining_class_properties),
+#if !defined(UNICODELIB_NO_NORMALIZATION)
+    _decomposition_pool,
+    UNICODELIB_TRIE(_decomposition_properties),
+    _normalization_composition_pairs,
+    UNICODELIB_TRIE(_normalization_composition),
+#else
+    nullptr,
+    {},
+    nullptr,
+    {},
+#endif
+#if !defined(UNICODELIB_NO_EMOJI)
+    UNICODELIB_TRIE(_emoji_properties),
+#else
+    {},
+#endif
+    _code_point_records,
+    UNICODELIB_TRIE(_code_point_record_ids),
+#if !defined(UNICODELIB_NO_RANGES)
+    &_general_category_range_index,
+    &_property_range_index,
+    &_derived_core_property_range_index,
+    &_grapheme_break_range_index,
+    &_word_break_range_index,
+    &_sentence_break_range_index,
+#else
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+#endif
+#if !defined(UNICODELIB_NO_RANGES) && !defined(UNICODELIB_NO_SCRIPTS)
+    &_block_range_index,
+    &_script_range_index,
+#else
+    nullptr,
+    nullptr,
+#endif
+    _latin1_records,
+};
+
+#undef UNICODELIB_TRIE
+
+namespace detail {
+
+const DataTables *_tables = &_builtin_tables;
+const Latin1Record *_default_latin1_records = _latin1_records;
+
+}  // namespace detail
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -0,0 +1,1115 @@
+#include "unicodelib.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "unicodelib_data.h"
+#include "unicodelib_encodings.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Case
+//-----------------------------------------------------------------------------
+
+inline const SimpleCaseDelta &simple_case_delta(DataContext ctx,
+                                                char32_t cp) {
+  return ctx->simple_case_deltas[ctx->simple_case_delta_ids[cp]];
+}
+
+inline char32_t add_delta(char32_t cp, int32_t delta) {
+  return static_cast<char32_t>(static_cast<int32_t>(cp) + delta);
+}
+
+static char32_t simple_case_mapping(DataContext ctx, char32_t cp,
+                                    CaseMappingType type) {
+  const auto &d = simple_case_delta(ctx, cp);
+  switch (type) {
+    case CaseMappingType::Upper: return add_delta(cp, d.upper);
+    case CaseMappingType::Lower: return add_delta(cp, d.lower);
+    case CaseMappingType::Title: return add_delta(cp, d.title);
+  }
+  return cp;
+}
+
+char32_t simple_uppercase_mapping(DataContext ctx, char32_t cp) {
+  return add_delta(cp, simple_case_delta(ctx, cp).upper);
+}
+
+char32_t simple_lowercase_mapping(DataContext ctx, char32_t cp) {
+  return add_delta(cp, simple_case_delta(ctx, cp).lower);
+}
+
+char32_t simple_titlecase_mapping(DataContext ctx, char32_t cp) {
+  return add_delta(cp, simple_case_delta(ctx, cp).title);
+}
+
+char32_t simple_case_folding(DataContext ctx, char32_t cp) {
+  return add_delta(cp, simple_case_delta(ctx, cp).folding);
+}
+
+static bool is_language_qualified(const char *user_lang,
+                                  const char *spec_lang) {
+  return !spec_lang[0] || (user_lang && !strcmp(user_lang, spec_lang));
+}
+
+inline bool has_record_flag(DataContext ctx, char32_t cp, uint8_t flag) {
+  return (code_point_record(ctx, cp).flags & flag) != 0;
+}
+
+// The code points of a string by position, so that the context rules of
+// SpecialCasing read UTF-32 and UTF-8 alike.
+struct Utf32Text {
+  const char32_t *s32;
+  size_t l;
+
+  size_t end() const { return l; }
+  size_t prev(size_t i) const { return i - 1; }
+  size_t next(size_t i) const { return i + 1; }
+  char32_t at(size_t i) const { return s32[i]; }
+};
+
+// Decodes a well-formed UTF-8 sequence as in table 3-7 of the Unicode
+// Standard, which has no overlong forms, surrogates or code points past
+// U+10FFFF. 'utf8::decode_codepoint' only checks the lead byte.
+static bool decode_well_formed(const char *s8, size_t l, size_t &bytes,
+                               char32_t &cp) {
+  if (!l) {
+    return false;
+  }
+  auto lead = static_cast<uint8_t>(s8[0]);
+  uint8_t lo = 0x80;
+  uint8_t hi = 0xBF;
+  if (lead < 0x80) {
+    bytes = 1;
+    cp = lead;
+    return true;
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    bytes = 2;
+    cp = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    bytes = 3;
+    cp = lead & 0x0F;
+    lo = lead == 0xE0 ? 0xA0 : lo;
+    hi = lead == 0xED ? 0x9F : hi;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    bytes = 4;
+    cp = lead & 0x07;
+    lo = lead == 0xF0 ? 0x90 : lo;
+    hi = lead == 0xF4 ? 0x8F : hi;
+  } else {
+    return false;
+  }
+  if (l < bytes) {
+    return false;
+  }
+  for (size_t i = 1; i < bytes; i++) {
+    auto b = static_cast<uint8_t>(s8[i]);
+    if (b < lo || b > hi) {
+      return false;
+    }
+    cp = (cp << 6) | (b & 0x3F);
+    lo = 0x80;
+    hi = 0xBF;
+  }
+  return true;
+}
+
+// A byte that doesn't start a well-formed UTF-8 sequence is a code point of
+// its own, read as U+FFFD.
+struct Utf8Text {
+  const char *s8;
+  size_t l;
+
+  size_t end() const { return l; }
+
+  size_t prev(size_t i) const {
+    auto pos = i - 1;
+    while (pos > 0 && i - pos < 4 && (s8[pos] & 0xC0) == 0x80) {
+      pos--;
+    }
+    return next(pos) == i ? pos : i - 1;
+  }
+
+  size_t next(size_t i) const {
+    size_t bytes;
+    char32_t cp;
+    return i + (decode_well_formed(&s8[i], l - i, bytes, cp) ? bytes : 1);
+  }
+
+  char32_t at(size_t i) const {
+    size_t bytes;
+    char32_t cp;
+    return decode_well_formed(&s8[i], l - i, bytes, cp) ? cp : 0xFFFD;
+  }
+};
+
+// Finds the last code point before 'i' that 'skip' is false for.
+template <typename Text, typename Skip>
+static bool find_before(const Text &text, size_t i, Skip skip, size_t &pos) {
+  pos = i;
+  while (pos > 0) {
+    pos = text.prev(pos);
+    if (!skip(text.at(pos))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Finds the first code point after 'i' that 'skip' is false for, or the end.
+template <typename Text, typename Skip>
+static size_t find_after(const Text &text, size_t i, Skip skip) {
+  auto pos = text.next(i);
+  while (pos < text.end() && skip(text.at(pos))) {
+    pos = text.next(pos);
+  }
+  return pos;
+}
+
+template <typename Text>
+static bool is_final_sigma(DataContext ctx, const Text &text, size_t i) {
+  // C is preceded by a sequence consisting of a cased letter and
+  // then zero or more case-ignorable characters, and C is not
+  // followed by a sequence consisting of zero or more case-ignorable
+  // characters and then a cased letter
+  auto is_case_ignorable = [&](char32_t cp) {
+    return has_record_flag(ctx, cp, CodePointRecord_Case_Ignorable);
+  };
+
+  // Before C: \p{cased} (\p{case-ignorable})*
+  size_t pos;
+  if (!find_before(text, i, is_case_ignorable, pos) ||
+      !has_record_flag(ctx, text.at(pos), CodePointRecord_Cased)) {
+    return false;
+  }
+
+  // After C: !((\p{case-ignorable})* \p{cased})
+  pos = find_after(text, i, is_case_ignorable);
+  if (pos < text.end() &&
+      has_record_flag(ctx, text.at(pos), CodePointRecord_Cased)) {
+    return false;
+  }
+
+  return true;
+}
+
+inline bool has_class_230_or_0(DataContext ctx, char32_t cp) {
+  auto cls = code_point_record(ctx, cp).combining_class;
+  return cls == 230 || cls == 0;
+}
+
+template <typename Text>
+static bool is_after_soft_dotted(DataContext ctx, const Text &text, size_t i) {
+  // There is a Soft_Dotted character before C, with no intervening character of
+  // combining class 0 or 230 (Above).
+  auto is_other_class = [&](char32_t cp) {
+    return !has_class_230_or_0(ctx, cp);
+  };
+
+  // Before C: [\p{Soft_Dotted}] ([^\p{ccc=230} \p{ccc=0}])*
+  size_t pos;
+  if (!find_before(text, i, is_other_class, pos) ||
+      !is_soft_dotted(ctx, text.at(pos))) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename Text>
+static bool is_more_above(DataContext ctx, const Text &text, size_t i) {
+  // C is followed by a character of combining class 230 (Above) with no
+  // intervening character of combining class 0 or 230 (Above).
+  auto is_other_class = [&](char32_t cp) {
+    return !has_class_230_or_0(ctx, cp);
+  };
+
+  // After C: [^\p{ccc=230}\p{ccc=0}]* [\p{ccc=230}]
+  auto pos = find_after(text, i, is_other_class);
+  if (pos == text.end() ||
+      code_point_record(ctx, text.at(pos)).combining_class != 230) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename Text>
+static bool is_before_dot(DataContext ctx, const Text &text, size_t i) {
+  // C is followed by combining dot above (U+0307). Any sequence of characters
+  // with a combining class that is neither 0 nor 230 may intervene between the
+  // current character and the combining dot above.
+  auto is_other_class = [&](char32_t cp) {
+    return !has_class_230_or_0(ctx, cp);
+  };
+
+  // After C: ([^\p{ccc=230} \p{ccc=0}])* [\u0307]
+  auto pos = find_after(text, i, is_other_class);
+  if (pos == text.end() || text.at(pos) != 0x0307) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename Text>
+static bool is_after_i(DataContext ctx, const Text &text, size_t i) {
+  // There is an uppercase I before C, and there is no intervening combining
+  // character class 230 (Above) or 0.
+  auto is_other_class = [&](char32_t cp) {
+    return !has_class_230_or_0(ctx, cp);
+  };
+
+  // Before C: [I] ([^\p{ccc=230} \p{ccc=0}])*
+  size_t pos;
+  if (!find_before(text, i, is_other_class, pos) || text.at(pos) != U'I') {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename Text, typename Out>
+static void full_case_mapping(DataContext ctx, const Text &text, size_t i,
+                              const char *lang, CaseMappingType type,
+                              Out &out) {
+  // D135 A character C is defined to be cased if and only if C has the
+  // Lowercase or Uppercase property or has a General_Category value of
+  // Titlecase_Letter. • The Uppercase and Lowercase property values are
+  // specified in the data file DerivedCoreProperties.txt in the Unicode
+  // Character Database. The derived property Cased is also listed in
+  // DerivedCoreProperties.txt.
+  //
+  // D136 A character C is defined to be case-ignorable if C has the value
+  // MidLetter (ML), MidNumLet (MB), or Single_Quote (SQ) for the Word_Break
+  // property or its General_Category is one of Nonspacing_Mark (Mn),
+  // Enclosing_Mark (Me), Format (Cf), Modifier_Letter (Lm), or Modifier_Symbol
+  // (Sk). • The Word_Break property is defined in the data file
+  // WordBreakProperty.txt in the Unicode Character Database. • The derived
+  // property Case_Ignorable is listed in the data file
+  // DerivedCoreProperties.txt in the Unicode Character Database. • The
+  // Case_Ignorable property is defined for use in the context specifications of
+  // Table 3-17. It is a narrow-use property, and is not intended for use in
+  // other contexts. The more broadly applicable string casing function,
+  // isCased(X), is defined in D143.
+  //
+  // D137 Case-ignorable sequence: A sequence of zero or more case-ignorable
+  // characters.
+  //
+  // D138 A character C is in a particular casing context for context-dependent
+  // matching if and only if it matches the corresponding specification in Table
+  // 3-17.
+  assert(i < text.end());
+  auto cp = text.at(i);
+
+  // Without a language, only code points that change when case mapped can
+  // have a special or simple mapping.
+  if (!lang &&
+      !has_record_flag(ctx, cp, CodePointRecord_Changes_When_Casemapped)) {
+    out += cp;
+    return;
+  }
+
+  // The rows of a code point end with its unconditional mapping, if any.
+  if (auto id = ctx->special_case_mapping_ids[cp]) {
+    for (auto it = &ctx->special_case_mappings[id]; it->code == cp; ++it) {
+      const auto &sc = *it;
+      if (is_language_qualified(lang, sc.language)) {
+        bool handle = false;
+        switch (sc.context) {
+          case SpecialCasingContext::Unassigned:
+            handle = true;
+            break;
+          case SpecialCasingContext::Final_Sigma:
+            handle = is_final_sigma(ctx, text, i);
+            break;
+          case SpecialCasingContext::Not_Final_Sigma:
+            handle = !is_final_sigma(ctx, text, i);
+            break;
+          case SpecialCasingContext::After_Soft_Dotted:
+            handle = is_after_soft_dotted(ctx, text, i);
+            break;
+          case SpecialCasingContext::More_Above:
+            handle = is_more_above(ctx, text, i);
+            break;
+          case SpecialCasingContext::Before_Dot:
+            handle = is_before_dot(ctx, text, i);
+            break;
+          case SpecialCasingContext::Not_Before_Dot:
+            handle = !is_before_dot(ctx, text, i);
+            break;
+          case SpecialCasingContext::After_I:
+            handle = is_after_i(ctx, text, i);
+            break;
+          default:
+            // NOTREACHED
+            break;
+        }
+        if (handle) {
+          // An empty mapping removes the character.
+          if (auto offset = sc.case_mapping(type)) {
+            out += &ctx->special_case_mapping_pool[offset];
+          }
+          return;
+        }
+      }
+    }
+  }
+
+  out += simple_case_mapping(ctx, cp, type);
+}
+
+template <typename Text, typename Out>
+static void uppercase_mapping(DataContext ctx, const Text &text, size_t i,
+                              const char *lang, Out &out) {
+  full_case_mapping(ctx, text, i, lang, CaseMappingType::Upper, out);
+}
+
+template <typename Text, typename Out>
+static void lowercase_mapping(DataContext ctx, const Text &text, size_t i,
+                              const char *lang, Out &out) {
+  full_case_mapping(ctx, text, i, lang, CaseMappingType::Lower, out);
+}
+
+//-----------------------------------------------------------------------------
+// ASCII Fast Path
+//-----------------------------------------------------------------------------
+
+// The case of an ASCII letter is changed by flipping bit 0x20, and no context
+// rule maps an ASCII code point unless a language has a SpecialCasing row for
+// it, as 'tr' has for 'I' and 'i'. Runs of ASCII are therefore mapped a block
+// at a time with branch-free loops, which the compiler vectorizes.
+const size_t AsciiBlockLength = 16;
+
+static bool is_ascii_block(const char32_t *s32) {
+  char32_t bits = 0;
+  for (size_t i = 0; i < AsciiBlockLength; i++) {
+    bits |= s32[i];
+  }
+  return bits < 0x80;
+}
+
+// Maps the letters from 'first' to 'first' + 25 to the other case.
+static char32_t ascii_case_mapping(char32_t cp, char32_t first) {
+  return cp ^ (cp - first < 26 ? 0x20 : 0);
+}
+
+// The rows are sorted by code point after the empty row 0.
+static bool has_ascii_special_casing(DataContext ctx, const char *lang) {
+  for (auto it = &ctx->special_case_mappings[1];
+       it->code != 0 && it->code < 0x80; ++it) {
+    if (is_language_qualified(lang, it->language)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Maps 's32' with 'first' as in 'ascii_case_mapping' for ASCII and
+// 'fn(i)' for the others. Once a block is not all ASCII, its code points are
+// mapped one at a time, so that mixed text doesn't test every block.
+template <typename Out, typename Fn>
+static void ascii_fast_path(const char32_t *s32, size_t l, char32_t first,
+                            Out &out, Fn fn) {
+  detail::reserve_more(out, l);
+  size_t i = 0;
+  while (i < l) {
+    while (i + AsciiBlockLength <= l && is_ascii_block(&s32[i])) {
+      char32_t block[AsciiBlockLength];
+      for (size_t j = 0; j < AsciiBlockLength; j++) {
+        block[j] = ascii_case_mapping(s32[i + j], first);
+      }
+      out.append(block, AsciiBlockLength);
+      i += AsciiBlockLength;
+    }
+
+    auto end = std::min(i + AsciiBlockLength, l);
+    for (; i < end; i++) {
+      if (s32[i] < 0x80) {
+        out += ascii_case_mapping(s32[i], first);
+      } else {
+        fn(i);
+      }
+    }
+  }
+}
+
+template <typename Out>
+static void to_uppercase_core(DataContext ctx, const char32_t *s32, size_t l,
+                               const char *lang, Out &out) {
+  // R1 toUppercase(X): Map each character C in X to Uppercase_Mapping(C)
+  if (!has_ascii_special_casing(ctx, lang)) {
+    ascii_fast_path(s32, l, U'a', out, [&](size_t i) {
+      uppercase_mapping(ctx, Utf32Text{s32, l}, i, lang, out);
+    });
+    return;
+  }
+  for (size_t i = 0; i < l; i++) {
+    uppercase_mapping(ctx, Utf32Text{s32, l}, i, lang, out);
+  }
+}
+
+template <typename Out>
+static void to_lowercase_core(DataContext ctx, const char32_t *s32, size_t l,
+                               const char *lang, Out &out) {
+  // R2 toLowercase(X): Map each character C in X to Lowercase_Mapping(C)
+  if (!has_ascii_special_casing(ctx, lang)) {
+    ascii_fast_path(s32, l, U'A', out, [&](size_t i) {
+      lowercase_mapping(ctx, Utf32Text{s32, l}, i, lang, out);
+    });
+    return;
+  }
+  for (size_t i = 0; i < l; i++) {
+    lowercase_mapping(ctx, Utf32Text{s32, l}, i, lang, out);
+  }
+}
+
+// Calls 'keep(i)' for the code points that toTitlecase leaves as they are and
+// 'map(i, type)' for the others.
+template <typename Keep, typename Map>
+static void titlecase_words(DataContext ctx, const char32_t *s32, size_t l,
+                            Keep keep, Map map) {
+  // R3 toTitlecase(X): Find the word boundaries in X according to Unicode
+  // Standard Annex #29, “Unicode Text Segmentation.” For each word boundary,
+  // find the first cased character F following the word boundary. If F exists,
+  // map F to Titlecase_Mapping(F); then map all characters C between F and the
+  // following word boundary to Lowercase_Mapping(C)
+  size_t i = 0;
+  while (i < l) {
+    while (i < l && !has_record_flag(ctx, s32[i], CodePointRecord_Cased)) {
+      keep(i);
+      i++;
+    }
+
+    if (i == l) {
+      break;
+    }
+
+    map(i, CaseMappingType::Title);
+    i++;
+
+    if (i == l) {
+      break;
+    }
+
+    while (i < l && !is_word_boundary(ctx, s32, l, i)) {
+      map(i, CaseMappingType::Lower);
+      i++;
+    }
+  }
+}
+
+template <typename Out>
+static void to_titlecase_core(DataContext ctx, const char32_t *s32, size_t l,
+                              const char *lang, Out &out) {
+  titlecase_words(
+      ctx, s32, l, [&](size_t i) { out += s32[i]; },
+      [&](size_t i, CaseMappingType type) {
+        full_case_mapping(ctx, Utf32Text{s32, l}, i, lang, type, out);
+      });
+}
+
+template <typename Out>
+static void case_folding(
+    DataContext ctx, char32_t cp,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I, Out &out) {
+  auto index = ctx->case_foldings[cp];
+  if (index) {
+    const auto &cf = ctx->case_folding_values[index];
+    if (special_case_for_uppercase_I_and_dotted_uppercase_I && cf.T) {
+      out += cf.T;
+      return;
+    } else if (cf.F) {
+      out += &ctx->case_folding_pool[cf.F];
+      return;
+    }
+  }
+  out += simple_case_folding(ctx, cp);
+}
+
+template <typename Out>
+static void to_case_fold_core(
+    DataContext ctx, const char32_t *s32, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I, Out &out) {
+  // R4 toCasefold(X): Map each character C in X to Case_Folding(C)
+  // The 'T' foldings are those of 'I' and U+0130.
+  if (!special_case_for_uppercase_I_and_dotted_uppercase_I) {
+    ascii_fast_path(s32, l, U'A', out,
+                    [&](size_t i) { case_folding(ctx, s32[i], false, out); });
+    return;
+  }
+  for (size_t i = 0; i < l; i++) {
+    case_folding(ctx, s32[i],
+                 special_case_for_uppercase_I_and_dotted_uppercase_I, out);
+  }
+}
+
+std::u32string to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang) {
+  std::u32string out;
+  to_uppercase_core(ctx, s32, l, lang, out);
+  return out;
+}
+
+void to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang) {
+  to_uppercase_core(ctx, s32, l, lang, out);
+}
+
+size_t to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang) {
+  BufferOutput out(buff, size);
+  to_uppercase_core(ctx, s32, l, lang, out);
+  return out.size();
+}
+
+std::u32string to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang) {
+  std::u32string out;
+  to_lowercase_core(ctx, s32, l, lang, out);
+  return out;
+}
+
+void to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang) {
+  to_lowercase_core(ctx, s32, l, lang, out);
+}
+
+size_t to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang) {
+  BufferOutput out(buff, size);
+  to_lowercase_core(ctx, s32, l, lang, out);
+  return out.size();
+}
+
+std::u32string to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang) {
+  std::u32string out;
+  to_titlecase_core(ctx, s32, l, lang, out);
+  return out;
+}
+
+void to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang) {
+  to_titlecase_core(ctx, s32, l, lang, out);
+}
+
+size_t to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang) {
+  BufferOutput out(buff, size);
+  to_titlecase_core(ctx, s32, l, lang, out);
+  return out.size();
+}
+
+std::u32string to_case_fold(
+    DataContext ctx, const char32_t *s32, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  std::u32string out;
+  to_case_fold_core(ctx, s32, l,
+                    special_case_for_uppercase_I_and_dotted_uppercase_I, out);
+  return out;
+}
+
+void to_case_fold(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  to_case_fold_core(ctx, s32, l,
+                    special_case_for_uppercase_I_and_dotted_uppercase_I, out);
+}
+
+size_t to_case_fold(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size,
+                    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  BufferOutput out(buff, size);
+  to_case_fold_core(ctx, s32, l,
+                    special_case_for_uppercase_I_and_dotted_uppercase_I, out);
+  return out.size();
+}
+
+namespace detail {
+
+void to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang) {
+  to_uppercase_core(ctx, s32, l, lang, out);
+}
+
+void to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang) {
+  to_lowercase_core(ctx, s32, l, lang, out);
+}
+
+void to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang) {
+  to_titlecase_core(ctx, s32, l, lang, out);
+}
+
+void to_case_fold(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  to_case_fold_core(ctx, s32, l,
+                    special_case_for_uppercase_I_and_dotted_uppercase_I, out);
+}
+
+}  // namespace detail
+
+//-----------------------------------------------------------------------------
+// UTF-8 Case Mapping
+//-----------------------------------------------------------------------------
+
+// The output of the UTF-8 transforms. It takes code points as 'std::u32string'
+// does for the mappings, and bytes for the runs that are copied as they are.
+class Utf8Output {
+public:
+  explicit Utf8Output(std::string &out) : out_(out) {}
+
+  size_t size() const { return out_.size(); }
+  size_t capacity() const { return out_.capacity(); }
+  void reserve(size_t size) { out_.reserve(size); }
+
+  Utf8Output &operator+=(char32_t cp) {
+    utf8::encode_codepoint(cp, out_);
+    return *this;
+  }
+
+  Utf8Output &operator+=(const char32_t *s32) {
+    while (*s32) {
+      *this += *s32++;
+    }
+    return *this;
+  }
+
+  void append(const char32_t *s32, size_t l) { utf8::encode(s32, l, out_); }
+  void append(const char *s8, size_t l) { out_.append(s8, l); }
+
+private:
+  std::string &out_;
+};
+
+// Maps 's8' with 'fn(i, cp)' for the code points that 'changes(cp)' is true
+// for, and copies the runs of bytes between them as they are. A byte that
+// doesn't start a well-formed UTF-8 sequence is copied too. When 'ascii' is true, ASCII
+// is mapped with 'first' as in 'ascii_case_mapping', eight bytes at a time.
+template <typename Changes, typename Fn>
+static void utf8_fast_path(const char *s8, size_t l, bool ascii, char first,
+                           Utf8Output &out, Changes changes, Fn fn) {
+  const uint64_t ones = 0x0101010101010101;
+  const uint64_t high = ones * 0x80;
+  const uint64_t from = ones * (0x80 - first);
+  const uint64_t to = ones * (0x80 - (first + 26));
+
+  detail::reserve_more(out, l);
+  size_t run = 0;
+  size_t i = 0;
+  while (i < l) {
+    if (ascii && i + 8 <= l) {
+      uint64_t word;
+      memcpy(&word, &s8[i], 8);
+      if (!(word & high)) {
+        // Bit 7 of a byte of 'word + from' is set from 'first' on, and of
+        // 'word + to' from 'first' + 26 on. No byte carries into the next.
+        auto mask = ((word + from) & ~(word + to) & high) >> 2;
+        if (mask) {
+          out.append(&s8[run], i - run);
+          word ^= mask;
+          out.append(reinterpret_cast<const char *>(&word), 8);
+          run = i + 8;
+        }
+        i += 8;
+        continue;
+      }
+    }
+
+    size_t bytes;
+    char32_t cp;
+    if (!decode_well_formed(&s8[i], l - i, bytes, cp)) {
+      i++;
+      continue;
+    }
+
+    if (ascii && cp < 0x80 ? cp - first >= 26 : !changes(cp)) {
+      i += bytes;
+      continue;
+    }
+
+    out.append(&s8[run], i - run);
+    if (ascii && cp < 0x80) {
+      out += ascii_case_mapping(cp, first);
+    } else {
+      fn(i, cp);
+    }
+    i += bytes;
+    run = i;
+  }
+  out.append(&s8[run], l - run);
+}
+
+// Without a language, the code points that don't change when upper or
+// lowercased are exactly those that their flag is clear for. The conditional
+// rows of a language may apply to others, as 'lt' removes U+0307.
+static bool changes_when_mapped(DataContext ctx, char32_t cp, uint8_t flag,
+                                const char *lang) {
+  return has_record_flag(ctx, cp, flag) ||
+         (lang && ctx->special_case_mapping_ids[cp]);
+}
+
+void to_uppercase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  Utf8Output o(out);
+  utf8_fast_path(
+      s8, l, !has_ascii_special_casing(ctx, lang), 'a', o,
+      [&](char32_t cp) {
+        return changes_when_mapped(
+            ctx, cp, CodePointRecord_Changes_When_Uppercased, lang);
+      },
+      [&](size_t i, char32_t) {
+        uppercase_mapping(ctx, Utf8Text{s8, l}, i, lang, o);
+      });
+}
+
+void to_lowercase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  Utf8Output o(out);
+  utf8_fast_path(
+      s8, l, !has_ascii_special_casing(ctx, lang), 'A', o,
+      [&](char32_t cp) {
+        return changes_when_mapped(
+            ctx, cp, CodePointRecord_Changes_When_Lowercased, lang);
+      },
+      [&](size_t i, char32_t) {
+        lowercase_mapping(ctx, Utf8Text{s8, l}, i, lang, o);
+      });
+}
+
+void to_titlecase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  // The word boundaries are found in UTF-32, so the code points are decoded
+  // with their offsets, and those that map to themselves are copied as bytes.
+  Utf8Text text{s8, l};
+  std::u32string s32;
+  std::vector<size_t> offsets;
+  for (size_t i = 0; i < l; i = text.next(i)) {
+    s32 += text.at(i);
+    offsets.push_back(i);
+  }
+  offsets.push_back(l);
+
+  Utf8Output o(out);
+  detail::reserve_more(o, l);
+  auto keep = [&](size_t i) {
+    o.append(&s8[offsets[i]], offsets[i + 1] - offsets[i]);
+  };
+  std::u32string mapped;
+  titlecase_words(ctx, s32.data(), s32.length(), keep,
+                  [&](size_t i, CaseMappingType type) {
+                    mapped.clear();
+                    full_case_mapping(ctx, text, offsets[i], lang, type,
+                                      mapped);
+                    if (mapped.length() == 1 && mapped[0] == s32[i]) {
+                      keep(i);
+                    } else {
+                      o.append(mapped.data(), mapped.length());
+                    }
+                  });
+}
+
+void to_case_fold(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  Utf8Output o(out);
+  utf8_fast_path(
+      s8, l, !special_case_for_uppercase_I_and_dotted_uppercase_I, 'A', o,
+      [&](char32_t cp) {
+        return ctx->case_foldings[cp] || simple_case_delta(ctx, cp).folding;
+      },
+      [&](size_t, char32_t cp) {
+        case_folding(ctx, cp,
+                     special_case_for_uppercase_I_and_dotted_uppercase_I, o);
+      });
+}
+
+std::string to_uppercase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang) {
+  std::string out;
+  to_uppercase(ctx, s8, l, out, lang);
+  return out;
+}
+
+std::string to_lowercase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang) {
+  std::string out;
+  to_lowercase(ctx, s8, l, out, lang);
+  return out;
+}
+
+std::string to_titlecase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang) {
+  std::string out;
+  to_titlecase(ctx, s8, l, out, lang);
+  return out;
+}
+
+std::string to_case_fold(
+    DataContext ctx, const char *s8, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  std::string out;
+  to_case_fold(ctx, s8, l, out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+  return out;
+}
+
+bool is_uppercase(DataContext ctx, const char32_t *s32, size_t l) {
+  // D140 isUppercase(X): isUppercase(X) is true when toUppercase(Y) = Y
+  for (size_t i = 0; i < l; i++) {
+    if (has_record_flag(ctx, s32[i], CodePointRecord_Changes_When_Uppercased)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool is_lowercase(DataContext ctx, const char32_t *s32, size_t l) {
+  // D139 isLowercase(X): isLowercase(X) is true when toLowercase(Y) = Y
+  for (size_t i = 0; i < l; i++) {
+    if (has_record_flag(ctx, s32[i], CodePointRecord_Changes_When_Lowercased)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool is_titlecase(DataContext ctx, const char32_t *s32, size_t l) {
+  // D141 isTitlecase(X): isTitlecase(X) is true when toTitlecase(Y) = Y
+  size_t i = 0;
+  while (i < l) {
+    while (i < l) {
+      auto flags = code_point_record(ctx, s32[i]).flags;
+      if (flags & CodePointRecord_Cased) {
+        break;
+      }
+      if (flags & CodePointRecord_Changes_When_Lowercased) {
+        return false;
+      }
+      i++;
+    }
+
+    if (i == l) {
+      break;
+    }
+
+    if (has_record_flag(ctx, s32[i], CodePointRecord_Changes_When_Titlecased)) {
+      return false;
+    }
+    i++;
+
+    if (i == l) {
+      break;
+    }
+
+    while (i < l && !is_word_boundary(ctx, s32, l, i)) {
+      if (has_record_flag(ctx, s32[i],
+                          CodePointRecord_Changes_When_Lowercased)) {
+        return false;
+      }
+      i++;
+    }
+  }
+
+  return true;
+}
+
+bool is_case_fold(DataContext ctx, const char32_t *s32, size_t l) {
+  // D142 isCasefolded(X): isCasefolded(X) is true when toCasefold(Y) = Y
+  for (size_t i = 0; i < l; i++) {
+    if (has_record_flag(ctx, s32[i], CodePointRecord_Changes_When_Casefolded)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool caseless_match(DataContext ctx, const char32_t *s1, size_t l1,
+                    const char32_t *s2, size_t l2,
+                    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  // D144 A string X is a caseless match for a string Y if and only if
+  // toCasefold(X) = toCasefold(Y)
+  return to_case_fold(ctx, s1, l1,
+                      special_case_for_uppercase_I_and_dotted_uppercase_I) ==
+         to_case_fold(ctx, s2, l2,
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+// The caseless matches that normalize need the normalization tables too.
+#if !defined(UNICODELIB_NO_NORMALIZATION)
+bool canonical_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2, bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  // D145 A string X is a canonical caseless match for a string Y if and only if
+  // NFD(toCasefold(NFD(X))) = NFD(toCasefold(NFD(Y)))
+  return canonical_caseless_match(
+      ctx, s1, l1, s2, l2, std::allocator<char32_t>(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+bool compatibility_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2, bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  // D146 A string X is a compatibility caseless match for a string Y if and
+  // only if NFKD(toCasefold(NFKD(toCasefold(NFD(X))))) =
+  // NFKD(toCasefold(NFKD(toCasefold(NFD(Y)))))
+  return compatibility_caseless_match(
+      ctx, s1, l1, s2, l2, std::allocator<char32_t>(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+std::u32string to_uppercase(const char32_t *s32, size_t l, const char *lang) {
+  return to_uppercase(_tables, s32, l, lang);
+}
+
+std::u32string to_lowercase(const char32_t *s32, size_t l, const char *lang) {
+  return to_lowercase(_tables, s32, l, lang);
+}
+
+std::u32string to_titlecase(const char32_t *s32, size_t l, const char *lang) {
+  return to_titlecase(_tables, s32, l, lang);
+}
+
+std::u32string to_case_fold(
+    const char32_t *s32, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return to_case_fold(_tables, s32, l,
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+void to_uppercase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang) {
+  to_uppercase(_tables, s32, l, out, lang);
+}
+
+size_t to_uppercase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang) {
+  return to_uppercase(_tables, s32, l, buff, size, lang);
+}
+
+void to_lowercase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang) {
+  to_lowercase(_tables, s32, l, out, lang);
+}
+
+size_t to_lowercase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang) {
+  return to_lowercase(_tables, s32, l, buff, size, lang);
+}
+
+void to_titlecase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang) {
+  to_titlecase(_tables, s32, l, out, lang);
+}
+
+size_t to_titlecase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang) {
+  return to_titlecase(_tables, s32, l, buff, size, lang);
+}
+
+void to_case_fold(const char32_t *s32, size_t l, std::u32string &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  to_case_fold(_tables, s32, l, out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+size_t to_case_fold(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return to_case_fold(_tables, s32, l, buff, size,
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+std::string to_uppercase(const char *s8, size_t l, const char *lang) {
+  return to_uppercase(_tables, s8, l, lang);
+}
+
+std::string to_lowercase(const char *s8, size_t l, const char *lang) {
+  return to_lowercase(_tables, s8, l, lang);
+}
+
+std::string to_titlecase(const char *s8, size_t l, const char *lang) {
+  return to_titlecase(_tables, s8, l, lang);
+}
+
+std::string to_case_fold(
+    const char *s8, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return to_case_fold(_tables, s8, l,
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+void to_uppercase(const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  to_uppercase(_tables, s8, l, out, lang);
+}
+
+void to_lowercase(const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  to_lowercase(_tables, s8, l, out, lang);
+}
+
+void to_titlecase(const char *s8, size_t l, std::string &out,
+                  const char *lang) {
+  to_titlecase(_tables, s8, l, out, lang);
+}
+
+void to_case_fold(const char *s8, size_t l, std::string &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  to_case_fold(_tables, s8, l, out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+bool is_uppercase(const char32_t *s32, size_t l) {
+  return is_uppercase(_tables, s32, l);
+}
+
+bool is_lowercase(const char32_t *s32, size_t l) {
+  return is_lowercase(_tables, s32, l);
+}
+
+bool is_titlecase(const char32_t *s32, size_t l) {
+  return is_titlecase(_tables, s32, l);
+}
+
+bool is_case_fold(const char32_t *s32, size_t l) {
+  return is_case_fold(_tables, s32, l);
+}
+
+bool caseless_match(const char32_t *s1, size_t l1, const char32_t *s2,
+                    size_t l2,
+                    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return caseless_match(_tables, s1, l1, s2, l2,
+                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+#if !defined(UNICODELIB_NO_NORMALIZATION)
+bool canonical_caseless_match(
+    const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return canonical_caseless_match(
+      _tables, s1, l1, s2, l2,
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+bool compatibility_caseless_match(
+    const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I) {
+  return compatibility_caseless_match(
+      _tables, s1, l1, s2, l2,
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+#endif
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
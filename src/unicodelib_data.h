@@ -1,9 +1,76 @@
-#include <unordered_map>
-#include <vector>
+#include <algorithm>
+#include <cstdint>
 #include "unicodelib.h"
 
 namespace unicode {
 
+// Three-stage lookup table for per-code-point properties, generated by
+// 'scripts/gen_tables.py'. The shifts must match the generator.
+template <typename T> struct CodePointTrie {
+  static const size_t Shift1 = 10;
+  static const size_t Shift2 = 4;
+
+  const uint16_t *stage1;
+  const uint16_t *stage2;
+  const T *stage3;
+
+  T operator[](char32_t cp) const {
+    auto block = stage1[cp >> Shift1];
+    auto leaf = stage2[block + ((cp >> Shift2) & 0x3F)];
+    return stage3[leaf + (cp & 0xF)];
+  }
+
+  // The lookups don't depend on each other, so the CPU overlaps their loads
+  // instead of waiting on each code point in turn. Sharing the stage 1 and 2
+  // lookups across code points of one leaf adds a dependency and a branch,
+  // and measured slower than this on 'bench-main batch'.
+  void lookup(const char32_t *s32, size_t l, T *out) const {
+    for (size_t i = 0; i < l; i++) {
+      out[i] = (*this)[s32[i]];
+    }
+  }
+};
+
+// The output of the overloads that write to a caller's buffer. It takes the
+// part of 'std::u32string' that the transforms use, stores what fits in the
+// buffer and counts the length of the whole output.
+class BufferOutput {
+public:
+  BufferOutput(char32_t *buff, size_t size) : buff_(buff), size_(size) {}
+
+  size_t size() const { return length_; }
+  bool fits() const { return length_ <= size_; }
+
+  size_t capacity() const { return size_; }
+  void reserve(size_t) {}
+
+  BufferOutput &operator+=(char32_t cp) {
+    if (length_ < size_) {
+      buff_[length_] = cp;
+    }
+    length_++;
+    return *this;
+  }
+
+  BufferOutput &operator+=(const char32_t *s32) {
+    while (*s32) {
+      *this += *s32++;
+    }
+    return *this;
+  }
+
+  void append(const char32_t *s32, size_t l) {
+    for (size_t i = 0; i < l; i++) {
+      *this += s32[i];
+    }
+  }
+
+private:
+  char32_t *buff_;
+  size_t size_;
+  size_t length_ = 0;
+};
+
 enum class CaseMappingType {
   Upper = 0,
   Lower,
@@ -21,14 +88,18 @@ enum class SpecialCasingContext {
   After_I,
 };
 
+// The mappings are offsets of zero-terminated strings in
+// '_special_case_mapping_pool', where 0 is the empty mapping. The tables hold
+// no pointers so that they can be mapped from a data file as they are.
 struct SpecialCasing {
-  const char32_t *lower;
-  const char32_t *title;
-  const char32_t *upper;
-  const char* language;
+  char32_t code;
+  uint16_t lower;
+  uint16_t title;
+  uint16_t upper;
+  char language[4];
   SpecialCasingContext context;
 
-  const char32_t* case_mapping_codes(CaseMappingType type) const {
+  uint16_t case_mapping(CaseMappingType type) const {
     switch (type) {
     case CaseMappingType::Upper:
       return upper;
@@ -38,120 +109,251 @@ struct SpecialCasing {
       return title;
     }
     // NOTREACHED
-    return nullptr;
+    return 0;
   }
 };
 
-struct CaseFolding {
-  const char32_t C;
-  const char32_t S;
-  const char32_t *F;
-  const char32_t T;
+// The simple case mappings and folding of a code point as offsets from it,
+// so that runs of letters that map alike share a row.
+struct SimpleCaseDelta {
+  int32_t upper;
+  int32_t lower;
+  int32_t title;
+  int32_t folding;
 };
 
-struct NormalizationProperties {
-  int combining_class;
-  const char *compat_format;
-  const char32_t *codes;
+// The full (F) and Turkic (T) foldings. 'F' is an offset of a zero-terminated
+// string in '_case_folding_pool'. The simple foldings are in
+// 'SimpleCaseDelta'.
+struct CaseFolding {
+  uint32_t F;
+  char32_t T;
 };
 
-// This is generated from 'GraphemeBreakProperty.txt' in Unicode database.
-// `python scripts/gen_property_values.py < UCD/auxiliary/GraphemeBreakProperty.txt`
-enum class GraphemeBreak {
-  Unassigned,
-  Prepend,
-  CR,
-  LF,
-  Control,
-  Extend,
-  Regional_Indicator,
-  SpacingMark,
-  L,
-  V,
-  T,
-  LV,
-  LVT,
-  ZWJ,
+// The properties the segmentation and casing code reads for every code point,
+// so that each code point costs a single lookup. 'flags' holds the
+// 'CodePointRecord_*' bits.
+struct CodePointRecord {
+  GeneralCategory general_category;
+  GraphemeBreak grapheme_break;
+  WordBreak word_break;
+  SentenceBreak sentence_break;
+  uint8_t combining_class;
+  uint8_t flags;
 };
 
-// This is generated from 'WordBreakProperty.txt' in Unicode database.
-// `python scripts/gen_property_values.py < UCD/auxiliary/WordBreakProperty.txt`
-enum class WordBreak {
-  Unassigned,
-  Double_Quote,
-  Single_Quote,
-  Hebrew_Letter,
-  CR,
-  LF,
-  Newline,
-  Extend,
-  Regional_Indicator,
-  Format,
-  Katakana,
-  ALetter,
-  MidLetter,
-  MidNum,
-  MidNumLet,
-  Numeric,
-  ExtendNumLet,
-  ZWJ,
-  WSegSpace,
+const uint8_t CodePointRecord_Extended_Pictographic = 0b00000001;
+const uint8_t CodePointRecord_Cased = 0b00000010;
+const uint8_t CodePointRecord_Case_Ignorable = 0b00000100;
+const uint8_t CodePointRecord_Changes_When_Lowercased = 0b00001000;
+const uint8_t CodePointRecord_Changes_When_Uppercased = 0b00010000;
+const uint8_t CodePointRecord_Changes_When_Titlecased = 0b00100000;
+const uint8_t CodePointRecord_Changes_When_Casefolded = 0b01000000;
+const uint8_t CodePointRecord_Changes_When_Casemapped = 0b10000000;
+
+#define UNICODELIB_DECLARE_TRIE(T, name)                                       \
+  extern const uint16_t name##_stage1[];                                       \
+  extern const uint16_t name##_stage2[];                                       \
+  extern const T name##_stage3[]
+
+extern const char _unicode_version[];
+UNICODELIB_DECLARE_TRIE(GeneralCategory, _general_category_properties);
+UNICODELIB_DECLARE_TRIE(uint64_t, _properties);
+UNICODELIB_DECLARE_TRIE(uint32_t, _derived_core_properties);
+extern const SimpleCaseDelta _simple_case_deltas[];
+UNICODELIB_DECLARE_TRIE(uint8_t, _simple_case_delta_ids);
+extern const char32_t _special_case_mapping_pool[];
+extern const SpecialCasing _special_case_mappings[];
+UNICODELIB_DECLARE_TRIE(uint8_t, _special_case_mapping_ids);
+extern const char32_t _case_folding_pool[];
+extern const CaseFolding _case_folding_values[];
+UNICODELIB_DECLARE_TRIE(uint16_t, _case_foldings);
+UNICODELIB_DECLARE_TRIE(Block, _block_properties);
+UNICODELIB_DECLARE_TRIE(Script, _script_properties);
+extern const ScriptSet _script_extension_sets[];
+UNICODELIB_DECLARE_TRIE(uint16_t, _script_extension_ids);
+UNICODELIB_DECLARE_TRIE(uint8_t, _combining_class_properties);
+UNICODELIB_DECLARE_TRIE(uint8_t, _emoji_properties);
+extern const char32_t _decomposition_pool[];
+UNICODELIB_DECLARE_TRIE(uint16_t, _decomposition_properties);
+extern const char32_t _normalization_composition_pairs[];
+UNICODELIB_DECLARE_TRIE(uint16_t, _normalization_composition);
+extern const CodePointRecord _code_point_records[];
+UNICODELIB_DECLARE_TRIE(uint8_t, _code_point_record_ids);
+
+#undef UNICODELIB_DECLARE_TRIE
+
+// The range index of a property, generated by 'genPropertyRangeTables'. The
+// ranges of value 'v' are from 'ranges[offsets[v]]' up to
+// 'ranges[offsets[v + 1]]'. The values of a binary property mask are its bits.
+struct PropertyRanges {
+  const CodePointRange *ranges;
+  const uint32_t *offsets;
+  size_t value_count;
 };
 
-// This is generated from 'SentenceBreakProperty.txt' in Unicode database.
-// `python scripts/gen_property_values.py < UCD/auxiliary/SentenceBreakProperty.txt`
-enum class SentenceBreak {
-  Unassigned,
-  CR,
-  LF,
-  Extend,
-  Sep,
-  Format,
-  Sp,
-  Lower,
-  Upper,
-  OLetter,
-  Numeric,
-  ATerm,
-  STerm,
-  Close,
-  SContinue,
+extern const PropertyRanges _general_category_range_index;
+extern const PropertyRanges _property_range_index;
+extern const PropertyRanges _derived_core_property_range_index;
+extern const PropertyRanges _grapheme_break_range_index;
+extern const PropertyRanges _word_break_range_index;
+extern const PropertyRanges _sentence_break_range_index;
+extern const PropertyRanges _block_range_index;
+extern const PropertyRanges _script_range_index;
+
+// A name of the perfect hash table generated by 'genPropertyNameTable', which
+// is 'length' bytes of '_property_name_pool' from 'offset'. 'ns' is 0 for a
+// property name and 1 + 'PropertyType' for a value of that property.
+struct PropertyNameEntry {
+  uint16_t offset;
+  uint8_t length;
+  uint8_t ns;
+  PropertyType type;
+  uint64_t value;
 };
 
-// This is generated from 'emoji-data.txt' in Unicode database.
-// `python scripts/gen_property_values.py < UCD/emoji/emoji-data.txt`
-enum class Emoji {
-  Unassigned,
-  Emoji,
-  Emoji_Presentation,
-  Emoji_Modifier,
-  Emoji_Modifier_Base,
-  Emoji_Component,
-  Extended_Pictographic,
+// The names are tied to the enums the library is built with, so they are not
+// part of 'DataTables'.
+extern const char _property_name_pool[];
+extern const PropertyNameEntry _property_names[];
+extern const size_t _property_name_count;
+extern const uint16_t _property_name_seeds[];
+extern const size_t _property_name_seed_count;
+
+// Every table the library reads, either the compiled-in arrays above or the
+// sections of a data file mapped by 'load_data_file'.
+struct DataTables {
+  const char *unicode_version;
+  CodePointTrie<GeneralCategory> general_category_properties;
+  CodePointTrie<uint64_t> properties;
+  CodePointTrie<uint32_t> derived_core_properties;
+  const SimpleCaseDelta *simple_case_deltas;
+  CodePointTrie<uint8_t> simple_case_delta_ids;
+  const char32_t *special_case_mapping_pool;
+  // Sorted by code point, with the unconditional mapping of a code point
+  // last. 'special_case_mapping_ids' gives the first row of a code point.
+  const SpecialCasing *special_case_mappings;
+  CodePointTrie<uint8_t> special_case_mapping_ids;
+  const char32_t *case_folding_pool;
+  const CaseFolding *case_folding_values;
+  CodePointTrie<uint16_t> case_foldings;
+  CodePointTrie<Block> block_properties;
+  CodePointTrie<Script> script_properties;
+  const ScriptSet *script_extension_sets;
+  CodePointTrie<uint16_t> script_extension_ids;
+  CodePointTrie<uint8_t> combining_class_properties;
+  const char32_t *decomposition_pool;
+  CodePointTrie<uint16_t> decomposition_properties;
+  const char32_t *normalization_composition_pairs;
+  CodePointTrie<uint16_t> normalization_composition;
+  CodePointTrie<uint8_t> emoji_properties;
+  const CodePointRecord *code_point_records;
+  CodePointTrie<uint8_t> code_point_record_ids;
+  const PropertyRanges *general_category_ranges;
+  const PropertyRanges *property_ranges;
+  const PropertyRanges *derived_core_property_ranges;
+  const PropertyRanges *grapheme_break_ranges;
+  const PropertyRanges *word_break_ranges;
+  const PropertyRanges *sentence_break_ranges;
+  const PropertyRanges *block_ranges;
+  const PropertyRanges *script_ranges;
+  const Latin1Record *latin1_records;
 };
 
-extern const GeneralCategory _general_category_properties[];
-extern const uint64_t _properties[];
-extern const uint32_t _derived_core_properties[];
-extern const std::unordered_map<char32_t, const char32_t *>
-    _simple_case_mappings;
-extern const std::unordered_multimap<char32_t, SpecialCasing>
-    _special_case_mappings;
-extern const std::unordered_multimap<char32_t, SpecialCasing>
-    _special_case_mappings_default;
-extern const std::unordered_map<char32_t, CaseFolding> _case_foldings;
-extern const Block _block_properties[];
-extern const Script _script_properties[];
-extern const int _script_extension_ids[];
-extern const std::vector<std::vector<Script>>
-    _script_extension_properties_for_id;
-extern const NormalizationProperties _normalization_properties[];
-extern const std::unordered_map<std::u32string, char32_t>
-    _normalization_composition;
-extern const GraphemeBreak _grapheme_break_properties[];
-extern const WordBreak _word_break_properties[];
-extern const SentenceBreak _sentence_break_properties[];
-extern const Emoji _emoji_properties[];
+extern const DataTables _builtin_tables;
+
+// The default context as the library's sources name it.
+using detail::_tables;
+using detail::_default_latin1_records;
+
+inline const CodePointRecord &code_point_record(DataContext ctx, char32_t cp) {
+  return ctx->code_point_records[ctx->code_point_record_ids[cp]];
+}
+
+// The code points whose value in 'trie' satisfies 'pred', as the inversion
+// list of a 'CodePointSet'. Each leaf is located once for its 16 code points.
+template <typename T, typename Pred>
+inline std::vector<char32_t> trie_inversion_list(const CodePointTrie<T> &trie,
+                                                 Pred pred) {
+  const char32_t leaf_size = 1 << CodePointTrie<T>::Shift2;
+  std::vector<char32_t> list;
+  bool in = false;
+  for (char32_t cp = 0; cp < 0x110000; cp += leaf_size) {
+    auto block = trie.stage1[cp >> CodePointTrie<T>::Shift1];
+    auto leaf = trie.stage2[block + ((cp >> CodePointTrie<T>::Shift2) & 0x3F)];
+    for (char32_t i = 0; i < leaf_size; i++) {
+      if (pred(trie.stage3[leaf + i]) != in) {
+        list.push_back(cp + i);
+        in = !in;
+      }
+    }
+  }
+  if (in) {
+    list.push_back(0x110000);
+  }
+  return list;
+}
+
+// The inversion list of the code points whose value in 'index' satisfies
+// 'pred', in O(values + ranges) instead of a scan of the code space. The
+// ranges of one value are increasing and never adjacent, so only those of
+// several values need sorting and merging.
+template <typename Pred>
+inline std::vector<char32_t> range_inversion_list(const PropertyRanges &index,
+                                                  Pred pred) {
+  std::vector<CodePointRange> ranges;
+  size_t value_count = 0;
+  for (size_t value = 0; value < index.value_count; value++) {
+    if (pred(value)) {
+      ranges.insert(ranges.end(), index.ranges + index.offsets[value],
+                    index.ranges + index.offsets[value + 1]);
+      value_count++;
+    }
+  }
+  if (value_count > 1) {
+    std::sort(ranges.begin(), ranges.end(),
+              [](const CodePointRange &a, const CodePointRange &b) {
+                return a.first < b.first;
+              });
+  }
+  std::vector<char32_t> list;
+  for (const auto &r : ranges) {
+    if (!list.empty() && r.first <= list.back()) {
+      list.back() = std::max<char32_t>(list.back(), r.last + 1);
+    } else {
+      list.push_back(r.first);
+      list.push_back(r.last + 1);
+    }
+  }
+  return list;
+}
+
+// Batch lookup of a field of 'latin1_records' for code points below U+0100
+// and of 'trie' for the others. The code points are taken eight at a time,
+// and a group is answered from 'latin1_records' only when all of them are
+// below U+0100, so runs of ASCII text skip the trie while mixed text costs
+// one well predicted branch per group instead of one per code point.
+template <typename T, typename F>
+inline void lookup_with_latin1(DataContext ctx, const CodePointTrie<T> &trie,
+                               const char32_t *s32, size_t l, T *out,
+                               F field) {
+  const size_t group = 8;
+  size_t i = 0;
+  for (; i + group <= l; i += group) {
+    char32_t bits = 0;
+    for (size_t j = 0; j < group; j++) {
+      bits |= s32[i + j];
+    }
+    if (bits < 0x100) {
+      for (size_t j = 0; j < group; j++) {
+        out[i + j] = ctx->latin1_records[s32[i + j]].*field;
+      }
+    } else {
+      trie.lookup(s32 + i, group, out + i);
+    }
+  }
+  trie.lookup(s32 + i, l - i, out + i);
+}
 
 }  // namespace unicode
 
@@ -0,0 +1,58 @@
+#include "unicodelib.h"
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Emoji
+//-----------------------------------------------------------------------------
+
+uint8_t emoji_property_mask(DataContext ctx, char32_t cp) {
+  return ctx->emoji_properties[cp];
+}
+
+void emoji_property_masks(DataContext ctx, const char32_t *s32, size_t l,
+                          uint8_t *out) {
+  ctx->emoji_properties.lookup(s32, l, out);
+}
+
+bool is_emoji(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Emoji) != 0;
+}
+
+bool is_emoji_presentation(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Emoji_Presentation) != 0;
+}
+
+bool is_emoji_modifier(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Emoji_Modifier) != 0;
+}
+
+bool is_emoji_modifier_base(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Emoji_Modifier_Base) != 0;
+}
+
+bool is_emoji_component(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Emoji_Component) != 0;
+}
+
+bool is_extended_pictographic(DataContext ctx, char32_t cp) {
+  return (ctx->emoji_properties[cp] & EmojiProperty_Extended_Pictographic) !=
+         0;
+}
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+uint8_t emoji_property_mask(char32_t cp) {
+  return emoji_property_mask(_tables, cp);
+}
+
+void emoji_property_masks(const char32_t *s32, size_t l, uint8_t *out) {
+  emoji_property_masks(_tables, s32, l, out);
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
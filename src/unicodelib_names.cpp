@@ -0,0 +1,134 @@
+#include "unicodelib.h"
+
+#include <cstring>
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Property Names
+//-----------------------------------------------------------------------------
+
+// Longer than any name in '_property_name_pool'.
+static const size_t MaxNameLength = 256;
+
+// UAX #44-LM3. This must match 'loose_name' in 'scripts/gen_tables.py'.
+// Returns false if the name is too long to be known.
+static bool loose_name(const char *s8, size_t l, char *key, size_t &key_len) {
+  key_len = 0;
+  for (size_t i = 0; i < l; i++) {
+    auto c = s8[i];
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+        c == '\r' || c == '_' || c == '-') {
+      continue;
+    }
+    if (key_len == MaxNameLength) {
+      return false;
+    }
+    key[key_len++] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a')
+                                            : c;
+  }
+  if (key_len >= 2 && key[0] == 'i' && key[1] == 's') {
+    key_len -= 2;
+    memmove(key, key + 2, key_len);
+  }
+  return true;
+}
+
+// This must match 'hash_name' in 'scripts/gen_tables.py'.
+static uint32_t hash_name(uint8_t ns, const char *key, size_t l,
+                          uint32_t seed) {
+  uint32_t h = (0x811C9DC5 ^ seed ^ ns) * 0x01000193;
+  for (size_t i = 0; i < l; i++) {
+    h = (h ^ static_cast<uint8_t>(key[i])) * 0x01000193;
+  }
+  return h;
+}
+
+static const PropertyNameEntry *find_name(uint8_t ns, const char *key,
+                                          size_t l) {
+  auto bucket = hash_name(ns, key, l, 0) % _property_name_seed_count;
+  auto seed = _property_name_seeds[bucket];
+  const auto &e = _property_names[hash_name(ns, key, l, seed) %
+                                  _property_name_count];
+  if (e.ns == ns && e.length == l &&
+      !memcmp(_property_name_pool + e.offset, key, l)) {
+    return &e;
+  }
+  return nullptr;
+}
+
+static uint8_t value_namespace(PropertyType type) {
+  return static_cast<uint8_t>(1 + static_cast<int>(type));
+}
+
+static bool is_binary(PropertyType type) {
+  return type == PropertyType::Property ||
+         type == PropertyType::Derived_Property;
+}
+
+static bool is_one_of(const char *key, size_t l,
+                      std::initializer_list<const char *> names) {
+  for (auto name : names) {
+    if (strlen(name) == l && !memcmp(name, key, l)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool resolve_property(const char *s8, size_t l, PropertyValue &out) {
+  char key[MaxNameLength];
+  size_t key_len = 0;
+
+  auto eq = static_cast<const char *>(memchr(s8, '=', l));
+  if (!eq) {
+    if (!loose_name(s8, l, key, key_len)) {
+      return false;
+    }
+    for (auto type : {PropertyType::General_Category, PropertyType::Script}) {
+      if (auto e = find_name(value_namespace(type), key, key_len)) {
+        out = {e->type, e->value, false};
+        return true;
+      }
+    }
+    auto e = find_name(0, key, key_len);
+    if (!e || !is_binary(e->type)) {
+      return false;
+    }
+    out = {e->type, e->value, false};
+    return true;
+  }
+
+  if (!loose_name(s8, static_cast<size_t>(eq - s8), key, key_len)) {
+    return false;
+  }
+  auto property = find_name(0, key, key_len);
+  if (!property ||
+      !loose_name(eq + 1, static_cast<size_t>(s8 + l - eq - 1), key,
+                  key_len)) {
+    return false;
+  }
+
+  if (is_binary(property->type)) {
+    bool negated = false;
+    if (is_one_of(key, key_len, {"no", "n", "false", "f"})) {
+      negated = true;
+    } else if (!is_one_of(key, key_len, {"yes", "y", "true", "t"})) {
+      return false;
+    }
+    out = {property->type, property->value, negated};
+    return true;
+  }
+
+  auto e = find_name(value_namespace(property->type), key, key_len);
+  if (!e) {
+    return false;
+  }
+  out = {e->type, e->value, false};
+  return true;
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -0,0 +1,364 @@
+#include "unicodelib.h"
+
+#include <algorithm>
+#include "unicodelib_data.h"
+#include "unicodelib_encodings.h"
+
+namespace unicode {
+
+namespace hangul {
+
+//-----------------------------------------------------------------------------
+// Hangul Algorithm
+//-----------------------------------------------------------------------------
+
+// Common Constants
+const char32_t SBase = 0xAC00;
+const char32_t LBase = 0x1100;
+const char32_t VBase = 0x1161;
+const char32_t TBase = 0x11A7;
+const size_t LCount = 19;
+const size_t VCount = 21;
+const size_t TCount = 28;
+const size_t NCount = VCount * TCount;  // 588
+const size_t SCount = LCount * NCount;  // 11172
+
+static bool is_precomposed_syllable(char32_t cp) {
+  return SBase <= cp && cp < SBase + SCount;
+}
+
+template <typename Out> static void decompose_hangul(char32_t cp, Out &out) {
+  int SIndex = cp - SBase;
+  char32_t L = LBase + SIndex / NCount;
+  char32_t V = VBase + (SIndex % NCount) / TCount;
+  char32_t T = TBase + SIndex % TCount;
+  out += L;
+  out += V;
+  if (T != TBase) {
+    out += T;
+  }
+}
+
+static bool compose_hangul(char32_t first, char32_t second, char32_t &cp) {
+  // 1. check to see if two current characters are L and V
+  int LIndex = first - LBase;
+  if (0 <= LIndex && LIndex < static_cast<int>(LCount)) {
+    int VIndex = second - VBase;
+    if (0 <= VIndex && VIndex < static_cast<int>(VCount)) {
+      // make syllable of form LV
+      cp = static_cast<char32_t>(SBase + (LIndex * VCount + VIndex) * TCount);
+      return true;
+    }
+  }
+
+  // 2. check to see if two current characters are LV and T
+  int SIndex = first - SBase;
+  if (0 <= SIndex && SIndex < static_cast<int>(SCount) &&
+      (SIndex % TCount) == 0) {
+    int TIndex = second - TBase;
+    if (0 < TIndex && TIndex < static_cast<int>(TCount)) {
+      // make syllable of form LVT
+      cp = first + TIndex;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace hangul
+
+//-----------------------------------------------------------------------------
+// Normalization
+//-----------------------------------------------------------------------------
+
+enum class Normalization {
+  NFC,
+  NFD,
+  NFKC,
+  NFKD,
+};
+
+template <typename Out>
+static void decompose_code(DataContext ctx, const char32_t cp, Out &out,
+                           Normalization norm) {
+  if (hangul::is_precomposed_syllable(cp)) {
+    hangul::decompose_hangul(cp, out);
+  } else {
+    // The lowest bit is the compatibility flag, and the rest is the offset
+    // of the decomposition in 'decomposition_pool'.
+    auto decomposition = ctx->decomposition_properties[cp];
+    auto compat = (decomposition & 1) != 0;
+    if (decomposition && (!compat || norm == Normalization::NFKC ||
+                          norm == Normalization::NFKD)) {
+      const auto *codes = &ctx->decomposition_pool[decomposition >> 1];
+      size_t i = 0;
+      while (codes[i]) {
+        decompose_code(ctx, codes[i], out, norm);
+        i++;
+      }
+    } else {
+      out += cp;
+    }
+  }
+}
+
+// Reorders combining marks with 'Canonical Ordering Algorithm'.
+static void reorder(DataContext ctx, char32_t *s32, size_t l) {
+  for (size_t i = 0; i < l; i++) {
+    if (combining_class(ctx, s32[i]) > 0) {
+      for (size_t j = i; j > 0; j--) {
+        auto prev = s32[j - 1];
+        auto curr = s32[j];
+        if (combining_class(ctx, prev) <= combining_class(ctx, curr)) {
+          break;
+        }
+        std::swap(s32[j - 1], s32[j]);
+      }
+    }
+  }
+}
+
+static bool compose_pair(DataContext ctx, char32_t cp0, char32_t cp1,
+                         char32_t &cp) {
+  if (hangul::compose_hangul(cp0, cp1, cp)) {
+    return true;
+  }
+
+  auto offset = ctx->normalization_composition[cp0];
+  if (offset) {
+    // (second, composite) pairs sorted by the second code point.
+    for (auto p = &ctx->normalization_composition_pairs[offset]; p[0];
+         p += 2) {
+      if (p[0] == cp1) {
+        cp = p[1];
+        return true;
+      }
+      if (p[0] > cp1) {
+        break;
+      }
+    }
+  }
+  return false;
+}
+
+// Composes 's32' in place and returns the new length.
+static size_t compose(DataContext ctx, char32_t *s32, size_t l) {
+  // 'Canonical Composition Algorithm': each character is either combined
+  // with the last starter in place, or moved down to the end of the output,
+  // which never passes the character being read.
+  if (!l) {
+    return 0;
+  }
+
+  size_t starter = 0;
+  size_t length = 1;
+
+  // A leading non-starter blocks any composition until the next starter.
+  int last_class = combining_class(ctx, s32[0]) == 0 ? 0 : 256;
+
+  for (size_t i = 1; i < l; i++) {
+    auto cp = s32[i];
+    auto klass = combining_class(ctx, cp);
+    char32_t composite;
+    if ((last_class < klass || last_class == 0) &&
+        compose_pair(ctx, s32[starter], cp, composite)) {
+      s32[starter] = composite;
+      continue;
+    }
+    if (klass == 0) {
+      starter = length;
+    }
+    last_class = klass;
+    s32[length++] = cp;
+  }
+
+  return length;
+}
+
+static bool is_composing(Normalization norm) {
+  return norm == Normalization::NFC || norm == Normalization::NFKC;
+}
+
+// Decomposes 's32' after the end of 'out', then reorders and composes the new
+// part in place, so that no temporary strings are needed.
+template <typename Out>
+static void normalize(DataContext ctx, const char32_t *s32, size_t l,
+                      Normalization norm, Out &out) {
+  auto start = out.length();
+  detail::reserve_more(out, l);
+  for (size_t i = 0; i < l; i++) {
+    decompose_code(ctx, s32[i], out, norm);
+  }
+
+  auto length = out.length() - start;
+  reorder(ctx, &out[start], length);
+  if (is_composing(norm)) {
+    out.resize(start + compose(ctx, &out[start], length));
+  }
+}
+
+static size_t normalize(DataContext ctx, const char32_t *s32, size_t l,
+                        Normalization norm, char32_t *buff, size_t size) {
+  BufferOutput out(buff, size);
+  for (size_t i = 0; i < l; i++) {
+    decompose_code(ctx, s32[i], out, norm);
+  }
+
+  // The decomposition must fit to be reordered and composed in place. When it
+  // doesn't, the output is built in a scratch string, so that 'buff' still
+  // gets the part that fits and the result is the exact length.
+  if (!out.fits()) {
+    std::u32string scratch;
+    normalize(ctx, s32, l, norm, scratch);
+    auto fit = std::min(size, scratch.size());
+    std::copy(scratch.data(), scratch.data() + fit, buff);
+    return scratch.size();
+  }
+  reorder(ctx, buff, out.size());
+  return is_composing(norm) ? compose(ctx, buff, out.size()) : out.size();
+}
+
+std::u32string to_nfc(DataContext ctx, const char32_t *s32, size_t l) {
+  std::u32string out;
+  normalize(ctx, s32, l, Normalization::NFC, out);
+  return out;
+}
+
+void to_nfc(DataContext ctx, const char32_t *s32, size_t l,
+            std::u32string &out) {
+  normalize(ctx, s32, l, Normalization::NFC, out);
+}
+
+size_t to_nfc(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+              size_t size) {
+  return normalize(ctx, s32, l, Normalization::NFC, buff, size);
+}
+
+std::u32string to_nfd(DataContext ctx, const char32_t *s32, size_t l) {
+  std::u32string out;
+  normalize(ctx, s32, l, Normalization::NFD, out);
+  return out;
+}
+
+void to_nfd(DataContext ctx, const char32_t *s32, size_t l,
+            std::u32string &out) {
+  normalize(ctx, s32, l, Normalization::NFD, out);
+}
+
+size_t to_nfd(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+              size_t size) {
+  return normalize(ctx, s32, l, Normalization::NFD, buff, size);
+}
+
+std::u32string to_nfkc(DataContext ctx, const char32_t *s32, size_t l) {
+  std::u32string out;
+  normalize(ctx, s32, l, Normalization::NFKC, out);
+  return out;
+}
+
+void to_nfkc(DataContext ctx, const char32_t *s32, size_t l,
+             std::u32string &out) {
+  normalize(ctx, s32, l, Normalization::NFKC, out);
+}
+
+size_t to_nfkc(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+               size_t size) {
+  return normalize(ctx, s32, l, Normalization::NFKC, buff, size);
+}
+
+std::u32string to_nfkd(DataContext ctx, const char32_t *s32, size_t l) {
+  std::u32string out;
+  normalize(ctx, s32, l, Normalization::NFKD, out);
+  return out;
+}
+
+void to_nfkd(DataContext ctx, const char32_t *s32, size_t l,
+             std::u32string &out) {
+  normalize(ctx, s32, l, Normalization::NFKD, out);
+}
+
+size_t to_nfkd(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+               size_t size) {
+  return normalize(ctx, s32, l, Normalization::NFKD, buff, size);
+}
+
+namespace detail {
+
+void to_nfc(DataContext ctx, const char32_t *s32, size_t l,
+            StringOutput &out) {
+  normalize(ctx, s32, l, Normalization::NFC, out);
+}
+
+void to_nfd(DataContext ctx, const char32_t *s32, size_t l,
+            StringOutput &out) {
+  normalize(ctx, s32, l, Normalization::NFD, out);
+}
+
+void to_nfkc(DataContext ctx, const char32_t *s32, size_t l,
+             StringOutput &out) {
+  normalize(ctx, s32, l, Normalization::NFKC, out);
+}
+
+void to_nfkd(DataContext ctx, const char32_t *s32, size_t l,
+             StringOutput &out) {
+  normalize(ctx, s32, l, Normalization::NFKD, out);
+}
+
+}  // namespace detail
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+std::u32string to_nfc(const char32_t *s32, size_t l) {
+  return to_nfc(_tables, s32, l);
+}
+
+std::u32string to_nfd(const char32_t *s32, size_t l) {
+  return to_nfd(_tables, s32, l);
+}
+
+std::u32string to_nfkc(const char32_t *s32, size_t l) {
+  return to_nfkc(_tables, s32, l);
+}
+
+std::u32string to_nfkd(const char32_t *s32, size_t l) {
+  return to_nfkd(_tables, s32, l);
+}
+
+void to_nfc(const char32_t *s32, size_t l, std::u32string &out) {
+  to_nfc(_tables, s32, l, out);
+}
+
+size_t to_nfc(const char32_t *s32, size_t l, char32_t *buff, size_t size) {
+  return to_nfc(_tables, s32, l, buff, size);
+}
+
+void to_nfd(const char32_t *s32, size_t l, std::u32string &out) {
+  to_nfd(_tables, s32, l, out);
+}
+
+size_t to_nfd(const char32_t *s32, size_t l, char32_t *buff, size_t size) {
+  return to_nfd(_tables, s32, l, buff, size);
+}
+
+void to_nfkc(const char32_t *s32, size_t l, std::u32string &out) {
+  to_nfkc(_tables, s32, l, out);
+}
+
+size_t to_nfkc(const char32_t *s32, size_t l, char32_t *buff, size_t size) {
+  return to_nfkc(_tables, s32, l, buff, size);
+}
+
+void to_nfkd(const char32_t *s32, size_t l, std::u32string &out) {
+  to_nfkd(_tables, s32, l, out);
+}
+
+size_t to_nfkd(const char32_t *s32, size_t l, char32_t *buff, size_t size) {
+  return to_nfkd(_tables, s32, l, buff, size);
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
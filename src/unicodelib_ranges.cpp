@@ -0,0 +1,107 @@
+#include "unicodelib.h"
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Property Ranges
+//-----------------------------------------------------------------------------
+
+static CodePointRangeList value_ranges(const PropertyRanges *index,
+                                       size_t value) {
+  if (value >= index->value_count) {
+    return {nullptr, 0};
+  }
+  auto first = index->offsets[value];
+  return {index->ranges + first, index->offsets[value + 1] - first};
+}
+
+// The ranges of a single bit of a mask, or none if 'mask' isn't a single bit.
+static CodePointRangeList bit_ranges(const PropertyRanges *index,
+                                     uint64_t mask) {
+  if (mask == 0 || (mask & (mask - 1)) != 0) {
+    return {nullptr, 0};
+  }
+  size_t bit = 0;
+  while (mask >>= 1) {
+    bit++;
+  }
+  return value_ranges(index, bit);
+}
+
+CodePointRangeList code_point_ranges(DataContext ctx, GeneralCategory gc) {
+  return value_ranges(ctx->general_category_ranges, static_cast<size_t>(gc));
+}
+
+CodePointRangeList property_ranges(DataContext ctx, uint64_t property) {
+  return bit_ranges(ctx->property_ranges, property);
+}
+
+CodePointRangeList derived_property_ranges(DataContext ctx,
+                                           uint32_t derived_property) {
+  return bit_ranges(ctx->derived_core_property_ranges, derived_property);
+}
+
+CodePointRangeList code_point_ranges(DataContext ctx, GraphemeBreak gb) {
+  return value_ranges(ctx->grapheme_break_ranges, static_cast<size_t>(gb));
+}
+
+CodePointRangeList code_point_ranges(DataContext ctx, WordBreak wb) {
+  return value_ranges(ctx->word_break_ranges, static_cast<size_t>(wb));
+}
+
+CodePointRangeList code_point_ranges(DataContext ctx, SentenceBreak sb) {
+  return value_ranges(ctx->sentence_break_ranges, static_cast<size_t>(sb));
+}
+
+#if !defined(UNICODELIB_NO_SCRIPTS)
+CodePointRangeList code_point_ranges(DataContext ctx, Block blk) {
+  return value_ranges(ctx->block_ranges, static_cast<size_t>(blk));
+}
+
+CodePointRangeList code_point_ranges(DataContext ctx, Script sc) {
+  return value_ranges(ctx->script_ranges, static_cast<size_t>(sc));
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+CodePointRangeList code_point_ranges(GeneralCategory gc) {
+  return code_point_ranges(_tables, gc);
+}
+
+CodePointRangeList property_ranges(uint64_t property) {
+  return property_ranges(_tables, property);
+}
+
+CodePointRangeList derived_property_ranges(uint32_t derived_property) {
+  return derived_property_ranges(_tables, derived_property);
+}
+
+CodePointRangeList code_point_ranges(GraphemeBreak gb) {
+  return code_point_ranges(_tables, gb);
+}
+
+CodePointRangeList code_point_ranges(WordBreak wb) {
+  return code_point_ranges(_tables, wb);
+}
+
+CodePointRangeList code_point_ranges(SentenceBreak sb) {
+  return code_point_ranges(_tables, sb);
+}
+
+#if !defined(UNICODELIB_NO_SCRIPTS)
+CodePointRangeList code_point_ranges(Block blk) {
+  return code_point_ranges(_tables, blk);
+}
+
+CodePointRangeList code_point_ranges(Script sc) {
+  return code_point_ranges(_tables, sc);
+}
+#endif
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -0,0 +1,85 @@
+#include "unicodelib.h"
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Block
+//-----------------------------------------------------------------------------
+
+Block block(DataContext ctx, char32_t cp) { return ctx->block_properties[cp]; }
+
+void blocks(DataContext ctx, const char32_t *s32, size_t l, Block *out) {
+  ctx->block_properties.lookup(s32, l, out);
+}
+
+CodePointSet block_set(DataContext ctx, Block blk) {
+  if (ctx->block_ranges) {
+    return CodePointSet(range_inversion_list(
+        *ctx->block_ranges,
+        [&](size_t value) { return value == static_cast<size_t>(blk); }));
+  }
+  return CodePointSet(trie_inversion_list(
+      ctx->block_properties, [&](Block value) { return value == blk; }));
+}
+
+//-----------------------------------------------------------------------------
+// Script
+//-----------------------------------------------------------------------------
+
+Script script(DataContext ctx, char32_t cp) {
+  return ctx->script_properties[cp];
+}
+
+void scripts(DataContext ctx, const char32_t *s32, size_t l, Script *out) {
+  ctx->script_properties.lookup(s32, l, out);
+}
+
+CodePointSet script_set(DataContext ctx, Script sc) {
+  if (ctx->script_ranges) {
+    return CodePointSet(range_inversion_list(
+        *ctx->script_ranges,
+        [&](size_t value) { return value == static_cast<size_t>(sc); }));
+  }
+  return CodePointSet(trie_inversion_list(
+      ctx->script_properties, [&](Script value) { return value == sc; }));
+}
+
+ScriptSet script_extensions(DataContext ctx, char32_t cp) {
+  return ctx->script_extension_sets[ctx->script_extension_ids[cp]];
+}
+
+bool is_script(DataContext ctx, Script sc, char32_t cp) {
+  return ctx->script_extension_sets[ctx->script_extension_ids[cp]]
+      .contains(sc);
+}
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+Block block(char32_t cp) { return block(_tables, cp); }
+
+void blocks(const char32_t *s32, size_t l, Block *out) {
+  blocks(_tables, s32, l, out);
+}
+
+CodePointSet block_set(Block blk) { return block_set(_tables, blk); }
+
+Script script(char32_t cp) { return script(_tables, cp); }
+
+void scripts(const char32_t *s32, size_t l, Script *out) {
+  scripts(_tables, s32, l, out);
+}
+
+CodePointSet script_set(Script sc) { return script_set(_tables, sc); }
+
+ScriptSet script_extensions(char32_t cp) {
+  return script_extensions(_tables, cp);
+}
+
+bool is_script(Script sc, char32_t cp) { return is_script(_tables, sc, cp); }
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -0,0 +1,928 @@
+#include "unicodelib.h"
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+const char32_t ZERO_WIDTH_JOINER = 0x200D;
+const char32_t ZERO_WIDTH_NON_JOINER = 0x200C;
+
+//-----------------------------------------------------------------------------
+// Combining Character Sequence
+//-----------------------------------------------------------------------------
+
+bool is_graphic_character(DataContext ctx, char32_t cp) {
+  // D50 Graphic character: A character with the General Category of Letter (L),
+  // Combining Mark (M), Number (N), Punctuation (P), Symbol (S), or Space
+  // Separator (Zs).
+  return is_base_character(ctx, cp) || is_mark(ctx, cp);
+}
+
+bool is_base_character(DataContext ctx, char32_t cp) {
+  // D51 Base character: Any graphic character except for those with the General
+  // Category of Combining Mark (M).
+  auto gc = general_category(ctx, cp);
+  switch (gc) {
+    case GeneralCategory::Zs:
+      return true;
+    default:
+      return is_letter_category(gc) || is_number_category(gc) ||
+             is_punctuation_category(gc) || is_symbol_category(gc);
+  }
+}
+
+static bool is_standard_korean_syllable_block(DataContext ctx,
+                                              const char32_t *s32, size_t l,
+                                              size_t &length) {
+  // D134 Standard Korean syllable block: A sequence of one or more L followed
+  // by a sequence of one or more V and a sequence of zero or more T, or any
+  // other sequence that is canonically equivalent.
+  size_t i = 0;
+  if (i == l ||
+      code_point_record(ctx, s32[i]).grapheme_break != GraphemeBreak::L) {
+    return false;
+  }
+  i++;
+  while (i < l &&
+         code_point_record(ctx, s32[i]).grapheme_break == GraphemeBreak::L) {
+    i++;
+  }
+  if (i == l ||
+      code_point_record(ctx, s32[i]).grapheme_break != GraphemeBreak::V) {
+    return false;
+  }
+  i++;
+  while (i < l &&
+         code_point_record(ctx, s32[i]).grapheme_break == GraphemeBreak::V) {
+    i++;
+  }
+  while (i < l &&
+         code_point_record(ctx, s32[i]).grapheme_break == GraphemeBreak::T) {
+    i++;
+  }
+  length = i;
+  return true;
+}
+
+static bool is_extended_base(DataContext ctx, const char32_t *s32, size_t l,
+                             size_t &length) {
+  // D51a Extended base: Any base character, or any standard Korean syllable
+  // block.
+  if (l > 0) {
+    if (is_standard_korean_syllable_block(ctx, s32, l, length)) {
+      return true;
+    } else if (is_base_character(ctx, s32[0])) {
+      length = 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool is_combining_character(DataContext ctx, char32_t cp) {
+  // D52 Combining character: A character with the General Category of Combining
+  // Mark (M)
+  return is_mark(ctx, cp);
+}
+
+size_t combining_character_sequence_length(DataContext ctx, const char32_t *s32,
+                                           size_t l) {
+  // D56 Combining character sequence: A maximal character sequence consisting
+  // of either a base character followed by a sequence of one or more characters
+  // where each is a combining character, zero width joiner, or zero width
+  // non-joiner; or a sequence of one or more characters where each is a
+  // combining character, zero width joiner, or zero width non-joiner.
+  size_t i = 0;
+  if (l) {
+    if (is_base_character(ctx, s32[i])) {
+      i++;
+    }
+    while (i < l) {
+      auto cp = s32[i];
+      if (is_combining_character(ctx, cp) || cp == ZERO_WIDTH_JOINER ||
+          cp == ZERO_WIDTH_NON_JOINER) {
+        i++;
+      } else {
+        break;
+      }
+    }
+  }
+  return i;
+}
+
+size_t extended_combining_character_sequence_length(DataContext ctx,
+                                                    const char32_t *s32,
+                                                    size_t l) {
+  // D56a Extended combining character sequence: A maximal character sequence
+  // consisting of either an extended base followed by a sequence of one or more
+  // characters where each is a combining character, zero width joiner, or zero
+  // width non-joiner; or a sequence of one or more characters where each is a
+  // combining character, zero width joiner, or zero width non-joiner.
+  size_t i = 0;
+  if (l) {
+    size_t length;
+    if (is_extended_base(ctx, s32, l, length)) {
+      i += length;
+    }
+    while (i < l) {
+      auto cp = s32[i];
+      if (is_combining_character(ctx, cp) || cp == ZERO_WIDTH_JOINER ||
+          cp == ZERO_WIDTH_NON_JOINER) {
+        i++;
+      } else {
+        break;
+      }
+    }
+  }
+  return i;
+}
+
+size_t combining_character_sequence_count(DataContext ctx, const char32_t *s32,
+                                          size_t l) {
+  size_t count = 0;
+  size_t i = 0;
+  while (i < l) {
+    count++;
+    i += combining_character_sequence_length(ctx, s32 + i, l - i);
+  }
+  return count;
+}
+
+size_t extended_combining_character_sequence_count(DataContext ctx,
+                                                   const char32_t *s32,
+                                                   size_t l) {
+  size_t count = 0;
+  size_t i = 0;
+  while (i < l) {
+    count++;
+    i += extended_combining_character_sequence_length(ctx, s32 + i, l - i);
+  }
+  return count;
+}
+
+//-----------------------------------------------------------------------------
+// Grapheme Cluster Segmentation
+//-----------------------------------------------------------------------------
+
+GraphemeBreak grapheme_break(DataContext ctx, char32_t cp) {
+  return code_point_record(ctx, cp).grapheme_break;
+}
+
+void grapheme_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                     GraphemeBreak *out) {
+  for (size_t i = 0; i < l; i++) {
+    out[i] = code_point_record(ctx, s32[i]).grapheme_break;
+  }
+}
+
+bool is_grapheme_boundary(DataContext ctx, const char32_t *s32, size_t l,
+                          size_t i) {
+  //---------------------------------------------------------------------------
+  // Break at the start and end of text, unless the text empty.
+  //---------------------------------------------------------------------------
+
+  // GB1: sot ÷
+  if (i == 0) {
+    return true;
+  }
+
+  // GB2: ÷ eot
+  if (i == l) {
+    return true;
+  }
+
+  auto lp = code_point_record(ctx, s32[i - 1]).grapheme_break;
+  const auto &rr = code_point_record(ctx, s32[i]);
+  auto rp = rr.grapheme_break;
+
+  //---------------------------------------------------------------------------
+  // Do not break between a CR and LF. Otherwise, break before and after
+  // controls.
+  //---------------------------------------------------------------------------
+
+  // GB3: CR × LF
+  if ((lp == GraphemeBreak::CR) && (rp == GraphemeBreak::LF)) {
+    return false;
+  }
+
+  // GB4: (Control|CR|LF) ÷
+  if ((lp == GraphemeBreak::Control || lp == GraphemeBreak::CR ||
+       lp == GraphemeBreak::LF)) {
+    return true;
+  }
+
+  // GB5: ÷ (Control|CR|LF)
+  if ((rp == GraphemeBreak::Control || rp == GraphemeBreak::CR ||
+       rp == GraphemeBreak::LF)) {
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break Hangul syllable sequences.
+  //---------------------------------------------------------------------------
+
+  // GB6: L × (L|V|LV|LVT)
+  if ((lp == GraphemeBreak::L) &&
+      (rp == GraphemeBreak::L || rp == GraphemeBreak::V ||
+       rp == GraphemeBreak::LV || rp == GraphemeBreak::LVT)) {
+    return false;
+  }
+
+  // GB7: (LV|V) × (V|T)
+  if ((lp == GraphemeBreak::LV || lp == GraphemeBreak::V) &&
+      (rp == GraphemeBreak::V || rp == GraphemeBreak::T)) {
+    return false;
+  }
+
+  // GB8: (LVT|T) × T
+  if ((lp == GraphemeBreak::LVT || lp == GraphemeBreak::T) &&
+      (rp == GraphemeBreak::T)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break before extending characters or ZWJ.
+  //---------------------------------------------------------------------------
+
+  // GB9: × Extend
+  if (rp == GraphemeBreak::Extend || rp == GraphemeBreak::ZWJ) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // The GB9a and GB9b rules only apply to extended grapheme clusters:
+  // Do not break before SpacingMakrs, or after Prepend characters.
+  //---------------------------------------------------------------------------
+
+  // GB9a: × SpacingMark
+  if (rp == GraphemeBreak::SpacingMark) {
+    return false;
+  }
+
+  // GB9b: Prepend ×
+  if (lp == GraphemeBreak::Prepend) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within emoji modifier sequences or emoji zwj sewuences.
+  //---------------------------------------------------------------------------
+
+  // GB11: \p{Extended_Pictographic} Extend* ZWJ x \p{Extended_Pictographic}
+  if (lp == GraphemeBreak::ZWJ &&
+      (rr.flags & CodePointRecord_Extended_Pictographic)) {
+    auto pos = static_cast<int>(i) - 2;
+    while (pos >= 0) {
+      const auto &r = code_point_record(ctx, s32[pos]);
+      if (r.grapheme_break != GraphemeBreak::Extend) {
+        if (r.flags & CodePointRecord_Extended_Pictographic) {
+          return false;
+        }
+        break;
+      }
+      pos--;
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within emoji flag sequences. That is, do not break between
+  // regional indicator (RI) symbols if there is an odd number of RI
+  // characters before the break point.
+  //---------------------------------------------------------------------------
+
+  // GB12: ^ (RI RI)* RI x RI
+  // GB13: [^RI] (RI RI)* RI x RI
+  if (lp == GraphemeBreak::Regional_Indicator &&
+      rp == GraphemeBreak::Regional_Indicator) {
+    auto pos = static_cast<int>(i) - 2;
+    while (pos >= 1 &&
+           code_point_record(ctx, s32[pos]).grapheme_break ==
+               GraphemeBreak::Regional_Indicator &&
+           code_point_record(ctx, s32[pos - 1]).grapheme_break ==
+               GraphemeBreak::Regional_Indicator) {
+      pos -= 2;
+    }
+    if (pos < 0) {
+      return false;
+    }
+    if (code_point_record(ctx, s32[pos]).grapheme_break !=
+        GraphemeBreak::Regional_Indicator) {
+      return false;
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Othewise, break everywhere.
+  //---------------------------------------------------------------------------
+
+  // GB999: Any ÷ Any
+  return true;
+}
+
+size_t grapheme_length(DataContext ctx, const char32_t *s32, size_t l) {
+  size_t i = 1;
+  for (; i < l; i++) {
+    if (is_grapheme_boundary(ctx, s32, l, i)) {
+      return i;
+    }
+  }
+  return i;
+}
+
+size_t grapheme_count(DataContext ctx, const char32_t *s32, size_t l) {
+  size_t count = 0;
+  size_t i = 0;
+  while (i < l) {
+    count++;
+    i += grapheme_length(ctx, s32 + i, l - i);
+  }
+  return count;
+}
+
+//-----------------------------------------------------------------------------
+// Word Segmentation
+//-----------------------------------------------------------------------------
+
+WordBreak word_break(DataContext ctx, char32_t cp) {
+  return code_point_record(ctx, cp).word_break;
+}
+
+void word_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                 WordBreak *out) {
+  for (size_t i = 0; i < l; i++) {
+    out[i] = code_point_record(ctx, s32[i]).word_break;
+  }
+}
+
+inline bool AHLetter(WordBreak p) {
+  return p == WordBreak::ALetter || p == WordBreak::Hebrew_Letter;
+}
+
+inline bool MidNumLetQ(WordBreak p) {
+  return p == WordBreak::MidNumLet || p == WordBreak::Single_Quote;
+}
+
+static int previous_word_break_property_position(DataContext ctx,
+                                                 const char32_t *s32,
+                                                 size_t i) {
+  auto prop = WordBreak::Unassigned;
+  auto pos = static_cast<int>(i) - 1;
+  while (pos >= 0) {
+    prop = code_point_record(ctx, s32[pos]).word_break;
+    if (prop != WordBreak::Extend && prop != WordBreak::Format &&
+        prop != WordBreak::ZWJ) {
+      break;
+    }
+    pos--;
+  }
+  return pos;
+}
+
+static size_t next_word_break_property_position(DataContext ctx,
+                                                const char32_t *s32, size_t l,
+                                                size_t i) {
+  auto prop = WordBreak::Unassigned;
+  auto pos = i + 1;
+  while (pos < l) {
+    prop = code_point_record(ctx, s32[pos]).word_break;
+    if (prop != WordBreak::Extend && prop != WordBreak::Format &&
+        prop != WordBreak::ZWJ) {
+      break;
+    }
+    pos++;
+  }
+  return pos;
+}
+
+bool is_word_boundary(DataContext ctx, const char32_t *s32, size_t l,
+                      size_t i) {
+  //---------------------------------------------------------------------------
+  // Break at the start and end of text, unless the text is empty
+  //---------------------------------------------------------------------------
+
+  // WB1: sot ÷
+  if (i == 0) {
+    return true;
+  }
+
+  // WB2: ÷ eot
+  if (i == l) {
+    return true;
+  }
+
+  auto lp = code_point_record(ctx, s32[i - 1]).word_break;
+  const auto &rr = code_point_record(ctx, s32[i]);
+  auto rp = rr.word_break;
+
+  //---------------------------------------------------------------------------
+  // Do not break within CRLF
+  //---------------------------------------------------------------------------
+
+  // WB3: CR × LF
+  if ((lp == WordBreak::CR) && (rp == WordBreak::LF)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Otherwise break before and after Newlines (including CR and LF)
+  //---------------------------------------------------------------------------
+
+  // WB3a: (Newline|CR|LF) ÷
+  if ((lp == WordBreak::Newline || lp == WordBreak::CR ||
+       lp == WordBreak::LF)) {
+    return true;
+  }
+
+  // WB3b: ÷ (Newline|CR|LF)
+  if ((rp == WordBreak::Newline || rp == WordBreak::CR ||
+       rp == WordBreak::LF)) {
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within emoji zwj sequences.
+  //---------------------------------------------------------------------------
+
+  // WB3c: ZWJ x \p{Extended_Pictographic}
+  if (lp == WordBreak::ZWJ &&
+      (rr.flags & CodePointRecord_Extended_Pictographic)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Keep horizontal whitespace together.
+  //---------------------------------------------------------------------------
+
+  // WB3d: WSegSpace x WSegSpace
+  if (lp == WordBreak::WSegSpace && rp == WordBreak::WSegSpace) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Ignore Format and Extend characters, except after sot, CR, LF, and
+  // Newline. (See Section 6.2, Replacing Ignore Rules.) This also has the
+  // effect of: Any × (Format | Extend | ZWJ)
+  //---------------------------------------------------------------------------
+
+  // WB4: X (Extend|Format|ZWJ)* → X
+  if ((rp == WordBreak::Extend || rp == WordBreak::Format ||
+       rp == WordBreak::ZWJ)) {
+    return false;
+  }
+
+  // Find left property
+  lp = WordBreak::Unassigned;
+  auto lpos = previous_word_break_property_position(ctx, s32, i);
+  if (lpos >= 0) {
+    lp = code_point_record(ctx, s32[lpos]).word_break;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break between most letters.
+  //---------------------------------------------------------------------------
+
+  // WB5: AHLetter × AHLetter
+  if (AHLetter(lp) && AHLetter(rp)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break across certain punctuation.
+  //---------------------------------------------------------------------------
+
+  auto rp1 = WordBreak::Unassigned;
+  auto rpos = next_word_break_property_position(ctx, s32, l, i);
+  if (rpos < l) {
+    rp1 = code_point_record(ctx, s32[rpos]).word_break;
+  }
+
+  // WB6: AHLetter × (MidLetter | MidNumLetQ) AHLetter
+  if ((AHLetter(lp)) &&
+      ((rp == WordBreak::MidLetter || MidNumLetQ(rp)) && AHLetter(rp1))) {
+    return false;
+  }
+
+  auto lp1 = WordBreak::Unassigned;
+  lpos = previous_word_break_property_position(ctx, s32, lpos);
+  if (lpos >= 0) {
+    lp1 = code_point_record(ctx, s32[lpos]).word_break;
+  }
+
+  // WB7: AHLetter (MidLetter | MidNumLetQ) × AHLetter
+  if ((AHLetter(lp1) && (lp == WordBreak::MidLetter || MidNumLetQ(lp))) &&
+      (AHLetter(rp))) {
+    return false;
+  }
+
+  // WB7a: Hebrew_Letter × Single_Quote
+  if ((lp == WordBreak::Hebrew_Letter) && (rp == WordBreak::Single_Quote)) {
+    return false;
+  }
+
+  // WB7b: Hebrew_Letter × Double_Quote Hebrew_Letter
+  if ((lp == WordBreak::Hebrew_Letter) &&
+      (rp == WordBreak::Double_Quote && rp1 == WordBreak::Hebrew_Letter)) {
+    return false;
+  }
+
+  // WB7c: Hebrew_Letter Double_Quote × Hebrew_Letter
+  if ((lp1 == WordBreak::Hebrew_Letter && lp == WordBreak::Double_Quote) &&
+      (rp == WordBreak::Hebrew_Letter)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within sequences of digits, or digits adjacent to letters
+  // ("3a", or "A3").
+  //---------------------------------------------------------------------------
+
+  // WB8: Numeric × Numeric
+  if ((lp == WordBreak::Numeric) && (rp == WordBreak::Numeric)) {
+    return false;
+  }
+
+  // WB9: AHLetter × Numeric
+  if ((AHLetter(lp)) && (rp == WordBreak::Numeric)) {
+    return false;
+  }
+
+  // WB10: Numeric × AHLetter
+  if ((lp == WordBreak::Numeric) && (AHLetter(rp))) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within sequences, such as "3.2" or "3,456.789"
+  //---------------------------------------------------------------------------
+
+  // WB11: Numeric (MidNum | MidNumLetQ) × Numeric
+  if ((lp1 == WordBreak::Numeric &&
+       (lp == WordBreak::MidNum || MidNumLetQ(lp))) &&
+      (rp == WordBreak::Numeric)) {
+    return false;
+  }
+
+  // WB12: Numeric × (MidNum | MidNumLetQ) Numeric
+  if ((lp == WordBreak::Numeric) &&
+      ((rp == WordBreak::MidNum || MidNumLetQ(rp)) &&
+       rp1 == WordBreak::Numeric)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break between Katakana.
+  //---------------------------------------------------------------------------
+
+  // WB13: Katakana × Katakana
+  if ((lp == WordBreak::Katakana) && (rp == WordBreak::Katakana)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break from extenders.
+  //---------------------------------------------------------------------------
+
+  // WB13a: (AHLetter | Numeric | Katakana | ExtendNumLet) × ExtendNumLet
+  if ((AHLetter(lp) || lp == WordBreak::Katakana || lp == WordBreak::Numeric ||
+       lp == WordBreak::Katakana || lp == WordBreak::ExtendNumLet) &&
+      (rp == WordBreak::ExtendNumLet)) {
+    return false;
+  }
+
+  // WB13b: ExtendNumLet × (AHLetter | Numeric | Katakana)
+  if ((lp == WordBreak::ExtendNumLet) &&
+      (AHLetter(rp) || rp == WordBreak::Numeric || rp == WordBreak::Katakana)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within emoji flag sequences. That is, do not break between
+  // regional indicator (RI) symbols if there is an odd number of RI
+  // characters before the break point.
+  //---------------------------------------------------------------------------
+
+  // WB15: ^ (RI RI)* RI x RI
+  // WB16: [^RI] (RI RI)* RI x RI
+  {
+    if (lp == WordBreak::Regional_Indicator &&
+        rp == WordBreak::Regional_Indicator) {
+      auto lpos = previous_word_break_property_position(ctx, s32, i);
+
+      while (true) {
+        lpos = previous_word_break_property_position(ctx, s32, lpos);
+        if (lpos < 0 || code_point_record(ctx, s32[lpos]).word_break !=
+                                 WordBreak::Regional_Indicator) {
+          return false;
+        }
+
+        lpos = previous_word_break_property_position(ctx, s32, lpos);
+        if (lpos < 0 || code_point_record(ctx, s32[lpos]).word_break !=
+                                 WordBreak::Regional_Indicator) {
+          break;
+        }
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Othewise, break everywhere.
+  //---------------------------------------------------------------------------
+
+  // WB14: Any ÷ Any
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// Sentence Segmentation
+//-----------------------------------------------------------------------------
+
+SentenceBreak sentence_break(DataContext ctx, char32_t cp) {
+  return code_point_record(ctx, cp).sentence_break;
+}
+
+void sentence_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                     SentenceBreak *out) {
+  for (size_t i = 0; i < l; i++) {
+    out[i] = code_point_record(ctx, s32[i]).sentence_break;
+  }
+}
+
+inline bool ParaSep(SentenceBreak p) {
+  return p == SentenceBreak::Sep || p == SentenceBreak::CR ||
+         p == SentenceBreak::LF;
+}
+
+inline bool SATerm(SentenceBreak p) {
+  return p == SentenceBreak::STerm || p == SentenceBreak::ATerm;
+}
+
+static int previous_sentence_break_property_position(DataContext ctx,
+                                                     const char32_t *s32,
+                                                     size_t i) {
+  auto prop = SentenceBreak::Unassigned;
+  auto pos = static_cast<int>(i) - 1;
+  while (pos >= 0) {
+    prop = code_point_record(ctx, s32[pos]).sentence_break;
+    if (prop != SentenceBreak::Extend && prop != SentenceBreak::Format) {
+      break;
+    }
+    pos--;
+  }
+  return pos;
+}
+
+static size_t next_sentence_break_property_position(DataContext ctx,
+                                                    const char32_t *s32,
+                                                    size_t l, size_t i) {
+  auto pos = i + 1;
+  while (pos < l) {
+    auto prop = code_point_record(ctx, s32[pos]).sentence_break;
+    if (prop != SentenceBreak::Extend && prop != SentenceBreak::Format) {
+      break;
+    }
+    pos++;
+  }
+  return pos;
+}
+
+bool is_sentence_boundary(DataContext ctx, const char32_t *s32, size_t l,
+                          size_t i) {
+  //---------------------------------------------------------------------------
+  // Break at the start and end of text, unless the text is empty.
+  //---------------------------------------------------------------------------
+
+  // SB1: sot ÷
+  if (i == 0) {
+    return true;
+  }
+
+  // SB2: ÷ eot
+  if (i == l) {
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break within CRLF.
+  //---------------------------------------------------------------------------
+
+  auto lp = code_point_record(ctx, s32[i - 1]).sentence_break;
+  auto rp = code_point_record(ctx, s32[i]).sentence_break;
+
+  // SB3: CR × LF
+  if ((lp == SentenceBreak::CR) && (rp == SentenceBreak::LF)) {
+    return false;
+  }
+
+  //---------------------------------------------------------------------------
+  // Break after paragraph separators.
+  //---------------------------------------------------------------------------
+
+  // SB4: ParaSep ÷
+  if (ParaSep(lp)) {
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  // Ignore Format and Extend characters, except after sot, ParaSep, and
+  // within CRLF. (See Section 6.2, Replacing Ignore Rules.) This also has the
+  // effect of: Any × (Format | Extend)
+  //---------------------------------------------------------------------------
+
+  // SB5: X (Extend | Format)* → X
+  if ((rp == SentenceBreak::Extend || rp == SentenceBreak::Format)) {
+    return false;
+  }
+
+  // Find left property
+  lp = SentenceBreak::Unassigned;
+  auto lpos = previous_sentence_break_property_position(ctx, s32, i);
+  if (lpos >= 0) {
+    lp = code_point_record(ctx, s32[lpos]).sentence_break;
+  }
+
+  //---------------------------------------------------------------------------
+  // Do not break after full stop in certain contexts.
+  //---------------------------------------------------------------------------
+
+  // SB6: ATerm × Numeric
+  if ((lp == SentenceBreak::ATerm) && (rp == SentenceBreak::Numeric)) {
+    return false;
+  }
+
+  auto lp1 = SentenceBreak::Unassigned;
+  if (lpos > 0) {
+    lpos = previous_sentence_break_property_position(ctx, s32, lpos);
+    if (lpos >= 0) {
+      lp1 = code_point_record(ctx, s32[lpos]).sentence_break;
+    }
+  }
+
+  // SB7: (Upper | Lower) ATerm × Upper
+  if (((lp1 == SentenceBreak::Upper || lp1 == SentenceBreak::Lower) &&
+       (lp == SentenceBreak::ATerm)) &&
+      (rp == SentenceBreak::Upper)) {
+    return false;
+  }
+
+  auto lp2 = SentenceBreak::Unassigned;
+  {
+    lp2 = SentenceBreak::Unassigned;
+    auto pos = previous_sentence_break_property_position(ctx, s32, i);
+    while (pos >= 0) {
+      lp2 = code_point_record(ctx, s32[pos]).sentence_break;
+      if (lp2 != SentenceBreak::Sp) {
+        break;
+      }
+      pos = previous_sentence_break_property_position(ctx, s32, pos);
+    }
+    while (pos >= 0) {
+      lp2 = code_point_record(ctx, s32[pos]).sentence_break;
+      if (lp2 != SentenceBreak::Close) {
+        break;
+      }
+      pos = previous_sentence_break_property_position(ctx, s32, pos);
+    }
+  }
+
+  auto rp2 = SentenceBreak::Unassigned;
+  {
+    size_t pos = i;
+    while (pos < l) {
+      rp2 = code_point_record(ctx, s32[pos]).sentence_break;
+      if (ParaSep(rp2) || SATerm(rp2) || rp2 == SentenceBreak::OLetter ||
+          rp2 == SentenceBreak::Upper || rp2 == SentenceBreak::Lower) {
+        break;
+      }
+      pos = next_sentence_break_property_position(ctx, s32, l, pos);
+    }
+  }
+
+  // SB8: ATerm Close* Sp* × (¬(OLetter | Upper | Lower | ParaSep | SATerm))*
+  // Lower
+  if ((lp2 == SentenceBreak::ATerm) && (rp2 == SentenceBreak::Lower)) {
+    return false;
+  }
+
+  // SB8a: SATerm Close* Sp* × (SContinue | SATerm)
+  if ((SATerm(lp2)) && (rp == SentenceBreak::SContinue || SATerm(rp))) {
+    return false;
+  }
+
+  auto lp3 = SentenceBreak::Unassigned;
+  {
+    auto pos = previous_sentence_break_property_position(ctx, s32, i);
+    while (pos >= 0) {
+      lp3 = code_point_record(ctx, s32[pos]).sentence_break;
+      if (lp3 != SentenceBreak::Close) {
+        break;
+      }
+      pos = previous_sentence_break_property_position(ctx, s32, pos);
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Break after sentence terminators, but include closing punctuation,
+  // trailing spaces, and any paragraph separator.
+  //---------------------------------------------------------------------------
+
+  // SB9: SATerm Close* × (Close | Sp | ParaSep)
+  if ((SATerm(lp3)) &&
+      (rp == SentenceBreak::Close || rp == SentenceBreak::Sp || ParaSep(rp))) {
+    return false;
+  }
+
+  // SB10: SATerm Close* Sp* × (Sp | ParaSep)
+  if ((SATerm(lp2)) && (rp == SentenceBreak::Sp || ParaSep(rp))) {
+    return false;
+  }
+
+  // SB11: SATerm Close* Sp* ParaSep? ÷
+  // NOTE: 'ParaSep?' has been handled in SB4.
+  if (SATerm(lp2)) {
+    return true;
+  }
+
+  //---------------------------------------------------------------------------
+  // Otherwise, do not break.
+  //---------------------------------------------------------------------------
+
+  // SB998: Any × Any
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+bool is_graphic_character(char32_t cp) {
+  return is_graphic_character(_tables, cp);
+}
+
+bool is_base_character(char32_t cp) { return is_base_character(_tables, cp); }
+
+bool is_combining_character(char32_t cp) {
+  return is_combining_character(_tables, cp);
+}
+
+size_t combining_character_sequence_length(const char32_t *s32, size_t l) {
+  return combining_character_sequence_length(_tables, s32, l);
+}
+
+size_t extended_combining_character_sequence_length(const char32_t *s32,
+                                                    size_t l) {
+  return extended_combining_character_sequence_length(_tables, s32, l);
+}
+
+size_t combining_character_sequence_count(const char32_t *s32, size_t l) {
+  return combining_character_sequence_count(_tables, s32, l);
+}
+
+size_t extended_combining_character_sequence_count(const char32_t *s32,
+                                                   size_t l) {
+  return extended_combining_character_sequence_count(_tables, s32, l);
+}
+
+GraphemeBreak grapheme_break(char32_t cp) {
+  return grapheme_break(_tables, cp);
+}
+
+void grapheme_breaks(const char32_t *s32, size_t l, GraphemeBreak *out) {
+  grapheme_breaks(_tables, s32, l, out);
+}
+
+bool is_grapheme_boundary(const char32_t *s32, size_t l, size_t i) {
+  return is_grapheme_boundary(_tables, s32, l, i);
+}
+
+size_t grapheme_length(const char32_t *s32, size_t l) {
+  return grapheme_length(_tables, s32, l);
+}
+
+size_t grapheme_count(const char32_t *s32, size_t l) {
+  return grapheme_count(_tables, s32, l);
+}
+
+WordBreak word_break(char32_t cp) { return word_break(_tables, cp); }
+
+void word_breaks(const char32_t *s32, size_t l, WordBreak *out) {
+  word_breaks(_tables, s32, l, out);
+}
+
+bool is_word_boundary(const char32_t *s32, size_t l, size_t i) {
+  return is_word_boundary(_tables, s32, l, i);
+}
+
+SentenceBreak sentence_break(char32_t cp) {
+  return sentence_break(_tables, cp);
+}
+
+void sentence_breaks(const char32_t *s32, size_t l, SentenceBreak *out) {
+  sentence_breaks(_tables, s32, l, out);
+}
+
+bool is_sentence_boundary(const char32_t *s32, size_t l, size_t i) {
+  return is_sentence_boundary(_tables, s32, l, i);
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
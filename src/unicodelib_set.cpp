@@ -0,0 +1,290 @@
+#include "unicodelib.h"
+
+#include <algorithm>
+#include <utility>
+#include "unicodelib_data.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// Code Point Set
+//-----------------------------------------------------------------------------
+
+// Merges two inversion lists, keeping the code points for which 'op' of their
+// membership in 'a' and in 'b' is true.
+template <typename Op>
+static std::vector<char32_t> merge_inversion_lists(
+    const std::vector<char32_t> &a, const std::vector<char32_t> &b, Op op) {
+  const char32_t end = 0x110001;
+  std::vector<char32_t> list;
+  size_t i = 0;
+  size_t j = 0;
+  bool in_a = false;
+  bool in_b = false;
+  bool in = false;
+  while (i < a.size() || j < b.size()) {
+    auto cp = std::min(i < a.size() ? a[i] : end, j < b.size() ? b[j] : end);
+    if (i < a.size() && a[i] == cp) {
+      in_a = !in_a;
+      i++;
+    }
+    if (j < b.size() && b[j] == cp) {
+      in_b = !in_b;
+      j++;
+    }
+    if (op(in_a, in_b) != in) {
+      list.push_back(cp);
+      in = !in;
+    }
+  }
+  return list;
+}
+
+// Sets the bits from 'first' to 'last', exclusive, of a bitmap block.
+static void fill_bits(uint64_t *words, size_t first, size_t last) {
+  while (first < last) {
+    auto shift = first % 64;
+    auto count = std::min<size_t>(64 - shift, last - first);
+    auto mask = count == 64 ? ~uint64_t(0) : ((uint64_t(1) << count) - 1);
+    words[first / 64] |= mask << shift;
+    first += count;
+  }
+}
+
+// Turns a list of half-open ranges into an inversion list: an odd trailing
+// value runs to the end of the code space, ranges are clipped to 0x110000,
+// and empty, unsorted or overlapping ranges are dropped, sorted and merged.
+static std::vector<char32_t> normalize_inversion_list(
+    std::vector<char32_t> list) {
+  const char32_t end = 0x110000;
+  if (list.size() % 2) {
+    list.push_back(end);
+  }
+
+  bool valid = true;
+  for (size_t i = 0; i < list.size(); i++) {
+    if (list[i] > end || (i > 0 && list[i] <= list[i - 1])) {
+      valid = false;
+      break;
+    }
+  }
+  if (valid) {
+    return list;
+  }
+
+  std::vector<std::pair<char32_t, char32_t>> ranges;
+  for (size_t i = 0; i < list.size(); i += 2) {
+    auto first = std::min(list[i], end);
+    auto last = std::min(list[i + 1], end);
+    if (first < last) {
+      ranges.emplace_back(first, last);
+    }
+  }
+  std::sort(ranges.begin(), ranges.end());
+
+  list.clear();
+  for (const auto &range : ranges) {
+    if (!list.empty() && range.first <= list.back()) {
+      list.back() = std::max(list.back(), range.second);
+    } else {
+      list.push_back(range.first);
+      list.push_back(range.second);
+    }
+  }
+  return list;
+}
+
+CodePointSet::CodePointSet() { build_index(); }
+
+CodePointSet::CodePointSet(char32_t first, char32_t last) {
+  if (first <= last && last <= 0x10FFFF) {
+    list_ = {first, last + 1};
+  } else if (first <= last && first <= 0x10FFFF) {
+    list_ = {first, 0x110000};
+  }
+  build_index();
+}
+
+CodePointSet::CodePointSet(std::vector<char32_t> inversion_list)
+    : list_(normalize_inversion_list(std::move(inversion_list))) {
+  build_index();
+}
+
+void CodePointSet::build_index() {
+  const size_t block_size = 1 << BlockShift;
+
+  index_.assign(0x110000 >> BlockShift, 0);
+  bits_.assign(BlockWordCount, 0);
+  bits_.resize(BlockWordCount * 2, ~uint64_t(0));
+
+  for (size_t i = 0; i < list_.size(); i += 2) {
+    size_t cp = list_[i];
+    size_t end = list_[i + 1];
+    while (cp < end) {
+      auto block = cp >> BlockShift;
+      auto block_start = block << BlockShift;
+      auto block_end = block_start + block_size;
+      if (cp == block_start && end >= block_end) {
+        index_[block] = 1;
+        cp = block_end;
+        continue;
+      }
+      if (index_[block] == 0) {
+        index_[block] = static_cast<uint16_t>(bits_.size() / BlockWordCount);
+        bits_.resize(bits_.size() + BlockWordCount, 0);
+      }
+      auto last = std::min(end, block_end);
+      fill_bits(&bits_[index_[block] * BlockWordCount], cp - block_start,
+                last - block_start);
+      cp = last;
+    }
+  }
+}
+
+size_t CodePointSet::size() const {
+  size_t count = 0;
+  for (size_t i = 0; i < list_.size(); i += 2) {
+    count += list_[i + 1] - list_[i];
+  }
+  return count;
+}
+
+CodePointSet &CodePointSet::operator|=(const CodePointSet &rhs) {
+  list_ = merge_inversion_lists(list_, rhs.list_,
+                                [](bool a, bool b) { return a || b; });
+  build_index();
+  return *this;
+}
+
+CodePointSet &CodePointSet::operator&=(const CodePointSet &rhs) {
+  list_ = merge_inversion_lists(list_, rhs.list_,
+                                [](bool a, bool b) { return a && b; });
+  build_index();
+  return *this;
+}
+
+CodePointSet &CodePointSet::operator-=(const CodePointSet &rhs) {
+  list_ = merge_inversion_lists(list_, rhs.list_,
+                                [](bool a, bool b) { return a && !b; });
+  build_index();
+  return *this;
+}
+
+// The sets are read from the range indexes when the data has them, and
+// otherwise from a scan of the tries.
+static CodePointSet general_category_mask_set(DataContext ctx, uint64_t mask) {
+  if (ctx->general_category_ranges) {
+    return CodePointSet(range_inversion_list(
+        *ctx->general_category_ranges,
+        [&](size_t value) { return ((mask >> value) & 1) != 0; }));
+  }
+  return CodePointSet(trie_inversion_list(
+      ctx->general_category_properties, [&](GeneralCategory gc) {
+        return ((mask >> static_cast<int>(gc)) & 1) != 0;
+      }));
+}
+
+CodePointSet general_category_set(DataContext ctx, GeneralCategory gc) {
+  return general_category_mask_set(ctx, uint64_t(1) << static_cast<int>(gc));
+}
+
+CodePointSet property_set(DataContext ctx, uint64_t properties) {
+  if (ctx->property_ranges) {
+    return CodePointSet(range_inversion_list(
+        *ctx->property_ranges,
+        [&](size_t bit) { return ((properties >> bit) & 1) != 0; }));
+  }
+  return CodePointSet(
+      trie_inversion_list(ctx->properties, [&](uint64_t value) {
+        return (value & properties) != 0;
+      }));
+}
+
+CodePointSet derived_property_set(DataContext ctx, uint32_t properties) {
+  if (ctx->derived_core_property_ranges) {
+    return CodePointSet(range_inversion_list(
+        *ctx->derived_core_property_ranges,
+        [&](size_t bit) { return ((properties >> bit) & 1) != 0; }));
+  }
+  return CodePointSet(
+      trie_inversion_list(ctx->derived_core_properties, [&](uint32_t value) {
+        return (value & properties) != 0;
+      }));
+}
+
+// A break property value of the code point records.
+template <typename T>
+static CodePointSet record_set(DataContext ctx, const PropertyRanges *index,
+                               T CodePointRecord::*field, uint64_t value) {
+  if (index) {
+    return CodePointSet(range_inversion_list(
+        *index, [&](size_t v) { return v == value; }));
+  }
+  return CodePointSet(
+      trie_inversion_list(ctx->code_point_record_ids, [&](uint8_t id) {
+        return static_cast<uint64_t>(ctx->code_point_records[id].*field) ==
+               value;
+      }));
+}
+
+CodePointSet property_value_set(DataContext ctx, const PropertyValue &pv) {
+  CodePointSet set;
+  switch (pv.type) {
+  case PropertyType::General_Category:
+    set = general_category_mask_set(ctx, pv.value);
+    break;
+  case PropertyType::Script:
+#if !defined(UNICODELIB_NO_SCRIPTS)
+    set = script_set(ctx, static_cast<Script>(pv.value));
+#endif
+    break;
+  case PropertyType::Block:
+#if !defined(UNICODELIB_NO_SCRIPTS)
+    set = block_set(ctx, static_cast<Block>(pv.value));
+#endif
+    break;
+  case PropertyType::Grapheme_Cluster_Break:
+    set = record_set(ctx, ctx->grapheme_break_ranges,
+                     &CodePointRecord::grapheme_break, pv.value);
+    break;
+  case PropertyType::Word_Break:
+    set = record_set(ctx, ctx->word_break_ranges,
+                     &CodePointRecord::word_break, pv.value);
+    break;
+  case PropertyType::Sentence_Break:
+    set = record_set(ctx, ctx->sentence_break_ranges,
+                     &CodePointRecord::sentence_break, pv.value);
+    break;
+  case PropertyType::Property:
+    set = property_set(ctx, pv.value);
+    break;
+  case PropertyType::Derived_Property:
+    set = derived_property_set(ctx, static_cast<uint32_t>(pv.value));
+    break;
+  }
+  return pv.negated ? ~set : set;
+}
+
+//-----------------------------------------------------------------------------
+// Default Data Context
+//-----------------------------------------------------------------------------
+
+CodePointSet general_category_set(GeneralCategory gc) {
+  return general_category_set(_tables, gc);
+}
+
+CodePointSet property_set(uint64_t properties) {
+  return property_set(_tables, properties);
+}
+
+CodePointSet derived_property_set(uint32_t properties) {
+  return derived_property_set(_tables, properties);
+}
+
+CodePointSet property_value_set(const PropertyValue &pv) {
+  return property_value_set(_tables, pv);
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
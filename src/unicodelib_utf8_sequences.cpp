@@ -0,0 +1,94 @@
+#include "unicodelib.h"
+
+#include <utility>
+#include "unicodelib_encodings.h"
+
+namespace unicode {
+
+//-----------------------------------------------------------------------------
+// UTF-8 Byte Sequences
+//-----------------------------------------------------------------------------
+
+// Splits a range until the encodings of its first and last code points have
+// the same length and differ only in bytes whose ranges are full, so that the
+// byte ranges between them match exactly the range, as utf8-ranges and RE2
+// do. The pieces are emitted in increasing order.
+static void push_utf8_sequences(char32_t first, char32_t last,
+                                std::vector<Utf8Sequence> &out) {
+  static const char32_t length_limits[] = {0x7F, 0x7FF, 0xFFFF};
+
+  std::vector<std::pair<char32_t, char32_t>> stack{{first, last}};
+  while (!stack.empty()) {
+    auto s = stack.back().first;
+    auto e = stack.back().second;
+    stack.pop_back();
+
+    for (;;) {
+      // Surrogates have no encoding.
+      if (s <= 0xDFFF && e >= 0xD800) {
+        if (e > 0xDFFF) {
+          stack.emplace_back(0xE000, e);
+        }
+        if (s >= 0xD800) {
+          break;
+        }
+        e = 0xD7FF;
+      }
+
+      auto split = false;
+      for (auto limit : length_limits) {
+        if (s <= limit && limit < e) {
+          stack.emplace_back(limit + 1, e);
+          e = limit;
+          split = true;
+          break;
+        }
+      }
+
+      // Continuation bytes below the first differing byte must cover all of
+      // 0x80..0xBF.
+      for (size_t i = 1; i < 4 && !split; i++) {
+        char32_t mask = (char32_t(1) << (6 * i)) - 1;
+        if ((s & ~mask) != (e & ~mask)) {
+          if ((s & mask) != 0) {
+            stack.emplace_back((s | mask) + 1, e);
+            e = s | mask;
+            split = true;
+          } else if ((e & mask) != mask) {
+            stack.emplace_back(e & ~mask, e);
+            e = (e & ~mask) - 1;
+            split = true;
+          }
+        }
+      }
+      if (split) {
+        continue;
+      }
+
+      char first_bytes[4];
+      char last_bytes[4];
+      Utf8Sequence seq;
+      seq.length = utf8::encode_codepoint(s, first_bytes);
+      utf8::encode_codepoint(e, last_bytes);
+      for (size_t i = 0; i < seq.length; i++) {
+        seq.ranges[i] = {static_cast<uint8_t>(first_bytes[i]),
+                         static_cast<uint8_t>(last_bytes[i])};
+      }
+      out.push_back(seq);
+      break;
+    }
+  }
+}
+
+std::vector<Utf8Sequence> utf8_sequences(const CodePointSet &set) {
+  std::vector<Utf8Sequence> sequences;
+  const auto &list = set.inversion_list();
+  for (size_t i = 0; i < list.size(); i += 2) {
+    push_utf8_sequences(list[i], list[i + 1] - 1, sequences);
+  }
+  return sequences;
+}
+
+}  // namespace unicode
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
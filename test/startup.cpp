@@ -0,0 +1,37 @@
+#include <unicodelib.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Every table is constant-initialized, so linking the library must not
+// allocate anything before 'main' runs.
+
+static size_t allocation_count = 0;
+
+void *operator new(size_t size) {
+  allocation_count++;
+  if (auto p = malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+int main() {
+  auto allocations = allocation_count;
+
+  // Touch the case and normalization tables so that they are linked in.
+  auto ok = unicode::to_uppercase(U"straße") == U"STRASSE" &&
+            unicode::to_case_fold(U"İ") == U"i̇" &&
+            unicode::to_nfc(U"é") == U"é" &&
+            unicode::is_script(unicode::Script::Latin, U'a');
+
+  printf("allocations before main: %zu\n", allocations);
+  return allocations == 0 && ok ? 0 : 1;
+}
+
+// vim: et ts=2 sw=2 cin cino=\:0 ff=unix
@@ -3,7 +3,11 @@
 
 #include <unicodelib.h>
 #include <unicodelib_encodings.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 using namespace unicode;
@@ -55,14 +59,157 @@ TEST_CASE("General category predicate functions", "[general category]") {
   REQUIRE(is_other(0x0378) == true);  // Unassigned
 }
 
+TEST_CASE("Compile-time predicates", "[general category]") {
+  static_assert(general_category_mask(GeneralCategory::Lu) == 1, "");
+  static_assert((GeneralCategoryMask_Letter & GeneralCategoryMask_Number) == 0,
+                "");
+
+  REQUIRE(in_category<GeneralCategory::Nd>(U'5'));
+  REQUIRE(!in_category<GeneralCategory::Nd>(U'¼'));
+  REQUIRE((in_category<GeneralCategory::Lu, GeneralCategory::Lt>(0x01C5)));
+  REQUIRE(!(in_category<GeneralCategory::Lu, GeneralCategory::Lt>(U'a')));
+  REQUIRE(in_category<GeneralCategory::Cn>(0x0378));
+  REQUIRE(has_property<Property_White_Space>(0x3000));
+  REQUIRE(has_property<Property_Dash | Property_Hyphen>(U'-'));
+  REQUIRE(!has_property<Property_White_Space>(U'a'));
+  REQUIRE(has_derived_property<DerivedProperty_XID_Continue>(U'_'));
+  REQUIRE(!has_derived_property<DerivedProperty_XID_Start>(U'_'));
+
+  auto ctx = default_data_context();
+  REQUIRE(in_category<GeneralCategory::Lo>(ctx, U'あ'));
+  REQUIRE(has_property<Property_Ideographic>(ctx, 0x4E00));
+  REQUIRE(has_derived_property<DerivedProperty_Alphabetic>(ctx, 0x4E00));
+
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    REQUIRE(in_category<GeneralCategory::Pd>(cp) ==
+            (general_category(cp) == GeneralCategory::Pd));
+    REQUIRE(has_derived_property<DerivedProperty_XID_Continue>(cp) ==
+            is_xid_continue(cp));
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Property
 //-----------------------------------------------------------------------------
 
+TEST_CASE("Property mask", "[property]") {
+  REQUIRE((property_mask(U' ') & Property_White_Space) != 0);
+  REQUIRE(property_mask(U'+') == Property_Pattern_Syntax);
+  REQUIRE(property_mask(U'a') ==
+          (Property_Hex_Digit | Property_ASCII_Hex_Digit));
+  REQUIRE(property_mask(U'g') == 0);
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    auto mask = property_mask(cp);
+    REQUIRE(((mask & Property_White_Space) != 0) == is_white_space(cp));
+    REQUIRE(((mask & Property_Pattern_Syntax) != 0) == is_pattern_syntax(cp));
+    REQUIRE(((mask & Property_Prepended_Concatenation_Mark) != 0) ==
+            is_prepended_concatenation_mark(cp));
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Derived Property
 //-----------------------------------------------------------------------------
 
+TEST_CASE("Derived property mask", "[derived property]") {
+  REQUIRE(derived_property_mask(U'_') ==
+          (DerivedProperty_ID_Continue | DerivedProperty_XID_Continue |
+           DerivedProperty_Grapheme_Base));
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    auto mask = derived_property_mask(cp);
+    REQUIRE(((mask & DerivedProperty_XID_Continue) != 0) ==
+            is_xid_continue(cp));
+    REQUIRE(((mask & DerivedProperty_Default_Ignorable_Code_Point) != 0) ==
+            is_default_ignorable_code_point(cp));
+    REQUIRE(((mask & DerivedProperty_Grapheme_Link) != 0) ==
+            is_grapheme_link(cp));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Other Property
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Combining class", "[other property]") {
+  REQUIRE(combining_class(U'a') == 0);
+  REQUIRE(combining_class(0x0301) == 230);
+  REQUIRE(combining_class(0x0327) == 202);
+  REQUIRE(combining_class(0x05B0) == 10);
+  REQUIRE(combining_class(0x1D165) == 216);
+
+  u32string text;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    text += cp;
+  }
+  vector<uint8_t> classes(text.size());
+  combining_classes(text.data(), text.size(), classes.data());
+  auto ctx = default_data_context();
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    REQUIRE(classes[cp] == combining_class(cp));
+    REQUIRE(classes[cp] == combining_class(ctx, cp));
+  }
+}
+
+TEST_CASE("Hangul syllable type", "[other property]") {
+  REQUIRE(hangul_syllable_type(U'a') == HangulSyllableType::NA);
+  REQUIRE(hangul_syllable_type(0x1100) == HangulSyllableType::L);
+  REQUIRE(hangul_syllable_type(0xA960) == HangulSyllableType::L);
+  REQUIRE(hangul_syllable_type(0x1161) == HangulSyllableType::V);
+  REQUIRE(hangul_syllable_type(0xD7B0) == HangulSyllableType::V);
+  REQUIRE(hangul_syllable_type(0x11A8) == HangulSyllableType::T);
+  REQUIRE(hangul_syllable_type(0xAC00) == HangulSyllableType::LV);
+  REQUIRE(hangul_syllable_type(0xAC01) == HangulSyllableType::LVT);
+  REQUIRE(hangul_syllable_type(0xD7A3) == HangulSyllableType::LVT);
+  REQUIRE(hangul_syllable_type(0xD7A4) == HangulSyllableType::NA);
+
+  const char32_t s32[] = U"a\u1100\u1161\u11A8\uAC00\uAC01abcdefgh\uD7A3";
+  const size_t l = sizeof(s32) / sizeof(s32[0]) - 1;
+  HangulSyllableType types[l];
+  hangul_syllable_types(s32, l, types);
+  for (size_t i = 0; i < l; i++) {
+    REQUIRE(types[i] == hangul_syllable_type(s32[i]));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Emoji
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Emoji", "[emoji]") {
+  REQUIRE(emoji_property_mask(U'a') == 0);
+  REQUIRE(emoji_property_mask(U'#') ==
+          (EmojiProperty_Emoji | EmojiProperty_Emoji_Component));
+  REQUIRE(emoji_property_mask(0x00A9) ==
+          (EmojiProperty_Emoji | EmojiProperty_Extended_Pictographic));
+  REQUIRE(emoji_property_mask(0x1F44D) ==
+          (EmojiProperty_Emoji | EmojiProperty_Emoji_Presentation |
+           EmojiProperty_Emoji_Modifier_Base |
+           EmojiProperty_Extended_Pictographic));
+
+  REQUIRE(is_emoji(0x1F600));
+  REQUIRE(is_emoji_presentation(0x1F600));
+  REQUIRE(!is_emoji_presentation(0x263A));
+  REQUIRE(is_emoji_modifier(0x1F3FB));
+  REQUIRE(is_emoji_component(0x1F3FB));
+  REQUIRE(is_emoji_modifier_base(0x1F44D));
+  REQUIRE(is_emoji_component(0x200D));
+  REQUIRE(!is_emoji(0x200D));
+  REQUIRE(is_extended_pictographic(0x1FFFD));
+  REQUIRE(!is_emoji(0x1FFFD));
+
+  u32string text;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    text += cp;
+  }
+  vector<uint8_t> masks(text.size());
+  emoji_property_masks(text.data(), text.size(), masks.data());
+  auto ctx = default_data_context();
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    REQUIRE(masks[cp] == emoji_property_mask(cp));
+    REQUIRE(is_emoji_presentation(cp) == is_emoji_presentation(ctx, cp));
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Case
 //-----------------------------------------------------------------------------
@@ -121,6 +268,11 @@ TEST_CASE("Simple case mapping", "[case]") {
   REQUIRE(simple_titlecase_mapping(U'Ǳ') == U'ǲ');
   REQUIRE(simple_titlecase_mapping(U'ǲ') == U'ǲ');
   REQUIRE(simple_titlecase_mapping(U'ǳ') == U'ǲ');
+
+  // The largest deltas
+  REQUIRE(simple_uppercase_mapping(0x0265) == 0xA78D);
+  REQUIRE(simple_lowercase_mapping(0xA78D) == 0x0265);
+  REQUIRE(simple_titlecase_mapping(0x0265) == 0xA78D);
 }
 
 TEST_CASE("Simple case folding", "[case]") {
@@ -133,6 +285,11 @@ TEST_CASE("Simple case folding", "[case]") {
   REQUIRE(simple_case_folding(U'Ǳ') == U'ǳ');
   REQUIRE(simple_case_folding(U'ǲ') == U'ǳ');
   REQUIRE(simple_case_folding(U'ǳ') == U'ǳ');
+  REQUIRE(simple_case_folding(0x1E9E) == U'ß');
+  REQUIRE(simple_case_folding(0x13F8) == 0x13F0);
+  // Only full or Turkic foldings
+  REQUIRE(simple_case_folding(U'ß') == U'ß');
+  REQUIRE(simple_case_folding(0x0130) == 0x0130);
 }
 
 TEST_CASE("Full case mapping", "[case]") {
@@ -150,12 +307,162 @@ TEST_CASE("Full case mapping", "[case]") {
   // German
   REQUIRE(to_uppercase(U"Maße") == U"MASSE");
 
+  // Turkish and Lithuanian
+  REQUIRE(to_lowercase(U"I", "tr") == U"ı");
+  REQUIRE(to_lowercase(U"I\u0307", "tr") == U"i");
+  REQUIRE(to_lowercase(U"\u00CC", "lt") == U"i\u0307\u0300");
+  REQUIRE(to_uppercase(U"i\u0307", "lt") == U"I");
+  REQUIRE(to_uppercase(U"i\u0307") == U"I\u0307");
+
   // Title case
   REQUIRE(to_titlecase(U"hello WORLD. A, a.") == U"Hello World. A, A.");
   REQUIRE(to_titlecase(U"ΧΑΟΣ χαος Σ σ") == U"Χαος Χαος Σ Σ");
   REQUIRE(to_titlecase(U"Ǳabc ǳabc ǲabc") == U"ǲabc ǲabc ǲabc");
 }
 
+TEST_CASE("Full case mapping of ASCII runs", "[case]") {
+  // Long enough for the ASCII blocks of the fast path.
+  const u32string lower_run = U"the quick brown fox jumps over the lazy dog ";
+  const u32string upper_run = U"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ";
+
+  REQUIRE(to_uppercase(lower_run + U"ma\u00DFe " + lower_run) ==
+          upper_run + U"MASSE " + upper_run);
+  REQUIRE(to_lowercase(upper_run + U"\u03A7\u0391\u039F\u03A3 " +
+                       upper_run) ==
+          lower_run + U"\u03C7\u03B1\u03BF\u03C2 " + lower_run);
+  REQUIRE(to_case_fold(upper_run + U"\u1E9E") == lower_run + U"ss");
+
+  // Languages with SpecialCasing rows for ASCII letters
+  REQUIRE(to_uppercase(u32string(32, U'i'), "tr") == u32string(32, 0x0130));
+  REQUIRE(to_lowercase(u32string(32, U'I'), "tr") == u32string(32, 0x0131));
+  REQUIRE(to_lowercase(upper_run + U"I\u0300", "lt") ==
+          lower_run + U"i\u0307\u0300");
+  REQUIRE(to_case_fold(u32string(32, U'I'), true) == u32string(32, 0x0131));
+
+  // A code point between ASCII runs maps as it does alone, with the runs
+  // mapped around it. All the code points that change are below U+20000.
+  const u32string a(20, U'a'), A(20, U'A');
+  for (char32_t cp = 0; cp < 0x20000; cp++) {
+    u32string c(1, cp);
+    REQUIRE(to_uppercase(a + c + a) == A + to_uppercase(c) + A);
+    REQUIRE(to_lowercase(A + c + A) == a + to_lowercase(c) + a);
+    REQUIRE(to_case_fold(A + c + A) == a + to_case_fold(c) + a);
+  }
+}
+
+TEST_CASE("Full case mapping to caller's output", "[case]") {
+  const u32string text = U"The quick brown fox jumps over the lazy dog "
+                         U"ma\u00DFe \u03A7\u0391\u039F\u03A3";
+
+  // Appends to what is in 'out'
+  u32string out = U">";
+  to_uppercase(text, out);
+  to_lowercase(text, out);
+  REQUIRE(out == U">" + to_uppercase(text) + to_lowercase(text));
+  out.clear();
+  to_case_fold(text, out);
+  REQUIRE(out == to_case_fold(text));
+
+  // A buffer that is too small gets the size to call again with.
+  u32string upper = to_uppercase(text);
+  vector<char32_t> buff(text.size());
+  auto l = to_uppercase(text.data(), text.size(), buff.data(), buff.size());
+  REQUIRE(l == upper.size());
+  REQUIRE(l > buff.size());
+  REQUIRE(u32string(buff.data(), buff.size()) == upper.substr(0, buff.size()));
+  buff.resize(l);
+  REQUIRE(to_uppercase(text.data(), text.size(), buff.data(), buff.size()) ==
+          l);
+  REQUIRE(u32string(buff.data(), l) == upper);
+
+  REQUIRE(to_titlecase(text.data(), text.size(), nullptr, 0, "lt") ==
+          to_titlecase(text, "lt").size());
+  REQUIRE(to_case_fold(U"\u0130", 1, nullptr, 0) == 2);
+  REQUIRE(to_case_fold(U"\u0130", 1, nullptr, 0, true) == 1);
+}
+
+TEST_CASE("Full case mapping of UTF-8", "[case]") {
+  auto upper = [](const string &s8, const char *lang = nullptr) {
+    return utf8::encode(to_uppercase(utf8::decode(s8), lang));
+  };
+  auto lower = [](const string &s8, const char *lang = nullptr) {
+    return utf8::encode(to_lowercase(utf8::decode(s8), lang));
+  };
+  auto title = [](const string &s8, const char *lang = nullptr) {
+    return utf8::encode(to_titlecase(utf8::decode(s8), lang));
+  };
+  auto fold = [](const string &s8, bool special = false) {
+    return utf8::encode(to_case_fold(utf8::decode(s8), special));
+  };
+
+  // The context rules read the UTF-8 text around the code point.
+  const string greek = u8"ΧΑΟΣ Σ̀Σ xΣ";
+  REQUIRE(to_lowercase(greek) == lower(greek));
+  REQUIRE(to_lowercase(string(u8"ΧΑΟΣ")) == u8"χαος");
+  REQUIRE(to_uppercase(string("Ma\xC3\x9F" "e")) == "MASSE");
+  REQUIRE(to_lowercase(string(u8"İ I"), "tr") == u8"i ı");
+  REQUIRE(to_lowercase(string(u8"Ì J́"), "lt") == lower(u8"Ì J́", "lt"));
+  REQUIRE(to_uppercase(string(u8"i̇ j́̇"), "lt") == upper(u8"i̇ j́̇", "lt"));
+  REQUIRE(to_titlecase(string(u8"hello WORLD. ǳabc σΣ")) ==
+          u8"Hello World. ǲabc Σς");
+  REQUIRE(to_titlecase(string(u8"istanbul IRMAK"), "tr") ==
+          title(u8"istanbul IRMAK", "tr"));
+  REQUIRE(to_case_fold(string(u8"Straße İI"), true) ==
+          fold(u8"Straße İI", true));
+
+  // ASCII runs of any length and alignment around other code points
+  const string text = "The quick brown fox jumps over the lazy dog";
+  for (size_t i = 0; i <= text.size(); i++) {
+    auto s8 = text.substr(0, i) + u8"éẞ" + text.substr(i);
+    REQUIRE(to_uppercase(s8) == upper(s8));
+    REQUIRE(to_lowercase(s8) == lower(s8));
+    REQUIRE(to_case_fold(s8) == fold(s8));
+    REQUIRE(to_uppercase(s8, "tr") == upper(s8, "tr"));
+    REQUIRE(to_case_fold(s8, true) == fold(s8, true));
+  }
+
+  // Bytes that don't start a UTF-8 sequence are copied as they are.
+  REQUIRE(to_uppercase(string("a\x80" "b\xFF" "c")) == "A\x80" "B\xFF" "C");
+  REQUIRE(to_lowercase(string("\xBF\xCE\xA3")) == "\xBF\xCF\x83");
+  REQUIRE(to_titlecase(string("\x80" "ab\x80" "cd")) == "\x80" "Ab\x80" "Cd");
+  REQUIRE(to_case_fold(string("A\xF8")) == "a\xF8");
+
+  // So is each byte of an ill-formed sequence, and the bytes after it are
+  // read again: truncated, bad continuation, overlong, surrogate and past
+  // U+10FFFF.
+  REQUIRE(to_lowercase(string("\xC3" "A")) == "\xC3" "a");
+  REQUIRE(to_lowercase(string("A\xE2\x82")) == "a\xE2\x82");
+  REQUIRE(to_lowercase(string("\xCE" "A\xCE\xA3")) == "\xCE" "a\xCF\x82");
+  REQUIRE(to_uppercase(string("\xC1\xA1" "a")) == "\xC1\xA1" "A");
+  REQUIRE(to_uppercase(string("\xE0\x81\xA1" "a")) == "\xE0\x81\xA1" "A");
+  REQUIRE(to_uppercase(string("\xF0\x80\x81\xA1")) == "\xF0\x80\x81\xA1");
+  REQUIRE(to_case_fold(string("\xED\xA0\x80" "A")) == "\xED\xA0\x80" "a");
+  REQUIRE(to_lowercase(string("\xF4\x90\x80\x80" "A")) ==
+          "\xF4\x90\x80\x80" "a");
+  REQUIRE(to_lowercase(string("\xF7\xBF\xBF\xBF" "x")) ==
+          "\xF7\xBF\xBF\xBF" "x");
+  REQUIRE(to_titlecase(string("\xC3" "abc \xCE\x41")) == "\xC3" "Abc \xCE" "A");
+  REQUIRE(to_lowercase(string("A\xFF\xCE\xA3")) == "a\xFF\xCF\x83");
+
+  // Appends to what is in 'out'
+  string out = ">";
+  to_uppercase(text, out);
+  to_titlecase(text, out);
+  REQUIRE(out == ">" + upper(text) + title(text));
+
+  // Each code point between ASCII runs maps as its UTF-32 mapping encoded.
+  const string a(20, 'a'), A(20, 'A');
+  for (char32_t cp = 0x80; cp < 0x20000; cp++) {
+    if (cp >= 0xD800 && cp < 0xE000) {
+      continue;
+    }
+    auto c = utf8::encode_codepoint(cp);
+    REQUIRE(to_uppercase(a + c + a) == upper(a + c + a));
+    REQUIRE(to_lowercase(A + c + A) == lower(A + c + A));
+    REQUIRE(to_case_fold(A + c + A) == fold(A + c + A));
+  }
+}
+
 TEST_CASE("Full case folding", "[case]") {
   REQUIRE(to_case_fold(U"heiss") == to_case_fold(U"heiß"));
 }
@@ -236,6 +543,10 @@ TEST_CASE("Combining character sequence", "[segmentation]") {
           4);
   REQUIRE(extended_combining_character_sequence_count(korean.data(),
                                                       korean.length()) == 2);
+
+  std::u32string korean_and_latin = U"\u1111\u1171\u11B6\u0061";
+  REQUIRE(extended_combining_character_sequence_count(
+              korean_and_latin.data(), korean_and_latin.length()) == 2);
 }
 
 template <typename T>
@@ -337,6 +648,452 @@ TEST_CASE("Script", "[script]") {
 TEST_CASE("Script extension", "[script]") {
   REQUIRE(is_script(Script::Hiragana, U'ー'));
   REQUIRE(is_script(Script::Katakana, U'ー'));
+  REQUIRE(is_script(Script::Latin, U'ー') == false);
+  REQUIRE(is_script(Script::Common, U'ー') == false);
+  REQUIRE(is_script(Script::Common, U' '));
+  REQUIRE(is_script(Script::Latin, U'a'));
+  REQUIRE(is_script(Script::Syriac, 0x0640));
+  REQUIRE(is_script(Script::Arabic, 0x0640));
+
+  // A character of a specific script matches its extensions too.
+  REQUIRE(script(0x0660) == Script::Arabic);
+  REQUIRE(is_script(Script::Arabic, 0x0660));
+  REQUIRE(is_script(Script::Thaana, 0x0660));
+  REQUIRE(is_script(Script::Yezidi, 0x0660));
+  REQUIRE(is_script(Script::Syriac, 0x0660) == false);
+}
+
+TEST_CASE("Script extension set", "[script]") {
+  auto kana = script_extensions(U'ー');
+  REQUIRE(kana.contains(Script::Hiragana));
+  REQUIRE(kana.contains(Script::Katakana));
+  REQUIRE(kana.contains(Script::Common) == false);
+
+  auto latin = script_extensions(U'a');
+  REQUIRE(latin.contains(Script::Latin));
+  REQUIRE(latin.contains(Script::Common) == false);
+
+  REQUIRE((kana & script_extensions(U'カ')) == script_extensions(U'カ'));
+  REQUIRE((kana & latin).empty());
+  REQUIRE((kana | latin).contains(Script::Latin));
+
+  ScriptSet set = {};
+  REQUIRE(set.empty());
+  set.insert(Script::Yezidi);
+  REQUIRE(set.contains(Script::Yezidi));
+  REQUIRE(set != latin);
+}
+
+//-----------------------------------------------------------------------------
+// Batch Lookup
+//-----------------------------------------------------------------------------
+
+template <typename T, typename Batch, typename Single>
+void check_batch(const vector<char32_t> &cps, Batch batch, Single single) {
+  vector<T> actual(cps.size());
+  batch(cps.data(), cps.size(), actual.data());
+  vector<T> expected;
+  for (auto cp : cps) {
+    expected.push_back(single(cp));
+  }
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("Batch lookup", "[batch]") {
+  REQUIRE(grapheme_break(U'\r') == GraphemeBreak::CR);
+  REQUIRE(word_break(U'a') == WordBreak::ALetter);
+  REQUIRE(sentence_break(U'.') == SentenceBreak::ATerm);
+
+  vector<char32_t> cps;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    cps.push_back(cp);
+  }
+  // Every code point in order, then text that switches between ASCII and
+  // other scripts.
+  for (auto cp : U"Hello, 世界! Ça va? 👍🏽 αβγ") {
+    cps.push_back(cp);
+  }
+
+  check_batch<GeneralCategory>(
+      cps, [](const char32_t *s32, size_t l, GeneralCategory *out) {
+        general_categories(s32, l, out);
+      },
+      [](char32_t cp) { return general_category(cp); });
+  check_batch<uint64_t>(
+      cps, [](const char32_t *s32, size_t l, uint64_t *out) {
+        property_masks(s32, l, out);
+      },
+      [](char32_t cp) { return property_mask(cp); });
+  check_batch<uint32_t>(
+      cps, [](const char32_t *s32, size_t l, uint32_t *out) {
+        derived_property_masks(s32, l, out);
+      },
+      [](char32_t cp) { return derived_property_mask(cp); });
+  check_batch<Block>(
+      cps, [](const char32_t *s32, size_t l, Block *out) {
+        blocks(s32, l, out);
+      },
+      [](char32_t cp) { return block(cp); });
+  check_batch<Script>(
+      cps, [](const char32_t *s32, size_t l, Script *out) {
+        scripts(s32, l, out);
+      },
+      [](char32_t cp) { return script(cp); });
+  check_batch<GraphemeBreak>(
+      cps, [](const char32_t *s32, size_t l, GraphemeBreak *out) {
+        grapheme_breaks(s32, l, out);
+      },
+      [](char32_t cp) { return grapheme_break(cp); });
+  check_batch<WordBreak>(
+      cps, [](const char32_t *s32, size_t l, WordBreak *out) {
+        word_breaks(s32, l, out);
+      },
+      [](char32_t cp) { return word_break(cp); });
+  check_batch<SentenceBreak>(
+      cps, [](const char32_t *s32, size_t l, SentenceBreak *out) {
+        sentence_breaks(s32, l, out);
+      },
+      [](char32_t cp) { return sentence_break(cp); });
+}
+
+//-----------------------------------------------------------------------------
+// Code Point Set
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Code point set", "[code point set]") {
+  CodePointSet empty;
+  REQUIRE(empty.empty());
+  REQUIRE(empty.contains(0) == false);
+  REQUIRE(~empty == CodePointSet(0, 0x10FFFF));
+  REQUIRE((~empty).contains(0x10FFFF));
+  REQUIRE((~empty).contains(0x110000) == false);
+
+  CodePointSet digits(U'0', U'9');
+  REQUIRE(digits.size() == 10);
+  REQUIRE(digits.contains(U'0'));
+  REQUIRE(digits.contains(U'9'));
+  REQUIRE(digits.contains(U'/') == false);
+  REQUIRE(digits.contains(U':') == false);
+
+  auto hex = digits | CodePointSet(U'A', U'F') | CodePointSet(U'a', U'f');
+  REQUIRE(hex.inversion_list() ==
+          vector<char32_t>({U'0', U':', U'A', U'G', U'a', U'g'}));
+  REQUIRE(hex == property_set(Property_ASCII_Hex_Digit));
+  REQUIRE((hex & digits) == digits);
+  REQUIRE((hex - digits).size() == 12);
+  REQUIRE((hex - hex).empty());
+  REQUIRE(~~hex == hex);
+  REQUIRE((~hex).size() == 0x110000 - 22);
+  REQUIRE((CodePointSet(U'0', U'5') | CodePointSet(U'6', U'9')) == digits);
+
+  auto lu = general_category_set(GeneralCategory::Lu);
+  REQUIRE(lu.contains(U'A'));
+  REQUIRE(lu.contains(U'a') == false);
+  REQUIRE(block_set(Block::Hiragana).contains(U'あ'));
+  REQUIRE(script_set(Script::Greek).contains(U'α'));
+
+  auto id = (derived_property_set(DerivedProperty_XID_Continue) -
+             script_set(Script::Han)) |
+            CodePointSet(U'-', U'-');
+  auto ws = property_set(Property_White_Space | Property_Pattern_White_Space);
+  size_t mismatches = 0;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    auto expected =
+        (is_xid_continue(cp) && script(cp) != Script::Han) || cp == U'-';
+    mismatches += id.contains(cp) != expected;
+    mismatches +=
+        lu.contains(cp) != (general_category(cp) == GeneralCategory::Lu);
+    mismatches +=
+        ws.contains(cp) != (is_white_space(cp) || is_pattern_white_space(cp));
+  }
+  REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("Code point set from an invalid list", "[code point set]") {
+  using list = vector<char32_t>;
+  CodePointSet digits(U'0', U'9');
+  REQUIRE(CodePointSet(list{U'5', U':', U'0', U'5'}) == digits);
+  REQUIRE(CodePointSet(list{U'0', U'8', U'3', U':'}) == digits);
+  REQUIRE(CodePointSet(list{U'0', U':', U'0', U':'}) == digits);
+  REQUIRE(CodePointSet(list{U':', U'0', U'0', U':'}) == digits);
+  REQUIRE(CodePointSet(list{U'0', U'0', U'0', U':'}) == digits);
+  REQUIRE(CodePointSet(list{U'0'}) == CodePointSet(U'0', 0x10FFFF));
+  REQUIRE(CodePointSet(list{0x10FFFF, 0xFFFFFFFF}) ==
+          CodePointSet(0x10FFFF, 0x10FFFF));
+  REQUIRE(CodePointSet(list{0x110000, 0x120000}).empty());
+  REQUIRE(CodePointSet(list{0xFFFFFFFF}).empty());
+
+  REQUIRE(CodePointSet(U'9', U'0').empty());
+  REQUIRE(CodePointSet(0x110000, 0x110000).empty());
+  REQUIRE(CodePointSet(0x10FFFF, 0xFFFFFFFF).size() == 1);
+  REQUIRE(CodePointSet(0, 0xFFFFFFFF) == CodePointSet(0, 0x10FFFF));
+}
+
+//-----------------------------------------------------------------------------
+// Property Ranges
+//-----------------------------------------------------------------------------
+
+static CodePointSet range_set(CodePointRangeList ranges) {
+  vector<char32_t> list;
+  for (const auto &r : ranges) {
+    list.push_back(r.first);
+    list.push_back(r.last + 1);
+  }
+  return CodePointSet(list);
+}
+
+template <typename T, typename Fn>
+static CodePointSet scanned_set(T value, Fn fn) {
+  vector<char32_t> list;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    if ((fn(cp) == value) != (list.size() % 2 == 1)) {
+      list.push_back(cp);
+    }
+  }
+  if (list.size() % 2 == 1) {
+    list.push_back(0x110000);
+  }
+  return CodePointSet(list);
+}
+
+TEST_CASE("Property ranges", "[property ranges]") {
+  auto greek = code_point_ranges(Script::Greek);
+  REQUIRE(greek.begin()->first == 0x0370);
+  REQUIRE(greek.begin()->last == 0x0373);
+
+  vector<CodePointRange> digits;
+  for_each_range(GeneralCategory::Nd, [&](char32_t first, char32_t last) {
+    digits.push_back({first, last});
+  });
+  REQUIRE(digits.size() == code_point_ranges(GeneralCategory::Nd).count);
+  REQUIRE(digits[0].first == U'0');
+  REQUIRE(digits[0].last == U'9');
+
+  REQUIRE(property_ranges(0).empty());
+  REQUIRE(property_ranges(Property_Dash | Property_Hyphen).empty());
+  REQUIRE(derived_property_ranges(0).empty());
+
+  size_t spaces = 0;
+  for_each_property_range(Property_White_Space,
+                          [&](char32_t first, char32_t last) {
+                            spaces += last - first + 1;
+                          });
+  REQUIRE(spaces == property_set(Property_White_Space).size());
+  size_t math = 0;
+  for_each_derived_property_range(DerivedProperty_Math,
+                                  [&](char32_t first, char32_t last) {
+                                    math += last - first + 1;
+                                  });
+  REQUIRE(math == derived_property_set(DerivedProperty_Math).size());
+
+  for (int i = 0; i <= static_cast<int>(GeneralCategory::Cn); i++) {
+    auto gc = static_cast<GeneralCategory>(i);
+    REQUIRE(range_set(code_point_ranges(gc)) == general_category_set(gc));
+  }
+  for (int i = 0; i <= static_cast<int>(Script::Yezidi); i++) {
+    auto sc = static_cast<Script>(i);
+    REQUIRE(range_set(code_point_ranges(sc)) == script_set(sc));
+  }
+  for (int i = 0; i <= static_cast<int>(Block::SupplementaryPrivateUseAreaB);
+       i++) {
+    auto blk = static_cast<Block>(i);
+    REQUIRE(range_set(code_point_ranges(blk)) == block_set(blk));
+  }
+  for (int i = 0; i < 64; i++) {
+    auto property = uint64_t(1) << i;
+    REQUIRE(range_set(property_ranges(property)) == property_set(property));
+  }
+  for (int i = 0; i < 32; i++) {
+    auto property = uint32_t(1) << i;
+    REQUIRE(range_set(derived_property_ranges(property)) ==
+            derived_property_set(property));
+  }
+
+  REQUIRE(range_set(code_point_ranges(GraphemeBreak::Extend)) ==
+          scanned_set(GraphemeBreak::Extend,
+                      [](char32_t cp) { return grapheme_break(cp); }));
+  REQUIRE(range_set(code_point_ranges(WordBreak::ALetter)) ==
+          scanned_set(WordBreak::ALetter,
+                      [](char32_t cp) { return word_break(cp); }));
+  REQUIRE(range_set(code_point_ranges(SentenceBreak::Upper)) ==
+          scanned_set(SentenceBreak::Upper,
+                      [](char32_t cp) { return sentence_break(cp); }));
+}
+
+TEST_CASE("Code point sets from the range index", "[property ranges]") {
+  REQUIRE(property_set(Property_Dash | Property_Hyphen) ==
+          scanned_set(true, [](char32_t cp) {
+            return (property_mask(cp) &
+                    (Property_Dash | Property_Hyphen)) != 0;
+          }));
+  REQUIRE(derived_property_set(DerivedProperty_Math |
+                               DerivedProperty_Alphabetic) ==
+          scanned_set(true, [](char32_t cp) {
+            return is_math(cp) || is_alphabetic(cp);
+          }));
+  REQUIRE(script_set(Script::Greek) ==
+          scanned_set(Script::Greek, [](char32_t cp) { return script(cp); }));
+  REQUIRE(block_set(Block::CJKUnifiedIdeographsExtensionB) ==
+          scanned_set(Block::CJKUnifiedIdeographsExtensionB,
+                      [](char32_t cp) { return block(cp); }));
+
+  PropertyValue pv;
+  REQUIRE(resolve_property("gc=P", pv));
+  REQUIRE(property_value_set(pv) ==
+          scanned_set(true, [](char32_t cp) { return is_punctuation(cp); }));
+  REQUIRE(resolve_property("WB=ALetter", pv));
+  REQUIRE(property_value_set(pv) ==
+          scanned_set(WordBreak::ALetter,
+                      [](char32_t cp) { return word_break(cp); }));
+}
+
+//-----------------------------------------------------------------------------
+// UTF-8 Byte Sequences
+//-----------------------------------------------------------------------------
+
+static size_t utf8_sequence_matches(const vector<Utf8Sequence> &sequences,
+                                    const string &s8) {
+  size_t count = 0;
+  for (const auto &seq : sequences) {
+    auto matches = seq.length == s8.size();
+    for (size_t i = 0; matches && i < seq.length; i++) {
+      auto byte = static_cast<uint8_t>(s8[i]);
+      matches = seq.ranges[i].first <= byte && byte <= seq.ranges[i].last;
+    }
+    count += matches;
+  }
+  return count;
+}
+
+TEST_CASE("UTF-8 byte sequences", "[utf8 sequences]") {
+  REQUIRE(utf8_sequences(CodePointSet()).empty());
+
+  auto ascii = utf8_sequences(CodePointSet(0, 0x7F));
+  REQUIRE(ascii.size() == 1);
+  REQUIRE(ascii[0].length == 1);
+  REQUIRE(ascii[0].ranges[0].first == 0x00);
+  REQUIRE(ascii[0].ranges[0].last == 0x7F);
+
+  // [\u0080-߿] is [\xC2-\xDF][\x80-\xBF].
+  auto two_bytes = utf8_sequences(CodePointSet(0x80, 0x7FF));
+  REQUIRE(two_bytes.size() == 1);
+  REQUIRE(two_bytes[0].length == 2);
+  REQUIRE(two_bytes[0].ranges[0].first == 0xC2);
+  REQUIRE(two_bytes[0].ranges[0].last == 0xDF);
+
+  // 1, 2, 3 (E0, E1-EC, ED, EE-EF) and 4 (F0, F1-F3, F4) byte forms.
+  REQUIRE(utf8_sequences(CodePointSet(0, 0x10FFFF)).size() == 9);
+
+  const CodePointSet sets[] = {
+      script_set(Script::Greek),
+      general_category_set(GeneralCategory::Nd),
+      CodePointSet(0x7F, 0x10000),
+      CodePointSet(0xD000, 0xE0FF) | CodePointSet(0x10FFFE, 0x10FFFF),
+  };
+  for (const auto &set : sets) {
+    auto sequences = utf8_sequences(set);
+    size_t mismatches = 0;
+    for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+      string s8;
+      if (utf8::encode_codepoint(cp, s8) == 0) {
+        continue;
+      }
+      mismatches += utf8_sequence_matches(sequences, s8) != set.contains(cp);
+    }
+    REQUIRE(mismatches == 0);
+  }
+}
+
+TEST_CASE("Property names", "[property names]") {
+  PropertyValue pv;
+
+  REQUIRE(resolve_property("Script=Greek", pv));
+  REQUIRE(pv.type == PropertyType::Script);
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Greek));
+  REQUIRE(!pv.negated);
+  REQUIRE(property_value_set(pv) == script_set(Script::Greek));
+
+  // Loose matching (UAX #44-LM3)
+  REQUIRE(resolve_property(" script = greek ", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Greek));
+  REQUIRE(resolve_property("Greek", pv));
+  REQUIRE(pv.type == PropertyType::Script);
+
+  REQUIRE(resolve_property("gc=Lu", pv));
+  REQUIRE(pv.type == PropertyType::General_Category);
+  REQUIRE(pv.value == 1ull << static_cast<int>(GeneralCategory::Lu));
+
+  REQUIRE(resolve_property("L", pv));
+  REQUIRE(pv.type == PropertyType::General_Category);
+  REQUIRE(property_value_set(pv) ==
+          (general_category_set(GeneralCategory::Lu) |
+           general_category_set(GeneralCategory::Ll) |
+           general_category_set(GeneralCategory::Lt) |
+           general_category_set(GeneralCategory::Lm) |
+           general_category_set(GeneralCategory::Lo)));
+  REQUIRE(resolve_property("General_Category=Letter", pv));
+  REQUIRE(property_value_set(pv).contains(U'a'));
+
+  REQUIRE(resolve_property("Alphabetic", pv));
+  REQUIRE(pv.type == PropertyType::Derived_Property);
+  REQUIRE(pv.value == DerivedProperty_Alphabetic);
+  REQUIRE(resolve_property("isAlphabetic", pv));
+  REQUIRE(pv.value == DerivedProperty_Alphabetic);
+  REQUIRE(resolve_property("White_Space", pv));
+  REQUIRE(pv.type == PropertyType::Property);
+  REQUIRE(pv.value == Property_White_Space);
+
+  REQUIRE(resolve_property("Alphabetic=No", pv));
+  REQUIRE(pv.negated);
+  auto not_alphabetic = property_value_set(pv);
+  REQUIRE(!not_alphabetic.contains(U'a'));
+  REQUIRE(not_alphabetic.contains(U'1'));
+  REQUIRE(!resolve_property("Alphabetic=Maybe", pv));
+
+  REQUIRE(resolve_property("blk=Basic Latin", pv));
+  REQUIRE(pv.type == PropertyType::Block);
+  REQUIRE(property_value_set(pv) == CodePointSet(0, 0x7F));
+
+  REQUIRE(resolve_property("WB=ALetter", pv));
+  REQUIRE(pv.type == PropertyType::Word_Break);
+  REQUIRE(property_value_set(pv).contains(U'a'));
+  REQUIRE(!property_value_set(pv).contains(U'1'));
+
+  // Short names from 'PropertyAliases.txt' and 'PropertyValueAliases.txt'
+  REQUIRE(resolve_property("sc=Grek", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Greek));
+  REQUIRE(resolve_property("Grek", pv));
+  REQUIRE(pv.type == PropertyType::Script);
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Greek));
+  REQUIRE(resolve_property("Hira", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Hiragana));
+  REQUIRE(resolve_property("sc=Zyyy", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(Script::Common));
+  REQUIRE(resolve_property("WSpace", pv));
+  REQUIRE(pv.type == PropertyType::Property);
+  REQUIRE(pv.value == Property_White_Space);
+  REQUIRE(resolve_property("Alpha", pv));
+  REQUIRE(pv.type == PropertyType::Derived_Property);
+  REQUIRE(pv.value == DerivedProperty_Alphabetic);
+  REQUIRE(resolve_property("XIDC", pv));
+  REQUIRE(pv.value == DerivedProperty_XID_Continue);
+  REQUIRE(resolve_property("blk=ASCII", pv));
+  REQUIRE(pv.type == PropertyType::Block);
+  REQUIRE(pv.value == static_cast<uint64_t>(Block::BasicLatin));
+  REQUIRE(resolve_property("gc=L&", pv));
+  REQUIRE(pv.value == GeneralCategoryMask_Cased_Letter);
+  REQUIRE(resolve_property("GCB=EX", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(GraphemeBreak::Extend));
+  REQUIRE(resolve_property("WB=LE", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(WordBreak::ALetter));
+  REQUIRE(resolve_property("SB=LE", pv));
+  REQUIRE(pv.value == static_cast<uint64_t>(SentenceBreak::OLetter));
+
+  REQUIRE(!resolve_property("", pv));
+  REQUIRE(!resolve_property("Klingon", pv));
+  REQUIRE(!resolve_property("Script=Klingon", pv));
+  REQUIRE(!resolve_property("Foo=Greek", pv));
+  REQUIRE(!resolve_property("Script", pv));
 }
 
 //-----------------------------------------------------------------------------
@@ -408,6 +1165,372 @@ TEST_CASE("Normalization", "[normalization]") {
   }
 }
 
+TEST_CASE("Normalization to caller's output", "[normalization]") {
+  // Appends to what is in 'out'
+  u32string out = U"x";
+  to_nfc(U"e\u0301", out);
+  to_nfd(U"\u00E9", out);
+  to_nfkc(U"\uFB01", out);
+  to_nfkd(U"\u1E9B\u0323", out);
+  REQUIRE(out == U"x\u00E9e\u0301fi\u0073\u0323\u0307");
+
+  // The result is exact even when the decomposition doesn't fit.
+  char32_t buff[4] = {};
+  REQUIRE(to_nfc(U"\u00E9", 1, buff, 1) == 1);
+  REQUIRE(buff[0] == 0x00E9);
+  REQUIRE(to_nfc(U"\u00E9", 1, nullptr, 0) == 1);
+  REQUIRE(to_nfc(U"\u00E9", 1, buff, 2) == 1);
+  REQUIRE(buff[0] == 0x00E9);
+  REQUIRE(to_nfc(U"e\u0301e\u0301", 4, buff, 1) == 2);
+  REQUIRE(buff[0] == 0x00E9);
+  REQUIRE(to_nfd(U"q\u0307\u0323", 3, buff, 2) == 3);
+  REQUIRE(u32string(buff, 2) == U"q\u0323");
+  REQUIRE(to_nfd(U"\uAC01", 1, nullptr, 0) == 3);
+  REQUIRE(to_nfd(U"\uAC01", 1, buff, 4) == 3);
+  REQUIRE(u32string(buff, 3) == U"\u1100\u1161\u11A8");
+  REQUIRE(to_nfkd(U"\uFB01", 1, buff, 1) == 2);
+  REQUIRE(to_nfkc(U"\uFB01", 1, buff, 2) == 2);
+  REQUIRE(u32string(buff, 2) == U"fi");
+}
+
+//-----------------------------------------------------------------------------
+// Allocator-aware Output
+//-----------------------------------------------------------------------------
+
+namespace test_allocator {
+
+// A bump allocator over a fixed arena, like a monotonic memory resource.
+struct Arena {
+  char bytes[1 << 16];
+  size_t used = 0;
+};
+
+template <typename T> struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena &arena) : arena(&arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+  T *allocate(size_t n) {
+    auto p = &arena->bytes[arena->used];
+    arena->used += (n * sizeof(T) + 15) & ~size_t(15);
+    if (arena->used > sizeof(arena->bytes)) {
+      throw std::bad_alloc();
+    }
+    return reinterpret_cast<T *>(p);
+  }
+  void deallocate(T *, size_t) {}
+
+  Arena *arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena != b.arena;
+}
+
+template <typename Char>
+using arena_string =
+    basic_string<Char, char_traits<Char>, ArenaAllocator<Char>>;
+
+TEST_CASE("Output with an allocator", "[allocator]") {
+  Arena arena;
+  ArenaAllocator<char32_t> alloc(arena);
+
+  // Longer than the input, so that the output grows while it is written.
+  const u32string text = U"Stra\u00DFe \u00DF\u00DF\u00DF "
+                         U"\u03A3\u0391\u03A3 \uAC01\u1E9B\u0323";
+  arena_string<char32_t> out(alloc);
+  to_uppercase(text.data(), text.size(), out);
+  REQUIRE(u32string(out.data(), out.size()) == to_uppercase(text));
+  to_lowercase(text.data(), text.size(), out, "tr");
+  REQUIRE(u32string(out.data(), out.size()) ==
+          to_uppercase(text) + to_lowercase(text, "tr"));
+
+  out.clear();
+  to_titlecase(text.data(), text.size(), out);
+  to_case_fold(text.data(), text.size(), out, true);
+  REQUIRE(u32string(out.data(), out.size()) ==
+          to_titlecase(text) + to_case_fold(text, true));
+
+  out.clear();
+  to_nfd(text.data(), text.size(), out);
+  REQUIRE(u32string(out.data(), out.size()) == to_nfd(text));
+  out.clear();
+  to_nfkc(default_data_context(), text.data(), text.size(), out);
+  REQUIRE(u32string(out.data(), out.size()) == to_nfkc(text));
+
+  // Composed in place after what is already in 'out'
+  u32string accented;
+  for (int i = 0; i < 100; i++) {
+    accented += U"e\u0301A\u030A\u1E9B\u0323 ";
+  }
+  out.assign(U">");
+  to_nfc(accented.data(), accented.size(), out);
+  REQUIRE(u32string(out.data(), out.size()) == U">" + to_nfc(accented));
+
+  REQUIRE(canonical_caseless_match(U"\u00C5", 1, U"a\u030A", 2, alloc));
+  REQUIRE(!canonical_caseless_match(U"\u00C5", 1, U"b", 1, alloc));
+  REQUIRE(compatibility_caseless_match(U"\uFB01", 1, U"FI", 2, alloc));
+
+  arena_string<char> s8{ArenaAllocator<char>(arena)};
+  utf8::encode(text.data(), text.size(), s8);
+  REQUIRE(string(s8.data(), s8.size()) == utf8::encode(text));
+  arena_string<char16_t> s16{ArenaAllocator<char16_t>(arena)};
+  to_utf16(s8.data(), s8.size(), s16);
+  REQUIRE(u16string(s16.data(), s16.size()) == utf16::encode(text));
+  arena_string<char32_t> s32(alloc);
+  utf16::decode(s16.data(), s16.size(), s32);
+  REQUIRE(u32string(s32.data(), s32.size()) == text);
+
+  REQUIRE(arena.used > 0);
+}
+
+} // namespace test_allocator
+
+//-----------------------------------------------------------------------------
+// Data File
+//-----------------------------------------------------------------------------
+
+#ifdef UNICODELIB_DATA_FILE
+
+namespace test_data_file {
+
+struct Snapshot {
+  std::vector<uint64_t> values;
+  std::u32string nfd, nfkc, upper, lower_tr, title_lt, fold;
+};
+
+Snapshot take_snapshot() {
+  std::u32string text;
+  Snapshot s;
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    uint64_t v = static_cast<uint64_t>(general_category(cp));
+    v = v * 2 + is_white_space(cp);
+    v = v * 2 + is_soft_dotted(cp);
+    v = v * 2 + is_alphabetic(cp);
+    v = v * 2 + is_changes_when_casefolded(cp);
+    v = v * 0x400 + static_cast<uint64_t>(block(cp));
+    v = v * 0x100 + static_cast<uint64_t>(script(cp));
+    s.values.push_back(v);
+    s.values.push_back(simple_uppercase_mapping(cp));
+    s.values.push_back(simple_lowercase_mapping(cp));
+    s.values.push_back(simple_titlecase_mapping(cp));
+    s.values.push_back(simple_case_folding(cp));
+    auto scx = script_extensions(cp);
+    s.values.insert(s.values.end(), scx.words,
+                    scx.words + ScriptSet::WordCount);
+    if (cp < 0xD800 || cp > 0xDFFF) {
+      text += cp;
+    }
+  }
+  s.nfd = to_nfd(text);
+  s.nfkc = to_nfkc(text);
+  s.upper = to_uppercase(text);
+  s.lower_tr = to_lowercase(text, "tr");
+  s.title_lt = to_titlecase(text, "lt");
+  s.fold = to_case_fold(text);
+  s.values.push_back(grapheme_count(text));
+  return s;
+}
+
+TEST_CASE("Data file", "[data file]") {
+  REQUIRE(std::string(unicode_version()) == "13.0.0");
+  auto builtin = take_snapshot();
+
+  REQUIRE(load_data_file(UNICODELIB_DATA_FILE));
+  REQUIRE(std::string(unicode_version()) == "13.0.0");
+  auto mapped = take_snapshot();
+  use_builtin_data();
+
+  REQUIRE(mapped.values == builtin.values);
+  REQUIRE(mapped.nfd == builtin.nfd);
+  REQUIRE(mapped.nfkc == builtin.nfkc);
+  REQUIRE(mapped.upper == builtin.upper);
+  REQUIRE(mapped.lower_tr == builtin.lower_tr);
+  REQUIRE(mapped.title_lt == builtin.title_lt);
+  REQUIRE(mapped.fold == builtin.fold);
+}
+
+TEST_CASE("Data context", "[data file]") {
+  auto builtin = builtin_data_context();
+  auto mapped = load_data_context(UNICODELIB_DATA_FILE);
+  REQUIRE(mapped);
+  REQUIRE(mapped != builtin);
+  REQUIRE(default_data_context() == builtin);
+  REQUIRE(std::string(unicode_version(mapped)) == "13.0.0");
+
+  for (char32_t cp = 0; cp <= 0x10FFFF; cp++) {
+    REQUIRE(general_category(mapped, cp) == general_category(cp));
+    REQUIRE(is_alphabetic(mapped, cp) == is_alphabetic(cp));
+    REQUIRE(simple_case_folding(mapped, cp) == simple_case_folding(cp));
+    REQUIRE(script_extensions(mapped, cp) == script_extensions(cp));
+    REQUIRE(emoji_property_mask(mapped, cp) == emoji_property_mask(cp));
+  }
+  REQUIRE(to_uppercase(mapped, U"straße") == U"STRASSE");
+  REQUIRE(to_lowercase(mapped, U"I\u0307", "tr") == U"i");
+  REQUIRE(to_nfc(mapped, U"\u1100\u1161\u11A8") == U"\uAC01");
+  REQUIRE(compatibility_caseless_match(mapped, U"\uFB03", U"FFI"));
+  REQUIRE(grapheme_count(mapped, U"g\u0308o") == 2);
+  REQUIRE(code_point_ranges(mapped, Script::Greek).count ==
+          code_point_ranges(Script::Greek).count);
+  REQUIRE(code_point_ranges(mapped, WordBreak::ALetter).count ==
+          code_point_ranges(WordBreak::ALetter).count);
+  REQUIRE(property_ranges(mapped, Property_White_Space).count ==
+          property_ranges(Property_White_Space).count);
+  REQUIRE(derived_property_ranges(mapped, DerivedProperty_Alphabetic).count ==
+          derived_property_ranges(DerivedProperty_Alphabetic).count);
+  REQUIRE(default_data_context() == builtin);
+
+  set_default_data_context(mapped);
+  REQUIRE(default_data_context() == mapped);
+  REQUIRE(to_uppercase(U"straße") == U"STRASSE");
+  set_default_data_context(builtin);
+}
+
+// The inline functions answer U+0000..U+00FF from records built for the
+// default context.
+static void check_latin1_fast_path(DataContext ctx) {
+  for (char32_t cp = 0; cp < 0x100; cp++) {
+    REQUIRE(general_category(cp) == general_category(ctx, cp));
+    REQUIRE(is_punctuation(cp) == is_punctuation(ctx, cp));
+    REQUIRE(property_mask(cp) == property_mask(ctx, cp));
+    REQUIRE(is_white_space(cp) == is_white_space(ctx, cp));
+    REQUIRE(derived_property_mask(cp) == derived_property_mask(ctx, cp));
+    REQUIRE(is_xid_continue(cp) == is_xid_continue(ctx, cp));
+    REQUIRE(simple_uppercase_mapping(cp) == simple_uppercase_mapping(ctx, cp));
+    REQUIRE(simple_lowercase_mapping(cp) == simple_lowercase_mapping(ctx, cp));
+    REQUIRE(simple_titlecase_mapping(cp) == simple_titlecase_mapping(ctx, cp));
+    REQUIRE(simple_case_folding(cp) == simple_case_folding(ctx, cp));
+  }
+}
+
+TEST_CASE("Latin-1 fast path", "[data file]") {
+  check_latin1_fast_path(builtin_data_context());
+
+  auto mapped = load_data_context(UNICODELIB_DATA_FILE);
+  REQUIRE(mapped);
+  set_default_data_context(mapped);
+  check_latin1_fast_path(mapped);
+  use_builtin_data();
+}
+
+// The elements of a section of the data file in 'data', as laid out by
+// 'write_data_file' in 'scripts/gen_tables.py'.
+template <typename T>
+static T *find_section(std::string &data, const char *name, size_t &count,
+                       uint32_t *element_size = nullptr) {
+  const size_t header_size = 40;
+  const size_t section_size = 64;
+  uint32_t section_count;
+  memcpy(&section_count, &data[32], sizeof(section_count));
+  for (uint32_t i = 0; i < section_count; i++) {
+    auto section = &data[header_size + i * section_size];
+    if (!strncmp(section, name, 48)) {
+      uint32_t n, offset;
+      memcpy(&n, section + 52, sizeof(n));
+      memcpy(&offset, section + 56, sizeof(offset));
+      count = n;
+      if (element_size) {
+        memcpy(element_size, section + 48, sizeof(*element_size));
+      }
+      return reinterpret_cast<T *>(&data[offset]);
+    }
+  }
+  return nullptr;
+}
+
+static void set_section_count(std::string &data, const char *name,
+                              uint32_t count) {
+  uint32_t section_count;
+  memcpy(&section_count, &data[32], sizeof(section_count));
+  for (uint32_t i = 0; i < section_count; i++) {
+    auto section = &data[40 + i * 64];
+    if (!strncmp(section, name, 48)) {
+      memcpy(section + 52, &count, sizeof(count));
+    }
+  }
+}
+
+template <typename Patch>
+static DataContext load_patched_data_file(Patch patch) {
+  ifstream in(UNICODELIB_DATA_FILE, ios::binary);
+  std::string data((istreambuf_iterator<char>(in)),
+                   istreambuf_iterator<char>());
+  patch(data);
+  const char *path = "patched.dat";
+  ofstream(path, ios::binary).write(data.data(), data.size());
+  return load_data_context(path);
+}
+
+TEST_CASE("Invalid data file", "[data file]") {
+  REQUIRE(load_data_context("no-such-file.dat") == nullptr);
+  REQUIRE_FALSE(load_data_file("no-such-file.dat"));
+  REQUIRE_FALSE(load_data_file("../test.cpp"));
+  REQUIRE(to_uppercase(U"straße") == U"STRASSE");
+
+  REQUIRE(load_patched_data_file([](std::string &) {}) != nullptr);
+
+  // Enum values out of range
+  REQUIRE(load_patched_data_file([](std::string &data) {
+            size_t count = 0;
+            auto gc = find_section<GeneralCategory>(
+                data, "_general_category_properties_stage3", count);
+            REQUIRE(gc);
+            gc[count - 1] = static_cast<GeneralCategory>(32);
+          }) == nullptr);
+  REQUIRE(load_patched_data_file([](std::string &data) {
+            size_t count = 0;
+            auto sc = find_section<Script>(data, "_script_properties_stage3",
+                                           count);
+            REQUIRE(sc);
+            sc[0] = static_cast<Script>(1000);
+          }) == nullptr);
+
+  // Special casing rows: only the terminator, a zero code point before it,
+  // and a row that its code point's id doesn't lead to.
+  REQUIRE(load_patched_data_file([](std::string &data) {
+            set_section_count(data, "_special_case_mappings", 1);
+          }) == nullptr);
+  for (char32_t code : {char32_t(0), char32_t(0x10FFFF)}) {
+    REQUIRE(load_patched_data_file([&](std::string &data) {
+              size_t count = 0;
+              uint32_t row_size = 0;
+              auto rows = find_section<char>(data, "_special_case_mappings",
+                                             count, &row_size);
+              REQUIRE(rows);
+              // 'code' is the first field of a row, and row 1 the first row
+              // after the empty one.
+              memcpy(rows + row_size, &code, sizeof(code));
+            }) == nullptr);
+  }
+
+  // U+00C0 decomposes to 'A' U+0300. Making it decompose to itself, or to a
+  // code point past U+10FFFF, is rejected.
+  for (char32_t cp : {char32_t(0xC0), char32_t(0x110000)}) {
+    REQUIRE(load_patched_data_file([&](std::string &data) {
+              size_t count = 0;
+              auto pool =
+                  find_section<char32_t>(data, "_decomposition_pool", count);
+              REQUIRE(pool);
+              auto it = search(pool, pool + count,
+                               std::begin(U"A\u0300"), std::end(U"A\u0300"));
+              REQUIRE(it != pool + count);
+              *it = cp;
+            }) == nullptr);
+  }
+}
+
+} // namespace test_data_file
+
+#endif
+
 //-----------------------------------------------------------------------------
 // UTF8 encoding
 //-----------------------------------------------------------------------------
@@ -490,6 +1613,24 @@ TEST_CASE("decode 3", "[utf8]") {
   REQUIRE(utf8::decode(u8text) == u32text);
 }
 
+TEST_CASE("encode and decode to buffer", "[utf8]") {
+  char buff8[32];
+  REQUIRE(utf8::encode(u32text.data(), u32text.size(), nullptr, 0) ==
+          u8text.size());
+  // Only whole code points are written.
+  auto l = utf8::encode(u32text.data(), u32text.size(), buff8, 4);
+  REQUIRE(l == u8text.size());
+  REQUIRE(std::string(buff8, 3) == u8"日");
+  l = utf8::encode(u32text.data(), u32text.size(), buff8, sizeof(buff8));
+  REQUIRE(std::string(buff8, l) == u8text);
+
+  char32_t buff32[16];
+  REQUIRE(utf8::decode(u8text.data(), u8text.size(), buff32, 2) ==
+          u32text.size());
+  l = utf8::decode(u8text.data(), u8text.size(), buff32, 16);
+  REQUIRE(std::u32string(buff32, l) == u32text);
+}
+
 } // namespace test_utf8
 
 //-----------------------------------------------------------------------------
@@ -591,6 +1732,21 @@ TEST_CASE("Conversion text", "[encodings]") {
   REQUIRE(to_utf16(u8text) == u16text);
   REQUIRE(to_utf8(u16text) == u8text);
 
+  std::string out8 = "<";
+  to_utf8(u16text.data(), u16text.size(), out8);
+  REQUIRE(out8 == "<" + u8text);
+  std::u16string out16 = u"<";
+  to_utf16(u8text.data(), u8text.size(), out16);
+  REQUIRE(out16 == u"<" + u16text);
+
+  char16_t buff16[16];
+  REQUIRE(utf16::encode(U"\U0002000B", 1, buff16, 1) == 2);
+  auto l = utf16::encode(u32text.data(), u32text.size(), buff16, 16);
+  REQUIRE(std::u16string(buff16, l) == u16text);
+  char32_t buff32[16];
+  l = utf16::decode(u16text.data(), u16text.size(), buff32, 16);
+  REQUIRE(std::u32string(buff32, l) == u32text);
+
   REQUIRE(to_wstring(u8text) == wtext);
   REQUIRE(to_wstring(u16text) == wtext);
   REQUIRE(to_wstring(u32text) == wtext);
@@ -8,11 +8,45 @@
 #ifndef _CPPUNICODELIB_UNICODELIB_H_
 #define _CPPUNICODELIB_UNICODELIB_H_
 
+#include <cstdint>
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 namespace unicode {
 
+//-----------------------------------------------------------------------------
+// Data Context
+//-----------------------------------------------------------------------------
+
+// The Unicode data tables the functions read. Every function that reads them
+// has an overload taking a context as the first argument, so tables of
+// different Unicode versions can be used side by side. The other overloads
+// use the default context, which is the compiled-in tables unless changed.
+struct DataTables;
+typedef const DataTables *DataContext;
+
+// The tables compiled into the library.
+DataContext builtin_data_context();
+
+// Memory maps a data file written by
+// `python scripts/gen_tables.py UCD_DIR OUT_DIR DATA_FILE`. Returns nullptr if
+// the file can't be read or fails validation. The context is valid until the
+// process exits.
+DataContext load_data_context(const char *path);
+
+// These switch the default context for every thread, so call them before
+// other threads use the library. 'load_data_file' keeps the current context
+// and returns false when the file can't be loaded.
+DataContext default_data_context();
+void set_default_data_context(DataContext ctx);
+bool load_data_file(const char *path);
+void use_builtin_data();
+
+// The Unicode version of the tables, e.g. "13.0.0".
+const char *unicode_version(DataContext ctx);
+const char *unicode_version();
+
 //-----------------------------------------------------------------------------
 // General Category
 //-----------------------------------------------------------------------------
@@ -81,6 +115,48 @@ enum class GeneralCategory {
 };
 
 GeneralCategory general_category(char32_t cp);
+GeneralCategory general_category(DataContext ctx, char32_t cp);
+
+// Writes the general category of each of the 'l' code points of 's32' to
+// 'out', which must have room for 'l' values. This and the other batch
+// lookups below are a convenience: each code point is still a table lookup,
+// but the whole array costs one call instead of one per code point.
+void general_categories(const char32_t *s32, size_t l, GeneralCategory *out);
+void general_categories(DataContext ctx, const char32_t *s32, size_t l,
+                        GeneralCategory *out);
+
+// The bit of 'gc' in a general category mask, and the masks of the category
+// groups, so that a group test is a shift and a mask. A mask of several
+// categories is e.g. 'general_category_mask(GeneralCategory::Lu,
+// GeneralCategory::Lt)'.
+constexpr uint32_t general_category_mask() { return 0; }
+
+template <typename... Rest>
+constexpr uint32_t general_category_mask(GeneralCategory gc, Rest... rest) {
+  return (1u << static_cast<int>(gc)) | general_category_mask(rest...);
+}
+
+const uint32_t GeneralCategoryMask_Cased_Letter = general_category_mask(
+    GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lt);
+const uint32_t GeneralCategoryMask_Letter = general_category_mask(
+    GeneralCategory::Lu, GeneralCategory::Ll, GeneralCategory::Lt,
+    GeneralCategory::Lm, GeneralCategory::Lo);
+const uint32_t GeneralCategoryMask_Mark = general_category_mask(
+    GeneralCategory::Mn, GeneralCategory::Mc, GeneralCategory::Me);
+const uint32_t GeneralCategoryMask_Number = general_category_mask(
+    GeneralCategory::Nd, GeneralCategory::Nl, GeneralCategory::No);
+const uint32_t GeneralCategoryMask_Punctuation = general_category_mask(
+    GeneralCategory::Pc, GeneralCategory::Pd, GeneralCategory::Ps,
+    GeneralCategory::Pe, GeneralCategory::Pi, GeneralCategory::Pf,
+    GeneralCategory::Po);
+const uint32_t GeneralCategoryMask_Symbol =
+    general_category_mask(GeneralCategory::Sm, GeneralCategory::Sc,
+                          GeneralCategory::Sk, GeneralCategory::So);
+const uint32_t GeneralCategoryMask_Separator = general_category_mask(
+    GeneralCategory::Zs, GeneralCategory::Zl, GeneralCategory::Zp);
+const uint32_t GeneralCategoryMask_Other = general_category_mask(
+    GeneralCategory::Cc, GeneralCategory::Cf, GeneralCategory::Cs,
+    GeneralCategory::Co, GeneralCategory::Cn);
 
 bool is_cased_letter_category(GeneralCategory gc);
 bool is_letter_category(GeneralCategory gc);
@@ -100,10 +176,72 @@ bool is_symbol(char32_t cp);
 bool is_separator(char32_t cp);
 bool is_other(char32_t cp);
 
+bool is_cased_letter(DataContext ctx, char32_t cp);
+bool is_letter(DataContext ctx, char32_t cp);
+bool is_mark(DataContext ctx, char32_t cp);
+bool is_number(DataContext ctx, char32_t cp);
+bool is_punctuation(DataContext ctx, char32_t cp);
+bool is_symbol(DataContext ctx, char32_t cp);
+bool is_separator(DataContext ctx, char32_t cp);
+bool is_other(DataContext ctx, char32_t cp);
+
 //-----------------------------------------------------------------------------
 // Property
 //-----------------------------------------------------------------------------
 
+const uint64_t Property_White_Space = 0b00000000000000000000000000000001;
+const uint64_t Property_Bidi_Control = 0b00000000000000000000000000000010;
+const uint64_t Property_Join_Control = 0b00000000000000000000000000000100;
+const uint64_t Property_Dash = 0b00000000000000000000000000001000;
+const uint64_t Property_Hyphen = 0b00000000000000000000000000010000;
+const uint64_t Property_Quotation_Mark = 0b00000000000000000000000000100000;
+const uint64_t Property_Terminal_Punctuation =
+    0b00000000000000000000000001000000;
+const uint64_t Property_Other_Math = 0b00000000000000000000000010000000;
+const uint64_t Property_Hex_Digit = 0b00000000000000000000000100000000;
+const uint64_t Property_ASCII_Hex_Digit = 0b00000000000000000000001000000000;
+const uint64_t Property_Other_Alphabetic = 0b00000000000000000000010000000000;
+const uint64_t Property_Ideographic = 0b00000000000000000000100000000000;
+const uint64_t Property_Diacritic = 0b00000000000000000001000000000000;
+const uint64_t Property_Extender = 0b00000000000000000010000000000000;
+const uint64_t Property_Other_Lowercase = 0b00000000000000000100000000000000;
+const uint64_t Property_Other_Uppercase = 0b00000000000000001000000000000000;
+const uint64_t Property_Noncharacter_Code_Point =
+    0b00000000000000010000000000000000;
+const uint64_t Property_Other_Grapheme_Extend =
+    0b00000000000000100000000000000000;
+const uint64_t Property_IDS_Binary_Operator =
+    0b00000000000001000000000000000000;
+const uint64_t Property_IDS_Trinary_Operator =
+    0b00000000000010000000000000000000;
+const uint64_t Property_Radical = 0b00000000000100000000000000000000;
+const uint64_t Property_Unified_Ideograph = 0b00000000001000000000000000000000;
+const uint64_t Property_Other_Default_Ignorable_Code_Point =
+    0b00000000010000000000000000000000;
+const uint64_t Property_Deprecated = 0b00000000100000000000000000000000;
+const uint64_t Property_Soft_Dotted = 0b00000001000000000000000000000000;
+const uint64_t Property_Logical_Order_Exception =
+    0b00000010000000000000000000000000;
+const uint64_t Property_Other_ID_Start = 0b00000100000000000000000000000000;
+const uint64_t Property_Other_ID_Continue = 0b00001000000000000000000000000000;
+const uint64_t Property_Sentence_Terminal = 0b00010000000000000000000000000000;
+const uint64_t Property_Variation_Selector = 0b00100000000000000000000000000000;
+const uint64_t Property_Pattern_White_Space =
+    0b01000000000000000000000000000000;
+const uint64_t Property_Pattern_Syntax = 0b10000000000000000000000000000000;
+const uint64_t Property_Prepended_Concatenation_Mark =
+    0b100000000000000000000000000000000;
+
+// All the properties above of a code point, so that one lookup answers any
+// combination of them, e.g.
+// 'property_mask(cp) & (Property_White_Space | Property_Pattern_Syntax)'.
+uint64_t property_mask(char32_t cp);
+uint64_t property_mask(DataContext ctx, char32_t cp);
+
+void property_masks(const char32_t *s32, size_t l, uint64_t *out);
+void property_masks(DataContext ctx, const char32_t *s32, size_t l,
+                    uint64_t *out);
+
 bool is_white_space(char32_t cp);
 bool is_bidi_control(char32_t cp);
 bool is_join_control(char32_t cp);
@@ -138,10 +276,83 @@ bool is_pattern_white_space(char32_t cp);
 bool is_pattern_syntax(char32_t cp);
 bool is_prepended_concatenation_mark(char32_t cp);
 
+bool is_white_space(DataContext ctx, char32_t cp);
+bool is_bidi_control(DataContext ctx, char32_t cp);
+bool is_join_control(DataContext ctx, char32_t cp);
+bool is_dash(DataContext ctx, char32_t cp);
+bool is_hyphen(DataContext ctx, char32_t cp);
+bool is_quotation_mark(DataContext ctx, char32_t cp);
+bool is_terminal_punctuation(DataContext ctx, char32_t cp);
+bool is_other_math(DataContext ctx, char32_t cp);
+bool is_hex_digit(DataContext ctx, char32_t cp);
+bool is_ascii_hex_digit(DataContext ctx, char32_t cp);
+bool is_other_alphabetic(DataContext ctx, char32_t cp);
+bool is_ideographic(DataContext ctx, char32_t cp);
+bool is_diacritic(DataContext ctx, char32_t cp);
+bool is_extender(DataContext ctx, char32_t cp);
+bool is_other_lowercase(DataContext ctx, char32_t cp);
+bool is_other_uppercase(DataContext ctx, char32_t cp);
+bool is_noncharacter_code_point(DataContext ctx, char32_t cp);
+bool is_other_grapheme_extend(DataContext ctx, char32_t cp);
+bool is_ids_binary_operator(DataContext ctx, char32_t cp);
+bool is_ids_trinary_operator(DataContext ctx, char32_t cp);
+bool is_radical(DataContext ctx, char32_t cp);
+bool is_unified_ideograph(DataContext ctx, char32_t cp);
+bool is_other_default_ignorable_code_point(DataContext ctx, char32_t cp);
+bool is_deprecated(DataContext ctx, char32_t cp);
+bool is_soft_dotted(DataContext ctx, char32_t cp);
+bool is_logical_order_exception(DataContext ctx, char32_t cp);
+bool is_other_id_start(DataContext ctx, char32_t cp);
+bool is_other_id_continue(DataContext ctx, char32_t cp);
+bool is_sentence_terminal(DataContext ctx, char32_t cp);
+bool is_variation_selector(DataContext ctx, char32_t cp);
+bool is_pattern_white_space(DataContext ctx, char32_t cp);
+bool is_pattern_syntax(DataContext ctx, char32_t cp);
+bool is_prepended_concatenation_mark(DataContext ctx, char32_t cp);
+
 //-----------------------------------------------------------------------------
 // Derived Property
 //-----------------------------------------------------------------------------
 
+const uint32_t DerivedProperty_Math = 0b00000000000000000000000000000001;
+const uint32_t DerivedProperty_Alphabetic = 0b00000000000000000000000000000010;
+const uint32_t DerivedProperty_Lowercase = 0b00000000000000000000000000000100;
+const uint32_t DerivedProperty_Uppercase = 0b00000000000000000000000000001000;
+const uint32_t DerivedProperty_Cased = 0b00000000000000000000000000010000;
+const uint32_t DerivedProperty_Case_Ignorable =
+    0b00000000000000000000000000100000;
+const uint32_t DerivedProperty_Changes_When_Lowercased =
+    0b00000000000000000000000001000000;
+const uint32_t DerivedProperty_Changes_When_Uppercased =
+    0b00000000000000000000000010000000;
+const uint32_t DerivedProperty_Changes_When_Titlecased =
+    0b00000000000000000000000100000000;
+const uint32_t DerivedProperty_Changes_When_Casefolded =
+    0b00000000000000000000001000000000;
+const uint32_t DerivedProperty_Changes_When_Casemapped =
+    0b00000000000000000000010000000000;
+const uint32_t DerivedProperty_ID_Start = 0b00000000000000000000100000000000;
+const uint32_t DerivedProperty_ID_Continue = 0b00000000000000000001000000000000;
+const uint32_t DerivedProperty_XID_Start = 0b00000000000000000010000000000000;
+const uint32_t DerivedProperty_XID_Continue =
+    0b00000000000000000100000000000000;
+const uint32_t DerivedProperty_Default_Ignorable_Code_Point =
+    0b00000000000000001000000000000000;
+const uint32_t DerivedProperty_Grapheme_Extend =
+    0b00000000000000010000000000000000;
+const uint32_t DerivedProperty_Grapheme_Base =
+    0b00000000000000100000000000000000;
+const uint32_t DerivedProperty_Grapheme_Link =
+    0b00000000000001000000000000000000;
+
+// All the derived properties above of a code point as with 'property_mask'.
+uint32_t derived_property_mask(char32_t cp);
+uint32_t derived_property_mask(DataContext ctx, char32_t cp);
+
+void derived_property_masks(const char32_t *s32, size_t l, uint32_t *out);
+void derived_property_masks(DataContext ctx, const char32_t *s32, size_t l,
+                            uint32_t *out);
+
 bool is_math(char32_t cp);
 bool is_alphabetic(char32_t cp);
 bool is_lowercase(char32_t cp);
@@ -162,6 +373,95 @@ bool is_grapheme_extend(char32_t cp);
 bool is_grapheme_base(char32_t cp);
 bool is_grapheme_link(char32_t cp);
 
+bool is_math(DataContext ctx, char32_t cp);
+bool is_alphabetic(DataContext ctx, char32_t cp);
+bool is_lowercase(DataContext ctx, char32_t cp);
+bool is_uppercase(DataContext ctx, char32_t cp);
+bool is_cased(DataContext ctx, char32_t cp);
+bool is_case_ignorable(DataContext ctx, char32_t cp);
+bool is_changes_when_lowercased(DataContext ctx, char32_t cp);
+bool is_changes_when_uppercased(DataContext ctx, char32_t cp);
+bool is_changes_when_titlecased(DataContext ctx, char32_t cp);
+bool is_changes_when_casefolded(DataContext ctx, char32_t cp);
+bool is_changes_when_casemapped(DataContext ctx, char32_t cp);
+bool is_id_start(DataContext ctx, char32_t cp);
+bool is_id_continue(DataContext ctx, char32_t cp);
+bool is_xid_start(DataContext ctx, char32_t cp);
+bool is_xid_continue(DataContext ctx, char32_t cp);
+bool is_default_ignorable_code_point(DataContext ctx, char32_t cp);
+bool is_grapheme_extend(DataContext ctx, char32_t cp);
+bool is_grapheme_base(DataContext ctx, char32_t cp);
+bool is_grapheme_link(DataContext ctx, char32_t cp);
+
+//-----------------------------------------------------------------------------
+// Other Property
+//-----------------------------------------------------------------------------
+
+// The Canonical_Combining_Class, 0 for starters, e.g. 230 for U+0301.
+uint8_t combining_class(char32_t cp);
+uint8_t combining_class(DataContext ctx, char32_t cp);
+
+void combining_classes(const char32_t *s32, size_t l, uint8_t *out);
+void combining_classes(DataContext ctx, const char32_t *s32, size_t l,
+                       uint8_t *out);
+
+enum class HangulSyllableType {
+  NA,
+  Not_Applicable = NA,
+  L,
+  Leading_Jamo = L,
+  V,
+  Vowel_Jamo = V,
+  T,
+  Trailing_Jamo = T,
+  LV,
+  LV_Syllable = LV,
+  LVT,
+  LVT_Syllable = LVT,
+};
+
+HangulSyllableType hangul_syllable_type(char32_t cp);
+HangulSyllableType hangul_syllable_type(DataContext ctx, char32_t cp);
+
+void hangul_syllable_types(const char32_t *s32, size_t l,
+                           HangulSyllableType *out);
+void hangul_syllable_types(DataContext ctx, const char32_t *s32, size_t l,
+                           HangulSyllableType *out);
+
+//-----------------------------------------------------------------------------
+// Emoji
+//-----------------------------------------------------------------------------
+
+const uint8_t EmojiProperty_Emoji = 0b00000001;
+const uint8_t EmojiProperty_Emoji_Presentation = 0b00000010;
+const uint8_t EmojiProperty_Emoji_Modifier = 0b00000100;
+const uint8_t EmojiProperty_Emoji_Modifier_Base = 0b00001000;
+const uint8_t EmojiProperty_Emoji_Component = 0b00010000;
+const uint8_t EmojiProperty_Extended_Pictographic = 0b00100000;
+
+// All the emoji properties above of a code point, of which it can have
+// several, e.g. U+1F44D has all but 'Emoji_Modifier' and 'Emoji_Component'.
+uint8_t emoji_property_mask(char32_t cp);
+uint8_t emoji_property_mask(DataContext ctx, char32_t cp);
+
+void emoji_property_masks(const char32_t *s32, size_t l, uint8_t *out);
+void emoji_property_masks(DataContext ctx, const char32_t *s32, size_t l,
+                          uint8_t *out);
+
+bool is_emoji(char32_t cp);
+bool is_emoji_presentation(char32_t cp);
+bool is_emoji_modifier(char32_t cp);
+bool is_emoji_modifier_base(char32_t cp);
+bool is_emoji_component(char32_t cp);
+bool is_extended_pictographic(char32_t cp);
+
+bool is_emoji(DataContext ctx, char32_t cp);
+bool is_emoji_presentation(DataContext ctx, char32_t cp);
+bool is_emoji_modifier(DataContext ctx, char32_t cp);
+bool is_emoji_modifier_base(DataContext ctx, char32_t cp);
+bool is_emoji_component(DataContext ctx, char32_t cp);
+bool is_extended_pictographic(DataContext ctx, char32_t cp);
+
 //-----------------------------------------------------------------------------
 // Case
 //-----------------------------------------------------------------------------
@@ -171,6 +471,11 @@ char32_t simple_lowercase_mapping(char32_t cp);
 char32_t simple_titlecase_mapping(char32_t cp);
 char32_t simple_case_folding(char32_t cp);
 
+char32_t simple_uppercase_mapping(DataContext ctx, char32_t cp);
+char32_t simple_lowercase_mapping(DataContext ctx, char32_t cp);
+char32_t simple_titlecase_mapping(DataContext ctx, char32_t cp);
+char32_t simple_case_folding(DataContext ctx, char32_t cp);
+
 std::u32string to_uppercase(const char32_t *s32, size_t l,
                             const char *lang = nullptr);
 std::u32string to_lowercase(const char32_t *s32, size_t l,
@@ -181,23 +486,141 @@ std::u32string to_case_fold(
     const char32_t *s32, size_t l,
     bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
 
+std::u32string to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang = nullptr);
+std::u32string to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang = nullptr);
+std::u32string to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                            const char *lang = nullptr);
+std::u32string to_case_fold(
+    DataContext ctx, const char32_t *s32, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+// These append to 'out', which must not be 's32', so that a string reused
+// across calls stops allocating once it has grown.
+void to_uppercase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang = nullptr);
+void to_lowercase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang = nullptr);
+void to_titlecase(const char32_t *s32, size_t l, std::u32string &out,
+                  const char *lang = nullptr);
+void to_case_fold(
+    const char32_t *s32, size_t l, std::u32string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+void to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang = nullptr);
+void to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang = nullptr);
+void to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                  std::u32string &out, const char *lang = nullptr);
+void to_case_fold(
+    DataContext ctx, const char32_t *s32, size_t l, std::u32string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+// These write as much of the output as fits in 'size' code points of 'buff'
+// and return the length of the whole output. A result above 'size' means the
+// output didn't fit, and is the size to call again with.
+size_t to_uppercase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang = nullptr);
+size_t to_lowercase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang = nullptr);
+size_t to_titlecase(const char32_t *s32, size_t l, char32_t *buff, size_t size,
+                    const char *lang = nullptr);
+size_t to_case_fold(
+    const char32_t *s32, size_t l, char32_t *buff, size_t size,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+size_t to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang = nullptr);
+size_t to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang = nullptr);
+size_t to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                    char32_t *buff, size_t size, const char *lang = nullptr);
+size_t to_case_fold(
+    DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+    size_t size,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+// These map UTF-8 to UTF-8 and copy the bytes of the code points that don't
+// change, so that mostly unchanged text costs little more than a copy. A byte
+// that doesn't start a well-formed UTF-8 sequence is copied as it is, and the
+// bytes after it are read again. The 'out' versions append, and 'out' must not
+// hold 's8'.
+std::string to_uppercase(const char *s8, size_t l, const char *lang = nullptr);
+std::string to_lowercase(const char *s8, size_t l, const char *lang = nullptr);
+std::string to_titlecase(const char *s8, size_t l, const char *lang = nullptr);
+std::string to_case_fold(
+    const char *s8, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+std::string to_uppercase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang = nullptr);
+std::string to_lowercase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang = nullptr);
+std::string to_titlecase(DataContext ctx, const char *s8, size_t l,
+                         const char *lang = nullptr);
+std::string to_case_fold(
+    DataContext ctx, const char *s8, size_t l,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+void to_uppercase(const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_lowercase(const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_titlecase(const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_case_fold(
+    const char *s8, size_t l, std::string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
+void to_uppercase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_lowercase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_titlecase(DataContext ctx, const char *s8, size_t l, std::string &out,
+                  const char *lang = nullptr);
+void to_case_fold(
+    DataContext ctx, const char *s8, size_t l, std::string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
 bool is_uppercase(const char32_t *s32, size_t l);
 bool is_lowercase(const char32_t *s32, size_t l);
 bool is_titlecase(const char32_t *s32, size_t l);
 bool is_case_fold(const char32_t *s32, size_t l);
 
+bool is_uppercase(DataContext ctx, const char32_t *s32, size_t l);
+bool is_lowercase(DataContext ctx, const char32_t *s32, size_t l);
+bool is_titlecase(DataContext ctx, const char32_t *s32, size_t l);
+bool is_case_fold(DataContext ctx, const char32_t *s32, size_t l);
+
 bool caseless_match(
     const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
     bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
 
+bool caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
 bool canonical_caseless_match(
     const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
     bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
 
+bool canonical_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
 bool compatibility_caseless_match(
     const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
     bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
 
+bool compatibility_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false);
+
 //-----------------------------------------------------------------------------
 // Text Segmentation
 //-----------------------------------------------------------------------------
@@ -206,24 +629,132 @@ bool is_graphic_character(char32_t cp);
 bool is_base_character(char32_t cp);
 bool is_combining_character(char32_t cp);
 
+bool is_graphic_character(DataContext ctx, char32_t cp);
+bool is_base_character(DataContext ctx, char32_t cp);
+bool is_combining_character(DataContext ctx, char32_t cp);
+
 size_t combining_character_sequence_length(const char32_t *s32, size_t l);
 size_t combining_character_sequence_count(const char32_t *s32, size_t l);
 
+size_t combining_character_sequence_length(DataContext ctx, const char32_t *s32,
+                                           size_t l);
+size_t combining_character_sequence_count(DataContext ctx, const char32_t *s32,
+                                          size_t l);
+
 size_t extended_combining_character_sequence_length(const char32_t *s32,
                                                     size_t l);
 size_t extended_combining_character_sequence_count(const char32_t *s32,
                                                    size_t l);
 
+size_t extended_combining_character_sequence_length(DataContext ctx,
+                                                    const char32_t *s32,
+                                                    size_t l);
+size_t extended_combining_character_sequence_count(DataContext ctx,
+                                                   const char32_t *s32,
+                                                   size_t l);
+
+// This is generated from 'GraphemeBreakProperty.txt' in Unicode database.
+// `python scripts/gen_property_values.py < UCD/auxiliary/GraphemeBreakProperty.txt`
+enum class GraphemeBreak {
+  Unassigned,
+  Prepend,
+  CR,
+  LF,
+  Control,
+  Extend,
+  Regional_Indicator,
+  SpacingMark,
+  L,
+  V,
+  T,
+  LV,
+  LVT,
+  ZWJ,
+};
+
+// This is generated from 'WordBreakProperty.txt' in Unicode database.
+// `python scripts/gen_property_values.py < UCD/auxiliary/WordBreakProperty.txt`
+enum class WordBreak {
+  Unassigned,
+  Double_Quote,
+  Single_Quote,
+  Hebrew_Letter,
+  CR,
+  LF,
+  Newline,
+  Extend,
+  Regional_Indicator,
+  Format,
+  Katakana,
+  ALetter,
+  MidLetter,
+  MidNum,
+  MidNumLet,
+  Numeric,
+  ExtendNumLet,
+  ZWJ,
+  WSegSpace,
+};
+
+// This is generated from 'SentenceBreakProperty.txt' in Unicode database.
+// `python scripts/gen_property_values.py < UCD/auxiliary/SentenceBreakProperty.txt`
+enum class SentenceBreak {
+  Unassigned,
+  CR,
+  LF,
+  Extend,
+  Sep,
+  Format,
+  Sp,
+  Lower,
+  Upper,
+  OLetter,
+  Numeric,
+  ATerm,
+  STerm,
+  Close,
+  SContinue,
+};
+
+GraphemeBreak grapheme_break(char32_t cp);
+WordBreak word_break(char32_t cp);
+SentenceBreak sentence_break(char32_t cp);
+
+GraphemeBreak grapheme_break(DataContext ctx, char32_t cp);
+WordBreak word_break(DataContext ctx, char32_t cp);
+SentenceBreak sentence_break(DataContext ctx, char32_t cp);
+
+void grapheme_breaks(const char32_t *s32, size_t l, GraphemeBreak *out);
+void word_breaks(const char32_t *s32, size_t l, WordBreak *out);
+void sentence_breaks(const char32_t *s32, size_t l, SentenceBreak *out);
+
+void grapheme_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                     GraphemeBreak *out);
+void word_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                 WordBreak *out);
+void sentence_breaks(DataContext ctx, const char32_t *s32, size_t l,
+                     SentenceBreak *out);
+
 // The following functions support 'extended' grapheme cluster, not 'legacy'
 // graphme cluster.
 bool is_grapheme_boundary(const char32_t *s32, size_t l, size_t i);
 size_t grapheme_length(const char32_t *s32, size_t l);
 size_t grapheme_count(const char32_t *s32, size_t l);
 
+bool is_grapheme_boundary(DataContext ctx, const char32_t *s32, size_t l,
+                          size_t i);
+size_t grapheme_length(DataContext ctx, const char32_t *s32, size_t l);
+size_t grapheme_count(DataContext ctx, const char32_t *s32, size_t l);
+
 bool is_word_boundary(const char32_t *s32, size_t l, size_t i);
 
+bool is_word_boundary(DataContext ctx, const char32_t *s32, size_t l, size_t i);
+
 bool is_sentence_boundary(const char32_t *s32, size_t l, size_t i);
 
+bool is_sentence_boundary(DataContext ctx, const char32_t *s32, size_t l,
+                          size_t i);
+
 //-----------------------------------------------------------------------------
 // Block
 //-----------------------------------------------------------------------------
@@ -544,6 +1075,12 @@ enum class Block {
 
 Block block(char32_t cp);
 
+Block block(DataContext ctx, char32_t cp);
+
+void blocks(const char32_t *s32, size_t l, Block *out);
+
+void blocks(DataContext ctx, const char32_t *s32, size_t l, Block *out);
+
 //-----------------------------------------------------------------------------
 // Script
 //-----------------------------------------------------------------------------
@@ -710,193 +1247,1534 @@ enum class Script {
   Yezidi,
 };
 
+// A set of scripts with one bit per 'Script' value. The scripts shared by a
+// run of text are the intersection of the 'script_extensions' of its
+// characters.
+struct ScriptSet {
+  static const size_t WordCount = 3;
+
+  uint64_t words[WordCount];
+
+  bool contains(Script sc) const {
+    auto i = static_cast<size_t>(sc);
+    return ((words[i / 64] >> (i % 64)) & 1) != 0;
+  }
+
+  void insert(Script sc) {
+    auto i = static_cast<size_t>(sc);
+    words[i / 64] |= uint64_t(1) << (i % 64);
+  }
+
+  bool empty() const {
+    for (size_t i = 0; i < WordCount; i++) {
+      if (words[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ScriptSet &operator&=(const ScriptSet &rhs) {
+    for (size_t i = 0; i < WordCount; i++) {
+      words[i] &= rhs.words[i];
+    }
+    return *this;
+  }
+
+  ScriptSet &operator|=(const ScriptSet &rhs) {
+    for (size_t i = 0; i < WordCount; i++) {
+      words[i] |= rhs.words[i];
+    }
+    return *this;
+  }
+};
+
+inline ScriptSet operator&(ScriptSet lhs, const ScriptSet &rhs) {
+  return lhs &= rhs;
+}
+
+inline ScriptSet operator|(ScriptSet lhs, const ScriptSet &rhs) {
+  return lhs |= rhs;
+}
+
+inline bool operator==(const ScriptSet &lhs, const ScriptSet &rhs) {
+  for (size_t i = 0; i < ScriptSet::WordCount; i++) {
+    if (lhs.words[i] != rhs.words[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool operator!=(const ScriptSet &lhs, const ScriptSet &rhs) {
+  return !(lhs == rhs);
+}
+
 Script script(char32_t cp);
+
+Script script(DataContext ctx, char32_t cp);
+
+void scripts(const char32_t *s32, size_t l, Script *out);
+
+void scripts(DataContext ctx, const char32_t *s32, size_t l, Script *out);
+
+// The Script_Extensions value, or the set of 'script(cp)' alone when the code
+// point has no explicit extensions.
+ScriptSet script_extensions(char32_t cp);
+
+ScriptSet script_extensions(DataContext ctx, char32_t cp);
+
+// True if 'sc' is in 'script_extensions(cp)'.
 bool is_script(Script sc, char32_t cp);
 
+bool is_script(DataContext ctx, Script sc, char32_t cp);
+
 //-----------------------------------------------------------------------------
-// Normalization
+// Code Point Set
 //-----------------------------------------------------------------------------
 
-std::u32string to_nfc(const char32_t *s32, size_t l);
-std::u32string to_nfd(const char32_t *s32, size_t l);
-std::u32string to_nfkc(const char32_t *s32, size_t l);
-std::u32string to_nfkd(const char32_t *s32, size_t l);
+// A set of code points stored as a sorted inversion list, where the set holds
+// [list[0], list[1]), [list[2], list[3]) and so on. A bitmap with one bit per
+// code point, in which blocks of 1024 code points that are all in or all out
+// of the set share storage, answers 'contains' in constant time. The set
+// operations merge the inversion lists, so they cost O(ranges) plus building
+// the bitmap of the result.
+class CodePointSet {
+public:
+  // The empty set.
+  CodePointSet();
+
+  // The code points from 'first' to 'last', inclusive, up to U+10FFFF. The set
+  // is empty if 'first' > 'last'.
+  CodePointSet(char32_t first, char32_t last);
+
+  // 'inversion_list' should be strictly increasing, with values up to 0x110000;
+  // an odd length leaves the last range open to U+10FFFF. Any other list is
+  // read as pairs of half-open ranges, which are clipped to the code space,
+  // sorted and merged.
+  explicit CodePointSet(std::vector<char32_t> inversion_list);
+
+  bool contains(char32_t cp) const {
+    if (cp > 0x10FFFF) {
+      return false;
+    }
+    auto block = index_[cp >> BlockShift];
+    auto word = bits_[block * BlockWordCount + ((cp >> 6) & 0xF)];
+    return ((word >> (cp & 0x3F)) & 1) != 0;
+  }
+
+  bool empty() const { return list_.empty(); }
+
+  // The number of code points in the set.
+  size_t size() const;
+
+  const std::vector<char32_t> &inversion_list() const { return list_; }
+
+  CodePointSet &operator|=(const CodePointSet &rhs);
+  CodePointSet &operator&=(const CodePointSet &rhs);
+  CodePointSet &operator-=(const CodePointSet &rhs);
+
+private:
+  static const size_t BlockShift = 10;
+  static const size_t BlockWordCount = (1 << BlockShift) / 64;
+
+  void build_index();
+
+  std::vector<char32_t> list_;
+  // A bitmap block for each block of 1024 code points. Block 0 of 'bits_' is
+  // all zero and block 1 is all one.
+  std::vector<uint16_t> index_;
+  std::vector<uint64_t> bits_;
+};
 
-//-----------------------------------------------------------------------------
-// Inline Wrapper functions
-//-----------------------------------------------------------------------------
+inline CodePointSet operator|(CodePointSet lhs, const CodePointSet &rhs) {
+  return lhs |= rhs;
+}
 
-inline std::u32string to_uppercase(const std::u32string &s32,
-                                   const char *lang = nullptr) {
-  return to_uppercase(s32.data(), s32.length(), lang);
+inline CodePointSet operator&(CodePointSet lhs, const CodePointSet &rhs) {
+  return lhs &= rhs;
 }
 
-inline std::u32string to_uppercase(const char32_t *s32,
-                                   const char *lang = nullptr) {
-  return to_uppercase(s32, std::char_traits<char32_t>::length(s32), lang);
+inline CodePointSet operator-(CodePointSet lhs, const CodePointSet &rhs) {
+  return lhs -= rhs;
 }
 
-inline std::u32string to_lowercase(const std::u32string &s32,
-                                   const char *lang = nullptr) {
-  return to_lowercase(s32.data(), s32.length(), lang);
+// The code points from U+0000 to U+10FFFF that are not in 'set'.
+inline CodePointSet operator~(const CodePointSet &set) {
+  return CodePointSet(0, 0x10FFFF) -= set;
 }
 
-inline std::u32string to_lowercase(const char32_t *s32,
-                                   const char *lang = nullptr) {
-  return to_lowercase(s32, std::char_traits<char32_t>::length(s32), lang);
+inline bool operator==(const CodePointSet &lhs, const CodePointSet &rhs) {
+  return lhs.inversion_list() == rhs.inversion_list();
 }
 
-inline std::u32string to_titlecase(const std::u32string &s32,
-                                   const char *lang = nullptr) {
-  return to_titlecase(s32.data(), s32.length(), lang);
+inline bool operator!=(const CodePointSet &lhs, const CodePointSet &rhs) {
+  return !(lhs == rhs);
 }
 
-inline std::u32string to_titlecase(const char32_t *s32,
-                                   const char *lang = nullptr) {
-  return to_titlecase(s32, std::char_traits<char32_t>::length(s32), lang);
+// The code points of a general category, a script, a block, or of any of the
+// 'Property_*' or 'DerivedProperty_*' bits of 'properties'. For example,
+// '(derived_property_set(DerivedProperty_XID_Continue) -
+// script_set(Script::Han)) | CodePointSet(U'-', U'-')'.
+CodePointSet general_category_set(GeneralCategory gc);
+CodePointSet property_set(uint64_t properties);
+CodePointSet derived_property_set(uint32_t properties);
+CodePointSet block_set(Block blk);
+CodePointSet script_set(Script sc);
+
+CodePointSet general_category_set(DataContext ctx, GeneralCategory gc);
+CodePointSet property_set(DataContext ctx, uint64_t properties);
+CodePointSet derived_property_set(DataContext ctx, uint32_t properties);
+CodePointSet block_set(DataContext ctx, Block blk);
+CodePointSet script_set(DataContext ctx, Script sc);
+
+//-----------------------------------------------------------------------------
+// Property Ranges
+//-----------------------------------------------------------------------------
+
+// The code points from 'first' to 'last', inclusive.
+struct CodePointRange {
+  char32_t first;
+  char32_t last;
+};
+
+// Ranges in increasing order, none of them adjacent to the next.
+struct CodePointRangeList {
+  const CodePointRange *ranges;
+  size_t count;
+
+  const CodePointRange *begin() const { return ranges; }
+  const CodePointRange *end() const { return ranges + count; }
+  bool empty() const { return count == 0; }
+};
+
+// The code points that have a property value, read from a generated index, so
+// that they cost O(ranges) instead of a lookup of every code point. A
+// 'Property_*' or 'DerivedProperty_*' argument must be a single bit.
+CodePointRangeList code_point_ranges(GeneralCategory gc);
+CodePointRangeList property_ranges(uint64_t property);
+CodePointRangeList derived_property_ranges(uint32_t derived_property);
+CodePointRangeList code_point_ranges(GraphemeBreak gb);
+CodePointRangeList code_point_ranges(WordBreak wb);
+CodePointRangeList code_point_ranges(SentenceBreak sb);
+CodePointRangeList code_point_ranges(Block blk);
+CodePointRangeList code_point_ranges(Script sc);
+
+CodePointRangeList code_point_ranges(DataContext ctx, GeneralCategory gc);
+CodePointRangeList property_ranges(DataContext ctx, uint64_t property);
+CodePointRangeList derived_property_ranges(DataContext ctx,
+                                           uint32_t derived_property);
+CodePointRangeList code_point_ranges(DataContext ctx, GraphemeBreak gb);
+CodePointRangeList code_point_ranges(DataContext ctx, WordBreak wb);
+CodePointRangeList code_point_ranges(DataContext ctx, SentenceBreak sb);
+CodePointRangeList code_point_ranges(DataContext ctx, Block blk);
+CodePointRangeList code_point_ranges(DataContext ctx, Script sc);
+
+// Calls 'fn(first, last)' for each range of 'code_point_ranges(value)', e.g.
+// 'for_each_range(Script::Greek, fn)', or of 'property_ranges(property)' and
+// 'derived_property_ranges(derived_property)', e.g.
+// 'for_each_property_range(Property_White_Space, fn)'.
+template <typename T, typename Fn> void for_each_range(T value, Fn fn) {
+  for (const auto &r : code_point_ranges(value)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline std::u32string to_case_fold(
-    const std::u32string &s32,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return to_case_fold(s32.data(), s32.length(),
-                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+template <typename Fn> void for_each_property_range(uint64_t property, Fn fn) {
+  for (const auto &r : property_ranges(property)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline std::u32string to_case_fold(
-    const char32_t *s32,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return to_case_fold(s32, std::char_traits<char32_t>::length(s32),
-                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+template <typename Fn>
+void for_each_derived_property_range(uint32_t derived_property, Fn fn) {
+  for (const auto &r : derived_property_ranges(derived_property)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline bool is_uppercase(const std::u32string &s32) {
-  return is_uppercase(s32.data(), s32.length());
+template <typename T, typename Fn>
+void for_each_range(DataContext ctx, T value, Fn fn) {
+  for (const auto &r : code_point_ranges(ctx, value)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline bool is_uppercase(const char32_t *s32) {
-  return is_uppercase(s32, std::char_traits<char32_t>::length(s32));
+template <typename Fn>
+void for_each_property_range(DataContext ctx, uint64_t property, Fn fn) {
+  for (const auto &r : property_ranges(ctx, property)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline bool is_lowercase(const std::u32string &s32) {
-  return is_lowercase(s32.data(), s32.length());
+template <typename Fn>
+void for_each_derived_property_range(DataContext ctx,
+                                     uint32_t derived_property, Fn fn) {
+  for (const auto &r : derived_property_ranges(ctx, derived_property)) {
+    fn(r.first, r.last);
+  }
 }
 
-inline bool is_lowercase(const char32_t *s32) {
-  return is_lowercase(s32, std::char_traits<char32_t>::length(s32));
+//-----------------------------------------------------------------------------
+// UTF-8 Byte Sequences
+//-----------------------------------------------------------------------------
+
+// The UTF-8 encodings of a range of code points, as one to four byte ranges.
+// A string of 'length' bytes matches if each byte is in its range.
+struct Utf8Sequence {
+  struct ByteRange {
+    uint8_t first;
+    uint8_t last;
+  };
+
+  size_t length;
+  ByteRange ranges[4];
+};
+
+// The byte sequences matching exactly the UTF-8 encodings of the code points
+// of 'set', in increasing order, for regex and lexer generators working on raw
+// UTF-8. Each code point matches one sequence, and surrogates match none. For
+// example, 'utf8_sequences(script_set(Script::Greek))'.
+std::vector<Utf8Sequence> utf8_sequences(const CodePointSet &set);
+
+//-----------------------------------------------------------------------------
+// Property Names
+//-----------------------------------------------------------------------------
+
+enum class PropertyType {
+  General_Category,
+  Script,
+  Block,
+  Grapheme_Cluster_Break,
+  Word_Break,
+  Sentence_Break,
+  Property,
+  Derived_Property,
+};
+
+// A property and value named by a property expression such as
+// '\p{Script=Greek}'. 'value' is
+// - a mask of '1 << GeneralCategory' bits for 'General_Category', so that
+//   groups such as 'L' select several categories,
+// - a 'Property_*' or 'DerivedProperty_*' bit for 'Property' and
+//   'Derived_Property',
+// - the enum value for the other properties.
+struct PropertyValue {
+  PropertyType type;
+  uint64_t value;
+  // Set by the 'No', 'N', 'False' and 'F' values of a binary property.
+  bool negated;
+};
+
+// Resolves the inside of a '\p{...}' expression, either 'NAME=VALUE' or a
+// bare name of a general category, a script or a binary property, in that
+// order. Names are compared with loose matching as in UAX #44-LM3, ignoring
+// case, whitespace, '_', '-' and a leading 'is', and looked up with a
+// generated perfect hash. Returns false for unknown names.
+bool resolve_property(const char *s8, size_t l, PropertyValue &out);
+
+inline bool resolve_property(const std::string &s8, PropertyValue &out) {
+  return resolve_property(s8.data(), s8.size(), out);
 }
 
-inline bool is_titlecase(const std::u32string &s32) {
-  return is_titlecase(s32.data(), s32.length());
+// The code points that have 'pv', e.g. for '\p{gc=L}' the union of the
+// letter categories.
+CodePointSet property_value_set(const PropertyValue &pv);
+
+CodePointSet property_value_set(DataContext ctx, const PropertyValue &pv);
+
+//-----------------------------------------------------------------------------
+// Normalization
+//-----------------------------------------------------------------------------
+
+std::u32string to_nfc(const char32_t *s32, size_t l);
+std::u32string to_nfd(const char32_t *s32, size_t l);
+std::u32string to_nfkc(const char32_t *s32, size_t l);
+std::u32string to_nfkd(const char32_t *s32, size_t l);
+
+std::u32string to_nfc(DataContext ctx, const char32_t *s32, size_t l);
+std::u32string to_nfd(DataContext ctx, const char32_t *s32, size_t l);
+std::u32string to_nfkc(DataContext ctx, const char32_t *s32, size_t l);
+std::u32string to_nfkd(DataContext ctx, const char32_t *s32, size_t l);
+
+// As with the casing functions, these append to 'out', which must not be
+// 's32', or write to 'buff' and return the length of the whole output. The
+// output is normalized in 'buff' when its decomposition fits there, and
+// otherwise in a scratch string, so the result is always the exact length.
+void to_nfc(const char32_t *s32, size_t l, std::u32string &out);
+void to_nfd(const char32_t *s32, size_t l, std::u32string &out);
+void to_nfkc(const char32_t *s32, size_t l, std::u32string &out);
+void to_nfkd(const char32_t *s32, size_t l, std::u32string &out);
+
+void to_nfc(DataContext ctx, const char32_t *s32, size_t l,
+            std::u32string &out);
+void to_nfd(DataContext ctx, const char32_t *s32, size_t l,
+            std::u32string &out);
+void to_nfkc(DataContext ctx, const char32_t *s32, size_t l,
+             std::u32string &out);
+void to_nfkd(DataContext ctx, const char32_t *s32, size_t l,
+             std::u32string &out);
+
+size_t to_nfc(const char32_t *s32, size_t l, char32_t *buff, size_t size);
+size_t to_nfd(const char32_t *s32, size_t l, char32_t *buff, size_t size);
+size_t to_nfkc(const char32_t *s32, size_t l, char32_t *buff, size_t size);
+size_t to_nfkd(const char32_t *s32, size_t l, char32_t *buff, size_t size);
+
+size_t to_nfc(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+              size_t size);
+size_t to_nfd(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+              size_t size);
+size_t to_nfkc(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+               size_t size);
+size_t to_nfkd(DataContext ctx, const char32_t *s32, size_t l, char32_t *buff,
+               size_t size);
+
+//-----------------------------------------------------------------------------
+// Inline Fast Paths
+//-----------------------------------------------------------------------------
+
+// The properties of U+0000..U+00FF in the default context, so that the
+// functions below answer them without a call. The others are looked up with
+// the context overloads.
+struct Latin1Record {
+  uint64_t properties;
+  uint32_t derived_properties;
+  GeneralCategory general_category;
+  uint16_t simple_uppercase_mapping;
+  uint16_t simple_lowercase_mapping;
+  uint16_t simple_titlecase_mapping;
+  uint16_t simple_case_folding;
+};
+
+namespace detail {
+
+// Internal state of the default context, which 'set_default_data_context'
+// replaces. They are read by the inline functions below and are not part of
+// the API; use 'default_data_context' instead.
+extern const DataTables *_tables;
+extern const Latin1Record *_default_latin1_records;
+
+}  // namespace detail
+
+inline bool is_cased_letter_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Cased_Letter >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool is_titlecase(const char32_t *s32) {
-  return is_titlecase(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_letter_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Letter >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool is_case_fold(const std::u32string &s32) {
-  return is_case_fold(s32.data(), s32.length());
+inline bool is_mark_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Mark >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool is_case_fold(const char32_t *s32) {
-  return is_case_fold(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_number_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Number >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool caseless_match(
-    const std::u32string &s1, const std::u32string &s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return caseless_match(s1.data(), s1.length(), s2.data(), s2.length(),
-                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline bool is_punctuation_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Punctuation >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool caseless_match(
-    const char32_t *s1, const char32_t *s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return caseless_match(s1, std::char_traits<char32_t>::length(s1), s2,
-                        std::char_traits<char32_t>::length(s2),
-                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline bool is_symbol_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Symbol >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool canonical_caseless_match(
-    const std::u32string &s1, const std::u32string &s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return canonical_caseless_match(
-      s1.data(), s1.length(), s2.data(), s2.length(),
-      special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline bool is_separator_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Separator >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool canonical_caseless_match(
-    const char32_t *s1, const char32_t *s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return canonical_caseless_match(
-      s1, std::char_traits<char32_t>::length(s1), s2,
-      std::char_traits<char32_t>::length(s2),
-      special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline bool is_other_category(GeneralCategory gc) {
+  return ((GeneralCategoryMask_Other >> static_cast<int>(gc)) & 1) != 0;
 }
 
-inline bool compatibility_caseless_match(
-    const std::u32string &s1, const std::u32string &s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return compatibility_caseless_match(
-      s1.data(), s1.length(), s2.data(), s2.length(),
-      special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline GeneralCategory general_category(char32_t cp) {
+  return cp < 0x100 ? detail::_default_latin1_records[cp].general_category
+                    : general_category(detail::_tables, cp);
 }
 
-inline bool compatibility_caseless_match(
-    const char32_t *s1, const char32_t *s2,
-    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
-  return compatibility_caseless_match(
-      s1, std::char_traits<char32_t>::length(s1), s2,
-      std::char_traits<char32_t>::length(s2),
-      special_case_for_uppercase_I_and_dotted_uppercase_I);
+inline bool is_cased_letter(char32_t cp) {
+  return is_cased_letter_category(general_category(cp));
 }
 
-inline std::u32string to_nfc(const std::u32string &s32) {
-  return to_nfc(s32.data(), s32.length());
+inline bool is_letter(char32_t cp) {
+  return is_letter_category(general_category(cp));
 }
 
-inline std::u32string to_nfc(const char32_t *s32) {
-  return to_nfc(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_mark(char32_t cp) {
+  return is_mark_category(general_category(cp));
 }
 
-inline std::u32string to_nfd(const std::u32string &s32) {
-  return to_nfd(s32.data(), s32.length());
+inline bool is_number(char32_t cp) {
+  return is_number_category(general_category(cp));
 }
 
-inline std::u32string to_nfd(const char32_t *s32) {
-  return to_nfd(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_punctuation(char32_t cp) {
+  return is_punctuation_category(general_category(cp));
 }
 
-inline std::u32string to_nfkc(const std::u32string &s32) {
-  return to_nfkc(s32.data(), s32.length());
+inline bool is_symbol(char32_t cp) {
+  return is_symbol_category(general_category(cp));
 }
 
-inline std::u32string to_nfkc(const char32_t *s32) {
-  return to_nfkc(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_separator(char32_t cp) {
+  return is_separator_category(general_category(cp));
 }
 
-inline std::u32string to_nfkd(const std::u32string &s32) {
-  return to_nfkd(s32.data(), s32.length());
+inline bool is_other(char32_t cp) {
+  return is_other_category(general_category(cp));
 }
 
-inline std::u32string to_nfkd(const char32_t *s32) {
-  return to_nfkd(s32, std::char_traits<char32_t>::length(s32));
+inline uint64_t property_mask(char32_t cp) {
+  return cp < 0x100 ? detail::_default_latin1_records[cp].properties
+                    : property_mask(detail::_tables, cp);
 }
 
-inline size_t grapheme_count(const std::u32string &s32) {
-  return grapheme_count(s32.data(), s32.length());
+inline bool is_white_space(char32_t cp) {
+  return (property_mask(cp) & Property_White_Space) != 0;
 }
 
-inline size_t grapheme_count(const char32_t *s32) {
-  return grapheme_count(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_bidi_control(char32_t cp) {
+  return (property_mask(cp) & Property_Bidi_Control) != 0;
 }
 
-inline size_t grapheme_length(const std::u32string &s32) {
-  return grapheme_length(s32.data(), s32.length());
+inline bool is_join_control(char32_t cp) {
+  return (property_mask(cp) & Property_Join_Control) != 0;
 }
 
-inline size_t grapheme_length(const char32_t *s32) {
-  return grapheme_length(s32, std::char_traits<char32_t>::length(s32));
+inline bool is_dash(char32_t cp) {
+  return (property_mask(cp) & Property_Dash) != 0;
+}
+
+inline bool is_hyphen(char32_t cp) {
+  return (property_mask(cp) & Property_Hyphen) != 0;
+}
+
+inline bool is_quotation_mark(char32_t cp) {
+  return (property_mask(cp) & Property_Quotation_Mark) != 0;
+}
+
+inline bool is_terminal_punctuation(char32_t cp) {
+  return (property_mask(cp) & Property_Terminal_Punctuation) != 0;
+}
+
+inline bool is_other_math(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Math) != 0;
+}
+
+inline bool is_hex_digit(char32_t cp) {
+  return (property_mask(cp) & Property_Hex_Digit) != 0;
+}
+
+inline bool is_ascii_hex_digit(char32_t cp) {
+  return (property_mask(cp) & Property_ASCII_Hex_Digit) != 0;
+}
+
+inline bool is_other_alphabetic(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Alphabetic) != 0;
+}
+
+inline bool is_ideographic(char32_t cp) {
+  return (property_mask(cp) & Property_Ideographic) != 0;
+}
+
+inline bool is_diacritic(char32_t cp) {
+  return (property_mask(cp) & Property_Diacritic) != 0;
+}
+
+inline bool is_extender(char32_t cp) {
+  return (property_mask(cp) & Property_Extender) != 0;
+}
+
+inline bool is_other_lowercase(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Lowercase) != 0;
+}
+
+inline bool is_other_uppercase(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Uppercase) != 0;
+}
+
+inline bool is_noncharacter_code_point(char32_t cp) {
+  return (property_mask(cp) & Property_Noncharacter_Code_Point) != 0;
+}
+
+inline bool is_other_grapheme_extend(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Grapheme_Extend) != 0;
+}
+
+inline bool is_ids_binary_operator(char32_t cp) {
+  return (property_mask(cp) & Property_IDS_Binary_Operator) != 0;
+}
+
+inline bool is_ids_trinary_operator(char32_t cp) {
+  return (property_mask(cp) & Property_IDS_Trinary_Operator) != 0;
+}
+
+inline bool is_radical(char32_t cp) {
+  return (property_mask(cp) & Property_Radical) != 0;
+}
+
+inline bool is_unified_ideograph(char32_t cp) {
+  return (property_mask(cp) & Property_Unified_Ideograph) != 0;
+}
+
+inline bool is_other_default_ignorable_code_point(char32_t cp) {
+  return (property_mask(cp) & Property_Other_Default_Ignorable_Code_Point) != 0;
+}
+
+inline bool is_deprecated(char32_t cp) {
+  return (property_mask(cp) & Property_Deprecated) != 0;
+}
+
+inline bool is_soft_dotted(char32_t cp) {
+  return (property_mask(cp) & Property_Soft_Dotted) != 0;
+}
+
+inline bool is_logical_order_exception(char32_t cp) {
+  return (property_mask(cp) & Property_Logical_Order_Exception) != 0;
+}
+
+inline bool is_other_id_start(char32_t cp) {
+  return (property_mask(cp) & Property_Other_ID_Start) != 0;
+}
+
+inline bool is_other_id_continue(char32_t cp) {
+  return (property_mask(cp) & Property_Other_ID_Continue) != 0;
+}
+
+inline bool is_sentence_terminal(char32_t cp) {
+  return (property_mask(cp) & Property_Sentence_Terminal) != 0;
+}
+
+inline bool is_variation_selector(char32_t cp) {
+  return (property_mask(cp) & Property_Variation_Selector) != 0;
+}
+
+inline bool is_pattern_white_space(char32_t cp) {
+  return (property_mask(cp) & Property_Pattern_White_Space) != 0;
+}
+
+inline bool is_pattern_syntax(char32_t cp) {
+  return (property_mask(cp) & Property_Pattern_Syntax) != 0;
+}
+
+inline bool is_prepended_concatenation_mark(char32_t cp) {
+  return (property_mask(cp) & Property_Prepended_Concatenation_Mark) != 0;
+}
+
+inline uint32_t derived_property_mask(char32_t cp) {
+  return cp < 0x100 ? detail::_default_latin1_records[cp].derived_properties
+                    : derived_property_mask(detail::_tables, cp);
+}
+
+inline bool is_math(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Math) != 0;
+}
+
+inline bool is_alphabetic(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Alphabetic) != 0;
+}
+
+inline bool is_lowercase(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Lowercase) != 0;
+}
+
+inline bool is_uppercase(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Uppercase) != 0;
+}
+
+inline bool is_cased(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Cased) != 0;
+}
+
+inline bool is_case_ignorable(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Case_Ignorable) != 0;
+}
+
+inline bool is_changes_when_lowercased(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Changes_When_Lowercased) != 0;
+}
+
+inline bool is_changes_when_uppercased(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Changes_When_Uppercased) != 0;
+}
+
+inline bool is_changes_when_titlecased(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Changes_When_Titlecased) != 0;
+}
+
+inline bool is_changes_when_casefolded(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Changes_When_Casefolded) != 0;
+}
+
+inline bool is_changes_when_casemapped(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Changes_When_Casemapped) != 0;
+}
+
+inline bool is_id_start(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_ID_Start) != 0;
+}
+
+inline bool is_id_continue(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_ID_Continue) != 0;
+}
+
+inline bool is_xid_start(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_XID_Start) != 0;
+}
+
+inline bool is_xid_continue(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_XID_Continue) != 0;
+}
+
+inline bool is_default_ignorable_code_point(char32_t cp) {
+  return (derived_property_mask(cp) &
+          DerivedProperty_Default_Ignorable_Code_Point) != 0;
+}
+
+inline bool is_grapheme_extend(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Grapheme_Extend) != 0;
+}
+
+inline bool is_grapheme_base(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Grapheme_Base) != 0;
+}
+
+inline bool is_grapheme_link(char32_t cp) {
+  return (derived_property_mask(cp) & DerivedProperty_Grapheme_Link) != 0;
+}
+
+inline bool is_emoji(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Emoji) != 0;
+}
+
+inline bool is_emoji_presentation(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Emoji_Presentation) != 0;
+}
+
+inline bool is_emoji_modifier(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Emoji_Modifier) != 0;
+}
+
+inline bool is_emoji_modifier_base(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Emoji_Modifier_Base) != 0;
+}
+
+inline bool is_emoji_component(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Emoji_Component) != 0;
+}
+
+inline bool is_extended_pictographic(char32_t cp) {
+  return (emoji_property_mask(cp) & EmojiProperty_Extended_Pictographic) != 0;
+}
+
+// No code point below U+0300 combines, and no Hangul jamo or syllable is
+// below U+1100.
+inline uint8_t combining_class(char32_t cp) {
+  return cp < 0x300 ? 0 : combining_class(detail::_tables, cp);
+}
+
+inline HangulSyllableType hangul_syllable_type(char32_t cp) {
+  return cp < 0x1100 ? HangulSyllableType::NA
+                     : hangul_syllable_type(detail::_tables, cp);
+}
+
+// Compile-time forms of the predicates above for code that names the
+// categories or properties it tests, e.g.
+// 'in_category<GeneralCategory::Lu, GeneralCategory::Lt>(cp)' or
+// 'has_derived_property<DerivedProperty_XID_Continue>(cp)'. The mask is a
+// constant, so each is one lookup and one test. 'has_property' and
+// 'has_derived_property' are true if the code point has any of the bits of
+// their mask.
+template <GeneralCategory... Categories> inline bool in_category(char32_t cp) {
+  constexpr auto mask = general_category_mask(Categories...);
+  return ((mask >> static_cast<int>(general_category(cp))) & 1) != 0;
+}
+
+template <GeneralCategory... Categories>
+inline bool in_category(DataContext ctx, char32_t cp) {
+  constexpr auto mask = general_category_mask(Categories...);
+  return ((mask >> static_cast<int>(general_category(ctx, cp))) & 1) != 0;
+}
+
+template <uint64_t Properties> inline bool has_property(char32_t cp) {
+  static_assert(Properties != 0, "no property");
+  return (property_mask(cp) & Properties) != 0;
+}
+
+template <uint64_t Properties>
+inline bool has_property(DataContext ctx, char32_t cp) {
+  static_assert(Properties != 0, "no property");
+  return (property_mask(ctx, cp) & Properties) != 0;
+}
+
+template <uint32_t Properties> inline bool has_derived_property(char32_t cp) {
+  static_assert(Properties != 0, "no property");
+  return (derived_property_mask(cp) & Properties) != 0;
+}
+
+template <uint32_t Properties>
+inline bool has_derived_property(DataContext ctx, char32_t cp) {
+  static_assert(Properties != 0, "no property");
+  return (derived_property_mask(ctx, cp) & Properties) != 0;
+}
+
+inline char32_t simple_uppercase_mapping(char32_t cp) {
+  return cp < 0x100
+             ? detail::_default_latin1_records[cp].simple_uppercase_mapping
+             : simple_uppercase_mapping(detail::_tables, cp);
+}
+
+inline char32_t simple_lowercase_mapping(char32_t cp) {
+  return cp < 0x100
+             ? detail::_default_latin1_records[cp].simple_lowercase_mapping
+             : simple_lowercase_mapping(detail::_tables, cp);
+}
+
+inline char32_t simple_titlecase_mapping(char32_t cp) {
+  return cp < 0x100
+             ? detail::_default_latin1_records[cp].simple_titlecase_mapping
+             : simple_titlecase_mapping(detail::_tables, cp);
+}
+
+inline char32_t simple_case_folding(char32_t cp) {
+  return cp < 0x100 ? detail::_default_latin1_records[cp].simple_case_folding
+                    : simple_case_folding(detail::_tables, cp);
+}
+
+//-----------------------------------------------------------------------------
+// Inline Wrapper functions
+//-----------------------------------------------------------------------------
+
+inline std::u32string to_uppercase(const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_uppercase(s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_uppercase(DataContext ctx, const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_uppercase(ctx, s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_uppercase(const char32_t *s32,
+                                   const char *lang = nullptr) {
+  return to_uppercase(s32, std::char_traits<char32_t>::length(s32), lang);
+}
+
+inline std::u32string to_lowercase(const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_lowercase(s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_lowercase(DataContext ctx, const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_lowercase(ctx, s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_lowercase(const char32_t *s32,
+                                   const char *lang = nullptr) {
+  return to_lowercase(s32, std::char_traits<char32_t>::length(s32), lang);
+}
+
+inline std::u32string to_titlecase(const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_titlecase(s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_titlecase(DataContext ctx, const std::u32string &s32,
+                                   const char *lang = nullptr) {
+  return to_titlecase(ctx, s32.data(), s32.length(), lang);
+}
+
+inline std::u32string to_titlecase(const char32_t *s32,
+                                   const char *lang = nullptr) {
+  return to_titlecase(s32, std::char_traits<char32_t>::length(s32), lang);
+}
+
+inline std::u32string to_case_fold(
+    const std::u32string &s32,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return to_case_fold(s32.data(), s32.length(),
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline std::u32string to_case_fold(
+    DataContext ctx, const std::u32string &s32,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return to_case_fold(ctx, s32.data(), s32.length(),
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline std::u32string to_case_fold(
+    const char32_t *s32,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return to_case_fold(s32, std::char_traits<char32_t>::length(s32),
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline void to_uppercase(const std::u32string &s32, std::u32string &out,
+                         const char *lang = nullptr) {
+  to_uppercase(s32.data(), s32.length(), out, lang);
+}
+
+inline void to_uppercase(DataContext ctx, const std::u32string &s32,
+                         std::u32string &out, const char *lang = nullptr) {
+  to_uppercase(ctx, s32.data(), s32.length(), out, lang);
+}
+
+inline void to_lowercase(const std::u32string &s32, std::u32string &out,
+                         const char *lang = nullptr) {
+  to_lowercase(s32.data(), s32.length(), out, lang);
+}
+
+inline void to_lowercase(DataContext ctx, const std::u32string &s32,
+                         std::u32string &out, const char *lang = nullptr) {
+  to_lowercase(ctx, s32.data(), s32.length(), out, lang);
+}
+
+inline void to_titlecase(const std::u32string &s32, std::u32string &out,
+                         const char *lang = nullptr) {
+  to_titlecase(s32.data(), s32.length(), out, lang);
+}
+
+inline void to_titlecase(DataContext ctx, const std::u32string &s32,
+                         std::u32string &out, const char *lang = nullptr) {
+  to_titlecase(ctx, s32.data(), s32.length(), out, lang);
+}
+
+inline void to_case_fold(
+    const std::u32string &s32, std::u32string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  to_case_fold(s32.data(), s32.length(), out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline void to_case_fold(
+    DataContext ctx, const std::u32string &s32, std::u32string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  to_case_fold(ctx, s32.data(), s32.length(), out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline std::string to_uppercase(const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_uppercase(s8.data(), s8.length(), lang);
+}
+
+inline std::string to_uppercase(DataContext ctx, const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_uppercase(ctx, s8.data(), s8.length(), lang);
+}
+
+inline void to_uppercase(const std::string &s8, std::string &out,
+                         const char *lang = nullptr) {
+  to_uppercase(s8.data(), s8.length(), out, lang);
+}
+
+inline void to_uppercase(DataContext ctx, const std::string &s8,
+                         std::string &out, const char *lang = nullptr) {
+  to_uppercase(ctx, s8.data(), s8.length(), out, lang);
+}
+
+inline std::string to_lowercase(const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_lowercase(s8.data(), s8.length(), lang);
+}
+
+inline std::string to_lowercase(DataContext ctx, const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_lowercase(ctx, s8.data(), s8.length(), lang);
+}
+
+inline void to_lowercase(const std::string &s8, std::string &out,
+                         const char *lang = nullptr) {
+  to_lowercase(s8.data(), s8.length(), out, lang);
+}
+
+inline void to_lowercase(DataContext ctx, const std::string &s8,
+                         std::string &out, const char *lang = nullptr) {
+  to_lowercase(ctx, s8.data(), s8.length(), out, lang);
+}
+
+inline std::string to_titlecase(const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_titlecase(s8.data(), s8.length(), lang);
+}
+
+inline std::string to_titlecase(DataContext ctx, const std::string &s8,
+                                const char *lang = nullptr) {
+  return to_titlecase(ctx, s8.data(), s8.length(), lang);
+}
+
+inline void to_titlecase(const std::string &s8, std::string &out,
+                         const char *lang = nullptr) {
+  to_titlecase(s8.data(), s8.length(), out, lang);
+}
+
+inline void to_titlecase(DataContext ctx, const std::string &s8,
+                         std::string &out, const char *lang = nullptr) {
+  to_titlecase(ctx, s8.data(), s8.length(), out, lang);
+}
+
+inline std::string to_case_fold(
+    const std::string &s8,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return to_case_fold(s8.data(), s8.length(),
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline std::string to_case_fold(
+    DataContext ctx, const std::string &s8,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return to_case_fold(ctx, s8.data(), s8.length(),
+                      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline void to_case_fold(
+    const std::string &s8, std::string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  to_case_fold(s8.data(), s8.length(), out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline void to_case_fold(
+    DataContext ctx, const std::string &s8, std::string &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  to_case_fold(ctx, s8.data(), s8.length(), out,
+               special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool is_uppercase(const std::u32string &s32) {
+  return is_uppercase(s32.data(), s32.length());
+}
+
+inline bool is_uppercase(DataContext ctx, const std::u32string &s32) {
+  return is_uppercase(ctx, s32.data(), s32.length());
+}
+
+inline bool is_uppercase(const char32_t *s32) {
+  return is_uppercase(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline bool is_lowercase(const std::u32string &s32) {
+  return is_lowercase(s32.data(), s32.length());
+}
+
+inline bool is_lowercase(DataContext ctx, const std::u32string &s32) {
+  return is_lowercase(ctx, s32.data(), s32.length());
+}
+
+inline bool is_lowercase(const char32_t *s32) {
+  return is_lowercase(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline bool is_titlecase(const std::u32string &s32) {
+  return is_titlecase(s32.data(), s32.length());
+}
+
+inline bool is_titlecase(DataContext ctx, const std::u32string &s32) {
+  return is_titlecase(ctx, s32.data(), s32.length());
+}
+
+inline bool is_titlecase(const char32_t *s32) {
+  return is_titlecase(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline bool is_case_fold(const std::u32string &s32) {
+  return is_case_fold(s32.data(), s32.length());
+}
+
+inline bool is_case_fold(DataContext ctx, const std::u32string &s32) {
+  return is_case_fold(ctx, s32.data(), s32.length());
+}
+
+inline bool is_case_fold(const char32_t *s32) {
+  return is_case_fold(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline bool caseless_match(
+    const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return caseless_match(s1.data(), s1.length(), s2.data(), s2.length(),
+                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool caseless_match(
+    DataContext ctx, const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return caseless_match(ctx, s1.data(), s1.length(), s2.data(), s2.length(),
+                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool caseless_match(
+    const char32_t *s1, const char32_t *s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return caseless_match(s1, std::char_traits<char32_t>::length(s1), s2,
+                        std::char_traits<char32_t>::length(s2),
+                        special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool canonical_caseless_match(
+    const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return canonical_caseless_match(
+      s1.data(), s1.length(), s2.data(), s2.length(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool canonical_caseless_match(
+    DataContext ctx, const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return canonical_caseless_match(
+      ctx, s1.data(), s1.length(), s2.data(), s2.length(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool canonical_caseless_match(
+    const char32_t *s1, const char32_t *s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return canonical_caseless_match(
+      s1, std::char_traits<char32_t>::length(s1), s2,
+      std::char_traits<char32_t>::length(s2),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool compatibility_caseless_match(
+    const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return compatibility_caseless_match(
+      s1.data(), s1.length(), s2.data(), s2.length(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool compatibility_caseless_match(
+    DataContext ctx, const std::u32string &s1, const std::u32string &s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return compatibility_caseless_match(
+      ctx, s1.data(), s1.length(), s2.data(), s2.length(),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline bool compatibility_caseless_match(
+    const char32_t *s1, const char32_t *s2,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return compatibility_caseless_match(
+      s1, std::char_traits<char32_t>::length(s1), s2,
+      std::char_traits<char32_t>::length(s2),
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+inline std::u32string to_nfc(const std::u32string &s32) {
+  return to_nfc(s32.data(), s32.length());
+}
+
+inline std::u32string to_nfc(DataContext ctx, const std::u32string &s32) {
+  return to_nfc(ctx, s32.data(), s32.length());
+}
+
+inline std::u32string to_nfc(const char32_t *s32) {
+  return to_nfc(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline std::u32string to_nfd(const std::u32string &s32) {
+  return to_nfd(s32.data(), s32.length());
+}
+
+inline std::u32string to_nfd(DataContext ctx, const std::u32string &s32) {
+  return to_nfd(ctx, s32.data(), s32.length());
+}
+
+inline std::u32string to_nfd(const char32_t *s32) {
+  return to_nfd(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline std::u32string to_nfkc(const std::u32string &s32) {
+  return to_nfkc(s32.data(), s32.length());
+}
+
+inline std::u32string to_nfkc(DataContext ctx, const std::u32string &s32) {
+  return to_nfkc(ctx, s32.data(), s32.length());
+}
+
+inline std::u32string to_nfkc(const char32_t *s32) {
+  return to_nfkc(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline std::u32string to_nfkd(const std::u32string &s32) {
+  return to_nfkd(s32.data(), s32.length());
+}
+
+inline std::u32string to_nfkd(DataContext ctx, const std::u32string &s32) {
+  return to_nfkd(ctx, s32.data(), s32.length());
+}
+
+inline std::u32string to_nfkd(const char32_t *s32) {
+  return to_nfkd(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline void to_nfc(const std::u32string &s32, std::u32string &out) {
+  to_nfc(s32.data(), s32.length(), out);
+}
+
+inline void to_nfc(DataContext ctx, const std::u32string &s32,
+                   std::u32string &out) {
+  to_nfc(ctx, s32.data(), s32.length(), out);
+}
+
+inline void to_nfd(const std::u32string &s32, std::u32string &out) {
+  to_nfd(s32.data(), s32.length(), out);
+}
+
+inline void to_nfd(DataContext ctx, const std::u32string &s32,
+                   std::u32string &out) {
+  to_nfd(ctx, s32.data(), s32.length(), out);
+}
+
+inline void to_nfkc(const std::u32string &s32, std::u32string &out) {
+  to_nfkc(s32.data(), s32.length(), out);
+}
+
+inline void to_nfkc(DataContext ctx, const std::u32string &s32,
+                    std::u32string &out) {
+  to_nfkc(ctx, s32.data(), s32.length(), out);
+}
+
+inline void to_nfkd(const std::u32string &s32, std::u32string &out) {
+  to_nfkd(s32.data(), s32.length(), out);
+}
+
+inline void to_nfkd(DataContext ctx, const std::u32string &s32,
+                    std::u32string &out) {
+  to_nfkd(ctx, s32.data(), s32.length(), out);
+}
+
+inline size_t grapheme_count(const std::u32string &s32) {
+  return grapheme_count(s32.data(), s32.length());
+}
+
+inline size_t grapheme_count(DataContext ctx, const std::u32string &s32) {
+  return grapheme_count(ctx, s32.data(), s32.length());
+}
+
+inline size_t grapheme_count(const char32_t *s32) {
+  return grapheme_count(s32, std::char_traits<char32_t>::length(s32));
+}
+
+inline size_t grapheme_length(const std::u32string &s32) {
+  return grapheme_length(s32.data(), s32.length());
+}
+
+inline size_t grapheme_length(DataContext ctx, const std::u32string &s32) {
+  return grapheme_length(ctx, s32.data(), s32.length());
+}
+
+inline size_t grapheme_length(const char32_t *s32) {
+  return grapheme_length(s32, std::char_traits<char32_t>::length(s32));
+}
+
+//-----------------------------------------------------------------------------
+// Allocator-aware Output
+//-----------------------------------------------------------------------------
+
+// The transforms also append to strings with other allocators, such as
+// 'std::pmr::u32string' on an arena. The string is written in place through
+// 'detail::StringOutput', as the 'std::u32string' overloads write theirs, so
+// all the memory comes from its allocator.
+
+namespace detail {
+
+template <typename Alloc>
+using u32string_with =
+    std::basic_string<char32_t, std::char_traits<char32_t>, Alloc>;
+
+// A string with any allocator, taking the part of 'std::u32string' that the
+// transforms use. The string is grown through its own allocator ahead of the
+// writes, and cut to the written length when this is destroyed.
+class StringOutput {
+public:
+  template <typename Alloc>
+  explicit StringOutput(u32string_with<Alloc> &str)
+      : str_(&str), resize_(&resize_string<Alloc>), data_(&str[0]),
+        size_(str.size()), capacity_(str.size()) {}
+
+  ~StringOutput() { resize_(str_, size_); }
+
+  StringOutput(const StringOutput &) = delete;
+  StringOutput &operator=(const StringOutput &) = delete;
+
+  size_t size() const { return size_; }
+  size_t length() const { return size_; }
+
+  char32_t &operator[](size_t i) { return data_[i]; }
+
+  void reserve(size_t size) {
+    if (size > capacity_) {
+      grow(size);
+    }
+  }
+
+  void resize(size_t size) {
+    reserve(size);
+    for (auto i = size_; i < size; i++) {
+      data_[i] = 0;
+    }
+    size_ = size;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  StringOutput &operator+=(char32_t cp) {
+    if (size_ == capacity_) {
+      grow(capacity_ * 2 > size_ ? capacity_ * 2 : size_ + 1);
+    }
+    data_[size_++] = cp;
+    return *this;
+  }
+
+  StringOutput &operator+=(const char32_t *s32) {
+    while (*s32) {
+      *this += *s32++;
+    }
+    return *this;
+  }
+
+  void append(const char32_t *s32, size_t l) {
+    if (size_ + l > capacity_) {
+      grow(capacity_ * 2 > size_ + l ? capacity_ * 2 : size_ + l);
+    }
+    std::char_traits<char32_t>::copy(data_ + size_, s32, l);
+    size_ += l;
+  }
+
+private:
+  template <typename Alloc>
+  static char32_t *resize_string(void *str, size_t size) {
+    auto &s = *static_cast<u32string_with<Alloc> *>(str);
+    s.resize(size);
+    return &s[0];
+  }
+
+  void grow(size_t size) {
+    data_ = resize_(str_, size);
+    capacity_ = size;
+  }
+
+  void *str_;
+  char32_t *(*resize_)(void *, size_t);
+  char32_t *data_;
+  size_t size_;
+  size_t capacity_;
+};
+
+void to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang);
+void to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang);
+void to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out, const char *lang);
+void to_case_fold(DataContext ctx, const char32_t *s32, size_t l,
+                  StringOutput &out,
+                  bool special_case_for_uppercase_I_and_dotted_uppercase_I);
+void to_nfc(DataContext ctx, const char32_t *s32, size_t l,
+            StringOutput &out);
+void to_nfd(DataContext ctx, const char32_t *s32, size_t l,
+            StringOutput &out);
+void to_nfkc(DataContext ctx, const char32_t *s32, size_t l,
+             StringOutput &out);
+void to_nfkd(DataContext ctx, const char32_t *s32, size_t l,
+             StringOutput &out);
+
+}  // namespace detail
+
+template <typename Alloc>
+inline void to_uppercase(const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_uppercase(default_data_context(), s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_uppercase(DataContext ctx, const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_uppercase(ctx, s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_lowercase(const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_lowercase(default_data_context(), s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_lowercase(DataContext ctx, const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_lowercase(ctx, s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_titlecase(const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_titlecase(default_data_context(), s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_titlecase(DataContext ctx, const char32_t *s32, size_t l,
+                         detail::u32string_with<Alloc> &out,
+                         const char *lang = nullptr) {
+  detail::StringOutput o(out);
+  detail::to_titlecase(ctx, s32, l, o, lang);
+}
+
+template <typename Alloc>
+inline void to_case_fold(
+    const char32_t *s32, size_t l, detail::u32string_with<Alloc> &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  detail::StringOutput o(out);
+  detail::to_case_fold(default_data_context(), s32, l, o,
+                       special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+template <typename Alloc>
+inline void to_case_fold(
+    DataContext ctx, const char32_t *s32, size_t l,
+    detail::u32string_with<Alloc> &out,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  detail::StringOutput o(out);
+  detail::to_case_fold(ctx, s32, l, o,
+                       special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+template <typename Alloc>
+inline void to_nfc(const char32_t *s32, size_t l,
+                  detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfc(default_data_context(), s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfc(DataContext ctx, const char32_t *s32, size_t l,
+                  detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfc(ctx, s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfd(const char32_t *s32, size_t l,
+                  detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfd(default_data_context(), s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfd(DataContext ctx, const char32_t *s32, size_t l,
+                  detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfd(ctx, s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfkc(const char32_t *s32, size_t l,
+                   detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfkc(default_data_context(), s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfkc(DataContext ctx, const char32_t *s32, size_t l,
+                   detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfkc(ctx, s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfkd(const char32_t *s32, size_t l,
+                   detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfkd(default_data_context(), s32, l, o);
+}
+
+template <typename Alloc>
+inline void to_nfkd(DataContext ctx, const char32_t *s32, size_t l,
+                   detail::u32string_with<Alloc> &out) {
+  detail::StringOutput o(out);
+  detail::to_nfkd(ctx, s32, l, o);
+}
+
+// The caseless matches that normalize, with their intermediate strings from
+// 'alloc', e.g. 'std::pmr::polymorphic_allocator<char32_t>(&arena)'.
+template <typename Alloc, typename = typename Alloc::value_type>
+inline bool canonical_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2, const Alloc &alloc,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  // NFD(toCasefold(NFD(X)))
+  auto key = [&](const char32_t *s32, size_t l) {
+    detail::u32string_with<Alloc> nfd(alloc), folded(alloc);
+    to_nfd(ctx, s32, l, nfd);
+    to_case_fold(ctx, nfd.data(), nfd.length(), folded,
+                 special_case_for_uppercase_I_and_dotted_uppercase_I);
+    nfd.clear();
+    to_nfd(ctx, folded.data(), folded.length(), nfd);
+    return nfd;
+  };
+  return key(s1, l1) == key(s2, l2);
+}
+
+template <typename Alloc, typename = typename Alloc::value_type>
+inline bool canonical_caseless_match(
+    const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
+    const Alloc &alloc,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return canonical_caseless_match(
+      default_data_context(), s1, l1, s2, l2, alloc,
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
+}
+
+template <typename Alloc, typename = typename Alloc::value_type>
+inline bool compatibility_caseless_match(
+    DataContext ctx, const char32_t *s1, size_t l1, const char32_t *s2,
+    size_t l2, const Alloc &alloc,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  // NFKD(toCasefold(NFKD(toCasefold(NFD(X)))))
+  auto key = [&](const char32_t *s32, size_t l) {
+    detail::u32string_with<Alloc> a(alloc), b(alloc);
+    to_nfd(ctx, s32, l, a);
+    to_case_fold(ctx, a.data(), a.length(), b,
+                 special_case_for_uppercase_I_and_dotted_uppercase_I);
+    a.clear();
+    to_nfkd(ctx, b.data(), b.length(), a);
+    b.clear();
+    to_case_fold(ctx, a.data(), a.length(), b,
+                 special_case_for_uppercase_I_and_dotted_uppercase_I);
+    a.clear();
+    to_nfkd(ctx, b.data(), b.length(), a);
+    return a;
+  };
+  return key(s1, l1) == key(s2, l2);
+}
+
+template <typename Alloc, typename = typename Alloc::value_type>
+inline bool compatibility_caseless_match(
+    const char32_t *s1, size_t l1, const char32_t *s2, size_t l2,
+    const Alloc &alloc,
+    bool special_case_for_uppercase_I_and_dotted_uppercase_I = false) {
+  return compatibility_caseless_match(
+      default_data_context(), s1, l1, s2, l2, alloc,
+      special_case_for_uppercase_I_and_dotted_uppercase_I);
 }
 
 }  // namespace unicode
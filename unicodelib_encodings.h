@@ -21,9 +21,11 @@
 
     size_t encode_codepoint(char32_t cp, std::string &out);
     void encode(const char32_t *s32, size_t l, std::string &out);
+    size_t encode(const char32_t *s32, size_t l, char *buff, size_t size);
 
     size_t decode_codepoint(const char *s8, size_t l, char32_t &out);
     void decode(const char *s8, size_t l, std::u32string &out);
+    size_t decode(const char *s8, size_t l, char32_t *buff, size_t size);
 
   }  // namespace utf8
 
@@ -35,15 +37,23 @@
 
     size_t encode_codepoint(char32_t cp, std::u16string &out);
     void encode(const char32_t *s32, size_t l, std::u16string &out);
+    size_t encode(const char32_t *s32, size_t l, char16_t *buff, size_t size);
 
     size_t decode_codepoint(const char16_t *s16, size_t l, char32_t &out);
     void decode(const char16_t *s16, size_t l, std::u32string &out);
+    size_t decode(const char16_t *s16, size_t l, char32_t *buff, size_t size);
 
   }  // namespace utf16
 
   std::string to_utf8(const char16_t *s16, size_t l);
   std::u16string to_utf16(const char *s8, size_t l);
 
+  void to_utf8(const char16_t *s16, size_t l, std::string &out);
+  void to_utf16(const char *s8, size_t l, std::u16string &out);
+
+  The functions appending to 'out' take strings with any allocator, e.g.
+  'std::pmr::string'.
+
   std::wstring to_wstring(const char *s8, size_t l);
   std::wstring to_wstring(const char16_t *s16, size_t l);
   std::wstring to_wstring(const char32_t *s32, size_t l);
@@ -56,6 +66,25 @@
 
 namespace unicode {
 
+//-----------------------------------------------------------------------------
+// Output growth
+//-----------------------------------------------------------------------------
+
+namespace detail {
+
+// Makes room for 'l' more characters at the end of 'out' ahead of an append.
+// 'reserve' may grow a string to exactly the size asked for, so the capacity
+// at least doubles here, and appending to one string again and again stays
+// linear.
+template <typename String> inline void reserve_more(String &out, size_t l) {
+  auto size = out.size() + l;
+  if (size > out.capacity()) {
+    out.reserve(size > out.capacity() * 2 ? size : out.capacity() * 2);
+  }
+}
+
+}  // namespace detail
+
 //-----------------------------------------------------------------------------
 // UTF8 encoding
 //-----------------------------------------------------------------------------
@@ -135,19 +164,45 @@ inline size_t encode_codepoint(char32_t cp, char *buff) {
   return 0;
 }
 
-inline size_t encode_codepoint(char32_t cp, std::string &out) {
+template <typename Alloc>
+inline size_t encode_codepoint(
+    char32_t cp, std::basic_string<char, std::char_traits<char>, Alloc> &out) {
   char buff[4];
   auto l = encode_codepoint(cp, buff);
   out.append(buff, l);
   return l;
 }
 
-inline void encode(const char32_t *s32, size_t l, std::string &out) {
+template <typename Alloc>
+inline void encode(
+    const char32_t *s32, size_t l,
+    std::basic_string<char, std::char_traits<char>, Alloc> &out) {
+  detail::reserve_more(out, l);
   for (size_t i = 0; i < l; i++) {
     encode_codepoint(s32[i], out);
   }
 }
 
+// Writes as many whole code points as fit in 'size' bytes of 'buff' and
+// returns the length of the whole encoding. A result above 'size' means it
+// didn't fit, and is the size to call again with.
+inline size_t encode(const char32_t *s32, size_t l, char *buff, size_t size) {
+  size_t length = 0;
+  for (size_t i = 0; i < l; i++) {
+    if (length + 4 <= size) {
+      length += encode_codepoint(s32[i], &buff[length]);
+    } else {
+      char code[4];
+      auto n = encode_codepoint(s32[i], code);
+      for (size_t j = 0; j < n && length + n <= size; j++) {
+        buff[length + j] = code[j];
+      }
+      length += n;
+    }
+  }
+  return length;
+}
+
 inline bool decode_codepoint(const char *s8, size_t l, size_t &bytes,
                              char32_t &cp) {
   if (l) {
@@ -206,7 +261,11 @@ inline void for_each(const char *s8, size_t l, T callback) {
   }
 }
 
-inline void decode(const char *s8, size_t l, std::u32string &out) {
+template <typename Alloc>
+inline void decode(
+    const char *s8, size_t l,
+    std::basic_string<char32_t, std::char_traits<char32_t>, Alloc> &out) {
+  detail::reserve_more(out, l);
   for_each(s8, l,
            [&](const char *s, size_t l, size_t beg, size_t end, size_t i) {
              size_t bytes;
@@ -216,6 +275,22 @@ inline void decode(const char *s8, size_t l, std::u32string &out) {
            });
 }
 
+// Writes as many code points as fit in 'size' code points of 'buff' and
+// returns the length of the whole decoding, as 'encode' does.
+inline size_t decode(const char *s8, size_t l, char32_t *buff, size_t size) {
+  size_t length = 0;
+  for_each(s8, l,
+           [&](const char *s, size_t l, size_t beg, size_t end, size_t i) {
+             if (length < size) {
+               size_t bytes;
+               buff[length] = 0;
+               decode_codepoint(&s[beg], (end - beg), bytes, buff[length]);
+             }
+             length++;
+           });
+  return length;
+}
+
 }  // namespace utf8
 
 //-----------------------------------------------------------------------------
@@ -277,19 +352,46 @@ inline size_t encode_codepoint(char32_t cp, char16_t *buff) {
   return 0;
 }
 
-inline size_t encode_codepoint(char32_t cp, std::u16string &out) {
+template <typename Alloc>
+inline size_t encode_codepoint(
+    char32_t cp,
+    std::basic_string<char16_t, std::char_traits<char16_t>, Alloc> &out) {
   char16_t buff[2];
   auto l = encode_codepoint(cp, buff);
   out.append(buff, l);
   return l;
 }
 
-inline void encode(const char32_t *s32, size_t l, std::u16string &out) {
+template <typename Alloc>
+inline void encode(
+    const char32_t *s32, size_t l,
+    std::basic_string<char16_t, std::char_traits<char16_t>, Alloc> &out) {
+  detail::reserve_more(out, l);
   for (size_t i = 0; i < l; i++) {
     encode_codepoint(s32[i], out);
   }
 }
 
+// Writes as many whole code points as fit in 'size' code units of 'buff' and
+// returns the length of the whole encoding, as 'utf8::encode' does.
+inline size_t encode(const char32_t *s32, size_t l, char16_t *buff,
+                     size_t size) {
+  size_t length = 0;
+  for (size_t i = 0; i < l; i++) {
+    if (length + 2 <= size) {
+      length += encode_codepoint(s32[i], &buff[length]);
+    } else {
+      char16_t code[2];
+      auto n = encode_codepoint(s32[i], code);
+      for (size_t j = 0; j < n && length + n <= size; j++) {
+        buff[length + j] = code[j];
+      }
+      length += n;
+    }
+  }
+  return length;
+}
+
 inline bool decode_codepoint(const char16_t *s16, size_t l, size_t &length,
                              char32_t &cp) {
   if (l) {
@@ -338,7 +440,11 @@ inline void for_each(const char16_t *s16, size_t l, T callback) {
   }
 }
 
-inline void decode(const char16_t *s16, size_t l, std::u32string &out) {
+template <typename Alloc>
+inline void decode(
+    const char16_t *s16, size_t l,
+    std::basic_string<char32_t, std::char_traits<char32_t>, Alloc> &out) {
+  detail::reserve_more(out, l);
   for_each(s16, l,
            [&](const char16_t *s, size_t l, size_t beg, size_t end, size_t i) {
              size_t length;
@@ -348,6 +454,23 @@ inline void decode(const char16_t *s16, size_t l, std::u32string &out) {
            });
 }
 
+// Writes as many code points as fit in 'size' code points of 'buff' and
+// returns the length of the whole decoding, as 'utf8::decode' does.
+inline size_t decode(const char16_t *s16, size_t l, char32_t *buff,
+                     size_t size) {
+  size_t length = 0;
+  for_each(s16, l,
+           [&](const char16_t *s, size_t l, size_t beg, size_t end, size_t i) {
+             if (length < size) {
+               size_t units;
+               buff[length] = 0;
+               decode_codepoint(&s[beg], (end - beg), units, buff[length]);
+             }
+             length++;
+           });
+  return length;
+}
+
 }  // namespace utf16
 
 //-----------------------------------------------------------------------------
@@ -542,8 +665,40 @@ inline std::u32string decode(const char16_t *s16) {
 // utf8/utf16 conversion
 //-----------------------------------------------------------------------------
 
+// Transcodes a code point at a time, without a UTF-32 copy of the text.
+template <typename Alloc>
+inline void to_utf8(
+    const char16_t *s16, size_t l,
+    std::basic_string<char, std::char_traits<char>, Alloc> &out) {
+  detail::reserve_more(out, l);
+  utf16::for_each(
+      s16, l,
+      [&](const char16_t *s, size_t l, size_t beg, size_t end, size_t i) {
+        size_t units;
+        char32_t cp = 0;
+        utf16::decode_codepoint(&s[beg], (end - beg), units, cp);
+        utf8::encode_codepoint(cp, out);
+      });
+}
+
+template <typename Alloc>
+inline void to_utf16(
+    const char *s8, size_t l,
+    std::basic_string<char16_t, std::char_traits<char16_t>, Alloc> &out) {
+  detail::reserve_more(out, l);
+  utf8::for_each(
+      s8, l, [&](const char *s, size_t l, size_t beg, size_t end, size_t i) {
+        size_t bytes;
+        char32_t cp = 0;
+        utf8::decode_codepoint(&s[beg], (end - beg), bytes, cp);
+        utf16::encode_codepoint(cp, out);
+      });
+}
+
 inline std::string to_utf8(const char16_t *s16, size_t l) {
-  return utf8::encode(utf16::decode(s16, l));
+  std::string out;
+  to_utf8(s16, l, out);
+  return out;
 }
 
 inline std::string to_utf8(const std::u16string &s16) {
@@ -551,7 +706,9 @@ inline std::string to_utf8(const std::u16string &s16) {
 }
 
 inline std::u16string to_utf16(const char *s8, size_t l) {
-  return utf16::encode(utf8::decode(s8, l));
+  std::u16string out;
+  to_utf16(s8, l, out);
+  return out;
 }
 
 inline std::u16string to_utf16(const std::string &s8) {